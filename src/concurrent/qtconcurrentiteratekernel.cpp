@@ -27,6 +27,51 @@ static double elapsed(qint64 after, qint64 before)
 
 namespace QtConcurrent {
 
+static thread_local int theFixedBlockSize = 0;
+
+/*!
+  \since 6.9
+
+  Sets the size, in iterations, of the work blocks that the worker threads
+  reserve and process at a time to \a size, for all computations started from
+  the current thread after this call.
+
+  By default (and when \a size is \c 0), the block size is chosen adaptively:
+  each worker thread starts with single-iteration blocks and grows its block
+  size based on timing measurements. This suits workloads with expensive or
+  irregular iterations, but for cheap, uniform iterations over large
+  contiguous ranges the measurement phase and the unequal block sizes it
+  produces can leave bandwidth-bound computations short of memory saturation.
+  Setting a fixed block size makes the partitioning deterministic and
+  eliminates the measurement overhead. For a static even split across the
+  pool's threads, pass
+  \c{iterationCount / QThreadPool::globalInstance()->maxThreadCount()}.
+
+  The setting is thread-local: it is captured when a computation is started
+  and does not affect computations started from other threads. It only
+  applies to computations over random access iterators; other iterator
+  categories are always processed one iteration at a time.
+
+  \sa fixedBlockSize()
+*/
+void setFixedBlockSize(int size)
+{
+    theFixedBlockSize = qMax(size, 0);
+}
+
+/*!
+  \since 6.9
+
+  Returns the fixed work block size for computations started from the current
+  thread, or \c 0 if the block size is chosen adaptively (the default).
+
+  \sa setFixedBlockSize()
+*/
+int fixedBlockSize()
+{
+    return theFixedBlockSize;
+}
+
 /*!
   \class QtConcurrent::Median
   \inmodule QtConcurrent
@@ -20,6 +20,9 @@ QT_BEGIN_NAMESPACE
 
 namespace QtConcurrent {
 
+Q_CONCURRENT_EXPORT void setFixedBlockSize(int size);
+Q_CONCURRENT_EXPORT int fixedBlockSize();
+
 /*
     The BlockSizeManager class manages how many iterations a thread should
     reserve and process at a time. This is done by measuring the time spent
@@ -220,12 +223,14 @@ public:
     {
         BlockSizeManager blockSizeManager(ThreadEngineBase::threadPool, iterationCount);
         ResultReporter<T> resultReporter = createResultsReporter();
+        const bool adaptiveBlockSize = (fixedChunkSize == 0);
 
         for(;;) {
             if (this->isCanceled())
                 break;
 
-            const int currentBlockSize = blockSizeManager.blockSize();
+            const int currentBlockSize =
+                    adaptiveBlockSize ? blockSizeManager.blockSize() : fixedChunkSize;
 
             if (currentIndex.loadRelaxed() >= iterationCount)
                 break;
@@ -248,9 +253,11 @@ public:
             resultReporter.reserveSpace(finalBlockSize);
 
             // Call user code with the current iteration range.
-            blockSizeManager.timeBeforeUser();
+            if (adaptiveBlockSize)
+                blockSizeManager.timeBeforeUser();
             const bool resultsAvailable = this->runIterations(begin, beginIndex, endIndex, resultReporter.getPointer());
-            blockSizeManager.timeAfterUser();
+            if (adaptiveBlockSize)
+                blockSizeManager.timeAfterUser();
 
             if (resultsAvailable)
                 resultReporter.reportResults(beginIndex);
@@ -320,6 +327,8 @@ public:
     QAtomicInt iteratorThreads;
     QAtomicInt completed;
     const int iterationCount;
+    // Captured on the thread that starts the computation; worker threads read it.
+    const int fixedChunkSize = QtConcurrent::fixedBlockSize();
     const bool forIteration;
     bool progressReportingEnabled;
     DefaultValueContainer<ResultType> defaultValue;
@@ -0,0 +1,221 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTCONCURRENT_PIPELINE_H
+#define QTCONCURRENT_PIPELINE_H
+
+#include <QtConcurrent/qtconcurrent_global.h>
+
+#if !defined(QT_NO_CONCURRENT) || defined(Q_QDOC)
+
+#include <QtCore/qfuture.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qpromise.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qwaitcondition.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtConcurrent {
+
+enum class PipelineOrder {
+    Unordered,
+    Ordered
+};
+
+template <typename T>
+class QChannel
+{
+public:
+    static constexpr qsizetype DefaultCapacity = 256;
+
+    explicit QChannel(qsizetype capacity = DefaultCapacity)
+        : m_capacity(qMax<qsizetype>(capacity, 1))
+    {
+    }
+
+    bool send(const T &value) { return sendImpl(value); }
+    bool send(T &&value) { return sendImpl(std::move(value)); }
+
+    std::optional<T> receive(quint64 *sequence = nullptr)
+    {
+        QMutexLocker locker(&m_mutex);
+        while (m_queue.empty() && !m_closed)
+            m_notEmpty.wait(&m_mutex);
+        if (m_queue.empty())
+            return std::nullopt;
+        if (sequence)
+            *sequence = m_popCount;
+        ++m_popCount;
+        std::optional<T> result(std::move(m_queue.front()));
+        m_queue.pop_front();
+        m_notFull.wakeOne();
+        return result;
+    }
+
+    void close()
+    {
+        QMutexLocker locker(&m_mutex);
+        m_closed = true;
+        // wake both receivers waiting for items and senders waiting for room
+        m_notEmpty.wakeAll();
+        m_notFull.wakeAll();
+    }
+
+    bool isClosed() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_closed;
+    }
+
+    qsizetype capacity() const noexcept { return m_capacity; }
+
+private:
+    Q_DISABLE_COPY_MOVE(QChannel)
+
+    template <typename U>
+    bool sendImpl(U &&value)
+    {
+        QMutexLocker locker(&m_mutex);
+        while (qsizetype(m_queue.size()) >= m_capacity && !m_closed)
+            m_notFull.wait(&m_mutex);
+        if (m_closed)
+            return false;
+        m_queue.push_back(std::forward<U>(value));
+        m_notEmpty.wakeOne();
+        return true;
+    }
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_notEmpty;
+    QWaitCondition m_notFull;
+    std::deque<T> m_queue;
+    const qsizetype m_capacity;
+    quint64 m_popCount = 0;
+    bool m_closed = false;
+};
+
+namespace QtPrivate {
+
+template <typename In, typename Out, typename MapFunctor>
+class PipelineStage : public std::enable_shared_from_this<PipelineStage<In, Out, MapFunctor>>
+{
+public:
+    PipelineStage(QThreadPool *pool, QChannel<In> *source, QChannel<Out> *sink,
+                  MapFunctor map, int workerCount, bool ordered)
+        : m_pool(pool),
+          m_source(source),
+          m_sink(sink),
+          m_map(std::move(map)),
+          m_workerCount(workerCount),
+          m_ordered(ordered)
+    {
+    }
+
+    QFuture<void> start()
+    {
+        m_promise.start();
+        m_activeWorkers.storeRelaxed(m_workerCount);
+        for (int i = 0; i < m_workerCount; ++i) {
+            m_pool->start(QRunnable::create(
+                    [self = this->shared_from_this()] { self->runWorker(); }));
+        }
+        return m_promise.future();
+    }
+
+private:
+    void runWorker()
+    {
+        while (!m_promise.isCanceled() && !m_failed.loadRelaxed()) {
+            quint64 sequence = 0;
+            std::optional<In> item = m_source->receive(&sequence);
+            if (!item)
+                break;  // source closed and drained
+#ifndef QT_NO_EXCEPTIONS
+            try {
+#endif
+                if (m_ordered)
+                    emitOrdered(sequence, m_map(*std::move(item)));
+                else
+                    m_sink->send(m_map(*std::move(item)));
+#ifndef QT_NO_EXCEPTIONS
+            } catch (...) {
+                if (!m_failed.fetchAndStoreOrdered(1))
+                    m_promise.setException(std::current_exception());
+                break;
+            }
+#endif
+        }
+        if (!m_activeWorkers.deref()) {
+            // last worker out: downstream stages see end-of-stream
+            m_sink->close();
+            m_promise.finish();
+        }
+    }
+
+    void emitOrdered(quint64 sequence, Out result)
+    {
+        QMutexLocker locker(&m_reorderMutex);
+        if (sequence != m_nextToEmit) {
+            m_pending.emplace(sequence, std::move(result));
+            return;
+        }
+        m_sink->send(std::move(result));
+        ++m_nextToEmit;
+        auto it = m_pending.begin();
+        while (it != m_pending.end() && it->first == m_nextToEmit) {
+            m_sink->send(std::move(it->second));
+            ++m_nextToEmit;
+            it = m_pending.erase(it);
+        }
+    }
+
+    QThreadPool *m_pool;
+    QChannel<In> *m_source;
+    QChannel<Out> *m_sink;
+    MapFunctor m_map;
+    const int m_workerCount;
+    const bool m_ordered;
+    QPromise<void> m_promise;
+    QAtomicInt m_activeWorkers;
+    QAtomicInt m_failed;
+    QMutex m_reorderMutex;
+    std::map<quint64, Out> m_pending;
+    quint64 m_nextToEmit = 0;
+};
+
+} // namespace QtPrivate
+
+template <typename In, typename Out, typename MapFunctor>
+QFuture<void> mapPipeline(QThreadPool *pool, QChannel<In> &source, QChannel<Out> &sink,
+                          MapFunctor &&map, int maxInFlight = 0,
+                          PipelineOrder order = PipelineOrder::Unordered)
+{
+    const int workerCount = maxInFlight > 0 ? maxInFlight : pool->maxThreadCount();
+    using Stage = QtPrivate::PipelineStage<In, Out, std::decay_t<MapFunctor>>;
+    auto stage = std::make_shared<Stage>(pool, &source, &sink, std::forward<MapFunctor>(map),
+                                         qMax(workerCount, 1), order == PipelineOrder::Ordered);
+    return stage->start();
+}
+
+template <typename In, typename Out, typename MapFunctor>
+QFuture<void> mapPipeline(QChannel<In> &source, QChannel<Out> &sink, MapFunctor &&map,
+                          int maxInFlight = 0, PipelineOrder order = PipelineOrder::Unordered)
+{
+    return mapPipeline(QThreadPool::globalInstance(), source, sink,
+                       std::forward<MapFunctor>(map), maxInFlight, order);
+}
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // !defined(QT_NO_CONCURRENT)
+
+#endif // QTCONCURRENT_PIPELINE_H
@@ -0,0 +1,274 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtconcurrenttaskgraph.h"
+
+#if !defined(QT_NO_CONCURRENT)
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qpromise.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qvarlengtharray.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtConcurrent {
+
+/*!
+    \class QtConcurrent::QTaskGraph
+    \inmodule QtConcurrent
+    \brief The QTaskGraph class runs a graph of dependent tasks on a thread pool.
+    \since 6.9
+
+    \ingroup thread
+
+    QtConcurrent::run() and QtConcurrent::task() express independent tasks.
+    Workloads shaped like a build pipeline, where a task may only start once
+    other tasks have produced their output, would otherwise have to encode
+    the dependencies by blocking pool threads in QFuture::waitForFinished(),
+    wasting a worker per blocked edge.
+
+    QTaskGraph instead schedules the tasks itself: declare each task with
+    addTask(), passing the ids of the tasks it depends on, then call submit().
+    A task is handed to the thread pool the moment its last dependency has
+    finished; no thread ever blocks waiting for a dependency. submit() returns
+    a QFuture<void> that finishes when the whole graph has run.
+
+    \section1 Cancellation and errors
+
+    Canceling the returned future stops tasks that have not started yet from
+    running; tasks that are already executing run to completion. The future
+    still finishes once the graph has drained.
+
+    If a task throws an exception, the remaining unstarted tasks are skipped
+    and the first exception is rethrown when the result of the future is
+    requested, matching the behavior of QtConcurrent::run().
+
+    \section1 Priorities
+
+    Each task may be given a QThreadPool priority. Because a low-priority
+    task may gate a high-priority one, priorities propagate backwards through
+    the graph: a task is scheduled with the highest priority of itself and
+    all tasks that (transitively) depend on it.
+
+    \sa QtConcurrent::run(), QtConcurrent::task(), QThreadPool
+*/
+
+class QTaskGraphPrivate : public std::enable_shared_from_this<QTaskGraphPrivate>
+{
+public:
+    struct Node
+    {
+        std::function<void()> task;
+        QList<int> successors;
+        int dependencyCount = 0;
+        int priority = 0;
+        int effectivePriority = 0;
+        QAtomicInt remainingDependencies;
+    };
+
+    explicit QTaskGraphPrivate(QThreadPool *pool)
+        : pool(pool ? pool : QThreadPool::globalInstance())
+    {
+    }
+
+    QFuture<void> submit();
+    bool computeSchedule();
+    void startNode(int index);
+    void runNode(int index);
+    void nodeFinished(int index);
+    bool shouldSkipTasks() const
+    {
+        return promise.isCanceled() || failed.loadRelaxed();
+    }
+
+    QThreadPool *pool;
+    QList<Node> nodes;
+    QPromise<void> promise;
+    QAtomicInt remainingNodes;
+    QAtomicInt failed;
+    bool submitted = false;
+};
+
+/*
+    Verifies that the graph is acyclic and computes the effective priority of
+    every node. Kahn's algorithm gives a topological order; walking it in
+    reverse propagates each node's priority to all its dependencies.
+*/
+bool QTaskGraphPrivate::computeSchedule()
+{
+    const qsizetype count = nodes.size();
+    QVarLengthArray<int, 64> order;
+    order.reserve(count);
+    QVarLengthArray<int, 64> pending(count);
+    for (qsizetype i = 0; i < count; ++i)
+        pending[i] = nodes[i].dependencyCount;
+    for (qsizetype i = 0; i < count; ++i) {
+        if (pending[i] == 0)
+            order.append(int(i));
+    }
+    for (qsizetype i = 0; i < order.size(); ++i) {
+        for (int successor : std::as_const(nodes[order[i]].successors)) {
+            if (--pending[successor] == 0)
+                order.append(successor);
+        }
+    }
+    if (order.size() != count)
+        return false; // a cycle keeps some nodes unreachable
+
+    for (qsizetype i = order.size() - 1; i >= 0; --i) {
+        Node &node = nodes[order[i]];
+        node.effectivePriority = node.priority;
+        for (int successor : std::as_const(node.successors)) {
+            node.effectivePriority =
+                    qMax(node.effectivePriority, nodes[successor].effectivePriority);
+        }
+    }
+    return true;
+}
+
+QFuture<void> QTaskGraphPrivate::submit()
+{
+    submitted = true;
+    promise.start();
+    QFuture<void> future = promise.future();
+
+    if (!computeSchedule()) {
+        qWarning("QTaskGraph::submit: the task graph contains a cycle");
+        future.cancel();
+        promise.finish();
+        return future;
+    }
+
+    if (nodes.isEmpty()) {
+        promise.finish();
+        return future;
+    }
+
+    remainingNodes.storeRelaxed(int(nodes.size()));
+    for (qsizetype i = 0; i < nodes.size(); ++i) {
+        nodes[i].remainingDependencies.storeRelaxed(nodes[i].dependencyCount);
+        if (nodes[i].dependencyCount == 0)
+            startNode(int(i));
+    }
+    return future;
+}
+
+void QTaskGraphPrivate::startNode(int index)
+{
+    // the runnable keeps the graph state alive until the last node has run
+    auto self = shared_from_this();
+    pool->start(QRunnable::create([self = std::move(self), index] { self->runNode(index); }),
+                nodes[index].effectivePriority);
+}
+
+void QTaskGraphPrivate::runNode(int index)
+{
+    if (!shouldSkipTasks()) {
+#ifndef QT_NO_EXCEPTIONS
+        try {
+            nodes[index].task();
+        } catch (...) {
+            if (!failed.fetchAndStoreOrdered(1))
+                promise.setException(std::current_exception());
+        }
+#else
+        nodes[index].task();
+#endif
+    }
+    nodeFinished(index);
+}
+
+void QTaskGraphPrivate::nodeFinished(int index)
+{
+    for (int successor : std::as_const(nodes[index].successors)) {
+        // deref() returns false when the counter reaches zero, i.e. when
+        // this node was the successor's last outstanding dependency
+        if (!nodes[successor].remainingDependencies.deref())
+            startNode(successor);
+    }
+    if (!remainingNodes.deref())
+        promise.finish();
+}
+
+/*!
+    Constructs an empty task graph that will run its tasks on \a pool, or on
+    QThreadPool::globalInstance() if \a pool is \nullptr.
+*/
+QTaskGraph::QTaskGraph(QThreadPool *pool)
+    : d(std::make_shared<QTaskGraphPrivate>(pool))
+{
+}
+
+/*!
+    Destroys the task graph. A submitted graph keeps running; destroying the
+    QTaskGraph object does not cancel it.
+*/
+QTaskGraph::~QTaskGraph() = default;
+
+/*!
+    Adds \a task to the graph and returns its id. The task will not start
+    before all tasks in \a dependencies have finished. \a priority is the
+    QThreadPool priority the task is scheduled with; see the class
+    description for how priorities propagate along dependency edges.
+
+    Ids of dependencies must come from earlier addTask() calls on the same
+    graph, which also guarantees that the graph stays acyclic.
+
+    This function must not be called after submit().
+*/
+QTaskGraph::TaskId QTaskGraph::addTask(std::function<void()> task,
+                                       std::initializer_list<TaskId> dependencies, int priority)
+{
+    return addTask(std::move(task), QList<TaskId>(dependencies), priority);
+}
+
+/*!
+    \overload
+*/
+QTaskGraph::TaskId QTaskGraph::addTask(std::function<void()> task,
+                                       const QList<TaskId> &dependencies, int priority)
+{
+    Q_ASSERT_X(!d->submitted, "QTaskGraph::addTask",
+               "tasks cannot be added after the graph was submitted");
+    const TaskId id = TaskId(d->nodes.size());
+    QTaskGraphPrivate::Node node;
+    node.task = std::move(task);
+    node.priority = priority;
+    for (TaskId dependency : dependencies) {
+        if (dependency < 0 || dependency >= id) {
+            qWarning("QTaskGraph::addTask: invalid dependency id %d ignored", dependency);
+            continue;
+        }
+        ++node.dependencyCount;
+        d->nodes[dependency].successors.append(id);
+    }
+    d->nodes.append(std::move(node));
+    return id;
+}
+
+/*!
+    Submits the graph for execution and returns a future that finishes once
+    all tasks have run. Tasks without dependencies are handed to the thread
+    pool immediately; every other task is scheduled, without blocking any
+    pool thread, as soon as its last dependency finishes.
+
+    Canceling the future prevents tasks that have not started from running.
+    submit() may be called only once per graph; an empty graph yields an
+    already-finished future.
+*/
+QFuture<void> QTaskGraph::submit()
+{
+    if (d->submitted) {
+        qWarning("QTaskGraph::submit: the graph was already submitted");
+        return QFuture<void>();
+    }
+    return d->submit();
+}
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_CONCURRENT
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTCONCURRENT_TASKGRAPH_H
+#define QTCONCURRENT_TASKGRAPH_H
+
+#include <QtConcurrent/qtconcurrent_global.h>
+
+#if !defined(QT_NO_CONCURRENT) || defined(Q_QDOC)
+
+#include <QtCore/qfuture.h>
+#include <QtCore/qlist.h>
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QThreadPool;
+
+namespace QtConcurrent {
+
+class QTaskGraphPrivate;
+
+class Q_CONCURRENT_EXPORT QTaskGraph
+{
+public:
+    using TaskId = int;
+
+    explicit QTaskGraph(QThreadPool *pool = nullptr);
+    ~QTaskGraph();
+
+    TaskId addTask(std::function<void()> task, std::initializer_list<TaskId> dependencies = {},
+                   int priority = 0);
+    TaskId addTask(std::function<void()> task, const QList<TaskId> &dependencies,
+                   int priority = 0);
+
+    QFuture<void> submit();
+
+private:
+    Q_DISABLE_COPY(QTaskGraph)
+    std::shared_ptr<QTaskGraphPrivate> d;
+};
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // !defined(QT_NO_CONCURRENT)
+
+#endif // QTCONCURRENT_TASKGRAPH_H
@@ -227,6 +227,26 @@ char buf[32];
 }
 ")
 
+# fanotify
+qt_config_compile_test(fanotify
+    LABEL "fanotify"
+    CODE
+"#include <sys/fanotify.h>
+#include <fcntl.h>
+
+int main(void)
+{
+    /* BEGIN TEST: */
+fanotify_init(FAN_CLASS_NOTIF | FAN_REPORT_DFID_NAME, O_RDONLY);
+fanotify_mark(0, FAN_MARK_ADD | FAN_MARK_FILESYSTEM,
+              FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_ONDIR,
+              -1, \"foobar\");
+(void) FAN_EVENT_INFO_TYPE_DFID_NAME;
+    /* END TEST: */
+    return 0;
+}
+")
+
 # inotify
 qt_config_compile_test(inotify
     LABEL "inotify"
@@ -533,6 +553,10 @@ qt_feature("dladdr" PRIVATE
     LABEL "dladdr"
     CONDITION QT_FEATURE_dlopen AND TEST_dladdr
 )
+qt_feature("fanotify" PRIVATE
+    LABEL "fanotify"
+    CONDITION LINUX AND TEST_fanotify
+)
 qt_feature("futimens" PRIVATE
     LABEL "futimens()"
     CONDITION NOT WIN32 AND TEST_futimens
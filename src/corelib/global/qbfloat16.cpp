@@ -0,0 +1,282 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qbfloat16.h"
+#include "private/qsimd_p.h"
+#include <cmath> // for fpclassify()'s return values
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class qbfloat16
+    \keyword bfloat16 Support
+    \ingroup funclists
+    \inmodule QtCore
+    \inheaderfile QBFloat16
+    \brief Provides 16-bit brain floating point support.
+    \since 6.9
+
+    \compares partial
+    \compareswith partial float double {long double} int long qint64
+    \endcompareswith
+
+    The \c qbfloat16 class provides support for the bfloat16 format: the most
+    significant 16 bits of an IEEE 754 single-precision value. Compared to
+    \l qfloat16 it keeps the full 8-bit exponent range of \c float at the cost
+    of mantissa precision (8 bits instead of 11), which makes it a popular
+    storage format for machine-learning style data where dynamic range matters
+    more than precision.
+
+    \c qbfloat16 is a storage type: any arithmetic operation on a \c qbfloat16
+    instance results in the value first being converted to a \c float. Since
+    bfloat16 is simply a truncated \c float, both conversion directions are
+    cheap integer operations and need no hardware floating-point support.
+
+    Use qFloatToBFloat16() and qFloatFromBFloat16() to convert whole arrays;
+    they use SIMD where the compiler provides it.
+
+    \sa qfloat16
+*/
+
+/*!
+    \fn qbfloat16::qbfloat16(Qt::Initialization)
+
+    Constructs a qbfloat16 without initializing the value.
+*/
+
+/*!
+    \fn bool qIsInf(qbfloat16 f)
+    \relates qbfloat16
+    \overload qIsInf(float)
+
+    Returns true if the \c qbfloat16 \a {f} is equivalent to infinity.
+*/
+
+/*!
+    \fn bool qIsNaN(qbfloat16 f)
+    \relates qbfloat16
+    \overload qIsNaN(float)
+
+    Returns true if the \c qbfloat16 \a {f} is not a number (NaN).
+*/
+
+/*!
+    \fn bool qIsFinite(qbfloat16 f)
+    \relates qbfloat16
+    \overload qIsFinite(float)
+
+    Returns true if the \c qbfloat16 \a {f} is a finite number.
+*/
+
+/*!
+    \fn bool qbfloat16::isNormal() const noexcept
+
+    Returns \c true if this \c qbfloat16 value is finite and in normal form.
+
+    \sa qFpClassify()
+*/
+
+/*!
+    \fn qbfloat16 qbfloat16::copySign(qbfloat16 sign) const noexcept
+
+    Returns a qbfloat16 with the sign of \a sign but the rest of its value
+    taken from this qbfloat16. Serves as qbfloat16's equivalent of
+    std::copysign().
+*/
+
+/*!
+    \fn int qFpClassify(qbfloat16 val)
+    \relates qbfloat16
+    \overload qFpClassify(float)
+
+    Returns the floating-point class of \a val.
+*/
+
+/*!
+    \internal
+    Implements qFpClassify() for qbfloat16.
+*/
+int qbfloat16::fpClassify() const noexcept
+{
+    return isInf() ? FP_INFINITE : isNaN() ? FP_NAN
+        : !(b16 & 0x7fff) ? FP_ZERO : isNormal() ? FP_NORMAL : FP_SUBNORMAL;
+}
+
+/*! \fn int qRound(qbfloat16 value)
+    \relates qbfloat16
+    \overload qRound(float)
+
+    Rounds \a value to the nearest integer.
+*/
+
+/*! \fn qint64 qRound64(qbfloat16 value)
+    \relates qbfloat16
+    \overload qRound64(float)
+
+    Rounds \a value to the nearest 64-bit integer.
+*/
+
+/*! \fn bool qFuzzyCompare(qbfloat16 p1, qbfloat16 p2)
+    \relates qbfloat16
+    \overload qFuzzyCompare(float, float)
+
+    Compares the floating point value \a p1 and \a p2 and
+    returns \c true if they are considered equal, otherwise \c false.
+
+    The two numbers are compared in a relative way, where the
+    exactness is stronger the smaller the numbers are.
+ */
+
+#if defined(__SSE2__)
+static void qFloatToBFloat16_fast(quint16 *out, const float *in, qsizetype len) noexcept
+{
+    qsizetype i = 0;
+    const __m128i absMask = _mm_set1_epi32(0x7fffffff);
+    const __m128i infinity = _mm_set1_epi32(0x7f800000);
+    const __m128i rounding = _mm_set1_epi32(0x7fff);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i quietBit = _mm_set1_epi32(0x0040);
+
+    auto convertOneVector = [=](const float *src) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        // NaN has to survive the truncation, so force the mantissa's
+        // quiet bit for those lanes instead of rounding
+        __m128i isNaN = _mm_cmpgt_epi32(_mm_and_si128(v, absMask), infinity);
+        // round half to even: add 0x7fff plus the last kept bit, truncate
+        __m128i rounded = _mm_add_epi32(v, rounding);
+        rounded = _mm_add_epi32(rounded, _mm_and_si128(_mm_srli_epi32(v, 16), one));
+        // the arithmetic shift keeps the values in packs's [-2^15, 2^15)
+        // saturation range, so the pack below is lossless
+        rounded = _mm_srai_epi32(rounded, 16);
+        __m128i nanValue = _mm_or_si128(_mm_srai_epi32(v, 16), quietBit);
+        return _mm_or_si128(_mm_and_si128(isNaN, nanValue),
+                            _mm_andnot_si128(isNaN, rounded));
+    };
+
+    for (; i + 8 <= len; i += 8) {
+        __m128i f16 = _mm_packs_epi32(convertOneVector(in + i), convertOneVector(in + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), f16);
+    }
+    SIMD_EPILOGUE(i, len, 7) {
+        float f = in[i];
+        quint32 u;
+        memcpy(&u, &f, sizeof(quint32));
+        if ((u & 0x7fffffff) > 0x7f800000)
+            out[i] = quint16((u >> 16) | 0x0040);
+        else
+            out[i] = quint16((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+    }
+}
+
+static void qFloatFromBFloat16_fast(float *out, const quint16 *in, qsizetype len) noexcept
+{
+    qsizetype i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= len; i += 8) {
+        __m128i f16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        // widening is a 16-bit left shift; interleaving with zero does
+        // that for four lanes at a time
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                         _mm_unpacklo_epi16(zero, f16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i + 4),
+                         _mm_unpackhi_epi16(zero, f16));
+    }
+    SIMD_EPILOGUE(i, len, 7) {
+        quint32 u = quint32(in[i]) << 16;
+        memcpy(out + i, &u, sizeof(quint32));
+    }
+}
+#elif defined(__ARM_NEON__)
+static void qFloatToBFloat16_fast(quint16 *out, const float *in, qsizetype len) noexcept
+{
+    qsizetype i = 0;
+    for (; i < len - 3; i += 4) {
+        uint32x4_t v = vld1q_u32(reinterpret_cast<const quint32 *>(in + i));
+        uint32x4_t isNaN = vcgtq_u32(vandq_u32(v, vdupq_n_u32(0x7fffffff)),
+                                     vdupq_n_u32(0x7f800000));
+        uint32x4_t rounded = vaddq_u32(v, vdupq_n_u32(0x7fff));
+        rounded = vaddq_u32(rounded, vandq_u32(vshrq_n_u32(v, 16), vdupq_n_u32(1)));
+        rounded = vshrq_n_u32(rounded, 16);
+        uint32x4_t nanValue = vorrq_u32(vshrq_n_u32(v, 16), vdupq_n_u32(0x0040));
+        uint32x4_t result = vbslq_u32(isNaN, nanValue, rounded);
+        vst1_u16(out + i, vmovn_u32(result));
+    }
+    SIMD_EPILOGUE(i, len, 3) {
+        float f = in[i];
+        quint32 u;
+        memcpy(&u, &f, sizeof(quint32));
+        if ((u & 0x7fffffff) > 0x7f800000)
+            out[i] = quint16((u >> 16) | 0x0040);
+        else
+            out[i] = quint16((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+    }
+}
+
+static void qFloatFromBFloat16_fast(float *out, const quint16 *in, qsizetype len) noexcept
+{
+    qsizetype i = 0;
+    for (; i < len - 3; i += 4) {
+        uint32x4_t v = vshll_n_u16(vld1_u16(in + i), 16);
+        vst1q_u32(reinterpret_cast<quint32 *>(out + i), v);
+    }
+    SIMD_EPILOGUE(i, len, 3) {
+        quint32 u = quint32(in[i]) << 16;
+        memcpy(out + i, &u, sizeof(quint32));
+    }
+}
+#else
+static void qFloatToBFloat16_fast(quint16 *out, const float *in, qsizetype len) noexcept
+{
+    for (qsizetype i = 0; i < len; ++i) {
+        float f = in[i];
+        quint32 u;
+        memcpy(&u, &f, sizeof(quint32));
+        if ((u & 0x7fffffff) > 0x7f800000)
+            out[i] = quint16((u >> 16) | 0x0040);
+        else
+            out[i] = quint16((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+    }
+}
+
+static void qFloatFromBFloat16_fast(float *out, const quint16 *in, qsizetype len) noexcept
+{
+    for (qsizetype i = 0; i < len; ++i) {
+        quint32 u = quint32(in[i]) << 16;
+        memcpy(out + i, &u, sizeof(quint32));
+    }
+}
+#endif
+
+/*!
+    \since 6.9
+    \relates qbfloat16
+
+    Converts \a len floats from \a in to qbfloat16 and stores them in \a out.
+    Both \a in and \a out must have \a len allocated entries.
+
+    Values are rounded to nearest, ties to even; NaNs keep their payload's
+    most significant bits, with the quiet bit forced on so they stay NaN.
+    This function is faster than converting values one by one and needs no
+    runtime CPU detection, as bfloat16 conversion is pure integer work.
+*/
+Q_CORE_EXPORT void qFloatToBFloat16(qbfloat16 *out, const float *in, qsizetype len) noexcept
+{
+    qFloatToBFloat16_fast(reinterpret_cast<quint16 *>(out), in, len);
+}
+
+/*!
+    \since 6.9
+    \relates qbfloat16
+
+    Converts \a len qbfloat16 from \a in to floats and stores them in \a out.
+    Both \a in and \a out must have \a len allocated entries.
+
+    The conversion is exact: every qbfloat16 value is representable as a
+    \c float.
+*/
+Q_CORE_EXPORT void qFloatFromBFloat16(float *out, const qbfloat16 *in, qsizetype len) noexcept
+{
+    qFloatFromBFloat16_fast(out, reinterpret_cast<const quint16 *>(in), len);
+}
+
+QT_END_NAMESPACE
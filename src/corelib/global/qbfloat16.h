@@ -0,0 +1,283 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QBFLOAT16_H
+#define QBFLOAT16_H
+
+#include <QtCore/qcompare.h>
+#include <QtCore/qglobal.h>
+#include <QtCore/qhashfunctions.h>
+#include <QtCore/qmath.h>
+#include <QtCore/qnamespace.h>
+#include <QtCore/qtypes.h>
+
+#include <limits>
+#include <string.h>
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+#if 0
+#pragma qt_class(QBFloat16)
+#pragma qt_no_master_include
+#endif
+
+class qbfloat16
+{
+    struct Wrap
+    {
+        // To let our private constructor work, without other code seeing
+        // ambiguity when constructing from int, double &c.
+        quint16 b16;
+        constexpr inline explicit Wrap(int value) : b16(quint16(value)) {}
+    };
+
+public:
+    constexpr inline qbfloat16() noexcept : b16(0) {}
+    explicit qbfloat16(Qt::Initialization) noexcept { }
+
+    inline qbfloat16(float f) noexcept;
+    inline operator float() const noexcept;
+
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, float>>>
+    constexpr explicit qbfloat16(T value) noexcept : qbfloat16(float(value)) {}
+
+    // Support for qIs{Inf,NaN,Finite}:
+    bool isInf() const noexcept { return (b16 & 0x7fff) == 0x7f80; }
+    bool isNaN() const noexcept { return (b16 & 0x7fff) > 0x7f80; }
+    bool isFinite() const noexcept { return (b16 & 0x7fff) < 0x7f80; }
+    Q_CORE_EXPORT int fpClassify() const noexcept;
+    // Can't specialize std::copysign() for qbfloat16
+    qbfloat16 copySign(qbfloat16 sign) const noexcept
+    { return qbfloat16(Wrap((sign.b16 & 0x8000) | (b16 & 0x7fff))); }
+
+    // Support for std::numeric_limits<qbfloat16>
+    static constexpr qbfloat16 _limit_epsilon()    noexcept { return qbfloat16(Wrap(0x3c00)); }
+    static constexpr qbfloat16 _limit_min()        noexcept { return qbfloat16(Wrap(0x0080)); }
+    static constexpr qbfloat16 _limit_denorm_min() noexcept { return qbfloat16(Wrap(1)); }
+    static constexpr qbfloat16 _limit_max()        noexcept { return qbfloat16(Wrap(0x7f7f)); }
+    static constexpr qbfloat16 _limit_lowest()     noexcept { return qbfloat16(Wrap(0xff7f)); }
+    static constexpr qbfloat16 _limit_infinity()   noexcept { return qbfloat16(Wrap(0x7f80)); }
+    static constexpr qbfloat16 _limit_quiet_NaN()  noexcept { return qbfloat16(Wrap(0x7fc0)); }
+#if QT_CONFIG(signaling_nan)
+    static constexpr qbfloat16 _limit_signaling_NaN() noexcept { return qbfloat16(Wrap(0x7fa0)); }
+#endif
+
+    inline constexpr bool isNormal() const noexcept
+    { return (b16 & 0x7f80) && (b16 & 0x7f80) != 0x7f80; }
+
+private:
+    quint16 b16;
+    constexpr inline explicit qbfloat16(Wrap nibble) noexcept : b16(nibble.b16) {}
+
+    friend bool qIsNull(qbfloat16 f) noexcept;
+
+    friend inline qbfloat16 operator-(qbfloat16 a) noexcept
+    {
+        qbfloat16 f;
+        f.b16 = a.b16 ^ quint16(0x8000);
+        return f;
+    }
+
+    friend inline qbfloat16 operator+(qbfloat16 a, qbfloat16 b) noexcept { return qbfloat16(float(a) + float(b)); }
+    friend inline qbfloat16 operator-(qbfloat16 a, qbfloat16 b) noexcept { return qbfloat16(float(a) - float(b)); }
+    friend inline qbfloat16 operator*(qbfloat16 a, qbfloat16 b) noexcept { return qbfloat16(float(a) * float(b)); }
+    friend inline qbfloat16 operator/(qbfloat16 a, qbfloat16 b) noexcept { return qbfloat16(float(a) / float(b)); }
+
+    friend size_t qHash(qbfloat16 key, size_t seed = 0) noexcept
+    { return qHash(float(key), seed); }
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_GCC("-Wfloat-conversion")
+
+#define QBF16_MAKE_ARITH_OP_FP(FP, OP) \
+    friend inline FP operator OP(qbfloat16 lhs, FP rhs) noexcept { return static_cast<FP>(lhs) OP rhs; } \
+    friend inline FP operator OP(FP lhs, qbfloat16 rhs) noexcept { return lhs OP static_cast<FP>(rhs); }
+#define QBF16_MAKE_ARITH_OP_EQ_FP(FP, OP_EQ, OP) \
+    friend inline qbfloat16& operator OP_EQ(qbfloat16& lhs, FP rhs) noexcept \
+    { lhs = qbfloat16(float(static_cast<FP>(lhs) OP rhs)); return lhs; }
+#define QBF16_MAKE_ARITH_OP(FP) \
+    QBF16_MAKE_ARITH_OP_FP(FP, +) \
+    QBF16_MAKE_ARITH_OP_FP(FP, -) \
+    QBF16_MAKE_ARITH_OP_FP(FP, *) \
+    QBF16_MAKE_ARITH_OP_FP(FP, /) \
+    QBF16_MAKE_ARITH_OP_EQ_FP(FP, +=, +) \
+    QBF16_MAKE_ARITH_OP_EQ_FP(FP, -=, -) \
+    QBF16_MAKE_ARITH_OP_EQ_FP(FP, *=, *) \
+    QBF16_MAKE_ARITH_OP_EQ_FP(FP, /=, /)
+
+    QBF16_MAKE_ARITH_OP(long double)
+    QBF16_MAKE_ARITH_OP(double)
+    QBF16_MAKE_ARITH_OP(float)
+#undef QBF16_MAKE_ARITH_OP
+#undef QBF16_MAKE_ARITH_OP_EQ_FP
+#undef QBF16_MAKE_ARITH_OP_FP
+
+#define QBF16_MAKE_ARITH_OP_INT(OP) \
+    friend inline double operator OP(qbfloat16 lhs, int rhs) noexcept { return static_cast<double>(lhs) OP rhs; } \
+    friend inline double operator OP(int lhs, qbfloat16 rhs) noexcept { return lhs OP static_cast<double>(rhs); }
+
+    QBF16_MAKE_ARITH_OP_INT(+)
+    QBF16_MAKE_ARITH_OP_INT(-)
+    QBF16_MAKE_ARITH_OP_INT(*)
+    QBF16_MAKE_ARITH_OP_INT(/)
+#undef QBF16_MAKE_ARITH_OP_INT
+
+QT_WARNING_DISABLE_FLOAT_COMPARE
+
+    friend bool comparesEqual(const qbfloat16 &lhs, const qbfloat16 &rhs) noexcept
+    { return float(lhs) == float(rhs); }
+    friend Qt::partial_ordering compareThreeWay(const qbfloat16 &lhs, const qbfloat16 &rhs) noexcept
+    { return Qt::compareThreeWay(float(lhs), float(rhs)); }
+    Q_DECLARE_PARTIALLY_ORDERED(qbfloat16)
+
+#define QBF16_MAKE_ORDER_OP_FP(FP) \
+    friend bool comparesEqual(const qbfloat16 &lhs, FP rhs) noexcept \
+    { return static_cast<FP>(lhs) == rhs; } \
+    friend Qt::partial_ordering compareThreeWay(const qbfloat16 &lhs, FP rhs) noexcept \
+    { return Qt::compareThreeWay(static_cast<FP>(lhs), rhs); } \
+    Q_DECLARE_PARTIALLY_ORDERED(qbfloat16, FP)
+
+    QBF16_MAKE_ORDER_OP_FP(long double)
+    QBF16_MAKE_ORDER_OP_FP(double)
+    QBF16_MAKE_ORDER_OP_FP(float)
+#undef QBF16_MAKE_ORDER_OP_FP
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    friend bool comparesEqual(const qbfloat16 &lhs, T rhs) noexcept
+    { return float(lhs) == float(rhs); }
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    friend Qt::partial_ordering compareThreeWay(const qbfloat16 &lhs, T rhs) noexcept
+    { return Qt::compareThreeWay(float(lhs), float(rhs)); }
+
+    Q_DECLARE_PARTIALLY_ORDERED(qbfloat16, int)
+    Q_DECLARE_PARTIALLY_ORDERED(qbfloat16, long)
+    Q_DECLARE_PARTIALLY_ORDERED(qbfloat16, qint64)
+
+QT_WARNING_POP
+};
+
+Q_DECLARE_TYPEINFO(qbfloat16, Q_PRIMITIVE_TYPE);
+
+Q_CORE_EXPORT void qFloatToBFloat16(qbfloat16 *, const float *, qsizetype length) noexcept;
+Q_CORE_EXPORT void qFloatFromBFloat16(float *, const qbfloat16 *, qsizetype length) noexcept;
+
+// Complement qnumeric.h:
+[[nodiscard]] inline bool qIsInf(qbfloat16 f) noexcept { return f.isInf(); }
+[[nodiscard]] inline bool qIsNaN(qbfloat16 f) noexcept { return f.isNaN(); }
+[[nodiscard]] inline bool qIsFinite(qbfloat16 f) noexcept { return f.isFinite(); }
+[[nodiscard]] inline int qFpClassify(qbfloat16 f) noexcept { return f.fpClassify(); }
+
+// The remainder of these utility functions complement qglobal.h
+[[nodiscard]] inline int qRound(qbfloat16 d) noexcept
+{ return qRound(static_cast<float>(d)); }
+
+[[nodiscard]] inline qint64 qRound64(qbfloat16 d) noexcept
+{ return qRound64(static_cast<float>(d)); }
+
+[[nodiscard]] inline bool qFuzzyCompare(qbfloat16 p1, qbfloat16 p2) noexcept
+{
+    float f1 = static_cast<float>(p1);
+    float f2 = static_cast<float>(p2);
+    // The significand precision for bfloat16 is 8 bits (7 explicitly stored),
+    // or approximately 2 decimal digits. In selecting the fuzzy comparison
+    // factor of 12.9f (that is, (2^7+1)/10) below, we effectively select a
+    // window of about 1 (least significant) decimal digit about which the two
+    // operands can vary and still return true.
+    return (qAbs(f1 - f2) * 12.9f <= qMin(qAbs(f1), qAbs(f2)));
+}
+
+/*!
+  \internal
+*/
+[[nodiscard]] inline bool qFuzzyIsNull(qbfloat16 f) noexcept
+{
+    return qAbs(f) < 0.0775f; // 1/12.9 to 3 significant digits; see qFuzzyCompare()
+}
+
+[[nodiscard]] inline bool qIsNull(qbfloat16 f) noexcept
+{
+    return (f.b16 & static_cast<quint16>(0x7fff)) == 0;
+}
+
+inline int qIntCast(qbfloat16 f) noexcept
+{ return int(static_cast<float>(f)); }
+
+#ifndef Q_QDOC
+inline qbfloat16::qbfloat16(float f) noexcept
+{
+    quint32 u;
+    memcpy(&u, &f, sizeof(quint32));
+    if ((u & 0x7fffffff) > 0x7f800000) {
+        // NaN: truncate the mantissa, but keep it a (quiet) NaN
+        b16 = quint16((u >> 16) | 0x0040);
+        return;
+    }
+    // Round half to even: add one in the most significant bit we'll be
+    // discarding, plus one more if the last kept bit is set, then truncate.
+    u += 0x7fff + ((u >> 16) & 1);
+    b16 = quint16(u >> 16);
+}
+
+inline qbfloat16::operator float() const noexcept
+{
+    // bfloat16 is float with the low 16 mantissa bits dropped, so widening is
+    // a plain shift.
+    quint32 u = quint32(b16) << 16;
+    float f;
+    memcpy(&f, &u, sizeof(quint32));
+    return f;
+}
+#endif // Q_QDOC
+
+QT_END_NAMESPACE
+
+namespace std {
+template<>
+class numeric_limits<QT_PREPEND_NAMESPACE(qbfloat16)> : public numeric_limits<float>
+{
+public:
+    /*
+      Treat quint16 b16 as if it were:
+      uint S: 1; // b16 >> 15 (sign); can be set for zero
+      uint E: 8; // (b16 >> 7) & 0xff (offset exponent)
+      uint M: 7; // b16 & 0x7f (adjusted mantissa)
+
+      i.e. the top half of an IEEE 754 single-precision value.
+     */
+    static constexpr int digits = 8;
+
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) epsilon()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_epsilon(); }
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) (min)()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_min(); }
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) denorm_min()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_denorm_min(); }
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) (max)()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_max(); }
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) lowest()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_lowest(); }
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) infinity()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_infinity(); }
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) quiet_NaN()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_quiet_NaN(); }
+#if QT_CONFIG(signaling_nan)
+    static constexpr QT_PREPEND_NAMESPACE(qbfloat16) signaling_NaN()
+    { return QT_PREPEND_NAMESPACE(qbfloat16)::_limit_signaling_NaN(); }
+#else
+    static constexpr bool has_signaling_NaN = false;
+#endif
+};
+
+template<> class numeric_limits<const QT_PREPEND_NAMESPACE(qbfloat16)>
+    : public numeric_limits<QT_PREPEND_NAMESPACE(qbfloat16)> {};
+template<> class numeric_limits<volatile QT_PREPEND_NAMESPACE(qbfloat16)>
+    : public numeric_limits<QT_PREPEND_NAMESPACE(qbfloat16)> {};
+template<> class numeric_limits<const volatile QT_PREPEND_NAMESPACE(qbfloat16)>
+    : public numeric_limits<QT_PREPEND_NAMESPACE(qbfloat16)> {};
+} // namespace std
+
+#endif // QBFLOAT16_H
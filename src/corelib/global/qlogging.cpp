@@ -124,6 +124,13 @@ static QT_PREPEND_NAMESPACE(qint64) qt_gettid()
 #include <memory>
 #include <vector>
 
+#if !defined(QT_BOOTSTRAPPED) && QT_CONFIG(thread)
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
 #include <stdio.h>
 
 QT_BEGIN_NAMESPACE
@@ -2060,6 +2067,137 @@ static bool grabMessageHandler() { return true; }
 static void ungrabMessageHandler() { }
 #endif // (Q_COMPILER_THREAD_LOCAL)
 
+static void qt_message_print_now(QtMsgType msgType, const QMessageLogContext &context,
+                                 const QString &message)
+{
+    // prevent recursion in case the message handler generates messages
+    // itself, e.g. by using Qt API
+    if (grabMessageHandler()) {
+        const auto ungrab = qScopeGuard([]{ ungrabMessageHandler(); });
+        auto msgHandler = messageHandler.loadAcquire();
+        (msgHandler ? msgHandler : qDefaultMessageHandler)(msgType, context, message);
+    } else {
+        stderr_message_handler(msgType, context, message);
+    }
+}
+
+#if !defined(QT_BOOTSTRAPPED) && QT_CONFIG(thread)
+/*
+    Asynchronous logging, opt-in via QT_LOGGING_ASYNC=1: messages are queued
+    and the installed message handler runs on a single background writer
+    thread, so the logging thread doesn't block on formatting and I/O. Fatal
+    messages stay synchronous and flush the queue first, preserving ordering.
+
+    The records keep the unformatted message; qFormatLogMessage() runs in the
+    handler, i.e. on the writer thread.
+*/
+class QAsyncMessageWriter
+{
+public:
+    QAsyncMessageWriter() = default;
+    ~QAsyncMessageWriter()
+    {
+        {
+            const std::lock_guard locker(mutex);
+            stopping = true;
+            wakeWriter.notify_one();
+        }
+        if (writer.joinable())
+            writer.join();      // run() drains the queue before exiting
+    }
+
+    void enqueue(QtMsgType type, const QMessageLogContext &context, const QString &message)
+    {
+        Record record = { type, context.line, QByteArray(context.category),
+                          QByteArray(context.file), QByteArray(context.function), message };
+#ifdef QLOGGING_HAVE_BACKTRACE
+        if (context.version == QMessageLogContext::CurrentVersion + 1) {
+            // an internal context; carry its backtrace over to the writer
+            record.backtrace = static_cast<const QInternalMessageLogContext &>(context).backtrace;
+        }
+#endif
+        const std::lock_guard locker(mutex);
+        if (!writer.joinable())
+            writer = std::thread([this] { run(); });
+        queue.push_back(std::move(record));
+        wakeWriter.notify_one();
+    }
+
+    void flush()
+    {
+        std::unique_lock locker(mutex);
+        if (std::this_thread::get_id() == writer.get_id())
+            return;     // called from a handler on the writer thread
+        queueDrained.wait(locker, [this] { return queue.empty() && !dispatching; });
+    }
+
+private:
+    struct Record
+    {
+        QtMsgType type;
+        int line;
+        QByteArray category;
+        QByteArray file;
+        QByteArray function;
+        QString message;
+#ifdef QLOGGING_HAVE_BACKTRACE
+        std::optional<QInternalMessageLogContext::BacktraceStorage> backtrace;
+#endif
+    };
+
+    void run()
+    {
+        std::unique_lock locker(mutex);
+        for (;;) {
+            wakeWriter.wait(locker, [this] { return stopping || !queue.empty(); });
+            if (queue.empty())
+                break;      // stopping, and everything was drained
+            Record record = std::move(queue.front());
+            queue.pop_front();
+            dispatching = true;
+            locker.unlock();
+            dispatch(record);
+            locker.lock();
+            dispatching = false;
+            if (queue.empty())
+                queueDrained.notify_all();
+        }
+    }
+
+    static void dispatch(const Record &record)
+    {
+        auto cstr = [](const QByteArray &ba) { return ba.isNull() ? nullptr : ba.constData(); };
+        const QMessageLogContext copy(cstr(record.file), record.line, cstr(record.function),
+                                      cstr(record.category));
+        QInternalMessageLogContext context(copy);
+#ifdef QLOGGING_HAVE_BACKTRACE
+        // replace whatever the constructor captured on this thread with the
+        // backtrace recorded (or not) on the logging thread
+        context.backtrace = record.backtrace;
+#endif
+        qt_message_print_now(record.type, context, record.message);
+    }
+
+    std::mutex mutex;
+    std::condition_variable wakeWriter;
+    std::condition_variable queueDrained;
+    std::deque<Record> queue;
+    std::thread writer;
+    bool stopping = false;
+    bool dispatching = false;
+};
+
+Q_GLOBAL_STATIC(QAsyncMessageWriter, theAsyncMessageWriter)
+
+static QAsyncMessageWriter *asyncMessageWriter()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_LOGGING_ASYNC") > 0;
+    if (!enabled || theAsyncMessageWriter.isDestroyed())
+        return nullptr;     // fall back to synchronous printing
+    return theAsyncMessageWriter();
+}
+#endif // !QT_BOOTSTRAPPED && thread
+
 static void qt_message_print(QtMsgType msgType, const QMessageLogContext &context, const QString &message)
 {
 #ifndef QT_BOOTSTRAPPED
@@ -2074,15 +2212,17 @@ static void qt_message_print(QtMsgType msgType, const QMessageLogContext &contex
     }
 #endif
 
-    // prevent recursion in case the message handler generates messages
-    // itself, e.g. by using Qt API
-    if (grabMessageHandler()) {
-        const auto ungrab = qScopeGuard([]{ ungrabMessageHandler(); });
-        auto msgHandler = messageHandler.loadAcquire();
-        (msgHandler ? msgHandler : qDefaultMessageHandler)(msgType, context, message);
-    } else {
-        stderr_message_handler(msgType, context, message);
+#if !defined(QT_BOOTSTRAPPED) && QT_CONFIG(thread)
+    if (QAsyncMessageWriter *async = asyncMessageWriter()) {
+        if (msgType != QtFatalMsg) {
+            async->enqueue(msgType, context, message);
+            return;
+        }
+        async->flush();     // print queued messages ahead of the fatal one
     }
+#endif
+
+    qt_message_print_now(msgType, context, message);
 }
 
 template <typename String>
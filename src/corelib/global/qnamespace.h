@@ -417,6 +417,8 @@ namespace Qt {
 
         WA_StyleSheetTarget = 131,
 
+        WA_CachedSubtreeLayer = 132,
+
         // Add new attributes before this line
         WA_AttributeCount
     };
@@ -202,11 +202,28 @@ static void fallback_update_seed(unsigned value)
     seed.fetchAndXorRelaxed(value);
 }
 
+namespace {
+struct FallbackGenerator
+{
+    // We can't make the std::mt19937 itself thread_local: its constructor
+    // isn't constexpr, so the compiler would emit a guard variable and run it
+    // on first access. Instead, we store raw bytes (zero-initialized, so
+    // \c seeded starts out false) and construct the engine in-place once we
+    // have gathered the seed data.
+    bool seeded;
+    alignas(std::mt19937) uchar data[sizeof(std::mt19937)];
+    std::mt19937 &engine() { return *reinterpret_cast<std::mt19937 *>(data); }
+};
+} // unnamed namespace
+static_assert(std::is_trivially_destructible_v<std::mt19937>,
+              "std::mt19937 not trivially destructible as expected");
+Q_CONSTINIT static thread_local FallbackGenerator fallback_generator = {};
+
 Q_NEVER_INLINE
 #ifdef Q_CC_GNU
 __attribute__((cold))   // this function is pretty big, so optimize for size
 #endif
-static void fallback_fill(quint32 *ptr, qsizetype left) noexcept
+static void fallback_fill_seed(FallbackGenerator &fallback) noexcept
 {
     quint32 scratch[12];    // see element count below
     quint32 *end = scratch;
@@ -224,8 +241,6 @@ static void fallback_fill(quint32 *ptr, qsizetype left) noexcept
         }
     };
 
-    Q_ASSERT(left);
-
     *end++ = foldPointer(quintptr(&seed));          // 1: variable in this library/executable's .data
     *end++ = foldPointer(quintptr(&scratch));       // 2: variable in the stack
     *end++ = foldPointer(quintptr(&errno));         // 3: veriable either in libc or thread-specific
@@ -270,10 +285,20 @@ static void fallback_fill(quint32 *ptr, qsizetype left) noexcept
 
     Q_ASSERT(end <= std::end(scratch));
 
-    // this is highly inefficient, we should save the generator across calls...
     std::seed_seq sseq(scratch, end);
-    std::mt19937 generator(sseq);
-    std::generate(ptr, ptr + left, generator);
+    new (&fallback.engine()) std::mt19937(sseq);
+    fallback.seeded = true;
+}
+
+static void fallback_fill(quint32 *ptr, qsizetype left) noexcept
+{
+    // The generator is kept per thread across calls, so bulk fills that
+    // repeatedly land here only pay the seeding cost once.
+    FallbackGenerator &fallback = fallback_generator;
+    if (Q_UNLIKELY(!fallback.seeded))
+        fallback_fill_seed(fallback);
+
+    std::generate(ptr, ptr + left, [&]() { return fallback.engine()(); });
 
     fallback_update_seed(*ptr);
 }
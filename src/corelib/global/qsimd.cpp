@@ -760,6 +760,168 @@ QT_FUNCTION_TARGET(RDRND) qsizetype qRandomCpu(void *buffer, qsizetype count) no
 static bool checkRdrndWorks() noexcept { return false; }
 #endif // Q_PROCESSOR_X86 && RDRND
 
+/*!
+    \class QCpuFeatures
+    \inmodule QtCore
+    \since 6.9
+    \brief The QCpuFeatures class exposes Qt's runtime CPU feature detection.
+
+    \ingroup tools
+
+    Qt selects optimized implementations of many of its own routines at run
+    time, based on a CPU feature detection pass performed once at library
+    load. QCpuFeatures::hasFeature() makes the result of that same pass
+    available to applications, so their hand-written kernels can dispatch on
+    identical information instead of duplicating \c cpuid or \c hwcap
+    handling.
+
+    Querying a feature is cheap (an atomic load), but repeated dispatch is
+    better expressed with qCpuDispatch(), which resolves a table of
+    implementation variants to a plain function pointer. Resolving into a
+    static ensures the table is evaluated only once, at first use:
+
+    \code
+    static void transform_generic(float *data, qsizetype n);
+    static void transform_avx2(float *data, qsizetype n);    // built with AVX2 enabled
+    static void transform_avx512(float *data, qsizetype n);  // built with AVX-512 enabled
+
+    void transform(float *data, qsizetype n)
+    {
+        using Fn = void (*)(float *, qsizetype);
+        static const QCpuDispatchEntry<Fn> variants[] = {
+            { QCpuFeatures::Feature::ArchSkylakeAvx512, transform_avx512 },
+            { QCpuFeatures::Feature::ArchHaswell, transform_avx2 },
+        };
+        static const Fn fn = qCpuDispatch(variants, transform_generic);
+        fn(data, n);
+    }
+    \endcode
+
+    Features belonging to other processor architectures than the one the
+    application runs on are reported as not available, so a dispatch table may
+    freely mix x86 and ARM variants.
+
+    \sa qCpuDispatch()
+*/
+
+/*!
+    \enum QCpuFeatures::Feature
+
+    This enum names the CPU features that can be queried with hasFeature().
+
+    \value None No feature; always reported as available.
+    \value Sse2 x86 Streaming SIMD Extensions 2
+    \value Sse3 x86 Streaming SIMD Extensions 3
+    \value Ssse3 x86 Supplemental Streaming SIMD Extensions 3
+    \value Sse41 x86 Streaming SIMD Extensions 4.1
+    \value Sse42 x86 Streaming SIMD Extensions 4.2
+    \value Avx x86 Advanced Vector Extensions
+    \value Avx2 x86 Advanced Vector Extensions 2
+    \value F16c x86 16-bit floating point conversion instructions
+    \value Rdrnd x86 hardware random number generator
+    \value Sha x86 SHA-1 and SHA-256 instructions
+    \value Avx512F AVX-512 Foundation
+    \value Avx512BW AVX-512 Byte & Word
+    \value Avx512VL AVX-512 Vector Length
+    \value Vaes 256- and 512-bit AES instructions
+    \value ArchHaswell all features of the Haswell microarchitecture
+           (equivalent to the \c x86-64-v3 psABI level), the set Qt's own AVX2
+           code paths require
+    \value ArchSkylakeAvx512 all features of the Skylake server
+           microarchitecture (equivalent to the \c x86-64-v4 psABI level)
+    \value Neon ARM Advanced SIMD
+    \value Crc32 ARM CRC32 instructions
+    \value Aes ARM cryptographic extensions
+    \value Dsp MIPS DSP extension
+    \value DspR2 MIPS DSP revision 2 extension
+*/
+
+/*!
+    Returns \c true if the processor this application is running on supports
+    \a feature.
+
+    The detection runs once, when QtCore is loaded; this function only reads
+    its cached result. Features of foreign processor architectures return
+    \c false.
+*/
+bool QCpuFeatures::hasFeature(Feature feature) noexcept
+{
+    switch (feature) {
+    case Feature::None:
+        return true;
+#if defined(Q_PROCESSOR_X86)
+    case Feature::Sse2:
+        return qCpuHasFeature(SSE2);
+    case Feature::Sse3:
+        return qCpuHasFeature(SSE3);
+    case Feature::Ssse3:
+        return qCpuHasFeature(SSSE3);
+    case Feature::Sse41:
+        return qCpuHasFeature(SSE4_1);
+    case Feature::Sse42:
+        return qCpuHasFeature(SSE4_2);
+    case Feature::Avx:
+        return qCpuHasFeature(AVX);
+    case Feature::Avx2:
+        return qCpuHasFeature(AVX2);
+    case Feature::F16c:
+        return qCpuHasFeature(F16C);
+    case Feature::Rdrnd:
+        return qCpuHasFeature(RDRND);
+    case Feature::Sha:
+        return qCpuHasFeature(SHA);
+    case Feature::Avx512F:
+        return qCpuHasFeature(AVX512F);
+    case Feature::Avx512BW:
+        return qCpuHasFeature(AVX512BW);
+    case Feature::Avx512VL:
+        return qCpuHasFeature(AVX512VL);
+    case Feature::Vaes:
+        return qCpuHasFeature(VAES);
+    case Feature::ArchHaswell:
+        return qCpuHasFeature(ArchHaswell);
+    case Feature::ArchSkylakeAvx512:
+        return qCpuHasFeature(ArchSkylakeAvx512);
+#elif defined(Q_PROCESSOR_ARM)
+    case Feature::Neon:
+        return qCpuHasFeature(NEON);
+    case Feature::Crc32:
+        return qCpuHasFeature(CRC32);
+    case Feature::Aes:
+        return qCpuHasFeature(AES);
+#elif defined(Q_PROCESSOR_MIPS)
+    case Feature::Dsp:
+        return qCpuHasFeature(DSP);
+    case Feature::DspR2:
+        return qCpuHasFeature(DSPR2);
+#endif
+    default:
+        return false;
+    }
+}
+
+/*!
+    \fn template <typename FunctionPointer, std::size_t N> FunctionPointer qCpuDispatch(const QCpuDispatchEntry<FunctionPointer> (&entries)[N], FunctionPointer generic)
+    \relates QCpuFeatures
+    \since 6.9
+
+    Returns the function of the first entry of \a entries whose feature the
+    processor supports, or \a generic if none matches. Entries are tried in
+    order, so list the most demanding variant first.
+
+    \sa QCpuFeatures::hasFeature()
+*/
+
+/*!
+    \class QCpuDispatchEntry
+    \inmodule QtCore
+    \since 6.9
+    \brief An entry in a qCpuDispatch() table: a CPU feature and the function
+    variant requiring it.
+
+    \sa qCpuDispatch(), QCpuFeatures
+*/
+
 #if QT_SUPPORTS_INIT_PRIORITY
 namespace {
 struct QSimdInitializer
@@ -28,8 +28,10 @@
  *   given instruction set. The intrinsics for those instructions are
  *   #included and can be used without restriction or runtime check.
  *
- * Code that requires runtime detection and different code paths at runtime is
- * currently not supported here, have a look at qsimd_p.h for support.
+ * Code that requires runtime detection and different code paths at runtime
+ * can use QCpuFeatures::hasFeature() and qCpuDispatch() below, which are
+ * backed by the same detection Qt uses for its own optimized code paths
+ * (see qsimd_p.h).
  */
 
 #define QT_COMPILER_USES(feature) (1/QT_COMPILER_USES_##feature == 1)
@@ -128,7 +130,70 @@
 #define QT_VECTORCALL
 #endif
 
+#include <cstddef>
+
 QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QCpuFeatures
+{
+public:
+    enum class Feature : int {
+        None = 0,
+
+        // x86 and x86-64
+        Sse2,
+        Sse3,
+        Ssse3,
+        Sse41,
+        Sse42,
+        Avx,
+        Avx2,
+        F16c,
+        Rdrnd,
+        Sha,
+        Avx512F,
+        Avx512BW,
+        Avx512VL,
+        Vaes,
+        // complete x86-64 microarchitecture levels, as used by Qt's own
+        // dispatch: Haswell matches x86-64-v3, SkylakeAvx512 x86-64-v4
+        ArchHaswell,
+        ArchSkylakeAvx512,
+
+        // ARM
+        Neon,
+        Crc32,
+        Aes,
+
+        // MIPS
+        Dsp,
+        DspR2,
+    };
+
+    static bool hasFeature(Feature feature) noexcept;
+
+private:
+    QCpuFeatures() = delete;
+};
+
+template <typename FunctionPointer>
+struct QCpuDispatchEntry
+{
+    QCpuFeatures::Feature feature;
+    FunctionPointer function;
+};
+
+template <typename FunctionPointer, std::size_t N>
+FunctionPointer qCpuDispatch(const QCpuDispatchEntry<FunctionPointer> (&entries)[N],
+                             FunctionPointer generic) noexcept
+{
+    for (const QCpuDispatchEntry<FunctionPointer> &entry : entries) {
+        if (QCpuFeatures::hasFeature(entry.feature))
+            return entry.function;
+    }
+    return generic;
+}
+
 QT_END_NAMESPACE
 
 #endif // QSIMD_H
@@ -6,7 +6,12 @@
 #endif
 #include <QtCore/qglobal.h>
 
-#define FORKFD_NO_SPAWNFD
+// spawnfd() requires the fallback (pipe-based) forkfd implementation, so it is
+// only usable where the system has no native forkfd equivalent; QProcess uses
+// it on Darwin only (see QChildProcess::trySpawn() in qprocess_unix.cpp).
+#ifndef Q_OS_DARWIN
+#  define FORKFD_NO_SPAWNFD
+#endif
 #if defined(QT_NO_DEBUG) && !defined(NDEBUG)
 #  define NDEBUG
 #endif
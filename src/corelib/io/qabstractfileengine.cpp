@@ -818,6 +818,24 @@ bool QAbstractFileEngine::unmap(uchar *address)
     return extension(UnMapExtension, &options);
 }
 
+/*!
+    \since 6.9
+
+    Advises the operating system that \a length bytes of the file starting
+    at \a offset will be accessed according to the pattern \a advice.
+
+    The default implementation does nothing and returns \c false.
+
+    \sa map()
+ */
+bool QAbstractFileEngine::advise(qint64 offset, qint64 length, QFile::FileAdvice advice)
+{
+    Q_UNUSED(offset);
+    Q_UNUSED(length);
+    Q_UNUSED(advice);
+    return false;
+}
+
 /*!
     \since 5.10
 
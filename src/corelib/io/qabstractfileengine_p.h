@@ -123,6 +123,7 @@ public:
     bool atEnd() const;
     uchar *map(qint64 offset, qint64 size, QFile::MemoryMapFlags flags);
     bool unmap(uchar *ptr);
+    virtual bool advise(qint64 offset, qint64 length, QFile::FileAdvice advice);
 
     typedef QAbstractFileEngineIterator Iterator;
     using IteratorUniquePtr = std::unique_ptr<Iterator>;
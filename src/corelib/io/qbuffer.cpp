@@ -22,6 +22,7 @@ public:
 
     qint64 peek(char *data, qint64 maxSize) override;
     QByteArray peek(qint64 maxSize) override;
+    QByteArrayView peekView(qint64 maxSize) override;
 
 #ifndef QT_NO_QOBJECT
     // private slots
@@ -59,6 +60,16 @@ QByteArray QBufferPrivate::peek(qint64 maxSize)
     return QByteArray(buf->constData() + pos, readBytes);
 }
 
+QByteArrayView QBufferPrivate::peekView(qint64 maxSize)
+{
+    qint64 readBytes = static_cast<qint64>(buf->size()) - pos;
+    if (maxSize >= 0)
+        readBytes = qMin(maxSize, readBytes);
+    if (readBytes <= 0)
+        return {};
+    return QByteArrayView(buf->constData() + pos, qsizetype(readBytes));
+}
+
 /*!
     \class QBuffer
     \inmodule QtCore
@@ -25,8 +25,15 @@ class QDirEntryInfo
 {
     const QFileSystemMetaData &ensureFilled(QFileSystemMetaData::MetaDataFlags what)
     {
-        if (!metaData.hasFlags(what))
-            QFileSystemEngine::fillMetaData(entry, metaData, what);
+        if (!metaData.hasFlags(what)) {
+#ifdef Q_OS_UNIX
+            // fd-relative lookup spares the kernel a full path resolution
+            if (dirFd >= 0)
+                QFileSystemEngine::fillMetaData(dirFd, dirEntryName, metaData, what);
+            if (!metaData.hasFlags(what))
+#endif
+                QFileSystemEngine::fillMetaData(entry, metaData, what);
+        }
         return metaData;
     }
 
@@ -149,6 +156,13 @@ private:
     QFileSystemEntry entry;
     QFileSystemMetaData metaData;
     std::optional<QFileInfo> fileInfoOpt;
+#ifdef Q_OS_UNIX
+    // Set by QDirListingPrivate when iterating a native directory: the fd of
+    // the directory containing this entry (owned by the iterator) and the
+    // entry's native name inside it.
+    int dirFd = -1;
+    QByteArray dirEntryName;
+#endif
 };
 
 QT_END_NAMESPACE
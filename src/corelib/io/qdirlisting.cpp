@@ -344,6 +344,16 @@ void QDirListingPrivate::advance()
             QFileSystemIterator *it;
             while (it = nativeIterators.back().get(),
                    it->advance(entryInfo.entry, entryInfo.metaData)) {
+#ifdef Q_OS_UNIX
+                // Lazy metadata fills can then use fstatat() & friends relative
+                // to the directory the iterator already has open, instead of
+                // resolving the full path again. The fd stays valid while this
+                // entry is current: its iterator is only popped after the next
+                // advance() fails.
+                entryInfo.dirFd = it->directoryFd();
+                if (entryInfo.dirFd >= 0)
+                    entryInfo.dirEntryName = it->currentEntryName();
+#endif
                 if (entryMatches(entryInfo)) {
                     currentEntryInfo = std::move(entryInfo);
                     return;
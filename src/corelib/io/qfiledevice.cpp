@@ -692,6 +692,27 @@ bool QFileDevice::setPermissions(Permissions permissions)
     memory is unmapped.  It is unspecified whether modifications made
     to the file made after the mapping is created will be visible through
     the mapped memory. This enum value was introduced in Qt 5.4.
+    \value MapSequentialOption Advise the operating system that the mapping
+    will be read sequentially, so it may read ahead aggressively and drop
+    pages soon after they have been accessed. This enum value was introduced
+    in Qt 6.9.
+    \value MapRandomAccessOption Advise the operating system that the mapping
+    will be accessed in a random order, so read-ahead is unlikely to pay off.
+    This enum value was introduced in Qt 6.9.
+    \value MapWillNeedOption Advise the operating system that the mapped
+    range will be needed soon, so it may start reading it into the page
+    cache immediately. This enum value was introduced in Qt 6.9.
+    \value MapPopulateOption Pre-fault the mapped pages as part of creating
+    the mapping, avoiding page faults on first access. This enum value was
+    introduced in Qt 6.9.
+    \value MapHugePagesOption Request that the mapping be backed by
+    transparent huge pages where the operating system supports them, reducing
+    TLB pressure for large mappings. This enum value was introduced in
+    Qt 6.9.
+
+    The options other than MapPrivateOption are hints: they do not change
+    the contents visible through the mapping, and they are ignored on
+    platforms that cannot honor them.
 */
 
 /*!
@@ -747,6 +768,53 @@ bool QFileDevice::unmap(uchar *address)
     return false;
 }
 
+/*!
+    \enum QFileDevice::FileAdvice
+    \since 6.9
+
+    This enum describes the access pattern passed to advise().
+
+    \value NormalAdvice     No special access pattern; resets any advice
+                            previously given for the range.
+    \value SequentialAdvice The range will be read sequentially, from lower
+                            to higher offsets.
+    \value RandomAdvice     The range will be accessed in a random order.
+    \value WillNeedAdvice   The range will be needed soon; the operating
+                            system may start reading it into the page cache.
+    \value DontNeedAdvice   The range will not be needed in the near future;
+                            the operating system may drop its cached pages.
+
+    \sa advise()
+*/
+
+/*!
+    \since 6.9
+
+    Advises the operating system that \a length bytes of the file starting
+    at \a offset will be accessed according to the pattern \a advice, so
+    that it can adjust its caching and read-ahead behavior accordingly.
+    A \a length of 0 applies the advice from \a offset to the end of the
+    file.
+
+    This is a performance hint: it does not change the contents of the file
+    or the result of any read or write. Returns \c true if the hint was
+    passed on to the operating system; returns \c false if the file is not
+    open or the platform does not support file access hints.
+
+    \sa map()
+ */
+bool QFileDevice::advise(qint64 offset, qint64 length, FileAdvice advice)
+{
+    Q_D(QFileDevice);
+    if (d->engine()) {
+        unsetError();
+        if (d->fileEngine->advise(offset, length, advice))
+            return true;
+        d->setError(d->fileEngine->error(), d->fileEngine->errorString());
+    }
+    return false;
+}
+
 /*!
     \enum QFileDevice::FileTime
     \since 5.10
@@ -100,13 +100,28 @@ public:
 
     enum MemoryMapFlag {
         NoOptions = 0,
-        MapPrivateOption = 0x0001
+        MapPrivateOption = 0x0001,
+        MapSequentialOption = 0x0002,
+        MapRandomAccessOption = 0x0004,
+        MapWillNeedOption = 0x0008,
+        MapPopulateOption = 0x0010,
+        MapHugePagesOption = 0x0020
     };
     Q_DECLARE_FLAGS(MemoryMapFlags, MemoryMapFlag)
 
     uchar *map(qint64 offset, qint64 size, MemoryMapFlags flags = NoOptions);
     bool unmap(uchar *address);
 
+    enum FileAdvice {
+        NormalAdvice,
+        SequentialAdvice,
+        RandomAdvice,
+        WillNeedAdvice,
+        DontNeedAdvice
+    };
+
+    bool advise(qint64 offset, qint64 length, FileAdvice advice);
+
     QDateTime fileTime(QFileDevice::FileTime time) const;
     bool setFileTime(const QDateTime &newDate, QFileDevice::FileTime fileTime);
 
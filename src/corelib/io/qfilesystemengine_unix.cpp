@@ -76,6 +76,13 @@
 struct statx { mode_t stx_mode; };      // dummy
 #endif
 
+// qplatformdefs.h has no fstatat(2) macro
+#if defined(QT_USE_XOPEN_LFS_EXTENSIONS) && defined(QT_LARGEFILE_SUPPORT)
+#  define QT_FSTATAT            ::fstatat64
+#else
+#  define QT_FSTATAT            ::fstatat
+#endif
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
@@ -294,6 +301,16 @@ static int qt_fstatx(int fd, struct statx *statxBuffer)
     return qt_real_statx(fd, "", AT_EMPTY_PATH, statxBuffer);
 }
 
+static int qt_statxat(int dfd, const char *pathname, struct statx *statxBuffer)
+{
+    return qt_real_statx(dfd, pathname, 0, statxBuffer);
+}
+
+static int qt_lstatxat(int dfd, const char *pathname, struct statx *statxBuffer)
+{
+    return qt_real_statx(dfd, pathname, AT_SYMLINK_NOFOLLOW, statxBuffer);
+}
+
 inline void QFileSystemMetaData::fillFromStatxBuf(const struct statx &statxBuffer)
 {
     // Permissions
@@ -355,6 +372,12 @@ static int qt_lstatx(const char *, struct statx *)
 static int qt_fstatx(int, struct statx *)
 { return -ENOSYS; }
 
+static int qt_statxat(int, const char *, struct statx *)
+{ return -ENOSYS; }
+
+static int qt_lstatxat(int, const char *, struct statx *)
+{ return -ENOSYS; }
+
 inline void QFileSystemMetaData::fillFromStatxBuf(const struct statx &)
 { }
 #endif
@@ -575,6 +598,15 @@ void QFileSystemMetaData::fillFromDirEnt(const QT_DIRENT &entry)
 #else
     Q_UNUSED(entry);
 #endif
+
+#if !defined(Q_OS_DARWIN)
+    // Hidden means a leading dot here, so we can answer that from d_name right
+    // away and spare our callers a fillMetaData() round trip per directory
+    // entry. Not on Darwin, where UF_HIDDEN also hides files.
+    if (entry.d_name[0] == '.')
+        entryFlags |= QFileSystemMetaData::HiddenAttribute;
+    knownFlagsMask |= QFileSystemMetaData::HiddenAttribute;
+#endif
 }
 
 //static
@@ -834,6 +866,150 @@ QString QFileSystemEngine::bundleName(const QFileSystemEntry &entry)
 #endif
 
 //static
+/*
+    fd-relative overload: fills metadata for the entry named \a fileName inside
+    the directory referred to by \a dfd, using fstatat(2)/faccessat(2), so the
+    kernel resolves a single path component instead of walking the full path.
+
+    Only the flags that the *at(2) family can answer are handled; anything else
+    (e.g. the Darwin alias and bundle detection, which need the full path) is
+    masked out, so the caller must check hasFlags() afterwards and fall back to
+    the path-based overload for whatever is still missing.
+*/
+// static
+bool QFileSystemEngine::fillMetaData(int dfd, const QByteArray &fileName,
+                                     QFileSystemMetaData &data,
+                                     QFileSystemMetaData::MetaDataFlags what)
+{
+    if (dfd < 0 || fileName.isEmpty() || fileName.startsWith('/'))
+        return false;
+
+    constexpr QFileSystemMetaData::MetaDataFlags SupportedFlags =
+            QFileSystemMetaData::PosixStatFlags
+            | QFileSystemMetaData::LinkType
+            | QFileSystemMetaData::ExistsAttribute
+            | QFileSystemMetaData::UserPermissions;
+    what &= SupportedFlags;
+    if (!what)
+        return false;
+
+    // if we're asking for any of the stat(2) flags, then we're getting them all
+    if (what & QFileSystemMetaData::PosixStatFlags)
+        what |= QFileSystemMetaData::PosixStatFlags;
+
+    data.entryFlags &= ~what;
+
+    const char *name = fileName.constData();
+    int entryErrno = 0; // innocent until proven otherwise
+
+    // The logic below mirrors the path-based overload; see the comments there.
+    union {
+        QT_STATBUF statBuffer;
+        struct statx statxBuffer;
+    };
+    int statResult = -1;
+    if (what & QFileSystemMetaData::LinkType) {
+        mode_t mode = 0;
+        statResult = qt_lstatxat(dfd, name, &statxBuffer);
+        if (statResult == -ENOSYS) {
+            // use fstatat(2) with AT_SYMLINK_NOFOLLOW
+            statResult = QT_FSTATAT(dfd, name, &statBuffer, AT_SYMLINK_NOFOLLOW);
+            if (statResult == 0)
+                mode = statBuffer.st_mode;
+        } else if (statResult == 0) {
+            statResult = 1; // record it was statx(2) that succeeded
+            mode = statxBuffer.stx_mode;
+        }
+
+        if (statResult >= 0) {
+            if (S_ISLNK(mode)) {
+                // it's a symlink, we don't know if the target "exists"
+                data.entryFlags |= QFileSystemMetaData::LinkType;
+                statResult = -1;    // force stat(2) below
+            } else {
+                // it's a regular file and it exists
+                if (statResult)
+                    data.fillFromStatxBuf(statxBuffer);
+                else
+                    data.fillFromStatBuf(statBuffer);
+                data.knownFlagsMask |= QFileSystemMetaData::PosixStatFlags
+                        | QFileSystemMetaData::ExistsAttribute;
+                data.entryFlags |= QFileSystemMetaData::ExistsAttribute;
+            }
+        } else {
+            // it doesn't exist
+            entryErrno = errno;
+            data.knownFlagsMask |= QFileSystemMetaData::ExistsAttribute;
+        }
+
+        data.knownFlagsMask |= QFileSystemMetaData::LinkType;
+    }
+
+    if (statResult == -1 && (what & QFileSystemMetaData::PosixStatFlags)) {
+        if (entryErrno == 0) {
+            data.entryFlags &= ~QFileSystemMetaData::PosixStatFlags;
+            statResult = qt_statxat(dfd, name, &statxBuffer);
+            if (statResult == -ENOSYS) {
+                // use fstatat(2)
+                statResult = QT_FSTATAT(dfd, name, &statBuffer, 0);
+                if (statResult == 0)
+                    data.fillFromStatBuf(statBuffer);
+            } else if (statResult == 0) {
+                data.fillFromStatxBuf(statxBuffer);
+            }
+        }
+
+        if (statResult != 0) {
+            entryErrno = errno;
+            data.birthTime_ = 0;
+            data.metadataChangeTime_ = 0;
+            data.modificationTime_ = 0;
+            data.accessTime_ = 0;
+            data.size_ = 0;
+            data.userId_ = (uint) -2;
+            data.groupId_ = (uint) -2;
+        }
+
+        data.knownFlagsMask |= QFileSystemMetaData::PosixStatFlags
+            | QFileSystemMetaData::ExistsAttribute;
+    }
+
+    if (what & (QFileSystemMetaData::UserPermissions | QFileSystemMetaData::ExistsAttribute)) {
+        auto checkAccess = [&](QFileSystemMetaData::MetaDataFlag flag, int mode) {
+            if (entryErrno != 0 || (what & flag) == 0)
+                return;
+            if (::faccessat(dfd, name, mode, 0) == 0) {
+                // access ok (and file exists)
+                data.entryFlags |= flag | QFileSystemMetaData::ExistsAttribute;
+            } else if (errno != EACCES && errno != EROFS) {
+                entryErrno = errno;
+            }
+        };
+
+        checkAccess(QFileSystemMetaData::UserReadPermission, R_OK);
+        checkAccess(QFileSystemMetaData::UserWritePermission, W_OK);
+        checkAccess(QFileSystemMetaData::UserExecutePermission, X_OK);
+
+        // if we still haven't found out if the file exists, try F_OK
+        if (entryErrno == 0 && (data.entryFlags & QFileSystemMetaData::ExistsAttribute) == 0) {
+            if (::faccessat(dfd, name, F_OK, 0) == -1)
+                entryErrno = errno;
+            else
+                data.entryFlags |= QFileSystemMetaData::ExistsAttribute;
+        }
+
+        data.knownFlagsMask |= (what & QFileSystemMetaData::UserPermissions) |
+                QFileSystemMetaData::ExistsAttribute;
+    }
+
+    if (entryErrno != 0) {
+        what &= ~QFileSystemMetaData::LinkType; // don't clear link: could be broken symlink
+        data.clearFlags(what);
+        return false;
+    }
+    return true;
+}
+
 bool QFileSystemEngine::fillMetaData(const QFileSystemEntry &entry, QFileSystemMetaData &data,
         QFileSystemMetaData::MetaDataFlags what)
 {
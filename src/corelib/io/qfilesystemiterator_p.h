@@ -43,6 +43,14 @@ public:
 
     bool advance(QFileSystemEntry &fileEntry, QFileSystemMetaData &metaData);
 
+#ifdef Q_OS_UNIX
+    // The directory being iterated, for *at(2)-style fd-relative metadata
+    // lookups; -1 if the directory could not be opened.
+    int directoryFd() const;
+    // The native name of the entry the last advance() returned.
+    QByteArray currentEntryName() const;
+#endif
+
 private:
     QString dirPath;
 
@@ -64,6 +72,14 @@ private:
     QT_DIRENT *dirEntry = nullptr;
     int lastError = 0;
     QStringDecoder toUtf16;
+
+#  if defined(Q_OS_LINUX)
+    // batched getdents64(2) directory reading, instead of readdir(3)
+    int dirFd = -1;
+    std::unique_ptr<char[]> direntBuffer;
+    qsizetype direntBufferUsed = 0;     // bytes filled by the last getdents64()
+    qsizetype direntBufferOffset = 0;   // read position inside direntBuffer
+#  endif
 #endif
 
     Q_DISABLE_COPY_MOVE(QFileSystemIterator)
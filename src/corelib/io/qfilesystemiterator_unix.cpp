@@ -8,21 +8,47 @@
 
 #include <qvarlengtharray.h>
 
+#include <private/qcore_unix_p.h>
+
 #include <memory>
 
 #include <stdlib.h>
 #include <errno.h>
 
+#if defined(Q_OS_LINUX)
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
 QT_BEGIN_NAMESPACE
 
+#if defined(Q_OS_LINUX)
+// A large batch buffer amortizes the syscall cost over many entries: one
+// getdents64(2) call typically returns hundreds of them, so pure enumeration
+// of a big directory runs at syscall speed instead of going through the
+// readdir(3) machinery (stream locking and a small, libc-chosen buffer).
+static constexpr qsizetype DirentBufferSize = 64 * 1024;
+#endif
+
 /*
     Native filesystem iterator, which uses ::opendir()/readdir()/dirent from the system
-    libraries to iterate over the directory represented by \a entry.
+    libraries to iterate over the directory represented by \a entry. On Linux, it instead
+    reads whole batches of entries at a time with getdents64(2).
 */
 QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry)
     : dirPath(entry.filePath()),
       toUtf16(QStringDecoder::Utf8)
 {
+#if defined(Q_OS_LINUX)
+    dirFd = qt_safe_open(entry.nativeFilePath().constData(), O_RDONLY | O_DIRECTORY);
+    if (dirFd < 0) {
+        lastError = errno;
+    } else {
+        direntBuffer.reset(new char[DirentBufferSize]);
+        if (!dirPath.endsWith(u'/'))
+            dirPath.append(u'/');
+    }
+#else
     dir.reset(QT_OPENDIR(entry.nativeFilePath().constData()));
     if (!dir) {
         lastError = errno;
@@ -30,6 +56,7 @@ QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry)
         if (!dirPath.endsWith(u'/'))
             dirPath.append(u'/');
     }
+#endif
 }
 
 QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry, QDirListing::IteratorFlags)
@@ -41,7 +68,27 @@ QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry, QDir::Fi
 {
 }
 
-QFileSystemIterator::~QFileSystemIterator() = default;
+int QFileSystemIterator::directoryFd() const
+{
+#if defined(Q_OS_LINUX)
+    return dirFd;
+#else
+    return dir ? ::dirfd(dir.get()) : -1;
+#endif
+}
+
+QByteArray QFileSystemIterator::currentEntryName() const
+{
+    return dirEntry ? QByteArray(dirEntry->d_name) : QByteArray();
+}
+
+QFileSystemIterator::~QFileSystemIterator()
+{
+#if defined(Q_OS_LINUX)
+    if (dirFd >= 0)
+        qt_safe_close(dirFd);
+#endif
+}
 
 bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaData &metaData)
 {
@@ -53,10 +100,33 @@ bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaDa
 #endif
         return QFileSystemEntry(dirPath + name, QFileSystemEntry::FromInternalPath());
     };
+#if defined(Q_OS_LINUX)
+    if (dirFd < 0)
+        return false;
+#else
     if (!dir)
         return false;
+#endif
 
     for (;;) {
+#if defined(Q_OS_LINUX)
+        if (direntBufferOffset >= direntBufferUsed) {
+            const auto bytesRead = syscall(SYS_getdents64, dirFd,
+                                           direntBuffer.get(), DirentBufferSize);
+            if (bytesRead <= 0) {
+                lastError = bytesRead < 0 ? errno : 0;
+                return false;
+            }
+            direntBufferUsed = qsizetype(bytesRead);
+            direntBufferOffset = 0;
+        }
+
+        // The kernel's linux_dirent64 has the same layout as struct dirent64
+        // (readdir64() hands out pointers into a getdents64() buffer of its
+        // own), so the entries can be used straight out of the batch buffer.
+        dirEntry = reinterpret_cast<QT_DIRENT *>(direntBuffer.get() + direntBufferOffset);
+        direntBufferOffset += dirEntry->d_reclen;
+#else
         // From readdir man page:
         // If the end of the directory stream is reached, NULL is returned and errno is
         // not changed. If an error occurs, NULL is returned and errno is set to indicate
@@ -65,31 +135,29 @@ bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaDa
         errno = 0;
         dirEntry = QT_READDIR(dir.get());
 
-        if (dirEntry) {
-            // POSIX allows readdir() to return a file name in struct dirent that
-            // extends past the end of the d_name array (it's a char[1] array on QNX, for
-            // example). Therefore, we *must* call strlen() on it to get the actual length
-            // of the file name. See:
-            // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/dirent.h.html#tag_13_07_05
-            QByteArrayView name(dirEntry->d_name, strlen(dirEntry->d_name));
-            // name.size() is sufficient here, see QUtf8::convertToUnicode() for details
-            QVarLengthArray<char16_t> buffer(name.size());
-            auto *end = toUtf16.appendToBuffer(buffer.data(), name);
-            buffer.resize(end - buffer.constData());
-            if (!toUtf16.hasError()) {
-                fileEntry = asFileEntry(buffer);
-                metaData.fillFromDirEnt(*dirEntry);
-                return true;
-            } else {
-                errno = EILSEQ; // Invalid or incomplete multibyte or wide character
-            }
-        } else {
-            break;
+        if (!dirEntry) {
+            lastError = errno;
+            return false;
         }
-    }
+#endif
 
-    lastError = errno;
-    return false;
+        // POSIX allows readdir() to return a file name in struct dirent that
+        // extends past the end of the d_name array (it's a char[1] array on QNX, for
+        // example). Therefore, we *must* call strlen() on it to get the actual length
+        // of the file name. See:
+        // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/dirent.h.html#tag_13_07_05
+        QByteArrayView name(dirEntry->d_name, strlen(dirEntry->d_name));
+        // name.size() is sufficient here, see QUtf8::convertToUnicode() for details
+        QVarLengthArray<char16_t> buffer(name.size());
+        auto *end = toUtf16.appendToBuffer(buffer.data(), name);
+        buffer.resize(end - buffer.constData());
+        if (!toUtf16.hasError()) {
+            fileEntry = asFileEntry(buffer);
+            metaData.fillFromDirEnt(*dirEntry);
+            return true;
+        }
+        // Invalid or incomplete multibyte or wide character: skip the entry
+    }
 }
 
 QT_END_NAMESPACE
@@ -19,6 +19,9 @@
 #  include "qfilesystemwatcher_win_p.h"
 #elif defined(USE_INOTIFY)
 #  include "qfilesystemwatcher_inotify_p.h"
+#  if QT_CONFIG(fanotify)
+#    include "qfilesystemwatcher_fanotify_p.h"
+#  endif
 #elif defined(Q_OS_FREEBSD) || defined(Q_OS_NETBSD) || defined(Q_OS_OPENBSD) || defined(QT_PLATFORM_UIKIT)
 #  include "qfilesystemwatcher_kqueue_p.h"
 #elif defined(Q_OS_MACOS)
@@ -39,6 +42,15 @@ QFileSystemWatcherEngine *QFileSystemWatcherPrivate::createNativeEngine(QObject
 #if defined(Q_OS_WIN)
     return new QWindowsFileSystemWatcherEngine(parent);
 #elif defined(USE_INOTIFY)
+#  if QT_CONFIG(fanotify)
+    // A single fanotify filesystem mark covers any number of watched
+    // directories, so it scales to trees that would exhaust inotify's watch
+    // limits. It is opt-in and needs privileges (see
+    // QFanotifyFileSystemWatcherEngine::create()), so fall back to inotify
+    // whenever it is unavailable.
+    if (QFileSystemWatcherEngine *fanotify = QFanotifyFileSystemWatcherEngine::create(parent))
+        return fanotify;
+#  endif
     // there is a chance that inotify may fail on Linux pre-2.6.13 (August
     // 2005), so we can't just new inotify directly.
     return QInotifyFileSystemWatcherEngine::create(parent);
@@ -0,0 +1,311 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qfilesystemwatcher.h"
+#include "qfilesystemwatcher_fanotify_p.h"
+
+#include "private/qcore_unix_p.h"
+
+#include <qdebug.h>
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qscopeguard.h>
+#include <qsocketnotifier.h>
+
+#include <sys/fanotify.h>
+#include <sys/statfs.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    fanotify-based engine. Unlike inotify, which needs one watch descriptor
+    per directory, a single FAN_MARK_FILESYSTEM mark delivers events for every
+    object on the marked filesystem, so installing watches is O(1) in the size
+    of the watched tree and cannot exhaust per-user watch limits. The price is
+    that the kernel reports all activity on that filesystem and we discard
+    everything that doesn't concern a watched path, plus the CAP_SYS_ADMIN
+    requirement of fanotify_init(2).
+
+    Events carry the file handle of the affected directory and the entry name
+    (FAN_REPORT_DFID_NAME, kernel 5.9). We record the handle of each watched
+    path and of its parent directory at addPaths() time and match events
+    against those, so no event-time path resolution (open_by_handle_at() and
+    friends) is needed.
+*/
+
+// directory-entry events: something was added to/removed from a directory
+static constexpr quint64 EntryEvents = FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO;
+// events that mean a watched path itself is gone
+static constexpr quint64 RemoveEvents = FAN_DELETE | FAN_MOVED_FROM;
+
+static constexpr quint64 WatchedEvents = EntryEvents | FAN_MODIFY | FAN_ATTRIB | FAN_ONDIR;
+
+static QByteArray encodeFsid(const void *fsid)
+{
+    static_assert(sizeof(fsid_t) == sizeof(__kernel_fsid_t));
+    return QByteArray(static_cast<const char *>(fsid), sizeof(__kernel_fsid_t));
+}
+
+static QByteArray encodeHandle(const QByteArray &fsid, const struct file_handle *handle)
+{
+    QByteArray key = fsid;
+    key.append(reinterpret_cast<const char *>(&handle->handle_type), sizeof(handle->handle_type));
+    key.append(reinterpret_cast<const char *>(handle->f_handle), handle->handle_bytes);
+    return key;
+}
+
+static bool getHandleKey(const QByteArray &nativePath, const QByteArray &fsid, QByteArray *key)
+{
+    alignas(struct file_handle) char buffer[sizeof(struct file_handle) + MAX_HANDLE_SZ];
+    auto *handle = reinterpret_cast<struct file_handle *>(buffer);
+    handle->handle_bytes = MAX_HANDLE_SZ;
+    int mountId;
+    if (name_to_handle_at(AT_FDCWD, nativePath.constData(), handle, &mountId,
+                          AT_SYMLINK_FOLLOW) != 0) {
+        return false;   // e.g. ENOENT, or a filesystem without handle support
+    }
+    *key = encodeHandle(fsid, handle);
+    return true;
+}
+
+QFanotifyFileSystemWatcherEngine *QFanotifyFileSystemWatcherEngine::create(QObject *parent)
+{
+    // A filesystem mark makes the kernel report every change on the marked
+    // filesystem, which is pure overhead for the common few-paths case, so
+    // this engine is opt-in for applications that watch very large trees. It
+    // also requires CAP_SYS_ADMIN and a 5.9 kernel, so on any failure we
+    // return null and the caller falls back to inotify.
+    if (qEnvironmentVariableIntValue("QT_FILESYSTEMWATCHER_FANOTIFY") <= 0)
+        return nullptr;
+
+    int fd = fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK | FAN_REPORT_DFID_NAME,
+                           O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+    return new QFanotifyFileSystemWatcherEngine(fd, parent);
+}
+
+QFanotifyFileSystemWatcherEngine::QFanotifyFileSystemWatcherEngine(int fd, QObject *parent)
+    : QFileSystemWatcherEngine(parent),
+      fanotifyFd(fd),
+      notifier(fd, QSocketNotifier::Read, this)
+{
+    QObject::connect(&notifier, &QSocketNotifier::activated,
+                     this, &QFanotifyFileSystemWatcherEngine::readFromFanotify);
+}
+
+QFanotifyFileSystemWatcherEngine::~QFanotifyFileSystemWatcherEngine()
+{
+    notifier.setEnabled(false);
+    ::close(fanotifyFd);    // releases all marks
+}
+
+QStringList QFanotifyFileSystemWatcherEngine::addPaths(const QStringList &paths,
+                                                       QStringList *files,
+                                                       QStringList *directories)
+{
+    QStringList unhandled;
+    for (const QString &path : paths) {
+        QFileInfo fi(path);
+        bool isDir = fi.isDir();
+        auto sg = qScopeGuard([&]{ unhandled.push_back(path); });
+        if (isDir) {
+            if (directories->contains(path))
+                continue;
+        } else {
+            if (files->contains(path))
+                continue;
+        }
+
+        const QByteArray nativePath = QFile::encodeName(fi.absoluteFilePath());
+        struct statfs sfs;
+        if (statfs(nativePath.constData(), &sfs) != 0) {
+            if (errno != ENOENT)
+                qErrnoWarning("statfs(%ls) failed:", path.constData());
+            continue;
+        }
+
+        Watch watch;
+        watch.path = path;
+        watch.isDir = isDir;
+        watch.fsid = encodeFsid(&sfs.f_fsid);
+        if (!getHandleKey(nativePath, watch.fsid, &watch.selfKey))
+            continue;
+
+        const QByteArray entryName = QFile::encodeName(fi.fileName());
+        if (entryName.isEmpty()) {
+            // the root directory is not an entry of any parent
+            watch.entryKey = watch.selfKey;
+        } else {
+            QByteArray parentKey;
+            if (!getHandleKey(QFile::encodeName(fi.absolutePath()), watch.fsid, &parentKey))
+                continue;
+            watch.entryKey = parentKey + '\0' + entryName;
+        }
+
+        FilesystemMark &mark = marks[watch.fsid];
+        if (mark.count == 0) {
+            if (fanotify_mark(fanotifyFd, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, WatchedEvents,
+                              AT_FDCWD, nativePath.constData()) != 0) {
+                qErrnoWarning("fanotify_mark(%ls) failed:", path.constData());
+                marks.remove(watch.fsid);
+                continue;
+            }
+            mark.markPath = nativePath;
+        }
+        ++mark.count;
+
+        sg.dismiss();
+
+        if (isDir)
+            directories->append(path);
+        else
+            files->append(path);
+
+        if (isDir)
+            selfKeyToPath.insert(watch.selfKey, path);
+        entryKeyToPath.insert(watch.entryKey, path);
+        watches.insert(path, watch);
+    }
+
+    return unhandled;
+}
+
+QStringList QFanotifyFileSystemWatcherEngine::removePaths(const QStringList &paths,
+                                                          QStringList *files,
+                                                          QStringList *directories)
+{
+    QStringList unhandled;
+    for (const QString &path : paths) {
+        const auto it = watches.constFind(path);
+        if (it == watches.cend()) {
+            unhandled.push_back(path);
+            continue;
+        }
+
+        const Watch watch = *it;
+        watches.erase(it);
+        removeWatch(watch);
+
+        if (watch.isDir)
+            directories->removeAll(path);
+        else
+            files->removeAll(path);
+    }
+
+    return unhandled;
+}
+
+void QFanotifyFileSystemWatcherEngine::removeWatch(const Watch &watch)
+{
+    if (watch.isDir)
+        selfKeyToPath.remove(watch.selfKey, watch.path);
+    entryKeyToPath.remove(watch.entryKey, watch.path);
+
+    const auto it = marks.find(watch.fsid);
+    if (it == marks.end())
+        return;
+    if (--it->count <= 0) {
+        // best effort: the path the mark was installed through may be gone,
+        // in which case the mark stays until the fd is closed and its events
+        // are simply discarded
+        fanotify_mark(fanotifyFd, FAN_MARK_REMOVE | FAN_MARK_FILESYSTEM, WatchedEvents,
+                      AT_FDCWD, it->markPath.constData());
+        marks.erase(it);
+    }
+}
+
+void QFanotifyFileSystemWatcherEngine::handleEvent(quint64 mask, const QByteArray &dirKey,
+                                                   QByteArrayView entryName)
+{
+    // an event on the object itself reports the name "." (or none at all)
+    const bool onSelf = entryName.isEmpty() || entryName == ".";
+
+    if (!onSelf) {
+        // a watched file or directory affected as an entry of its parent
+        QByteArray entryKey = dirKey;
+        entryKey += '\0';
+        entryKey += entryName;
+        const QStringList affected = entryKeyToPath.values(entryKey);
+        for (const QString &path : affected) {
+            const auto it = watches.constFind(path);
+            if (it == watches.cend())
+                continue;
+            const bool removed = mask & RemoveEvents;
+            if (it->isDir)
+                emit directoryChanged(path, removed);
+            else
+                emit fileChanged(path, removed);
+            if (removed) {
+                const Watch watch = *it;
+                watches.erase(it);
+                removeWatch(watch);
+            }
+        }
+    }
+
+    if (mask & EntryEvents) {
+        // the contents of a watched directory changed
+        const QStringList affected = selfKeyToPath.values(dirKey);
+        for (const QString &path : affected)
+            emit directoryChanged(path, false);
+    } else if (onSelf && (mask & FAN_ATTRIB)) {
+        // attribute change of a watched directory itself
+        const QStringList affected = selfKeyToPath.values(dirKey);
+        for (const QString &path : affected)
+            emit directoryChanged(path, false);
+    }
+}
+
+void QFanotifyFileSystemWatcherEngine::readFromFanotify()
+{
+    alignas(fanotify_event_metadata) char buffer[65536];
+    for (;;) {
+        ssize_t len = read(fanotifyFd, buffer, sizeof buffer);
+        if (len <= 0)
+            return;     // EAGAIN: drained the queue (the fd is FAN_NONBLOCK)
+
+        auto *metadata = reinterpret_cast<fanotify_event_metadata *>(buffer);
+        while (FAN_EVENT_OK(metadata, len)) {
+            if (metadata->vers != FANOTIFY_METADATA_VERSION) {
+                qWarning("QFanotifyFileSystemWatcherEngine: metadata version mismatch");
+                return;
+            }
+            if (metadata->fd >= 0)
+                ::close(metadata->fd);  // we use FID reporting; shouldn't happen
+
+            if (!(metadata->mask & FAN_Q_OVERFLOW)) {
+                const char *p = reinterpret_cast<const char *>(metadata) + metadata->metadata_len;
+                const char *end = reinterpret_cast<const char *>(metadata) + metadata->event_len;
+                while (p < end) {
+                    auto *header = reinterpret_cast<const fanotify_event_info_header *>(p);
+                    if (header->info_type == FAN_EVENT_INFO_TYPE_DFID_NAME
+                        || header->info_type == FAN_EVENT_INFO_TYPE_DFID
+                        || header->info_type == FAN_EVENT_INFO_TYPE_FID) {
+                        auto *fid = reinterpret_cast<const fanotify_event_info_fid *>(header);
+                        auto *handle = reinterpret_cast<const struct file_handle *>(fid->handle);
+                        const QByteArray dirKey = encodeHandle(encodeFsid(&fid->fsid), handle);
+                        QByteArrayView entryName;
+                        if (header->info_type == FAN_EVENT_INFO_TYPE_DFID_NAME) {
+                            auto *name = reinterpret_cast<const char *>(handle->f_handle)
+                                    + handle->handle_bytes;
+                            entryName = QByteArrayView(name, strlen(name));
+                        }
+                        handleEvent(metadata->mask, dirKey, entryName);
+                    }
+                    p += header->len;
+                }
+            }
+
+            metadata = FAN_EVENT_NEXT(metadata, len);
+        }
+    }
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qfilesystemwatcher_fanotify_p.cpp"
@@ -0,0 +1,73 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QFILESYSTEMWATCHER_FANOTIFY_P_H
+#define QFILESYSTEMWATCHER_FANOTIFY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qfilesystemwatcher_p.h"
+
+QT_REQUIRE_CONFIG(filesystemwatcher);
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qsocketnotifier.h>
+
+QT_BEGIN_NAMESPACE
+
+class QFanotifyFileSystemWatcherEngine : public QFileSystemWatcherEngine
+{
+    Q_OBJECT
+
+public:
+    ~QFanotifyFileSystemWatcherEngine();
+
+    static QFanotifyFileSystemWatcherEngine *create(QObject *parent);
+
+    QStringList addPaths(const QStringList &paths, QStringList *files, QStringList *directories) override;
+    QStringList removePaths(const QStringList &paths, QStringList *files, QStringList *directories) override;
+
+private Q_SLOTS:
+    void readFromFanotify();
+
+private:
+    QFanotifyFileSystemWatcherEngine(int fd, QObject *parent);
+
+    struct Watch
+    {
+        QString path;
+        QByteArray selfKey;     // fsid + file handle of the watched path
+        QByteArray entryKey;    // fsid + file handle of the parent + entry name
+        QByteArray fsid;
+        bool isDir;
+    };
+    struct FilesystemMark
+    {
+        QByteArray markPath;    // native path the mark was installed through
+        int count = 0;          // number of watches on this filesystem
+    };
+
+    void handleEvent(quint64 mask, const QByteArray &dirKey, QByteArrayView entryName);
+    void removeWatch(const Watch &watch);
+
+    QHash<QString, Watch> watches;                  // watched path -> bookkeeping
+    QMultiHash<QByteArray, QString> selfKeyToPath;  // directory watches only
+    QMultiHash<QByteArray, QString> entryKeyToPath; // all watches
+    QHash<QByteArray, FilesystemMark> marks;        // fsid -> mark refcount
+
+    int fanotifyFd;
+    QSocketNotifier notifier;
+};
+
+QT_END_NAMESPACE
+#endif // QFILESYSTEMWATCHER_FANOTIFY_P_H
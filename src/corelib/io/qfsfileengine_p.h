@@ -96,6 +96,7 @@ public:
     qint64 readLine(char *data, qint64 maxlen) override;
     qint64 write(const char *data, qint64 len) override;
     bool cloneTo(QAbstractFileEngine *target) override;
+    bool advise(qint64 offset, qint64 length, QFile::FileAdvice advice) override;
 
     virtual bool isUnnamedFile() const
     { return false; }
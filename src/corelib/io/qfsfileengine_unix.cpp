@@ -585,6 +585,10 @@ uchar *QFSFileEnginePrivate::map(qint64 offset, qint64 size, QFile::MemoryMapFla
         sharemode = MAP_PRIVATE;
         access |= PROT_WRITE;
     }
+#if defined(MAP_POPULATE)
+    if (flags & QFileDevice::MapPopulateOption)
+        sharemode |= MAP_POPULATE;
+#endif
 
 #if defined(Q_OS_INTEGRITY)
     int pageSize = sysconf(_SC_PAGESIZE);
@@ -605,6 +609,20 @@ uchar *QFSFileEnginePrivate::map(qint64 offset, qint64 size, QFile::MemoryMapFla
     void *mapAddress = QT_MMAP((void*)nullptr, realSize,
                    access, sharemode, nativeHandle(), realOffset);
     if (MAP_FAILED != mapAddress) {
+        // the access pattern options are best-effort hints, so their failure
+        // is not a mapping failure
+#if defined(MADV_HUGEPAGE)
+        if (flags & QFileDevice::MapHugePagesOption)
+            madvise(mapAddress, realSize, MADV_HUGEPAGE);
+#endif
+#if defined(POSIX_MADV_NORMAL) && !defined(Q_OS_INTEGRITY)
+        if (flags & QFileDevice::MapSequentialOption)
+            posix_madvise(mapAddress, realSize, POSIX_MADV_SEQUENTIAL);
+        else if (flags & QFileDevice::MapRandomAccessOption)
+            posix_madvise(mapAddress, realSize, POSIX_MADV_RANDOM);
+        if (flags & QFileDevice::MapWillNeedOption)
+            posix_madvise(mapAddress, realSize, POSIX_MADV_WILLNEED);
+#endif
         uchar *address = extra + static_cast<uchar*>(mapAddress);
         maps[address] = {extra, realSize};
         return address;
@@ -650,6 +668,53 @@ bool QFSFileEnginePrivate::unmap(uchar *ptr)
 #endif
 }
 
+/*!
+    \reimp
+*/
+bool QFSFileEngine::advise(qint64 offset, qint64 length, QFile::FileAdvice advice)
+{
+#if defined(POSIX_FADV_NORMAL)
+    Q_D(QFSFileEngine);
+
+    if (d->openMode == QIODevice::NotOpen) {
+        setError(QFile::PermissionsError, qt_error_string(EACCES));
+        return false;
+    }
+    if (offset < 0 || length < 0) {
+        setError(QFile::UnspecifiedError, qt_error_string(EINVAL));
+        return false;
+    }
+
+    int nativeAdvice = POSIX_FADV_NORMAL;
+    switch (advice) {
+    case QFileDevice::NormalAdvice:
+        nativeAdvice = POSIX_FADV_NORMAL;
+        break;
+    case QFileDevice::SequentialAdvice:
+        nativeAdvice = POSIX_FADV_SEQUENTIAL;
+        break;
+    case QFileDevice::RandomAdvice:
+        nativeAdvice = POSIX_FADV_RANDOM;
+        break;
+    case QFileDevice::WillNeedAdvice:
+        nativeAdvice = POSIX_FADV_WILLNEED;
+        break;
+    case QFileDevice::DontNeedAdvice:
+        nativeAdvice = POSIX_FADV_DONTNEED;
+        break;
+    }
+
+    if (int err = posix_fadvise(d->nativeHandle(), QT_OFF_T(offset), QT_OFF_T(length),
+                                nativeAdvice)) {
+        setError(QFile::UnspecifiedError, qt_error_string(err));
+        return false;
+    }
+    return true;
+#else
+    return QAbstractFileEngine::advise(offset, length, advice);
+#endif
+}
+
 /*!
     \reimp
 */
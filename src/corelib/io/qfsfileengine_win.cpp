@@ -899,6 +899,16 @@ bool QFSFileEnginePrivate::unmap(uchar *ptr)
     return true;
 }
 
+/*!
+    \reimp
+*/
+bool QFSFileEngine::advise(qint64 offset, qint64 length, QFile::FileAdvice advice)
+{
+    // Windows has no posix_fadvise() equivalent for an open handle; access
+    // pattern flags can only be given to CreateFile().
+    return QAbstractFileEngine::advise(offset, length, advice);
+}
+
 /*!
     \reimp
 */
@@ -12,6 +12,7 @@
 #include "private/qtools_p.h"
 
 #include <algorithm>
+#include <string.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -1478,6 +1479,70 @@ QByteArray QIODevice::readLine(qint64 maxSize)
     return result;
 }
 
+/*!
+    \since 6.9
+
+    Reads a line from the internal read buffer without copying it, and returns
+    it as a view into that buffer. If \a maxSize is greater than 0, the view
+    contains at most \a maxSize bytes.
+
+    The returned view includes the trailing newline character and stays valid
+    only until the next call to a function of this device; after that, the
+    viewed bytes may be overwritten or freed. Copy the data if it has to
+    outlive the view.
+
+    An empty view is returned when no complete line is available in a
+    contiguous part of the internal buffer; that doesn't necessarily mean the
+    device is at its end, so callers should fall back to readLine() in that
+    case. Unlike readLine(), this function performs no end-of-line translation
+    and always returns an empty view on devices opened in text mode.
+
+    \sa readLine(), peekView(), canReadLine()
+*/
+QByteArrayView QIODevice::readLineView(qint64 maxSize)
+{
+    Q_D(QIODevice);
+#if defined QIODEVICE_DEBUG
+    printf("%p QIODevice::readLineView(%lld), d->pos = %lld, d->buffer.size() = %lld\n",
+           this, maxSize, d->pos, d->buffer.size());
+#endif
+
+    CHECK_READABLE(readLineView, QByteArrayView());
+    if (maxSize < 0) {
+        checkWarnMessage(this, "readLineView", "Called with maxSize < 0");
+        return {};
+    }
+    if (d->openMode & QIODevice::Text)
+        return {};  // views don't translate end-of-line; use readLine()
+
+    const QByteArrayView view = d->peekView(-1);
+    if (view.isEmpty())
+        return {};
+
+    const qint64 contiguous = view.size();
+    const qint64 limit = (maxSize > 0) ? qMin(contiguous, maxSize) : contiguous;
+    qint64 length;
+    if (const void *newline = memchr(view.data(), '\n', size_t(limit)))
+        length = static_cast<const char *>(newline) - view.data() + 1;
+    else if (maxSize > 0 && contiguous >= maxSize)
+        length = maxSize;           // line truncated at maxSize, like readLine()
+    else if (bytesAvailable() == limit)
+        length = limit;             // unterminated last line at the end of the stream
+    else
+        return {};                  // no complete line contiguously buffered
+
+    if (d->isSequential() && d->transactionStarted) {
+        d->transactionPos += length;
+    } else {
+        // Keep a reference to the chunk's storage: skip() may free the chunk,
+        // but the view we hand out has to survive until the next call.
+        d->viewAnchor = d->buffer.firstChunkStorage();
+        if (skip(length) != length)
+            return {};
+    }
+    return view.first(qsizetype(length));
+}
+
 /*!
     Reads up to \a maxSize characters into \a data and returns the
     number of characters read.
@@ -1845,6 +1910,37 @@ QByteArray QIODevicePrivate::peek(qint64 maxSize)
     return result;
 }
 
+/*!
+    \internal
+
+    Returns a view of the data that is buffered contiguously at the current
+    read position, without copying it. The view stays valid until the buffer
+    is next modified.
+*/
+QByteArrayView QIODevicePrivate::peekView(qint64 maxSize)
+{
+    if (maxSize == 0)
+        return {};
+
+    if (buffer.isEmpty()) {
+        // bring a chunk of data into the buffer, as peek() would
+        char c;
+        if (peek(&c, 1) < 1)
+            return {};
+    }
+
+    const qint64 bufferPos = (isSequential() && transactionStarted)
+                             ? transactionPos : Q_INT64_C(0);
+    qint64 contiguous;
+    const char *ptr = buffer.readPointerAtPosition(bufferPos, contiguous);
+    if (!ptr)
+        return {};
+
+    if (maxSize > 0)
+        contiguous = qMin(contiguous, maxSize);
+    return QByteArrayView(ptr, qsizetype(contiguous));
+}
+
 /*! \fn bool QIODevice::getChar(char *c)
 
     Reads one character from the device and stores it in \a c. If \a c
@@ -1915,6 +2011,34 @@ QByteArray QIODevice::peek(qint64 maxSize)
     return d->peek(maxSize);
 }
 
+/*!
+    \since 6.9
+
+    Peeks at the internal read buffer without copying it, returning a view of
+    the data that is buffered contiguously at the current position. If
+    \a maxSize is not negative, the view contains at most \a maxSize bytes.
+
+    The returned view stays valid only until the next call to a function of
+    this device; after that, the viewed bytes may be overwritten or freed.
+    Copy the data if it has to outlive the view. Use skip() to consume viewed
+    bytes without copying them.
+
+    The view may be shorter than bytesAvailable() — it never spans more than
+    one chunk of the internal buffer — and is empty when nothing can be
+    viewed, for example on unbuffered devices. No end-of-line translation is
+    performed in text mode; the data is returned exactly as stored.
+
+    \sa peek(), readLineView(), skip()
+*/
+QByteArrayView QIODevice::peekView(qint64 maxSize)
+{
+    Q_D(QIODevice);
+
+    CHECK_READABLE(peekView, QByteArrayView());
+
+    return d->peekView(maxSize);
+}
+
 /*!
     \since 5.10
 
@@ -4,6 +4,7 @@
 #ifndef QIODEVICE_H
 #define QIODEVICE_H
 
+#include <QtCore/qbytearrayview.h>
 #include <QtCore/qglobal.h>
 #include <QtCore/qiodevicebase.h>
 #ifndef QT_NO_QOBJECT
@@ -78,6 +79,7 @@ public:
     QByteArray readAll();
     qint64 readLine(char *data, qint64 maxlen);
     QByteArray readLine(qint64 maxlen = 0);
+    QByteArrayView readLineView(qint64 maxlen = 0);
     virtual bool canReadLine() const;
 
     void startTransaction();
@@ -91,6 +93,7 @@ public:
 
     qint64 peek(char *data, qint64 maxlen);
     QByteArray peek(qint64 maxlen);
+    QByteArrayView peekView(qint64 maxlen = -1);
     qint64 skip(qint64 maxSize);
 
     virtual bool waitForReadyRead(int msecs);
@@ -66,6 +66,7 @@ public:
         inline qint64 nextDataBlockSize() const { return (m_buf ? m_buf->nextDataBlockSize() : Q_INT64_C(0)); }
         inline const char *readPointer() const { return (m_buf ? m_buf->readPointer() : nullptr); }
         inline const char *readPointerAtPosition(qint64 pos, qint64 &length) const { Q_ASSERT(m_buf); return m_buf->readPointerAtPosition(pos, length); }
+        inline QByteArray firstChunkStorage() const { return (m_buf ? m_buf->firstChunkStorage() : QByteArray()); }
         inline void free(qint64 bytes) { Q_ASSERT(m_buf); m_buf->free(bytes); }
         inline char *reserve(qint64 bytes) { Q_ASSERT(m_buf); return m_buf->reserve(bytes); }
         inline char *reserveFront(qint64 bytes) { Q_ASSERT(m_buf); return m_buf->reserveFront(bytes); }
@@ -102,6 +103,9 @@ public:
     QVarLengthArray<QRingBuffer, 2> readBuffers;
     QVarLengthArray<QRingBuffer, 1> writeBuffers;
     QString errorString;
+    // pins the storage of the most recent view handed out by
+    // QIODevice::readLineView() while its bytes are freed from the buffer
+    QByteArray viewAnchor;
     QIODevice::OpenMode openMode = QIODevice::NotOpen;
 
     bool transactionStarted = false;
@@ -148,6 +152,7 @@ public:
     qint64 readLine(char *data, qint64 maxSize);
     virtual qint64 peek(char *data, qint64 maxSize);
     virtual QByteArray peek(qint64 maxSize);
+    virtual QByteArrayView peekView(qint64 maxSize);
     qint64 skipByReading(qint64 maxSize);
     void write(const char *data, qint64 size);
 
@@ -13,12 +13,6 @@ using namespace Qt::StringLiterals;
 
 namespace QIPAddressUtils {
 
-static QString number(quint8 val)
-{
-    QString zero = QStringLiteral("0");
-    return val ? qulltoa(val, 10, zero) : zero;
-}
-
 typedef QVarLengthArray<char, 64> Buffer;
 static const QChar *checkedToAscii(Buffer &buffer, const QChar *begin, const QChar *end)
 {
@@ -38,10 +32,50 @@ static const QChar *checkedToAscii(Buffer &buffer, const QChar *begin, const QCh
     return nullptr;
 }
 
+// Single-pass parser for the common plain dotted-decimal form, reading the
+// UTF-16 data directly. Everything this rejects (hex and octal fields, fewer
+// than four fields) may still be acceptable to the general parser below.
+static bool parseIp4FastPath(IPv4Address &address, const QChar *begin, const QChar *end)
+{
+    using QtMiscUtils::isAsciiDigit;
+    quint32 result = 0;
+    const QChar *ptr = begin;
+    for (int part = 0; part < 4; ++part) {
+        if (part != 0) {
+            if (ptr == end || *ptr != u'.')
+                return false;
+            ++ptr;
+        }
+        if (ptr == end || !isAsciiDigit(ptr->unicode()))
+            return false;
+        const char16_t first = ptr->unicode();
+        uint value = first - u'0';
+        ++ptr;
+        int digits = 1;
+        while (ptr != end && isAsciiDigit(ptr->unicode())) {
+            // a leading zero means octal to the general parser
+            if (++digits > 3 || first == u'0')
+                return false;
+            value = value * 10 + (ptr->unicode() - u'0');
+            ++ptr;
+        }
+        if (value > 255)
+            return false;
+        result = (result << 8) | value;
+    }
+    if (ptr != end)
+        return false;
+    address = result;
+    return true;
+}
+
 static bool parseIp4Internal(IPv4Address &address, const char *ptr, bool acceptLeadingZero);
 bool parseIp4(IPv4Address &address, const QChar *begin, const QChar *end)
 {
     Q_ASSERT(begin != end);
+    if (parseIp4FastPath(address, begin, end))
+        return true;
+
     Buffer buffer;
     if (checkedToAscii(buffer, begin, end))
         return false;
@@ -93,12 +127,20 @@ static bool parseIp4Internal(IPv4Address &address, const char *ptr, bool acceptL
 
 void toString(QString &appendTo, IPv4Address address)
 {
-    // reconstructing is easy
-    // use the fast operator% that pre-calculates the size
-    appendTo += number(address >> 24) % u'.'
-                % number(address >> 16) % u'.'
-                % number(address >> 8) % u'.'
-                % number(address);
+    // reconstructing is easy: format into a stack buffer and append once
+    char16_t buffer[sizeof "255.255.255.255"];
+    char16_t *dst = buffer;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        const quint8 byte = address >> shift;
+        if (byte >= 100)
+            *dst++ = u'0' + byte / 100;
+        if (byte >= 10)
+            *dst++ = u'0' + (byte / 10) % 10;
+        *dst++ = u'0' + byte % 10;
+        if (shift != 0)
+            *dst++ = u'.';
+    }
+    appendTo += QStringView(buffer, dst);
 }
 
 /*!
@@ -212,9 +254,9 @@ const QChar *parseIp6(IPv6Address &address, const QChar *begin, const QChar *end
     return pos == 16 ? nullptr : end;
 }
 
-static inline QChar toHex(uchar c)
+static inline char16_t toHex(uchar c)
 {
-    return QChar::fromLatin1(QtMiscUtils::toHexLower(c));
+    return char16_t(QtMiscUtils::toHexLower(c));
 }
 
 void toString(QString &appendTo, const IPv6Address address)
@@ -227,7 +269,6 @@ void toString(QString &appendTo, const IPv6Address address)
     // and the longest with an IPv4 address is:
     //   "::ffff:255.255.255.255"
     static const int Ip6AddressMaxLen = sizeof "1111:2222:3333:4444:5555:6666:7777:8888";
-    static const int Ip6WithIp4AddressMaxLen = sizeof "::ffff:255.255.255.255";
 
     // check for the special cases
     const quint64 zeroes[] = { 0, 0 };
@@ -249,9 +290,10 @@ void toString(QString &appendTo, const IPv6Address address)
         }
     }
 
-    // QString::reserve doesn't shrink, so it's fine to us
-    appendTo.reserve(appendTo.size() +
-                     (embeddedIp4 ? Ip6WithIp4AddressMaxLen : Ip6AddressMaxLen));
+    // format into a stack buffer and append once; the embedded IPv4 form
+    // flushes before its last four octets, so this length is enough for both
+    char16_t buffer[Ip6AddressMaxLen];
+    char16_t *dst = buffer;
 
     // for finding where to place the "::"
     int zeroRunLength = 0; // in octets
@@ -273,20 +315,21 @@ void toString(QString &appendTo, const IPv6Address address)
         }
     }
 
-    const QChar colon = u':';
+    const char16_t colon = u':';
     if (zeroRunLength < 4)
         zeroRunOffset = -1;
     else if (zeroRunOffset == 0)
-        appendTo.append(colon);
+        *dst++ = colon;
 
     for (int i = 0; i < 16; i += 2) {
         if (i == zeroRunOffset) {
-            appendTo.append(colon);
+            *dst++ = colon;
             i += zeroRunLength - 2;
             continue;
         }
 
         if (i == 12 && embeddedIp4) {
+            appendTo += QStringView(buffer, dst);
             IPv4Address ip4 = address[12] << 24 |
                               address[13] << 16 |
                               address[14] << 8 |
@@ -297,25 +340,27 @@ void toString(QString &appendTo, const IPv6Address address)
 
         if (address[i]) {
             if (address[i] >> 4) {
-                appendTo.append(toHex(address[i] >> 4));
-                appendTo.append(toHex(address[i] & 0xf));
-                appendTo.append(toHex(address[i + 1] >> 4));
-                appendTo.append(toHex(address[i + 1] & 0xf));
+                *dst++ = toHex(address[i] >> 4);
+                *dst++ = toHex(address[i] & 0xf);
+                *dst++ = toHex(address[i + 1] >> 4);
+                *dst++ = toHex(address[i + 1] & 0xf);
             } else if (address[i] & 0xf) {
-                appendTo.append(toHex(address[i] & 0xf));
-                appendTo.append(toHex(address[i + 1] >> 4));
-                appendTo.append(toHex(address[i + 1] & 0xf));
+                *dst++ = toHex(address[i] & 0xf);
+                *dst++ = toHex(address[i + 1] >> 4);
+                *dst++ = toHex(address[i + 1] & 0xf);
             }
         } else if (address[i + 1] >> 4) {
-            appendTo.append(toHex(address[i + 1] >> 4));
-            appendTo.append(toHex(address[i + 1] & 0xf));
+            *dst++ = toHex(address[i + 1] >> 4);
+            *dst++ = toHex(address[i + 1] & 0xf);
         } else {
-            appendTo.append(toHex(address[i + 1] & 0xf));
+            *dst++ = toHex(address[i + 1] & 0xf);
         }
 
         if (i != 14)
-            appendTo.append(colon);
+            *dst++ = colon;
     }
+
+    appendTo += QStringView(buffer, dst);
 }
 
 }
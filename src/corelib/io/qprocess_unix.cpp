@@ -16,6 +16,8 @@
 
 #ifdef Q_OS_DARWIN
 #include <private/qcore_mac_p.h>
+#include <crt_externs.h>
+#include <spawn.h>
 #endif
 
 #include <private/qcoreapplication_p.h>
@@ -322,11 +324,23 @@ struct QChildProcess
 
     int startChild(pid_t *pid)
     {
+#ifdef Q_OS_DARWIN
+        // We never use vfork() on Darwin, so without this we'd always pay for
+        // duplicating the parent's address space only to throw the copy away
+        // at execve() time. posix_spawn(2) is the system's fast path, but it
+        // can only express the child-side set up that startProcess() performs
+        // when there are no unixExtras.
+        if (!d->unixExtras)
+            return trySpawn(pid);
+#endif
         int ffdflags = FFD_CLOEXEC | (isUsingVfork ? 0 : FFD_USE_FORK);
         return ::vforkfd(ffdflags, pid, &QChildProcess::startProcess, this);
     }
 
 private:
+#ifdef Q_OS_DARWIN
+    int trySpawn(pid_t *ppid) const noexcept;
+#endif
     Q_NORETURN void startProcess() const noexcept;
     static int startProcess(void *self) noexcept
     {
@@ -893,6 +907,68 @@ static void callChildProcessModifier(const QProcessPrivate *d) noexcept
     }
 }
 
+#ifdef Q_OS_DARWIN
+// Starts the child via posix_spawn(2) instead of fork()/execve(). Only called
+// when there are no unixExtras, so everything startProcess() would do in the
+// child is expressed as spawn file actions and attributes here. Returns a file
+// descriptor suitable for forkfd_wait() (see spawnfd() in forkfd.c), or -1
+// with errno set on failure.
+int QChildProcess::trySpawn(pid_t *ppid) const noexcept
+{
+    posix_spawn_file_actions_t fileActions;
+    posix_spawnattr_t attr;
+    if (int err = posix_spawn_file_actions_init(&fileActions); err != 0) {
+        errno = err;
+        return -1;
+    }
+    if (int err = posix_spawnattr_init(&attr); err != 0) {
+        posix_spawn_file_actions_destroy(&fileActions);
+        errno = err;
+        return -1;
+    }
+
+    int err = 0;
+    auto addAction = [&](int r) { if (err == 0) err = r; };
+
+    // render the channels configuration, like commitChannels()
+    if (d->stdinChannel.pipe[0] != INVALID_Q_PIPE)
+        addAction(posix_spawn_file_actions_adddup2(&fileActions, d->stdinChannel.pipe[0],
+                                                   STDIN_FILENO));
+    if (d->stdoutChannel.pipe[1] != INVALID_Q_PIPE)
+        addAction(posix_spawn_file_actions_adddup2(&fileActions, d->stdoutChannel.pipe[1],
+                                                   STDOUT_FILENO));
+    if (d->stderrChannel.pipe[1] != INVALID_Q_PIPE) {
+        addAction(posix_spawn_file_actions_adddup2(&fileActions, d->stderrChannel.pipe[1],
+                                                   STDERR_FILENO));
+    } else if (d->processChannelMode == QProcess::MergedChannels) {
+        addAction(posix_spawn_file_actions_adddup2(&fileActions, STDOUT_FILENO, STDERR_FILENO));
+    }
+
+    // enter the working directory
+    if (workingDirectory >= 0)
+        addAction(posix_spawn_file_actions_addfchdir_np(&fileActions, workingDirectory));
+
+    // reset the SIGPIPE handler that we ignore in the parent
+    sigset_t sigdefault;
+    sigemptyset(&sigdefault);
+    sigaddset(&sigdefault, SIGPIPE);
+    addAction(posix_spawnattr_setsigdefault(&attr, &sigdefault));
+    addAction(posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF));
+
+    int ret = -1;
+    if (err == 0) {
+        char **environment = envp.pointers ? envp.pointers.get() : *_NSGetEnviron();
+        ret = ::spawnfd(FFD_CLOEXEC, ppid, argv[0], &fileActions, &attr, argv, environment);
+    } else {
+        errno = err;
+    }
+
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&fileActions);
+    return ret;
+}
+#endif // Q_OS_DARWIN
+
 // IMPORTANT:
 //
 // This function is called in a vfork() context on some OSes (notably, Linux
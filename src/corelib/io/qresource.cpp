@@ -25,6 +25,8 @@
 #include "private/qtools_p.h"
 #include "private/qsystemerror_p.h"
 
+#include <algorithm>
+
 #ifndef QT_NO_COMPRESS
 #  include <zconf.h>
 #  include <zlib.h>
@@ -275,7 +277,8 @@ static inline ResourceList *resourceList()
                             be decompressed using the qUncompress() function.
     \value ZstdCompression  Contents are compressed using \l{Zstandard Site}{zstd}. To
                             decompress, use the \c{ZSTD_decompress} function from the zstd
-                            library.
+                            library. The contents may consist of multiple concatenated
+                            zstd frames, which that function decompresses jointly.
 
     \sa compressionAlgorithm()
 */
@@ -440,8 +443,20 @@ qint64 QResourcePrivate::uncompressedSize() const
 
     case QResource::ZstdCompression: {
 #if QT_CONFIG(zstd)
-        size_t n = ZSTD_getFrameContentSize(data, size);
-        return ZSTD_isError(n) ? -1 : qint64(n);
+        // the content may consist of multiple concatenated frames (see rcc)
+        qint64 total = 0;
+        size_t pos = 0;
+        while (pos < size_t(size)) {
+            unsigned long long usize = ZSTD_getFrameContentSize(data + pos, size_t(size) - pos);
+            size_t csize = ZSTD_findFrameCompressedSize(data + pos, size_t(size) - pos);
+            if (ZSTD_isError(csize) || usize == ZSTD_CONTENTSIZE_UNKNOWN
+                    || usize == ZSTD_CONTENTSIZE_ERROR) {
+                return -1;
+            }
+            total += qint64(usize);
+            pos += csize;
+        }
+        return total;
 #else
         // This should not happen because we've refused to load such resource
         Q_ASSERT(!"QResource: Qt built without support for Zstd compression");
@@ -1389,9 +1404,27 @@ private:
     void mapUncompressed();
     bool mapUncompressed_sys();
     void unmapUncompressed_sys();
+#if QT_CONFIG(zstd)
+    bool buildZstdIndex();
+    qint64 readZstd(char *data, qint64 len);
+#endif
     qint64 offset = 0;
     QResource resource;
     mutable QByteArray uncompressed;
+#if QT_CONFIG(zstd)
+    // for multi-frame zstd entries, read() decompresses one frame at a time
+    // instead of materializing the whole contents at open() (see rcc)
+    struct ZstdFrame
+    {
+        qint64 uncompressedOffset;
+        qint64 uncompressedSize;
+        qsizetype compressedOffset;
+        qsizetype compressedSize;
+    };
+    QList<ZstdFrame> zstdFrames;
+    QByteArray cachedFrame;
+    qsizetype cachedFrameIndex = -1;
+#endif
     bool mustUnmap = false;
 
     // minimum size for which we'll try to re-open ourselves in mapUncompressed()
@@ -1442,10 +1475,18 @@ bool QResourceFileEngine::open(QIODevice::OpenMode flags,
     if (flags & QIODevice::WriteOnly)
         return false;
     if (d->resource.compressionAlgorithm() != QResource::NoCompression) {
-        d->uncompress();
-        if (d->uncompressed.isNull()) {
-            d->errorString = QSystemError::stdString(EIO);
-            return false;
+        bool lazyZstd = false;
+#if QT_CONFIG(zstd)
+        // multi-frame zstd entries are decompressed on demand in read()
+        lazyZstd = d->resource.compressionAlgorithm() == QResource::ZstdCompression
+                && d->buildZstdIndex();
+#endif
+        if (!lazyZstd) {
+            d->uncompress();
+            if (d->uncompressed.isNull()) {
+                d->errorString = QSystemError::stdString(EIO);
+                return false;
+            }
         }
     }
     if (!d->resource.isValid()) {
@@ -1474,10 +1515,15 @@ qint64 QResourceFileEngine::read(char *data, qint64 len)
         len = size() - d->offset;
     if (len <= 0)
         return 0;
-    if (!d->uncompressed.isNull())
+    if (!d->uncompressed.isNull()) {
         memcpy(data, d->uncompressed.constData() + d->offset, len);
-    else
+#if QT_CONFIG(zstd)
+    } else if (!d->zstdFrames.isEmpty()) {
+        return d->readZstd(data, len);
+#endif
+    } else {
         memcpy(data, d->resource.data() + d->offset, len);
+    }
     d->offset += len;
     return len;
 }
@@ -1623,6 +1669,11 @@ bool QResourceFileEngine::supportsExtension(Extension extension) const
 uchar *QResourceFileEnginePrivate::map(qint64 offset, qint64 size, QFile::MemoryMapFlags flags)
 {
     Q_Q(QResourceFileEngine);
+#if QT_CONFIG(zstd)
+    // a mapping needs the entire contents, so the per-frame laziness ends here
+    if (uncompressed.isNull() && !zstdFrames.isEmpty())
+        uncompress();
+#endif
     Q_ASSERT_X(resource.compressionAlgorithm() == QResource::NoCompression
                || !uncompressed.isNull(), "QFile::map()",
                "open() should have uncompressed compressed resources");
@@ -1664,6 +1715,82 @@ void QResourceFileEnginePrivate::uncompress() const
     uncompressed = resource.uncompressedData();
 }
 
+#if QT_CONFIG(zstd)
+/*
+    Scans the compressed contents for zstd frame boundaries, so read() can
+    decompress only the frames a read touches. rcc emits one frame per
+    CONSTANT_ZSTDCHUNKSIZE uncompressed bytes for large entries. Returns false
+    for single-frame entries (where eager decompression is just as good) and
+    on malformed contents (where uncompress() will report the error).
+*/
+bool QResourceFileEnginePrivate::buildZstdIndex()
+{
+    if (resource.size() == 0 || !resource.isValid())
+        return false;
+
+    const uchar *ptr = resource.data();
+    const size_t totalSize = size_t(resource.size());
+    qint64 uncompressedOffset = 0;
+    size_t pos = 0;
+    QList<ZstdFrame> frames;
+    while (pos < totalSize) {
+        unsigned long long usize = ZSTD_getFrameContentSize(ptr + pos, totalSize - pos);
+        size_t csize = ZSTD_findFrameCompressedSize(ptr + pos, totalSize - pos);
+        if (ZSTD_isError(csize) || usize == ZSTD_CONTENTSIZE_UNKNOWN
+                || usize == ZSTD_CONTENTSIZE_ERROR) {
+            return false;
+        }
+        frames.append({uncompressedOffset, qint64(usize), qsizetype(pos), qsizetype(csize)});
+        uncompressedOffset += qint64(usize);
+        pos += csize;
+    }
+
+    if (frames.size() <= 1)
+        return false;
+    zstdFrames = std::move(frames);
+    return true;
+}
+
+qint64 QResourceFileEnginePrivate::readZstd(char *data, qint64 len)
+{
+    qint64 written = 0;
+    while (written < len) {
+        const qint64 pos = offset + written;
+        // find the frame containing pos (the list is sorted by offset)
+        auto it = std::upper_bound(zstdFrames.cbegin(), zstdFrames.cend(), pos,
+                                   [](qint64 p, const ZstdFrame &frame) {
+                                       return p < frame.uncompressedOffset;
+                                   });
+        Q_ASSERT(it != zstdFrames.cbegin());
+        --it;
+
+        // keep the most recently used frame decompressed, which makes
+        // sequential reads decompress each frame exactly once
+        const qsizetype frameIndex = it - zstdFrames.cbegin();
+        if (frameIndex != cachedFrameIndex) {
+            QByteArray frame(it->uncompressedSize, Qt::Uninitialized);
+            size_t n = ZSTD_decompress(frame.data(), size_t(frame.size()),
+                                       resource.data() + it->compressedOffset,
+                                       size_t(it->compressedSize));
+            if (ZSTD_isError(n) || qint64(n) != it->uncompressedSize) {
+                qWarning("QResource: error decompressing zstd content: %s",
+                         ZSTD_getErrorName(n));
+                break;
+            }
+            cachedFrame = std::move(frame);
+            cachedFrameIndex = frameIndex;
+        }
+
+        const qint64 frameOffset = pos - it->uncompressedOffset;
+        const qint64 chunk = qMin(len - written, it->uncompressedSize - frameOffset);
+        memcpy(data + written, cachedFrame.constData() + frameOffset, chunk);
+        written += chunk;
+    }
+    offset += written;
+    return written > 0 ? written : -1;
+}
+#endif // QT_CONFIG(zstd)
+
 void QResourceFileEnginePrivate::mapUncompressed()
 {
     Q_ASSERT(resource.compressionAlgorithm() == QResource::NoCompression);
@@ -1390,6 +1390,7 @@ void QConfFileSettingsPrivate::syncConfFile(QConfFile *confFile)
 
     if (mustReadFile) {
         confFile->unparsedIniSections.clear();
+        confFile->iniData.clear();
         confFile->originalKeys.clear();
 
         QFile file(confFile->name);
@@ -1407,8 +1408,8 @@ void QConfFileSettingsPrivate::syncConfFile(QConfFile *confFile)
 
 #ifdef Q_OS_WASM
             if (format == QSettings::WebIndexedDBFormat) {
-                QByteArray data = file.readAll();
-                ok = readIniFile(data, &confFile->unparsedIniSections);
+                confFile->iniData = file.readAll();
+                ok = readIniFile(confFile->iniData, &confFile->unparsedIniSections);
             } else
 #endif
 #ifdef Q_OS_DARWIN
@@ -1418,8 +1419,11 @@ void QConfFileSettingsPrivate::syncConfFile(QConfFile *confFile)
             } else
 #endif
             if (format <= QSettings::IniFormat) {
-                QByteArray data = file.readAll();
-                ok = readIniFile(data, &confFile->unparsedIniSections);
+                // Keep the raw contents alive in the QConfFile: the unparsed
+                // sections are zero-copy views into it, so the initial read
+                // doesn't duplicate the whole file just to parse it lazily.
+                confFile->iniData = file.readAll();
+                ok = readIniFile(confFile->iniData, &confFile->unparsedIniSections);
             } else if (readFunc) {
                 QSettings::SettingsMap tempNewKeys;
                 ok = readFunc(file, tempNewKeys);
@@ -1497,6 +1501,7 @@ void QConfFileSettingsPrivate::syncConfFile(QConfFile *confFile)
 
         if (ok) {
             confFile->unparsedIniSections.clear();
+            confFile->iniData.clear();
             confFile->originalKeys = mergedKeys;
             confFile->addedKeys.clear();
             confFile->removedKeys.clear();
@@ -1623,6 +1628,12 @@ break_out_of_outer_loop:
     possible, so if the user doesn't check the status he will get the
     most out of the file anyway.
 */
+/*
+    Splits data into unparsed sections, to be parsed on demand by
+    ensureSectionParsed(). The section entries are views into data wherever
+    possible, so the caller must keep the backing buffer alive for as long as
+    the map (see QConfFile::iniData).
+*/
 bool QConfFileSettingsPrivate::readIniFile(QByteArrayView data,
                                            UnparsedSettingsMap *unparsedIniSections)
 {
@@ -1631,9 +1642,15 @@ bool QConfFileSettingsPrivate::readIniFile(QByteArrayView data,
         QByteArray &sectionData = (*unparsedIniSections)[QSettingsKey(currentSection, \
                                                                       IniCaseSensitivity, \
                                                                       sectionPosition)]; \
-        if (!sectionData.isEmpty()) \
+        const QByteArrayView sectionView = data.first(lineStart).sliced(currentSectionStart); \
+        if (sectionData.isEmpty()) { \
+            /* a view into the caller's buffer (which must outlive the map), not a copy */ \
+            sectionData = QByteArray::fromRawData(sectionView.constData(), sectionView.size()); \
+        } else { \
+            /* the section appears more than once; fall back to an owned copy */ \
             sectionData.append('\n'); \
-        sectionData += data.first(lineStart).sliced(currentSectionStart); \
+            sectionData += sectionView; \
+        } \
         sectionPosition = ++position; \
     }
 
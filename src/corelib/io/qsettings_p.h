@@ -126,6 +126,7 @@ public:
     QString name;
     QDateTime timeStamp;
     qint64 size;
+    QByteArray iniData;     // raw file contents backing unparsedIniSections
     UnparsedSettingsMap unparsedIniSections;
     ParsedSettingsMap originalKeys;
     ParsedSettingsMap addedKeys;
@@ -11,6 +11,7 @@
 #include <private/qtools_p.h>
 
 #include <QtCore/qdirlisting.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qsystemdetection.h>
 
 #include <q20memory.h>
@@ -418,8 +419,94 @@ void QStorageInfoPrivate::retrieveVolumeInfo()
     }
 }
 
+static QByteArray readMountInfo(int fd)
+{
+    QByteArray data;
+    if (lseek(fd, 0, SEEK_SET) < 0)
+        return data;
+
+    qsizetype used = 0;
+    for (;;) {
+        data.resize(used + 4096);
+        ssize_t n = qt_safe_read(fd, data.data() + used, data.size() - used);
+        if (n <= 0)
+            break;
+        used += n;
+    }
+    data.resize(used);
+    return data;
+}
+
+namespace {
+// Parsing /proc/self/mountinfo is by far the most expensive part of refresh()
+// and mountedVolumes(), and the mount table rarely changes. The kernel makes
+// this file pollable: an fd kept open on it reports POLLPRI (POLLERR before
+// Linux 2.6.30) once the mount table has changed since the fd was last read,
+// and re-reading the file rearms the notification. So we keep one fd and a
+// parsed snapshot around and only reparse when poll() says we must.
+//
+// The per-volume statfs() data (bytes free, etc.) is not cached; only the
+// mount table is.
+struct MountInfoCache
+{
+    QBasicMutex mutex;
+    int fd = -1;
+    bool populated = false;
+    std::vector<MountInfo> entries;     // always unfiltered
+
+    ~MountInfoCache()
+    {
+        if (fd >= 0)
+            qt_safe_close(fd);
+    }
+
+    std::vector<MountInfo> get(FilterMountInfo filter);
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(MountInfoCache, mountInfoCache)
+
+std::vector<MountInfo> MountInfoCache::get(FilterMountInfo filter)
+{
+    const QMutexLocker locker(&mutex);
+    if (fd < 0)
+        fd = qt_safe_open(MountInfoPath, QT_OPEN_RDONLY);
+    if (fd < 0)
+        return {};
+
+    bool refreshNeeded = !populated;
+    if (!refreshNeeded) {
+        pollfd pfd = qt_make_pollfd(fd, POLLPRI);
+        if (qt_safe_poll(&pfd, 1, QDeadlineTimer(0)) > 0
+                && (pfd.revents & (POLLPRI | POLLERR)) != 0)
+            refreshNeeded = true;
+    }
+    if (refreshNeeded) {
+        entries = doParseMountInfo(readMountInfo(fd), FilterMountInfo::All);
+        populated = true;
+    }
+
+    if (filter == FilterMountInfo::All)
+        return entries;
+
+    std::vector<MountInfo> filtered;
+    filtered.reserve(entries.size());
+    std::copy_if(entries.begin(), entries.end(), std::back_inserter(filtered),
+                 [](const MountInfo &info) {
+                     return shouldIncludeFs(info.mountPoint, info.fsType);
+                 });
+    return filtered;
+}
+
 static std::vector<MountInfo> parseMountInfo(FilterMountInfo filter = FilterMountInfo::All)
 {
+    // An application that changes its mount namespace after the first query
+    // (e.g. via unshare(2)) would keep seeing the old namespace through the
+    // cached fd; such code can disable the cache.
+    static const bool cacheDisabled = qEnvironmentVariableIntValue("QT_NO_MOUNTINFO_CACHE") > 0;
+    if (!cacheDisabled && !mountInfoCache.isDestroyed())
+        return mountInfoCache->get(filter);
+
     QFile file(u"/proc/self/mountinfo"_s);
     if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
         return {};
@@ -333,6 +333,48 @@ static void unicodeToEncodedUtf8(QString &result, char16_t *&output, const char1
     }
 }
 
+#ifdef __SSE2__
+/*
+    Scans from \a input to \a end for the first character the recode loop may
+    have to act on: anything outside the printable ASCII range, or a printable
+    character whose entry in \a actionTable is not LeaveCharacter. Characters
+    skipped here are guaranteed to pass through the recode loop unchanged.
+*/
+static const char16_t *scanForActionable(const char16_t *input, const char16_t *end,
+                                         const uchar *actionTable)
+{
+    // One bit per character in [0x20, 0x80): set if the recode loop needs to
+    // inspect it. '%' is always included, as percent sequences get special
+    // treatment regardless of the table.
+    quint64 actionable[2] = { 0, 0 };
+    for (int i = 0; i < 96; ++i) {
+        if (actionTable[i] != LeaveCharacter || i == '%' - ' ')
+            actionable[i >> 6] |= quint64(1) << (i & 63);
+    }
+
+    const __m128i offset = _mm_set1_epi16(0x20);
+    const __m128i range = _mm_set1_epi16(0x5f);
+    const __m128i zero = _mm_setzero_si128();
+    while (end - input >= 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+        // in the printable ASCII range iff (c - 0x20) <= 0x5f, unsigned
+        const __m128i inRange =
+                _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(data, offset), range), zero);
+        if (ushort(_mm_movemask_epi8(inRange)) != 0xffff)
+            return input;   // a control or non-ASCII character; leave it to the scalar loop
+        uint mask = 0;
+        for (int i = 0; i < 8; ++i) {
+            const uint idx = input[i] - 0x20;
+            mask |= uint((actionable[idx >> 6] >> (idx & 63)) & 1) << i;
+        }
+        if (mask)
+            return input + qCountTrailingZeroBits(mask);
+        input += 8;
+    }
+    return input;
+}
+#endif
+
 static int recode(QString &result, const char16_t *begin, const char16_t *end,
                   QUrl::ComponentFormattingOptions encoding, const uchar *actionTable,
                   bool retryBadEncoding)
@@ -341,6 +383,17 @@ static int recode(QString &result, const char16_t *begin, const char16_t *end,
     const char16_t *input = begin;
     char16_t *output = nullptr;
 
+#ifdef __SSE2__
+    // Skip the leading run that needs no transformation; in the common case of
+    // an already well-formed ASCII component, this reaches the end and we
+    // never enter the character-by-character loop at all.
+    if (end - begin >= 16) {
+        input = scanForActionable(input, end, actionTable);
+        if (input == end)
+            return 0;
+    }
+#endif
+
     EncodingAction action = EncodeCharacter;
     for ( ; input != end; ++input) {
         char16_t c;
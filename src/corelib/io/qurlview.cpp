@@ -0,0 +1,285 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qurlview.h"
+
+#include <QtCore/private/qtools_p.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtMiscUtils;
+
+/*!
+    \class QUrlView
+    \inmodule QtCore
+    \since 6.9
+    \brief The QUrlView class provides a non-owning, read-only view over the
+    components of a URL.
+
+    \ingroup io
+    \ingroup network
+    \ingroup shared
+
+    \reentrant
+
+    QUrlView splits a URL string into its RFC 3986 components — scheme,
+    authority (user info, host, port), path, query and fragment — without
+    copying, validating, decoding or re-encoding anything. Each accessor
+    returns a QStringView into the string the view was constructed from, so
+    the string must stay alive and unmodified for as long as the view is used.
+
+    This makes QUrlView suitable for high-throughput, read-only processing of
+    URLs that are known (or assumed) to be well-formed, such as scanning log
+    files or crawling, where constructing a QUrl for every record just to look
+    at one or two components would be wasteful. The components are returned
+    exactly as they appear in the input: percent-encoded sequences are not
+    decoded, the scheme is not lowercased, hosts are not processed for IDN,
+    and an IPv6 host keeps its square brackets.
+
+    The component boundaries follow the same rules QUrl uses when parsing: the
+    scheme must start with an ASCII letter and consist of ASCII letters,
+    digits, \c{'+'}, \c{'-'} or \c{'.'} followed by a colon; an authority is
+    present only after \c{"//"}; the user info ends at the first \c{'@'} of
+    the authority and the port starts after its last colon outside any
+    \c{[...]} bracket pair.
+
+    Use toUrl() to convert to a full QUrl when normalization, validation or
+    encoding transformations are needed.
+
+    \sa QUrl, QStringView
+*/
+
+/*!
+    \fn QUrlView::QUrlView()
+
+    Constructs an empty view. All components are null.
+*/
+
+/*!
+    Constructs a view over \a url and locates its component boundaries.
+
+    The view does not own the data: \a url's underlying string must remain
+    valid and unchanged for the lifetime of the view and of any QStringView
+    obtained from it.
+*/
+QUrlView::QUrlView(QStringView url) noexcept
+    : m_url(url)
+{
+    // find the important delimiters, as QUrlPrivate::parse() does
+    qsizetype colon = -1;
+    qsizetype question = -1;
+    qsizetype hash = -1;
+    const qsizetype len = url.size();
+    const char16_t *const data = url.utf16();
+
+    for (qsizetype i = 0; i < len; ++i) {
+        const char16_t uc = data[i];
+        if (uc == '#') {
+            hash = i;
+            break;      // nothing more to be found
+        }
+
+        if (question == -1) {
+            if (uc == ':' && colon == -1)
+                colon = i;
+            else if (uc == '?')
+                question = i;
+        }
+    }
+
+    // check if we have a valid scheme
+    qsizetype hierStart = 0;
+    if (colon > 0 && (isAsciiLower(data[0]) || isAsciiUpper(data[0]))) {
+        qsizetype i = 1;
+        while (i < colon) {
+            const char16_t c = data[i];
+            if (!isAsciiLetterOrNumber(c) && c != '+' && c != '-' && c != '.')
+                break;
+            ++i;
+        }
+        if (i == colon) {
+            m_schemeLength = colon;
+            hierStart = colon + 1;
+        }
+    }
+
+    const qsizetype hierEnd = qMin<size_t>(qMin<size_t>(question, hash), len);
+    if (hierEnd - hierStart >= 2 && data[hierStart] == '/' && data[hierStart + 1] == '/') {
+        // we have an authority; it ends at the first slash after these
+        m_authorityStart = hierStart + 2;
+        m_pathStart = hierEnd;
+        for (qsizetype i = m_authorityStart; i < hierEnd; ++i) {
+            if (data[i] == '/') {
+                m_pathStart = i;
+                break;
+            }
+        }
+    } else {
+        m_pathStart = hierStart;
+    }
+    m_pathEnd = hierEnd;
+
+    if (size_t(question) < size_t(hash))
+        m_queryStart = question + 1;
+    if (hash != -1)
+        m_fragmentStart = hash + 1;
+}
+
+/*!
+    Returns the user info component — everything in the authority up to its
+    first \c{'@'} — or a null view if the authority has none.
+
+    The result may contain a user name and a password, separated by a colon,
+    still percent-encoded as in the input.
+
+    \sa authority(), host()
+*/
+QStringView QUrlView::userInfo() const noexcept
+{
+    const QStringView auth = authority();
+    const qsizetype at = auth.indexOf(u'@');
+    return at < 0 ? QStringView() : auth.first(at);
+}
+
+/*!
+    \internal
+
+    Returns the authority with any user info stripped.
+*/
+QStringView QUrlView::hostAndPort() const noexcept
+{
+    QStringView auth = authority();
+    const qsizetype at = auth.indexOf(u'@');
+    if (at >= 0)
+        auth = auth.sliced(at + 1);
+    return auth;
+}
+
+/*!
+    Returns the host component, exactly as it appears in the URL: not
+    lowercased, not decoded, and with the square brackets of an IPv6 address
+    left in place.
+
+    \sa port(), authority()
+*/
+QStringView QUrlView::host() const noexcept
+{
+    QStringView result = hostAndPort();
+    const qsizetype colon = result.lastIndexOf(u':');
+    if (colon < 0)
+        return result;
+    if (result.startsWith(u'[') && result.indexOf(u']') > colon)
+        return result;      // colon is inside an IPv6 address
+    return result.first(colon);
+}
+
+/*!
+    Returns the port number, or \a defaultPort if the URL has no port, the
+    port is empty, or it does not parse as a number in the range 0 to 65535.
+
+    \sa host()
+*/
+int QUrlView::port(int defaultPort) const noexcept
+{
+    const QStringView hp = hostAndPort();
+    const qsizetype colon = hp.lastIndexOf(u':');
+    if (colon < 0)
+        return defaultPort;
+    if (hp.startsWith(u'[') && hp.indexOf(u']') > colon)
+        return defaultPort; // colon is inside an IPv6 address
+
+    ulong x = 0;
+    const QStringView digits = hp.sliced(colon + 1);
+    if (digits.isEmpty())
+        return defaultPort;
+    for (const QChar ch : digits) {
+        const char16_t c = ch.unicode();
+        if (!isAsciiDigit(c))
+            return defaultPort;
+        x = x * 10 + (c - '0');
+        if (x > 65535)
+            return defaultPort;
+    }
+    return int(x);
+}
+
+/*!
+    Returns the query component — everything between \c{'?'} and the fragment
+    delimiter — or a null view if the URL has no query.
+
+    \sa hasQuery(), fragment()
+*/
+QStringView QUrlView::query() const noexcept
+{
+    if (!hasQuery())
+        return QStringView();
+    const qsizetype end = hasFragment() ? m_fragmentStart - 1 : m_url.size();
+    return m_url.sliced(m_queryStart, end - m_queryStart);
+}
+
+/*!
+    \fn QStringView QUrlView::url() const
+
+    Returns the string this view was constructed from.
+*/
+
+/*!
+    \fn bool QUrlView::isEmpty() const
+
+    Returns \c true if the viewed URL string is empty.
+*/
+
+/*!
+    \fn bool QUrlView::hasScheme() const
+
+    Returns \c true if the URL has a scheme.
+*/
+
+/*!
+    \fn QStringView QUrlView::scheme() const
+
+    Returns the scheme, exactly as it appears in the URL (not lowercased), or
+    a null view if the URL is relative.
+*/
+
+/*!
+    \fn bool QUrlView::hasAuthority() const
+
+    Returns \c true if the URL contains an authority component, that is, the
+    hierarchical part starts with \c{"//"}.
+*/
+
+/*!
+    \fn QStringView QUrlView::authority() const
+
+    Returns the authority component — user info, host and port — or a null
+    view if the URL has none.
+*/
+
+/*!
+    \fn QStringView QUrlView::path() const
+
+    Returns the path component. The path of a URL is never absent, but may be
+    empty.
+*/
+
+/*!
+    \fn bool QUrlView::hasFragment() const
+
+    Returns \c true if the URL has a fragment.
+*/
+
+/*!
+    \fn QStringView QUrlView::fragment() const
+
+    Returns the fragment component, or a null view if the URL has none.
+*/
+
+/*!
+    \fn QUrl QUrlView::toUrl(QUrl::ParsingMode mode) const
+
+    Returns a QUrl parsed from the viewed string using \a mode, applying the
+    validation and normalization that this class deliberately skips.
+*/
+
+QT_END_NAMESPACE
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QURLVIEW_H
+#define QURLVIEW_H
+
+#include <QtCore/qstringview.h>
+#include <QtCore/qurl.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QUrlView
+{
+public:
+    constexpr QUrlView() noexcept = default;
+    explicit QUrlView(QStringView url) noexcept;
+
+    QStringView url() const noexcept { return m_url; }
+    bool isEmpty() const noexcept { return m_url.isEmpty(); }
+
+    bool hasScheme() const noexcept { return m_schemeLength >= 0; }
+    QStringView scheme() const noexcept
+    { return hasScheme() ? m_url.first(m_schemeLength) : QStringView(); }
+
+    bool hasAuthority() const noexcept { return m_authorityStart >= 0; }
+    QStringView authority() const noexcept
+    {
+        return hasAuthority() ? m_url.sliced(m_authorityStart, m_pathStart - m_authorityStart)
+                              : QStringView();
+    }
+    QStringView userInfo() const noexcept;
+    QStringView host() const noexcept;
+    int port(int defaultPort = -1) const noexcept;
+
+    QStringView path() const noexcept
+    { return m_url.sliced(m_pathStart, m_pathEnd - m_pathStart); }
+
+    bool hasQuery() const noexcept { return m_queryStart >= 0; }
+    QStringView query() const noexcept;
+
+    bool hasFragment() const noexcept { return m_fragmentStart >= 0; }
+    QStringView fragment() const noexcept
+    { return hasFragment() ? m_url.sliced(m_fragmentStart) : QStringView(); }
+
+    QUrl toUrl(QUrl::ParsingMode mode = QUrl::TolerantMode) const
+    { return QUrl(m_url.toString(), mode); }
+
+private:
+    QStringView hostAndPort() const noexcept;
+
+    QStringView m_url;
+    qsizetype m_schemeLength = -1;
+    qsizetype m_authorityStart = -1;
+    qsizetype m_pathStart = 0;
+    qsizetype m_pathEnd = 0;
+    qsizetype m_queryStart = -1;
+    qsizetype m_fragmentStart = -1;
+};
+
+QT_END_NAMESPACE
+
+#endif // QURLVIEW_H
@@ -0,0 +1,703 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qipcringchannel.h"
+#include "qipcringchannel_p.h"
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qmath.h>
+#if QT_CONFIG(thread)
+#  include <QtCore/qthread.h>
+#endif
+
+#include <cstring>
+
+#ifdef Q_OS_UNIX
+#  include <private/qcore_unix_p.h>
+#  include <sys/stat.h>
+#endif
+
+#if defined(Q_OS_LINUX) && !defined(QT_LINUXBASE)
+#  include <asm/unistd.h>
+#  include <limits.h>
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  define QIPCRINGCHANNEL_USE_FUTEX
+#endif
+
+#if QT_CONFIG(sharedmemory)
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+#ifdef QIPCRINGCHANNEL_USE_FUTEX
+// Unlike QtLinuxFutex, these helpers do not pass FUTEX_PRIVATE_FLAG: the
+// futex word lives in the shared memory segment and the waiter and the waker
+// are different processes.
+static bool futexWaitShared(QBasicAtomicInteger<quint32> &futex, quint32 expectedValue,
+                            QDeadlineTimer deadline)
+{
+    int *addr = reinterpret_cast<int *>(&futex);
+    if (deadline.isForever()) {
+        syscall(__NR_futex, addr, FUTEX_WAIT_BITSET, qintptr(expectedValue), nullptr,
+                nullptr, FUTEX_BITSET_MATCH_ANY);
+        return true;
+    }
+    auto timeout = deadline.deadline<std::chrono::steady_clock>().time_since_epoch();
+    struct timespec ts = durationToTimespec(timeout);
+    long r = syscall(__NR_futex, addr, FUTEX_WAIT_BITSET, qintptr(expectedValue), &ts,
+                     nullptr, FUTEX_BITSET_MATCH_ANY);
+    return r == 0 || errno != ETIMEDOUT;
+}
+
+static void futexWakeShared(QBasicAtomicInteger<quint32> &futex)
+{
+    syscall(__NR_futex, reinterpret_cast<int *>(&futex), FUTEX_WAKE, INT_MAX, nullptr,
+            nullptr, 0);
+}
+#endif // QIPCRINGCHANNEL_USE_FUTEX
+
+#ifdef Q_OS_UNIX
+static QString doorbellPathForKey(const QNativeIpcKey &key)
+{
+    QByteArray id = QCryptographicHash::hash(key.toString().toUtf8(), QCryptographicHash::Sha1);
+    return QDir::tempPath() + "/qipcring-"_L1 + QString::fromLatin1(id.left(8).toHex());
+}
+#endif
+
+QIpcRingChannelPrivate::QIpcRingChannelPrivate(const QNativeIpcKey &key, QIpcRingChannel::Role role)
+    : memory(key), role(role)
+{
+}
+
+QIpcRingChannelPrivate::~QIpcRingChannelPrivate()
+{
+    closeDoorbell();
+}
+
+void QIpcRingChannelPrivate::setError(QIpcRingChannel::RingChannelError e, const QString &message)
+{
+    error = e;
+    errorString = message;
+}
+
+void QIpcRingChannelPrivate::setErrorFromSharedMemory()
+{
+    switch (memory.error()) {
+    case QSharedMemory::NoError:
+        error = QIpcRingChannel::NoError;
+        break;
+    case QSharedMemory::PermissionDenied:
+        error = QIpcRingChannel::PermissionDenied;
+        break;
+    case QSharedMemory::InvalidSize:
+        error = QIpcRingChannel::InvalidSize;
+        break;
+    case QSharedMemory::KeyError:
+        error = QIpcRingChannel::KeyError;
+        break;
+    case QSharedMemory::AlreadyExists:
+        error = QIpcRingChannel::AlreadyExists;
+        break;
+    case QSharedMemory::NotFound:
+        error = QIpcRingChannel::NotFound;
+        break;
+    default:
+        error = QIpcRingChannel::UnknownError;
+        break;
+    }
+    errorString = memory.errorString();
+}
+
+bool QIpcRingChannelPrivate::initializeAttachment(bool justCreated)
+{
+    SharedHeader *hdr = header();
+    if (justCreated) {
+        hdr->version = SharedVersion;
+        hdr->capacity = capacity;
+        hdr->reserved = 0;
+        hdr->head.storeRelaxed(0);
+        hdr->tail.storeRelaxed(0);
+        hdr->dataSeq.storeRelaxed(0);
+        hdr->spaceSeq.storeRelaxed(0);
+        // stored last, with release, so that an attaching peer that sees the
+        // magic also sees a fully initialized header
+        hdr->magic.storeRelease(SharedMagic);
+    } else {
+        // the creator may still be between create() and the header stores;
+        // give it a moment before declaring the segment incompatible
+        int retries = 100;
+        while (hdr->magic.loadAcquire() != SharedMagic && --retries) {
+#if QT_CONFIG(thread)
+            QThread::usleep(1000);
+#endif
+        }
+        if (hdr->magic.loadAcquire() != SharedMagic || hdr->version != SharedVersion
+                || qPopulationCount(hdr->capacity) != 1
+                || RingOffset + qsizetype(hdr->capacity) > memory.size()) {
+            setError(QIpcRingChannel::IncompatibleSegment,
+                     QIpcRingChannel::tr("%1: shared memory segment does not contain a "
+                                         "compatible ring channel")
+                             .arg("QIpcRingChannel::attach"_L1));
+            memory.detach();
+            return false;
+        }
+        capacity = hdr->capacity;
+    }
+    openDoorbell();
+    setError(QIpcRingChannel::NoError, QString());
+    return true;
+}
+
+void QIpcRingChannelPrivate::copyToRing(quint32 pos, const void *src, qsizetype n)
+{
+    const quint32 mask = capacity - 1;
+    const quint32 idx = pos & mask;
+    const qsizetype first = qMin(n, qsizetype(capacity - idx));
+    memcpy(ringData() + idx, src, size_t(first));
+    if (first != n)
+        memcpy(ringData(), static_cast<const uchar *>(src) + first, size_t(n - first));
+}
+
+void QIpcRingChannelPrivate::copyFromRing(void *dest, quint32 pos, qsizetype n)
+{
+    const quint32 mask = capacity - 1;
+    const quint32 idx = pos & mask;
+    const qsizetype first = qMin(n, qsizetype(capacity - idx));
+    memcpy(dest, ringData() + idx, size_t(first));
+    if (first != n)
+        memcpy(static_cast<uchar *>(dest) + first, ringData(), size_t(n - first));
+}
+
+bool QIpcRingChannelPrivate::hasMessage() const
+{
+    SharedHeader *hdr = header();
+    return hdr->tail.loadAcquire() - hdr->head.loadRelaxed() >= quint32(FrameHeaderSize);
+}
+
+bool QIpcRingChannelPrivate::hasRequestedSpace() const
+{
+    SharedHeader *hdr = header();
+    const quint32 used = hdr->tail.loadRelaxed() - hdr->head.loadAcquire();
+    return qsizetype(capacity - used) >= pendingSpaceRequest;
+}
+
+bool QIpcRingChannelPrivate::waitForCondition(QBasicAtomicInteger<quint32> &seq,
+                                              QDeadlineTimer deadline,
+                                              bool (QIpcRingChannelPrivate::*satisfied)() const)
+{
+    forever {
+        const quint32 current = seq.loadAcquire();
+        if ((this->*satisfied)())
+            return true;
+        if (deadline.hasExpired())
+            return false;
+#ifdef QIPCRINGCHANNEL_USE_FUTEX
+        if (!futexWaitShared(seq, current, deadline))
+            return (this->*satisfied)();
+#else
+        Q_UNUSED(current);
+        // no cross-process wait primitive on this platform: poll
+#  if QT_CONFIG(thread)
+        QThread::usleep(250);
+#  endif
+#endif
+    }
+}
+
+void QIpcRingChannelPrivate::notifyDataWritten()
+{
+    header()->dataSeq.fetchAndAddRelease(1);
+#ifdef QIPCRINGCHANNEL_USE_FUTEX
+    futexWakeShared(header()->dataSeq);
+#endif
+    ringDoorbell();
+}
+
+void QIpcRingChannelPrivate::notifyDataConsumed()
+{
+    header()->spaceSeq.fetchAndAddRelease(1);
+#ifdef QIPCRINGCHANNEL_USE_FUTEX
+    futexWakeShared(header()->spaceSeq);
+#endif
+}
+
+void QIpcRingChannelPrivate::openDoorbell()
+{
+#ifdef Q_OS_UNIX
+    const QByteArray path = QFile::encodeName(doorbellPathForKey(memory.nativeIpcKey()));
+    if (role == QIpcRingChannel::Role::Reader) {
+        if (::mkfifo(path.constData(), 0600) == -1 && errno != EEXIST)
+            return;     // no doorbell; waitForMessage() still works
+        doorbellFd = qt_safe_open(path.constData(), O_RDONLY | O_NONBLOCK);
+    } else {
+        // opening the write end fails with ENXIO until the reader has opened
+        // its end; ringDoorbell() retries lazily
+        doorbellFd = qt_safe_open(path.constData(), O_WRONLY | O_NONBLOCK);
+    }
+#endif
+}
+
+void QIpcRingChannelPrivate::closeDoorbell()
+{
+#ifdef Q_OS_UNIX
+    if (doorbellFd != -1) {
+        qt_safe_close(doorbellFd);
+        doorbellFd = -1;
+    }
+    if (role == QIpcRingChannel::Role::Reader && memory.isAttached())
+        ::unlink(QFile::encodeName(doorbellPathForKey(memory.nativeIpcKey())).constData());
+#endif
+}
+
+void QIpcRingChannelPrivate::ringDoorbell()
+{
+#ifdef Q_OS_UNIX
+    if (doorbellFd == -1) {
+        const QByteArray path = QFile::encodeName(doorbellPathForKey(memory.nativeIpcKey()));
+        doorbellFd = qt_safe_open(path.constData(), O_WRONLY | O_NONBLOCK);
+        if (doorbellFd == -1)
+            return;
+    }
+    char byte = 1;
+    // EAGAIN (pipe full) is fine: the reader has plenty of pending wakeups
+    qt_safe_write(doorbellFd, &byte, 1);
+#endif
+}
+
+void QIpcRingChannelPrivate::drainDoorbell()
+{
+#ifdef Q_OS_UNIX
+    if (role != QIpcRingChannel::Role::Reader || doorbellFd == -1)
+        return;
+    char buf[64];
+    while (qt_safe_read(doorbellFd, buf, sizeof(buf)) > 0)
+        ;
+#endif
+}
+
+/*!
+    \class QIpcRingChannel
+    \inmodule QtCore
+    \since 6.9
+    \brief The QIpcRingChannel class provides a single-writer, single-reader
+    message channel over shared memory.
+
+    \ingroup ipc
+    \ingroup shared
+
+    QIpcRingChannel layers a lock-free ring buffer with variable-length
+    message framing on top of a QSharedMemory segment, so two processes can
+    exchange messages without a system call per handoff. Exactly one process
+    may act as the \l{Role::Writer}{writer} and exactly one as the
+    \l{Role::Reader}{reader}; the roles synchronize through atomic positions
+    in the shared segment, not through locks.
+
+    One side — usually the writer — calls create() with the desired ring
+    capacity; the other side calls attach(). Messages are sent with send()
+    and retrieved with receive(); both are non-blocking and complete with a
+    pair of \c memcpy calls when the ring has room. When the ring is empty or
+    full, waitForMessage() and waitForSpace() block efficiently (on Linux via
+    a futex shared between the processes; elsewhere by polling).
+
+    On Unix systems, notificationDescriptor() returns a file descriptor that
+    becomes readable when the writer publishes a message, suitable for
+    monitoring with QSocketNotifier from an event loop. After the notifier
+    fires, call receive() until it returns an empty result.
+
+    \sa QSharedMemory, QSystemSemaphore
+*/
+
+/*!
+    \enum QIpcRingChannel::Role
+
+    This enum selects which end of the channel an instance operates.
+
+    \value Writer   This instance publishes messages with send().
+    \value Reader   This instance retrieves messages with receive().
+*/
+
+/*!
+    \enum QIpcRingChannel::RingChannelError
+
+    \value NoError              No error occurred.
+    \value PermissionDenied     The operation failed because the caller didn't have
+                                the required permissions.
+    \value InvalidSize          A create operation failed because the requested size
+                                was invalid.
+    \value KeyError             The operation failed because of an invalid key.
+    \value AlreadyExists        A create() operation failed because a segment with
+                                the specified key already existed.
+    \value NotFound             An attach() failed because the segment with the
+                                specified key could not be found.
+    \value NotAttached          The operation requires an attached channel.
+    \value IncompatibleSegment  The attached segment was not created by
+                                QIpcRingChannel or uses an incompatible layout.
+    \value MessageTooLarge      The message cannot ever fit in the ring.
+    \value CorruptData          The ring contents failed consistency checks.
+    \value UnknownError         Something else happened and it was bad.
+*/
+
+/*!
+    Constructs a ring channel object for the end given by \a role, with the
+    native IPC key \a key. The channel is not attached; call create() or
+    attach() before use.
+*/
+QIpcRingChannel::QIpcRingChannel(const QNativeIpcKey &key, Role role)
+    : d(new QIpcRingChannelPrivate(key, role))
+{
+}
+
+/*!
+    \overload
+
+    Constructs a ring channel object for the end given by \a role, using the
+    legacy key \a key of type \a type.
+*/
+QIpcRingChannel::QIpcRingChannel(const QString &key, Role role, QNativeIpcKey::Type type)
+    : QIpcRingChannel(QNativeIpcKey{ key, type }, role)
+{
+}
+
+/*!
+    Destroys the channel, detaching from the shared memory segment if it was
+    attached. The segment itself follows QSharedMemory ownership rules: on
+    Unix it is released when the last attached process detaches.
+*/
+QIpcRingChannel::~QIpcRingChannel()
+{
+    detach();
+}
+
+/*!
+    Returns the native IPC key of the underlying shared memory segment.
+*/
+QNativeIpcKey QIpcRingChannel::nativeIpcKey() const
+{
+    return d->memory.nativeIpcKey();
+}
+
+/*!
+    Returns the role this end of the channel was constructed with.
+*/
+QIpcRingChannel::Role QIpcRingChannel::role() const
+{
+    return d->role;
+}
+
+/*!
+    Creates the shared memory segment with room for at least \a capacity
+    bytes of ring space and attaches to it. The capacity is rounded up to the
+    next power of two. Returns \c true on success; otherwise sets error() and
+    returns \c false.
+
+    Either end may create the segment; the other end attaches with attach().
+
+    \sa attach(), capacity()
+*/
+bool QIpcRingChannel::create(qsizetype capacity)
+{
+    if (d->memory.isAttached()) {
+        d->setError(AlreadyExists, tr("%1: already attached").arg("QIpcRingChannel::create"_L1));
+        return false;
+    }
+    constexpr qsizetype MaxCapacity = qsizetype(1) << 30;
+    if (capacity <= QIpcRingChannelPrivate::FrameHeaderSize || capacity > MaxCapacity) {
+        d->setError(InvalidSize, tr("%1: invalid capacity").arg("QIpcRingChannel::create"_L1));
+        return false;
+    }
+    const quint64 rounded = qNextPowerOfTwo(quint64(capacity - 1));
+    if (!d->memory.create(QIpcRingChannelPrivate::RingOffset + qsizetype(rounded))) {
+        d->setErrorFromSharedMemory();
+        return false;
+    }
+    d->capacity = quint32(rounded);
+    return d->initializeAttachment(true);
+}
+
+/*!
+    Attaches to a shared memory segment previously set up by a call to
+    create() in this or another process. Returns \c true on success;
+    otherwise sets error() and returns \c false.
+
+    \sa create(), detach()
+*/
+bool QIpcRingChannel::attach()
+{
+    if (d->memory.isAttached()) {
+        d->setError(AlreadyExists, tr("%1: already attached").arg("QIpcRingChannel::attach"_L1));
+        return false;
+    }
+    if (!d->memory.attach(QSharedMemory::ReadWrite)) {
+        d->setErrorFromSharedMemory();
+        return false;
+    }
+    return d->initializeAttachment(false);
+}
+
+/*!
+    Returns \c true if this channel is attached to its shared memory segment.
+*/
+bool QIpcRingChannel::isAttached() const
+{
+    return d->memory.isAttached();
+}
+
+/*!
+    Detaches from the shared memory segment. Messages still in the ring
+    remain there for the reader.
+*/
+void QIpcRingChannel::detach()
+{
+    d->closeDoorbell();
+    if (d->memory.isAttached())
+        d->memory.detach();
+    d->capacity = 0;
+}
+
+/*!
+    Returns the ring capacity in bytes, or 0 if the channel is not attached.
+    Each message additionally consumes a fixed framing overhead of four
+    bytes.
+*/
+qsizetype QIpcRingChannel::capacity() const
+{
+    return qsizetype(d->capacity);
+}
+
+/*!
+    Returns the size of the largest message this channel can carry, or 0 if
+    the channel is not attached.
+*/
+qsizetype QIpcRingChannel::maximumMessageSize() const
+{
+    return d->capacity ? qsizetype(d->capacity) - QIpcRingChannelPrivate::FrameHeaderSize : 0;
+}
+
+/*!
+    Returns the number of bytes currently occupied in the ring, including
+    framing overhead, or 0 if the channel is not attached.
+*/
+qsizetype QIpcRingChannel::bytesAvailable() const
+{
+    if (!d->memory.isAttached())
+        return 0;
+    auto *hdr = d->header();
+    return qsizetype(hdr->tail.loadAcquire() - hdr->head.loadAcquire());
+}
+
+/*!
+    Returns the number of unoccupied bytes in the ring, or 0 if the channel
+    is not attached.
+*/
+qsizetype QIpcRingChannel::bytesFree() const
+{
+    return d->memory.isAttached() ? capacity() - bytesAvailable() : 0;
+}
+
+/*!
+    Appends \a message to the ring and wakes the reader. Returns \c true on
+    success. Returns \c false without blocking if the ring does not currently
+    have room for the message; in that case error() is NoError and the caller
+    may retry after waitForSpace(). Other failures set error().
+
+    May only be called on the \l{Role::Writer}{writer} end.
+
+    \sa receive(), waitForSpace()
+*/
+bool QIpcRingChannel::send(QByteArrayView message)
+{
+    if (!d->memory.isAttached()) {
+        d->setError(NotAttached, tr("%1: not attached").arg("QIpcRingChannel::send"_L1));
+        return false;
+    }
+    if (d->role != Role::Writer) {
+        d->setError(UnknownError,
+                    tr("%1: only the writer end may send").arg("QIpcRingChannel::send"_L1));
+        return false;
+    }
+    const qsizetype needed = QIpcRingChannelPrivate::FrameHeaderSize + message.size();
+    if (message.size() > maximumMessageSize()) {
+        d->setError(MessageTooLarge,
+                    tr("%1: message of %2 bytes exceeds the channel capacity")
+                            .arg("QIpcRingChannel::send"_L1).arg(message.size()));
+        return false;
+    }
+    d->setError(NoError, QString());
+
+    auto *hdr = d->header();
+    const quint32 tail = hdr->tail.loadRelaxed();    // we are the only writer
+    const quint32 used = tail - hdr->head.loadAcquire();
+    if (qsizetype(d->capacity - used) < needed)
+        return false;
+
+    const quint32 length = quint32(message.size());
+    d->copyToRing(tail, &length, QIpcRingChannelPrivate::FrameHeaderSize);
+    d->copyToRing(tail + quint32(QIpcRingChannelPrivate::FrameHeaderSize),
+                  message.data(), message.size());
+    hdr->tail.storeRelease(tail + quint32(needed));
+    d->notifyDataWritten();
+    return true;
+}
+
+/*!
+    Removes the oldest message from the ring and returns it, waking the
+    writer if it is blocked in waitForSpace(). Returns an empty QByteArray if
+    no message is available; in that case error() is NoError.
+
+    May only be called on the \l{Role::Reader}{reader} end.
+
+    \sa send(), waitForMessage()
+*/
+QByteArray QIpcRingChannel::receive()
+{
+    if (!d->memory.isAttached()) {
+        d->setError(NotAttached, tr("%1: not attached").arg("QIpcRingChannel::receive"_L1));
+        return QByteArray();
+    }
+    if (d->role != Role::Reader) {
+        d->setError(UnknownError,
+                    tr("%1: only the reader end may receive").arg("QIpcRingChannel::receive"_L1));
+        return QByteArray();
+    }
+    d->setError(NoError, QString());
+
+    auto *hdr = d->header();
+    const quint32 head = hdr->head.loadRelaxed();    // we are the only reader
+    const quint32 available = hdr->tail.loadAcquire() - head;
+    if (available < quint32(QIpcRingChannelPrivate::FrameHeaderSize)) {
+        d->drainDoorbell();
+        return QByteArray();
+    }
+
+    quint32 length;
+    d->copyFromRing(&length, head, QIpcRingChannelPrivate::FrameHeaderSize);
+    if (length > available - quint32(QIpcRingChannelPrivate::FrameHeaderSize)
+            || qsizetype(length) > maximumMessageSize()) {
+        d->setError(CorruptData,
+                    tr("%1: ring contains an invalid message length")
+                            .arg("QIpcRingChannel::receive"_L1));
+        return QByteArray();
+    }
+
+    QByteArray result(qsizetype(length), Qt::Uninitialized);
+    d->copyFromRing(result.data(), head + quint32(QIpcRingChannelPrivate::FrameHeaderSize),
+                    result.size());
+    hdr->head.storeRelease(head + quint32(QIpcRingChannelPrivate::FrameHeaderSize) + length);
+    d->notifyDataConsumed();
+    return result;
+}
+
+/*!
+    Blocks until at least one message is available in the ring or \a deadline
+    expires, and returns \c true if a message can be retrieved with
+    receive().
+
+    May only be called on the \l{Role::Reader}{reader} end.
+
+    \sa receive(), notificationDescriptor()
+*/
+bool QIpcRingChannel::waitForMessage(QDeadlineTimer deadline)
+{
+    if (!d->memory.isAttached()) {
+        d->setError(NotAttached,
+                    tr("%1: not attached").arg("QIpcRingChannel::waitForMessage"_L1));
+        return false;
+    }
+    d->setError(NoError, QString());
+    return d->waitForCondition(d->header()->dataSeq, deadline,
+                               &QIpcRingChannelPrivate::hasMessage);
+}
+
+/*!
+    Blocks until the ring has room for a message of \a bytes bytes or
+    \a deadline expires, and returns \c true if a send() of that size will
+    succeed (provided no other message is sent in between).
+
+    May only be called on the \l{Role::Writer}{writer} end.
+
+    \sa send()
+*/
+bool QIpcRingChannel::waitForSpace(qsizetype bytes, QDeadlineTimer deadline)
+{
+    if (!d->memory.isAttached()) {
+        d->setError(NotAttached,
+                    tr("%1: not attached").arg("QIpcRingChannel::waitForSpace"_L1));
+        return false;
+    }
+    if (bytes > maximumMessageSize()) {
+        d->setError(MessageTooLarge,
+                    tr("%1: message of %2 bytes exceeds the channel capacity")
+                            .arg("QIpcRingChannel::waitForSpace"_L1).arg(bytes));
+        return false;
+    }
+    d->setError(NoError, QString());
+    d->pendingSpaceRequest = QIpcRingChannelPrivate::FrameHeaderSize + bytes;
+    return d->waitForCondition(d->header()->spaceSeq, deadline,
+                               &QIpcRingChannelPrivate::hasRequestedSpace);
+}
+
+/*!
+    Returns a file descriptor that becomes readable when the writer publishes
+    a message, for monitoring with QSocketNotifier, or -1 if the platform
+    does not support one or the channel is not attached.
+
+    Only the \l{Role::Reader}{reader} end has a notification descriptor. The
+    descriptor is a wakeup signal, not the data channel: after it fires, call
+    receive() until it returns an empty result. receive() drains the pending
+    wakeups once the ring is empty.
+*/
+int QIpcRingChannel::notificationDescriptor() const
+{
+    return d->role == Role::Reader ? d->doorbellFd : -1;
+}
+
+/*!
+    Returns a value indicating whether an error occurred, and, if so, which
+    error it was.
+
+    \sa errorString()
+*/
+QIpcRingChannel::RingChannelError QIpcRingChannel::error() const
+{
+    return d->error;
+}
+
+/*!
+    Returns a text description of the last error that occurred.
+
+    \sa error()
+*/
+QString QIpcRingChannel::errorString() const
+{
+    return d->errorString;
+}
+
+/*!
+    Returns \c true if the underlying shared memory key type \a type is
+    supported on this platform.
+
+    \sa QSharedMemory::isKeyTypeSupported()
+*/
+bool QIpcRingChannel::isKeyTypeSupported(QNativeIpcKey::Type type)
+{
+    return QSharedMemory::isKeyTypeSupported(type);
+}
+
+/*!
+    Returns a key whose native key is valid for the underlying shared memory
+    segment, of type \a type, based on the cross-platform identifier \a key.
+
+    \sa QSharedMemory::platformSafeKey()
+*/
+QNativeIpcKey QIpcRingChannel::platformSafeKey(const QString &key, QNativeIpcKey::Type type)
+{
+    return QSharedMemory::platformSafeKey(key, type);
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_CONFIG(sharedmemory)
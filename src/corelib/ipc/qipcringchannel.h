@@ -0,0 +1,90 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIPCRINGCHANNEL_H
+#define QIPCRINGCHANNEL_H
+
+#include <QtCore/qtipccommon.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+#if QT_CONFIG(sharedmemory)
+
+class QIpcRingChannelPrivate;
+
+class Q_CORE_EXPORT QIpcRingChannel
+{
+    Q_GADGET
+    Q_DECLARE_TR_FUNCTIONS(QIpcRingChannel)
+public:
+    enum class Role
+    {
+        Writer,
+        Reader
+    };
+    Q_ENUM(Role)
+
+    enum RingChannelError
+    {
+        NoError,
+        PermissionDenied,
+        InvalidSize,
+        KeyError,
+        AlreadyExists,
+        NotFound,
+        NotAttached,
+        IncompatibleSegment,
+        MessageTooLarge,
+        CorruptData,
+        UnknownError
+    };
+    Q_ENUM(RingChannelError)
+
+    QIpcRingChannel(const QNativeIpcKey &key, Role role);
+    QIpcRingChannel(const QString &key, Role role,
+                    QNativeIpcKey::Type type = QNativeIpcKey::legacyDefaultTypeForOs());
+    ~QIpcRingChannel();
+
+    QNativeIpcKey nativeIpcKey() const;
+    Role role() const;
+
+    bool create(qsizetype capacity);
+    bool attach();
+    bool isAttached() const;
+    void detach();
+
+    qsizetype capacity() const;
+    qsizetype maximumMessageSize() const;
+    qsizetype bytesAvailable() const;
+    qsizetype bytesFree() const;
+
+    bool send(QByteArrayView message);
+    QByteArray receive();
+    bool waitForMessage(QDeadlineTimer deadline = QDeadlineTimer::Forever);
+    bool waitForSpace(qsizetype bytes, QDeadlineTimer deadline = QDeadlineTimer::Forever);
+
+    int notificationDescriptor() const;
+
+    RingChannelError error() const;
+    QString errorString() const;
+
+    static bool isKeyTypeSupported(QNativeIpcKey::Type type) Q_DECL_CONST_FUNCTION;
+    static QNativeIpcKey platformSafeKey(const QString &key,
+            QNativeIpcKey::Type type = QNativeIpcKey::DefaultTypeForOs);
+
+private:
+    Q_DISABLE_COPY(QIpcRingChannel)
+    QScopedPointer<QIpcRingChannelPrivate> d;
+};
+
+#endif // QT_CONFIG(sharedmemory)
+
+QT_END_NAMESPACE
+
+#endif // QIPCRINGCHANNEL_H
@@ -0,0 +1,91 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QIPCRINGCHANNEL_P_H
+#define QIPCRINGCHANNEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qipcringchannel.h"
+
+#include "qsharedmemory.h"
+#include <QtCore/qbasicatomic.h>
+
+#if QT_CONFIG(sharedmemory)
+
+QT_BEGIN_NAMESPACE
+
+class QIpcRingChannelPrivate
+{
+public:
+    // Lives at the start of the shared memory segment. Both sides access the
+    // atomics concurrently, so the layout must never change within a version.
+    struct SharedHeader
+    {
+        QBasicAtomicInteger<quint32> magic;     // stored last during creation
+        quint32 version;
+        quint32 capacity;                       // ring size in bytes, power of two
+        quint32 reserved;
+        QBasicAtomicInteger<quint32> head;      // consumer position, free-running
+        QBasicAtomicInteger<quint32> tail;      // producer position, free-running
+        QBasicAtomicInteger<quint32> dataSeq;   // bumped by the writer after publishing
+        QBasicAtomicInteger<quint32> spaceSeq;  // bumped by the reader after consuming
+    };
+    static constexpr quint32 SharedMagic = 0x51524331;  // "QRC1"
+    static constexpr quint32 SharedVersion = 1;
+    static constexpr qsizetype RingOffset = 64;         // keep the ring cache-line aligned
+    static constexpr qsizetype FrameHeaderSize = qsizetype(sizeof(quint32));
+
+    explicit QIpcRingChannelPrivate(const QNativeIpcKey &key, QIpcRingChannel::Role role);
+    ~QIpcRingChannelPrivate();
+
+    // the shared block stays writable even when reached from const methods
+    // (the atomics in the header must be modifiable); data() on a const
+    // QSharedMemory only hands out const void *, so cast the constness away
+    // deliberately
+    QSharedMemory &sharedMemory() const
+    { return const_cast<QIpcRingChannelPrivate *>(this)->memory; }
+    SharedHeader *header() const
+    { return static_cast<SharedHeader *>(sharedMemory().data()); }
+    uchar *ringData() const
+    { return static_cast<uchar *>(sharedMemory().data()) + RingOffset; }
+
+    bool initializeAttachment(bool justCreated);
+    void copyToRing(quint32 pos, const void *src, qsizetype n);
+    void copyFromRing(void *dest, quint32 pos, qsizetype n);
+    bool waitForCondition(QBasicAtomicInteger<quint32> &seq, QDeadlineTimer deadline,
+                          bool (QIpcRingChannelPrivate::*satisfied)() const);
+    bool hasMessage() const;
+    bool hasRequestedSpace() const;
+    void notifyDataWritten();
+    void notifyDataConsumed();
+    void openDoorbell();
+    void closeDoorbell();
+    void ringDoorbell();
+    void drainDoorbell();
+    void setError(QIpcRingChannel::RingChannelError e, const QString &message);
+    void setErrorFromSharedMemory();
+
+    QSharedMemory memory;
+    QString errorString;
+    QIpcRingChannel::Role role;
+    QIpcRingChannel::RingChannelError error = QIpcRingChannel::NoError;
+    quint32 capacity = 0;
+    qsizetype pendingSpaceRequest = 0;
+    int doorbellFd = -1;
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_CONFIG(sharedmemory)
+
+#endif // QIPCRINGCHANNEL_P_H
@@ -4,6 +4,7 @@
 
 #include "qabstractitemmodel.h"
 #include <private/qabstractitemmodel_p.h>
+#include <private/qlocking_p.h>
 #include <qdatastream.h>
 #include <qstringlist.h>
 #include <qsize.h>
@@ -15,10 +16,12 @@
 #endif
 #include <qstack.h>
 #include <qmap.h>
+#include <qvarlengtharray.h>
 #include <qbitarray.h>
 #include <qdatetime.h>
 #include <qloggingcategory.h>
 
+#include <cstddef>
 #include <functional>
 
 #include <limits.h>
@@ -29,6 +32,53 @@ Q_STATIC_LOGGING_CATEGORY(lcCheckIndex, "qt.core.qabstractitemmodel.checkindex")
 
 QT_IMPL_METATYPE_EXTERN(QModelIndexList)
 
+// QPersistentModelIndexData entries are allocated from contiguous slabs with
+// an intrusive free list of recycled slots, instead of one malloc per entry.
+// Views routinely hold tens of thousands of persistent indexes; slab storage
+// makes creating and releasing them cheap and keeps the entries the
+// persistent-index bookkeeping loops dereference close together in memory.
+// The slabs themselves are process-wide and are intentionally never returned
+// to the OS: persistent indexes may outlive any given model, and the pool's
+// high-water mark is bounded by the largest set of simultaneously live
+// entries.
+namespace {
+union PersistentIndexSlot
+{
+    PersistentIndexSlot *nextFree;
+    alignas(QPersistentModelIndexData) std::byte storage[sizeof(QPersistentModelIndexData)];
+};
+constexpr int PersistentIndexSlabSize = 256;    // entries per slab
+}
+Q_CONSTINIT static QBasicMutex persistentIndexPoolMutex;
+Q_CONSTINIT static PersistentIndexSlot *persistentIndexFreeList = nullptr;
+
+void *QPersistentModelIndexData::operator new(std::size_t size)
+{
+    Q_ASSERT(size == sizeof(QPersistentModelIndexData));
+    const auto locker = qt_scoped_lock(persistentIndexPoolMutex);
+    if (!persistentIndexFreeList) {
+        auto *slab = static_cast<PersistentIndexSlot *>(
+                ::operator new(PersistentIndexSlabSize * sizeof(PersistentIndexSlot)));
+        for (int i = 0; i < PersistentIndexSlabSize; ++i) {
+            slab[i].nextFree = persistentIndexFreeList;
+            persistentIndexFreeList = &slab[i];
+        }
+    }
+    PersistentIndexSlot *slot = persistentIndexFreeList;
+    persistentIndexFreeList = slot->nextFree;
+    return slot;
+}
+
+void QPersistentModelIndexData::operator delete(void *ptr, std::size_t size)
+{
+    Q_ASSERT(size == sizeof(QPersistentModelIndexData));
+    Q_UNUSED(size);
+    const auto locker = qt_scoped_lock(persistentIndexPoolMutex);
+    auto *slot = static_cast<PersistentIndexSlot *>(ptr);
+    slot->nextFree = persistentIndexFreeList;
+    persistentIndexFreeList = slot;
+}
+
 QPersistentModelIndexData *QPersistentModelIndexData::create(const QModelIndex &index)
 {
     Q_ASSERT(index.isValid()); // we will _never_ insert an invalid index in the list
@@ -1004,20 +1054,45 @@ void QAbstractItemModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
     QList<QPersistentModelIndexData *> persistent_invalidated;
     // find the persistent indexes that are affected by the change, either by being in the removed subtree
     // or by being on the same level and below the removed rows
-    for (auto *data : std::as_const(persistent.indexes)) {
-        bool level_changed = false;
-        QModelIndex current = data->index;
+
+    // Whether an ancestor lies in the removed subtree is the same question
+    // for every entry sharing that ancestor, so memoize the answers: one
+    // ancestor walk per distinct parent instead of one per persistent entry.
+    QHash<QModelIndex, bool> inRemovedSubtree;
+    auto ancestorIsRemoved = [&](QModelIndex current) {
+        QVarLengthArray<QModelIndex, 8> walked;
+        bool removed = false;
         while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.row() > last) // below the removed rows
-                    persistent_moved.append(data);
-                else if (current.row() <= last && current.row() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
+            const auto it = inRemovedSubtree.constFind(current);
+            if (it != inRemovedSubtree.cend()) {
+                removed = it.value();
+                break;
+            }
+            walked.append(current);
+            const QModelIndex currentParent = current.parent();
+            if (currentParent == parent) { // reached the level of the change
+                removed = current.row() <= last && current.row() >= first;
                 break;
             }
-            current = current_parent;
-            level_changed = true;
+            current = currentParent;
+        }
+        for (const QModelIndex &seen : walked)
+            inRemovedSubtree.insert(seen, removed);
+        return removed;
+    };
+
+    for (auto *data : std::as_const(persistent.indexes)) {
+        const QModelIndex &index = data->index;
+        if (!index.isValid())
+            continue;
+        const QModelIndex indexParent = index.parent();
+        if (indexParent == parent) { // on the same level as the change
+            if (index.row() > last) // below the removed rows
+                persistent_moved.append(data);
+            else if (index.row() >= first) // in the removed subtree
+                persistent_invalidated.append(data);
+        } else if (ancestorIsRemoved(indexParent)) { // deeper in the removed subtree
+            persistent_invalidated.append(data);
         }
     }
 
@@ -1089,20 +1164,44 @@ void QAbstractItemModelPrivate::columnsAboutToBeRemoved(const QModelIndex &paren
     QList<QPersistentModelIndexData *> persistent_invalidated;
     // find the persistent indexes that are affected by the change, either by being in the removed subtree
     // or by being on the same level and to the right of the removed columns
-    for (auto *data : std::as_const(persistent.indexes)) {
-        bool level_changed = false;
-        QModelIndex current = data->index;
+
+    // memoized as in rowsAboutToBeRemoved(): one ancestor walk per distinct
+    // parent instead of one per persistent entry
+    QHash<QModelIndex, bool> inRemovedSubtree;
+    auto ancestorIsRemoved = [&](QModelIndex current) {
+        QVarLengthArray<QModelIndex, 8> walked;
+        bool removed = false;
         while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.column() > last) // right of the removed columns
-                    persistent_moved.append(data);
-                else if (current.column() <= last && current.column() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
+            const auto it = inRemovedSubtree.constFind(current);
+            if (it != inRemovedSubtree.cend()) {
+                removed = it.value();
                 break;
             }
-            current = current_parent;
-            level_changed = true;
+            walked.append(current);
+            const QModelIndex currentParent = current.parent();
+            if (currentParent == parent) { // reached the level of the change
+                removed = current.column() <= last && current.column() >= first;
+                break;
+            }
+            current = currentParent;
+        }
+        for (const QModelIndex &seen : walked)
+            inRemovedSubtree.insert(seen, removed);
+        return removed;
+    };
+
+    for (auto *data : std::as_const(persistent.indexes)) {
+        const QModelIndex &index = data->index;
+        if (!index.isValid())
+            continue;
+        const QModelIndex indexParent = index.parent();
+        if (indexParent == parent) { // on the same level as the change
+            if (index.column() > last) // right of the removed columns
+                persistent_moved.append(data);
+            else if (index.column() >= first) // in the removed subtree
+                persistent_invalidated.append(data);
+        } else if (ancestorIsRemoved(indexParent)) { // deeper in the removed subtree
+            persistent_invalidated.append(data);
         }
     }
 
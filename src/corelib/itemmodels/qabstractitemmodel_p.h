@@ -35,6 +35,10 @@ public:
     QAtomicInt ref;
     static QPersistentModelIndexData *create(const QModelIndex &index);
     static void destroy(QPersistentModelIndexData *data);
+
+    // entries are allocated from contiguous slabs; see qabstractitemmodel.cpp
+    void *operator new(std::size_t size);
+    void operator delete(void *ptr, std::size_t size);
 };
 
 class Q_CORE_EXPORT QAbstractItemModelPrivate : public QObjectPrivate
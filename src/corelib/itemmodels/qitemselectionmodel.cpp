@@ -8,6 +8,7 @@
 #include <private/qabstractitemmodel_p.h>
 #include <private/qduplicatetracker_p.h>
 #include <private/qoffsetstringarray_p.h>
+#include <qvarlengtharray.h>
 #include <qdebug.h>
 
 #include <algorithm>
@@ -462,15 +463,23 @@ void QItemSelection::merge(const QItemSelection &other, QItemSelectionModel::Sel
 
     QItemSelection newSelection;
     newSelection.reserve(other.size());
-    // Collect intersections
+    // Collect intersections; the interval index makes each lookup
+    // O(log n + k) instead of a scan over all our ranges
     QItemSelection intersections;
+    QSelectionRangeIndex index;
+    index.build(*this);
+    QVarLengthArray<qsizetype> overlapping;
     for (const auto &range : other) {
         if (!range.isValid())
             continue;
         newSelection.push_back(range);
-        for (int t = 0; t < size(); ++t) {
-            if (range.intersects(at(t)))
-                intersections.append(at(t).intersected(range));
+        overlapping.clear();
+        index.findOverlaps(range.parent(), range.top(), range.bottom(),
+                           [&overlapping](qsizetype pos) { overlapping.append(pos); return false; });
+        std::sort(overlapping.begin(), overlapping.end());  // keep the historical order
+        for (qsizetype pos : overlapping) {
+            if (range.intersects(at(pos)))
+                intersections.append(at(pos).intersected(range));
         }
     }
 
@@ -670,6 +679,7 @@ void QItemSelectionModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
             emit q->currentColumnChanged(currentIndex, old);
     }
 
+    invalidateRangeIndex();
     QItemSelection deselected;
     QItemSelection newParts;
     bool indexesOfSelectionChanged = false;
@@ -786,6 +796,7 @@ void QItemSelectionModelPrivate::columnsAboutToBeInserted(const QModelIndex &par
         }
     }
     ranges += split;
+    invalidateRangeIndex();
 }
 
 /*!
@@ -822,6 +833,7 @@ void QItemSelectionModelPrivate::rowsAboutToBeInserted(const QModelIndex &parent
         }
     }
     ranges += split;
+    invalidateRangeIndex();
 
     if (indexesOfSelectionChanged)
         emit q->selectionChanged(QItemSelection(), QItemSelection());
@@ -1002,6 +1014,7 @@ static bool qt_PersistentModelIndexLessThan(const QPersistentModelIndex &i1, con
 */
 void QItemSelectionModelPrivate::layoutChanged(const QList<QPersistentModelIndex> &, QAbstractItemModel::LayoutChangeHint hint)
 {
+    invalidateRangeIndex();
     // special case for when all indexes are selected
     if (tableSelected && tableColCount == model->columnCount(tableParent)
         && tableRowCount == model->rowCount(tableParent)) {
@@ -1299,6 +1312,7 @@ void QItemSelectionModel::select(const QItemSelection &selection, QItemSelection
     // it might call select() on this selection model before any such QItemSelectionModelPrivate::modelReset() slot
     // is invoked, so it would not be cleared yet. We clear it invalid ranges in it here.
     d->ranges.removeIf(QtFunctionObjects::IsNotValid());
+    d->invalidateRangeIndex();      // also covers the Clear command below
 
     QItemSelection old = d->ranges;
     old.merge(d->currentSelection, d->currentCommand);
@@ -1429,15 +1443,10 @@ bool QItemSelectionModel::isSelected(const QModelIndex &index) const
     if (d->model != index.model() || !index.isValid())
         return false;
 
-    bool selected = false;
-    //  search model ranges
-    QList<QItemSelectionRange>::const_iterator it = d->ranges.begin();
-    for (; it != d->ranges.end(); ++it) {
-        if ((*it).isValid() && (*it).contains(index)) {
-            selected = true;
-            break;
-        }
-    }
+    //  search model ranges, via the interval index over them
+    bool selected = d->indexedRanges().findOverlaps(
+            index.parent(), index.row(), index.row(),
+            [d, &index](qsizetype pos) { return d->ranges.at(pos).contains(index); });
 
     // check  currentSelection
     if (d->currentSelection.size()) {
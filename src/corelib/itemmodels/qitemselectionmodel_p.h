@@ -18,18 +18,74 @@
 #include "qitemselectionmodel.h"
 #include "private/qobject_p.h"
 #include "private/qproperty_p.h"
+#include <algorithm>
 #include <array>
+#include <climits>
 
 QT_REQUIRE_CONFIG(itemmodel);
 
 QT_BEGIN_NAMESPACE
 
+// A flattened interval tree over a list of selection ranges: entries are
+// grouped by parent and sorted by top row, each carrying the running maximum
+// of the bottom rows seen so far. A row-overlap query is then a binary search
+// plus a bounded walk to the left — O(log n + k) for k candidate ranges —
+// instead of a scan of the whole list.
+class QSelectionRangeIndex
+{
+public:
+    void build(const QList<QItemSelectionRange> &ranges)
+    {
+        byParent.clear();
+        for (qsizetype i = 0; i < ranges.size(); ++i) {
+            const QItemSelectionRange &range = ranges.at(i);
+            if (range.isValid())
+                byParent[range.parent()].append({ range.top(), range.bottom(), 0, i });
+        }
+        for (auto &entries : byParent) {
+            std::sort(entries.begin(), entries.end(),
+                      [](const Entry &lhs, const Entry &rhs) { return lhs.top < rhs.top; });
+            int runningMax = INT_MIN;
+            for (Entry &e : entries) {
+                runningMax = qMax(runningMax, e.bottom);
+                e.maxBottom = runningMax;
+            }
+        }
+    }
+
+    // Calls f(pos) for each range whose rows overlap [top, bottom] under the
+    // given parent, in unspecified order, where pos is the range's position in
+    // the list build() was given. Stops, returning true, as soon as f does.
+    template <typename F>
+    bool findOverlaps(const QModelIndex &parent, int top, int bottom, F f) const
+    {
+        const auto it = byParent.constFind(parent);
+        if (it == byParent.cend())
+            return false;
+        const QList<Entry> &entries = *it;
+        auto entry = std::upper_bound(entries.begin(), entries.end(), bottom,
+                                      [](int b, const Entry &e) { return b < e.top; });
+        while (entry != entries.begin()) {
+            --entry;
+            if (entry->maxBottom < top)
+                break;      // nothing further left reaches down to [top, bottom]
+            if (entry->bottom >= top && f(entry->pos))
+                return true;
+        }
+        return false;
+    }
+
+private:
+    struct Entry { int top; int bottom; int maxBottom; qsizetype pos; };
+    QHash<QModelIndex, QList<Entry>> byParent;
+};
+
 class QItemSelectionModelPrivate: public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QItemSelectionModel)
 public:
     QItemSelectionModelPrivate()
-      : currentCommand(QItemSelectionModel::NoUpdate),
+      : rangeIndexDirty(true), currentCommand(QItemSelectionModel::NoUpdate),
         tableSelected(false), tableColCount(0), tableRowCount(0) {}
 
     QItemSelection expandSelection(const QItemSelection &selection,
@@ -60,15 +116,28 @@ public:
         QList<QItemSelectionRange>::const_iterator it = r.constBegin();
         for (; it != r.constEnd(); ++it)
             ranges.removeAll(*it);
+        invalidateRangeIndex();
     }
 
     inline void finalize()
     {
         ranges.merge(currentSelection, currentCommand);
+        invalidateRangeIndex();
         if (!currentSelection.isEmpty())  // ### perhaps this should be in QList
             currentSelection.clear();
     }
 
+    void invalidateRangeIndex() { rangeIndexDirty = true; }
+
+    const QSelectionRangeIndex &indexedRanges() const
+    {
+        if (rangeIndexDirty) {
+            rangeIndex.build(ranges);
+            rangeIndexDirty = false;
+        }
+        return rangeIndex;
+    }
+
     void setModel(QAbstractItemModel *mod) { q_func()->setModel(mod); }
     void disconnectModel();
     void modelChanged(QAbstractItemModel *mod) { emit q_func()->modelChanged(mod); }
@@ -77,6 +146,8 @@ public:
                                        &QItemSelectionModelPrivate::modelChanged, nullptr)
 
     QItemSelection ranges;
+    mutable QSelectionRangeIndex rangeIndex;    // over `ranges`, rebuilt on demand
+    mutable bool rangeIndexDirty;
     QItemSelection currentSelection;
     QPersistentModelIndex currentIndex;
     QItemSelectionModel::SelectionFlags currentCommand;
@@ -369,6 +369,7 @@ public:
     QSet<int> handle_filter_changed(
         QList<int> &source_to_proxy, QList<int> &proxy_to_source,
         const QModelIndex &source_parent, Qt::Orientation orient);
+    void rows_filter_changed(const QModelIndexList &source_indexes);
 
     void updateChildrenMapping(const QModelIndex &source_parent, Mapping *parent_mapping,
                                Qt::Orientation orient, int start, int end, int delta_item_count, bool remove);
@@ -1363,6 +1364,78 @@ QSet<int> QSortFilterProxyModelPrivate::handle_filter_changed(
     return qListToSet(source_items_remove);
 }
 
+/*!
+  \internal
+
+  Re-evaluates the filter only for the rows of the given \a source_indexes,
+  updating the mapping of each affected parent. Unlike filter_changed(), the
+  cost is proportional to the number of indexes passed, not to the number of
+  rows in the source model.
+*/
+void QSortFilterProxyModelPrivate::rows_filter_changed(const QModelIndexList &source_indexes)
+{
+    QHash<QModelIndex, QList<int>> rows_by_parent;
+    for (const QModelIndex &source_index : source_indexes) {
+        if (source_index.isValid())
+            rows_by_parent[source_index.parent()].append(source_index.row());
+    }
+
+    for (auto it = rows_by_parent.cbegin(); it != rows_by_parent.cend(); ++it) {
+        const QModelIndex &source_parent = it.key();
+        IndexMap::const_iterator mit = source_index_mapping.constFind(source_parent);
+        if (mit == source_index_mapping.constEnd())
+            continue; // no mapping, the filter is applied when the mapping is created
+        Mapping *m = mit.value();
+
+        QList<int> source_rows = it.value();
+        std::sort(source_rows.begin(), source_rows.end());
+
+        // Figure out which of the given rows to remove and which to insert
+        QList<int> source_rows_remove;
+        QList<int> source_rows_insert;
+        int previous_source_row = -1;
+        for (int source_row : std::as_const(source_rows)) {
+            if (source_row == previous_source_row)
+                continue; // skip duplicates
+            previous_source_row = source_row;
+            if (source_row < 0 || source_row >= m->proxy_rows.size())
+                continue;
+            if (m->proxy_rows.at(source_row) != -1) {
+                if (!filterAcceptsRowInternal(source_row, source_parent)) {
+                    // This source row no longer satisfies the filter, so it must be removed
+                    source_rows_remove.append(source_row);
+                }
+            } else {
+                if (filterAcceptsRowInternal(source_row, source_parent)) {
+                    // This source row now satisfies the filter, so it must be added
+                    source_rows_insert.append(source_row);
+                }
+            }
+        }
+
+        if (!source_rows_remove.isEmpty()) {
+            remove_source_items(m->proxy_rows, m->source_rows,
+                                source_rows_remove, source_parent, Qt::Vertical);
+            const QSet<int> source_rows_remove_set = qListToSet(source_rows_remove);
+            QList<QModelIndex>::iterator childIt = m->mapped_children.end();
+            while (childIt != m->mapped_children.begin()) {
+                --childIt;
+                const QModelIndex source_child_index = *childIt;
+                if (source_rows_remove_set.contains(source_child_index.row())) {
+                    childIt = m->mapped_children.erase(childIt);
+                    remove_from_mapping(source_child_index);
+                }
+            }
+        }
+
+        if (!source_rows_insert.isEmpty()) {
+            sort_source_rows(source_rows_insert, source_parent);
+            insert_source_items(m->proxy_rows, m->source_rows,
+                                source_rows_insert, source_parent, Qt::Vertical);
+        }
+    }
+}
+
 bool QSortFilterProxyModelPrivate::needsReorder(const QList<int> &source_rows, const QModelIndex &source_parent) const
 {
     Q_Q(const QSortFilterProxyModel);
@@ -3141,6 +3214,34 @@ void QSortFilterProxyModel::invalidateRowsFilter()
     d->filter_changed(QSortFilterProxyModelPrivate::Direction::Rows);
 }
 
+/*!
+   \since 6.9
+
+   Invalidates the current filtering for the rows of the given
+   \a sourceIndexes only.
+
+   This function should be called if you are implementing custom filtering
+   (by filterAcceptsRow()), your filter parameters have changed, and you know
+   which source rows may be affected. Unlike invalidateRowsFilter(), which
+   re-evaluates the filter for every row of the source model, only the given
+   rows are re-evaluated, so the cost is proportional to the number of
+   indexes passed. Rows not listed in \a sourceIndexes keep their current
+   accepted state, even if the filter would now decide differently.
+
+   \note When filtering \l{recursiveFilteringEnabled}{recursively}, changing the
+   accepted state of a row can also change the state of its ancestors and
+   descendants. It is the caller's responsibility to include all rows whose
+   state may have changed.
+
+   \sa invalidateRowsFilter()
+   \sa invalidateFilter()
+*/
+void QSortFilterProxyModel::invalidateRowsFilter(const QModelIndexList &sourceIndexes)
+{
+    Q_D(QSortFilterProxyModel);
+    d->rows_filter_changed(sourceIndexes);
+}
+
 /*!
     Returns \c true if the value of the item referred to by the given
     index \a source_left is less than the value of the item referred to by
@@ -115,6 +115,7 @@ protected:
 
     void invalidateFilter();
     void invalidateRowsFilter();
+    void invalidateRowsFilter(const QModelIndexList &sourceIndexes);
     void invalidateColumnsFilter();
 
 public:
@@ -444,6 +444,8 @@ void QChronoTimer::singleShotImpl(std::chrono::nanoseconds interval, Qt::TimerTy
         return;
     }
 
+    if (QPooledSingleShotTimer::schedule(interval, timerType, receiver, slotObj))
+        return;
     new QSingleShotTimer(interval, timerType, receiver, slotObj);
 }
 
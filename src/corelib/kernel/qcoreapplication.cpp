@@ -103,6 +103,8 @@
 #include <private/qtrace_p.h>
 #else
 #include <qtcore_tracepoints_p.h>
+#include <QtCore/qtracecounter.h>
+#include <QtCore/private/qstartupprofiler_p.h>
 #endif
 
 #include <algorithm>
@@ -130,6 +132,19 @@ Q_TRACE_POINT(qtcore, QCoreApplication_sendSpontaneousEvent, QObject *receiver,
 Q_TRACE_POINT(qtcore, QCoreApplication_notify_entry, QObject *receiver, QEvent *event, QEvent::Type type);
 Q_TRACE_POINT(qtcore, QCoreApplication_notify_exit, bool consumed, bool filtered);
 
+#ifndef QT_BOOTSTRAPPED
+// Tracks the number of events currently sitting in the per-thread posted
+// event lists; every site that adjusts QObjectPrivate::postedEvents adjusts
+// this counter by the same amount.
+static QTraceCounter qtEventQueueDepthCounter("qcoreapplication.eventqueue.depth");
+static inline void adjustEventQueueDepthCounter(qint64 delta) noexcept
+{
+    qtEventQueueDepthCounter.increment(delta);
+}
+#else
+static inline void adjustEventQueueDepthCounter(qint64) noexcept {}
+#endif
+
 #if defined(Q_OS_WIN) || defined(Q_OS_DARWIN)
 extern QString qAppFileName();
 #endif
@@ -500,6 +515,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
         for (const QPostEvent &pe : std::as_const(thisThreadData->postEventList)) {
             if (pe.event) {
                 --pe.receiver->d_func()->postedEvents;
+                adjustEventQueueDepthCounter(-1);
                 pe.event->m_posted = false;
                 delete pe.event;
             }
@@ -832,6 +848,9 @@ QCoreApplication::QCoreApplication(int &argc, char **argv
 void Q_TRACE_INSTRUMENT(qtcore) QCoreApplicationPrivate::init()
 {
     Q_TRACE_SCOPE(QCoreApplicationPrivate_init);
+#ifndef QT_BOOTSTRAPPED
+    QStartupPhase startupPhase("QCoreApplicationPrivate::init");
+#endif
 
 #if defined(Q_OS_MACOS)
     QMacAutoReleasePool pool;
@@ -941,6 +960,11 @@ void Q_TRACE_INSTRUMENT(qtcore) QCoreApplicationPrivate::init()
 */
 QCoreApplication::~QCoreApplication()
 {
+    // for programs that never reach exec()
+#ifndef QT_BOOTSTRAPPED
+    QStartupProfiler::dump();
+#endif
+
     preRoutinesCalled = false;
 
     qt_call_post_routines();
@@ -1490,6 +1514,11 @@ int QCoreApplication::exec()
         return -1;
     }
 
+    // startup is over once the event loop runs
+#ifndef QT_BOOTSTRAPPED
+    QStartupProfiler::dump();
+#endif
+
     threadData->quitNow = false;
     QEventLoop eventLoop;
     self->d_func()->in_exec = true;
@@ -1706,6 +1735,7 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
     Q_UNUSED(eventDeleter.release());
     event->m_posted = true;
     ++receiver->d_func()->postedEvents;
+    adjustEventQueueDepthCounter(1);
     data->canWait = false;
     locker.unlock();
 
@@ -1731,7 +1761,9 @@ bool QCoreApplication::compressEvent(QEvent *event, QObject *receiver, QPostEven
         auto it = postedEvents->cbegin();
         const auto end = postedEvents->cend();
         while (it != end) {
-            if (it->event && it->event->type() == QEvent::Timer && it->receiver == receiver) {
+            // match the receiver first: it rejects foreign entries without
+            // dereferencing their event
+            if (it->receiver == receiver && it->event && it->event->type() == QEvent::Timer) {
                 if (static_cast<QTimerEvent *>(it->event)->timerId() == timerId) {
                     delete event;
                     return true;
@@ -1746,7 +1778,7 @@ bool QCoreApplication::compressEvent(QEvent *event, QObject *receiver, QPostEven
         for (const QPostEvent &cur : std::as_const(*postedEvents)) {
             if (cur.receiver != receiver
                     || cur.event == nullptr
-                    || cur.event->type() != event->type())
+                    || cur.event->type() != QEvent::Quit)
                 continue;
             // found an event for this receiver
             delete event;
@@ -1937,6 +1969,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
         QObject * r = pe.receiver;
 
         --r->d_func()->postedEvents;
+        adjustEventQueueDepthCounter(-1);
         Q_ASSERT(r->d_func()->postedEvents >= 0);
 
         // next, update the data structure so that we're ready
@@ -2002,6 +2035,7 @@ void QCoreApplication::removePostedEvents(QObject *receiver, int eventType)
         if ((!receiver || pe.receiver == receiver)
             && (pe.event && (eventType == 0 || pe.event->type() == eventType))) {
             --pe.receiver->d_func()->postedEvents;
+            adjustEventQueueDepthCounter(-1);
             pe.event->m_posted = false;
             events.append(pe.event);
             const_cast<QPostEvent &>(pe).event = nullptr;
@@ -2063,6 +2097,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
                      pe.receiver->objectName().toLocal8Bit().data());
 #endif
             --pe.receiver->d_func()->postedEvents;
+            adjustEventQueueDepthCounter(-1);
             pe.event->m_posted = false;
             delete pe.event;
             const_cast<QPostEvent &>(pe).event = nullptr;
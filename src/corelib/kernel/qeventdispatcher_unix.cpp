@@ -13,11 +13,14 @@
 #include <private/qthread_p.h>
 #include <private/qcoreapplication_p.h>
 #include <private/qcore_unix_p.h>
+#include <qtcore_tracepoints_p.h>
 
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
 #if __has_include(<sys/eventfd.h>)
 #  include <sys/eventfd.h>
 static constexpr bool UsingEventfd = true;
@@ -34,6 +37,11 @@ using namespace std::chrono_literals;
 
 QT_BEGIN_NAMESPACE
 
+Q_TRACE_POINT(qtcore, QEventDispatcherUNIX_wait_entry);
+Q_TRACE_POINT(qtcore, QEventDispatcherUNIX_wait_exit, int pollResult);
+Q_TRACE_POINT(qtcore, QEventDispatcherUNIX_dispatch_entry);
+Q_TRACE_POINT(qtcore, QEventDispatcherUNIX_dispatch_exit, int nevents);
+
 static const char *socketType(QSocketNotifier::Type type)
 {
     switch (type) {
@@ -182,11 +190,17 @@ QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
     timerList.clearTimers();
 }
 
-void QEventDispatcherUNIXPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
+void QEventDispatcherUNIXPrivate::setSocketNotifierPending(QSocketNotifier *notifier,
+                                                           qsizetype alreadyPending)
 {
     Q_ASSERT(notifier);
 
-    if (pendingNotifiers.contains(notifier))
+    // Within one marking pass a notifier can occur at most once, so only the
+    // first \a alreadyPending entries (leftovers from a nested event loop)
+    // need to be searched for duplicates. This keeps marking linear when many
+    // descriptors become ready at once.
+    const auto end = pendingNotifiers.cbegin() + alreadyPending;
+    if (std::find(pendingNotifiers.cbegin(), end, notifier) != end)
         return;
 
     pendingNotifiers << notifier;
@@ -199,6 +213,7 @@ int QEventDispatcherUNIXPrivate::activateTimers()
 
 void QEventDispatcherUNIXPrivate::markPendingSocketNotifiers()
 {
+    const qsizetype alreadyPending = pendingNotifiers.size();
     for (const pollfd &pfd : std::as_const(pollfds)) {
         if (pfd.fd < 0 || pfd.revents == 0)
             continue;
@@ -230,7 +245,7 @@ void QEventDispatcherUNIXPrivate::markPendingSocketNotifiers()
             }
 
             if (pfd.revents & n.flags)
-                setSocketNotifierPending(notifier);
+                setSocketNotifierPending(notifier, alreadyPending);
         }
     }
 
@@ -454,7 +469,11 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
     d->pollfds.append(d->threadPipe.prepare());
 
     int nevents = 0;
-    switch (qt_safe_poll(d->pollfds.data(), d->pollfds.size(), deadline)) {
+    Q_TRACE(QEventDispatcherUNIX_wait_entry);
+    const int pollResult = qt_safe_poll(d->pollfds.data(), d->pollfds.size(), deadline);
+    Q_TRACE(QEventDispatcherUNIX_wait_exit, pollResult);
+    Q_TRACE(QEventDispatcherUNIX_dispatch_entry);
+    switch (pollResult) {
     case -1:
         qErrnoWarning("qt_safe_poll");
         if (QT_CONFIG(poll_exit_on_error))
@@ -472,6 +491,8 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
     if (include_timers)
         nevents += d->activateTimers();
 
+    Q_TRACE(QEventDispatcherUNIX_dispatch_exit, nevents);
+
     // return true if we handled events, false otherwise
     return (nevents > 0);
 }
@@ -101,7 +101,7 @@ public:
 
     void markPendingSocketNotifiers();
     int activateSocketNotifiers();
-    void setSocketNotifierPending(QSocketNotifier *notifier);
+    void setSocketNotifierPending(QSocketNotifier *notifier, qsizetype alreadyPending);
 
     QThreadPipe threadPipe;
     QList<pollfd> pollfds;
@@ -8,6 +8,7 @@
 #include "qobjectdefs.h"
 #include "qdatetime.h"
 #include "qbytearray.h"
+#include "qmutex.h"
 #include "qreadwritelock.h"
 #include "qhash.h"
 #include "qmap.h"
@@ -56,6 +57,8 @@
 # include "qline.h"
 #endif
 
+#include <algorithm>
+#include <array>
 #include <new>
 #include <cstring>
 
@@ -1676,46 +1679,69 @@ static const QMetaTypeModuleHelper *qModuleHelperForType(int type)
 template<typename T, typename Key>
 class QMetaTypeFunctionRegistry
 {
+    /*
+        Lookups vastly outnumber registrations (which typically all happen at
+        startup), so reads are lock-free: the table is an immutable snapshot
+        reached through an atomic pointer. Writers serialize on a mutex, copy
+        the current snapshot, apply the change and publish the copy. Retired
+        snapshots are kept until destruction because a reader may still hold a
+        pointer into one; they are few (one per registration call) and small.
+    */
+    using Map = QHash<Key, T>;
 public:
+    QMetaTypeFunctionRegistry() : snapshot(new Map) {}
+
     ~QMetaTypeFunctionRegistry()
     {
-        const QWriteLocker locker(&lock);
-        map.clear();
+        const QMutexLocker locker(&writeLock);
+        delete snapshot.fetchAndStoreOrdered(nullptr);
+        qDeleteAll(retired);
     }
 
     bool contains(Key k) const
     {
-        const QReadLocker locker(&lock);
-        return map.contains(k);
+        const Map *map = snapshot.loadAcquire();
+        return map && map->contains(k);
     }
 
     bool insertIfNotContains(Key k, const T &f)
     {
-        const QWriteLocker locker(&lock);
-        const qsizetype oldSize = map.size();
-        auto &e = map[k];
-        if (map.size() == oldSize) // already present
+        const QMutexLocker locker(&writeLock);
+        const Map *current = snapshot.loadRelaxed();
+        if (current->contains(k))
             return false;
-        e = f;
+        auto *next = new Map(*current);
+        next->insert(k, f);
+        retired.append(current);
+        snapshot.storeRelease(next);
         return true;
     }
 
     const T *function(Key k) const
     {
-        const QReadLocker locker(&lock);
-        auto it = map.find(k);
-        return it == map.end() ? nullptr : std::addressof(*it);
+        const Map *map = snapshot.loadAcquire();
+        if (!map)
+            return nullptr;
+        auto it = map->find(k);
+        return it == map->end() ? nullptr : std::addressof(*it);
     }
 
     void remove(int from, int to)
     {
         const Key k(from, to);
-        const QWriteLocker locker(&lock);
-        map.remove(k);
+        const QMutexLocker locker(&writeLock);
+        const Map *current = snapshot.loadRelaxed();
+        if (!current->contains(k))
+            return;
+        auto *next = new Map(*current);
+        next->remove(k);
+        retired.append(current);
+        snapshot.storeRelease(next);
     }
 private:
-    mutable QReadWriteLock lock;
-    QHash<Key, T> map;
+    mutable QMutex writeLock;
+    QAtomicPointer<const Map> snapshot;
+    QList<const Map *> retired;
 };
 
 using QMetaTypeConverterRegistry
@@ -2750,15 +2776,41 @@ bool QtPrivate::hasRegisteredMutableViewFunctionToIterableMetaAssociation(QMetaT
 
 /*
     Similar to QMetaType::type(), but only looks in the static set of types.
+
+    The lookup goes through an index of the types[] table sorted by name
+    length first and name second, so a miss costs a handful of length
+    comparisons instead of a memcmp against every entry. The index is built
+    on first use (thread-safe, function-local static).
 */
-static inline int qMetaTypeStaticType(const char *typeName, int length)
+static int qMetaTypeStaticType(const char *typeName, int length)
 {
-    int i = 0;
-    while (types[i].typeName && ((length != types[i].typeNameLength)
-                                 || memcmp(typeName, types[i].typeName, length))) {
-        ++i;
+    constexpr int StaticTypeCount = int(std::size(types)) - 1;   // without the terminating entry
+    static_assert(StaticTypeCount <= 0xffff);   // the index stores quint16 positions
+    const auto lessThan = [](quint16 entry, const char *name, int len) {
+        if (types[entry].typeNameLength != len)
+            return types[entry].typeNameLength < len;
+        return memcmp(types[entry].typeName, name, size_t(len)) < 0;
+    };
+
+    static const auto sortedTypes = [&lessThan] {
+        std::array<quint16, StaticTypeCount> result;
+        for (int i = 0; i < StaticTypeCount; ++i)
+            result[i] = quint16(i);
+        std::sort(result.begin(), result.end(), [&lessThan](quint16 lhs, quint16 rhs) {
+            return lessThan(lhs, types[rhs].typeName, types[rhs].typeNameLength);
+        });
+        return result;
+    }();
+
+    const auto it = std::lower_bound(sortedTypes.begin(), sortedTypes.end(), 0,
+                                     [&lessThan, typeName, length](quint16 entry, int) {
+                                         return lessThan(entry, typeName, length);
+                                     });
+    if (it != sortedTypes.end() && types[*it].typeNameLength == length
+        && memcmp(types[*it].typeName, typeName, size_t(length)) == 0) {
+        return types[*it].type;
     }
-    return types[i].type;
+    return QMetaType::UnknownType;
 }
 
 /*
@@ -29,9 +29,11 @@
 #include <qsemaphore.h>
 #endif
 
+#include <private/qfreelist_p.h>
 #include <private/qorderedmutexlocker_p.h>
 #include <private/qhooks_p.h>
 #include <qtcore_tracepoints_p.h>
+#include <QtCore/qtracecounter.h>
 
 #include <new>
 #include <mutex>
@@ -53,6 +55,8 @@ Q_TRACE_POINT(qtcore, QMetaObject_activate_slot_functor_exit);
 Q_TRACE_POINT(qtcore, QMetaObject_activate_declarative_signal_entry, QObject *sender, int signalIndex);
 Q_TRACE_POINT(qtcore, QMetaObject_activate_declarative_signal_exit);
 
+static QTraceCounter qtSignalsEmittedCounter("qobject.signals.emitted");
+
 static int DIRECT_CONNECTION_ONLY = 0;
 
 Q_STATIC_LOGGING_CATEGORY(lcConnectSlotsByName, "qt.core.qmetaobject.connectslotsbyname")
@@ -179,6 +183,7 @@ QObjectPrivate::QObjectPrivate(int version)
     willBeWidget = false;
     wasWidget = false;
     receiveParentEvents = false;                // If object wants ParentAboutToChange and ParentChange
+    fixedThreadAffinity = false;                // see QObjectPrivate::setFixedThreadAffinity()
 }
 
 QObjectPrivate::~QObjectPrivate()
@@ -480,6 +485,90 @@ QAbstractMetaCallEvent::~QAbstractMetaCallEvent()
 #endif
 }
 
+namespace {
+
+/*
+    Pool for queued connection events.
+
+    Queued signal emission used to heap-allocate every QMetaCallEvent; in
+    inter-thread pipelines that queue signals at high rates, the allocator
+    showed up prominently in profiles. Events are recycled through a bounded
+    lock-free free list instead; allocations beyond the pool's capacity (or of
+    derived classes, which have a different size) fall back to operator new.
+
+    Every allocation is prefixed with a small header recording how to free it,
+    because allocation happens on the emitting thread and deallocation on the
+    receiving thread.
+*/
+struct MetaCallEventPoolConstants
+{
+    enum {
+        InitialNextValue = 0,
+        IndexMask = 0x00ffffff,
+        SerialMask = ~IndexMask & ~0x80000000,
+        SerialCounter = IndexMask + 1,
+        MaxIndex = IndexMask,
+        BlockCount = 2,
+        Capacity = 256 + 768
+    };
+    static const int Sizes[BlockCount];
+};
+const int MetaCallEventPoolConstants::Sizes[MetaCallEventPoolConstants::BlockCount] = { 256, 768 };
+
+struct MetaCallEventPoolElement
+{
+    static constexpr int HeapAllocated = -1;
+    int poolId;
+    alignas(std::max_align_t) unsigned char storage[sizeof(QMetaCallEvent)];
+};
+
+using QMetaCallEventPool = QFreeList<MetaCallEventPoolElement, MetaCallEventPoolConstants>;
+
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QMetaCallEventPool, metaCallEventPool)
+// number of pool entries currently handed out; gates pool exhaustion
+Q_CONSTINIT static QBasicAtomicInt metaCallEventsOutstanding = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+/*!
+    \internal
+ */
+void *QMetaCallEvent::operator new(std::size_t size)
+{
+    if (size == sizeof(QMetaCallEvent) && !metaCallEventPool.isDestroyed()) {
+        if (metaCallEventsOutstanding.fetchAndAddAcquire(1) < MetaCallEventPoolConstants::Capacity) {
+            const int id = metaCallEventPool->next();
+            MetaCallEventPoolElement &element = (*metaCallEventPool)[id];
+            element.poolId = id;
+            return element.storage;
+        }
+        metaCallEventsOutstanding.fetchAndSubRelaxed(1);
+    }
+    auto *element = static_cast<MetaCallEventPoolElement *>(
+            ::operator new(offsetof(MetaCallEventPoolElement, storage) + size));
+    element->poolId = MetaCallEventPoolElement::HeapAllocated;
+    return element->storage;
+}
+
+/*!
+    \internal
+ */
+void QMetaCallEvent::operator delete(void *ptr)
+{
+    if (!ptr)
+        return;
+    auto *element = reinterpret_cast<MetaCallEventPoolElement *>(
+            static_cast<char *>(ptr) - offsetof(MetaCallEventPoolElement, storage));
+    if (element->poolId == MetaCallEventPoolElement::HeapAllocated) {
+        ::operator delete(element);
+        return;
+    }
+    if (metaCallEventPool.isDestroyed())
+        return;     // the pool, and with it this entry's memory, is already gone
+    metaCallEventPool->release(element->poolId);
+    metaCallEventsOutstanding.fetchAndSubRelease(1);
+}
+
 /*!
     \internal
  */
@@ -603,14 +692,40 @@ QMetaCallEvent::~QMetaCallEvent()
     if (d.nargs_) {
         QMetaType *t = types();
         for (int i = 0; i < d.nargs_; ++i) {
-            if (t[i].isValid() && d.args_[i])
-                t[i].destroy(d.args_[i]);
+            if (t[i].isValid() && d.args_[i]) {
+                if (isInlineArg(d.args_[i]))
+                    t[i].destruct(d.args_[i]);
+                else
+                    t[i].destroy(d.args_[i]);
+            }
         }
         if (reinterpret_cast<void *>(d.args_) != reinterpret_cast<void *>(prealloc_))
             free(d.args_);
     }
 }
 
+/*!
+    \internal
+
+    Copies the argument at \a copy, of type \a type, for queued delivery.
+    Values that fit are constructed into the event's inline storage, so that
+    delivering a queued signal with a few small arguments does not allocate;
+    everything else goes through QMetaType::create().
+ */
+void *QMetaCallEvent::createArg(QMetaType type, const void *copy)
+{
+    const size_t size = size_t(type.sizeOf());
+    const size_t alignment = size_t(type.alignOf());
+    if (size > 0 && alignment <= alignof(std::max_align_t)) {
+        const size_t offset = (argStorageUsed_ + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= sizeof(argStorage_)) {
+            argStorageUsed_ = offset + size;
+            return type.construct(argStorage_ + offset, copy);
+        }
+    }
+    return type.create(copy);
+}
+
 /*!
     \internal
  */
@@ -638,7 +753,7 @@ QMetaCallEvent* QMetaCallEvent::create_impl(QtPrivate::SlotObjUniquePtr slotObj,
     QMetaType *types = metaCallEvent->types();
     for (size_t i = 0; i < argc; ++i) {
         types[i] = metaTypes[i];
-        args[i] = types[i].create(argp[i]);
+        args[i] = metaCallEvent->createArg(types[i], argp[i]);
         Q_CHECK_PTR(!i || args[i]);
     }
 
@@ -1682,6 +1797,13 @@ bool QObject::moveToThread(QThread *targetThread QT6_IMPL_NEW_OVERLOAD_TAIL)
         return false;
     }
 
+    if (d->fixedThreadAffinity) {
+        // emitters may already have read the thread affinity without locking
+        qWarning("QObject::moveToThread: object %p promised a fixed thread affinity; "
+                 "concurrent signal emissions may misbehave", static_cast<void *>(this));
+        d->fixedThreadAffinity = false;
+    }
+
     // prepare to move
     d->moveToThread_helper();
 
@@ -2139,7 +2261,9 @@ void qt_qFindChildren_helper(const QObject *parent, QAnyStringView name,
     Q_ASSERT(parent);
     Q_ASSERT(list);
     for (QObject *obj : parent->children()) {
-        if (mo.cast(obj) && (name.isNull() || matches_objectName_non_null(obj, name)))
+        // check the name first: it rejects non-matches more cheaply than
+        // walking the meta-object hierarchy in cast()
+        if ((name.isNull() || matches_objectName_non_null(obj, name)) && mo.cast(obj))
             list->append(obj);
         if (options & Qt::FindChildrenRecursively)
             qt_qFindChildren_helper(obj, name, mo, list, options);
@@ -2174,7 +2298,9 @@ QObject *qt_qFindChild_helper(const QObject *parent, QAnyStringView name, const
 {
     Q_ASSERT(parent);
     for (QObject *obj : parent->children()) {
-        if (mo.cast(obj) && (name.isNull() || matches_objectName_non_null(obj, name)))
+        // check the name first: it rejects non-matches more cheaply than
+        // walking the meta-object hierarchy in cast()
+        if ((name.isNull() || matches_objectName_non_null(obj, name)) && mo.cast(obj))
            return obj;
     }
     if (options & Qt::FindChildrenRecursively) {
@@ -3975,7 +4101,7 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
             types[n] = QMetaType(argumentTypes[n - 1]);
 
         for (int n = 1; n < nargs; ++n)
-            args[n] = types[n].create(argv[n]);
+            args[n] = ev->createArg(types[n], argv[n]);
     }
 
     if (c->isSingleShot && !QObjectPrivate::removeConnection(c)) {
@@ -3994,6 +4120,12 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
     QCoreApplication::postEvent(receiver, ev);
 }
 
+static bool allThreadAffinitiesFixed()
+{
+    static const bool fixed = qEnvironmentVariableIntValue("QT_STABLE_THREAD_AFFINITY") > 0;
+    return fixed;
+}
+
 template <bool callbacks_enabled>
 void doActivate(QObject *sender, int signal_index, void **argv)
 {
@@ -4002,6 +4134,7 @@ void doActivate(QObject *sender, int signal_index, void **argv)
     if (sp->blockSig)
         return;
 
+    qtSignalsEmittedCounter.increment();
     Q_TRACE_SCOPE(QMetaObject_activate, sender, signal_index);
 
     if (sp->isDeclarativeSignalConnected(signal_index)
@@ -4035,14 +4168,15 @@ void doActivate(QObject *sender, int signal_index, void **argv)
     QObjectPrivate::ConnectionDataPointer connections(sp->connections.loadAcquire());
     QObjectPrivate::SignalVector *signalVector = connections->signalVector.loadRelaxed();
 
+    const QObjectPrivate::ConnectionList *allSignalsList = &signalVector->at(-1);
     const QObjectPrivate::ConnectionList *list;
     if (signal_index < signalVector->count())
         list = &signalVector->at(signal_index);
     else
-        list = &signalVector->at(-1);
+        list = allSignalsList;
 
     Qt::HANDLE currentThreadId = QThread::currentThreadId();
-    bool inSenderThread = currentThreadId == QObjectPrivate::get(sender)->threadData.loadRelaxed()->threadId.loadRelaxed();
+    bool inSenderThread = currentThreadId == sp->threadData.loadRelaxed()->threadId.loadRelaxed();
 
     // We need to check against the highest connection id to ensure that signals added
     // during the signal emission are not emitted in this emission.
@@ -4064,6 +4198,10 @@ void doActivate(QObject *sender, int signal_index, void **argv)
             bool receiverInSameThread;
             if (inSenderThread) {
                 receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
+            } else if (QObjectPrivate::get(receiver)->fixedThreadAffinity || allThreadAffinitiesFixed()) {
+                // the receiver promised not to be moved to another thread
+                // anymore, so the threadId cannot change under us
+                receiverInSameThread = currentThreadId == td->threadId.loadRelaxed();
             } else {
                 // need to lock before reading the threadId, because moveToThread() could interfere
                 QMutexLocker lock(signalSlotLock(receiver));
@@ -4151,9 +4289,9 @@ void doActivate(QObject *sender, int signal_index, void **argv)
             }
         } while ((c = c->nextConnectionList.loadRelaxed()) != nullptr && c->id <= highestConnectionId);
 
-    } while (list != &signalVector->at(-1) &&
+    } while (list != allSignalsList &&
         //start over for all signals;
-        ((list = &signalVector->at(-1)), true));
+        ((list = allSignalsList), true));
 
         if (connections->currentConnectionId.loadRelaxed() == 0)
             senderDeleted = true;
@@ -85,7 +85,8 @@ public:
     uint willBeWidget : 1; // for handling widget-specific bits in QObject's ctor
     uint wasWidget : 1; // for properly cleaning up in QObject's dtor
     uint receiveParentEvents: 1;
-    uint unused : 20;
+    uint fixedThreadAffinity : 1; // promises the object won't be moved to another thread anymore
+    uint unused : 19;
     QAtomicInt postedEvents;
     QDynamicMetaObjectData *metaObject;
     QBindingStorage bindingStorage;
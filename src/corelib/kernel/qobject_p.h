@@ -105,6 +105,15 @@ public:
             extraData = new ExtraData(this);
     }
 
+    // Promises that this object stays in its current thread until it is
+    // destroyed. Cross-thread signal emission then reads the object's thread
+    // affinity without taking its signal-slot lock, so direct activation on a
+    // stable connection topology stays lock-free for the emitter.
+    // moveToThread() revokes the promise with a warning. The promise can also
+    // be made globally with the QT_STABLE_THREAD_AFFINITY environment
+    // variable for applications that never move objects between live threads.
+    void setFixedThreadAffinity(bool fixed) { fixedThreadAffinity = fixed; }
+
     typedef void (*StaticMetaCallFunction)(QObject *, QMetaObject::Call, int, void **);
     struct Connection;
     struct ConnectionData;
@@ -419,6 +428,14 @@ public:
     inline const QMetaType *types() const { return reinterpret_cast<QMetaType *>(d.args_ + d.nargs_); }
     inline QMetaType *types() { return reinterpret_cast<QMetaType *>(d.args_ + d.nargs_); }
 
+    // copies an argument for queued delivery, into the inline storage if it fits
+    void *createArg(QMetaType type, const void *copy);
+
+    // events for queued connections are pooled, to keep steady-state queued
+    // signal emission away from the general-purpose allocator
+    void *operator new(std::size_t size);
+    void operator delete(void *ptr);
+
     virtual void placeMetaCall(QObject *object) override;
 
 private:
@@ -444,8 +461,16 @@ private:
         ushort method_offset_;
         ushort method_relative_;
     } d;
+    bool isInlineArg(const void *ptr) const
+    {
+        return quintptr(ptr) - quintptr(argStorage_) < sizeof(argStorage_);
+    }
+
     // preallocate enough space for three arguments
     alignas(void *) char prealloc_[3 * sizeof(void *) + 3 * sizeof(QMetaType)];
+    // inline storage for small argument values (see createArg())
+    alignas(std::max_align_t) char argStorage_[8 * sizeof(void *)];
+    size_t argStorageUsed_ = 0;
 };
 
 class QBoolBlocker
@@ -162,7 +162,8 @@ struct QPropertyObserverPointer
 #else
     void noSelfDependencies(QPropertyBindingPrivate *) {}
 #endif
-    void evaluateBindings(PendingBindingObserverList &bindingObservers, QBindingStatus *status);
+    void evaluateBindings(PendingBindingObserverList &bindingObservers, QBindingStatus *status,
+                          quint64 skipEpoch = 0);
     void observeProperty(QPropertyBindingDataPointer property);
 
     explicit operator bool() const { return ptr != nullptr; }
@@ -318,6 +319,11 @@ private:
 
     QMetaType metaType;
 
+    // epoch of the property update group flush this binding was last evaluated
+    // in; used by Qt::endPropertyUpdateGroup() to evaluate each binding at most
+    // once per flush (see QPropertyObserverPointer::evaluateBindings())
+    quint64 evaluationEpoch = 0;
+
 public:
     static constexpr size_t getSizeEnsuringAlignment() {
         constexpr auto align = alignof (std::max_align_t) - 1;
@@ -335,6 +341,8 @@ public:
     void setSticky(bool keep = true) {m_sticky = keep;}
     bool isSticky() {return m_sticky;}
     void scheduleNotify() {pendingNotify = true;}
+    quint64 lastEvaluationEpoch() const { return evaluationEpoch; }
+    void setEvaluationEpoch(quint64 epoch) { evaluationEpoch = epoch; }
 
     QPropertyBindingPrivate(QMetaType metaType, const QtPrivate::BindingFunctionVTable *vtable,
                             const QPropertyBindingSourceLocation &location, bool isQQmlPropertyBinding=false)
@@ -816,6 +824,9 @@ public:
 namespace QtPrivate {
 Q_CORE_EXPORT BindingEvaluationState *suspendCurrentBindingStatus();
 Q_CORE_EXPORT void restoreBindingStatus(BindingEvaluationState *status);
+// number of binding evaluations this thread avoided because the binding had
+// already been evaluated in the same property update group flush
+Q_AUTOTEST_EXPORT quint64 propertyUpdateGroupSkippedEvaluations();
 }
 
 struct QUntypedBindablePrivate
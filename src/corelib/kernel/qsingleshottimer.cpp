@@ -6,8 +6,11 @@
 
 #include "qcoreapplication.h"
 #include "qmetaobject_p.h"
+#include "qthread.h"
 #include "private/qnumeric_p.h"
 
+#include <utility>
+
 QT_BEGIN_NAMESPACE
 
 QSingleShotTimer::QSingleShotTimer(Duration interval, Qt::TimerType timerType,
@@ -81,6 +84,110 @@ void QSingleShotTimer::timerEvent(QTimerEvent *)
     delete this;
 }
 
+// The pool is a fixed, trivially destructible per-thread array: the parked
+// instances are owned by the thread's event dispatcher (their parent), and a
+// trivial pool can still be touched safely by their destructors even after
+// thread-local destruction has begun at thread exit.
+namespace {
+constexpr qsizetype SingleShotPoolCapacity = 16;
+struct SingleShotTimerPool
+{
+    QPooledSingleShotTimer *entries[SingleShotPoolCapacity];
+    qsizetype count = 0;
+
+    QPooledSingleShotTimer *take()
+    { return count > 0 ? entries[--count] : nullptr; }
+    bool park(QPooledSingleShotTimer *timer)
+    {
+        if (count == SingleShotPoolCapacity)
+            return false;
+        entries[count++] = timer;
+        return true;
+    }
+    void remove(QPooledSingleShotTimer *timer)
+    {
+        for (qsizetype i = 0; i < count; ++i) {
+            if (entries[i] == timer) {
+                entries[i] = entries[--count];
+                return;
+            }
+        }
+    }
+};
+}
+static thread_local SingleShotTimerPool singleShotPool;
+
+QPooledSingleShotTimer::QPooledSingleShotTimer(QObject *dispatcher)
+    : QObject(dispatcher)
+{
+}
+
+QPooledSingleShotTimer::~QPooledSingleShotTimer()
+{
+    // destroyed by the dispatcher, either while parked in the pool or with a
+    // shot still pending at dispatcher teardown
+    if (timerId > Qt::TimerId::Invalid)
+        killTimer(timerId);
+    if (slot)
+        slot->destroyIfLastRef();
+    singleShotPool.remove(this);
+}
+
+bool QPooledSingleShotTimer::schedule(Duration interval, Qt::TimerType timerType,
+                                      const QObject *r, QtPrivate::QSlotObjectBase *slotObj)
+{
+    QAbstractEventDispatcher *dispatcher = QAbstractEventDispatcher::instance();
+    if (!dispatcher)
+        return false;
+    if (r && r->thread() != QThread::currentThread())
+        return false;   // cross-thread shots need QSingleShotTimer's thread move
+
+    QPooledSingleShotTimer *timer = singleShotPool.take();
+    if (!timer)
+        timer = new QPooledSingleShotTimer(dispatcher);
+    timer->slot = slotObj;
+    timer->receiver = r;
+    timer->hasReceiver = r != nullptr;
+    timer->timerId = Qt::TimerId{timer->startTimer(interval, timerType)};
+    return true;
+}
+
+void QPooledSingleShotTimer::timerEvent(QTimerEvent *)
+{
+    // need to kill the timer _before_ we invoke the slot in case the
+    // slot calls processEvents()
+    if (timerId > Qt::TimerId::Invalid)
+        killTimer(std::exchange(timerId, Qt::TimerId::Invalid));
+
+    QtPrivate::QSlotObjectBase *slotObj = std::exchange(slot, nullptr);
+    // a destroyed receiver cancels the shot, like a broken connection would
+    QObject *context = hasReceiver ? const_cast<QObject *>(receiver.data()) : this;
+    if (context && slotObj) {
+        if (hasReceiver && context->thread() != thread()) {
+            // the receiver moved to another thread after the shot was
+            // scheduled; deliver the call over there, as the
+            // connection-based path would
+            QtPrivate::SlotObjUniquePtr slot(std::exchange(slotObj, nullptr));
+            QMetaObject::invokeMethod(context, [context, slot = std::move(slot)] {
+                void *args[] = { nullptr };
+                slot->call(context, args);
+            }, Qt::QueuedConnection);
+        } else {
+            void *args[] = { nullptr };
+            slotObj->call(context, args);
+        }
+    }
+    if (slotObj)
+        slotObj->destroyIfLastRef();
+
+    // not in the pool while the slot ran, so it cannot have been handed out
+    // again; park it for reuse now
+    receiver.clear();
+    hasReceiver = false;
+    if (!singleShotPool.park(this))
+        delete this;
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qsingleshottimer_p.cpp"
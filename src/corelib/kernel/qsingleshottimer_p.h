@@ -19,6 +19,7 @@
 #include <QtCore/qobject.h>
 #include <QtCore/qabstracteventdispatcher.h>
 #include <QtCore/qnamespace.h>
+#include <QtCore/qpointer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -51,6 +52,33 @@ private:
     void timerEvent(QTimerEvent *) override;
 };
 
+// Allocation-free path for same-thread single shots with a functor: instead
+// of a fresh QObject plus a connection per shot, instances are recycled
+// through a small per-thread pool and invoke the slot object directly.
+class QPooledSingleShotTimer : public QObject
+{
+public:
+    using Duration = QAbstractEventDispatcher::Duration;
+
+    // Schedules slotObj to be called once after interval, reusing a parked
+    // instance from the current thread's pool when one is available. Returns
+    // false when this path cannot be used (no dispatcher in this thread, or a
+    // receiver living in another thread) and the caller must fall back to
+    // QSingleShotTimer.
+    static bool schedule(Duration interval, Qt::TimerType timerType,
+                         const QObject *receiver, QtPrivate::QSlotObjectBase *slotObj);
+
+private:
+    explicit QPooledSingleShotTimer(QObject *dispatcher);
+    ~QPooledSingleShotTimer() override;
+    void timerEvent(QTimerEvent *) override;
+
+    Qt::TimerId timerId = Qt::TimerId::Invalid;
+    QtPrivate::QSlotObjectBase *slot = nullptr;
+    QPointer<const QObject> receiver;
+    bool hasReceiver = false;
+};
+
 QT_END_NAMESPACE
 
 #endif // QSINGLESHOTTIMER_P_H
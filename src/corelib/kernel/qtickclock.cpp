@@ -0,0 +1,227 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtickclock_p.h"
+
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/private/qlocking_p.h>
+
+#if defined(Q_CC_MSVC)
+#  include <intrin.h>
+#elif defined(Q_PROCESSOR_X86_64)
+#  include <cpuid.h>
+#  include <x86intrin.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtPrivate;
+using namespace std::chrono;
+
+// We can only do the tick-to-nanosecond conversion without loss of precision
+// or overflow if 128-bit multiplication is available.
+#if defined(QT_SUPPORTS_INT128) && (defined(Q_PROCESSOR_X86_64) || defined(Q_PROCESSOR_ARM_64))
+#  define QTICKCLOCK_HAVE_COUNTER
+#endif
+
+#ifdef QTICKCLOCK_HAVE_COUNTER
+static quint64 readTicks() noexcept
+{
+#  if defined(Q_PROCESSOR_X86_64)
+    return __rdtsc();
+#  elif defined(Q_PROCESSOR_ARM_64)
+#    if defined(Q_CC_MSVC)
+    return _ReadStatusReg(ARM64_SYSREG(3, 3, 14, 0, 2));    // CNTVCT_EL0
+#    else
+    quint64 ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r" (ticks));
+    return ticks;
+#    endif
+#  endif
+}
+
+static bool counterIsInvariant() noexcept
+{
+#  if defined(Q_PROCESSOR_X86_64)
+    // CPUID leaf 8000_0007h, EDX bit 8: the TSC ticks at a constant rate in
+    // all P-, C- and T-states ("invariant TSC")
+    uint eax = 0, ebx = 0, ecx = 0, edx = 0;
+#    if defined(Q_CC_MSVC)
+    int info[4];
+    __cpuid(info, int(0x80000000));
+    if (uint(info[0]) < 0x80000007)
+        return false;
+    __cpuid(info, int(0x80000007));
+    edx = uint(info[3]);
+#    else
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007)
+        return false;
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+#    endif
+    return edx & (1U << 8);
+#  elif defined(Q_PROCESSOR_ARM_64)
+    // the architected counter of the ARM generic timer is invariant by design
+    return true;
+#  endif
+}
+
+static quint64 architectedFrequency() noexcept
+{
+#  if defined(Q_PROCESSOR_ARM_64)
+    // the generic timer reports its own frequency
+#    if defined(Q_CC_MSVC)
+    return _ReadStatusReg(ARM64_SYSREG(3, 3, 14, 0, 0));    // CNTFRQ_EL0
+#    else
+    quint64 frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r" (frequency));
+    return frequency;
+#    endif
+#  else
+    // x86 has no architected way to get the TSC frequency that works across
+    // vendors, so we measure it against steady_clock instead
+    return 0;
+#  endif
+}
+#endif // QTICKCLOCK_HAVE_COUNTER
+
+namespace {
+enum ClockState : int {
+    Uncalibrated,       // nothing decided yet
+    Calibrating,        // anchor taken, measuring the tick frequency
+    UsingCounter,       // reading the hardware counter
+    UsingSystemClock    // no usable counter, permanent steady_clock fallback
+};
+}
+
+Q_CONSTINIT static QBasicAtomicInt clockState = Q_BASIC_ATOMIC_INITIALIZER(Uncalibrated);
+Q_CONSTINIT static QBasicMutex calibrationMutex;
+
+// written under calibrationMutex before clockState transitions to
+// UsingCounter (release), read freely afterwards (acquire)
+Q_CONSTINIT static quint64 anchorTicks = 0;
+Q_CONSTINIT static qint64 anchorNsecs = 0;
+Q_CONSTINIT static quint64 tickFrequency = 0;
+
+// minimum measurement interval: long enough that steady_clock jitter at both
+// ends stays well below one part per thousand of the measured frequency
+static constexpr nanoseconds MinimumCalibrationTime = 10ms;
+
+static QTickClock::time_point steadyNow() noexcept
+{
+    return time_point_cast<QTickClock::duration>(steady_clock::now());
+}
+
+#ifdef QTICKCLOCK_HAVE_COUNTER
+static QTickClock::time_point fromTicks(quint64 ticks) noexcept
+{
+    const quint128 elapsed = quint128(ticks - anchorTicks) * 1'000'000'000;
+    return QTickClock::time_point(nanoseconds(anchorNsecs + qint64(elapsed / tickFrequency)));
+}
+
+static QTickClock::time_point calibrate() noexcept
+{
+    // take the sample pair before acquiring the mutex, so a contended lock
+    // doesn't separate the two reads
+    const qint64 nsecs = steadyNow().time_since_epoch().count();
+    const quint64 ticks = readTicks();
+
+    const auto locker = qt_scoped_lock(calibrationMutex);
+    switch (clockState.loadRelaxed()) {
+    case Uncalibrated:
+        if (!counterIsInvariant()) {
+            clockState.storeRelease(UsingSystemClock);
+            break;
+        }
+        anchorTicks = ticks;
+        anchorNsecs = nsecs;
+        if (quint64 frequency = architectedFrequency()) {
+            tickFrequency = frequency;
+            clockState.storeRelease(UsingCounter);
+        } else {
+            // we need a second sample to measure the frequency; until it is
+            // due, keep answering from steady_clock
+            clockState.storeRelease(Calibrating);
+        }
+        break;
+
+    case Calibrating:
+        if (nanoseconds(nsecs - anchorNsecs) >= MinimumCalibrationTime) {
+            const quint128 elapsedTicks = quint128(ticks - anchorTicks) * 1'000'000'000;
+            const quint64 frequency = quint64(elapsedTicks / quint64(nsecs - anchorNsecs));
+            if (frequency == 0) {
+                // the "counter" didn't advance; don't trust it
+                clockState.storeRelease(UsingSystemClock);
+                break;
+            }
+            tickFrequency = frequency;
+            anchorTicks = ticks;
+            anchorNsecs = nsecs;
+            clockState.storeRelease(UsingCounter);
+        }
+        break;
+
+    case UsingCounter:
+        // another thread finished calibrating while we took our samples
+        return fromTicks(ticks);
+
+    case UsingSystemClock:
+        break;
+    }
+    return QTickClock::time_point(nanoseconds(nsecs));
+}
+#endif // QTICKCLOCK_HAVE_COUNTER
+
+/*!
+    \internal
+
+    Returns the current time as a nanosecond time point anchored to the
+    steady_clock epoch.
+*/
+QTickClock::time_point QTickClock::now() noexcept
+{
+#ifdef QTICKCLOCK_HAVE_COUNTER
+    const int state = clockState.loadAcquire();
+    if (Q_LIKELY(state == UsingCounter))
+        return fromTicks(readTicks());
+    if (state != UsingSystemClock)
+        return calibrate();
+#endif
+    return steadyNow();
+}
+
+/*!
+    \internal
+
+    Fills \a points with consecutive timestamps, front to back.
+*/
+void QTickClock::timestamp(QSpan<time_point> points) noexcept
+{
+#ifdef QTICKCLOCK_HAVE_COUNTER
+    if (!points.isEmpty() && clockState.loadAcquire() == UsingCounter) {
+        // load the conversion parameters once for the whole batch
+        const quint64 ticks0 = anchorTicks;
+        const qint64 nsecs0 = anchorNsecs;
+        const quint64 frequency = tickFrequency;
+        for (time_point &point : points) {
+            const quint128 elapsed = quint128(readTicks() - ticks0) * 1'000'000'000;
+            point = time_point(nanoseconds(nsecs0 + qint64(elapsed / frequency)));
+        }
+        return;
+    }
+#endif
+    for (time_point &point : points)
+        point = now();
+}
+
+/*!
+    \internal
+*/
+bool QTickClock::usesHardwareCounter() noexcept
+{
+    now();      // trigger calibration
+    const int state = clockState.loadAcquire();
+    return state == UsingCounter || state == Calibrating;
+}
+
+QT_END_NAMESPACE
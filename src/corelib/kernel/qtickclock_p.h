@@ -0,0 +1,67 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTICKCLOCK_P_H
+#define QTICKCLOCK_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qspan.h>
+
+#include <chrono>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+/*
+    A std::chrono-compatible clock for hot-path timestamping.
+
+    Where the processor provides an invariant tick counter readable from user
+    space (TSC on x86-64, the generic timer counter on 64-bit ARM), now() reads
+    it directly and converts to nanoseconds with a calibrated ratio, which is
+    several times cheaper than a clock_gettime() round trip. On all other
+    processors, and whenever the counter cannot be trusted to tick uniformly,
+    now() transparently falls back to std::chrono::steady_clock.
+
+    Time points are anchored to the steady_clock epoch, so they can be compared
+    (modulo calibration error in the microsecond range) with values obtained
+    from steady_clock or QElapsedTimer. Use this clock only where the cost of
+    taking a timestamp matters more than that error; for everything else,
+    QElapsedTimer remains the right tool.
+*/
+class QTickClock
+{
+public:
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<std::chrono::steady_clock, duration>;
+    static constexpr bool is_steady = true;
+
+    Q_CORE_EXPORT static time_point now() noexcept;
+
+    // fills \a points with consecutive timestamps; cheaper than calling now()
+    // in a loop because the conversion parameters are only loaded once
+    Q_CORE_EXPORT static void timestamp(QSpan<time_point> points) noexcept;
+
+    // returns true if now() reads the hardware tick counter on this system
+    // (triggers calibration on first call)
+    Q_CORE_EXPORT static bool usesHardwareCounter() noexcept;
+};
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // QTICKCLOCK_P_H
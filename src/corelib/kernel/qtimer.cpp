@@ -349,6 +349,8 @@ void QTimer::singleShotImpl(std::chrono::milliseconds msec, Qt::TimerType timerT
         return;
     }
 
+    if (QPooledSingleShotTimer::schedule(from_msecs(msec), timerType, receiver, slotObj))
+        return;
     new QSingleShotTimer(from_msecs(msec), timerType, receiver, slotObj);
 }
 
@@ -12,6 +12,8 @@
 
 #include <sys/times.h>
 
+#include <algorithm>
+
 using namespace std::chrono;
 // Implied by "using namespace std::chrono", but be explicit about it, for grep-ability
 using namespace std::chrono_literals;
@@ -56,6 +58,7 @@ void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
     timers.insert(std::upper_bound(timers.cbegin(), timers.cend(), ti, byTimeout),
                   ti);
+    timerIds.insert(ti->id, ti);
 }
 
 static constexpr milliseconds roundToMillisecond(nanoseconds val)
@@ -260,15 +263,14 @@ QTimerInfoList::Duration QTimerInfoList::remainingDuration(Qt::TimerId timerId)
 {
     const steady_clock::time_point now = updateCurrentTime();
 
-    auto it = findTimerById(timerId);
-    if (it == timers.cend()) {
+    const QTimerInfo *t = findTimerById(timerId);
+    if (!t) {
 #ifndef QT_NO_DEBUG
         qWarning("QTimerInfoList::timerRemainingTime: timer id %i not found", int(timerId));
 #endif
         return Duration::min();
     }
 
-    const QTimerInfo *t = *it;
     if (now < t->timeout) // time to wait
         return t->timeout - now;
     return 0ms;
@@ -319,18 +321,24 @@ void QTimerInfoList::registerTimer(Qt::TimerId timerId, QTimerInfoList::Duration
 
 bool QTimerInfoList::unregisterTimer(Qt::TimerId timerId)
 {
-    auto it = findTimerById(timerId);
-    if (it == timers.cend())
+    QTimerInfo *t = findTimerById(timerId);
+    if (!t)
         return false; // id not found
 
     // set timer inactive
-    QTimerInfo *t = *it;
     if (t == firstTimerInfo)
         firstTimerInfo = nullptr;
     if (t->activateRef)
         *(t->activateRef) = nullptr;
-    delete t;
+
+    // the list is kept sorted by timeout, so the entry can be located with a
+    // binary search instead of scanning the whole list
+    const auto [first, last] = std::equal_range(timers.cbegin(), timers.cend(), t, byTimeout);
+    auto it = std::find(first, last, t);
+    Q_ASSERT(it != last);
     timers.erase(it);
+    timerIds.remove(timerId);
+    delete t;
     return true;
 }
 
@@ -346,6 +354,7 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
                     firstTimerInfo = nullptr;
                 if (t->activateRef)
                     *(t->activateRef) = nullptr;
+                timerIds.remove(t->id);
                 delete t;
                 return true;
             }
@@ -18,6 +18,7 @@
 #include <QtCore/private/qglobal_p.h>
 
 #include "qabstracteventdispatcher.h"
+#include <QtCore/qhash.h>
 
 #include <sys/time.h> // struct timespec
 #include <chrono>
@@ -69,16 +70,16 @@ public:
     {
         qDeleteAll(timers);
         timers.clear();
+        timerIds.clear();
     }
 
     bool isEmpty() const { return timers.empty(); }
 
     qsizetype size() const { return timers.size(); }
 
-    auto findTimerById(Qt::TimerId timerId) const
+    QTimerInfo *findTimerById(Qt::TimerId timerId) const
     {
-        auto matchesId = [timerId](const auto &t) { return t->id == timerId; };
-        return std::find_if(timers.cbegin(), timers.cend(), matchesId);
+        return timerIds.value(timerId);
     }
 
 private:
@@ -86,7 +87,8 @@ private:
 
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo = nullptr;
-    QList<QTimerInfo *> timers;
+    QList<QTimerInfo *> timers;     // sorted by timeout
+    QHash<Qt::TimerId, QTimerInfo *> timerIds;  // the same entries, for lookup by id
 };
 
 QT_END_NAMESPACE
@@ -45,7 +45,8 @@ QMimeDatabasePrivate *QMimeDatabasePrivate::instance()
 }
 
 QMimeDatabasePrivate::QMimeDatabasePrivate()
-    : m_defaultMimeType(QStringLiteral("application/octet-stream"))
+    : m_sniffCacheEnabled(qEnvironmentVariableIsEmpty("QT_NO_MIME_SNIFF_CACHE")),
+      m_defaultMimeType(QStringLiteral("application/octet-stream"))
 {
 }
 
@@ -61,6 +62,10 @@ static const
 #endif
 int qmime_secondsBetweenChecks = 5;
 
+// Keeps the sniff cache from growing without bound on huge trees; at this
+// size it is cheaper to start over than to evict individual entries.
+static constexpr qsizetype maxSniffCacheSize = 1 << 17;
+
 bool QMimeDatabasePrivate::shouldCheck()
 {
     if (m_lastCheck.isValid() && m_lastCheck.elapsed() < qmime_secondsBetweenChecks * 1000)
@@ -97,6 +102,7 @@ void QMimeDatabasePrivate::loadProviders()
 
     m_providers.reserve(mimeDirs.size() + (needInternalDB ? 1 : 0));
 
+    bool providersChanged = false;
     for (const QString &mimeDir : mimeDirs) {
         const QString cacheFile = mimeDir + "/mime.cache"_L1;
         // Check if we already have a provider for this dir
@@ -121,12 +127,14 @@ void QMimeDatabasePrivate::loadProviders()
                 //qDebug() << "Created XML provider for" << mimeDir;
             }
             m_providers.push_back(std::move(provider));
+            providersChanged = true;
         } else {
             auto provider = std::move(*it); // take provider out of the vector
             provider->ensureLoaded();
             if (!provider->isValid()) {
                 provider.reset(new QMimeXMLProvider(this, mimeDir));
                 //qDebug() << "Created XML provider to replace binary provider for" << mimeDir;
+                providersChanged = true;
             }
             m_providers.push_back(std::move(provider));
         }
@@ -153,6 +161,15 @@ void QMimeDatabasePrivate::loadProviders()
     const auto end = m_providers.end();
     for (; it != end; ++it)
         (*it)->setOverrideProvider((it - 1)->get());
+
+    // providers still left in currentProviders were dropped (their directory
+    // disappeared); a different set of providers may produce different
+    // answers for files that were already sniffed
+    const auto notReused = [](const Providers::value_type &prov) { return bool(prov); };
+    if (providersChanged
+        || std::any_of(currentProviders.begin(), currentProviders.end(), notReused)) {
+        m_sniffCache.clear();
+    }
 }
 
 const QMimeDatabasePrivate::Providers &QMimeDatabasePrivate::providers()
@@ -476,6 +493,24 @@ QMimeType QMimeDatabasePrivate::mimeTypeForFile(const QString &fileName,
                 return mimeTypeForName(QStringLiteral("inode/fifo"));
             if (S_ISSOCK(statBuffer.st_mode))
                 return mimeTypeForName(QStringLiteral("inode/socket"));
+
+            if (m_sniffCacheEnabled && mode == QMimeDatabase::MatchDefault
+                && S_ISREG(statBuffer.st_mode)) {
+                // we already paid for the stat(), so use it to serve repeated
+                // queries for unchanged files without reopening them
+                const SniffCacheKey key = { quint64(statBuffer.st_dev),
+                                            quint64(statBuffer.st_ino),
+                                            qint64(statBuffer.st_size),
+                                            qint64(statBuffer.st_mtime) };
+                const auto it = m_sniffCache.constFind(key);
+                if (it != m_sniffCache.constEnd())
+                    return mimeTypeForName(it.value());
+                const QMimeType result = mimeTypeForFileNameAndData(fileName, nullptr);
+                if (m_sniffCache.size() >= maxSniffCacheSize)
+                    m_sniffCache.clear();
+                m_sniffCache.insert(key, result.name());
+                return result;
+            }
         }
 #endif
     } else if (fileInfo.isDir()) {
@@ -634,6 +669,29 @@ QMimeType QMimeDatabase::mimeTypeForFile(const QFileInfo &fileInfo, MatchMode mo
     return d->mimeTypeForFile(fileInfo.filePath(), fileInfo, mode);
 }
 
+/*!
+    \overload
+    \since 6.9
+
+    Returns the MIME type for the directory entry \a entry using \a mode.
+
+    This overload is intended for classifying many files while iterating a
+    directory tree with QDirListing. It reuses the file information the
+    listing already gathered instead of building a new QFileInfo from the
+    path, and, like the other overloads, it serves repeated queries for
+    unchanged files from a result cache keyed by the file's device, inode and
+    modification time, so re-running over a mostly-unchanged tree does not
+    sniff file contents again.
+
+    \sa QDirListing, QMimeType::isDefault(), mimeTypeForData()
+*/
+QMimeType QMimeDatabase::mimeTypeForFile(const QDirListing::DirEntry &entry, MatchMode mode) const
+{
+    QMutexLocker locker(&d->mutex);
+
+    return d->mimeTypeForFile(entry.filePath(), entry.fileInfo(), mode);
+}
+
 /*!
     Returns a MIME type for the file named \a fileName using \a mode.
 
@@ -9,6 +9,7 @@
 
 QT_REQUIRE_CONFIG(mimetype);
 
+#include <QtCore/qdirlisting.h>
 #include <QtCore/qstringlist.h>
 
 QT_BEGIN_NAMESPACE
@@ -37,6 +38,8 @@ public:
 
     QMimeType mimeTypeForFile(const QString &fileName, MatchMode mode = MatchDefault) const;
     QMimeType mimeTypeForFile(const QFileInfo &fileInfo, MatchMode mode = MatchDefault) const;
+    QMimeType mimeTypeForFile(const QDirListing::DirEntry &entry,
+                              MatchMode mode = MatchDefault) const;
     QList<QMimeType> mimeTypesForFileName(const QString &fileName) const;
 
     QMimeType mimeTypeForData(const QByteArray &data) const;
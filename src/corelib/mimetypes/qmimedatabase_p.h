@@ -25,6 +25,7 @@ QT_REQUIRE_CONFIG(mimetype);
 #include "qmimeglobpattern_p.h"
 
 #include <QtCore/qelapsedtimer.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qlist.h>
 #include <QtCore/qmutex.h>
 
@@ -81,6 +82,26 @@ private:
     void loadProviders();
     QString fallbackParent(const QString &mimeTypeName) const;
 
+    // caches sniffing results for regular local files; the result cannot
+    // change unless the file itself does, so key by (device, inode, size,
+    // modification time) and serve unchanged files without reopening them
+    struct SniffCacheKey
+    {
+        quint64 device;
+        quint64 inode;
+        qint64 size;
+        qint64 mtime;
+        friend bool operator==(const SniffCacheKey &lhs, const SniffCacheKey &rhs) noexcept
+        {
+            return lhs.device == rhs.device && lhs.inode == rhs.inode
+                    && lhs.size == rhs.size && lhs.mtime == rhs.mtime;
+        }
+        friend size_t qHash(const SniffCacheKey &key, size_t seed) noexcept
+        { return qHashMulti(seed, key.device, key.inode, key.size, key.mtime); }
+    };
+    QHash<SniffCacheKey, QString> m_sniffCache;
+    bool m_sniffCacheEnabled;
+
     const QString m_defaultMimeType;
     mutable Providers m_providers; // most local first, most global last
     QElapsedTimer m_lastCheck;
@@ -9,6 +9,7 @@
 #include "private/qduplicatetracker_p.h"
 #include "private/qloggingregistry_p.h"
 #include "private/qobject_p.h"
+#include "private/qstartupprofiler_p.h"
 #include "qcborarray.h"
 #include "qcbormap.h"
 #include "qcborstreamreader.h"
@@ -27,6 +28,15 @@
 #  include "qlibrary_p.h"
 #endif
 
+#if QT_CONFIG(library) && QT_CONFIG(temporaryfile) && QT_CONFIG(cborstreamwriter)
+#  define QFACTORYLOADER_METADATA_CACHE
+#  include "qdir.h"
+#  include "qsavefile.h"
+#  include "qstandardpaths.h"
+#  include "qsysinfo.h"
+#  include "qtimezone.h"
+#endif
+
 #include <qtcore_tracepoints_p.h>
 
 #include <map>
@@ -249,6 +259,32 @@ QJsonObject QPluginParsedMetaData::toJson() const
     return o;
 }
 
+#ifdef QFACTORYLOADER_METADATA_CACHE
+/*!
+    \internal
+    Serializes the parsed metadata for QFactoryLoader's on-disk cache.
+*/
+QByteArray QPluginParsedMetaData::toCborBytes() const
+{
+    return data.toCbor();
+}
+
+/*!
+    \internal
+    Restores metadata that toCborBytes() produced. Returns false (leaving the
+    object unchanged) if \a cbor does not hold a well-formed metadata map.
+*/
+bool QPluginParsedMetaData::setCborData(const QByteArray &cbor)
+{
+    QCborParserError error;
+    QCborValue value = QCborValue::fromCbor(cbor, &error);
+    if (error.error != QCborError::NoError || !value.isMap())
+        return false;
+    data = std::move(value);
+    return true;
+}
+#endif // QFACTORYLOADER_METADATA_CACHE
+
 class QFactoryLoaderPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QFactoryLoader)
@@ -287,6 +323,120 @@ struct QFactoryLoaderGlobals
 
 Q_GLOBAL_STATIC(QFactoryLoaderGlobals, qt_factoryloader_global)
 
+#ifdef QFACTORYLOADER_METADATA_CACHE
+namespace {
+// On-disk cache of plugin metadata, so that enumerating unchanged plugin
+// directories costs one small file read instead of opening every library to
+// locate its metadata section. Entries are validated lazily against each
+// file's size and modification time while the directory listing is walked;
+// a mismatch falls back to the normal scan and the cache is rewritten.
+struct QFactoryLoaderMetadataCache
+{
+    static constexpr qint64 CacheFormatVersion = 1;
+
+    struct Entry
+    {
+        qint64 size = 0;
+        qint64 mtime = 0;
+        QByteArray metaData;    // empty for files known not to be plugins
+
+        friend bool operator==(const Entry &lhs, const Entry &rhs) noexcept
+        { return lhs.size == rhs.size && lhs.mtime == rhs.mtime && lhs.metaData == rhs.metaData; }
+    };
+    using DirEntries = QHash<QString, Entry>;
+
+    QMutex mutex;
+    QHash<QString, DirEntries> dirs;
+    bool loaded = false;
+
+    static bool isEnabled()
+    {
+        static const bool disabled = qEnvironmentVariableIsSet("QT_NO_PLUGIN_METADATA_CACHE");
+        return !disabled;
+    }
+
+    // the Qt version, build ABI and build configuration are part of the file
+    // name, so a cache file is only ever read by the build that wrote it
+    static QString cacheFilePath()
+    {
+        const QString dir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+        if (dir.isEmpty())
+            return QString();
+        return dir + "/qt_plugin_metadata_"_L1 + QSysInfo::buildAbi() + u'_'
+                + QLatin1StringView(QT_VERSION_STR)
+                + (QT_CONFIG(debug) ? "_debug"_L1 : ""_L1);
+    }
+
+    void ensureLoaded()     // call with the mutex held
+    {
+        if (loaded)
+            return;
+        loaded = true;
+
+        const QString path = cacheFilePath();
+        if (path.isEmpty())
+            return;
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly))
+            return;
+
+        QCborParserError error;
+        const QCborValue root = QCborValue::fromCbor(file.readAll(), &error);
+        if (error.error != QCborError::NoError || !root.isMap()
+            || root[0].toInteger() != CacheFormatVersion) {
+            qCDebug(lcFactoryLoader) << "ignoring stale or invalid metadata cache" << path;
+            return;
+        }
+
+        const QCborMap dirMap = root[1].toMap();
+        for (auto dirIt : dirMap) {
+            if (!dirIt.first.isString() || !dirIt.second.isMap())
+                continue;
+            DirEntries entries;
+            const QCborMap files = dirIt.second.toMap();
+            for (auto fileIt : files) {
+                const QCborArray fields = fileIt.second.toArray();
+                if (!fileIt.first.isString() || fields.size() != 3)
+                    continue;
+                entries.insert(fileIt.first.toString(),
+                               Entry{ fields.at(0).toInteger(), fields.at(1).toInteger(),
+                                      fields.at(2).toByteArray() });
+            }
+            dirs.insert(dirIt.first.toString(), std::move(entries));
+        }
+    }
+
+    void save()             // call with the mutex held
+    {
+        const QString path = cacheFilePath();
+        if (path.isEmpty())
+            return;
+
+        QCborMap dirMap;
+        for (auto dirIt = dirs.cbegin(), dirEnd = dirs.cend(); dirIt != dirEnd; ++dirIt) {
+            QCborMap files;
+            for (auto it = dirIt.value().cbegin(), end = dirIt.value().cend(); it != end; ++it)
+                files.insert(it.key(),
+                             QCborArray{ it.value().size, it.value().mtime, it.value().metaData });
+            dirMap.insert(dirIt.key(), files);
+        }
+        QCborMap root;
+        root.insert(qint64(0), CacheFormatVersion);
+        root.insert(qint64(1), dirMap);
+
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly))
+            return;
+        file.write(QCborValue(root).toCbor());
+        file.commit();
+    }
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QFactoryLoaderMetadataCache, factoryLoaderMetadataCache)
+#endif // QFACTORYLOADER_METADATA_CACHE
+
 QFactoryLoaderPrivate::~QFactoryLoaderPrivate()
     = default;
 
@@ -303,6 +453,18 @@ inline void QFactoryLoaderPrivate::updateSinglePath(const QString &path)
 
     qCDebug(lcFactoryLoader) << "checking directory path" << path << "...";
 
+#ifdef QFACTORYLOADER_METADATA_CACHE
+    QFactoryLoaderMetadataCache *cache =
+            QFactoryLoaderMetadataCache::isEnabled() ? factoryLoaderMetadataCache() : nullptr;
+    QFactoryLoaderMetadataCache::DirEntries cachedEntries;
+    QFactoryLoaderMetadataCache::DirEntries seenEntries;
+    if (cache) {
+        QMutexLocker locker(&cache->mutex);
+        cache->ensureLoaded();
+        cachedEntries = cache->dirs.value(path);
+    }
+#endif
+
     QDirListing plugins(path,
 #if defined(Q_OS_WIN)
                 QStringList(QStringLiteral("*.dll")),
@@ -323,14 +485,59 @@ inline void QFactoryLoaderPrivate::updateSinglePath(const QString &path)
 
         Q_TRACE(QFactoryLoader_update, fileName);
 
+#ifdef QFACTORYLOADER_METADATA_CACHE
+        QFactoryLoaderMetadataCache::Entry cacheEntry;
+        bool cacheHit = false;
+        if (cache) {
+            cacheEntry.size = dirEntry.size();
+            cacheEntry.mtime = dirEntry.lastModified(QTimeZone::UTC).toMSecsSinceEpoch();
+            const auto it = cachedEntries.constFind(fileName);
+            if (it != cachedEntries.constEnd() && it->size == cacheEntry.size
+                && it->mtime == cacheEntry.mtime) {
+                cacheHit = true;
+                cacheEntry.metaData = it->metaData;
+                if (cacheEntry.metaData.isEmpty()) {
+                    // known not to be a (compatible) plugin; skip it without
+                    // even opening the file
+                    qCDebug(lcFactoryLoader) << "cached as not a plugin";
+                    seenEntries.insert(fileName, cacheEntry);
+                    continue;
+                }
+            }
+        }
+#endif
+
         QLibraryPrivate::UniquePtr library;
         library.reset(QLibraryPrivate::findOrCreate(dirEntry.canonicalFilePath()));
+#ifdef QFACTORYLOADER_METADATA_CACHE
+        if (cacheHit) {
+            QPluginParsedMetaData cachedMetaData;
+            if (cachedMetaData.setCborData(cacheEntry.metaData))
+                library->setPluginMetaData(cachedMetaData);
+            else
+                cacheHit = false;   // corrupt entry; rescan and refresh it
+        }
+#endif
         if (!library->isPlugin()) {
             qCDebug(lcFactoryLoader) << library->errorString << Qt::endl
                                      << "         not a plugin";
+#ifdef QFACTORYLOADER_METADATA_CACHE
+            if (cache) {
+                cacheEntry.metaData.clear();
+                seenEntries.insert(fileName, cacheEntry);
+            }
+#endif
             continue;
         }
 
+#ifdef QFACTORYLOADER_METADATA_CACHE
+        if (cache) {
+            if (!cacheHit)
+                cacheEntry.metaData = library->metaData.toCborBytes();
+            seenEntries.insert(fileName, cacheEntry);
+        }
+#endif
+
         QStringList keys;
         bool metaDataOk = false;
 
@@ -379,6 +586,14 @@ inline void QFactoryLoaderPrivate::updateSinglePath(const QString &path)
             libraries.push_back(std::move(library));
         }
     };
+
+#ifdef QFACTORYLOADER_METADATA_CACHE
+    if (cache && seenEntries != cachedEntries) {
+        QMutexLocker locker(&cache->mutex);
+        cache->dirs.insert(path, std::move(seenEntries));
+        cache->save();
+    }
+#endif
 }
 
 void QFactoryLoader::update()
@@ -386,6 +601,8 @@ void QFactoryLoader::update()
 #ifdef QT_SHARED
     Q_D(QFactoryLoader);
 
+    QStartupPhase startupPhase("QFactoryLoader::update", d->iid);
+
     const QStringList paths = QCoreApplication::libraryPaths();
     for (const QString &pluginDir : paths) {
 #ifdef Q_OS_ANDROID
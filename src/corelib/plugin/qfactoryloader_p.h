@@ -52,6 +52,10 @@ public:
 
     QJsonObject toJson() const;     // only for QLibrary & QPluginLoader
 
+    // (de)serialization for QFactoryLoader's on-disk metadata cache
+    QByteArray toCborBytes() const;
+    bool setCborData(const QByteArray &cbor);
+
     // if data is not a map, toMap() returns empty, so shall these functions
     QCborMap toCbor() const                         { return data.toMap(); }
     QCborValue value(QtPluginMetaDataKeys k) const  { return data[int(k)]; }
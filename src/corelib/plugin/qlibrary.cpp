@@ -719,6 +719,22 @@ bool QLibraryPrivate::isPlugin()
     return pluginState == IsAPlugin;
 }
 
+/*!
+    \internal
+    Seeds the plugin metadata from QFactoryLoader's metadata cache instead of
+    scanning the library file. The caller guarantees that the cached data was
+    produced by this very Qt build from an unchanged file, so the
+    compatibility checks in updatePluginState() have already passed for it.
+*/
+void QLibraryPrivate::setPluginMetaData(const QPluginParsedMetaData &data)
+{
+    QMutexLocker locker(&mutex);
+    if (pluginState != MightBeAPlugin)
+        return;     // the real file has already been scanned
+    metaData = data;
+    pluginState = IsAPlugin;
+}
+
 void QLibraryPrivate::updatePluginState()
 {
     QMutexLocker locker(&mutex);
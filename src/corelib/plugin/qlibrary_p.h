@@ -100,6 +100,7 @@ public:
 
     void updatePluginState();
     bool isPlugin();
+    void setPluginMetaData(const QPluginParsedMetaData &data);
 
 private:
     explicit QLibraryPrivate(const QString &canonicalFileName, const QString &version, QLibrary::LoadHints loadHints);
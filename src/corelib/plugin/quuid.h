@@ -6,6 +6,7 @@
 
 #include <QtCore/qcompare.h>
 #include <QtCore/qendian.h>
+#include <QtCore/qspan.h>
 #include <QtCore/qstring.h>
 
 #if defined(Q_OS_WIN) || defined(Q_QDOC)
@@ -47,7 +48,8 @@ public:
         Md5                 = 3, // 0 0 1 1
         Name = Md5,
         Random                = 4,  // 0 1 0 0
-        Sha1                 = 5 // 0 1 0 1
+        Sha1                 = 5, // 0 1 0 1
+        UnixEpoch        = 7 // 0 1 1 1
     };
 
     enum StringFormat {
@@ -229,6 +231,9 @@ public:
 #endif
 public:
     static QUuid createUuid();
+    static QUuid createUuidV7();
+    static void createUuids(QSpan<QUuid> uuids);
+    static void createUuidsV7(QSpan<QUuid> uuids);
 #if QT_CORE_REMOVED_SINCE(6, 8)
     static QUuid createUuidV3(const QUuid &ns, const QByteArray &baseData) noexcept;
     static QUuid createUuidV5(const QUuid &ns, const QByteArray &baseData) noexcept;
@@ -617,16 +617,19 @@ public:
             char *ptr;
             QByteArray *array;
             QString *string;
+            QByteArrayView *view;
         };
-        enum Type { ByteArray = -1, String = -3, Utf8String = -5 };
+        enum Type { ByteArray = -1, String = -3, Utf8String = -5, View = -7 };
         qsizetype maxlen_or_type;
 
         ReadStringChunk(char *ptr, qsizetype maxlen) : ptr(ptr), maxlen_or_type(maxlen) {}
         ReadStringChunk(QByteArray *array, Type type = ByteArray) : array(array), maxlen_or_type(type) {}
         ReadStringChunk(QString *str) : string(str), maxlen_or_type(String) {}
+        ReadStringChunk(QByteArrayView *view) : view(view), maxlen_or_type(View) {}
         bool isString() const { return maxlen_or_type == String; }
         bool isUtf8String() const { return maxlen_or_type == Utf8String; }
         bool isByteArray() const { return maxlen_or_type == ByteArray; }
+        bool isView() const { return maxlen_or_type == View; }
         bool isPlainPointer() const { return maxlen_or_type >= 0; }
     };
 
@@ -636,6 +639,7 @@ public:
     qsizetype readStringChunk_byte(ReadStringChunk params, qsizetype len);
     qsizetype readStringChunk_unicode(ReadStringChunk params, qsizetype utf8len);
     qsizetype readStringChunk_utf8(ReadStringChunk params, qsizetype utf8len);
+    qsizetype readStringChunk_view(ReadStringChunk params, qsizetype len);
     bool ensureStringIteration();
 };
 
@@ -1030,11 +1034,24 @@ bool QCborStreamReader::next(int maxRecursion)
             r = readStringChunk(&c, 1);
         } while (r.status == Ok);
     } else if (isString()) {
-        // we need to use actual readString so we get UTF-8 validation
-        StringResult<QString> r;
-        do {
-            r = readString();
-        } while (r.status == Ok);
+        if (!d->device) {
+            // in-memory source: validate the UTF-8 in place and skip the
+            // chunk, instead of allocating a QString for data we discard
+            StringResult<QByteArrayView> r;
+            do {
+                r = readStringView();
+                if (r.status == Ok && !QtPrivate::isValidUtf8(r.data)) {
+                    d->handleError(CborErrorInvalidUtf8TextString);
+                    break;
+                }
+            } while (r.status == Ok);
+        } else {
+            // we need to use actual readString so we get UTF-8 validation
+            StringResult<QString> r;
+            do {
+                r = readString();
+            } while (r.status == Ok);
+        }
     } else {
         // fixed types
         CborError err = cbor_value_advance_fixed(&d->currentElement);
@@ -1394,6 +1411,75 @@ QCborStreamReader::StringResult<QByteArray> QCborStreamReader::_readByteArray_he
     return result;
 }
 
+/*!
+   \fn QCborStreamReader::StringResult<QByteArrayView> QCborStreamReader::readStringView()
+   \since 6.9
+
+   Decodes one string chunk from the CBOR string and returns a view to its
+   UTF-8 contents, without copying the data. This function can only be used if
+   this QCborStreamReader was constructed over contiguous memory (a
+   QByteArray or a plain buffer, possibly memory-mapped); for readers operating
+   on a QIODevice, the internal buffer is transient and this function fails
+   with status \l Error. Like readString(), this function must be called in a
+   loop, even if isLengthKnown() is true.
+
+   The returned view points into the source buffer: it is valid only as long
+   as that buffer is unchanged and this reader is not modified with addData(),
+   setDevice() or clear().
+
+   \note Unlike readString(), this function does not verify that the UTF-8
+   contents are properly formatted, so it does not produce the
+   QCborError::InvalidUtf8String error.
+
+   \include qcborstreamreader.cpp string-no-type-conversions
+
+   \sa readString(), readByteArrayView(), readStringChunk(), isString()
+ */
+QCborStreamReader::StringResult<QByteArrayView> QCborStreamReader::_readStringView_helper()
+{
+    QCborStreamReader::StringResult<QByteArrayView> result;
+    if (d->device) {
+        qWarning("QCborStreamReader: string views require an in-memory source");
+        return result;
+    }
+    auto r = d->readStringChunk(&result.data);
+    result.status = r.status;
+    if (r.status == Error) {
+        result.data = {};
+    } else {
+        Q_ASSERT(r.data == result.data.size());
+        if (r.status == EndOfString && lastError() == QCborError::NoError)
+            preparse();
+    }
+
+    return result;
+}
+
+/*!
+   \fn QCborStreamReader::StringResult<QByteArrayView> QCborStreamReader::readByteArrayView()
+   \since 6.9
+
+   Decodes one byte array chunk from the CBOR stream and returns a view to its
+   contents, without copying the data. This function can only be used if this
+   QCborStreamReader was constructed over contiguous memory (a QByteArray or a
+   plain buffer, possibly memory-mapped); for readers operating on a QIODevice,
+   the internal buffer is transient and this function fails with status
+   \l Error. Like readByteArray(), this function must be called in a loop,
+   even if isLengthKnown() is true.
+
+   The returned view points into the source buffer: it is valid only as long
+   as that buffer is unchanged and this reader is not modified with addData(),
+   setDevice() or clear().
+
+   \include qcborstreamreader.cpp bytearray-no-type-conversions
+
+   \sa readByteArray(), readStringView(), readStringChunk(), isByteArray()
+ */
+QCborStreamReader::StringResult<QByteArrayView> QCborStreamReader::_readByteArrayView_helper()
+{
+    return _readStringView_helper();
+}
+
 /*!
     \fn qsizetype QCborStreamReader::currentStringChunkSize() const
 
@@ -1688,6 +1774,9 @@ QCborStreamReaderPrivate::readStringChunk(ReadStringChunk params)
         result.data = readStringChunk_unicode(params, qsizetype(len));
     } else if (params.isUtf8String()) {
         result.data = readStringChunk_utf8(params, qsizetype(len));
+    } else if (params.isView()) {
+        // readStringView() or readByteArrayView()
+        result.data = readStringChunk_view(params, qsizetype(len));
     } else {
         // readByteArray() or readStringChunk()
         result.data = readStringChunk_byte(params, qsizetype(len));
@@ -1835,6 +1924,16 @@ QCborStreamReaderPrivate::readStringChunk_unicode(ReadStringChunk params, qsizet
     return size - currentSize;  // how many bytes we added
 }
 
+inline qsizetype
+QCborStreamReaderPrivate::readStringChunk_view(ReadStringChunk params, qsizetype len)
+{
+    // Only used for memory-based readers, where the whole chunk is contiguous
+    // in the source buffer; the caller has checked there's no device.
+    Q_ASSERT(!device);
+    *params.view = QByteArrayView(buffer.constData() + bufferStart, len);
+    return len;
+}
+
 inline qsizetype
 QCborStreamReaderPrivate::readStringChunk_utf8(ReadStringChunk params, qsizetype utf8len)
 {
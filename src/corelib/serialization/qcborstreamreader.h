@@ -5,6 +5,7 @@
 #define QCBORSTREAMREADER_H
 
 #include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
 #include <QtCore/qcborcommon.h>
 #include <QtCore/qfloat16.h>
 #include <QtCore/qscopedpointer.h>
@@ -129,6 +130,10 @@ public:
     StringResult<QString> readString()      { Q_ASSERT(isString()); return _readString_helper(); }
     StringResult<QByteArray> readUtf8String() { Q_ASSERT(isString()); return _readUtf8String_helper(); }
     StringResult<QByteArray> readByteArray(){ Q_ASSERT(isByteArray()); return _readByteArray_helper(); }
+    StringResult<QByteArrayView> readStringView()
+    { Q_ASSERT(isString()); return _readStringView_helper(); }
+    StringResult<QByteArrayView> readByteArrayView()
+    { Q_ASSERT(isByteArray()); return _readByteArrayView_helper(); }
     qsizetype currentStringChunkSize() const{ Q_ASSERT(isString() || isByteArray()); return _currentStringChunkSize(); }
     StringResult<qsizetype> readStringChunk(char *ptr, qsizetype maxlen);
 
@@ -177,6 +182,8 @@ private:
     StringResult<QString> _readString_helper();
     StringResult<QByteArray> _readUtf8String_helper();
     StringResult<QByteArray> _readByteArray_helper();
+    StringResult<QByteArrayView> _readStringView_helper();
+    StringResult<QByteArrayView> _readByteArrayView_helper();
     qsizetype _currentStringChunkSize() const;
     bool _readAndAppendToString_helper(QString &);
     bool _readAndAppendToUtf8String_helper(QByteArray &);
@@ -7,11 +7,13 @@
 #if !defined(QT_NO_DATASTREAM) || defined(QT_BOOTSTRAPPED)
 #include "qbuffer.h"
 #include "qfloat16.h"
+#include "qlist.h"
 #include "qstring.h"
 #include <stdio.h>
 #include <ctype.h>
 #include <stdlib.h>
 #include "qendian.h"
+#include "qnumeric.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -253,20 +255,31 @@ constexpr quint32 QDataStream::ExtendedSize;
 
 #undef  CHECK_STREAM_PRECOND
 #ifndef QT_NO_DEBUG
+// reads may also be served from an in-memory view (QByteArrayView constructor)
 #define CHECK_STREAM_PRECOND(retVal) \
+    if (!dev && !hasDataView()) { \
+        qWarning("QDataStream: No device"); \
+        return retVal; \
+    }
+// writes always need a device; view-backed streams are read-only
+#define CHECK_STREAM_DEVICE_PRECOND(retVal) \
     if (!dev) { \
         qWarning("QDataStream: No device"); \
         return retVal; \
     }
 #else
 #define CHECK_STREAM_PRECOND(retVal) \
+    if (!dev && !hasDataView()) { \
+        return retVal; \
+    }
+#define CHECK_STREAM_DEVICE_PRECOND(retVal) \
     if (!dev) { \
         return retVal; \
     }
 #endif
 
 #define CHECK_STREAM_WRITE_PRECOND(retVal) \
-    CHECK_STREAM_PRECOND(retVal) \
+    CHECK_STREAM_DEVICE_PRECOND(retVal) \
     if (q_status != Ok) \
         return retVal;
 
@@ -276,6 +289,14 @@ constexpr quint32 QDataStream::ExtendedSize;
         return retVal; \
     }
 
+/*!
+    \internal
+*/
+inline bool QDataStream::hasDataView() const
+{
+    return d && !d->view.isNull();
+}
+
 /*!
     Constructs a data stream that has no I/O device.
 
@@ -341,6 +362,29 @@ QDataStream::QDataStream(const QByteArray &a)
     owndev = true;
 }
 
+/*!
+    \since 6.9
+
+    Constructs a read-only data stream that reads directly from the memory
+    referenced by \a data.
+
+    Unlike the constructor taking a QByteArray, no QBuffer is created
+    internally: device() returns \nullptr and every read is served straight
+    from the view's memory, without going through the QIODevice layer. The
+    caller must ensure the data referenced by \a data stays valid and
+    unmodified for the lifetime of the stream.
+
+    The stream is read-only: attempting to write to it behaves as if no
+    device was set.
+
+    \sa setByteArrayAliasingEnabled()
+*/
+QDataStream::QDataStream(QByteArrayView data)
+    : d(new QDataStreamPrivate)
+{
+    d->view = data;
+}
+
 /*!
     Destroys the data stream.
 
@@ -382,6 +426,12 @@ void QDataStream::setDevice(QIODevice *d)
         owndev = false;
     }
     dev = d;
+    if (this->d) {
+        // a device replaces a QByteArrayView source, if any
+        this->d->view = {};
+        this->d->viewPos = 0;
+        this->d->viewTransactionPos = -1;
+    }
 }
 
 /*!
@@ -389,14 +439,17 @@ void QDataStream::setDevice(QIODevice *d)
 
     Returns \c true if the I/O device has reached the end position (end of
     the stream or file) or if there is no I/O device set; otherwise
-    returns \c false.
+    returns \c false. For a stream constructed from a QByteArrayView,
+    returns \c true once the whole view has been consumed.
 
     \sa QIODevice::atEnd()
 */
 
 bool QDataStream::atEnd() const
 {
-    return dev ? dev->atEnd() : true;
+    if (!dev)
+        return hasDataView() ? d->viewPos >= d->view.size() : true;
+    return dev->atEnd();
 }
 
 /*!
@@ -499,6 +552,44 @@ void QDataStream::setByteOrder(ByteOrder bo)
         noswap = (bo == LittleEndian);
 }
 
+/*!
+    \since 6.9
+
+    If \a enabled is \c true and this stream reads from in-memory data (it
+    was constructed from a QByteArrayView), extracting a QByteArray makes it
+    alias the stream's source instead of copying the bytes out of it. The
+    resulting byte arrays are only valid as long as the original source data
+    is; modifying them detaches them from the source first.
+
+    This option has no effect on streams that read from a QIODevice.
+
+    The default is \c false.
+
+    \sa byteArrayAliasingEnabled(), QByteArray::fromRawData()
+*/
+void QDataStream::setByteArrayAliasingEnabled(bool enabled)
+{
+    if (!d) {
+        if (!enabled)
+            return;
+        d.reset(new QDataStreamPrivate);
+    }
+    d->aliasedReads = enabled;
+}
+
+/*!
+    \since 6.9
+
+    Returns \c true if QByteArray extraction may alias the stream's source
+    instead of copying from it.
+
+    \sa setByteArrayAliasingEnabled()
+*/
+bool QDataStream::byteArrayAliasingEnabled() const
+{
+    return d && d->aliasedReads;
+}
+
 
 /*!
     \enum QDataStream::Version
@@ -622,7 +713,10 @@ void QDataStream::startTransaction()
     CHECK_STREAM_PRECOND(Q_VOID)
 
     if (++transactionDepth == 1) {
-        dev->startTransaction();
+        if (dev)
+            dev->startTransaction();
+        else
+            d->viewTransactionPos = d->viewPos; // random access: remember the position
         resetStatus();
     }
 }
@@ -654,10 +748,16 @@ bool QDataStream::commitTransaction()
         CHECK_STREAM_PRECOND(false)
 
         if (q_status == ReadPastEnd) {
-            dev->rollbackTransaction();
+            if (dev)
+                dev->rollbackTransaction();
+            else
+                d->viewPos = std::exchange(d->viewTransactionPos, -1);
             return false;
         }
-        dev->commitTransaction();
+        if (dev)
+            dev->commitTransaction();
+        else
+            d->viewTransactionPos = -1;
     }
     return q_status == Ok;
 }
@@ -694,6 +794,13 @@ void QDataStream::rollbackTransaction()
         return;
 
     CHECK_STREAM_PRECOND(Q_VOID)
+    if (!dev) {
+        if (q_status == ReadPastEnd)
+            d->viewPos = std::exchange(d->viewTransactionPos, -1);
+        else
+            d->viewTransactionPos = -1;
+        return;
+    }
     if (q_status == ReadPastEnd)
         dev->rollbackTransaction();
     else
@@ -730,6 +837,10 @@ void QDataStream::abortTransaction()
         return;
 
     CHECK_STREAM_PRECOND(Q_VOID)
+    if (!dev) {
+        d->viewTransactionPos = -1;
+        return;
+    }
     dev->commitTransaction();
 }
 
@@ -738,7 +849,9 @@ void QDataStream::abortTransaction()
 */
 bool QDataStream::isDeviceTransactionStarted() const
 {
-   return dev && dev->isTransactionStarted();
+   if (!dev)
+       return d && d->viewTransactionPos >= 0;
+   return dev->isTransactionStarted();
 }
 
 /*****************************************************************************
@@ -752,15 +865,79 @@ bool QDataStream::isDeviceTransactionStarted() const
 qint64 QDataStream::readBlock(char *data, qint64 len)
 {
     // Disable reads on failure in transacted stream
-    if (q_status != Ok && dev->isTransactionStarted())
+    if (q_status != Ok && isDeviceTransactionStarted())
         return -1;
 
-    const qint64 readResult = dev->read(data, len);
+    const qint64 readResult = dev ? dev->read(data, len) : d->read(data, len);
     if (readResult != len)
         setStatus(ReadPastEnd);
     return readResult;
 }
 
+/*!
+    \internal
+
+    Reads \a count elements of \a wordSize bytes each into \a data as a
+    single block, byte-swapping each element in place if the serialized byte
+    order differs from the host's. Returns \c false if the stream ends
+    prematurely. Used by the container fast path for fixed-width element
+    types.
+*/
+bool QDataStream::readFixedWidthBlock(void *data, qsizetype count, qsizetype wordSize)
+{
+    if (count == 0)
+        return true;
+    CHECK_STREAM_PRECOND(false)
+
+    qint64 len;
+    if (qMulOverflow(qint64(count), qint64(wordSize), &len)) {
+        setStatus(SizeLimitExceeded);
+        return false;
+    }
+    if (readBlock(static_cast<char *>(data), len) != len)
+        return false;       // readBlock() has set ReadPastEnd
+
+    if (!noswap) {
+        switch (wordSize) {
+        case 1:
+            break;
+        case 2:
+            qbswap<2>(data, count, data);
+            break;
+        case 4:
+            qbswap<4>(data, count, data);
+            break;
+        case 8:
+            qbswap<8>(data, count, data);
+            break;
+        }
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Serves the content part of a QByteArray extraction directly from the
+    in-memory view, making \a ba alias the source instead of copying \a len
+    bytes out of it. Returns \c false if this stream does not read from a
+    view or aliasing was not enabled, in which case the caller must copy.
+*/
+bool QDataStream::readBytesAliased(QByteArray &ba, qsizetype len)
+{
+    if (dev || !d || !d->aliasedReads || !hasDataView())
+        return false;
+
+    if (d->view.size() - d->viewPos < len) {
+        d->viewPos = d->view.size();
+        setStatus(ReadPastEnd);
+    } else {
+        ba = QByteArray::fromRawData(d->view.data() + d->viewPos, len);
+        d->viewPos += len;
+    }
+    return true;
+}
+
 /*!
     \fn QDataStream &QDataStream::operator>>(std::nullptr_t &ptr)
     \since 5.9
@@ -1087,7 +1264,8 @@ QDataStream &QDataStream::readBytes(char *&s, qint64 &l)
         return *this;
     }
 
-    qsizetype step = (dev->bytesAvailable() >= len) ? len : 1024 * 1024;
+    const qint64 available = dev ? dev->bytesAvailable() : d->bytesAvailable();
+    qsizetype step = (available >= len) ? len : 1024 * 1024;
     qsizetype allocated = 0;
     std::unique_ptr<char[]> curBuf = nullptr;
 
@@ -1435,10 +1613,10 @@ qint64 QDataStream::writeRawData(const char *s, qint64 len)
 qint64 QDataStream::skipRawData(qint64 len)
 {
     CHECK_STREAM_PRECOND(-1)
-    if (q_status != Ok && dev->isTransactionStarted())
+    if (q_status != Ok && isDeviceTransactionStarted())
         return -1;
 
-    const qint64 skipResult = dev->skip(len);
+    const qint64 skipResult = dev ? dev->skip(len) : d->skip(len);
     if (skipResult != len)
         setStatus(ReadPastEnd);
     return skipResult;
@@ -1456,6 +1634,202 @@ qint64 QDataStream::skipRawData(qint64 len)
     \sa {Serializing Qt Data Types}
 */
 
+/*!
+    \class QDataStreamIndex
+    \inmodule QtCore
+    \ingroup qtserialization
+    \since 6.9
+
+    \brief The QDataStreamIndex class provides random access to the
+    top-level entries of a QDataStream snapshot.
+
+    A QDataStream is strictly sequential: to read the n-th entry of a
+    serialized file, everything before it must be deserialized too.
+    QDataStreamIndex removes that restriction for files that consist of a
+    sequence of independent top-level entries, such as application state
+    snapshots, by appending a table of entry offsets to the end of the file.
+
+    When writing, call recordEntry() just before serializing each entry and
+    write() once after the last one:
+
+    \code
+        QDataStream out(&file);
+        QDataStreamIndex index;
+        for (const Entry &entry : entries) {
+            index.recordEntry(out);
+            out << entry;
+        }
+        index.write(out);
+    \endcode
+
+    When reading, read() locates and loads the table from the end of the
+    file without touching the entries, after which seekToEntry() positions
+    the stream on any entry directly, so only the entries that are actually
+    needed get deserialized:
+
+    \code
+        QDataStream in(&file);
+        QDataStreamIndex index;
+        if (index.read(in) && index.seekToEntry(in, i))
+            in >> entry;
+    \endcode
+
+    The index stores byte offsets only; it does not describe what each entry
+    contains. Applications that need keyed lookup typically serialize a
+    key-to-entry-number table as their first entry.
+
+    The table is written with the stream's byte order, so it must be read
+    back with the same stream settings used to write it. Reading requires a
+    device that supports random access; sequential devices such as sockets
+    cannot be indexed.
+
+    \sa QDataStream
+*/
+
+class QDataStreamIndexPrivate
+{
+public:
+    QList<qint64> offsets;
+};
+
+// The trailer is count offsets, the count and the magic, all written through
+// the stream's own operators: [qint64 * count][qint64 count][quint32 magic]
+static constexpr quint32 QDataStreamIndexMagic = 0x51445349; // "QDSI"
+static constexpr qint64 QDataStreamIndexTrailerSize = sizeof(qint64) + sizeof(quint32);
+
+/*!
+    Constructs an empty index.
+*/
+QDataStreamIndex::QDataStreamIndex()
+    : d(new QDataStreamIndexPrivate)
+{
+}
+
+/*!
+    Destroys the index.
+*/
+QDataStreamIndex::~QDataStreamIndex()
+    = default;
+
+/*!
+    Removes all recorded entries.
+*/
+void QDataStreamIndex::clear()
+{
+    d->offsets.clear();
+}
+
+/*!
+    Records the current position of \a stream's device as the start of the
+    next top-level entry. Call this immediately before serializing each
+    entry.
+
+    \sa write()
+*/
+void QDataStreamIndex::recordEntry(const QDataStream &stream)
+{
+    if (QIODevice *dev = stream.device())
+        d->offsets.append(dev->pos());
+}
+
+/*!
+    Appends the table of recorded entry offsets to \a stream. Call this once,
+    after the last entry has been serialized. Returns \c true if the table
+    was written successfully.
+
+    \sa recordEntry(), read()
+*/
+bool QDataStreamIndex::write(QDataStream &stream) const
+{
+    for (qint64 offset : std::as_const(d->offsets))
+        stream << offset;
+    stream << qint64(d->offsets.size());
+    stream << QDataStreamIndexMagic;
+    return stream.status() == QDataStream::Ok;
+}
+
+/*!
+    Loads the table of entry offsets from the end of \a stream's device,
+    replacing any recorded entries, and returns \c true on success. The
+    entries themselves are not read.
+
+    Returns \c false if the device does not support random access or does
+    not end in an index written by write(); the index is left empty in that
+    case.
+
+    \sa write(), seekToEntry()
+*/
+bool QDataStreamIndex::read(QDataStream &stream)
+{
+    d->offsets.clear();
+
+    QIODevice *dev = stream.device();
+    if (!dev || dev->isSequential())
+        return false;
+    const qint64 size = dev->size();
+    if (size < QDataStreamIndexTrailerSize || !dev->seek(size - QDataStreamIndexTrailerSize))
+        return false;
+    stream.resetStatus();
+
+    qint64 count;
+    quint32 magic;
+    stream >> count >> magic;
+    if (stream.status() != QDataStream::Ok || magic != QDataStreamIndexMagic || count < 0
+            || count > (size - QDataStreamIndexTrailerSize) / qint64(sizeof(qint64))) {
+        return false;
+    }
+
+    const qint64 tableStart = size - QDataStreamIndexTrailerSize - count * qint64(sizeof(qint64));
+    if (!dev->seek(tableStart))
+        return false;
+    d->offsets.reserve(count);
+    for (qint64 i = 0; i < count; ++i) {
+        qint64 offset;
+        stream >> offset;
+        if (stream.status() != QDataStream::Ok || offset < 0 || offset > tableStart) {
+            d->offsets.clear();
+            return false;
+        }
+        d->offsets.append(offset);
+    }
+    return true;
+}
+
+/*!
+    Returns the number of recorded entries.
+*/
+qsizetype QDataStreamIndex::count() const
+{
+    return d->offsets.size();
+}
+
+/*!
+    Returns the byte offset of the entry at \a index, or -1 if \a index is
+    out of range.
+*/
+qint64 QDataStreamIndex::offset(qsizetype index) const
+{
+    return index >= 0 && index < d->offsets.size() ? d->offsets.at(index) : -1;
+}
+
+/*!
+    Positions \a stream's device on the entry at \a index and resets the
+    stream's status, so the entry can be deserialized directly. Returns
+    \c true on success.
+
+    \sa offset(), read()
+*/
+bool QDataStreamIndex::seekToEntry(QDataStream &stream, qsizetype index) const
+{
+    QIODevice *dev = stream.device();
+    if (!dev || index < 0 || index >= d->offsets.size())
+        return false;
+    if (!dev->seek(d->offsets.at(index)))
+        return false;
+    stream.resetStatus();
+    return true;
+}
+
 QT_END_NAMESPACE
 
 #endif // QT_NO_DATASTREAM
@@ -22,6 +22,7 @@ QT_BEGIN_NAMESPACE
 class qfloat16;
 #endif
 class QByteArray;
+class QByteArrayView;
 class QDataStream;
 class QIODevice;
 class QString;
@@ -117,6 +118,7 @@ public:
     explicit QDataStream(QIODevice *);
     QDataStream(QByteArray *, OpenMode flags);
     QDataStream(const QByteArray &);
+    explicit QDataStream(QByteArrayView data);
     ~QDataStream();
 
     QIODevice *device() const;
@@ -136,6 +138,9 @@ public:
     ByteOrder byteOrder() const;
     void setByteOrder(ByteOrder);
 
+    void setByteArrayAliasingEnabled(bool enabled);
+    bool byteArrayAliasingEnabled() const;
+
     int version() const;
     void setVersion(int);
 
@@ -235,6 +240,9 @@ private:
     int readBlock(char *data, int len);
 #endif
     qint64 readBlock(char *data, qint64 len);
+    bool readFixedWidthBlock(void *data, qsizetype count, qsizetype wordSize);
+    bool hasDataView() const;
+    bool readBytesAliased(QByteArray &ba, qsizetype len);
     static inline qint64 readQSizeType(QDataStream &s);
     static inline bool writeQSizeType(QDataStream &s, qint64 value);
     static constexpr quint32 NullCode = 0xffffffffu;
@@ -260,6 +268,29 @@ private:
                                                                   const Container &c);
 };
 
+class QDataStreamIndexPrivate;
+class Q_CORE_EXPORT QDataStreamIndex
+{
+public:
+    QDataStreamIndex();
+    ~QDataStreamIndex();
+    Q_DISABLE_COPY(QDataStreamIndex)
+
+    void clear();
+
+    void recordEntry(const QDataStream &stream);
+    bool write(QDataStream &stream) const;
+
+    bool read(QDataStream &stream);
+
+    qsizetype count() const;
+    qint64 offset(qsizetype index) const;
+    bool seekToEntry(QDataStream &stream, qsizetype index) const;
+
+private:
+    QScopedPointer<QDataStreamIndexPrivate> d;
+};
+
 namespace QtPrivate {
 
 class StreamStateSaver
@@ -284,6 +315,22 @@ private:
     QDataStream::Status oldStatus;
 };
 
+// Integral element types other than bool are serialized as their exact
+// in-memory representation, modulo byte order, so whole arrays of them can be
+// read with a single block read instead of one device access per element.
+template <typename T>
+constexpr bool isFixedWidthStreamable =
+        std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+// Detects resize() and contiguous data() so the bulk path below can read
+// straight into the container's storage.
+template <typename Container, typename = void>
+struct IsContiguousResizableContainer : std::false_type {};
+template <typename Container>
+struct IsContiguousResizableContainer<Container, std::void_t<
+        decltype(std::declval<Container &>().resize(qsizetype(0))),
+        decltype(std::declval<Container &>().data())>> : std::true_type {};
+
 template <typename Container>
 QDataStream &readArrayBasedContainer(QDataStream &s, Container &c)
 {
@@ -296,6 +343,16 @@ QDataStream &readArrayBasedContainer(QDataStream &s, Container &c)
         s.setStatus(QDataStream::SizeLimitExceeded);
         return s;
     }
+    using T = typename Container::value_type;
+    if constexpr (isFixedWidthStreamable<T> && IsContiguousResizableContainer<Container>::value) {
+        // 64-bit integers were serialized as two 32-bit halves before Qt_3_3
+        if (sizeof(T) != 8 || s.version() >= QDataStream::Qt_3_3) {
+            c.resize(n);
+            if (!s.readFixedWidthBlock(c.data(), n, qsizetype(sizeof(T))))
+                c.clear();
+            return s;
+        }
+    }
     c.reserve(n);
     for (qsizetype i = 0; i < n; ++i) {
         typename Container::value_type t;
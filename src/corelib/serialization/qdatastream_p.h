@@ -16,14 +16,44 @@
 //
 
 #include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbytearrayview.h>
 #include <qdatastream.h>
 
+#include <string.h>
+
 QT_BEGIN_NAMESPACE
 
 #if !defined(QT_NO_DATASTREAM) || defined(QT_BOOTSTRAPPED)
 class QDataStreamPrivate
 {
 public:
+    // In-memory source for a stream constructed from a QByteArrayView. Reads
+    // are served straight from the view, with no QIODevice in between.
+    QByteArrayView view;
+    qsizetype viewPos = 0;
+    qsizetype viewTransactionPos = -1;  // restore point of the outermost transaction
+    bool aliasedReads = false;
+
+    qint64 bytesAvailable() const
+    {
+        return view.size() - viewPos;
+    }
+
+    qint64 read(char *data, qint64 len)
+    {
+        const qint64 n = qMin(len, bytesAvailable());
+        if (n > 0)
+            memcpy(data, view.data() + viewPos, n);
+        viewPos += n;
+        return n;
+    }
+
+    qint64 skip(qint64 len)
+    {
+        const qint64 n = qMin(len, bytesAvailable());
+        viewPos += n;
+        return n;
+    }
 };
 #endif
 
@@ -271,6 +271,30 @@ QByteArray QJsonDocument::toJson(JsonFormat format) const
 
     return json;
 }
+
+/*!
+    \since 6.9
+    Writes the document as a UTF-8 encoded JSON document in the provided
+    \a format to \a device.
+
+    Unlike toJson(), the text is written out in chunks as it is produced, so
+    the full document never needs to be held in memory at once.
+
+    Returns \c true on success; returns \c false if the document is null or
+    writing to the device failed.
+
+    \sa toJson(), fromJson(), JsonFormat
+ */
+bool QJsonDocument::writeTo(QIODevice *device, JsonFormat format) const
+{
+    if (!d || !device)
+        return false;
+
+    const QCborContainerPrivate *container = QJsonPrivate::Value::container(d->value);
+    if (d->value.isArray())
+        return QJsonPrivate::Writer::arrayToJson(container, device, 0, (format == Compact));
+    return QJsonPrivate::Writer::objectToJson(container, device, 0, (format == Compact));
+}
 #endif
 
 /*!
@@ -14,6 +14,7 @@ QT_BEGIN_NAMESPACE
 
 class QDebug;
 class QCborValue;
+class QIODevice;
 
 namespace QJsonPrivate { class Parser; }
 
@@ -83,6 +84,7 @@ public:
 
 #if !defined(QT_JSON_READONLY) || defined(Q_QDOC)
     QByteArray toJson(JsonFormat format = Indented) const;
+    bool writeTo(QIODevice *device, JsonFormat format = Indented) const;
 #endif
 
     bool isEmpty() const;
@@ -11,8 +11,15 @@
 #include "private/qstringconverter_p.h"
 #include "private/qcborvalue_p.h"
 #include "private/qnumeric_p.h"
+#include <private/qsimd_p.h>
 #include <private/qtools_p.h>
 
+#include <QtCore/qalgorithms.h>
+
+#if QT_CONFIG(cborstreamwriter)
+#  include <qcborstreamwriter.h>
+#endif
+
 //#define PARSER_DEBUG
 #ifdef PARSER_DEBUG
 #  error currently broken after `current` was moved to StashedContainer
@@ -244,7 +251,7 @@ enum {
     Quote = 0x22
 };
 
-void Parser::eatBOM()
+static void skipBOM(const char *&json, const char *end)
 {
     // eat UTF-8 byte order mark
     uchar utf8bom[3] = { 0xef, 0xbb, 0xbf };
@@ -255,7 +262,7 @@ void Parser::eatBOM()
         json += 3;
 }
 
-bool Parser::eatSpace()
+static bool skipSpace(const char *&json, const char *end)
 {
     while (json < end) {
         if (*json > Space)
@@ -270,9 +277,9 @@ bool Parser::eatSpace()
     return (json < end);
 }
 
-char Parser::nextToken()
+static char scanToken(const char *&json, const char *end)
 {
-    if (!eatSpace())
+    if (!skipSpace(json, end))
         return 0;
     char token = *json++;
     switch (token) {
@@ -291,6 +298,21 @@ char Parser::nextToken()
     return token;
 }
 
+void Parser::eatBOM()
+{
+    skipBOM(json, end);
+}
+
+bool Parser::eatSpace()
+{
+    return skipSpace(json, end);
+}
+
+char Parser::nextToken()
+{
+    return scanToken(json, end);
+}
+
 /*
     JSON-text = object / array
 */
@@ -437,6 +459,17 @@ static void sortContainer(QCborContainerPrivate *container)
         source.value() = QtCbor::Element();
     };
 
+    // Generated JSON very commonly stores its keys in sorted order already; a
+    // single linear pass detects that, so parsing a huge object doesn't pay
+    // for a stable_sort plus a duplicate scan it doesn't need. Strictly
+    // ascending keys also can't contain duplicates.
+    if (std::adjacent_find(
+                Forward(container->elements.begin()), Forward(container->elements.end()),
+                [&compare](const Value &a, const Value &b) { return compare(a, b) >= 0; })
+            == Forward(container->elements.end())) {
+        return;
+    }
+
     std::stable_sort(
                 Forward(container->elements.begin()), Forward(container->elements.end()),
                 [&compare](const Value &a, const Value &b) { return compare(a, b) < 0; });
@@ -685,10 +718,9 @@ bool Parser::parseValue()
 
 */
 
-bool Parser::parseNumber()
+bool QJsonPrivate::scanJsonNumber(const char *&json, const char *end,
+                                  QJsonParseError::ParseError &lastError, ScannedNumber &number)
 {
-    QT_PARSER_TRACING_BEGIN << "parseNumber" << json;
-
     const char *start = json;
     bool isInt = true;
 
@@ -728,32 +760,42 @@ bool Parser::parseNumber()
         return false;
     }
 
-    const QByteArray number = QByteArray::fromRawData(start, json - start);
-    QT_PARSER_TRACING_DEBUG << "numberstring" << number;
+    const QByteArray digits = QByteArray::fromRawData(start, json - start);
+    QT_PARSER_TRACING_DEBUG << "numberstring" << digits;
 
     if (isInt) {
         bool ok;
-        qlonglong n = number.toLongLong(&ok);
+        number.intValue = digits.toLongLong(&ok);
         if (ok) {
-            container->append(QCborValue(n));
-            QT_PARSER_TRACING_END;
+            number.isInteger = true;
             return true;
         }
     }
 
     bool ok;
-    double d = number.toDouble(&ok);
+    number.doubleValue = digits.toDouble(&ok);
 
     if (!ok) {
         lastError = QJsonParseError::IllegalNumber;
         return false;
     }
 
-    qint64 n;
-    if (convertDoubleTo(d, &n))
-        container->append(QCborValue(n));
+    number.isInteger = convertDoubleTo(number.doubleValue, &number.intValue);
+    return true;
+}
+
+bool Parser::parseNumber()
+{
+    QT_PARSER_TRACING_BEGIN << "parseNumber" << json;
+
+    ScannedNumber number;
+    if (!scanJsonNumber(json, end, lastError, number))
+        return false;
+
+    if (number.isInteger)
+        container->append(QCborValue(number.intValue));
     else
-        container->append(QCborValue(d));
+        container->append(QCborValue(number.doubleValue));
 
     QT_PARSER_TRACING_END;
     return true;
@@ -851,16 +893,69 @@ static inline bool scanUtf8Char(const char *&json, const char *end, char32_t *re
     return true;
 }
 
-bool Parser::parseString()
+/*
+    Fast-forwards \a json over a run of plain string characters: ASCII bytes
+    that are neither the closing quote nor the start of an escape sequence.
+    Such bytes need no per-character work in parseString(), and they are the
+    vast majority of typical JSON payloads, so we classify 16 bytes per
+    iteration. Returns with \a json pointing at the first byte it could not
+    classify that way (or in the < 16 bytes tail), for the scalar loop to
+    examine. SSE2 and NEON are baseline on x86-64 and AArch64 respectively, so
+    no runtime dispatch is needed.
+*/
+static void skipPlainStringChars(const char *&json, const char *end)
+{
+#if defined(__SSE2__)
+    while (end - json >= 16) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(json));
+        __m128i quotes = _mm_cmpeq_epi8(data, _mm_set1_epi8('"'));
+        __m128i backslashes = _mm_cmpeq_epi8(data, _mm_set1_epi8('\\'));
+        // the sign bit of each byte flags non-ASCII
+        uint mask = uint(_mm_movemask_epi8(_mm_or_si128(quotes, backslashes)))
+                | uint(_mm_movemask_epi8(data));
+        if (mask) {
+            json += qCountTrailingZeroBits(mask);
+            return;
+        }
+        json += 16;
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    while (end - json >= 16) {
+        uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t *>(json));
+        uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(data, vdupq_n_u8('"')),
+                                               vceqq_u8(data, vdupq_n_u8('\\'))),
+                                      vcgeq_u8(data, vdupq_n_u8(0x80)));
+        if (vmaxvq_u8(special) != 0)
+            return;     // the scalar loop locates the exact byte
+        json += 16;
+    }
+#else
+    Q_UNUSED(json);
+    Q_UNUSED(end);
+#endif
+}
+
+/*
+    Scans a string, with \a json positioned after the opening quote. On
+    StringScanResult::Utf8 the text had no escape sequences; the validated raw
+    text is the input up to (and excluding) the closing quote and \a isAscii
+    says whether it is 7bit ASCII. On StringScanResult::Utf16, \a ucs4 holds
+    the decoded text. Either way \a json ends up after the closing quote.
+*/
+StringScanResult QJsonPrivate::scanJsonString(const char *&json, const char *end,
+                                              QJsonParseError::ParseError &lastError,
+                                              bool &isAscii, QString &ucs4)
 {
     const char *start = json;
 
     // try to parse a utf-8 string without escape sequences, and note whether it's 7bit ASCII.
 
-    QT_PARSER_TRACING_BEGIN << "parse string" << json;
     bool isUtf8 = true;
-    bool isAscii = true;
+    isAscii = true;
     while (json < end) {
+        skipPlainStringChars(json, end);    // all skipped bytes are ASCII
+        if (json >= end)
+            break;
         char32_t ch = 0;
         if (*json == '"')
             break;
@@ -874,34 +969,27 @@ bool Parser::parseString()
         }
         if (!scanUtf8Char(json, end, &ch)) {
             lastError = QJsonParseError::IllegalUTF8String;
-            return false;
+            return StringScanResult::Error;
         }
         if (ch > 0x7f)
             isAscii = false;
         QT_PARSER_TRACING_DEBUG << "  " << ch << char(ch);
     }
-    ++json;
     QT_PARSER_TRACING_DEBUG << "end of string";
     if (json >= end) {
         lastError = QJsonParseError::UnterminatedString;
-        return false;
+        return StringScanResult::Error;
     }
+    ++json;     // step over the closing quote (or the backslash, when rescanning)
 
     // no escape sequences, we are done
-    if (isUtf8) {
-        if (isAscii)
-            container->appendAsciiString(start, json - start - 1);
-        else
-            container->appendUtf8String(start, json - start - 1);
-        QT_PARSER_TRACING_END;
-        return true;
-    }
+    if (isUtf8)
+        return StringScanResult::Utf8;
 
     QT_PARSER_TRACING_DEBUG << "has escape sequences";
 
     json = start;
 
-    QString ucs4;
     while (json < end) {
         char32_t ch = 0;
         if (*json == '"')
@@ -909,29 +997,329 @@ bool Parser::parseString()
         else if (*json == '\\') {
             if (!scanEscapeSequence(json, end, &ch)) {
                 lastError = QJsonParseError::IllegalEscapeSequence;
-                return false;
+                return StringScanResult::Error;
             }
         } else {
             if (!scanUtf8Char(json, end, &ch)) {
                 lastError = QJsonParseError::IllegalUTF8String;
-                return false;
+                return StringScanResult::Error;
             }
         }
         ucs4.append(QChar::fromUcs4(ch));
     }
-    ++json;
-
     if (json >= end) {
         lastError = QJsonParseError::UnterminatedString;
-        return false;
+        return StringScanResult::Error;
     }
+    ++json;     // step over the closing quote
 
-    container->appendByteData(reinterpret_cast<const char *>(ucs4.constData()), ucs4.size() * 2,
-                              QCborValue::String, QtCbor::Element::StringIsUtf16);
+    return StringScanResult::Utf16;
+}
+
+bool Parser::parseString()
+{
+    QT_PARSER_TRACING_BEGIN << "parse string" << json;
+
+    const char *start = json;
+    bool isAscii = true;
+    QString ucs4;
+    switch (scanJsonString(json, end, lastError, isAscii, ucs4)) {
+    case StringScanResult::Error:
+        return false;
+
+    case StringScanResult::Utf8:
+        if (isAscii)
+            container->appendAsciiString(start, json - start - 1);
+        else
+            container->appendUtf8String(start, json - start - 1);
+        break;
+
+    case StringScanResult::Utf16:
+        container->appendByteData(reinterpret_cast<const char *>(ucs4.constData()),
+                                  ucs4.size() * 2,
+                                  QCborValue::String, QtCbor::Element::StringIsUtf16);
+        break;
+    }
     QT_PARSER_TRACING_END;
     return true;
 }
 
+#if QT_CONFIG(cborstreamwriter)
+
+namespace {
+/*
+    Recursive descent transcoder from JSON text straight to a CBOR stream.
+    The grammar, the limits and the error reporting mirror Parser above, but
+    instead of building up a QCborContainerPrivate tree, each element is
+    emitted to the writer the moment it is scanned.
+*/
+class JsonToCborTranscoder
+{
+public:
+    JsonToCborTranscoder(const char *json, qsizetype length, QCborStreamWriter &writer)
+        : head(json), json(json), writer(writer)
+    {
+        end = json + length;
+    }
+
+    bool transcode(QJsonParseError *error);
+
+private:
+    bool parseObject();
+    bool parseArray();
+    bool parseMember();
+    bool parseString();
+    bool parseValue();
+    bool parseNumber();
+
+    const char *head;
+    const char *json;
+    const char *end;
+    QCborStreamWriter &writer;
+
+    int nestingLevel = 0;
+    QJsonParseError::ParseError lastError = QJsonParseError::NoError;
+};
+} // unnamed namespace
+
+bool JsonToCborTranscoder::transcode(QJsonParseError *error)
+{
+    skipBOM(json, end);
+    char token = scanToken(json, end);
+
+    bool ok;
+    if (token == BeginArray) {
+        ok = parseArray();
+    } else if (token == BeginObject) {
+        ok = parseObject();
+    } else {
+        lastError = QJsonParseError::IllegalValue;
+        ok = false;
+    }
+
+    if (ok) {
+        skipSpace(json, end);
+        if (json < end) {
+            lastError = QJsonParseError::GarbageAtEnd;
+            ok = false;
+        }
+    }
+
+    if (error) {
+        error->offset = ok ? 0 : json - head;
+        error->error = ok ? QJsonParseError::NoError : lastError;
+    }
+    return ok;
+}
+
+bool JsonToCborTranscoder::parseObject()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    writer.startMap();
+
+    char token = scanToken(json, end);
+    while (token == Quote) {
+        if (!parseMember())
+            return false;
+        token = scanToken(json, end);
+        if (token != ValueSeparator)
+            break;
+        token = scanToken(json, end);
+        if (token == EndObject) {
+            lastError = QJsonParseError::MissingObject;
+            return false;
+        }
+    }
+
+    if (token != EndObject) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+
+    --nestingLevel;
+    return writer.endMap();
+}
+
+bool JsonToCborTranscoder::parseMember()
+{
+    if (!parseString())
+        return false;
+    char token = scanToken(json, end);
+    if (token != NameSeparator) {
+        lastError = QJsonParseError::MissingNameSeparator;
+        return false;
+    }
+    if (!skipSpace(json, end)) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+    return parseValue();
+}
+
+bool JsonToCborTranscoder::parseArray()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    writer.startArray();
+
+    if (!skipSpace(json, end)) {
+        lastError = QJsonParseError::UnterminatedArray;
+        return false;
+    }
+    if (*json == EndArray) {
+        scanToken(json, end);
+    } else {
+        while (1) {
+            if (!skipSpace(json, end)) {
+                lastError = QJsonParseError::UnterminatedArray;
+                return false;
+            }
+            if (!parseValue())
+                return false;
+            char token = scanToken(json, end);
+            if (token == EndArray)
+                break;
+            else if (token != ValueSeparator) {
+                if (!skipSpace(json, end))
+                    lastError = QJsonParseError::UnterminatedArray;
+                else
+                    lastError = QJsonParseError::MissingValueSeparator;
+                return false;
+            }
+        }
+    }
+
+    --nestingLevel;
+    return writer.endArray();
+}
+
+bool JsonToCborTranscoder::parseValue()
+{
+    switch (*json++) {
+    case 'n':
+        if (end - json < 4) {
+            lastError = QJsonParseError::IllegalValue;
+            return false;
+        }
+        if (*json++ == 'u' &&
+            *json++ == 'l' &&
+            *json++ == 'l') {
+            writer.append(nullptr);
+            return true;
+        }
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case 't':
+        if (end - json < 4) {
+            lastError = QJsonParseError::IllegalValue;
+            return false;
+        }
+        if (*json++ == 'r' &&
+            *json++ == 'u' &&
+            *json++ == 'e') {
+            writer.append(true);
+            return true;
+        }
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case 'f':
+        if (end - json < 5) {
+            lastError = QJsonParseError::IllegalValue;
+            return false;
+        }
+        if (*json++ == 'a' &&
+            *json++ == 'l' &&
+            *json++ == 's' &&
+            *json++ == 'e') {
+            writer.append(false);
+            return true;
+        }
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case Quote:
+        return parseString();
+    case BeginArray:
+        return parseArray();
+    case BeginObject:
+        return parseObject();
+    case ValueSeparator:
+        // Essentially missing value, but after a colon, not after a comma
+        // like the other MissingObject errors.
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case EndObject:
+    case EndArray:
+        lastError = QJsonParseError::MissingObject;
+        return false;
+    default:
+        --json;
+        return parseNumber();
+    }
+}
+
+bool JsonToCborTranscoder::parseNumber()
+{
+    ScannedNumber number;
+    if (!scanJsonNumber(json, end, lastError, number))
+        return false;
+
+    if (number.isInteger)
+        writer.append(number.intValue);
+    else
+        writer.append(number.doubleValue);
+    return true;
+}
+
+bool JsonToCborTranscoder::parseString()
+{
+    const char *start = json;
+    bool isAscii = true;
+    QString ucs4;
+    switch (scanJsonString(json, end, lastError, isAscii, ucs4)) {
+    case StringScanResult::Error:
+        return false;
+
+    case StringScanResult::Utf8:
+        // no escape sequences and already validated; emit straight from the
+        // input text
+        writer.appendTextString(start, json - start - 1);
+        return true;
+
+    case StringScanResult::Utf16:
+        writer.append(QStringView(ucs4));
+        return true;
+    }
+    Q_UNREACHABLE_RETURN(false);
+}
+
+/*
+    \internal
+
+    Parses the JSON text in \a json and emits each element straight to
+    \a writer as it is scanned, using O(depth) memory instead of building an
+    intermediate document. Unlike the document parser, map keys keep their
+    input order and duplicated keys are all emitted.
+
+    Returns false on a parse error, which is reported through \a error just
+    like QJsonDocument::fromJson() does; the writer may have received part of
+    the document by then.
+*/
+bool QJsonPrivate::transcodeJsonToCbor(QByteArrayView json, QCborStreamWriter &writer,
+                                       QJsonParseError *error)
+{
+    JsonToCborTranscoder transcoder(json.constData(), json.size(), writer);
+    return transcoder.transcode(error);
+}
+
+#endif // QT_CONFIG(cborstreamwriter)
+
 QT_END_NAMESPACE
 
 #undef QT_PARSER_TRACING_BEGIN
@@ -21,6 +21,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QCborStreamWriter;
+
 namespace QJsonPrivate {
 
 class Parser
@@ -50,6 +52,30 @@ private:
     QExplicitlySharedDataPointer<QCborContainerPrivate> container;
 };
 
+#if QT_CONFIG(cborstreamwriter)
+// Parses JSON text and emits each element straight to \a writer, without
+// building an intermediate document and using only O(depth) memory. Parse
+// errors are reported like QJsonDocument::fromJson() does.
+Q_CORE_EXPORT bool transcodeJsonToCbor(QByteArrayView json, QCborStreamWriter &writer,
+                                       QJsonParseError *error = nullptr);
+#endif
+
+// Lexing helpers shared between the document parser, the CBOR transcoder
+// and QJsonStreamReader. Both scanners expect the full lexeme to be present
+// in [json, end).
+struct ScannedNumber {
+    qint64 intValue = 0;
+    double doubleValue = 0.;
+    bool isInteger = false;
+};
+enum class StringScanResult { Error, Utf8, Utf16 };
+
+bool scanJsonNumber(const char *&json, const char *end,
+                    QJsonParseError::ParseError &lastError, ScannedNumber &number);
+StringScanResult scanJsonString(const char *&json, const char *end,
+                                QJsonParseError::ParseError &lastError,
+                                bool &isAscii, QString &ucs4);
+
 }
 
 QT_END_NAMESPACE
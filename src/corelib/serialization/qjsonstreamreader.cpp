@@ -0,0 +1,600 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonstreamreader.h"
+#include "qjsonparser_p.h"
+
+#ifndef QT_BOOTSTRAPPED
+#include <qcoreapplication.h>
+#endif
+#include <QtCore/qvarlengtharray.h>
+#include <private/qtools_p.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QtMiscUtils;
+
+// same limit as the document parser applies
+static const int nestingLimit = 1024;
+
+class QJsonStreamReaderPrivate
+{
+public:
+    QByteArray buffer;
+    qsizetype pos = 0;      // scan position; everything before it is consumed
+    qint64 basePos = 0;     // stream offset of the buffer's first byte
+
+    // one entry per open container, true for objects
+    QVarLengthArray<bool, 64> containers;
+
+    enum class State : quint8 {
+        Start,          // expecting the '{' or '[' opening a document
+        Value,          // expecting a value
+        ValueOrClose,   // at the first array position: a value or ']'
+        Key,            // expecting a key
+        KeyOrClose,     // at the first object position: a key or '}'
+        Colon,          // expecting the ':' after a key
+        CommaOrClose    // expecting ',' or the container's closing bracket
+    };
+    State state = State::Start;
+    bool pendingEndDocument = false;
+
+    QJsonStreamReader::TokenType token = QJsonStreamReader::NoToken;
+    QJsonStreamReader::Error error = QJsonStreamReader::NoError;
+    QJsonParseError::ParseError detailedError = QJsonParseError::NoError;
+
+    QString textValue;
+    QJsonPrivate::ScannedNumber number;
+    bool boolValue = false;
+
+    QJsonStreamReader::TokenType readNext();
+    bool hasMoreContent() const;
+
+private:
+    QJsonStreamReader::TokenType raiseError(QJsonParseError::ParseError detail);
+    QJsonStreamReader::TokenType prematureEnd();
+    QJsonStreamReader::TokenType openContainer(char bracket);
+    QJsonStreamReader::TokenType closeContainer();
+    QJsonStreamReader::TokenType parseValue(const char *json, const char *end);
+    QJsonStreamReader::TokenType parseStringToken(QJsonStreamReader::TokenType type,
+                                                  State nextState);
+    QJsonStreamReader::TokenType parseNumberToken(const char *json, const char *end);
+};
+
+static bool isJsonSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool QJsonStreamReaderPrivate::hasMoreContent() const
+{
+    for (qsizetype i = pos; i < buffer.size(); ++i) {
+        if (!isJsonSpace(buffer.at(i)))
+            return true;
+    }
+    return false;
+}
+
+QJsonStreamReader::TokenType
+QJsonStreamReaderPrivate::raiseError(QJsonParseError::ParseError detail)
+{
+    error = QJsonStreamReader::NotWellFormedError;
+    detailedError = detail;
+    return token = QJsonStreamReader::Invalid;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::prematureEnd()
+{
+    // recoverable: addData() clears this state and readNext() re-scans the
+    // incomplete token, which was not consumed
+    error = QJsonStreamReader::PrematureEndOfDocumentError;
+    return token = QJsonStreamReader::Invalid;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::openContainer(char bracket)
+{
+    if (containers.size() >= nestingLimit)
+        return raiseError(QJsonParseError::DeepNesting);
+
+    ++pos;
+    const bool isObject = (bracket == '{');
+    containers.append(isObject);
+    state = isObject ? State::KeyOrClose : State::ValueOrClose;
+    return token = isObject ? QJsonStreamReader::StartObject : QJsonStreamReader::StartArray;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::closeContainer()
+{
+    ++pos;
+    const bool wasObject = containers.last();
+    containers.removeLast();
+    if (containers.isEmpty()) {
+        state = State::Start;
+        pendingEndDocument = true;
+    } else {
+        state = State::CommaOrClose;
+    }
+    return token = wasObject ? QJsonStreamReader::EndObject : QJsonStreamReader::EndArray;
+}
+
+QJsonStreamReader::TokenType
+QJsonStreamReaderPrivate::parseStringToken(QJsonStreamReader::TokenType type, State nextState)
+{
+    const char *begin = buffer.constData();
+    const char *end = begin + buffer.size();
+
+    // Locate the closing quote first, so that an incomplete lexeme is told
+    // apart from an ill-formed one. UTF-8 continuation bytes can't be
+    // mistaken for '"' or '\\', so scanning bytes is safe.
+    const char *scan = begin + pos + 1;
+    while (scan < end) {
+        if (*scan == '"')
+            break;
+        if (*scan == '\\') {
+            ++scan;
+            if (scan >= end)
+                break;      // escape sequence truncated at the buffer's end
+        }
+        ++scan;
+    }
+    if (scan >= end)
+        return prematureEnd();
+
+    const char *json = begin + pos + 1;
+    const char *start = json;
+    bool isAscii = true;
+    QString ucs4;
+    QJsonParseError::ParseError scanError = QJsonParseError::NoError;
+    switch (QJsonPrivate::scanJsonString(json, scan + 1, scanError, isAscii, ucs4)) {
+    case QJsonPrivate::StringScanResult::Error:
+        return raiseError(scanError);
+    case QJsonPrivate::StringScanResult::Utf8:
+        textValue = QString::fromUtf8(start, json - start - 1);
+        break;
+    case QJsonPrivate::StringScanResult::Utf16:
+        textValue = std::move(ucs4);
+        break;
+    }
+
+    pos = json - begin;
+    state = nextState;
+    return token = type;
+}
+
+QJsonStreamReader::TokenType
+QJsonStreamReaderPrivate::parseNumberToken(const char *json, const char *end)
+{
+    // The lexeme must be terminated within the buffered data: inside a
+    // container another token always follows, so more data will terminate it.
+    const char *scan = json;
+    while (scan < end && (isAsciiDigit(*scan) || *scan == '-' || *scan == '+' || *scan == '.'
+                          || *scan == 'e' || *scan == 'E')) {
+        ++scan;
+    }
+    if (scan >= end)
+        return prematureEnd();
+
+    const char *begin = buffer.constData();
+    const char *cursor = json;
+    number = {};
+    QJsonParseError::ParseError scanError = QJsonParseError::NoError;
+    if (!QJsonPrivate::scanJsonNumber(cursor, end, scanError, number))
+        return raiseError(scanError);
+
+    pos = cursor - begin;
+    state = State::CommaOrClose;
+    return token = QJsonStreamReader::Number;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::parseValue(const char *json,
+                                                                  const char *end)
+{
+    switch (*json) {
+    case '{':
+    case '[':
+        return openContainer(*json);
+
+    case '"':
+        return parseStringToken(QJsonStreamReader::String, State::CommaOrClose);
+
+    case 't':
+    case 'f':
+    case 'n': {
+        const char *word = *json == 't' ? "true" : *json == 'f' ? "false" : "null";
+        const qsizetype len = *json == 'f' ? 5 : 4;
+        if (end - json < len)
+            return prematureEnd();
+        if (memcmp(json, word, len) != 0)
+            return raiseError(QJsonParseError::IllegalValue);
+        pos += len;
+        state = State::CommaOrClose;
+        if (*json == 'n')
+            return token = QJsonStreamReader::Null;
+        boolValue = (*json == 't');
+        return token = QJsonStreamReader::Bool;
+    }
+
+    case ',':
+        // essentially a missing value, like the document parser reports it
+        return raiseError(QJsonParseError::IllegalValue);
+    case ']':
+    case '}':
+        return raiseError(QJsonParseError::MissingObject);
+
+    default:
+        return parseNumberToken(json, end);
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::readNext()
+{
+    if (error == QJsonStreamReader::NotWellFormedError)
+        return token = QJsonStreamReader::Invalid;
+    error = QJsonStreamReader::NoError;
+    detailedError = QJsonParseError::NoError;
+
+    if (pendingEndDocument) {
+        pendingEndDocument = false;
+        return token = QJsonStreamReader::EndDocument;
+    }
+
+    for (;;) {
+        const char *begin = buffer.constData();
+        const char *json = begin + pos;
+        const char *end = begin + buffer.size();
+        while (json < end && isJsonSpace(*json))
+            ++json;
+        pos = json - begin;
+        if (json >= end) {
+            if (state == State::Start)
+                return token = QJsonStreamReader::NoToken;      // between documents
+            return prematureEnd();
+        }
+
+        const char ch = *json;
+        switch (state) {
+        case State::Start:
+            if (uchar(ch) == 0xef) {    // possibly a UTF-8 byte order mark
+                if (end - json < 3)
+                    return prematureEnd();
+                if (memcmp(json, "\xef\xbb\xbf", 3) != 0)
+                    return raiseError(QJsonParseError::IllegalValue);
+                pos += 3;
+                continue;
+            }
+            if (ch == '{' || ch == '[')
+                return openContainer(ch);
+            // like fromJson(), only objects and arrays can form a document
+            return raiseError(QJsonParseError::IllegalValue);
+
+        case State::Colon:
+            if (ch != ':')
+                return raiseError(QJsonParseError::MissingNameSeparator);
+            ++pos;
+            state = State::Value;
+            continue;
+
+        case State::CommaOrClose:
+            if (ch == ',') {
+                ++pos;
+                state = containers.last() ? State::Key : State::Value;
+                continue;
+            }
+            if (containers.last() ? ch == '}' : ch == ']')
+                return closeContainer();
+            return raiseError(containers.last() ? QJsonParseError::UnterminatedObject
+                                                : QJsonParseError::MissingValueSeparator);
+
+        case State::KeyOrClose:
+            if (ch == '}')
+                return closeContainer();
+            Q_FALLTHROUGH();
+        case State::Key:
+            if (ch == '}')      // only reachable after a comma
+                return raiseError(QJsonParseError::MissingObject);
+            if (ch != '"')
+                return raiseError(QJsonParseError::UnterminatedObject);
+            return parseStringToken(QJsonStreamReader::Name, State::Colon);
+
+        case State::ValueOrClose:
+            if (ch == ']')
+                return closeContainer();
+            Q_FALLTHROUGH();
+        case State::Value:
+            return parseValue(json, end);
+        }
+    }
+}
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \ingroup json
+    \ingroup qtserialization
+    \reentrant
+    \since 6.9
+
+    \brief The QJsonStreamReader class provides an incremental, push-based
+    JSON parser.
+
+    Unlike QJsonDocument::fromJson(), which needs the complete document in
+    one buffer, QJsonStreamReader accepts data in arbitrary chunks as it
+    arrives — from a socket, for example — and reports the document's
+    structure as a stream of tokens, similar to QXmlStreamReader. The memory
+    used is proportional to the nesting depth and the size of the current
+    token, not to the document.
+
+    A typical loop feeds each received chunk with addData() and consumes the
+    tokens that have become available:
+
+    \code
+        QJsonStreamReader reader;
+        while (haveIncomingData()) {
+            reader.addData(nextChunk());
+            while (true) {
+                QJsonStreamReader::TokenType token = reader.readNext();
+                if (token == QJsonStreamReader::Invalid || token == QJsonStreamReader::NoToken)
+                    break;
+                // process the token
+            }
+            if (reader.error() == QJsonStreamReader::NotWellFormedError)
+                break;      // real error; PrematureEndOfDocumentError just
+                            // means more data is needed
+        }
+    \endcode
+
+    When the buffered data ends in the middle of a token, readNext() returns
+    \l Invalid with error() set to \l PrematureEndOfDocumentError. The
+    incomplete token is not consumed: once more data has been added,
+    readNext() resumes with it. All other errors are fatal and readNext()
+    keeps returning \l Invalid.
+
+    Like QJsonDocument::fromJson(), a document must be an object or an
+    array. After the document's closing bracket, readNext() reports
+    \l EndDocument; any further readNext() then starts the next document, so
+    concatenated or newline-delimited JSON streams can be read with a single
+    reader.
+
+    \sa QJsonDocument, QXmlStreamReader, QCborStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum describes the token the reader is positioned on.
+
+    \value NoToken        Nothing has been read yet, or all buffered
+                          documents have been fully read.
+    \value Invalid        An error occurred; see error().
+    \value StartObject    The beginning of an object, i.e. \c {'{'}.
+    \value EndObject      The end of an object, i.e. \c {'}'}.
+    \value StartArray     The beginning of an array, i.e. \c {'['}.
+    \value EndArray       The end of an array, i.e. \c {']'}.
+    \value Name           A key inside an object; its text is available from
+                          text().
+    \value String         A string value; its text is available from text().
+    \value Number         A number value; available from toDouble() or, if
+                          isInteger() is true, toInteger().
+    \value Bool           \c true or \c false; available from toBool().
+    \value Null           The \c null value.
+    \value EndDocument    The document's root container was closed.
+*/
+
+/*!
+    \enum QJsonStreamReader::Error
+
+    This enum describes the errors the reader can report.
+
+    \value NoError                      No error has occurred.
+    \value NotWellFormedError           The data is not well-formed JSON.
+                                        This error is fatal.
+    \value PrematureEndOfDocumentError  The buffered data ended in the middle
+                                        of a document. This error is
+                                        recoverable: call addData() and read
+                                        on.
+*/
+
+/*!
+    Creates a reader with no data. Call addData() to feed it.
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d(new QJsonStreamReaderPrivate)
+{
+}
+
+/*!
+    Creates a reader with \a data as the initially available data. More data
+    can be added with addData().
+*/
+QJsonStreamReader::QJsonStreamReader(QByteArrayView data)
+    : d(new QJsonStreamReaderPrivate)
+{
+    addData(data);
+}
+
+/*!
+    Destroys the reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+    = default;
+
+/*!
+    Makes the UTF-8 encoded \a data available for reading. If the reader
+    stopped with \l PrematureEndOfDocumentError, that error is cleared and
+    the next call to readNext() resumes with the token the previous data
+    ended in.
+*/
+void QJsonStreamReader::addData(QByteArrayView data)
+{
+    // drop what has been consumed, so a long stream doesn't accumulate
+    if (d->pos > 0) {
+        d->buffer.remove(0, d->pos);
+        d->basePos += d->pos;
+        d->pos = 0;
+    }
+    d->buffer.append(data.data(), data.size());
+
+    if (d->error == PrematureEndOfDocumentError) {
+        d->error = NoError;
+        d->token = NoToken;
+    }
+}
+
+/*!
+    Removes all buffered data and resets the reader to its initial state.
+*/
+void QJsonStreamReader::clear()
+{
+    *d = QJsonStreamReaderPrivate();
+}
+
+/*!
+    Reads the next token and returns its type, consuming the corresponding
+    input.
+
+    If the buffered data ends before the token is complete, returns
+    \l Invalid with error() set to \l PrematureEndOfDocumentError and leaves
+    the incomplete token unconsumed; reading can continue once addData() has
+    been called. Returns \l NoToken when all buffered documents have been
+    fully read.
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    return d->readNext();
+}
+
+/*!
+    Returns the type of the token the reader is currently positioned on,
+    i.e. what the last call to readNext() returned.
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    return d->token;
+}
+
+/*!
+    Returns true if the reader cannot produce another token from the
+    currently buffered data: either it stopped with
+    \l PrematureEndOfDocumentError or a fatal error, or all buffered
+    documents have been fully read.
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    if (d->error != NoError)
+        return true;
+    return d->state == QJsonStreamReaderPrivate::State::Start && !d->pendingEndDocument
+            && !d->hasMoreContent();
+}
+
+/*!
+    Returns the number of containers the reader is currently inside, i.e.
+    how many \l StartObject and \l StartArray tokens have not seen their
+    matching end token yet.
+*/
+int QJsonStreamReader::containerDepth() const
+{
+    return int(d->containers.size());
+}
+
+/*!
+    Returns the offset into the stream of the first byte the reader has not
+    consumed yet, counted across all calls to addData().
+*/
+qint64 QJsonStreamReader::currentOffset() const
+{
+    return d->basePos + d->pos;
+}
+
+/*!
+    Returns the text of the current \l Name or \l String token, or an empty
+    string for any other token.
+*/
+QString QJsonStreamReader::text() const
+{
+    if (d->token == Name || d->token == String)
+        return d->textValue;
+    return QString();
+}
+
+/*!
+    Returns true if the current \l Number token holds a number that is
+    representable as an integer, in which case toInteger() returns its exact
+    value.
+*/
+bool QJsonStreamReader::isInteger() const
+{
+    return d->token == Number && d->number.isInteger;
+}
+
+/*!
+    Returns the current \l Number token's value as an integer. If
+    isInteger() is false, the fractional part is discarded.
+
+    \sa toDouble(), isInteger()
+*/
+qint64 QJsonStreamReader::toInteger() const
+{
+    if (d->token != Number)
+        return 0;
+    return d->number.isInteger ? d->number.intValue : qint64(d->number.doubleValue);
+}
+
+/*!
+    Returns the current \l Number token's value as a double.
+
+    \sa toInteger(), isInteger()
+*/
+double QJsonStreamReader::toDouble() const
+{
+    if (d->token != Number)
+        return 0.;
+    return d->number.isInteger ? double(d->number.intValue) : d->number.doubleValue;
+}
+
+/*!
+    Returns the value of the current \l Bool token, or false for any other
+    token.
+*/
+bool QJsonStreamReader::toBool() const
+{
+    return d->token == Bool && d->boolValue;
+}
+
+/*!
+    Returns the reader's error state.
+
+    \sa errorString(), hasError()
+*/
+QJsonStreamReader::Error QJsonStreamReader::error() const
+{
+    return d->error;
+}
+
+/*!
+    Returns a human-readable description of the reader's error state.
+*/
+QString QJsonStreamReader::errorString() const
+{
+    switch (d->error) {
+    case NoError:
+        break;
+    case PrematureEndOfDocumentError:
+#ifndef QT_BOOTSTRAPPED
+        return QCoreApplication::translate("QJsonStreamReader", "premature end of document");
+#else
+        return QStringLiteral("premature end of document");
+#endif
+    case NotWellFormedError: {
+        QJsonParseError parseError;
+        parseError.error = d->detailedError;
+        return parseError.errorString();
+    }
+    }
+    return QString();
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qjsonstreamreader.cpp"
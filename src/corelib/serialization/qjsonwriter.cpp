@@ -3,45 +3,136 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include <cmath>
+#include <qalgorithms.h>
+#include <qiodevice.h>
 #include <qlocale.h>
 #include "qjsonwriter_p.h"
 #include "qjson_p.h"
 #include "private/qstringconverter_p.h"
 #include <private/qnumeric_p.h>
 #include <private/qcborvalue_p.h>
+#include <private/qsimd_p.h>
+
+#if QT_CONFIG(cborstreamreader)
+#  include <qcborstreamreader.h>
+#  include <qurl.h>
+#  include <quuid.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
 using namespace QJsonPrivate;
 
-static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json, int indent, bool compact);
-static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json, int indent, bool compact);
+namespace {
+// When serializing to a device, the in-memory buffer is flushed whenever it
+// grows beyond this, so the full document text never exists at once.
+constexpr qsizetype FlushThreshold = 128 * 1024;
+
+struct StreamSink
+{
+    QIODevice *device;
+    bool failed = false;
+
+    void maybeFlush(QByteArray &json)
+    {
+        if (json.size() >= FlushThreshold)
+            flush(json);
+    }
+    void flush(QByteArray &json)
+    {
+        if (!failed && device->write(json) != json.size())
+            failed = true;
+        json.resize(0);     // keep the capacity
+    }
+};
+} // unnamed namespace
+
+static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json, int indent,
+                                bool compact, StreamSink *sink = nullptr);
+static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json, int indent,
+                               bool compact, StreamSink *sink = nullptr);
 
 static inline uchar hexdig(uint u)
 {
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(QStringView s)
+/*
+    Converts runs of printable ASCII needing no JSON escaping straight to the
+    output, eight characters at a time, and stops at the first character that
+    needs the slow path: controls, '"', '\\' and everything non-ASCII.
+ */
+static void appendAsciiRun(const char16_t *&src, const char16_t *const end,
+                           uchar *&cursor, const uchar *const ba_end)
 {
-    // give it a minimum size to ensure the resize() below always adds enough space
-    QByteArray ba(qMax(s.size(), 16), Qt::Uninitialized);
+#if defined(__SSE2__)
+    while (end - src >= 8 && ba_end - cursor >= 8) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        // characters >= 0x8000 are negative as epi16 and caught by the first compare
+        __m128i special =
+                _mm_or_si128(_mm_or_si128(_mm_cmplt_epi16(data, _mm_set1_epi16(0x20)),
+                                          _mm_cmpgt_epi16(data, _mm_set1_epi16(0x7f))),
+                             _mm_or_si128(_mm_cmpeq_epi16(data, _mm_set1_epi16('"')),
+                                          _mm_cmpeq_epi16(data, _mm_set1_epi16('\\'))));
+        // narrowing is exact for the clean prefix; anything after the first
+        // special character is overwritten by the slow path
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(cursor), _mm_packus_epi16(data, data));
+        if (uint mask = uint(_mm_movemask_epi8(special))) {
+            qsizetype len = qCountTrailingZeroBits(mask) / 2;
+            cursor += len;
+            src += len;
+            return;
+        }
+        cursor += 8;
+        src += 8;
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    while (end - src >= 8 && ba_end - cursor >= 8) {
+        uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(src));
+        uint16x8_t special = vorrq_u16(vorrq_u16(vcltq_u16(data, vdupq_n_u16(0x20)),
+                                                 vcgtq_u16(data, vdupq_n_u16(0x7f))),
+                                       vorrq_u16(vceqq_u16(data, vdupq_n_u16('"')),
+                                                 vceqq_u16(data, vdupq_n_u16('\\'))));
+        if (vmaxvq_u16(special) != 0)
+            return;     // the slow path locates the special character
+        vst1_u8(cursor, vmovn_u16(data));
+        cursor += 8;
+        src += 8;
+    }
+#else
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+    Q_UNUSED(cursor);
+    Q_UNUSED(ba_end);
+#endif
+}
+
+static void appendEscapedString(QByteArray &json, QStringView s)
+{
+    const qsizetype base = json.size();
+    // assume, for the initial allocation, that the string is mostly ASCII
+    json.resize(base + qMax(s.size(), qsizetype(16)));
 
-    auto ba_const_start = [&]() { return reinterpret_cast<const uchar *>(ba.constData()); };
-    uchar *cursor = reinterpret_cast<uchar *>(const_cast<char *>(ba.constData()));
-    const uchar *ba_end = cursor + ba.size();
+    auto ba_const_start = [&]() { return reinterpret_cast<const uchar *>(json.constData()); };
+    uchar *cursor = reinterpret_cast<uchar *>(json.data()) + base;
+    const uchar *ba_end = ba_const_start() + json.size();
     const char16_t *src = s.utf16();
     const char16_t *const end = s.utf16() + s.size();
 
     while (src != end) {
-        if (cursor >= ba_end - 6) {
-            // ensure we have enough space
+        if (cursor >= ba_end - 8) {
+            // ensure we have enough space for the largest escape sequence and
+            // for one bulk store of appendAsciiRun()
             qptrdiff pos = cursor - ba_const_start();
-            ba.resize(ba.size()*2);
-            cursor = reinterpret_cast<uchar *>(ba.data()) + pos;
-            ba_end = ba_const_start() + ba.size();
+            json.resize(json.size() + qMax<qsizetype>(3 * (end - src) + 8, 16));
+            cursor = reinterpret_cast<uchar *>(json.data()) + pos;
+            ba_end = ba_const_start() + json.size();
         }
 
+        appendAsciiRun(src, end, cursor, ba_end);
+        if (src == end)
+            break;
+
         char16_t u = *src++;
         if (u < 0x80) {
             if (u < 0x20 || u == 0x22 || u == 0x5c) {
@@ -89,11 +180,52 @@ static QByteArray escapedString(QStringView s)
         }
     }
 
-    ba.resize(cursor - ba_const_start());
-    return ba;
+    json.resize(cursor - ba_const_start());
+}
+
+/*
+    Estimates the serialized size of the container's content, so the output
+    can be reserved in one go. The estimate leaves room for escaping and
+    UTF-8 growth of strings and for the longest number representations; it
+    need not be an upper bound, appending grows the output as usual.
+ */
+static qsizetype estimatedContentSize(const QCborContainerPrivate *c, int indent, bool compact)
+{
+    if (!c)
+        return 0;
+
+    // separators plus, when indenting, the indentation and the newline
+    const qsizetype perElement = compact ? 2 : 4 * indent + 6;
+    qsizetype size = 0;
+    for (const QtCbor::Element &e : c->elements) {
+        size += perElement;
+        switch (e.type) {
+        case QCborValue::Integer:
+        case QCborValue::Double:
+            size += 24;
+            break;
+        case QCborValue::String:
+            size += 2;
+            if (e.flags & QtCbor::Element::HasByteData) {
+                if (const QtCbor::ByteData *b = c->byteData(e))
+                    size += b->len + b->len / 2;
+            }
+            break;
+        case QCborValue::Array:
+        case QCborValue::Map:
+            size += 2;
+            if (e.flags & QtCbor::Element::IsContainer)
+                size += estimatedContentSize(e.container, indent + (compact ? 0 : 1), compact);
+            break;
+        default:
+            size += 5;      // true, false, null
+        }
+    }
+    return size;
 }
 
-static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
+static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact,
+                        StreamSink *sink = nullptr)
 {
     QCborValue::Type type = v.type();
     switch (type) {
@@ -116,20 +248,20 @@ static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool
     }
     case QCborValue::String:
         json += '"';
-        json += escapedString(v.toString());
+        appendEscapedString(json, v.toString());
         json += '"';
         break;
     case QCborValue::Array:
         json += compact ? "[" : "[\n";
         arrayContentToJson(
-                QJsonPrivate::Value::container(v), json, indent + (compact ? 0 : 1), compact);
+                QJsonPrivate::Value::container(v), json, indent + (compact ? 0 : 1), compact, sink);
         json += QByteArray(4*indent, ' ');
         json += ']';
         break;
     case QCborValue::Map:
         json += compact ? "{" : "{\n";
         objectContentToJson(
-                QJsonPrivate::Value::container(v), json, indent + (compact ? 0 : 1), compact);
+                QJsonPrivate::Value::container(v), json, indent + (compact ? 0 : 1), compact, sink);
         json += QByteArray(4*indent, ' ');
         json += '}';
         break;
@@ -139,7 +271,8 @@ static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool
     }
 }
 
-static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json, int indent, bool compact)
+static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json, int indent,
+                               bool compact, StreamSink *sink)
 {
     if (!a || a->elements.empty())
         return;
@@ -148,8 +281,10 @@ static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json,
 
     qsizetype i = 0;
     while (true) {
+        if (sink)
+            sink->maybeFlush(json);
         json += indentString;
-        valueToJson(a->valueAt(i), json, indent, compact);
+        valueToJson(a->valueAt(i), json, indent, compact, sink);
 
         if (++i == a->elements.size()) {
             if (!compact)
@@ -162,7 +297,8 @@ static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json,
 }
 
 
-static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json, int indent, bool compact)
+static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json, int indent,
+                                bool compact, StreamSink *sink)
 {
     if (!o || o->elements.empty())
         return;
@@ -171,12 +307,14 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
 
     qsizetype i = 0;
     while (true) {
+        if (sink)
+            sink->maybeFlush(json);
         QCborValue e = o->valueAt(i);
         json += indentString;
         json += '"';
-        json += escapedString(o->valueAt(i).toString());
+        appendEscapedString(json, o->valueAt(i).toString());
         json += compact ? "\":" : "\": ";
-        valueToJson(o->valueAt(i + 1), json, indent, compact);
+        valueToJson(o->valueAt(i + 1), json, indent, compact, sink);
 
         if ((i += 2) == o->elements.size()) {
             if (!compact)
@@ -190,7 +328,7 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
 
 void Writer::objectToJson(const QCborContainerPrivate *o, QByteArray &json, int indent, bool compact)
 {
-    json.reserve(json.size() + (o ? (int)o->elements.size() : 16));
+    json.reserve(json.size() + 4 + estimatedContentSize(o, indent + (compact ? 0 : 1), compact));
     json += compact ? "{" : "{\n";
     objectContentToJson(o, json, indent + (compact ? 0 : 1), compact);
     json += QByteArray(4*indent, ' ');
@@ -199,11 +337,386 @@ void Writer::objectToJson(const QCborContainerPrivate *o, QByteArray &json, int
 
 void Writer::arrayToJson(const QCborContainerPrivate *a, QByteArray &json, int indent, bool compact)
 {
-    json.reserve(json.size() + (a ? (int)a->elements.size() : 16));
+    json.reserve(json.size() + 4 + estimatedContentSize(a, indent + (compact ? 0 : 1), compact));
     json += compact ? "[" : "[\n";
     arrayContentToJson(a, json, indent + (compact ? 0 : 1), compact);
     json += QByteArray(4*indent, ' ');
     json += compact ? "]" : "]\n";
 }
 
+bool Writer::objectToJson(const QCborContainerPrivate *o, QIODevice *device, int indent,
+                          bool compact)
+{
+    StreamSink sink = { device };
+    QByteArray json;
+    json.reserve(qMin(4 + estimatedContentSize(o, indent + (compact ? 0 : 1), compact),
+                      FlushThreshold + qsizetype(16)));
+    json += compact ? "{" : "{\n";
+    objectContentToJson(o, json, indent + (compact ? 0 : 1), compact, &sink);
+    json += QByteArray(4*indent, ' ');
+    json += compact ? "}" : "}\n";
+    sink.flush(json);
+    return !sink.failed;
+}
+
+bool Writer::arrayToJson(const QCborContainerPrivate *a, QIODevice *device, int indent,
+                         bool compact)
+{
+    StreamSink sink = { device };
+    QByteArray json;
+    json.reserve(qMin(4 + estimatedContentSize(a, indent + (compact ? 0 : 1), compact),
+                      FlushThreshold + qsizetype(16)));
+    json += compact ? "[" : "[\n";
+    arrayContentToJson(a, json, indent + (compact ? 0 : 1), compact, &sink);
+    json += QByteArray(4*indent, ' ');
+    json += compact ? "]" : "]\n";
+    sink.flush(json);
+    return !sink.failed;
+}
+
+#if QT_CONFIG(cborstreamreader)
+
+namespace {
+struct CborToJsonTranscoder
+{
+    QCborStreamReader &reader;
+    StreamSink sink;
+    const bool compact;
+    QByteArray json;
+
+    bool appendNumber();
+    bool transcodeValue(int indent, int remainingRecursionDepth);
+    bool transcodeContainer(int indent, int remainingRecursionDepth);
+    bool transcodeTaggedValue(int indent, int remainingRecursionDepth);
+    bool transcodeKey(int remainingRecursionDepth);
+    bool transcodeString();
+    bool transcodeByteArray(QCborTag encoding);
+};
+} // unnamed namespace
+
+/*
+    Appends the number the reader is positioned on and moves to the next
+    element. Unlike the DOM conversion, integers outside the qint64 range
+    keep their exact decimal form, since JSON numbers have no range limit.
+ */
+bool CborToJsonTranscoder::appendNumber()
+{
+    switch (reader.type()) {
+    case QCborStreamReader::UnsignedInteger:
+        json += QByteArray::number(reader.toUnsignedInteger());
+        break;
+
+    case QCborStreamReader::NegativeInteger: {
+        quint64 n = quint64(reader.toNegativeInteger());
+        json += '-';
+        if (n)
+            json += QByteArray::number(n);
+        else
+            json += "18446744073709551616";     // -2^64 wrapped around to zero
+        break;
+    }
+
+    default: {
+        const double d = reader.isDouble() ? reader.toDouble()
+                       : reader.isFloat() ? double(reader.toFloat())
+                       : double(reader.toFloat16());
+        if (qt_is_finite(d))
+            json += QByteArray::number(d, 'g', QLocale::FloatingPointShortest);
+        else
+            json += "null"; // +INF || -INF || NaN (see RFC4627#section2.4)
+        break;
+    }
+    }
+
+    reader.next();
+    return reader.lastError() == QCborError::NoError;
+}
+
+bool CborToJsonTranscoder::transcodeString()
+{
+    json += '"';
+    auto r = reader.readString();
+    while (r.status == QCborStreamReader::Ok) {
+        appendEscapedString(json, r.data);
+        sink.maybeFlush(json);
+        r = reader.readString();
+    }
+    if (r.status == QCborStreamReader::Error)
+        return false;
+    json += '"';
+    return true;
+}
+
+bool CborToJsonTranscoder::transcodeByteArray(QCborTag encoding)
+{
+    // the base conversions need the full content, so collect all chunks
+    QByteArray data = reader.readAllByteArray();
+    if (reader.lastError() != QCborError::NoError)
+        return false;
+
+    if (encoding == QCborTag(QCborKnownTags::ExpectedBase16))
+        data = data.toHex();
+    else if (encoding == QCborTag(QCborKnownTags::ExpectedBase64))
+        data = data.toBase64();
+    else
+        data = data.toBase64(QByteArray::Base64UrlEncoding | QByteArray::OmitTrailingEquals);
+
+    json += '"';
+    json += data;
+    json += '"';
+    return true;
+}
+
+bool CborToJsonTranscoder::transcodeContainer(int indent, int remainingRecursionDepth)
+{
+    const bool isMap = reader.isMap();
+    if (!reader.enterContainer())
+        return false;
+
+    json += isMap ? '{' : '[';
+    if (!compact)
+        json += '\n';
+    const QByteArray indentString(compact ? 0 : 4 * (indent + 1), ' ');
+
+    bool first = true;
+    while (reader.hasNext()) {
+        if (!first)
+            json += compact ? "," : ",\n";
+        first = false;
+        sink.maybeFlush(json);
+        json += indentString;
+        if (isMap) {
+            if (!transcodeKey(remainingRecursionDepth - 1))
+                return false;
+            json += compact ? ":" : ": ";
+        }
+        if (!transcodeValue(indent + 1, remainingRecursionDepth - 1))
+            return false;
+    }
+    if (reader.lastError() != QCborError::NoError || !reader.leaveContainer())
+        return false;
+
+    if (!compact && !first)
+        json += '\n';
+    json += QByteArray(compact ? 0 : 4 * indent, ' ');
+    json += isMap ? '}' : ']';
+    return true;
+}
+
+bool CborToJsonTranscoder::transcodeTaggedValue(int indent, int remainingRecursionDepth)
+{
+    if (Q_UNLIKELY(remainingRecursionDepth == 0))
+        return false;
+
+    const QCborTag tag = reader.toTag();
+    reader.next();
+    if (reader.lastError() != QCborError::NoError)
+        return false;
+
+    switch (qint64(tag)) {
+    case qint64(QCborKnownTags::DateTimeString):
+        if (reader.isString())
+            return transcodeString();
+        break;
+
+    case qint64(QCborKnownTags::Url):
+        if (reader.isString()) {
+            // use the fully-encoded URL form, like QCborValue::toJsonValue()
+            const QString s = reader.readAllString();
+            if (reader.lastError() != QCborError::NoError)
+                return false;
+            json += '"';
+            appendEscapedString(json,
+                                QUrl::fromEncoded(s.toUtf8()).toString(QUrl::FullyEncoded));
+            json += '"';
+            return true;
+        }
+        break;
+
+    case qint64(QCborKnownTags::ExpectedBase64url):
+    case qint64(QCborKnownTags::ExpectedBase64):
+    case qint64(QCborKnownTags::ExpectedBase16):
+        if (reader.isByteArray())
+            return transcodeByteArray(tag);
+        break;
+
+    case qint64(QCborKnownTags::Uuid):
+        if (reader.isByteArray()) {
+            const QByteArray data = reader.readAllByteArray();
+            if (reader.lastError() != QCborError::NoError)
+                return false;
+            json += '"';
+            if (data.size() == qsizetype(sizeof(QUuid)))
+                json += QUuid::fromRfc4122(data).toString(QUuid::WithoutBraces).toLatin1();
+            else
+                json += data.toBase64(QByteArray::Base64UrlEncoding
+                                      | QByteArray::OmitTrailingEquals);
+            json += '"';
+            return true;
+        }
+        break;
+    }
+
+    // all other tags are ignored and the tagged value converted as usual
+    return transcodeValue(indent, remainingRecursionDepth);
+}
+
+/*
+    Transcodes a map key. JSON keys are strings, so other types are converted
+    to their string form, following QCborValue::toJsonValue().
+ */
+bool CborToJsonTranscoder::transcodeKey(int remainingRecursionDepth)
+{
+    if (Q_UNLIKELY(remainingRecursionDepth == 0))
+        return false;
+
+    // tags on keys only matter as encoding hints for byte string keys
+    QCborTag byteEncoding = QCborTag(QCborKnownTags::ExpectedBase64url);
+    while (reader.isTag()) {
+        if (reader.toTag() == QCborTag(QCborKnownTags::ExpectedBase64)
+                || reader.toTag() == QCborTag(QCborKnownTags::ExpectedBase16))
+            byteEncoding = reader.toTag();
+        reader.next();
+        if (reader.lastError() != QCborError::NoError)
+            return false;
+    }
+
+    switch (reader.type()) {
+    case QCborStreamReader::String:
+        return transcodeString();
+
+    case QCborStreamReader::ByteArray:
+        return transcodeByteArray(byteEncoding);
+
+    case QCborStreamReader::UnsignedInteger:
+    case QCborStreamReader::NegativeInteger:
+    case QCborStreamReader::Float16:
+    case QCborStreamReader::Float:
+    case QCborStreamReader::Double:
+        json += '"';
+        if (!appendNumber())
+            return false;
+        json += '"';
+        return true;
+
+    case QCborStreamReader::SimpleType:
+        json += '"';
+        if (reader.isTrue()) {
+            json += "true";
+        } else if (reader.isFalse()) {
+            json += "false";
+        } else if (reader.isNull()) {
+            json += "null";
+        } else if (reader.isUndefined()) {
+            json += "undefined";
+        } else {
+            json += "simple(";
+            json += QByteArray::number(quint8(reader.toSimpleType()));
+            json += ')';
+        }
+        json += '"';
+        reader.next();
+        return reader.lastError() == QCborError::NoError;
+
+    case QCborStreamReader::Array:
+    case QCborStreamReader::Map: {
+        // exceedingly rare; materialize just the key and convert it the way
+        // the DOM conversion does
+        const QCborValue key = QCborValue::fromCbor(reader);
+        if (reader.lastError() != QCborError::NoError)
+            return false;
+        json += '"';
+        appendEscapedString(json, key.toDiagnosticNotation(QCborValue::Compact));
+        json += '"';
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+bool CborToJsonTranscoder::transcodeValue(int indent, int remainingRecursionDepth)
+{
+    if (Q_UNLIKELY(remainingRecursionDepth == 0))
+        return false;
+
+    switch (reader.type()) {
+    case QCborStreamReader::UnsignedInteger:
+    case QCborStreamReader::NegativeInteger:
+    case QCborStreamReader::Float16:
+    case QCborStreamReader::Float:
+    case QCborStreamReader::Double:
+        return appendNumber();
+
+    case QCborStreamReader::ByteArray:
+        return transcodeByteArray(QCborTag(QCborKnownTags::ExpectedBase64url));
+
+    case QCborStreamReader::String:
+        return transcodeString();
+
+    case QCborStreamReader::Array:
+    case QCborStreamReader::Map:
+        return transcodeContainer(indent, remainingRecursionDepth);
+
+    case QCborStreamReader::Tag:
+        return transcodeTaggedValue(indent, remainingRecursionDepth - 1);
+
+    case QCborStreamReader::SimpleType:
+        if (reader.isTrue()) {
+            json += "true";
+        } else if (reader.isFalse()) {
+            json += "false";
+        } else if (reader.isNull() || reader.isUndefined()) {
+            json += "null";
+        } else {
+            // like QCborValue::toJsonValue() for unknown simple types
+            json += "\"simple(";
+            json += QByteArray::number(quint8(reader.toSimpleType()));
+            json += ")\"";
+        }
+        reader.next();
+        return reader.lastError() == QCborError::NoError;
+
+    case QCborStreamReader::Invalid:
+    default:
+        return false;
+    }
+}
+
+/*
+    \internal
+
+    Transcodes the CBOR element \a reader is positioned on straight to JSON
+    text on \a device, driving the reader as the text is produced, so neither
+    a QCborValue nor the document text is ever materialized in full. The
+    conversions match QCborValue::toJsonValue() followed by
+    QJsonDocument::toJson(), except that out-of-range integers keep their
+    exact decimal form and that map keys stay in stream order instead of
+    being sorted.
+
+    Returns false on a CBOR decoding error, a device write error or too
+    deeply nested input; part of the output may already have been written by
+    then.
+ */
+bool QJsonPrivate::transcodeCborToJson(QCborStreamReader &reader, QIODevice *device, bool compact)
+{
+    if (!device)
+        return false;
+
+    // same limit as the JSON parser applies when building a document
+    constexpr int MaximumRecursionDepth = 1024;
+
+    CborToJsonTranscoder t = { reader, { device }, compact, {} };
+    const bool isContainer = reader.isContainer();
+    if (!t.transcodeValue(0, MaximumRecursionDepth))
+        return false;
+    if (!compact && isContainer)
+        t.json += '\n';     // toJson() ends indented documents with a newline
+    t.sink.flush(t.json);
+    return !t.sink.failed;
+}
+
+#endif // QT_CONFIG(cborstreamreader)
+
 QT_END_NAMESPACE
@@ -20,6 +20,9 @@
 
 QT_BEGIN_NAMESPACE
 
+class QCborStreamReader;
+class QIODevice;
+
 namespace QJsonPrivate
 {
 
@@ -28,8 +31,22 @@ class Writer
 public:
     static void objectToJson(const QCborContainerPrivate *o, QByteArray &json, int indent, bool compact = false);
     static void arrayToJson(const QCborContainerPrivate *a, QByteArray &json, int indent, bool compact = false);
+
+    // streaming variants; the document text is flushed to the device in
+    // chunks instead of being accumulated in full
+    static bool objectToJson(const QCborContainerPrivate *o, QIODevice *device, int indent, bool compact = false);
+    static bool arrayToJson(const QCborContainerPrivate *a, QIODevice *device, int indent, bool compact = false);
 };
 
+#if QT_CONFIG(cborstreamreader)
+// Transcodes the CBOR element \a reader is positioned on straight to JSON
+// text on \a device, without materializing a QCborValue or QJsonDocument in
+// between, using O(depth) memory. Returns false on a CBOR decoding error, a
+// device write error or too deeply nested input.
+Q_CORE_EXPORT bool transcodeCborToJson(QCborStreamReader &reader, QIODevice *device,
+                                       bool compact = false);
+#endif
+
 }
 
 QT_END_NAMESPACE
@@ -201,6 +201,7 @@ static const int QTEXTSTREAM_BUFFERSIZE = 16384;
 
 #include <locale.h>
 #include "private/qlocale_p.h"
+#include "private/qlocale_tools_p.h"
 #include "private/qstringconverter_p.h"
 
 #include <stdlib.h>
@@ -1711,12 +1712,18 @@ QTextStreamPrivate::NumberParsingStatus QTextStreamPrivate::getNumber(qulonglong
         break;
     }
     case 10: {
+        // The locale's symbols don't change while we scan, so fetch them once
+        // instead of once per character.
+        const QString negativeSign = locale.negativeSign();
+        const QString positiveSign = locale.positiveSign();
+        const QString groupSeparator = locale != QLocale::c() ? locale.groupSeparator()
+                                                              : QString();
         // Parse sign (or first digit)
         QChar sign;
         int ndigits = 0;
         if (!getChar(&sign))
             return npsMissingDigit;
-        if (sign != locale.negativeSign() && sign != locale.positiveSign()) {
+        if (sign != negativeSign && sign != positiveSign) {
             if (!sign.isDigit()) {
                 ungetChar(sign);
                 return npsMissingDigit;
@@ -1730,7 +1737,7 @@ QTextStreamPrivate::NumberParsingStatus QTextStreamPrivate::getNumber(qulonglong
             if (ch.isDigit()) {
                 val *= 10;
                 val += ch.digitValue();
-            } else if (locale != QLocale::c() && ch == locale.groupSeparator()) {
+            } else if (!groupSeparator.isEmpty() && ch == groupSeparator) {
                 continue;
             } else {
                 ungetChar(ch);
@@ -1740,7 +1747,7 @@ QTextStreamPrivate::NumberParsingStatus QTextStreamPrivate::getNumber(qulonglong
         }
         if (ndigits == 0)
             return npsMissingDigit;
-        if (sign == locale.negativeSign()) {
+        if (sign == negativeSign) {
             qlonglong ival = qlonglong(val);
             if (ival > 0)
                 ival = -ival;
@@ -1848,6 +1855,15 @@ bool QTextStreamPrivate::getReal(double *f)
     char buf[BufferSize];
     int i = 0;
 
+    // The locale's symbols don't change while we scan, so fetch them once
+    // instead of once per character.
+    const bool isCLocale = (locale == QLocale::c());
+    const QString decimalPoint = locale.decimalPoint().toLower();
+    const QString exponential = locale.exponential().toLower();
+    const QString negativeSign = locale.negativeSign().toLower();
+    const QString positiveSign = locale.positiveSign().toLower();
+    const QString groupSeparator = isCLocale ? QString() : locale.groupSeparator().toLower();
+
     QChar c;
     while (getChar(&c)) {
         switch (c.unicode()) {
@@ -1872,15 +1888,14 @@ bool QTextStreamPrivate::getReal(double *f)
             break;
         default: {
             QChar lc = c.toLower();
-            if (lc == locale.decimalPoint().toLower())
+            if (lc == decimalPoint)
                 input = InputDot;
-            else if (lc == locale.exponential().toLower())
+            else if (lc == exponential)
                 input = InputExp;
-            else if (lc == locale.negativeSign().toLower()
-                     || lc == locale.positiveSign().toLower())
+            else if (lc == negativeSign || lc == positiveSign)
                 input = InputSign;
-            else if (locale != QLocale::c() // backward-compatibility
-                     && lc == locale.groupSeparator().toLower())
+            else if (!groupSeparator.isEmpty() // backward-compatibility
+                     && lc == groupSeparator)
                 input = InputDigit; // well, it isn't a digit, but no one cares.
             else
                 input = None;
@@ -1926,6 +1941,12 @@ bool QTextStreamPrivate::getReal(double *f)
         *f = -qt_inf();
         return true;
     }
+    if (isCLocale) {
+        // the buffer is plain ASCII; skip the QString and QLocale round-trip
+        auto r = qt_asciiToDouble(buf, i);
+        *f = r.result;
+        return r.ok();
+    }
     bool ok;
     *f = locale.toDouble(QString::fromLatin1(buf), &ok);
     return ok;
@@ -15,9 +15,13 @@
 #include <qscopeguard.h>
 #include <qcoreapplication.h>
 
+#include <qalgorithms.h>
+
 #include <private/qoffsetstringarray_p.h>
+#include <private/qsimd_p.h>
 #include <private/qtools_p.h>
 
+#include <algorithm>
 #include <iterator>
 #include "qxmlstream_p.h"
 #include "qxmlstreamparser_p.h"
@@ -1176,6 +1180,59 @@ bool QXmlStreamReaderPrivate::scanAttType()
     return false;
 }
 
+/*
+    Returns the length of the leading run of [str, end) consisting solely of
+    plain characters, i.e. characters the calling scanner appends verbatim.
+    The run stops at a control character (which covers the line endings and
+    the whitespace the scanners track), at one of the up to four delimiters
+    \c{D1..D4}, or at the invalid characters U+FFFE/U+FFFF. Surrogate halves
+    are passed through untouched, like in the per-character loops.
+ */
+template <char16_t D1, char16_t D2, char16_t D3, char16_t D4>
+static qsizetype scanPlainChars(const char16_t *str, const char16_t *end)
+{
+    const char16_t *start = str;
+#if defined(__SSE2__)
+    // process 8 characters at a time, biasing the unsigned range comparisons
+    // into the signed domain
+    const __m128i bias = _mm_set1_epi16(short(0x8000));
+    while (end - str >= 8) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str));
+        __m128i biased = _mm_xor_si128(data, bias);
+        __m128i special =
+                _mm_or_si128(_mm_cmplt_epi16(biased, _mm_set1_epi16(short(0x8020))),
+                             _mm_cmpgt_epi16(biased, _mm_set1_epi16(short(0x7ffd))));
+        special = _mm_or_si128(special, _mm_cmpeq_epi16(data, _mm_set1_epi16(short(D1))));
+        special = _mm_or_si128(special, _mm_cmpeq_epi16(data, _mm_set1_epi16(short(D2))));
+        special = _mm_or_si128(special, _mm_cmpeq_epi16(data, _mm_set1_epi16(short(D3))));
+        special = _mm_or_si128(special, _mm_cmpeq_epi16(data, _mm_set1_epi16(short(D4))));
+        if (uint mask = uint(_mm_movemask_epi8(special)))
+            return str - start + qCountTrailingZeroBits(mask) / 2;
+        str += 8;
+    }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+    while (end - str >= 8) {
+        uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(str));
+        uint16x8_t special = vorrq_u16(vcltq_u16(data, vdupq_n_u16(0x20)),
+                                       vcgtq_u16(data, vdupq_n_u16(0xfffd)));
+        special = vorrq_u16(special, vceqq_u16(data, vdupq_n_u16(D1)));
+        special = vorrq_u16(special, vceqq_u16(data, vdupq_n_u16(D2)));
+        special = vorrq_u16(special, vceqq_u16(data, vdupq_n_u16(D3)));
+        special = vorrq_u16(special, vceqq_u16(data, vdupq_n_u16(D4)));
+        if (vmaxvq_u16(special) != 0)
+            break;      // the loop below locates the special character
+        str += 8;
+    }
+#endif
+    while (str != end) {
+        char16_t c = *str;
+        if (c < 0x20 || c > 0xfffd || c == D1 || c == D2 || c == D3 || c == D4)
+            break;
+        ++str;
+    }
+    return str - start;
+}
+
 /*!
  \internal
 
@@ -1192,7 +1249,22 @@ inline qsizetype QXmlStreamReaderPrivate::fastScanLiteralContent()
 {
     qsizetype n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        // bulk step: append a run of plain characters straight out of the
+        // read buffer; neither whitespace normalization nor line tracking
+        // applies to them
+        if (!putStack.size() && readBufferPos < readBuffer.size()) {
+            const char16_t *data = reinterpret_cast<const char16_t *>(readBuffer.constData());
+            const qsizetype len = scanPlainChars<u'&', u'<', u'"', u'\''>(
+                        data + readBufferPos, data + readBuffer.size());
+            if (len) {
+                textBuffer.append(reinterpret_cast<const QChar *>(data) + readBufferPos, len);
+                readBufferPos += len;
+                n += len;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -1242,7 +1314,24 @@ inline qsizetype QXmlStreamReaderPrivate::fastScanSpace()
 {
     qsizetype n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        // bulk step: spaces and tabs need no line tracking, so take whole
+        // runs of them out of the read buffer at once
+        if (!putStack.size() && readBufferPos < readBuffer.size()) {
+            const char16_t *data = reinterpret_cast<const char16_t *>(readBuffer.constData());
+            qsizetype len = 0;
+            while (readBufferPos + len < readBuffer.size()
+                   && (data[readBufferPos + len] == u' ' || data[readBufferPos + len] == u'\t')) {
+                ++len;
+            }
+            if (len) {
+                textBuffer.append(reinterpret_cast<const QChar *>(data) + readBufferPos, len);
+                readBufferPos += len;
+                n += len;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (c) {
         case '\r':
             if ((c = filterCarriageReturn()) == 0)
@@ -1275,7 +1364,28 @@ inline qsizetype QXmlStreamReaderPrivate::fastScanContentCharList()
 {
     qsizetype n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        // bulk step: append a run of plain characters straight out of the
+        // read buffer; markup, line endings and anything else needing
+        // per-character treatment stops the run and drops to the switch below
+        if (!putStack.size() && readBufferPos < readBuffer.size()) {
+            const char16_t *data = reinterpret_cast<const char16_t *>(readBuffer.constData());
+            const qsizetype len = scanPlainChars<u'&', u'<', u']', u']'>(
+                        data + readBufferPos, data + readBuffer.size());
+            if (len) {
+                // runs may contain spaces, which don't affect isWhitespace
+                if (isWhitespace
+                    && !std::all_of(data + readBufferPos, data + readBufferPos + len,
+                                    [](char16_t ch) { return ch == u' '; })) {
+                    isWhitespace = false;
+                }
+                textBuffer.append(reinterpret_cast<const QChar *>(data) + readBufferPos, len);
+                readBufferPos += len;
+                n += len;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
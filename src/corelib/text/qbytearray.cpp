@@ -25,6 +25,12 @@
 #include <zconf.h>
 #include <zlib.h>
 #include <qxpfunctional.h>
+#ifndef QT_BOOTSTRAPPED
+#  include <private/qtcore-config_p.h>
+#  if QT_CONFIG(zstd)
+#    include <zstd.h>
+#  endif
+#endif
 #endif
 #include <ctype.h>
 #include <limits.h>
@@ -754,9 +760,13 @@ QByteArray qCompress(const uchar* data, qsizetype nbytes, int compressionLevel)
     from this and any earlier Qt version, back to Qt 3.1 when this
     feature was added.
 
+    Since 6.9, if Qt was configured with zstd support, the compressed
+    payload may also be a zstd frame; the format is detected
+    automatically.
+
     \b{Note:} If you want to use this function to uncompress external
-    data that was compressed using zlib, you first need to prepend a four
-    byte header to the byte array containing the data. The header must
+    data that was compressed using zlib or zstd, you first need to prepend
+    a four byte header to the byte array containing the data. The header must
     contain the expected length (in bytes) of the uncompressed data,
     expressed as an unsigned, big-endian, 32-bit integer. This number is
     just a hint for the initial size of the output buffer size,
@@ -780,6 +790,43 @@ QByteArray qCompress(const uchar* data, qsizetype nbytes, int compressionLevel)
     Uncompresses the first \a nbytes of \a data and returns a new byte
     array with the uncompressed data.
 */
+#ifndef QT_BOOTSTRAPPED
+#if QT_CONFIG(zstd)
+static QByteArray zstdUncompress(const uchar *data, qsizetype nbytes, qsizetype capacity)
+{
+    QArrayDataPointer<char> out(capacity);
+    if (out.data() == nullptr) // allocation failed
+        return tooMuchData(ZLibOp::Decompression);
+
+    ZSTD_DCtx *dctx = ZSTD_createDCtx();
+    if (!dctx)
+        return tooMuchData(ZLibOp::Decompression);
+    const auto sg = qScopeGuard([&] { ZSTD_freeDCtx(dctx); });
+
+    ZSTD_inBuffer in = { data, size_t(nbytes), 0 };
+    size_t ret = 1; // any non-zero value: "frame not finished yet"
+    while (ret != 0) {
+        if (out.size == out.allocatedCapacity()) {
+            out->reallocateAndGrow(QArrayData::GrowsAtEnd, 1); // next natural capacity
+            if (out.data() == nullptr) // reallocation failed
+                return tooMuchData(ZLibOp::Decompression);
+        }
+        ZSTD_outBuffer outBuf = { out.data() + out.size,
+                                  size_t(out.allocatedCapacity() - out.size), 0 };
+        ret = ZSTD_decompressStream(dctx, &outBuf, &in);
+        if (ZSTD_isError(ret))
+            return invalidCompressedData();
+        out.size += qsizetype(outBuf.pos);
+        if (ret != 0 && in.pos == in.size)
+            return invalidCompressedData(); // truncated frame
+    }
+
+    out.data()[out.size] = '\0';
+    return QByteArray(std::move(out));
+}
+#endif // QT_CONFIG(zstd)
+#endif // QT_BOOTSTRAPPED
+
 QByteArray qUncompress(const uchar* data, qsizetype nbytes)
 {
     if (!data)
@@ -810,6 +857,19 @@ QByteArray qUncompress(const uchar* data, qsizetype nbytes)
     qsizetype capacity = std::max(qsizetype(expectedSize), // cannot overflow!
                                   nbytes);
 
+#ifndef QT_BOOTSTRAPPED
+#if QT_CONFIG(zstd)
+    // Transparently accept zstd frames after the size header, so data from
+    // zstd-based producers can be consumed; qCompress() keeps writing zlib
+    // streams for compatibility.
+    constexpr uchar ZstdMagic[] = { 0x28, 0xb5, 0x2f, 0xfd };
+    if (nbytes - HeaderSize >= qsizetype(sizeof(ZstdMagic))
+            && memcmp(data + HeaderSize, ZstdMagic, sizeof(ZstdMagic)) == 0) {
+        return zstdUncompress(data + HeaderSize, nbytes - HeaderSize, capacity);
+    }
+#endif
+#endif
+
     QArrayDataPointer<char> d(capacity);
     return xxflate(ZLibOp::Decompression, std::move(d), {data + HeaderSize, nbytes - HeaderSize},
                    [] (z_stream *zs) { return inflateInit(zs); },
@@ -3347,6 +3407,10 @@ QDataStream &operator>>(QDataStream &in, QByteArray &ba)
         return in;
     }
 
+    // opt-in zero-copy path for streams reading from in-memory data
+    if (in.readBytesAliased(ba, len))
+        return in;
+
     constexpr qsizetype Step = 1024 * 1024;
     qsizetype allocated = 0;
 
@@ -9,6 +9,7 @@
 #endif
 
 #include <limits.h>
+#include <string.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -26,6 +27,13 @@ static inline qsizetype bm_find(const uchar *cc, qsizetype l, qsizetype index, c
 {
     if (pl == 0)
         return index > l ? -1 : index;
+    if (pl == 1) {
+        // single-byte needle: libc's vectorized memchr beats the skip loop
+        if (index >= l)
+            return -1;
+        const void *match = memchr(cc + index, *puc, size_t(l - index));
+        return match ? qsizetype(static_cast<const uchar *>(match) - cc) : -1;
+    }
     const qsizetype pl_minus_one = pl - 1;
 
     const uchar *current = cc + index + pl_minus_one;
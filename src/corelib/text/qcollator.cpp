@@ -7,7 +7,9 @@
 #include "qstring.h"
 
 #include "qdebug.h"
+#include "qhash.h"
 #include "qlocale_p.h"
+#include "qmutex.h"
 #include "qthreadstorage.h"
 
 QT_BEGIN_NAMESPACE
@@ -35,6 +37,16 @@ public:
 }
 Q_GLOBAL_STATIC(QThreadStorage<GenerationalCollator>, defaultCollator)
 
+namespace {
+struct CachedCollators
+{
+    QMutex mutex;
+    QHash<QString, QCollator> collators;
+    int generation = QLocalePrivate::s_generation.loadRelaxed();
+};
+}
+Q_GLOBAL_STATIC(CachedCollators, cachedCollators)
+
 /*!
     \class QCollator
     \inmodule QtCore
@@ -377,6 +389,59 @@ QCollatorSortKey QCollator::defaultSortKey(QStringView key)
     return defaultCollator->localData().collator().sortKey(key.toString());
 }
 
+/*!
+    \since 6.9
+
+    Returns a collator for \a locale with the given \a caseSensitivity,
+    \a numericMode and \a ignorePunctuation, from a process-wide cache.
+
+    Constructing a collator is comparatively expensive on most platforms, as
+    the backend has to load and process the locale's collation rules. This
+    function constructs the collator for each distinct combination of
+    arguments only once and afterwards returns shallow copies of the cached
+    instance, so it can be called freely from short-lived tasks, including
+    concurrently from multiple threads.
+
+    The returned collator can be used for comparing and creating sort keys
+    from any thread. Calling one of its setters detaches it from the cached
+    instance first, as any copy of a collator would.
+
+    \sa QCollator(), defaultCompare()
+*/
+QCollator QCollator::cached(const QLocale &locale, Qt::CaseSensitivity caseSensitivity,
+                            bool numericMode, bool ignorePunctuation)
+{
+    QString key = locale.bcp47Name();
+    key += u'/';
+    if (caseSensitivity == Qt::CaseInsensitive)
+        key += u'i';
+    if (numericMode)
+        key += u'n';
+    if (ignorePunctuation)
+        key += u'p';
+
+    CachedCollators *cache = cachedCollators();
+    QMutexLocker locker(&cache->mutex);
+    const int currentGeneration = QLocalePrivate::s_generation.loadRelaxed();
+    if (Q_UNLIKELY(cache->generation != currentGeneration)) {
+        // locale data changed behind our back; drop the stale collators
+        cache->generation = currentGeneration;
+        cache->collators.clear();
+    }
+    auto it = cache->collators.constFind(key);
+    if (it == cache->collators.cend()) {
+        QCollator collator(locale);
+        collator.setCaseSensitivity(caseSensitivity);
+        collator.setNumericMode(numericMode);
+        collator.setIgnorePunctuation(ignorePunctuation);
+        // Initialize now, so that the copies handed out can be used
+        // concurrently without racing on initialization:
+        collator.d->ensureInitialized();
+        it = cache->collators.insert(key, collator);
+    }
+    return it.value();
+}
+
 /*!
     \fn QCollatorSortKey QCollator::sortKey(const QString &string) const
 
@@ -390,6 +455,21 @@ QCollatorSortKey QCollator::defaultSortKey(QStringView key)
     \note Not supported with the C (a.k.a. POSIX) locale on Darwin.
 */
 
+/*!
+    \fn QList<QCollatorSortKey> QCollator::sortKeys(QSpan<const QString> strings) const
+    \since 6.9
+
+    Returns the sort keys for all of \a strings, in the same order.
+
+    This is equivalent to calling sortKey() for each entry of \a strings, but
+    amortizes the per-call setup over the whole batch; prefer it when keying
+    large lists for sorting.
+
+    \note Not supported with the C (a.k.a. POSIX) locale on Darwin.
+
+    \sa sortKey()
+*/
+
 /*!
     \class QCollatorSortKey
     \inmodule QtCore
@@ -8,6 +8,7 @@
 #include <QtCore/qstring.h>
 #include <QtCore/qstringlist.h>
 #include <QtCore/qlocale.h>
+#include <QtCore/qspan.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -84,6 +85,11 @@ public:
     { return compare(s1, s2) < 0; }
 
     QCollatorSortKey sortKey(const QString &string) const;
+    QList<QCollatorSortKey> sortKeys(QSpan<const QString> strings) const;
+
+    static QCollator cached(const QLocale &locale,
+                            Qt::CaseSensitivity caseSensitivity = Qt::CaseSensitive,
+                            bool numericMode = false, bool ignorePunctuation = false);
 
     static int defaultCompare(QStringView s1, QStringView s2);
     static QCollatorSortKey defaultSortKey(QStringView key);
@@ -6,6 +6,7 @@
 #include "qlocale_p.h"
 #include "qstringlist.h"
 #include "qstring.h"
+#include "qvarlengtharray.h"
 
 #include <unicode/utypes.h>
 #include <unicode/ucol.h>
@@ -114,6 +115,43 @@ QCollatorSortKey QCollator::sortKey(const QString &string) const
     return QCollatorSortKey(new QCollatorSortKeyPrivate(QByteArray()));
 }
 
+QList<QCollatorSortKey> QCollator::sortKeys(QSpan<const QString> strings) const
+{
+    d->ensureInitialized();
+
+    QList<QCollatorSortKey> result;
+    result.reserve(strings.size());
+
+    if (d->isC()) {
+        for (const QString &string : strings)
+            result.append(QCollatorSortKey(new QCollatorSortKeyPrivate(string.toUtf8())));
+        return result;
+    }
+
+    if (d->collator) {
+        // One scratch buffer for the whole batch; each key is then stored at
+        // its exact size, without sortKey()'s per-call estimate and retry.
+        QVarLengthArray<uint8_t, 4096> buffer(4096);
+        for (const QString &string : strings) {
+            // truncating sizes (QTBUG-105038)
+            int size = ucol_getSortKey(d->collator, (const UChar *)string.constData(),
+                                       string.size(), buffer.data(), int(buffer.size()));
+            if (size > buffer.size()) {
+                buffer.resize(size);
+                size = ucol_getSortKey(d->collator, (const UChar *)string.constData(),
+                                       string.size(), buffer.data(), int(buffer.size()));
+            }
+            result.append(QCollatorSortKey(new QCollatorSortKeyPrivate(
+                    QByteArray(reinterpret_cast<const char *>(buffer.constData()), size))));
+        }
+        return result;
+    }
+
+    for (qsizetype i = 0; i < strings.size(); ++i)
+        result.append(QCollatorSortKey(new QCollatorSortKeyPrivate(QByteArray())));
+    return result;
+}
+
 int QCollatorSortKey::compare(const QCollatorSortKey &otherKey) const
 {
     return qstrcmp(d->m_key, otherKey.d->m_key);
@@ -108,6 +108,15 @@ QCollatorSortKey QCollator::sortKey(const QString &string) const
     return QCollatorSortKey(new QCollatorSortKeyPrivate(std::move(ret)));
 }
 
+QList<QCollatorSortKey> QCollator::sortKeys(QSpan<const QString> strings) const
+{
+    QList<QCollatorSortKey> result;
+    result.reserve(strings.size());
+    for (const QString &string : strings)
+        result.append(sortKey(string));
+    return result;
+}
+
 int QCollatorSortKey::compare(const QCollatorSortKey &key) const
 {
     if (!d.data())
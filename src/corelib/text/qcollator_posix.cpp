@@ -86,6 +86,15 @@ QCollatorSortKey QCollator::sortKey(const QString &string) const
     return QCollatorSortKey(new QCollatorSortKeyPrivate(std::move(result)));
 }
 
+QList<QCollatorSortKey> QCollator::sortKeys(QSpan<const QString> strings) const
+{
+    QList<QCollatorSortKey> keys;
+    keys.reserve(strings.size());
+    for (const QString &string : strings)
+        keys.append(sortKey(string));
+    return keys;
+}
+
 int QCollatorSortKey::compare(const QCollatorSortKey &otherKey) const
 {
     return std::wcscmp(d->m_key.constData(), otherKey.d->m_key.constData());
@@ -113,6 +113,15 @@ QCollatorSortKey QCollator::sortKey(const QString &string) const
     return QCollatorSortKey(new QCollatorSortKeyPrivate(std::move(ret)));
 }
 
+QList<QCollatorSortKey> QCollator::sortKeys(QSpan<const QString> strings) const
+{
+    QList<QCollatorSortKey> result;
+    result.reserve(strings.size());
+    for (const QString &string : strings)
+        result.append(sortKey(string));
+    return result;
+}
+
 int QCollatorSortKey::compare(const QCollatorSortKey &otherKey) const
 {
     return d->m_key.compare(otherKey.d->m_key);
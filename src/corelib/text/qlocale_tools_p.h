@@ -43,6 +43,15 @@ enum StrayCharacterMode {
 [[nodiscard]] QSimpleParsedNumber<double>
 qt_asciiToDouble(const char *num, qsizetype numLen,
                  StrayCharacterMode strayCharMode = TrailingJunkProhibited);
+// Parses a whole delimiter-separated run of numbers (e.g. one CSV column) in
+// a single call, storing up to maxCount results in out. Fields may be padded
+// with whitespace, but must otherwise parse completely. Returns how many
+// fields were parsed; parsing stops early at the first malformed field. If
+// consumed is not null, *consumed is set to the number of bytes processed,
+// including the delimiter following the last parsed field.
+Q_CORE_EXPORT qsizetype
+qt_asciiToDoubles(const char *text, qsizetype len, char delimiter,
+                  double *out, qsizetype maxCount, qsizetype *consumed = nullptr);
 void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision,
                       char *buf, qsizetype bufSize,
                       bool &sign, int &length, int &decpt);
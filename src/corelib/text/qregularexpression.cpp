@@ -14,6 +14,7 @@
 #include <QtCore/qglobal.h>
 #include <QtCore/qatomic.h>
 #include <QtCore/qdatastream.h>
+#include <QtCore/private/qconcurrentcache_p.h>
 
 #if defined(Q_OS_MACOS)
 #include <QtCore/private/qcore_mac_p.h>
@@ -969,6 +970,64 @@ static pcre2_jit_stack_16 *qtPcreCallback(void *)
     return jitStacks.get();
 }
 
+/*
+    Per-thread reusable match state. Creating a match context and match data
+    on every doMatch() call costs two heap allocation/free pairs per match,
+    which dominates tight loops matching the same pattern repeatedly. The
+    match context carries the same JIT stack callback for every match, so each
+    thread keeps a single one; the match data is cached and reused for as long
+    as the pattern's ovector fits, growing when a pattern with more capturing
+    groups comes along.
+
+    doMatch() does not re-enter itself on the same thread (PCRE2 callouts are
+    not used), so handing out the thread-local objects is safe.
+*/
+namespace {
+struct PcreMatchContextFree
+{
+    void operator()(pcre2_match_context_16 *context)
+    {
+        if (context)
+            pcre2_match_context_free_16(context);
+    }
+};
+struct PcreMatchDataFree
+{
+    void operator()(pcre2_match_data_16 *matchData)
+    {
+        if (matchData)
+            pcre2_match_data_free_16(matchData);
+    }
+};
+Q_CONSTINIT static thread_local std::unique_ptr<pcre2_match_context_16, PcreMatchContextFree> matchContexts;
+Q_CONSTINIT static thread_local std::unique_ptr<pcre2_match_data_16, PcreMatchDataFree> cachedMatchData;
+Q_CONSTINIT static thread_local uint32_t cachedMatchDataOvecCount = 0;
+}
+
+/*!
+    \internal
+*/
+static pcre2_match_context_16 *qtPcreMatchContext()
+{
+    if (!matchContexts) {
+        matchContexts.reset(pcre2_match_context_create_16(nullptr));
+        pcre2_jit_stack_assign_16(matchContexts.get(), &qtPcreCallback, nullptr);
+    }
+    return matchContexts.get();
+}
+
+/*!
+    \internal
+*/
+static pcre2_match_data_16 *qtPcreMatchData(uint32_t ovecCount)
+{
+    if (!cachedMatchData || cachedMatchDataOvecCount < ovecCount) {
+        cachedMatchData.reset(pcre2_match_data_create_16(ovecCount, nullptr));
+        cachedMatchDataOvecCount = cachedMatchData ? ovecCount : 0;
+    }
+    return cachedMatchData.get();
+}
+
 /*!
     \internal
 */
@@ -1145,9 +1204,8 @@ void QRegularExpressionPrivate::doMatch(QRegularExpressionMatchPrivate *priv,
         previousMatchWasEmpty = true;
     }
 
-    pcre2_match_context_16 *matchContext = pcre2_match_context_create_16(nullptr);
-    pcre2_jit_stack_assign_16(matchContext, &qtPcreCallback, nullptr);
-    pcre2_match_data_16 *matchData = pcre2_match_data_create_from_pattern_16(compiledPattern, nullptr);
+    pcre2_match_context_16 *matchContext = qtPcreMatchContext();
+    pcre2_match_data_16 *matchData = qtPcreMatchData(uint32_t(capturingCount) + 1);
 
     // PCRE does not accept a null pointer as subject string, even if
     // its length is zero. We however allow it in input: a QStringView
@@ -1261,8 +1319,7 @@ void QRegularExpressionPrivate::doMatch(QRegularExpressionMatchPrivate *priv,
         }
     }
 
-    pcre2_match_data_free_16(matchData);
-    pcre2_match_context_free_16(matchContext);
+    // matchData and matchContext are thread-local and reused by the next match
 }
 
 /*!
@@ -1340,6 +1397,33 @@ QRegularExpression::QRegularExpression()
 {
 }
 
+/*
+    A process-wide cache of recently used privates, so that re-creating a
+    QRegularExpression from the same pattern string is a reference count bump
+    on a (possibly already compiled) private instead of a new PCRE2 compile.
+    Sharing the private is not observable from the outside: the mutating
+    setters detach, and lazy compilation already supports privates shared
+    between threads.
+*/
+namespace {
+struct PatternCacheKey
+{
+    QString pattern;
+    QRegularExpression::PatternOptions patternOptions;
+
+    friend bool operator==(const PatternCacheKey &lhs, const PatternCacheKey &rhs) noexcept
+    { return lhs.patternOptions == rhs.patternOptions && lhs.pattern == rhs.pattern; }
+    friend size_t qHash(const PatternCacheKey &key, size_t seed) noexcept
+    { return qHashMulti(seed, key.pattern, key.patternOptions.toInt()); }
+};
+} // unnamed namespace
+
+using QRegularExpressionPatternCache =
+        QConcurrentCache<PatternCacheKey, QExplicitlySharedDataPointer<QRegularExpressionPrivate>>;
+enum { PatternCacheMaxEntries = 512 };
+Q_GLOBAL_STATIC_WITH_ARGS(QRegularExpressionPatternCache, qt_patternCache,
+                          (PatternCacheMaxEntries))
+
 /*!
     Constructs a QRegularExpression object using the given \a pattern as
     pattern and the \a options as the pattern options.
@@ -1347,8 +1431,20 @@ QRegularExpression::QRegularExpression()
     \sa setPattern(), setPatternOptions()
 */
 QRegularExpression::QRegularExpression(const QString &pattern, PatternOptions options)
-    : d(new QRegularExpressionPrivate)
 {
+    if (!qt_patternCache.isDestroyed()) {
+        auto entry = qt_patternCache->objectOrInsert(PatternCacheKey{pattern, options}, [&] {
+            auto priv = new QRegularExpressionPrivate;
+            priv->pattern = pattern;
+            priv->patternOptions = options;
+            using CachedPointer = QExplicitlySharedDataPointer<QRegularExpressionPrivate>;
+            return std::pair(new CachedPointer(priv), qsizetype(1));
+        });
+        d = *entry;
+        return;
+    }
+
+    d = new QRegularExpressionPrivate;
     d->pattern = pattern;
     d->patternOptions = options;
 }
@@ -781,6 +781,186 @@ const char16_t *QtPrivate::qustrcasechr(QStringView str, char16_t c) noexcept
     return reinterpret_cast<const char16_t *>(it);
 }
 
+/*!
+ * \internal
+ *
+ * Searches \a haystack, starting at \a from, for the first occurrence of any
+ * of the characters in \a needles and returns its index, or -1 if none of
+ * them occurs. Matching is done code unit by code unit, so only characters
+ * from the Basic Multilingual Plane can be searched for.
+ */
+Q_NEVER_INLINE
+qsizetype QtPrivate::findFirstOf(QStringView haystack, qsizetype from, QStringView needles,
+                                 Qt::CaseSensitivity cs) noexcept
+{
+    if (from < 0)
+        from = qMax(from + haystack.size(), qsizetype(0));
+    if (from >= haystack.size() || needles.isEmpty())
+        return -1;
+
+    if (needles.size() == 1) {
+        const QStringView tail = haystack.sliced(from);
+        const char16_t c = needles.front().unicode();
+        const char16_t *it = cs == Qt::CaseSensitive ? qustrchr(tail, c) : qustrcasechr(tail, c);
+        return it == tail.utf16() + tail.size() ? -1 : from + (it - tail.utf16());
+    }
+
+    // fold the needles once, so the loops below only fold the haystack
+    QVarLengthArray<char16_t, 16> folded;
+    if (cs == Qt::CaseInsensitive) {
+        folded.resize(needles.size());
+        std::transform(needles.utf16(), needles.utf16() + needles.size(), folded.begin(),
+                       [](char16_t c) { return foldCase(c); });
+        needles = QStringView(folded.constData(), folded.size());
+    }
+    const char16_t *const nb = needles.utf16();
+
+    const char16_t *const b = haystack.utf16();
+    const char16_t *n = b + from;
+    const char16_t *const e = b + haystack.size();
+
+#ifdef __SSE2__
+    if (cs == Qt::CaseSensitive && needles.size() <= 8) {
+        __m128i mch[8];
+        for (qsizetype i = 0; i < needles.size(); ++i)
+            mch[i] = _mm_set1_epi16(nb[i]);
+
+        // we're going to read n[0..7] (16 bytes)
+        for (const char16_t *next = n + 8; next <= e; n = next, next += 8) {
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n));
+            __m128i result = _mm_cmpeq_epi16(data, mch[0]);
+            for (qsizetype i = 1; i < needles.size(); ++i)
+                result = _mm_or_si128(result, _mm_cmpeq_epi16(data, mch[i]));
+            const uint mask = uint(_mm_movemask_epi8(result));
+            if (mask)
+                return n - b + qCountTrailingZeroBits(mask) / 2;
+        }
+    }
+#elif defined(__ARM_NEON__)
+    if (cs == Qt::CaseSensitive && needles.size() <= 8) {
+        const uint16x8_t vmask = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+        for (const char16_t *next = n + 8; next <= e; n = next, next += 8) {
+            const uint16x8_t data = vld1q_u16(reinterpret_cast<const uint16_t *>(n));
+            uint16x8_t result = vceqq_u16(data, vdupq_n_u16(nb[0]));
+            for (qsizetype i = 1; i < needles.size(); ++i)
+                result = vorrq_u16(result, vceqq_u16(data, vdupq_n_u16(nb[i])));
+            const uint mask = vaddvq_u16(vandq_u16(result, vmask));
+            if (ushort(mask))
+                return n - b + qCountTrailingZeroBits(mask);
+        }
+    }
+#endif
+
+    for ( ; n != e; ++n) {
+        const char16_t c = cs == Qt::CaseSensitive ? *n : foldCase(*n);
+        if (std::char_traits<char16_t>::find(nb, needles.size(), c))
+            return n - b;
+    }
+    return -1;
+}
+
+/*!
+ * \internal
+ * \overload
+ */
+qsizetype QtPrivate::findFirstOf(QLatin1StringView haystack, qsizetype from, QStringView needles,
+                                 Qt::CaseSensitivity cs) noexcept
+{
+    if (from < 0)
+        from = qMax(from + haystack.size(), qsizetype(0));
+    if (from >= haystack.size() || needles.isEmpty())
+        return -1;
+
+    QVarLengthArray<char16_t, 16> folded;
+    if (cs == Qt::CaseInsensitive) {
+        folded.resize(needles.size());
+        std::transform(needles.utf16(), needles.utf16() + needles.size(), folded.begin(),
+                       [](char16_t c) { return foldCase(c); });
+        needles = QStringView(folded.constData(), folded.size());
+    }
+    const char16_t *const nb = needles.utf16();
+
+    const char *const d = haystack.data();
+    for (qsizetype i = from; i < haystack.size(); ++i) {
+        char16_t c = char16_t(uchar(d[i]));
+        if (cs == Qt::CaseInsensitive)
+            c = foldCase(c);
+        if (std::char_traits<char16_t>::find(nb, needles.size(), c))
+            return i;
+    }
+    return -1;
+}
+
+/*!
+ * \internal
+ *
+ * Returns the index of the first character in \a haystack, at or after
+ * \a from, for which QChar::isSpace() returns true, or -1 if there is none.
+ */
+Q_NEVER_INLINE
+qsizetype QtPrivate::findFirstSpace(QStringView haystack, qsizetype from) noexcept
+{
+    if (from < 0)
+        from = qMax(from + haystack.size(), qsizetype(0));
+    if (from >= haystack.size())
+        return -1;
+
+    const char16_t *const b = haystack.utf16();
+    const char16_t *n = b + from;
+    const char16_t *const e = b + haystack.size();
+
+#ifdef __SSE2__
+    // Prefilter: every space character is <= U+0020, U+0085, U+00A0 or
+    // >= U+1680, so eight characters outside those ranges can be rejected at
+    // a time. Candidates are then verified with QChar::isSpace().
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max20 = _mm_set1_epi16(0x20);
+    const __m128i m85 = _mm_set1_epi16(0x85);
+    const __m128i mA0 = _mm_set1_epi16(0xA0);
+    const __m128i max167F = _mm_set1_epi16(0x167f);
+
+    // we're going to read n[0..7] (16 bytes)
+    for (const char16_t *next = n + 8; next <= e; n = next, next += 8) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n));
+        __m128i result = _mm_cmpeq_epi16(_mm_subs_epu16(data, max20), zero);
+        result = _mm_or_si128(result, _mm_cmpeq_epi16(data, m85));
+        result = _mm_or_si128(result, _mm_cmpeq_epi16(data, mA0));
+        // the remaining space characters lie in [U+1680, U+3000], where the
+        // saturated difference is a small positive number:
+        result = _mm_or_si128(result, _mm_cmpgt_epi16(_mm_subs_epu16(data, max167F), zero));
+        uint mask = uint(_mm_movemask_epi8(result));
+        while (mask) {
+            const uint idx = qCountTrailingZeroBits(mask) / 2;
+            if (QChar::isSpace(n[idx]))
+                return n - b + idx;
+            mask &= ~(3U << (idx * 2));
+        }
+    }
+#endif
+
+    for ( ; n != e; ++n) {
+        if (QChar::isSpace(*n))
+            return n - b;
+    }
+    return -1;
+}
+
+/*!
+ * \internal
+ * \overload
+ */
+qsizetype QtPrivate::findFirstSpace(QLatin1StringView haystack, qsizetype from) noexcept
+{
+    if (from < 0)
+        from = qMax(from + haystack.size(), qsizetype(0));
+    const char *const d = haystack.data();
+    for (qsizetype i = from; i < haystack.size(); ++i) {
+        if (QChar::isSpace(char32_t(uchar(d[i]))))
+            return i;
+    }
+    return -1;
+}
+
 // Note: ptr on output may be off by one and point to a preceding US-ASCII
 // character. Usually harmless.
 bool qt_is_ascii(const char *&ptr, const char *end) noexcept
@@ -1199,8 +1379,28 @@ Q_NEVER_INLINE static int ucstricmp(qsizetype alen, const char16_t *a, qsizetype
     char32_t alast = 0;
     char32_t blast = 0;
     qsizetype l = qMin(alen, blen);
-    qsizetype i;
-    for (i = 0; i < l; ++i) {
+    qsizetype i = 0;
+
+    // Fast path for ASCII runs: ASCII folds to ASCII and is never part of a
+    // surrogate pair, so the case-folding context cannot span it.
+    for (; i < l; ++i) {
+        const char16_t ac = a[i];
+        const char16_t bc = b[i];
+        if ((ac | bc) >= 0x80)
+            break;
+        if (ac != bc) {
+            const int diff = QtMiscUtils::toAsciiLower(char(ac)) - QtMiscUtils::toAsciiLower(char(bc));
+            if (diff)
+                return diff;
+        }
+    }
+    if (i > 0) {
+        // re-establish the context the table-driven loop would have recorded
+        alast = a[i - 1];
+        blast = b[i - 1];
+    }
+
+    for (; i < l; ++i) {
 //         qDebug() << Qt::hex << alast << blast;
 //         qDebug() << Qt::hex << "*a=" << *a << "alast=" << alast << "folded=" << foldCase (*a, alast);
 //         qDebug() << Qt::hex << "*b=" << *b << "blast=" << blast << "folded=" << foldCase (*b, blast);
@@ -7188,7 +7388,24 @@ static QString convertCase(T &str, QUnicodeTables::Case which)
     while (e != p && e[-1].isHighSurrogate())
         --e;
 
-    QStringIterator it(p, e);
+    // Skip any ASCII prefix that this conversion cannot change: such
+    // characters need neither the property lookup nor, in the common
+    // "already converted" case, the detach.
+    const QChar *caseInvariantEnd = p;
+    if (which == QUnicodeTables::UpperCase || which == QUnicodeTables::LowerCase
+            || which == QUnicodeTables::CaseFold) {
+        while (caseInvariantEnd != e) {
+            const char16_t c = caseInvariantEnd->unicode();
+            if (c >= 0x80)
+                break;
+            if (which == QUnicodeTables::UpperCase ? (c >= 'a' && c <= 'z')
+                                                   : (c >= 'A' && c <= 'Z'))
+                break;
+            ++caseInvariantEnd;
+        }
+    }
+
+    QStringIterator it(p, caseInvariantEnd - p, e);
     while (it.hasNext()) {
         const char32_t uc = it.next();
         if (qGetProp(uc)->cases[which].diff) {
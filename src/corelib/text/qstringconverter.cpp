@@ -695,6 +695,19 @@ char16_t *QUtf8::convertToUnicode(char16_t *dst, QByteArrayView in, QStringConve
     if (!len)
         return dst;
 
+    // Two-stage fast path: with no state carried over from a previous chunk,
+    // validate the whole chunk in one (vectorized) pass and, if it is
+    // well-formed, transcode it with the stateless decoder. That avoids the
+    // per-sequence state bookkeeping below; malformed or truncated chunks fall
+    // back to the full stateful decoding.
+    if (state->remainingChars == 0 && !(state->internalState & HeaderDone)
+            && !(state->flags & QStringConverter::Flag::ConvertInitialBom)) {
+        if (isValidUtf8(in).isValidUtf8) {
+            dst = convertToUnicode(dst, in);
+            state->internalState |= HeaderDone;
+            return dst;
+        }
+    }
 
     char16_t replacement = QChar::ReplacementCharacter;
     if (state->flags & QStringConverter::Flag::ConvertInvalidToNull)
@@ -326,4 +326,52 @@ QT_BEGIN_NAMESPACE
     with CTAD instead.
 */
 
+/*!
+    \fn template <typename Haystack, typename...Flags> auto qTokenizeAnyOf(Haystack &&haystack, QStringView separators, Flags...flags)
+    \relates QStringTokenizer
+    \since 6.9
+
+    Factory function for a QStringTokenizer that splits the string \a haystack
+    into substrings wherever any of the characters in \a separators occurs,
+    and allows iteration over those strings as they are found. If none of the
+    characters matches anywhere in \a haystack, a single element containing
+    \a haystack is produced.
+
+    Each separator character matches one code unit at a time, so runs of
+    adjacent separators produce empty tokens; pass Qt::SkipEmptyParts to
+    collapse them. Characters outside the Basic Multilingual Plane cannot be
+    used as separators.
+
+    Like the tokenizer itself, this function performs no memory allocations;
+    \a separators is referenced, not copied, and must stay valid for as long
+    as the tokenizer is used.
+
+    Pass values from Qt::CaseSensitivity and Qt::SplitBehavior enumerators
+    as \a flags to modify the behavior of the tokenizer.
+
+    \code
+    for (QStringView line : qTokenizeAnyOf(data, u"\r\n", Qt::SkipEmptyParts))
+        use(line);
+    \endcode
+
+    \sa qTokenize(), qTokenizeWhitespace()
+*/
+
+/*!
+    \fn template <typename Haystack> auto qTokenizeWhitespace(Haystack &&haystack, Qt::SplitBehavior sb)
+    \relates QStringTokenizer
+    \since 6.9
+
+    Factory function for a QStringTokenizer that splits the string \a haystack
+    into substrings wherever a whitespace character occurs, as determined by
+    QChar::isSpace(), and allows iteration over those strings as they are
+    found.
+
+    Since runs of adjacent whitespace characters are usually meant to act as
+    a single separator, \a sb defaults to Qt::SkipEmptyParts, unlike the other
+    tokenizer factories.
+
+    \sa qTokenize(), qTokenizeAnyOf()
+*/
+
 QT_END_NAMESPACE
@@ -127,14 +127,44 @@ QT_END_INCLUDE_NAMESPACE
 namespace QtPrivate {
 namespace Tok {
 
+    // Pseudo-needles for character-class tokenization: AnyChar splits on
+    // every character contained in its view, WhitespaceChar on every
+    // character for which QChar::isSpace() returns true. Both match one code
+    // unit at a time, so runs of separators produce empty tokens, which
+    // Qt::SkipEmptyParts collapses.
+    struct AnyChar
+    {
+        QStringView chars;
+    };
+    struct WhitespaceChar {};
+
     constexpr qsizetype size(QChar) noexcept { return 1; }
+    constexpr qsizetype size(AnyChar) noexcept { return 1; }
+    constexpr qsizetype size(WhitespaceChar) noexcept { return 1; }
     template <typename String>
     constexpr qsizetype size(const String &s) noexcept { return static_cast<qsizetype>(s.size()); }
 
+    template <typename Haystack, typename Needle>
+    qsizetype findNeedle(Haystack haystack, Needle needle, qsizetype from,
+                         Qt::CaseSensitivity cs) noexcept
+    { return haystack.indexOf(needle, from, cs); }
+
+    template <typename Haystack>
+    qsizetype findNeedle(Haystack haystack, AnyChar needle, qsizetype from,
+                         Qt::CaseSensitivity cs) noexcept
+    { return QtPrivate::findFirstOf(haystack, from, needle.chars, cs); }
+
+    template <typename Haystack>
+    qsizetype findNeedle(Haystack haystack, WhitespaceChar, qsizetype from,
+                         Qt::CaseSensitivity) noexcept
+    { return QtPrivate::findFirstSpace(haystack, from); }
+
     template <typename String> struct ViewForImpl {};
     template <> struct ViewForImpl<QStringView>   { using type = QStringView; };
     template <> struct ViewForImpl<QLatin1StringView> { using type = QLatin1StringView; };
     template <> struct ViewForImpl<QChar>         { using type = QChar; };
+    template <> struct ViewForImpl<AnyChar>       { using type = AnyChar; };
+    template <> struct ViewForImpl<WhitespaceChar> { using type = WhitespaceChar; };
     template <> struct ViewForImpl<QString>     : ViewForImpl<QStringView> {};
     template <> struct ViewForImpl<QLatin1Char> : ViewForImpl<QChar> {};
     template <> struct ViewForImpl<char16_t>    : ViewForImpl<QChar> {};
@@ -387,6 +417,24 @@ qTokenize(Haystack &&h, Needle &&n, Flags...flags)
                                                            std::forward<Needle>(n),
                                                            flags...}; }
 
+template <typename Haystack, typename...Flags>
+[[nodiscard]] constexpr auto
+qTokenizeAnyOf(Haystack &&h, QStringView separators, Flags...flags)
+    noexcept(QtPrivate::Tok::is_nothrow_constructible_from<Haystack, QtPrivate::Tok::AnyChar>::value)
+    -> decltype(QtPrivate::Tok::TokenizerResult<Haystack, QtPrivate::Tok::AnyChar>{
+                    std::forward<Haystack>(h), QtPrivate::Tok::AnyChar{separators}, flags...})
+{ return QtPrivate::Tok::TokenizerResult<Haystack, QtPrivate::Tok::AnyChar>{
+        std::forward<Haystack>(h), QtPrivate::Tok::AnyChar{separators}, flags...}; }
+
+template <typename Haystack>
+[[nodiscard]] constexpr auto
+qTokenizeWhitespace(Haystack &&h, Qt::SplitBehavior sb = Qt::SkipEmptyParts)
+    noexcept(QtPrivate::Tok::is_nothrow_constructible_from<Haystack, QtPrivate::Tok::WhitespaceChar>::value)
+    -> decltype(QtPrivate::Tok::TokenizerResult<Haystack, QtPrivate::Tok::WhitespaceChar>{
+                    std::forward<Haystack>(h), QtPrivate::Tok::WhitespaceChar{}, sb})
+{ return QtPrivate::Tok::TokenizerResult<Haystack, QtPrivate::Tok::WhitespaceChar>{
+        std::forward<Haystack>(h), QtPrivate::Tok::WhitespaceChar{}, sb}; }
+
 template <typename Haystack, typename Needle>
 auto QStringTokenizerBase<Haystack, Needle>::next(tokenizer_state state) const noexcept -> next_result
 {
@@ -395,7 +443,7 @@ auto QStringTokenizerBase<Haystack, Needle>::next(tokenizer_state state) const n
             // already at end:
             return {{}, false, state};
         }
-        state.end = m_haystack.indexOf(m_needle, state.start + state.extra, m_cs);
+        state.end = QtPrivate::Tok::findNeedle(m_haystack, m_needle, state.start + state.extra, m_cs);
         Haystack result;
         if (state.end >= 0) {
             // token separator found => return intermediate element:
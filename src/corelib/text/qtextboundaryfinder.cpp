@@ -5,6 +5,8 @@
 
 #include <private/qunicodetools_p.h>
 
+#include <optional>
+
 QT_BEGIN_NAMESPACE
 
 static void init(QTextBoundaryFinder::BoundaryType type, QStringView str, QCharAttributes *attributes)
@@ -359,6 +361,77 @@ qsizetype QTextBoundaryFinder::toPreviousBoundary()
     return pos;
 }
 
+/*!
+  \since 6.9
+
+  Recomputes the break attributes for the text range from \a from to \a to
+  after the underlying character data has been modified in place.
+
+  This is only useful with the constructors taking a QStringView or a QChar
+  array: since QTextBoundaryFinder does not copy the string in that case, the
+  application can edit the characters it points to and then call this function
+  to bring the boundary analysis up to date without paying for a full
+  re-analysis of the whole string. The length of the string must not have
+  changed.
+
+  The affected range is internally extended to whole paragraphs (delimited by
+  newline characters), as text boundaries never depend on characters beyond
+  the enclosing paragraph.
+*/
+void QTextBoundaryFinder::recalculate(qsizetype from, qsizetype to)
+{
+    if (!attributes || sv.isEmpty())
+        return;
+
+    from = qBound(qsizetype(0), from, sv.size());
+    to = qBound(from, to, sv.size());
+
+    // Restarting the analysis is only safe at a position whose preceding
+    // context the break algorithms cannot see across. Right after a newline
+    // all of them are back in their start-of-text state, except for the
+    // numeric sequence tracking of TR#14's LB25, which skips newlines; an
+    // ASCII letter in front of the newline guarantees that state is empty too.
+    const auto isSafeAnchor = [this](qsizetype lf) {
+        if (lf == 0)
+            return true;
+        const char16_t prev = sv[lf - 1].unicode();
+        return (prev >= u'a' && prev <= u'z') || (prev >= u'A' && prev <= u'Z');
+    };
+
+    qsizetype start = 0;
+    for (qsizetype i = from; i > 0; --i) {
+        if (sv[i - 1] == u'\n' && isSafeAnchor(i - 1)) {
+            start = i;
+            break;
+        }
+    }
+
+    qsizetype end = sv.size();
+    for (qsizetype i = to; i < sv.size(); ++i) {
+        if (sv[i] == u'\n' && isSafeAnchor(i)) {
+            end = i + 1;
+            break;
+        }
+    }
+
+    // The entry at the right edge also carries attributes of the unchanged
+    // text that follows (and an interior init() would treat it as end of
+    // text), so keep it as it is.
+    std::optional<QCharAttributes> oldEnd;
+    if (end < sv.size())
+        oldEnd = attributes[end];
+
+    init(t, sv.mid(start, end - start), attributes + start);
+
+    if (oldEnd)
+        attributes[end] = *oldEnd;
+    if (t == Line && start > 0) {
+        // LB2 suppressed the break at the window's start of text, but in the
+        // full string this position follows a newline (LB5)
+        attributes[start].lineBreak = attributes[start].mandatoryBreak = true;
+    }
+}
+
 /*!
   Returns \c true if the object's position() is currently at a valid text boundary.
 */
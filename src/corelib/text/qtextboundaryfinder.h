@@ -56,6 +56,8 @@ public:
     qsizetype toNextBoundary();
     qsizetype toPreviousBoundary();
 
+    void recalculate(qsizetype from, qsizetype to);
+
     bool isAtBoundary() const;
     BoundaryReasons boundaryReasons() const;
 
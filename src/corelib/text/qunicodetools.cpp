@@ -5,6 +5,7 @@
 
 #include "qunicodetables_p.h"
 #include "qvarlengtharray.h"
+#include <private/qsimd_p.h>
 #if QT_CONFIG(library)
 #include "qlibrary.h"
 #endif
@@ -117,11 +118,77 @@ enum class State : uchar {
 
 } // namespace GB
 
+#ifdef __SSE2__
+// SIMD block classification for the fast paths below: 16 UTF-16 code units
+// resolved with a handful of vector compares instead of one properties()
+// lookup per character.
+
+// Returns true if all of the 16 code units at \a text are ASCII and none of
+// them is a carriage return.
+static bool isAsciiBlockWithoutCr(const char16_t *text)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i limit = _mm_set1_epi16(0x7f);
+    const __m128i cr = _mm_set1_epi16('\r');
+    uint result = 0xffff;
+    for (int half = 0; half < 2; ++half) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text) + half);
+        __m128i isAscii = _mm_cmpeq_epi16(_mm_subs_epu16(data, limit), zero);
+        __m128i isCr = _mm_cmpeq_epi16(data, cr);
+        result &= uint(_mm_movemask_epi8(_mm_andnot_si128(isCr, isAscii)));
+    }
+    return result == 0xffff;
+}
+
+// Returns true if all of the 16 code units at \a text are ASCII letters or
+// digits.
+static bool isAsciiAlnumBlock(const char16_t *text)
+{
+    const __m128i zero = _mm_setzero_si128();
+    uint result = 0xffff;
+    auto inRange = [=](__m128i data, char16_t first, int count) {
+        __m128i offset = _mm_sub_epi16(data, _mm_set1_epi16(first));
+        return _mm_cmpeq_epi16(_mm_subs_epu16(offset, _mm_set1_epi16(short(count - 1))), zero);
+    };
+    for (int half = 0; half < 2; ++half) {
+        __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text) + half);
+        __m128i isAlnum = _mm_or_si128(inRange(data, u'0', 10),
+                                       _mm_or_si128(inRange(data, u'A', 26),
+                                                    inRange(data, u'a', 26)));
+        result &= uint(_mm_movemask_epi8(isAlnum));
+    }
+    return result == 0xffff;
+}
+#endif // __SSE2__
+
 static void getGraphemeBreaks(const char16_t *string, qsizetype len, QCharAttributes *attributes)
 {
     QUnicodeTables::GraphemeBreakClass lcls = QUnicodeTables::GraphemeBreak_LF; // to meet GB1
     GB::State state = GB::State::Normal;
     for (qsizetype i = 0; i != len; ++i) {
+#ifdef __SSE2__
+        // Fast path: within a run of ASCII characters without CR there is a
+        // grapheme boundary at every position (the only ASCII classes are
+        // Any, LF and Control, and every pairing of those breaks), and the
+        // state machine stays in its Normal state. The preceding character
+        // must not be CR (GB3) or Prepend (GB9b).
+        if (state == GB::State::Normal
+                && lcls != QUnicodeTables::GraphemeBreak_CR
+                && lcls != QUnicodeTables::GraphemeBreak_Prepend
+                && i + 16 <= len && isAsciiBlockWithoutCr(string + i)) {
+            do {
+                for (int j = 0; j < 16; ++j)
+                    attributes[i + j].graphemeBoundary = true;
+                i += 16;
+            } while (i + 16 <= len && isAsciiBlockWithoutCr(string + i));
+            const char16_t last = string[i - 1];
+            lcls = last == u'\n' ? QUnicodeTables::GraphemeBreak_LF
+                 : last < 0x20 || last == 0x7f ? QUnicodeTables::GraphemeBreak_Control
+                 : QUnicodeTables::GraphemeBreak_Any;
+            if (i == len)
+                break;
+        }
+#endif
         qsizetype pos = i;
         char32_t ucs4 = string[i];
         if (QChar::isHighSurrogate(ucs4) && i + 1 != len) {
@@ -247,6 +314,22 @@ static void getWordBreaks(const char16_t *string, qsizetype len, QCharAttributes
     auto real_cls = cls; // Unaffected by WB4
 
     for (qsizetype i = 0; i != len; ++i) {
+#ifdef __SSE2__
+        // Fast path: after an ALetter or Numeric character, a run of ASCII
+        // letters and digits contains no word boundary at all (WB5, WB8,
+        // WB9, WB10), and no attributes need to be written for it.
+        if ((cls == QUnicodeTables::WordBreak_ALetter
+                    || cls == QUnicodeTables::WordBreak_Numeric)
+                && real_cls == cls && i + 16 <= len && isAsciiAlnumBlock(string + i)) {
+            do {
+                i += 16;
+            } while (i + 16 <= len && isAsciiAlnumBlock(string + i));
+            cls = real_cls = string[i - 1] <= u'9' ? QUnicodeTables::WordBreak_Numeric
+                                                   : QUnicodeTables::WordBreak_ALetter;
+            if (i == len)
+                break;
+        }
+#endif
         qsizetype pos = i;
         char32_t ucs4 = string[i];
         if (QChar::isHighSurrogate(ucs4) && i + 1 != len) {
@@ -13,6 +13,9 @@
 #include <QtCore/qfuture_impl.h>
 
 #include <type_traits>
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#  include <coroutine>
+#endif
 
 QT_REQUIRE_CONFIG(future);
 
@@ -541,6 +544,104 @@ static QFuture<T> makeReadyFuture()
 
 } // namespace QtFuture
 
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>) && !defined(QT_NO_EXCEPTIONS)
+
+namespace QtFuture {
+
+// Thrown by co_await on a future whose chain was canceled, or that finished
+// without producing the result it was awaited for.
+class CanceledException : public QException
+{
+public:
+    const char *what() const noexcept override { return "QFuture was canceled"; }
+    void raise() const override { throw *this; }
+    CanceledException *clone() const override { return new CanceledException(*this); }
+};
+
+} // namespace QtFuture
+
+namespace QtPrivate {
+
+template<class T>
+class FutureAwaiter
+{
+public:
+    explicit FutureAwaiter(QFuture<T> future, QObject *context = nullptr)
+        : m_future(std::move(future)), m_context(context)
+    {
+    }
+
+    bool await_ready() const
+    {
+        // With a context object, always resume through its event loop, so
+        // that the coroutine continues on the context's thread even when the
+        // future is already finished.
+        return !m_context && m_future.isFinished();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // The handler takes the future as argument, so it is also invoked
+        // when the chain failed, and onCanceled() covers cancellation without
+        // an exception: the coroutine always resumes, and await_resume()
+        // reports what happened.
+        auto resume = [handle](const QFuture<T> &) { handle.resume(); };
+        if (m_context) {
+            m_future.then(m_context, resume)
+                    .onCanceled(m_context, [handle] { handle.resume(); });
+        } else {
+            m_future.then(QtFuture::Launch::Sync, resume)
+                    .onCanceled([handle] { handle.resume(); });
+        }
+    }
+
+    T await_resume()
+    {
+        m_future.waitForFinished(); // already finished; rethrows a stored exception
+        if constexpr (std::is_void_v<T>) {
+            if (m_future.isCanceled())
+                throw QtFuture::CanceledException();
+        } else {
+            if (m_future.isCanceled() || m_future.resultCount() == 0)
+                throw QtFuture::CanceledException();
+            if constexpr (std::is_copy_constructible_v<T>)
+                return m_future.result();
+            else
+                return m_future.takeResult();
+        }
+    }
+
+private:
+    QFuture<T> m_future;
+    QObject *m_context;
+};
+
+} // namespace QtPrivate
+
+// Awaiting a QFuture suspends the coroutine until the future has finished and
+// yields the future's result. A stored exception is rethrown, and
+// cancellation is reported by throwing QtFuture::CanceledException. The
+// coroutine resumes in the thread that finished the future.
+template<class T>
+auto operator co_await(QFuture<T> future)
+{
+    return QtPrivate::FutureAwaiter<T>(std::move(future));
+}
+
+namespace QtFuture {
+
+// Like co_await on the future itself, but resumes the coroutine through the
+// event loop of \a context's thread.
+template<class T>
+auto await(QFuture<T> future, QObject *context)
+{
+    return QtPrivate::FutureAwaiter<T>(std::move(future), context);
+}
+
+} // namespace QtFuture
+
+#endif // __cpp_impl_coroutine && !QT_NO_EXCEPTIONS
+
 Q_DECLARE_SEQUENTIAL_ITERATOR(Future)
 
 QT_END_NAMESPACE
@@ -535,30 +535,34 @@ void Continuation<Function, ResultType, ParentResultType>::create(F &&func,
 
     fi.setLaunchAsync(launchAsync);
 
-    auto continuation = [func = std::forward<F>(func), fi, promise_ = QPromise(fi), pool,
-                         launchAsync](const QFutureInterfaceBase &parentData) mutable {
-        const auto parent = QFutureInterface<ParentResultType>(parentData).future();
-        Continuation<Function, ResultType, ParentResultType> *continuationJob = nullptr;
-        if (launchAsync) {
+    // The launch mode is known here, so use a dedicated callback for each
+    // mode instead of deciding at invocation time: the synchronous one runs
+    // the continuation right in the caller, so its job can live on the stack
+    // instead of being allocated on each invocation, and it doesn't need to
+    // capture the pool or the promise's future interface.
+    if (launchAsync) {
+        auto continuation = [func = std::forward<F>(func), fi, promise_ = QPromise(fi),
+                             pool](const QFutureInterfaceBase &parentData) mutable {
+            const auto parent = QFutureInterface<ParentResultType>(parentData).future();
             auto asyncJob = new AsyncContinuation<Function, ResultType, ParentResultType>(
                     std::forward<Function>(func), parent, std::move(promise_), pool);
             fi.setRunnable(asyncJob);
-            continuationJob = asyncJob;
-        } else {
-            continuationJob = new SyncContinuation<Function, ResultType, ParentResultType>(
+            // If the continuation is successfully launched, the job will be
+            // deleted by the QThreadPool which has started it.
+            if (!asyncJob->execute())
+                delete asyncJob;
+        };
+        f->d.setContinuation(ContinuationWrapper(std::move(continuation)), fi.d);
+    } else {
+        auto continuation = [func = std::forward<F>(func), promise_ = QPromise(fi)](
+                                    const QFutureInterfaceBase &parentData) mutable {
+            const auto parent = QFutureInterface<ParentResultType>(parentData).future();
+            SyncContinuation<Function, ResultType, ParentResultType> continuationJob(
                     std::forward<Function>(func), parent, std::move(promise_));
-        }
-
-        bool isLaunched = continuationJob->execute();
-        // If continuation is successfully launched, AsyncContinuation will be deleted
-        // by the QThreadPool which has started it. Synchronous continuation will be
-        // executed immediately, so it's safe to always delete it here.
-        if (!(launchAsync && isLaunched)) {
-            delete continuationJob;
-            continuationJob = nullptr;
-        }
-    };
-    f->d.setContinuation(ContinuationWrapper(std::move(continuation)), fi.d);
+            continuationJob.execute();
+        };
+        f->d.setContinuation(ContinuationWrapper(std::move(continuation)), fi.d);
+    }
 }
 
 template<typename Function, typename ResultType, typename ParentResultType>
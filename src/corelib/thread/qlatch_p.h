@@ -0,0 +1,199 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLATCH_P_H
+#define QLATCH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the implementation.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qfutex_p.h>
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
+#include <QtCore/qyieldcpu.h>
+
+QT_REQUIRE_CONFIG(thread);
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QLatch is a single-use countdown synchronization point, QBarrier its
+    reusable, phased counterpart (std::latch and std::barrier, essentially,
+    which we cannot rely on yet).
+
+    Both talk to the futex directly where the platform has one, so the
+    typical wake costs one syscall instead of the condition-variable plus
+    internal-mutex pair that QWaitCondition goes through, and both spin
+    briefly before sleeping because fork-join phases are frequently shorter
+    than the cost of a futex syscall. On platforms without futexes (see
+    QT_ALWAYS_USE_FUTEX in qfutex_p.h) they fall back to an internal
+    QWaitCondition.
+*/
+class QLatch
+{
+public:
+    explicit QLatch(int expected) noexcept : m_counter(expected) { }
+
+    void countDown(int n = 1) noexcept
+    {
+        const int remaining = m_counter.fetchAndSubOrdered(n) - n;
+        if (remaining > 0)
+            return;
+        // the full barrier in the RMW above orders the counter update
+        // against the waiter flag read (and the waiter's flag write
+        // against its counter read)
+        if (m_waiters.loadAcquire() != 0)
+            wakeWaiters();
+    }
+
+    bool tryWait() const noexcept { return m_counter.loadAcquire() <= 0; }
+
+    void wait() noexcept
+    {
+        if (tryWait())
+            return;
+        for (int spins = SpinCount; spins > 0; --spins) {
+            if (tryWait())
+                return;
+            qYieldCpu();
+        }
+        sleepUntilDone();
+    }
+
+    void arriveAndWait() noexcept
+    {
+        countDown();
+        wait();
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QLatch)
+
+    static constexpr int SpinCount = 1024;
+
+    void sleepUntilDone() noexcept
+    {
+        m_waiters.fetchAndStoreOrdered(1);
+        if (QtFutex::futexAvailable()) {
+            int value;
+            while ((value = m_counter.loadAcquire()) > 0)
+                QtFutex::futexWait(m_counter, value);
+        }
+#ifndef QT_ALWAYS_USE_FUTEX
+        else {
+            QMutexLocker locker(&m_mutex);
+            while (m_counter.loadAcquire() > 0)
+                m_condition.wait(&m_mutex);
+        }
+#endif
+    }
+
+    void wakeWaiters() noexcept
+    {
+        if (QtFutex::futexAvailable()) {
+            QtFutex::futexWakeAll(m_counter);
+        }
+#ifndef QT_ALWAYS_USE_FUTEX
+        else {
+            // taking the mutex serializes with a waiter that has checked the
+            // counter but not yet gone to sleep
+            QMutexLocker locker(&m_mutex);
+            m_condition.wakeAll();
+        }
+#endif
+    }
+
+    QBasicAtomicInteger<int> m_counter;
+    QBasicAtomicInteger<int> m_waiters = Q_BASIC_ATOMIC_INITIALIZER(0);
+#ifndef QT_ALWAYS_USE_FUTEX
+    QMutex m_mutex;
+    QWaitCondition m_condition;
+#endif
+};
+
+class QBarrier
+{
+public:
+    explicit QBarrier(int participants) noexcept
+        : m_participants(participants), m_pending(participants)
+    {
+    }
+
+    void arriveAndWait() noexcept
+    {
+        const quint32 phase = m_phase.loadAcquire();
+        if (m_pending.fetchAndSubOrdered(1) == 1) {
+            // last to arrive: rearm for the next phase, then release everyone
+            m_pending.storeRelaxed(m_participants);
+            m_phase.fetchAndAddOrdered(1);
+            if (m_waiters.fetchAndStoreOrdered(0) != 0)
+                wakeWaiters();
+        } else {
+            waitForPhase(phase);
+        }
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QBarrier)
+
+    static constexpr int SpinCount = 1024;
+
+    bool phasePassed(quint32 phase) const noexcept { return m_phase.loadAcquire() != phase; }
+
+    void waitForPhase(quint32 phase) noexcept
+    {
+        for (int spins = SpinCount; spins > 0; --spins) {
+            if (phasePassed(phase))
+                return;
+            qYieldCpu();
+        }
+        m_waiters.fetchAndStoreOrdered(1);
+        if (QtFutex::futexAvailable()) {
+            while (!phasePassed(phase))
+                QtFutex::futexWait(m_phase, phase);
+        }
+#ifndef QT_ALWAYS_USE_FUTEX
+        else {
+            QMutexLocker locker(&m_mutex);
+            while (!phasePassed(phase))
+                m_condition.wait(&m_mutex);
+        }
+#endif
+    }
+
+    void wakeWaiters() noexcept
+    {
+        if (QtFutex::futexAvailable()) {
+            QtFutex::futexWakeAll(m_phase);
+        }
+#ifndef QT_ALWAYS_USE_FUTEX
+        else {
+            QMutexLocker locker(&m_mutex);
+            m_condition.wakeAll();
+        }
+#endif
+    }
+
+    const int m_participants;
+    QBasicAtomicInteger<int> m_pending;
+    QBasicAtomicInteger<quint32> m_phase = Q_BASIC_ATOMIC_INITIALIZER(0U);
+    QBasicAtomicInteger<int> m_waiters = Q_BASIC_ATOMIC_INITIALIZER(0);
+#ifndef QT_ALWAYS_USE_FUTEX
+    QMutex m_mutex;
+    QWaitCondition m_condition;
+#endif
+};
+
+QT_END_NAMESPACE
+
+#endif // QLATCH_P_H
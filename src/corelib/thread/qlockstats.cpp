@@ -0,0 +1,161 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlockstats_p.h"
+
+#include <qhash.h>
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtLockStats {
+
+Q_CONSTINIT QBasicAtomicInt instrumentedLockCount = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+namespace {
+struct LockStats
+{
+    QByteArray name;
+    std::atomic<quint64> contendedAcquisitions{0};
+    std::atomic<quint64> totalWaitNsecs{0};
+    std::atomic<int> activeWaiters{0};
+    std::atomic<int> waiterHighWaterMark{0};
+};
+
+// The hooks below run inside the QMutex and QReadWriteLock slow paths, so
+// the registry must not be protected by either class (the registry's own
+// contention would re-enter the hooks and deadlock). The stats entries are
+// heap-allocated and updated through atomics, so the hooks only need the
+// lock in shared mode; they are deleted under the exclusive lock, which
+// waits out any hook still holding a shared lock on the registry.
+struct LockRegistry
+{
+    std::shared_mutex mutex;
+    QHash<const void *, LockStats *> locks;
+    ~LockRegistry() { qDeleteAll(locks); }
+};
+Q_GLOBAL_STATIC(LockRegistry, lockRegistry)
+} // unnamed namespace
+
+/*! \internal
+    Starts gathering contention statistics for \a lock, identified in
+    snapshots by \a name. Registering an already-registered lock just
+    replaces its name; the counters are kept.
+*/
+void registerLock(const void *lock, const char *name)
+{
+    LockRegistry *registry = lockRegistry();
+    if (!registry)
+        return;
+    std::unique_lock locker(registry->mutex);
+    LockStats *&stats = registry->locks[lock];
+    if (!stats) {
+        stats = new LockStats;
+        instrumentedLockCount.ref();
+    }
+    stats->name = name;
+}
+
+/*! \internal
+    Stops gathering statistics for \a lock and discards its counters.
+    Waiters that are blocked on \a lock at this point are no longer
+    accounted for when they wake up.
+*/
+void unregisterLock(const void *lock) noexcept
+{
+    LockRegistry *registry = lockRegistry();
+    if (!registry)
+        return;
+    std::unique_lock locker(registry->mutex);
+    if (LockStats *stats = registry->locks.take(lock)) {
+        delete stats;
+        instrumentedLockCount.deref();
+    }
+}
+
+/*! \internal
+    Returns the current statistics for all registered locks.
+*/
+QList<LockSnapshot> snapshot()
+{
+    QList<LockSnapshot> result;
+    LockRegistry *registry = lockRegistry();
+    if (!registry)
+        return result;
+    std::shared_lock locker(registry->mutex);
+    result.reserve(registry->locks.size());
+    for (auto it = registry->locks.cbegin(), end = registry->locks.cend(); it != end; ++it) {
+        const LockStats *stats = it.value();
+        result.append({ it.key(), stats->name,
+                        stats->contendedAcquisitions.load(std::memory_order_relaxed),
+                        stats->totalWaitNsecs.load(std::memory_order_relaxed),
+                        stats->waiterHighWaterMark.load(std::memory_order_relaxed) });
+    }
+    return result;
+}
+
+/*! \internal
+    Resets the counters of all registered locks. The waiter high-water mark
+    restarts from the number of threads currently waiting.
+*/
+void resetStatistics() noexcept
+{
+    LockRegistry *registry = lockRegistry();
+    if (!registry)
+        return;
+    std::shared_lock locker(registry->mutex);
+    for (LockStats *stats : std::as_const(registry->locks)) {
+        stats->contendedAcquisitions.store(0, std::memory_order_relaxed);
+        stats->totalWaitNsecs.store(0, std::memory_order_relaxed);
+        stats->waiterHighWaterMark.store(stats->activeWaiters.load(std::memory_order_relaxed),
+                                         std::memory_order_relaxed);
+    }
+}
+
+/*! \internal
+    Called when a thread enters the contended slow path of \a lock. Returns
+    \c true if the lock is registered, in which case the caller must report
+    the wait back through endWait().
+*/
+bool beginWait(const void *lock) noexcept
+{
+    LockRegistry *registry = lockRegistry();
+    if (!registry)
+        return false;
+    std::shared_lock locker(registry->mutex);
+    LockStats *stats = registry->locks.value(lock);
+    if (!stats)
+        return false;
+    const int waiters = ++stats->activeWaiters;
+    int peak = stats->waiterHighWaterMark.load(std::memory_order_relaxed);
+    while (waiters > peak
+           && !stats->waiterHighWaterMark.compare_exchange_weak(peak, waiters,
+                                                                std::memory_order_relaxed)) {
+    }
+    return true;
+}
+
+/*! \internal
+    Called when a thread leaves the contended slow path of \a lock after
+    having waited for \a waitNsecs nanoseconds.
+*/
+void endWait(const void *lock, qint64 waitNsecs) noexcept
+{
+    LockRegistry *registry = lockRegistry();
+    if (!registry)
+        return;
+    std::shared_lock locker(registry->mutex);
+    LockStats *stats = registry->locks.value(lock);
+    if (!stats)
+        return;
+    --stats->activeWaiters;
+    ++stats->contendedAcquisitions;
+    stats->totalWaitNsecs += quint64(qMax(waitNsecs, qint64(0)));
+}
+
+} // namespace QtLockStats
+
+QT_END_NAMESPACE
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLOCKSTATS_P_H
+#define QLOCKSTATS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of qmutex.cpp and qreadwritelock.cpp.  This header file may change
+// from version to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Opt-in contention statistics for QMutex and QReadWriteLock.
+
+    Locks are identified by their address; registering an address makes the
+    contended slow paths count blocking acquisitions, accumulate the time
+    spent waiting and track the waiter high-water mark for that lock. The
+    fast (uncontended) paths are unaffected, and unregistered locks only pay
+    for one relaxed atomic load on their slow path.
+*/
+namespace QtLockStats {
+
+struct LockSnapshot
+{
+    const void *lock;
+    QByteArray name;
+    quint64 contendedAcquisitions;
+    quint64 totalWaitNsecs;
+    int waiterHighWaterMark;
+};
+
+Q_CORE_EXPORT extern QBasicAtomicInt instrumentedLockCount;
+
+inline bool anyInstrumented() noexcept
+{
+    return instrumentedLockCount.loadRelaxed() != 0;
+}
+
+Q_CORE_EXPORT void registerLock(const void *lock, const char *name);
+Q_CORE_EXPORT void unregisterLock(const void *lock) noexcept;
+Q_CORE_EXPORT QList<LockSnapshot> snapshot();
+Q_CORE_EXPORT void resetStatistics() noexcept;
+
+// Hooks for the lock implementations; use WaitRecorder instead of calling
+// these directly.
+Q_CORE_EXPORT bool beginWait(const void *lock) noexcept;
+Q_CORE_EXPORT void endWait(const void *lock, qint64 waitNsecs) noexcept;
+
+class WaitRecorder
+{
+public:
+    explicit WaitRecorder(const void *lock) noexcept
+    {
+        if (Q_UNLIKELY(anyInstrumented()) && beginWait(lock)) {
+            m_lock = lock;
+            m_timer.start();
+        }
+    }
+    ~WaitRecorder()
+    {
+        if (Q_UNLIKELY(m_lock))
+            endWait(m_lock, m_timer.nsecsElapsed());
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(WaitRecorder)
+    const void *m_lock = nullptr;
+    QElapsedTimer m_timer;
+};
+
+} // namespace QtLockStats
+
+QT_END_NAMESPACE
+
+#endif // QLOCKSTATS_P_H
@@ -9,6 +9,7 @@
 #include <qdebug.h>
 #include "qatomic.h"
 #include "qfutex_p.h"
+#include "qlockstats_p.h"
 #include "qthread.h"
 #include "qmutex_p.h"
 
@@ -640,6 +641,8 @@ void QRecursiveMutex::unlock() noexcept
 void QBasicMutex::lockInternal() QT_MUTEX_LOCK_NOEXCEPT
 {
     if (futexAvailable()) {
+        QtLockStats::WaitRecorder waitRecorder(this);
+
         // note we must set to dummyFutexValue because there could be other threads
         // also waiting
         while (d_ptr.fetchAndStoreAcquire(dummyFutexValue()) != nullptr) {
@@ -675,12 +678,14 @@ bool QBasicMutex::lockInternal(QDeadlineTimer deadlineTimer) QT_MUTEX_LOCK_NOEXC
     if (deadlineTimer.hasExpired())
         return false;
 
-    if (futexAvailable()) {
-        if (Q_UNLIKELY(deadlineTimer.isForever())) {
-            lockInternal();
-            return true;
-        }
+    if (futexAvailable() && Q_UNLIKELY(deadlineTimer.isForever())) {
+        lockInternal(); // records its own contention statistics
+        return true;
+    }
 
+    QtLockStats::WaitRecorder waitRecorder(this);
+
+    if (futexAvailable()) {
         // The mutex is already locked, set a bit indicating we're waiting.
         // Note we must set to dummyFutexValue because there could be other threads
         // also waiting.
@@ -0,0 +1,70 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qreadmostlypointer_p.h"
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+Q_CONSTINIT static std::atomic<HazardSlots *> hazardSlotsHead{nullptr};
+
+static HazardSlots *claimHazardSlots()
+{
+    // Prefer reusing the block of an exited thread over growing the registry.
+    for (HazardSlots *block = hazardSlotsHead.load(std::memory_order_acquire); block;
+         block = block->next) {
+        bool expected = false;
+        if (block->claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return block;
+    }
+
+    auto *block = new HazardSlots;
+    block->claimed.store(true, std::memory_order_relaxed);
+    HazardSlots *head = hazardSlotsHead.load(std::memory_order_relaxed);
+    do {
+        block->next = head;
+    } while (!hazardSlotsHead.compare_exchange_weak(head, block, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+    return block;
+}
+
+ThreadHazardSlots::~ThreadHazardSlots()
+{
+    if (!block)
+        return;
+    for (auto &hazard : block->hazards)
+        hazard.store(nullptr, std::memory_order_relaxed);
+    block->claimed.store(false, std::memory_order_release);
+}
+
+/*! \internal
+    Returns the hazard slots of the current thread, claiming a block from the
+    registry on first use.
+*/
+ThreadHazardSlots *currentThreadHazard()
+{
+    thread_local ThreadHazardSlots tls;
+    if (!tls.block)
+        tls.block = claimHazardSlots();
+    return &tls;
+}
+
+/*! \internal
+    Returns \c true if any reader has \a pointer pinned in a hazard slot.
+*/
+bool isHazardous(const void *pointer) noexcept
+{
+    for (HazardSlots *block = hazardSlotsHead.load(std::memory_order_acquire); block;
+         block = block->next) {
+        for (const auto &hazard : block->hazards) {
+            if (hazard.load(std::memory_order_seq_cst) == pointer)
+                return true;
+        }
+    }
+    return false;
+}
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
@@ -0,0 +1,166 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QREADMOSTLYPOINTER_P_H
+#define QREADMOSTLYPOINTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the implementation.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/private/qlocking_p.h>
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qmutex.h>
+
+#include <atomic>
+
+QT_REQUIRE_CONFIG(thread);
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+
+// One block of hazard slots per reading thread. The blocks are linked into a
+// global registry and are never freed; a thread that exits releases its block
+// for reuse by a later thread (the same never-shrinks scheme as QFreeList).
+struct HazardSlots
+{
+    static constexpr int SlotCount = 8;
+    std::atomic<const void *> hazards[SlotCount] = {};
+    std::atomic<bool> claimed{false};
+    HazardSlots *next = nullptr;
+};
+
+struct ThreadHazardSlots
+{
+    // not named "slots": that's a macro inside Qt's own build
+    HazardSlots *block = nullptr;
+    int depth = 0;
+    Q_CORE_EXPORT ~ThreadHazardSlots();
+};
+
+Q_CORE_EXPORT ThreadHazardSlots *currentThreadHazard();
+Q_CORE_EXPORT bool isHazardous(const void *pointer) noexcept;
+
+} // namespace QtPrivate
+
+/*
+    QReadMostlyPointer shares a heap-allocated value between many readers and
+    occasional writers, RCU style.
+
+    Readers pin the current value with a ReadGuard; pinning publishes the
+    pointer into a per-thread hazard slot, so readers never perform a
+    read-modify-write on memory shared with other readers and scale without
+    cache-line ping-pong. A writer installs a new value with replace(), which
+    atomically swaps the pointer and retires the old value; a retired value
+    is deleted once no hazard slot refers to it any more, either by a later
+    replace() or by an explicit reclaim().
+
+    Read guards are cheap, but must be destroyed in LIFO order on each thread
+    and at most QtPrivate::HazardSlots::SlotCount of them may be live per
+    thread at once. The destructor requires that no readers are active and
+    deletes the current and all retired values.
+*/
+template <typename T>
+class QReadMostlyPointer
+{
+public:
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const QAtomicPointer<T> &source)
+        {
+            QtPrivate::ThreadHazardSlots *tls = QtPrivate::currentThreadHazard();
+            Q_ASSERT_X(tls->depth < QtPrivate::HazardSlots::SlotCount,
+                       "QReadMostlyPointer", "too many nested read guards");
+            m_tls = tls;
+            m_slot = &tls->block->hazards[tls->depth++];
+            for (;;) {
+                const T *candidate = source.loadAcquire();
+                // The hazard must be globally visible before we validate, so
+                // that a concurrent replace() either sees it when scanning or
+                // has already given us the new pointer; seq_cst orders the
+                // store with the load below.
+                m_slot->store(candidate, std::memory_order_seq_cst);
+                if (candidate == source.loadAcquire()) {
+                    m_pointer = candidate;
+                    break;
+                }
+            }
+        }
+        ~ReadGuard()
+        {
+            m_slot->store(nullptr, std::memory_order_release);
+            --m_tls->depth;
+        }
+
+        const T *get() const noexcept { return m_pointer; }
+        const T *operator->() const noexcept { return m_pointer; }
+        const T &operator*() const noexcept { return *m_pointer; }
+        explicit operator bool() const noexcept { return m_pointer != nullptr; }
+
+    private:
+        Q_DISABLE_COPY_MOVE(ReadGuard)
+        QtPrivate::ThreadHazardSlots *m_tls;
+        std::atomic<const void *> *m_slot;
+        const T *m_pointer;
+    };
+
+    QReadMostlyPointer() = default;
+    explicit QReadMostlyPointer(T *pointer) noexcept : m_current(pointer) { }
+    ~QReadMostlyPointer()
+    {
+        delete m_current.loadAcquire();
+        qDeleteAll(m_retired);
+    }
+
+    ReadGuard read() const { return ReadGuard(m_current); }
+
+    void replace(T *newValue)
+    {
+        T *old = m_current.fetchAndStoreOrdered(newValue);
+        if (!old)
+            return;
+        const auto locker = qt_scoped_lock(m_retireMutex);
+        m_retired.append(old);
+        sweepRetired();
+    }
+
+    // Deletes retired values that are no longer pinned by any reader.
+    void reclaim()
+    {
+        const auto locker = qt_scoped_lock(m_retireMutex);
+        sweepRetired();
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QReadMostlyPointer)
+
+    void sweepRetired()
+    {
+        m_retired.removeIf([](T *retired) {
+            if (QtPrivate::isHazardous(retired))
+                return false;
+            delete retired;
+            return true;
+        });
+    }
+
+    QAtomicPointer<T> m_current = nullptr;
+    QBasicMutex m_retireMutex;
+    QList<T *> m_retired;
+};
+
+QT_END_NAMESPACE
+
+#endif // QREADMOSTLYPOINTER_P_H
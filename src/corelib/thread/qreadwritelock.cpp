@@ -10,6 +10,7 @@
 #include "qreadwritelock_p.h"
 #include "private/qfreelist_p.h"
 #include "private/qlocking_p.h"
+#include "private/qlockstats_p.h"
 
 #include <algorithm>
 
@@ -241,6 +242,9 @@ Q_NEVER_INLINE static bool contendedTryLockForRead(QAtomicPointer<QReadWriteLock
             d = d_ptr.loadAcquire();
             continue;
         }
+        // &d_ptr is the address of the QReadWriteLock, which is how the lock
+        // is known to the contention statistics.
+        QtLockStats::WaitRecorder waitRecorder(&d_ptr);
         return d->lockForRead(lock, timeout);
     }
 }
@@ -346,6 +350,7 @@ Q_NEVER_INLINE static bool contendedTryLockForWrite(QAtomicPointer<QReadWriteLoc
             d = d_ptr.loadAcquire();
             continue;
         }
+        QtLockStats::WaitRecorder waitRecorder(&d_ptr);
         return d->lockForWrite(lock, timeout);
     }
 }
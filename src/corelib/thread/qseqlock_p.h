@@ -0,0 +1,98 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSEQLOCK_P_H
+#define QSEQLOCK_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the implementation.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/private/qlocking_p.h>
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qyieldcpu.h>
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+QT_REQUIRE_CONFIG(thread);
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QSeqLock protects a small, trivially copyable value with a sequence lock.
+
+    Readers copy the value out and validate the copy against a sequence
+    counter, retrying in the rare case that a writer interfered; they never
+    write to shared memory, so read-mostly values scale across cores without
+    the cache-line ping-pong that the reader-side RMW of a QReadWriteLock
+    causes. Writers are serialized with a QBasicMutex and bump the sequence
+    counter to an odd value around the update, which is what readers detect.
+
+    Readers loop until they observe a consistent value, so a reader that
+    preempts the writer between the two counter updates just spins; keep the
+    protected value small and the writes rare, which is the workload this
+    class is for.
+*/
+template <typename T>
+class QSeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "QSeqLock only supports trivially copyable types");
+
+public:
+    constexpr QSeqLock() noexcept : m_value() { }
+    explicit constexpr QSeqLock(const T &value) noexcept : m_value(value) { }
+
+    T loadAcquire() const noexcept
+    {
+        T result;
+        for (;;) {
+            const unsigned before = m_sequence.loadAcquire();
+            if (before & 1) {
+                // a write is in progress
+                qYieldCpu();
+                continue;
+            }
+            std::memcpy(&result, &m_value, sizeof(T));
+            // Order the copy above before re-reading the sequence counter
+            // below, so a concurrent write cannot go unnoticed.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.loadRelaxed() == before)
+                return result;
+        }
+    }
+
+    void storeRelease(const T &value) noexcept
+    {
+        const auto locker = qt_scoped_lock(m_writerMutex);
+        const unsigned sequence = m_sequence.loadRelaxed();
+        m_sequence.storeRelaxed(sequence + 1); // odd: write in progress
+        // Keep the data update below from being reordered before the odd
+        // store above; otherwise a reader could accept a torn copy.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::memcpy(&m_value, &value, sizeof(T));
+        m_sequence.storeRelease(sequence + 2); // even again: value consistent
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QSeqLock)
+
+    mutable QBasicAtomicInteger<unsigned> m_sequence = Q_BASIC_ATOMIC_INITIALIZER(0U);
+    QBasicMutex m_writerMutex;
+    T m_value;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSEQLOCK_P_H
@@ -789,6 +789,56 @@ QThread::Priority QThread::priority() const
     return Priority(d->priority & 0xffff);
 }
 
+/*!
+    \since 6.9
+
+    Requests that this thread run only on the logical processors listed in
+    \a cpus. Processors are identified by the numbers the operating system
+    assigns to them, starting at 0.
+
+    If the thread is running, the new affinity is applied immediately;
+    otherwise it is stored and applied when the thread starts. Passing an
+    empty list removes any earlier restriction, allowing the thread to run
+    on any processor available to the process.
+
+    Returns \c true if the request was accepted. Returns \c false on
+    platforms without support for setting thread affinity, or if the
+    operating system rejected the processor set (for example because none
+    of the listed processors exist or are available to the process).
+
+    Restricting a thread to a fixed set of processors can keep its caches
+    warm and its scheduling latency stable, but it also prevents the
+    operating system from balancing load, so it is best reserved for
+    latency-critical threads on machines you control.
+
+    \sa cpuAffinity(), setPriority(), idealThreadCount()
+*/
+bool QThread::setCpuAffinity(const QList<int> &cpus)
+{
+    Q_D(QThread);
+    QMutexLocker locker(&d->mutex);
+    d->requestedCpuAffinity = cpus;
+    if (d->threadState != QThreadPrivate::Running)
+        return QThreadPrivate::cpuAffinitySupported();
+    return d->applyCpuAffinity();
+}
+
+/*!
+    \since 6.9
+
+    Returns the list of logical processors this thread was restricted to
+    with setCpuAffinity(), or an empty list if no restriction has been
+    requested.
+
+    \sa setCpuAffinity()
+*/
+QList<int> QThread::cpuAffinity() const
+{
+    Q_D(const QThread);
+    QMutexLocker locker(&d->mutex);
+    return d->requestedCpuAffinity;
+}
+
 /*!
     \fn void QThread::sleep(std::chrono::nanoseconds nsecs)
     \since 6.6
@@ -54,6 +54,9 @@ public:
     void setPriority(Priority priority);
     Priority priority() const;
 
+    bool setCpuAffinity(const QList<int> &cpus);
+    QList<int> cpuAffinity() const;
+
     bool isFinished() const;
     bool isRunning() const;
 
@@ -179,6 +179,8 @@ public:
     ~QThreadPrivate();
 
     void setPriority(QThread::Priority prio);
+    bool applyCpuAffinity();
+    static bool cpuAffinitySupported() noexcept;
     Qt::HANDLE threadId() const noexcept;
 
     mutable QMutex mutex;
@@ -203,6 +205,7 @@ public:
 
     uint stackSize = 0;
     std::underlying_type_t<QThread::Priority> priority = QThread::InheritPriority;
+    QList<int> requestedCpuAffinity;
 
 #ifdef Q_OS_UNIX
     QWaitCondition thread_done;
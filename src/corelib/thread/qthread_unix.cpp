@@ -303,6 +303,10 @@ void *QThreadPrivate::start(void *arg)
                 thr->d_func()->setPriority(QThread::Priority(thr->d_func()->priority & ~ThreadPriorityResetFlag));
             }
 
+            // was an affinity requested before the thread started?
+            if (!thr->d_func()->requestedCpuAffinity.isEmpty())
+                thr->d_func()->applyCpuAffinity();
+
             // threadId is set in QThread::start()
             Q_ASSERT(pthread_equal(from_HANDLE<pthread_t>(data->threadId.loadRelaxed()),
                                    pthread_self()));
@@ -859,6 +863,40 @@ void QThreadPrivate::setPriority(QThread::Priority threadPriority)
 #endif
 }
 
+// Caller must lock the mutex; the thread must be running
+bool QThreadPrivate::applyCpuAffinity()
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (requestedCpuAffinity.isEmpty()) {
+        // an empty set means "no restriction": allow every processor
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            CPU_SET(cpu, &cpuSet);
+    } else {
+        for (int cpu : std::as_const(requestedCpuAffinity)) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &cpuSet);
+        }
+        if (CPU_COUNT(&cpuSet) == 0)
+            return false;
+    }
+    return pthread_setaffinity_np(from_HANDLE<pthread_t>(data->threadId.loadRelaxed()),
+                                  sizeof(cpuSet), &cpuSet) == 0;
+#else
+    return false;
+#endif
+}
+
+bool QThreadPrivate::cpuAffinitySupported() noexcept
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    return true;
+#else
+    return false;
+#endif
+}
+
 #endif // QT_CONFIG(thread)
 
 QT_END_NAMESPACE
@@ -460,6 +460,11 @@ void QThread::start(Priority priority)
         qErrnoWarning("QThread::start: Failed to set thread priority");
     }
 
+    // the thread is still suspended, so any requested affinity applies
+    // before user code runs
+    if (!d->requestedCpuAffinity.isEmpty())
+        d->applyCpuAffinity();
+
     if (ResumeThread(d->handle) == (DWORD) -1) {
         qErrnoWarning("QThread::start: Failed to resume new thread");
     }
@@ -586,6 +591,36 @@ void QThreadPrivate::setPriority(QThread::Priority threadPriority)
     }
 }
 
+// Caller must lock the mutex; the thread must have been created
+bool QThreadPrivate::applyCpuAffinity()
+{
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+        return false;
+
+    DWORD_PTR mask = 0;
+    if (requestedCpuAffinity.isEmpty()) {
+        // an empty set means "no restriction": allow every processor
+        // available to the process
+        mask = processMask;
+    } else {
+        for (int cpu : std::as_const(requestedCpuAffinity)) {
+            if (cpu >= 0 && size_t(cpu) < sizeof(DWORD_PTR) * 8)
+                mask |= DWORD_PTR(1) << cpu;
+        }
+        mask &= processMask;
+        if (mask == 0)
+            return false;
+    }
+    return SetThreadAffinityMask(handle, mask) != 0;
+}
+
+bool QThreadPrivate::cpuAffinitySupported() noexcept
+{
+    return true;
+}
+
 #endif // QT_CONFIG(thread)
 
 QT_END_NAMESPACE
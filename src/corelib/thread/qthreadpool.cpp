@@ -190,13 +190,20 @@ inline bool comparePriority(int priority, const QueuePage *p)
 void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
 {
     Q_ASSERT(runnable != nullptr);
-    for (QueuePage *page : std::as_const(queue)) {
+    // The queue is sorted by priority (descending), and only the last page of
+    // a given priority can have room: any earlier page was full when the page
+    // after it was created, and pages never shrink. So the insertion point
+    // found by binary search is all we need to look at; scanning the whole
+    // queue would serialize submitters on long queues for no benefit.
+    const auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority,
+                                     comparePriority);
+    if (it != queue.constBegin()) {
+        QueuePage *page = *std::prev(it);
         if (page->priority() == priority && !page->isFull()) {
             page->push(runnable);
             return;
         }
     }
-    auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority, comparePriority);
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
 }
 
@@ -252,6 +259,13 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     ++activeThreads;
 
     thread->runnable = runnable;
+    if (!workerCpuAffinity.isEmpty()) {
+        // distribute new workers round-robin over the configured processors;
+        // the pin sticks to the QThread object, so a worker that expires and
+        // is restarted keeps its processor
+        thread->setCpuAffinity({ workerCpuAffinity.at(nextWorkerCpu) });
+        nextWorkerCpu = (nextWorkerCpu + 1) % workerCpuAffinity.size();
+    }
     thread.release()->start(threadPriority);
 }
 
@@ -730,6 +744,42 @@ QThread::Priority QThreadPool::threadPriority() const
     return d->threadPriority;
 }
 
+/*! \property QThreadPool::workerCpuAffinity
+    \brief the logical processors new worker threads are pinned to.
+
+    When the list is not empty, each new worker thread is restricted to a
+    single processor from the list, assigned round-robin in the order the
+    workers are created. A worker keeps its processor if it expires and is
+    later restarted, so pipelines that rely on warm, pinned workers are not
+    disturbed by the pool's thread recycling.
+
+    The value of the property is only used when the thread pool starts
+    new threads. Changing it has no effect for already running threads.
+
+    The default value is an empty list, which leaves worker placement to
+    the operating system. On platforms without support for thread
+    affinity the list is ignored.
+
+    \sa QThread::setCpuAffinity()
+
+    \since 6.9
+*/
+
+void QThreadPool::setWorkerCpuAffinity(const QList<int> &cpus)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    d->workerCpuAffinity = cpus;
+    d->nextWorkerCpu = 0;
+}
+
+QList<int> QThreadPool::workerCpuAffinity() const
+{
+    Q_D(const QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    return d->workerCpuAffinity;
+}
+
 /*!
     Releases a thread previously reserved by a call to reserveThread().
 
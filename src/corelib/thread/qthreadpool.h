@@ -27,6 +27,7 @@ class Q_CORE_EXPORT QThreadPool : public QObject
     Q_PROPERTY(int activeThreadCount READ activeThreadCount)
     Q_PROPERTY(uint stackSize READ stackSize WRITE setStackSize)
     Q_PROPERTY(QThread::Priority threadPriority READ threadPriority WRITE setThreadPriority)
+    Q_PROPERTY(QList<int> workerCpuAffinity READ workerCpuAffinity WRITE setWorkerCpuAffinity)
     friend class QFutureInterfaceBase;
 
 public:
@@ -69,6 +70,9 @@ public:
     void setThreadPriority(QThread::Priority priority);
     QThread::Priority threadPriority() const;
 
+    void setWorkerCpuAffinity(const QList<int> &cpus);
+    QList<int> workerCpuAffinity() const;
+
     void reserveThread();
     void releaseThread();
 
@@ -149,6 +149,8 @@ public:
     int activeThreads = 0;
     uint stackSize = 0;
     QThread::Priority threadPriority = QThread::InheritPriority;
+    QList<int> workerCpuAffinity;
+    qsizetype nextWorkerCpu = 0;
 };
 
 QT_END_NAMESPACE
@@ -97,32 +97,27 @@ using ParsedInt = QSimpleParsedNumber<qulonglong>;
 /*
     Reads a whole number that must be the whole text.
 */
-ParsedInt readInt(QLatin1StringView text)
-{
-    // Various date formats' fields (e.g. all in ISO) should not accept spaces
-    // or signs, so check that the string starts with a digit and that qstrntoull()
-    // converted the whole string.
-
-    if (text.isEmpty() || !isAsciiDigit(text.front().toLatin1()))
-        return {};
-
-    QSimpleParsedNumber res = qstrntoull(text.data(), text.size(), 10);
-    return res.used == text.size() ? res : ParsedInt{};
-}
-
 ParsedInt readInt(QStringView text)
 {
+    // QStringView::toULongLong() can't be used here as it will happily ignore
+    // spaces and accept signs; but various date formats' fields (e.g. all in
+    // ISO) should not. Accumulate the digits directly instead of converting
+    // to Latin-1 first: this runs once per field when parsing a date-time, so
+    // the scratch buffer and conversion pass were a measurable cost.
     if (text.isEmpty())
         return {};
 
-    // Converting to Latin-1 because QStringView::toULongLong() works with
-    // US-ASCII only by design anyway.
-    // Also QStringView::toULongLong() can't be used here as it will happily ignore
-    // spaces and accept signs; but various date formats' fields (e.g. all in ISO)
-    // should not.
-    QVarLengthArray<char> latin1(text.size());
-    QLatin1::convertFromUnicode(latin1.data(), text);
-    return readInt(QLatin1StringView{latin1.data(), latin1.size()});
+    qulonglong value = 0;
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        const char16_t ch = text[i].unicode();
+        if (ch < u'0' || ch > u'9')
+            return {};
+        if (Q_UNLIKELY(qMulOverflow(value, qulonglong(10), &value)
+                       || qAddOverflow(value, qulonglong(ch - u'0'), &value))) {
+            return {};
+        }
+    }
+    return { value, text.size() };
 }
 
 } // namespace
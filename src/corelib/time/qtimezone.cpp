@@ -1063,6 +1063,71 @@ int QTimeZone::offsetFromUtc(const QDateTime &atDateTime) const
     return 0;
 }
 
+/*!
+    \since 6.9
+
+    Returns the total effective offset from UTC, in seconds, at each of the
+    given \a msecsSinceEpoch times, i.e. the number of seconds to add to UTC
+    to obtain the local time at that instant. The result has one entry per
+    input time, in the same order.
+
+    This is equivalent to calling offsetFromUtc() for each time, but amortizes
+    the cost of looking up the zone's transition table: each lookup's result
+    is reused for later inputs that fall before the next transition. Sorting
+    the input times makes converting large series — for example the timestamp
+    column of a report — considerably cheaper than converting them one by one.
+
+    \sa offsetFromUtc(), transitions()
+*/
+QList<int> QTimeZone::offsetsFromUtc(QSpan<const qint64> msecsSinceEpoch) const
+{
+    QList<int> result;
+    result.reserve(msecsSinceEpoch.size());
+    if (d.isShort()) {
+        switch (d.s.spec()) {
+        case Qt::LocalTime:
+            return systemTimeZone().offsetsFromUtc(msecsSinceEpoch);
+        case Qt::UTC:
+        case Qt::OffsetFromUTC:
+            result.resize(msecsSinceEpoch.size(), d.s.offset);
+            return result;
+        case Qt::TimeZone:
+            Q_UNREACHABLE();
+            break;
+        }
+    }
+    if (!isValid()) {
+        result.resize(msecsSinceEpoch.size(), 0);
+        return result;
+    }
+
+    const bool hasTransitions = d->hasTransitions();
+    // the offset is constant on [windowStart, windowEnd)
+    qint64 windowStart = 0, windowEnd = 0;
+    int offset = 0;
+    bool windowValid = false;
+    for (qint64 when : msecsSinceEpoch) {
+        if (!windowValid || when < windowStart || when >= windowEnd) {
+            const QTimeZonePrivate::Data data = d->data(when);
+            if (data.offsetFromUtc == QTimeZonePrivate::invalidSeconds()) {
+                result.append(0);
+                continue;
+            }
+            offset = data.offsetFromUtc;
+            windowStart = when;
+            windowEnd = QTimeZonePrivate::maxMSecs();
+            if (hasTransitions) {
+                const QTimeZonePrivate::Data next = d->nextTransition(when);
+                if (next.atMSecsSinceEpoch != QTimeZonePrivate::invalidMSecs())
+                    windowEnd = next.atMSecsSinceEpoch;
+            }
+            windowValid = true;
+        }
+        result.append(offset);
+    }
+    return result;
+}
+
 /*!
     Returns the standard time offset at the given \a atDateTime, i.e. the
     number of seconds to add to UTC to obtain the local Standard Time.  This
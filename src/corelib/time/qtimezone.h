@@ -8,6 +8,7 @@
 #include <QtCore/qcompare.h>
 #include <QtCore/qdatetime.h>
 #include <QtCore/qlocale.h>
+#include <QtCore/qspan.h>
 #include <QtCore/qswap.h>
 #include <QtCore/qtclasshelpermacros.h>
 
@@ -184,6 +185,7 @@ public:
     QString abbreviation(const QDateTime &atDateTime) const;
 
     int offsetFromUtc(const QDateTime &atDateTime) const;
+    QList<int> offsetsFromUtc(QSpan<const qint64> msecsSinceEpoch) const;
     int standardTimeOffset(const QDateTime &atDateTime) const;
     int daylightTimeOffset(const QDateTime &atDateTime) const;
 
@@ -3,13 +3,20 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include <QtCore/qarraydata.h>
+#include <QtCore/private/qarraydataarena_p.h>
 #include <QtCore/private/qnumeric_p.h>
 #include <QtCore/private/qtools_p.h>
 #include <QtCore/qmath.h>
+#ifndef QT_BOOTSTRAPPED
+#include <QtCore/qtracecounter.h>
+#endif
 
 #include <QtCore/qbytearray.h>  // QBA::value_type
 #include <QtCore/qstring.h>  // QString::value_type
 
+#include <limits>
+#include <utility>
+
 #include <stdlib.h>
 
 QT_BEGIN_NAMESPACE
@@ -134,12 +141,109 @@ calculateBlockSize(qsizetype capacity, qsizetype objectSize, qsizetype headerSiz
     }
 }
 
+static thread_local QArrayDataArena *currentArena = nullptr;
+
+QArrayDataArena::QArrayDataArena(qsizetype chunkSize) noexcept
+    : chunkSize(qMax(chunkSize, qsizetype(256)))
+{
+}
+
+QArrayDataArena::~QArrayDataArena()
+{
+    // destroying the arena while it is still active on this thread would
+    // leave currentArena dangling
+    Q_ASSERT(current() != this);
+
+    while (chunks) {
+        Chunk *next = chunks->next;
+        ::free(chunks);
+        chunks = next;
+    }
+}
+
+static constexpr qsizetype arenaAlignUp(qsizetype value, qsizetype alignment) noexcept
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+void *QArrayDataArena::allocate(qsizetype size) noexcept
+{
+    constexpr qsizetype Alignment = qsizetype(QtPrivate::MaxPrimitiveAlignment);
+    constexpr qsizetype PayloadOffset = arenaAlignUp(qsizetype(sizeof(Chunk)), Alignment);
+
+    if (size_t(size) > size_t(std::numeric_limits<qsizetype>::max()) - Alignment)
+        return nullptr;
+    size = arenaAlignUp(size, Alignment);
+
+    Chunk *c = chunks;
+    if (!c || c->size - c->used < size) {
+        c = grow(size);
+        if (!c)
+            return nullptr;
+    }
+    void *result = reinterpret_cast<char *>(c) + PayloadOffset + c->used;
+    c->used += size;
+    return result;
+}
+
+QArrayDataArena::Chunk *QArrayDataArena::grow(qsizetype payload) noexcept
+{
+    constexpr qsizetype Alignment = qsizetype(QtPrivate::MaxPrimitiveAlignment);
+    constexpr qsizetype PayloadOffset = arenaAlignUp(qsizetype(sizeof(Chunk)), Alignment);
+
+    const qsizetype bytes = qMax(payload, chunkSize);
+    size_t allocSize;
+    if (Q_UNLIKELY(qAddOverflow(size_t(bytes), size_t(PayloadOffset), &allocSize))
+            || Q_UNLIKELY(qsizetype(allocSize) < 0))
+        return nullptr;
+
+    Chunk *c = static_cast<Chunk *>(::malloc(allocSize));
+    if (!c)
+        return nullptr;
+    c->next = chunks;
+    c->used = 0;
+    c->size = bytes;
+    chunks = c;
+    totalBytes += qsizetype(allocSize);
+    return c;
+}
+
+QArrayDataArena *QArrayDataArena::current() noexcept
+{
+    return currentArena;
+}
+
+QArrayDataArena::Scope::Scope(QArrayDataArena &arena) noexcept
+    : previous(std::exchange(currentArena, &arena))
+{
+}
+
+QArrayDataArena::Scope::~Scope()
+{
+    currentArena = previous;
+}
+
+#ifndef QT_BOOTSTRAPPED
+static QTraceCounter qtArrayAllocationsCounter("qarraydata.allocations");
+#endif
+
 static QArrayData *allocateData(qsizetype allocSize)
 {
-    QArrayData *header = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
+#ifndef QT_BOOTSTRAPPED
+    qtArrayAllocationsCounter.increment();
+#endif
+    QArrayData::ArrayOptions flags = {};
+    QArrayData *header = nullptr;
+    if (QArrayDataArena *arena = QArrayDataArena::current()) {
+        header = static_cast<QArrayData *>(arena->allocate(allocSize));
+        if (header)
+            flags = QArrayData::ArenaAllocated;
+    }
+    if (!header)
+        header = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
     if (header) {
         header->ref_.storeRelaxed(1);
-        header->flags = {};
+        header->flags = flags;
         header->alloc = 0;
     }
     return header;
@@ -241,6 +345,35 @@ QArrayData::reallocateUnaligned(QArrayData *data, void *dataPointer,
     Q_ASSERT(offset > 0);
     Q_ASSERT(offset <= allocSize); // equals when all free space is at the beginning
 
+    if (data && (data->flags & QArrayData::ArenaAllocated)) {
+        // arena memory cannot be realloc()ed: grab a fresh block and copy the
+        // old one over. The old block is reclaimed when its arena is destroyed.
+        constexpr qsizetype FooterSize = qMax(sizeof(QString::value_type), sizeof(QByteArray::value_type));
+        qsizetype oldSize = offset + objectSize * data->alloc;
+        if (objectSize <= FooterSize)
+            oldSize += FooterSize; // trailing null space, see calculateBlockSize()
+
+        QArrayData *newHeader = nullptr;
+        bool inArena = false;
+        if (QArrayDataArena *arena = QArrayDataArena::current()) {
+            newHeader = static_cast<QArrayData *>(arena->allocate(allocSize));
+            inArena = newHeader != nullptr;
+        }
+        if (!newHeader)
+            newHeader = static_cast<QArrayData *>(::malloc(size_t(allocSize)));
+        if (!newHeader)
+            return {nullptr, nullptr};
+
+        // copy through void * to sidestep -Wclass-memaccess: QArrayData is not
+        // trivially copyable only because of the atomic refcount, and a
+        // refcount of 1 is safe to copy bytewise
+        memcpy(static_cast<void *>(newHeader), static_cast<const void *>(data),
+               size_t(qMin(oldSize, allocSize)));
+        newHeader->flags.setFlag(QArrayData::ArenaAllocated, inArena);
+        newHeader->alloc = capacity;
+        return {newHeader, reinterpret_cast<char *>(newHeader) + offset};
+    }
+
     QArrayData *header = static_cast<QArrayData *>(::realloc(data, size_t(allocSize)));
     if (header) {
         header->alloc = capacity;
@@ -260,6 +393,9 @@ void QArrayData::deallocate(QArrayData *data, qsizetype objectSize,
     Q_UNUSED(objectSize);
     Q_UNUSED(alignment);
 
+    if (data && (data->flags & QArrayData::ArenaAllocated))
+        return; // reclaimed in one go when the QArrayDataArena is destroyed
+
     ::free(data);
 }
 
@@ -35,7 +35,8 @@ struct QArrayData
 
    enum ArrayOption {
         ArrayOptionDefault = 0,
-        CapacityReserved     = 0x1  //!< the capacity was reserved by the user, try to keep it
+        CapacityReserved     = 0x1, //!< the capacity was reserved by the user, try to keep it
+        ArenaAllocated       = 0x2  //!< the block came from a QArrayDataArena, deallocate() must not free() it
     };
     Q_DECLARE_FLAGS(ArrayOptions, ArrayOption)
 
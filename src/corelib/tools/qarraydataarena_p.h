@@ -0,0 +1,84 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QARRAYDATAARENA_P_H
+#define QARRAYDATAARENA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qarraydata.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A bump allocator for QArrayData blocks.
+
+    While a QArrayDataArena::Scope is active on a thread, QArrayData
+    allocations on that thread are served from the arena instead of malloc();
+    the blocks are marked QArrayData::ArenaAllocated, deallocate() becomes a
+    no-op for them, and the memory is released in one go when the arena is
+    destroyed.
+
+    The caller must guarantee that no container backed by arena memory (nor a
+    copy of one: the blocks are still reference-counted and shared as usual)
+    outlives the arena, and that such containers do not escape to other
+    threads that might grow them. This is an opt-in tool for request-scoped
+    workloads; it is not a general-purpose allocator.
+*/
+class Q_CORE_EXPORT QArrayDataArena
+{
+    Q_DISABLE_COPY_MOVE(QArrayDataArena)
+public:
+    static constexpr qsizetype DefaultChunkSize = 64 * 1024;
+
+    explicit QArrayDataArena(qsizetype chunkSize = DefaultChunkSize) noexcept;
+    ~QArrayDataArena();
+
+    // Returns a MaxPrimitiveAlignment-aligned block of \a size bytes, or
+    // nullptr on allocation failure. The block stays valid until the arena is
+    // destroyed.
+    void *allocate(qsizetype size) noexcept;
+
+    qsizetype bytesAllocated() const noexcept { return totalBytes; }
+
+    static QArrayDataArena *current() noexcept;
+
+    class Scope
+    {
+        Q_DISABLE_COPY_MOVE(Scope)
+    public:
+        explicit Scope(QArrayDataArena &arena) noexcept;
+        ~Scope();
+    private:
+        QArrayDataArena *previous;
+    };
+
+private:
+    struct Chunk
+    {
+        Chunk *next;
+        qsizetype used;
+        qsizetype size;
+        // payload follows, aligned to MaxPrimitiveAlignment
+    };
+
+    Chunk *grow(qsizetype payload) noexcept;
+
+    Chunk *chunks = nullptr;
+    qsizetype chunkSize;
+    qsizetype totalBytes = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QARRAYDATAARENA_P_H
@@ -486,7 +486,9 @@ public:
         dataPtr += (position == QArrayData::GrowsAtBeginning)
                 ? n + qMax(0, (header->alloc - from.size - n) / 2)
                 : from.freeSpaceAtBegin();
-        header->flags = from.flags();
+        // the allocation-origin flag describes the new block, not the old one
+        header->flags = (from.flags() & ~QArrayData::ArrayOptions(QArrayData::ArenaAllocated))
+                | (header->flags & QArrayData::ArenaAllocated);
         return QArrayDataPointer(header, dataPtr);
     }
 
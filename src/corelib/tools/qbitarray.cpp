@@ -566,18 +566,29 @@ QBitArray &performBitwiseOperationHelper(QBitArray &out, const QBitArray &a1,
     auto p1 = reinterpret_cast<const uchar *>(d1.data());
     auto p2 = reinterpret_cast<const uchar *>(d2.data());
 
-    // Main: perform the operation in the range where both arrays have data
+    // Main: perform the operation in the range where both arrays have data,
+    // a register-width chunk at a time.
     if (n1 < n2) {
         std::swap(n1, n2);
         std::swap(p1, p2);
     }
-    for (qsizetype i = 1; i < n2; ++i)
+    qsizetype i = 1;
+    for (; i + qsizetype(sizeof(quint64)) <= n2; i += sizeof(quint64)) {
+        quint64 v = op(qFromUnaligned<quint64>(p1 + i), qFromUnaligned<quint64>(p2 + i));
+        qToUnaligned(v, dst + i);
+    }
+    for (; i < n2; ++i)
         dst[i] = op(p1[i], p2[i]);
 
     // Tail: operate as if both arrays had the same data by padding zeroes to
     // the end of the shorter of the two (for std::bit_or and std::bit_xor, this is
     // a memmove; for std::bit_and, it's memset to 0).
-    for (qsizetype i = qMax(n2, qsizetype(1)); i < n1; ++i)
+    i = qMax(n2, qsizetype(1));
+    for (; i + qsizetype(sizeof(quint64)) <= n1; i += sizeof(quint64)) {
+        quint64 v = op(qFromUnaligned<quint64>(p1 + i), quint64(0));
+        qToUnaligned(v, dst + i);
+    }
+    for (; i < n1; ++i)
         dst[i] = op(p1[i], uchar(0));
 
     return out;
@@ -661,12 +672,12 @@ QBitArray &performBitwiseOperation(QBitArray &self, QBitArray &other, BitwiseOp
 
 QBitArray &QBitArray::operator&=(QBitArray &&other)
 {
-    return performBitwiseOperation(*this, other, std::bit_and<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_and<>());
 }
 
 QBitArray &QBitArray::operator&=(const QBitArray &other)
 {
-    return performBitwiseOperation(*this, other, std::bit_and<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_and<>());
 }
 
 /*!
@@ -689,12 +700,12 @@ QBitArray &QBitArray::operator&=(const QBitArray &other)
 
 QBitArray &QBitArray::operator|=(QBitArray &&other)
 {
-    return performBitwiseOperation(*this, other, std::bit_or<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_or<>());
 }
 
 QBitArray &QBitArray::operator|=(const QBitArray &other)
 {
-    return performBitwiseOperation(*this, other, std::bit_or<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_or<>());
 }
 
 /*!
@@ -717,12 +728,12 @@ QBitArray &QBitArray::operator|=(const QBitArray &other)
 
 QBitArray &QBitArray::operator^=(QBitArray &&other)
 {
-    return performBitwiseOperation(*this, other, std::bit_xor<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_xor<>());
 }
 
 QBitArray &QBitArray::operator^=(const QBitArray &other)
 {
-    return performBitwiseOperation(*this, other, std::bit_xor<uchar>());
+    return performBitwiseOperation(*this, other, std::bit_xor<>());
 }
 
 /*!
@@ -789,7 +800,7 @@ Q_NEVER_INLINE QBitArray QBitArray::inverted_inplace() &&
 QBitArray operator&(const QBitArray &a1, const QBitArray &a2)
 {
     QBitArray tmp = sizedForOverwrite(a1, a2);
-    performBitwiseOperationHelper(tmp, a1, a2, std::bit_and<uchar>());
+    performBitwiseOperationHelper(tmp, a1, a2, std::bit_and<>());
     return tmp;
 }
 
@@ -815,7 +826,7 @@ QBitArray operator&(const QBitArray &a1, const QBitArray &a2)
 QBitArray operator|(const QBitArray &a1, const QBitArray &a2)
 {
     QBitArray tmp = sizedForOverwrite(a1, a2);
-    performBitwiseOperationHelper(tmp, a1, a2, std::bit_or<uchar>());
+    performBitwiseOperationHelper(tmp, a1, a2, std::bit_or<>());
     return tmp;
 }
 
@@ -841,7 +852,7 @@ QBitArray operator|(const QBitArray &a1, const QBitArray &a2)
 QBitArray operator^(const QBitArray &a1, const QBitArray &a2)
 {
     QBitArray tmp = sizedForOverwrite(a1, a2);
-    performBitwiseOperationHelper(tmp, a1, a2, std::bit_xor<uchar>());
+    performBitwiseOperationHelper(tmp, a1, a2, std::bit_xor<>());
     return tmp;
 }
 
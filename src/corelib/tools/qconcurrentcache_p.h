@@ -0,0 +1,168 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCONCURRENTCACHE_P_H
+#define QCONCURRENTCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
+
+#include <limits>
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A thread-safe, sharded LRU cache with QCache's cost-based eviction.
+
+    Keys are distributed over a fixed number of independently locked QCache
+    shards, so concurrent lookups and insertions from different threads
+    mostly take different locks instead of serializing on one. Values are
+    handed out as std::shared_ptr because, unlike with QCache, an object may
+    be evicted by another thread while a caller is still using it.
+
+    Eviction is per shard: each shard gets an equal slice of maxCost, so a
+    single entry cannot be larger than maxCost / ShardCount.
+*/
+template <class Key, class T, size_t ShardCount = 16>
+class QConcurrentCache
+{
+    static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0,
+                  "ShardCount must be a power of two");
+
+    struct Shard
+    {
+        QMutex mutex;
+        QCache<Key, std::shared_ptr<T>> cache;
+    };
+
+public:
+    explicit QConcurrentCache(qsizetype maxCost = 100)
+    {
+        setMaxCost(maxCost);
+    }
+    Q_DISABLE_COPY_MOVE(QConcurrentCache)
+
+    qsizetype maxCost() const noexcept { return totalMaxCost; }
+    void setMaxCost(qsizetype cost)
+    {
+        totalMaxCost = cost;
+        const qsizetype perShard = qMax(qsizetype(1), cost / qsizetype(ShardCount));
+        for (Shard &s : shards) {
+            QMutexLocker locker(&s.mutex);
+            s.cache.setMaxCost(perShard);
+        }
+    }
+
+    qsizetype totalCost() const
+    {
+        qsizetype sum = 0;
+        for (Shard &s : shards) {
+            QMutexLocker locker(&s.mutex);
+            sum += s.cache.totalCost();
+        }
+        return sum;
+    }
+
+    qsizetype count() const
+    {
+        qsizetype sum = 0;
+        for (Shard &s : shards) {
+            QMutexLocker locker(&s.mutex);
+            sum += s.cache.count();
+        }
+        return sum;
+    }
+
+    void clear()
+    {
+        for (Shard &s : shards) {
+            QMutexLocker locker(&s.mutex);
+            s.cache.clear();
+        }
+    }
+
+    // Takes ownership of \a object, like QCache::insert(); returns false if
+    // the object was too big for its shard and was deleted instead.
+    bool insert(const Key &key, T *object, qsizetype cost = 1)
+    {
+        return insert(key, std::shared_ptr<T>(object), cost);
+    }
+
+    bool insert(const Key &key, std::shared_ptr<T> object, qsizetype cost = 1)
+    {
+        Shard &s = shard(key);
+        QMutexLocker locker(&s.mutex);
+        return s.cache.insert(key, new std::shared_ptr<T>(std::move(object)), cost);
+    }
+
+    // Returns the cached object, or nullptr. The returned reference keeps the
+    // object alive even if it is evicted concurrently.
+    std::shared_ptr<T> object(const Key &key) const
+    {
+        Shard &s = shard(key);
+        QMutexLocker locker(&s.mutex);
+        if (std::shared_ptr<T> *entry = s.cache.object(key))
+            return *entry;
+        return nullptr;
+    }
+
+    bool contains(const Key &key) const
+    {
+        Shard &s = shard(key);
+        QMutexLocker locker(&s.mutex);
+        return s.cache.contains(key);
+    }
+
+    bool remove(const Key &key)
+    {
+        Shard &s = shard(key);
+        QMutexLocker locker(&s.mutex);
+        return s.cache.remove(key);
+    }
+
+    // Atomic get-or-insert: returns the cached object for \a key, or invokes
+    // \a factory to create one (returning {object, cost}) while holding the
+    // shard lock, so concurrent callers never create the same entry twice.
+    template <typename Factory>
+    std::shared_ptr<T> objectOrInsert(const Key &key, Factory &&factory)
+    {
+        Shard &s = shard(key);
+        QMutexLocker locker(&s.mutex);
+        if (std::shared_ptr<T> *entry = s.cache.object(key))
+            return *entry;
+        auto [object, cost] = factory();
+        std::shared_ptr<T> result(std::move(object));
+        s.cache.insert(key, new std::shared_ptr<T>(result), cost);
+        return result;
+    }
+
+private:
+    Shard &shard(const Key &key) const
+    {
+        const size_t hash = qHash(key, seed);
+        // qHash mixes well; fold the high bits in so sharding and the
+        // in-shard bucket index do not use the same bits
+        return shards[(hash ^ (hash >> (std::numeric_limits<size_t>::digits / 2))) % ShardCount];
+    }
+
+    mutable Shard shards[ShardCount];
+    size_t seed = QHashSeed::globalSeed();
+    qsizetype totalMaxCost = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif // QCONCURRENTCACHE_P_H
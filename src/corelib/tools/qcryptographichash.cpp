@@ -951,11 +951,16 @@ bool QCryptographicHashPrivate::addData(QIODevice *device)
     if (!device->isOpen())
         return false;
 
-    char buffer[1024];
+    // The hash kernels run at memory bandwidth; with a small buffer the
+    // QIODevice::read() round trips dominate instead, so read in large
+    // chunks. 64K also matches the preferred I/O block size of most
+    // filesystems.
+    constexpr qsizetype ChunkSize = 64 * 1024;
+    QVarLengthArray<char> buffer(ChunkSize);
     qint64 length;
 
-    while ((length = device->read(buffer, sizeof(buffer))) > 0)
-        addData({buffer, qsizetype(length)}); // length always <= 1024
+    while ((length = device->read(buffer.data(), ChunkSize)) > 0)
+        addData({buffer.data(), qsizetype(length)}); // length always <= ChunkSize
 
     return device->atEnd();
 }
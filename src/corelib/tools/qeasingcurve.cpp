@@ -435,12 +435,22 @@ struct BezierEase : public QEasingCurveFunction
 
     QList<SingleCubicBezier> _curves;
     QList<qreal> _intervals;
+    QList<qreal> _lookupTable;
     int _curveCount;
+    int _evaluationsUntilTable;
     bool _init;
     bool _valid;
 
+    // A lookup table pays for itself once the curve is evaluated repeatedly,
+    // which is what the animation framework does on every tick. Build it only
+    // after the exact solver has been exercised a few times, so that one-off
+    // evaluations don't pay for filling the table.
+    static constexpr int TableIntervals = 512;
+    static constexpr int TableWarmupEvaluations = 16;
+
     BezierEase(QEasingCurve::Type type = QEasingCurve::BezierSpline)
-        : QEasingCurveFunction(type), _curves(10), _intervals(10), _init(false), _valid(false)
+        : QEasingCurveFunction(type), _curves(10), _intervals(10),
+          _evaluationsUntilTable(TableWarmupEvaluations), _init(false), _valid(false)
     { }
 
     void init()
@@ -555,12 +565,61 @@ struct BezierEase : public QEasingCurveFunction
         if (!(x < 1))
             return 1;
 
+        if (!_lookupTable.isEmpty())
+            return tableValue(x);
+        if (_evaluationsUntilTable > 0) {
+            --_evaluationsUntilTable;
+        } else if (_evaluationsUntilTable == 0) {
+            if (tableIsAccurate()) {
+                buildLookupTable();
+                return tableValue(x);
+            }
+            _evaluationsUntilTable = -1; // stay on the exact solver
+        }
+
+        return exactValue(x);
+    }
+
+    qreal exactValue(qreal x)
+    {
         SingleCubicBezier *singleCubicBezier = nullptr;
         getBezierSegment(singleCubicBezier, x);
 
         return evaluateSegmentForY(*singleCubicBezier, findTForX(*singleCubicBezier, x));
     }
 
+    // The table samples the curve uniformly, so a spline segment narrower
+    // than the table step would be flattened into the interpolation of its
+    // neighbours' samples. Such curves keep using the exact solver.
+    bool tableIsAccurate() const
+    {
+        qreal previousEnd = 0.0;
+        for (int i = 0; i < _curveCount; ++i) {
+            if (_intervals.at(i) - previousEnd < qreal(1) / TableIntervals)
+                return false;
+            previousEnd = _intervals.at(i);
+        }
+        return true;
+    }
+
+    void buildLookupTable()
+    {
+        _lookupTable.resize(TableIntervals + 1);
+        _lookupTable[0] = 0.0;
+        _lookupTable[TableIntervals] = 1.0;
+        for (int i = 1; i < TableIntervals; ++i)
+            _lookupTable[i] = exactValue(qreal(i) / TableIntervals);
+    }
+
+    qreal tableValue(qreal x) const
+    {
+        const qreal scaled = x * TableIntervals;
+        const int index = qMin(int(scaled), TableIntervals - 1);
+        const qreal fraction = scaled - index;
+        const qreal y0 = _lookupTable.at(index);
+        return y0 + fraction * (_lookupTable.at(index + 1) - y0);
+    }
+
     qreal static inline evaluateSegmentForY(const SingleCubicBezier &singleCubicBezier, qreal t)
     {
         const qreal p0 = singleCubicBezier.p0y;
@@ -813,6 +813,52 @@ public:
         return fromKeysIterator(std::lower_bound(c.keys.begin(), c.keys.end(), key, key_comp()));
     }
 
+    iterator upper_bound(const Key &key)
+    {
+        auto cit = std::as_const(*this).upper_bound(key);
+        return { &c, cit.i };
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    iterator upper_bound(const X &key)
+    {
+        auto cit = std::as_const(*this).upper_bound(key);
+        return { &c, cit.i };
+    }
+
+    const_iterator upper_bound(const Key &key) const
+    {
+        return fromKeysIterator(std::upper_bound(c.keys.begin(), c.keys.end(), key, key_comp()));
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    const_iterator upper_bound(const X &key) const
+    {
+        return fromKeysIterator(std::upper_bound(c.keys.begin(), c.keys.end(), key, key_comp()));
+    }
+
+    std::pair<iterator, iterator> equal_range(const Key &key)
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    std::pair<iterator, iterator> equal_range(const X &key)
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const Key &key) const
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+
+    template <class X, class Y = Compare, is_marked_transparent<Y> = nullptr>
+    std::pair<const_iterator, const_iterator> equal_range(const X &key) const
+    {
+        return { lower_bound(key), upper_bound(key) };
+    }
+
     iterator find(const Key &key)
     {
         return { &c, std::as_const(*this).find(key).i };
@@ -921,6 +921,142 @@ size_t qHash(QLatin1StringView key, size_t seed) noexcept
     return qHashBits_fallback<ByteToWord>(data, size, seed, seed2);
 }
 
+#ifndef QT_BOOTSTRAPPED
+/*!
+    \class QHasher
+    \inmodule QtCore
+    \since 6.9
+
+    \brief The QHasher class computes a hash incrementally over a stream of
+    data.
+
+    Unlike qHash() and qHashBits(), which require the entire input to be
+    present in one contiguous buffer, QHasher can be fed data in arbitrary
+    chunks with addData() and produces the same value for the same
+    concatenated byte sequence, no matter how the input was split. This is
+    useful for checksumming data arriving from a socket or for hashing large
+    structures without materializing an intermediate buffer.
+
+    The default constructor seeds the hasher with the process-wide seed also
+    used by QHash (see QHashSeed), so results are not predictable by
+    attackers, but also not reproducible across processes. To obtain values
+    that are stable across processes of the same application build on the
+    same architecture, construct the hasher with an explicit seed.
+
+    QHasher uses the SipHash-1-2 algorithm, which is also the portable
+    fallback used by qHashBits(). The result is not guaranteed to match
+    qHashBits() for the same input and is not a cryptographic hash; use
+    QCryptographicHash where integrity against adversarial inputs is
+    required.
+
+    \sa qHashBits(), QHashSeed, QCryptographicHash
+*/
+
+namespace {
+template <typename Hasher> static Hasher sipHashFromState(const size_t state[4], size_t k0, size_t k1) noexcept
+{
+    Hasher h(0, k0, k1);
+    h.v0 = state[0];
+    h.v1 = state[1];
+    h.v2 = state[2];
+    h.v3 = state[3];
+    return h;
+}
+} // unnamed namespace
+
+/*!
+    Constructs a hasher seeded with the process-global hashing seed.
+
+    \sa QHashSeed::globalSeed()
+*/
+QHasher::QHasher() noexcept
+    : QHasher(size_t(QHashSeed::globalSeed()))
+{
+    k1 = qt_qhash_seed.currentSeed(1);
+    reset();
+}
+
+/*!
+    Constructs a hasher seeded with \a seed. Two hashers constructed with the
+    same seed produce the same result for the same input, even in different
+    processes, making this form suitable for hash values that are exchanged
+    between processes or stored to disk. Note that the result still depends
+    on the architecture's pointer size and endianness.
+*/
+QHasher::QHasher(size_t seed) noexcept
+    : k0(seed), k1(0)
+{
+    reset();
+}
+
+/*!
+    Adds \a data to the hash being calculated.
+*/
+void QHasher::addData(QByteArrayView data) noexcept
+{
+    auto in = reinterpret_cast<const uchar *>(data.constData());
+    size_t len = size_t(data.size());
+    if (len == 0)
+        return;
+    totalLength += len;
+
+    auto h = sipHashFromState<SipHash<>>(state, k0, k1);
+    if (bufferUsed) {
+        // top up the partial block left over from the previous call
+        size_t n = qMin(len, sizeof(buffer) - bufferUsed);
+        memcpy(buffer + bufferUsed, in, n);
+        bufferUsed += uchar(n);
+        in += n;
+        len -= n;
+        if (bufferUsed < sizeof(buffer))
+            return;
+        h.addBlock(buffer, sizeof(buffer));
+        bufferUsed = 0;
+    }
+
+    size_t blocks = len & ~(sizeof(size_t) - 1);
+    if (blocks)
+        h.addBlock(in, blocks);
+    memcpy(buffer, in + blocks, len - blocks);
+    bufferUsed = uchar(len - blocks);
+
+    state[0] = h.v0;
+    state[1] = h.v1;
+    state[2] = h.v2;
+    state[3] = h.v3;
+}
+
+/*!
+    Returns the hash of all the data added so far. This does not modify the
+    internal state: more data may be added afterwards, and the hasher will
+    then behave as if result() had never been called.
+*/
+size_t QHasher::result() const noexcept
+{
+    // The total length is only folded in during finalization, so we can
+    // supply it now, even though the one-shot SipHash implementation takes it
+    // in the constructor.
+    auto h = sipHashFromState<SipHash<>>(state, k0, k1);
+    h.b = decltype(h.b)(totalLength) << (sizeof(size_t) == 8 ? 56 : 24);
+    return h.finalize(buffer, bufferUsed);
+}
+
+/*!
+    Discards all the data added so far, returning the hasher to its
+    just-constructed state. The seed is retained.
+*/
+void QHasher::reset() noexcept
+{
+    SipHash<> h(0, k0, k1);
+    state[0] = h.v0;
+    state[1] = h.v1;
+    state[2] = h.v2;
+    state[3] = h.v3;
+    totalLength = 0;
+    bufferUsed = 0;
+}
+#endif // !QT_BOOTSTRAPPED
+
 /*!
     \class QHashSeed
     \inmodule QtCore
@@ -2379,6 +2515,21 @@ size_t qHash(long double key, size_t seed) noexcept
     value stored in \a other.
 */
 
+/*! \fn template <class Key, class T> template <typename InputIterator> void QHash<Key, T>::insert(InputIterator first, InputIterator last)
+    \since 6.9
+
+    Inserts all the items in the iterator range [\a first, \a last) into
+    this hash. The items can be std::pair<Key, T> or have \c key() and
+    \c value() member functions returning a key and a value, respectively.
+
+    If a key from the range is already present in the hash, its value is
+    replaced with the one from the range.
+
+    When the range's length can be computed up front, the hash is sized
+    once for the whole range, so bulk construction does not rehash while
+    inserting.
+*/
+
 /*! \fn template <class Key, class T> bool QHash<Key, T>::empty() const
 
     This function is provided for STL compatibility. It is equivalent
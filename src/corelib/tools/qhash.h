@@ -1321,6 +1321,33 @@ public:
             emplace(it.key(), it.value());
     }
 
+#ifdef Q_QDOC
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last);
+#else
+    template <typename InputIterator, QtPrivate::IfAssociativeIteratorHasKeyAndValue<InputIterator> = true>
+    void insert(InputIterator first, InputIterator last)
+    {
+        if constexpr (std::is_convertible_v<typename std::iterator_traits<InputIterator>::iterator_category,
+                                            std::forward_iterator_tag>) {
+            reserve(size() + std::distance(first, last));
+        }
+        for (; first != last; ++first)
+            emplace(first.key(), first.value());
+    }
+
+    template <typename InputIterator, QtPrivate::IfAssociativeIteratorHasFirstAndSecond<InputIterator> = true>
+    void insert(InputIterator first, InputIterator last)
+    {
+        if constexpr (std::is_convertible_v<typename std::iterator_traits<InputIterator>::iterator_category,
+                                            std::forward_iterator_tag>) {
+            reserve(size() + std::distance(first, last));
+        }
+        for (; first != last; ++first)
+            emplace(first->first, first->second);
+    }
+#endif
+
     template <typename ...Args>
     iterator emplace(const Key &key, Args &&... args)
     {
@@ -50,6 +50,30 @@ private:
     size_t data;
 };
 
+#ifndef QT_BOOTSTRAPPED
+class QHasher
+{
+public:
+    Q_CORE_EXPORT QHasher() noexcept;
+    Q_CORE_EXPORT explicit QHasher(size_t seed) noexcept;
+
+    Q_CORE_EXPORT void addData(QByteArrayView data) noexcept;
+    void addData(const void *data, qsizetype length) noexcept
+    { addData(QByteArrayView(static_cast<const char *>(data), length)); }
+
+    Q_CORE_EXPORT size_t result() const noexcept;
+    Q_CORE_EXPORT void reset() noexcept;
+
+private:
+    size_t state[4];
+    size_t k0;
+    size_t k1;
+    quint64 totalLength;
+    uchar buffer[sizeof(size_t)];
+    uchar bufferUsed;
+};
+#endif // !QT_BOOTSTRAPPED
+
 // Whether, ∀ t of type T && ∀ seed, qHash(Key(t), seed) == qHash(t, seed)
 template <typename Key, typename T> struct QHashHeterogeneousSearch : std::false_type {};
 
@@ -59,6 +59,12 @@ public:
     Q_CORE_EXPORT void detach();
     QByteArray toByteArray() &&;
 
+    // shares the underlying storage, e.g. to pin its lifetime
+    inline QByteArray storage() const
+    {
+        return chunk;
+    }
+
     // getters
     inline qsizetype head() const
     {
@@ -156,6 +162,10 @@ public:
         return bufferSize == 0 ? nullptr : buffers.first().data();
     }
 
+    inline QByteArray firstChunkStorage() const {
+        return bufferSize == 0 ? QByteArray() : buffers.first().storage();
+    }
+
     Q_CORE_EXPORT const char *readPointerAtPosition(qint64 pos, qint64 &length) const;
     Q_CORE_EXPORT void free(qint64 bytes);
     Q_CORE_EXPORT char *reserve(qint64 bytes);
@@ -0,0 +1,139 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSPSCQUEUE_P_H
+#define QSPSCQUEUE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A bounded wait-free single-producer/single-consumer queue.
+
+    One thread may call tryPush()/push-side accessors, one (other) thread may
+    call tryPop(); neither ever blocks or allocates after construction. The
+    producer and consumer indexes live on separate cache lines, and each side
+    caches the other's index so the common case performs a single relaxed
+    atomic load per operation.
+
+    Capacity is rounded up to a power of two; one slot is sacrificed to
+    distinguish full from empty.
+*/
+template <typename T>
+class QSpscQueue
+{
+    Q_DISABLE_COPY_MOVE(QSpscQueue)
+
+#ifdef __cpp_lib_hardware_interference_size
+    static constexpr size_t CacheLineSize = std::hardware_destructive_interference_size;
+#else
+    static constexpr size_t CacheLineSize = 64;
+#endif
+
+public:
+    explicit QSpscQueue(qsizetype capacity)
+    {
+        Q_ASSERT(capacity > 0);
+        capacity = qMax(capacity, qsizetype(1));
+        size_t n = 2;
+        while (n < size_t(capacity) + 1)
+            n *= 2;
+        mask = n - 1;
+        storage.reset(static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignof(T)))));
+    }
+
+    ~QSpscQueue()
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_relaxed);
+        while (h != t) {
+            storage[h].~T();
+            h = (h + 1) & mask;
+        }
+    }
+
+    qsizetype capacity() const noexcept { return qsizetype(mask); }
+
+    // producer side
+    bool tryPush(const T &value) { return tryEmplace(value); }
+    bool tryPush(T &&value) { return tryEmplace(std::move(value)); }
+
+    template <typename ...Args>
+    bool tryEmplace(Args &&...args)
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t next = (t + 1) & mask;
+        if (next == cachedHead) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (next == cachedHead)
+                return false; // full
+        }
+        new (std::addressof(storage[t])) T(std::forward<Args>(args)...);
+        tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side
+    bool tryPop(T &out)
+    {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail)
+                return false; // empty
+        }
+        T &slot = storage[h];
+        out = std::move(slot);
+        slot.~T();
+        head.store((h + 1) & mask, std::memory_order_release);
+        return true;
+    }
+
+    // approximate when called while the other side is active
+    bool isEmpty() const noexcept
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    qsizetype size() const noexcept
+    {
+        const size_t t = tail.load(std::memory_order_acquire);
+        const size_t h = head.load(std::memory_order_acquire);
+        return qsizetype((t - h) & mask);
+    }
+
+private:
+    struct AlignedDelete
+    {
+        void operator()(T *p) const { ::operator delete(p, std::align_val_t(alignof(T))); }
+    };
+
+    std::unique_ptr<T[], AlignedDelete> storage;
+    size_t mask = 0;
+
+    alignas(CacheLineSize) std::atomic<size_t> tail{0}; // written by producer
+    size_t cachedHead = 0;                              // producer's view of head
+    alignas(CacheLineSize) std::atomic<size_t> head{0}; // written by consumer
+    size_t cachedTail = 0;                              // consumer's view of tail
+};
+
+QT_END_NAMESPACE
+
+#endif // QSPSCQUEUE_P_H
@@ -0,0 +1,159 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qstartupprofiler_p.h"
+
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qtenvironmentvariables.h>
+#include <QtCore/private/qlocking_p.h>
+
+#include <stdio.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+/*
+    \internal
+
+    Cold-start regressions are hard to attribute without a breakdown of where
+    the time went. The startup profiler records named phases with their start
+    offset and duration relative to the first use of the profiler, which for an
+    instrumented Qt application is early in QCoreApplication construction. It
+    is enabled by setting the QT_STARTUP_PROFILE environment variable; the
+    recorded phases are dumped as JSON when the event loop is first entered
+    (or at application destruction, for programs that never reach exec()).
+
+    Phases may nest and may be recorded from any thread; entries are kept in
+    completion order, each with its own timestamp, so a flame-graph-style
+    reconstruction is possible from the offsets alone.
+*/
+
+namespace {
+struct PhaseRecord
+{
+    const char *name;
+    QByteArray detail;
+    qint64 startNsecs;
+    qint64 durationNsecs; // -1 for an instant marker
+};
+}
+
+// -1 = not yet initialized from the environment, 0 = disabled, 1 = enabled
+Q_CONSTINIT static QBasicAtomicInt startupProfilerEnabled = Q_BASIC_ATOMIC_INITIALIZER(-1);
+Q_CONSTINIT static QBasicMutex startupProfilerMutex;
+static QList<PhaseRecord> *startupPhases = nullptr; // protected by startupProfilerMutex
+Q_CONSTINIT static QBasicAtomicInt startupProfilerDumped = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static qint64 nsecsSinceStartup()
+{
+    static const QElapsedTimer timebase = [] {
+        QElapsedTimer timer;
+        timer.start();
+        return timer;
+    }();
+    return timebase.nsecsElapsed();
+}
+
+static bool initializeEnabled() noexcept
+{
+    const int enabled = qEnvironmentVariableIsSet("QT_STARTUP_PROFILE") ? 1 : 0;
+    int expected = -1;
+    startupProfilerEnabled.testAndSetRelaxed(expected, enabled);
+    if (enabled)
+        nsecsSinceStartup(); // anchor the timebase as early as possible
+    return startupProfilerEnabled.loadRelaxed() != 0;
+}
+
+bool QStartupProfiler::isEnabled() noexcept
+{
+    int enabled = startupProfilerEnabled.loadRelaxed();
+    if (Q_UNLIKELY(enabled < 0))
+        return initializeEnabled();
+    return enabled != 0;
+}
+
+void QStartupProfiler::setEnabled(bool enabled) noexcept
+{
+    if (enabled)
+        nsecsSinceStartup();
+    startupProfilerEnabled.storeRelaxed(enabled ? 1 : 0);
+}
+
+qint64 QStartupProfiler::beginPhase() noexcept
+{
+    if (!isEnabled())
+        return -1;
+    return nsecsSinceStartup();
+}
+
+static void recordPhase(const char *name, const QByteArray &detail, qint64 start, qint64 duration)
+{
+    const auto locker = qt_scoped_lock(startupProfilerMutex);
+    if (!startupPhases)
+        startupPhases = new QList<PhaseRecord>;
+    startupPhases->append({ name, detail, start, duration });
+}
+
+void QStartupProfiler::endPhase(const char *name, const QByteArray &detail, qint64 begin)
+{
+    Q_ASSERT(begin >= 0);
+    recordPhase(name, detail, begin, nsecsSinceStartup() - begin);
+}
+
+void QStartupProfiler::mark(const char *name, const QByteArray &detail)
+{
+    if (!isEnabled())
+        return;
+    recordPhase(name, detail, nsecsSinceStartup(), -1);
+}
+
+void QStartupProfiler::dump()
+{
+    if (!isEnabled())
+        return;
+    if (!startupProfilerDumped.testAndSetRelaxed(0, 1))
+        return; // already dumped
+
+    QJsonArray phases;
+    {
+        const auto locker = qt_scoped_lock(startupProfilerMutex);
+        if (startupPhases) {
+            for (const PhaseRecord &record : std::as_const(*startupPhases)) {
+                QJsonObject phase;
+                phase[u"name"_s] = QLatin1StringView(record.name);
+                if (!record.detail.isEmpty())
+                    phase[u"detail"_s] = QLatin1StringView(record.detail);
+                phase[u"start_us"_s] = double(record.startNsecs) / 1000.0;
+                if (record.durationNsecs >= 0)
+                    phase[u"duration_us"_s] = double(record.durationNsecs) / 1000.0;
+                phases.append(phase);
+            }
+        }
+    }
+
+    QJsonObject root;
+    root[u"elapsed_us"_s] = double(nsecsSinceStartup()) / 1000.0;
+    root[u"phases"_s] = phases;
+    const QByteArray json = QJsonDocument(root).toJson(QJsonDocument::Indented);
+
+    const QString target = qEnvironmentVariable("QT_STARTUP_PROFILE");
+    if (target == "1"_L1 || target == "-"_L1 || target == "stderr"_L1) {
+        fprintf(stderr, "%s", json.constData());
+        return;
+    }
+    QFile file(target);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        fprintf(stderr, "QStartupProfiler: cannot write to '%s'\n", qPrintable(target));
+        return;
+    }
+    file.write(json);
+}
+
+QT_END_NAMESPACE
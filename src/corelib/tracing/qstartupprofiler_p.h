@@ -0,0 +1,70 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSTARTUPPROFILER_P_H
+#define QSTARTUPPROFILER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qbytearray.h>
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+// Records timestamped phases of application startup (library init, plugin
+// scanning, platform integration, font database population, ...) when the
+// QT_STARTUP_PROFILE environment variable is set, and dumps them as JSON when
+// the event loop is entered. Disabled, a phase costs one relaxed atomic load.
+namespace QStartupProfiler {
+
+Q_CORE_EXPORT bool isEnabled() noexcept;
+Q_CORE_EXPORT void setEnabled(bool enabled) noexcept; // for autotests
+
+// Returns the phase's start timestamp, or -1 when profiling is disabled.
+Q_CORE_EXPORT qint64 beginPhase() noexcept;
+Q_CORE_EXPORT void endPhase(const char *name, const QByteArray &detail, qint64 begin);
+Q_CORE_EXPORT void mark(const char *name, const QByteArray &detail = QByteArray());
+
+// Writes the recorded phases to the destination named by QT_STARTUP_PROFILE
+// ("stderr", "-" or "1" for stderr, anything else is a file path). Only the
+// first call writes anything; startup is over once the event loop runs.
+Q_CORE_EXPORT void dump();
+
+} // namespace QStartupProfiler
+
+class QStartupPhase
+{
+public:
+    Q_NODISCARD_CTOR
+    explicit QStartupPhase(const char *name, QByteArray detail = QByteArray())
+        : m_name(name), m_detail(std::move(detail)), m_begin(QStartupProfiler::beginPhase())
+    {
+    }
+    ~QStartupPhase()
+    {
+        if (m_begin >= 0)
+            QStartupProfiler::endPhase(m_name, m_detail, m_begin);
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QStartupPhase)
+
+    const char *m_name;
+    QByteArray m_detail;
+    qint64 m_begin;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSTARTUPPROFILER_P_H
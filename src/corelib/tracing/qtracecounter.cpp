@@ -0,0 +1,221 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtracecounter.h"
+
+#include <QtCore/qtenvironmentvariables.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QTraceCounter
+    \inmodule QtCore
+    \brief The QTraceCounter class provides an always-available, low-overhead
+    event counter for diagnosing live processes.
+    \since 6.9
+
+    \ingroup tools
+
+    Unlike the tracepoints in Qt's tracing layer, which are compiled in only
+    when Qt is configured with a tracing backend, QTraceCounter is available in
+    every build. Incrementing a disabled counter costs a single relaxed atomic
+    load, so counters can be left permanently in hot paths and switched on in
+    production when an incident needs diagnosing, either programmatically with
+    setEnabled() or by setting the \c QT_TRACE_COUNTERS environment variable to
+    a non-zero value before the process starts.
+
+    A counter must have static storage duration; it registers itself with a
+    process-wide registry on construction and is never unregistered. The name
+    passed to the constructor must outlive the counter, so it should be a
+    string literal. Qt itself maintains counters for posted event queue depth,
+    signal emissions and container allocations; applications can add their own:
+
+    \code
+    static QTraceCounter framesDropped("myapp.frames.dropped");
+
+    void VideoSink::present(const Frame &frame)
+    {
+        if (behindSchedule(frame)) {
+            framesDropped.increment();
+            return;
+        }
+        // ...
+    }
+    \endcode
+
+    The current values of all counters in the process can be collected with
+    snapshot(), for example from a debug command handler or a monitoring
+    endpoint.
+
+    \sa QTraceScope
+*/
+
+/*!
+    \class QTraceScope
+    \inmodule QtCore
+    \brief The QTraceScope class counts executions of a scope and accumulates
+    the time spent in it.
+    \since 6.9
+
+    \ingroup tools
+
+    QTraceScope increments one \l QTraceCounter and adds the scope's elapsed
+    nanoseconds to another when the scope is left, but only while counters are
+    \l{QTraceCounter::isEnabled()}{enabled}; a disabled scope costs a single
+    relaxed atomic load on entry.
+
+    \code
+    static QTraceCounter parseCalls("myapp.parse.calls");
+    static QTraceCounter parseNsecs("myapp.parse.nsecs");
+
+    void Parser::parse()
+    {
+        QTraceScope scope(parseCalls, parseNsecs);
+        // ...
+    }
+    \endcode
+
+    \sa QTraceCounter
+*/
+
+/*!
+    \struct QTraceCounter::Value
+    \inmodule QtCore
+    \brief A counter name and its value at the time of a snapshot().
+    \since 6.9
+*/
+
+/*!
+    \variable QTraceCounter::Value::name
+    \brief the name the counter was constructed with.
+*/
+
+/*!
+    \variable QTraceCounter::Value::value
+    \brief the counter's value when the snapshot was taken.
+*/
+
+namespace QtPrivate {
+QBasicAtomicInt qtTraceCountersEnabled = Q_BASIC_ATOMIC_INITIALIZER(-1);
+}
+
+Q_CONSTINIT static QBasicAtomicPointer<QTraceCounter> counterListHead =
+        Q_BASIC_ATOMIC_INITIALIZER(nullptr);
+
+/*!
+    Constructs a counter named \a name, with an initial value of zero, and
+    registers it with the process-wide registry.
+
+    The counter must have static storage duration and \a name must be valid
+    for the lifetime of the process.
+*/
+QTraceCounter::QTraceCounter(const char *name) noexcept
+    : m_name(name)
+{
+    QTraceCounter *head = counterListHead.loadAcquire();
+    do {
+        m_next = head;
+    } while (!counterListHead.testAndSetRelease(head, this, head));
+}
+
+/*!
+    \fn const char *QTraceCounter::name() const
+
+    Returns the name the counter was constructed with.
+*/
+
+/*!
+    \fn qint64 QTraceCounter::value() const
+
+    Returns the counter's current value.
+*/
+
+/*!
+    \fn void QTraceCounter::reset()
+
+    Resets the counter to zero.
+*/
+
+/*!
+    \fn void QTraceCounter::increment(qint64 delta)
+
+    Adds \a delta (by default 1) to the counter if counters are
+    \l{isEnabled()}{enabled}; otherwise does nothing.
+
+    This function is thread-safe and lock-free. When counters are disabled it
+    performs a single relaxed atomic load.
+*/
+
+/*!
+    \fn bool QTraceCounter::isEnabled()
+
+    Returns \c true if counters are enabled in this process.
+
+    Counters start out enabled if the \c QT_TRACE_COUNTERS environment
+    variable is set to a non-zero value, and disabled otherwise.
+
+    \sa setEnabled()
+*/
+
+/*!
+    Enables all counters in the process if \a enabled is \c true; disables
+    them otherwise.
+
+    Counter values are retained across disable/enable cycles; use reset() to
+    restart a counter.
+
+    \sa isEnabled()
+*/
+void QTraceCounter::setEnabled(bool enabled) noexcept
+{
+    QtPrivate::qtTraceCountersEnabled.storeRelaxed(enabled ? 1 : 0);
+}
+
+/*!
+    \internal
+
+    Initializes the enabled state from the QT_TRACE_COUNTERS environment
+    variable the first time a counter is exercised or queried.
+*/
+bool QTraceCounter::initializeEnabled() noexcept
+{
+    const int enabled = qEnvironmentVariableIntValue("QT_TRACE_COUNTERS") != 0 ? 1 : 0;
+    int expected = -1;
+    QtPrivate::qtTraceCountersEnabled.testAndSetRelaxed(expected, enabled);
+    return QtPrivate::qtTraceCountersEnabled.loadRelaxed() != 0;
+}
+
+/*!
+    Returns the name and current value of every counter registered in the
+    process.
+
+    The counters are not sampled atomically with respect to each other: a
+    snapshot taken while counters are being incremented reflects each
+    counter's value at the moment it was visited.
+*/
+QList<QTraceCounter::Value> QTraceCounter::snapshot()
+{
+    QList<Value> result;
+    for (const QTraceCounter *counter = counterListHead.loadAcquire(); counter;
+         counter = counter->m_next)
+        result.append({ counter->m_name, counter->m_value.loadRelaxed() });
+    return result;
+}
+
+/*!
+    \fn QTraceScope::QTraceScope(QTraceCounter &calls, QTraceCounter &nsecs)
+
+    Starts timing the current scope. When the scope is left, \a calls is
+    incremented by one and \a nsecs by the elapsed time in nanoseconds,
+    provided counters were \l{QTraceCounter::isEnabled()}{enabled} when the
+    scope was entered.
+*/
+
+/*!
+    \fn QTraceScope::~QTraceScope()
+
+    Records the scope's execution in the counters passed to the constructor,
+    if counters were enabled when the scope was entered.
+*/
+
+QT_END_NAMESPACE
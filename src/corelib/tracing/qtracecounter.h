@@ -0,0 +1,85 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTRACECOUNTER_H
+#define QTRACECOUNTER_H
+
+#include <QtCore/qbasicatomic.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtPrivate {
+// -1 = not yet initialized from the environment, 0 = disabled, 1 = enabled
+Q_CORE_EXPORT extern QBasicAtomicInt qtTraceCountersEnabled;
+}
+
+class Q_CORE_EXPORT QTraceCounter
+{
+public:
+    explicit QTraceCounter(const char *name) noexcept;
+
+    const char *name() const noexcept { return m_name; }
+    qint64 value() const noexcept { return m_value.loadRelaxed(); }
+    void reset() noexcept { m_value.storeRelaxed(0); }
+
+    void increment(qint64 delta = 1) noexcept
+    {
+        if (isEnabled())
+            m_value.fetchAndAddRelaxed(delta);
+    }
+
+    static bool isEnabled() noexcept
+    {
+        int enabled = QtPrivate::qtTraceCountersEnabled.loadRelaxed();
+        if (Q_UNLIKELY(enabled < 0))
+            return initializeEnabled();
+        return enabled != 0;
+    }
+    static void setEnabled(bool enabled) noexcept;
+
+    struct Value
+    {
+        const char *name;
+        qint64 value;
+    };
+    static QList<Value> snapshot();
+
+private:
+    Q_DISABLE_COPY_MOVE(QTraceCounter)
+    static bool initializeEnabled() noexcept;
+
+    const char *m_name;
+    QTraceCounter *m_next = nullptr;
+    QBasicAtomicInteger<qint64> m_value = Q_BASIC_ATOMIC_INITIALIZER(0);
+};
+
+class QTraceScope
+{
+public:
+    Q_NODISCARD_CTOR explicit QTraceScope(QTraceCounter &calls, QTraceCounter &nsecs) noexcept
+        : m_calls(calls), m_nsecs(nsecs)
+    {
+        if (QTraceCounter::isEnabled())
+            m_timer.start();
+    }
+    ~QTraceScope()
+    {
+        if (m_timer.isValid()) {
+            m_calls.increment();
+            m_nsecs.increment(m_timer.nsecsElapsed());
+        }
+    }
+
+private:
+    Q_DISABLE_COPY_MOVE(QTraceScope)
+
+    QTraceCounter &m_calls;
+    QTraceCounter &m_nsecs;
+    QElapsedTimer m_timer;
+};
+
+QT_END_NAMESPACE
+
+#endif // QTRACECOUNTER_H
@@ -80,6 +80,8 @@ QDBusAbstractInterfacePrivate::QDBusAbstractInterfacePrivate(const QString &serv
                                                          connectionPrivate()->mode == QDBusConnectionPrivate::PeerMode))),
       timeout(-1),
       interactiveAuthorizationAllowed(false),
+      propertyCacheValid(false),
+      propertyCacheEnabled(false),
       isValid(!lastError.isValid())
 {
     if (!isValid)
@@ -137,27 +139,34 @@ bool QDBusAbstractInterfacePrivate::property(const QMetaProperty &mp, void *retu
     }
 
     // try to read this property
-    QDBusMessage msg = QDBusMessage::createMethodCall(service, path,
-                                                      QDBusUtil::dbusInterfaceProperties(),
-                                                      QStringLiteral("Get"));
-    QDBusMessagePrivate::setParametersValidated(msg, true);
-    msg << interface << QString::fromUtf8(mp.name());
-    QDBusMessage reply = connection.call(msg, QDBus::Block, timeout);
+    QVariant value;
+    if (propertyCacheEnabled) {
+        if (!cachedPropertyValue(QString::fromUtf8(mp.name()), value))
+            return false;       // lastError already set
+    } else {
+        QDBusMessage msg = QDBusMessage::createMethodCall(service, path,
+                                                          QDBusUtil::dbusInterfaceProperties(),
+                                                          QStringLiteral("Get"));
+        QDBusMessagePrivate::setParametersValidated(msg, true);
+        msg << interface << QString::fromUtf8(mp.name());
+        QDBusMessage reply = connection.call(msg, QDBus::Block, timeout);
+
+        if (reply.type() != QDBusMessage::ReplyMessage) {
+            lastError = QDBusError(reply);
+            return false;
+        }
+        if (reply.signature() != "v"_L1) {
+            QString errmsg =
+                    "Invalid signature '%1' in return from call to " DBUS_INTERFACE_PROPERTIES ""_L1;
+            lastError = QDBusError(QDBusError::InvalidSignature, std::move(errmsg).arg(reply.signature()));
+            return false;
+        }
 
-    if (reply.type() != QDBusMessage::ReplyMessage) {
-        lastError = QDBusError(reply);
-        return false;
-    }
-    if (reply.signature() != "v"_L1) {
-        QString errmsg =
-                "Invalid signature '%1' in return from call to " DBUS_INTERFACE_PROPERTIES ""_L1;
-        lastError = QDBusError(QDBusError::InvalidSignature, std::move(errmsg).arg(reply.signature()));
-        return false;
+        value = qvariant_cast<QDBusVariant>(reply.arguments().at(0)).variant();
     }
 
     QByteArray foundSignature;
     const char *foundType = nullptr;
-    QVariant value = qvariant_cast<QDBusVariant>(reply.arguments().at(0)).variant();
 
     if (value.metaType() == type || type.id() == QMetaType::QVariant
         || (expectedSignature[0] == 'v' && expectedSignature[1] == '\0')) {
@@ -215,9 +224,95 @@ bool QDBusAbstractInterfacePrivate::setProperty(const QMetaProperty &mp, const Q
         lastError = QDBusError(reply);
         return false;
     }
+    if (propertyCacheEnabled) {
+        // refetch in one batch on the next read; the service may have
+        // transformed the value and may not emit PropertiesChanged for it
+        invalidatePropertyCache();
+    }
     return true;
 }
 
+/*!
+    \internal
+    Returns the value of the property \a name in \a value, serving it from the
+    cache filled by a single batched org.freedesktop.DBus.Properties.GetAll
+    call. The cache is kept current by _q_propertiesChanged(), so steady-state
+    property polling involves no D-Bus traffic at all. On failure, sets
+    lastError and returns false.
+*/
+bool QDBusAbstractInterfacePrivate::cachedPropertyValue(const QString &name, QVariant &value) const
+{
+    QMutexLocker locker(&cacheMutex);
+    if (!propertyCacheValid) {
+        locker.unlock();
+
+        QDBusMessage msg = QDBusMessage::createMethodCall(service, path,
+                                                          QDBusUtil::dbusInterfaceProperties(),
+                                                          QStringLiteral("GetAll"));
+        QDBusMessagePrivate::setParametersValidated(msg, true);
+        msg << interface;
+        QDBusMessage reply = connection.call(msg, QDBus::Block, timeout);
+
+        if (reply.type() != QDBusMessage::ReplyMessage) {
+            lastError = QDBusError(reply);
+            return false;
+        }
+        if (reply.signature() != "a{sv}"_L1) {
+            QString errmsg =
+                    "Invalid signature '%1' in return from call to " DBUS_INTERFACE_PROPERTIES ""_L1;
+            lastError = QDBusError(QDBusError::InvalidSignature, std::move(errmsg).arg(reply.signature()));
+            return false;
+        }
+
+        QVariantMap values = qdbus_cast<QVariantMap>(reply.arguments().at(0));
+        locker.relock();
+        cachedProperties = std::move(values);
+        propertyCacheValid = true;
+    }
+
+    const auto it = cachedProperties.constFind(name);
+    if (it == cachedProperties.constEnd()) {
+        lastError = QDBusError(QDBusError::UnknownProperty,
+                               "Property %1 not returned by call to " DBUS_INTERFACE_PROPERTIES
+                               ".GetAll"_L1.arg(name));
+        return false;
+    }
+    value = it.value();
+    return true;
+}
+
+/*!
+    \internal
+    Discards the GetAll-backed property cache so that the next property read
+    refetches all values in one batch.
+*/
+void QDBusAbstractInterfacePrivate::invalidatePropertyCache()
+{
+    QMutexLocker locker(&cacheMutex);
+    cachedProperties.clear();
+    propertyCacheValid = false;
+}
+
+void QDBusAbstractInterfacePrivate::_q_propertiesChanged(const QString &interfaceName,
+                                                         const QVariantMap &changedProperties,
+                                                         const QStringList &invalidatedProperties)
+{
+    if (interfaceName != interface)
+        return;
+
+    QMutexLocker locker(&cacheMutex);
+    if (!propertyCacheValid)
+        return;
+    for (auto it = changedProperties.cbegin(), end = changedProperties.cend(); it != end; ++it)
+        cachedProperties.insert(it.key(), it.value());
+    if (!invalidatedProperties.isEmpty()) {
+        // their new values weren't included in the signal; refetch everything
+        // in one batch on the next read instead of issuing individual Gets
+        cachedProperties.clear();
+        propertyCacheValid = false;
+    }
+}
+
 void QDBusAbstractInterfacePrivate::_q_serviceOwnerChanged(const QString &name,
                                                            const QString &oldOwner,
                                                            const QString &newOwner)
@@ -226,6 +321,7 @@ void QDBusAbstractInterfacePrivate::_q_serviceOwnerChanged(const QString &name,
     //qDebug() << "QDBusAbstractInterfacePrivate serviceOwnerChanged" << name << oldOwner << newOwner;
     Q_ASSERT(name == service);
     currentOwner = newOwner;
+    invalidatePropertyCache();      // the new owner may report different values
 }
 
 QDBusAbstractInterfaceBase::QDBusAbstractInterfaceBase(QDBusAbstractInterfacePrivate &d, QObject *parent)
@@ -434,6 +530,63 @@ bool QDBusAbstractInterface::isInteractiveAuthorizationAllowed() const
     return d_func()->interactiveAuthorizationAllowed;
 }
 
+/*!
+    Configures whether property reads on this interface are served from a
+    local cache.
+
+    If \a enable is set to \c true, the first property read fetches the
+    values of all properties of this interface in a single batched
+    \c org.freedesktop.DBus.Properties.GetAll call and subsequent reads are
+    answered from the cache, which is kept current by listening to the
+    \c org.freedesktop.DBus.Properties.PropertiesChanged signal. This avoids
+    one blocking round trip per property read, which makes a substantial
+    difference for applications that poll many properties frequently.
+
+    Only enable the cache for services that implement \c GetAll and emit
+    \c PropertiesChanged for the cached interface; for services that do not,
+    property reads may fail or return stale values. Writing a property
+    discards the cache, as does a change of the service owner.
+
+    The default is \c false.
+
+    \since 6.9
+    \sa isPropertyCacheEnabled()
+*/
+void QDBusAbstractInterface::setPropertyCacheEnabled(bool enable)
+{
+    Q_D(QDBusAbstractInterface);
+    if (d->propertyCacheEnabled == enable)
+        return;
+    d->propertyCacheEnabled = enable;
+    if (!d->isValid)
+        return;
+
+    if (enable) {
+        d->connection.connect(d->service, d->path, QDBusUtil::dbusInterfaceProperties(),
+                              QStringLiteral("PropertiesChanged"), this,
+                              SLOT(_q_propertiesChanged(QString,QVariantMap,QStringList)));
+    } else {
+        d->connection.disconnect(d->service, d->path, QDBusUtil::dbusInterfaceProperties(),
+                                 QStringLiteral("PropertiesChanged"), this,
+                                 SLOT(_q_propertiesChanged(QString,QVariantMap,QStringList)));
+        d->invalidatePropertyCache();
+    }
+}
+
+/*!
+    Returns whether property reads on this interface are served from a local
+    cache filled by a batched \c GetAll call.
+
+    The default is \c false.
+
+    \since 6.9
+    \sa setPropertyCacheEnabled()
+*/
+bool QDBusAbstractInterface::isPropertyCacheEnabled() const
+{
+    return d_func()->propertyCacheEnabled;
+}
+
 /*!
     Places a call to the remote method specified by \a method on this interface, using \a args as
     arguments. This function returns the message that was received as a reply, which can be a normal
@@ -467,24 +620,33 @@ QDBusMessage QDBusAbstractInterface::callWithArgumentList(QDBus::CallMode mode,
         m.truncate(pos);
 
     if (mode == QDBus::AutoDetect) {
-        // determine if this a sync or async call
-        mode = QDBus::Block;
-        const QMetaObject *mo = metaObject();
-        QByteArray match = m.toLatin1();
-
-        for (int i = staticMetaObject.methodCount(); i < mo->methodCount(); ++i) {
-            QMetaMethod mm = mo->method(i);
-            if (mm.name() == match) {
-                // found a method with the same name as what we're looking for
-                // hopefully, nobody is overloading asynchronous and synchronous methods with
-                // the same name
-
-                QList<QByteArray> tags = QByteArray(mm.tag()).split(' ');
-                if (tags.contains("Q_NOREPLY"))
-                    mode = QDBus::NoBlock;
-
-                break;
+        // the resolved mode cannot change (the metaobject is fixed), so scan
+        // for it only on the first call to each method
+        QMutexLocker locker(&d->cacheMutex);
+        const auto it = d->callModeCache.constFind(m);
+        if (it != d->callModeCache.cend()) {
+            mode = it.value();
+        } else {
+            // determine if this a sync or async call
+            mode = QDBus::Block;
+            const QMetaObject *mo = metaObject();
+            QByteArray match = m.toLatin1();
+
+            for (int i = staticMetaObject.methodCount(); i < mo->methodCount(); ++i) {
+                QMetaMethod mm = mo->method(i);
+                if (mm.name() == match) {
+                    // found a method with the same name as what we're looking for
+                    // hopefully, nobody is overloading asynchronous and synchronous methods with
+                    // the same name
+
+                    QList<QByteArray> tags = QByteArray(mm.tag()).split(' ');
+                    if (tags.contains("Q_NOREPLY"))
+                        mode = QDBus::NoBlock;
+
+                    break;
+                }
             }
+            d->callModeCache.insert(m, mode);
         }
     }
 
@@ -66,6 +66,9 @@ public:
     void setInteractiveAuthorizationAllowed(bool enable);
     bool isInteractiveAuthorizationAllowed() const;
 
+    void setPropertyCacheEnabled(bool enable);
+    bool isPropertyCacheEnabled() const;
+
     QDBusMessage call(const QString &method)
     {
         return doCall(QDBus::AutoDetect, method, nullptr, 0);
@@ -136,6 +139,7 @@ private:
 private:
     Q_DECLARE_PRIVATE(QDBusAbstractInterface)
     Q_PRIVATE_SLOT(d_func(), void _q_serviceOwnerChanged(QString,QString,QString))
+    Q_PRIVATE_SLOT(d_func(), void _q_propertiesChanged(QString,QVariantMap,QStringList))
 };
 
 QT_END_NAMESPACE
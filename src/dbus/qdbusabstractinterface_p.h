@@ -24,6 +24,10 @@
 #include "qdbusconnection_p.h"
 #include "private/qobject_p.h"
 
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvariant.h>
+
 #define ANNOTATION_NO_WAIT      "org.freedesktop.DBus.Method.NoReply"
 
 #ifndef QT_NO_DBUS
@@ -44,6 +48,15 @@ public:
     int timeout;
     bool interactiveAuthorizationAllowed;
 
+    // caches the call modes resolved for QDBus::AutoDetect calls, keyed by
+    // method name, and (when enabled with setPropertyCacheEnabled()) the
+    // property values fetched in one batched Properties.GetAll call
+    mutable QMutex cacheMutex;
+    mutable QHash<QString, QDBus::CallMode> callModeCache;
+    mutable QVariantMap cachedProperties;
+    mutable bool propertyCacheValid;
+    bool propertyCacheEnabled;
+
     // this is set during creation and never changed
     // it can't be const because QDBusInterfacePrivate has one more check
     bool isValid;
@@ -57,12 +70,16 @@ public:
     // these functions do not check if the property is valid
     bool property(const QMetaProperty &mp, void *returnValuePtr) const;
     bool setProperty(const QMetaProperty &mp, const QVariant &value);
+    bool cachedPropertyValue(const QString &name, QVariant &value) const;
+    void invalidatePropertyCache();
 
     // return conn's d pointer
     inline QDBusConnectionPrivate *connectionPrivate() const
     { return QDBusConnectionPrivate::d(connection); }
 
     void _q_serviceOwnerChanged(const QString &name, const QString &oldOwner, const QString &newOwner);
+    void _q_propertiesChanged(const QString &interfaceName, const QVariantMap &changedProperties,
+                              const QStringList &invalidatedProperties);
 
     static void finishDisconnectNotify(QDBusAbstractInterface *iface, int signalId);
 };
@@ -524,7 +524,8 @@ qDBusSignalFilter(DBusConnection *connection, DBusMessage *message, void *data)
     if (d->mode == QDBusConnectionPrivate::InvalidMode)
         return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
 
-    QDBusMessage amsg = QDBusMessagePrivate::fromDBusMessage(message, d->connectionCapabilities());
+    QDBusMessage amsg = QDBusMessagePrivate::fromDBusMessage(message, d->connectionCapabilities(),
+                                                             true /* lazy demarshalling */);
     qDBusDebug() << d << "got message (signal):" << amsg;
 
     return d->handleMessage(amsg) ?
@@ -1878,7 +1879,8 @@ void QDBusConnectionPrivate::processFinishedCall(QDBusPendingCallPrivate *call)
         if (q_dbus_pending_call_get_completed(call->pending)) {
             // decode the message
             DBusMessage *reply = q_dbus_pending_call_steal_reply(call->pending);
-            msg = QDBusMessagePrivate::fromDBusMessage(reply, connection->connectionCapabilities());
+            msg = QDBusMessagePrivate::fromDBusMessage(reply, connection->connectionCapabilities(),
+                                                       true /* lazy demarshalling */);
             q_dbus_message_unref(reply);
         } else {
             msg = QDBusMessage::createError(QDBusError::Disconnected, QDBusUtil::disconnectedErrorMessage());
@@ -8,6 +8,8 @@
 #include <qdebug.h>
 #include <qstringlist.h>
 
+#include <QtCore/private/qlocking_p.h>
+
 #include "qdbus_symbols_p.h"
 
 #include "qdbusargument_p.h"
@@ -36,7 +38,7 @@ static inline const char *data(const QByteArray &arr)
 }
 
 QDBusMessagePrivate::QDBusMessagePrivate()
-    : localReply(nullptr), ref(1), type(QDBusMessage::InvalidMessage),
+    : pendingMessage(nullptr), localReply(nullptr), ref(1), type(QDBusMessage::InvalidMessage),
       delayedReply(false), parametersValidated(false),
       localMessage(false), autoStartService(true),
       interactiveAuthorizationAllowed(false), isReplyRequired(false)
@@ -45,9 +47,41 @@ QDBusMessagePrivate::QDBusMessagePrivate()
 
 QDBusMessagePrivate::~QDBusMessagePrivate()
 {
+    if (DBusMessage *dmsg = pendingMessage.loadRelaxed())
+        q_dbus_message_unref(dmsg);
     delete localReply;
 }
 
+/*!
+    \internal
+    Demarshalls the arguments of an incoming message whose parsing was
+    deferred by fromDBusMessage(). This runs on the first access to the
+    argument list, which normally happens in the thread that consumes the
+    message instead of the connection's thread.
+*/
+void QDBusMessagePrivate::demarshallPendingArguments()
+{
+    // serializes concurrent first accesses; contention is rare enough that a
+    // single global lock beats growing every message by one mutex
+    Q_CONSTINIT static QBasicMutex demarshallingLock;
+    const auto locker = qt_scoped_lock(demarshallingLock);
+
+    DBusMessage *dmsg = pendingMessage.loadRelaxed();
+    if (!dmsg)
+        return;                 // another thread got here first
+
+    QDBusDemarshaller demarshaller(capabilities);
+    demarshaller.message = q_dbus_message_ref(dmsg);
+    if (q_dbus_message_iter_init(demarshaller.message, &demarshaller.iterator))
+        while (!demarshaller.atEnd())
+            arguments << demarshaller.toVariantInternal();
+
+    // the release store pairs with the acquire load in ensureArguments(),
+    // making the filled argument list visible before the fast path is taken
+    if (pendingMessage.testAndSetRelease(dmsg, nullptr))
+        q_dbus_message_unref(dmsg);
+}
+
 void QDBusMessagePrivate::createResponseLink(const QDBusMessagePrivate *call)
 {
     if (Q_UNLIKELY(call->type != QDBusMessage::MethodCallMessage)) {
@@ -76,6 +110,7 @@ QString QDBusMessage::errorMessage() const
     if (d_ptr->type == ErrorMessage) {
         if (!d_ptr->message.isEmpty())
            return d_ptr->message;
+        d_ptr->ensureArguments();
         if (!d_ptr->arguments.isEmpty())
             return d_ptr->arguments.at(0).toString();
     }
@@ -100,6 +135,7 @@ DBusMessage *QDBusMessagePrivate::toDBusMessage(const QDBusMessage &message, QDB
     }
 
     DBusMessage *msg = nullptr;
+    message.d_ptr->ensureArguments();   // in case we're re-sending a received message
     const QDBusMessagePrivate *d_ptr = message.d_ptr;
 
     switch (d_ptr->type) {
@@ -210,9 +246,13 @@ DBUS_DISABLE_CHECKS
 
 /*!
     \internal
-    Constructs a QDBusMessage by parsing the given DBusMessage object.
+    Constructs a QDBusMessage by parsing the given DBusMessage object. If
+    \a lazyDemarshalling is true, only the header fields are parsed here and
+    the arguments are demarshalled on first access, keeping the heavy lifting
+    off the connection's thread.
 */
-QDBusMessage QDBusMessagePrivate::fromDBusMessage(DBusMessage *dmsg, QDBusConnection::ConnectionCapabilities capabilities)
+QDBusMessage QDBusMessagePrivate::fromDBusMessage(DBusMessage *dmsg, QDBusConnection::ConnectionCapabilities capabilities,
+                                                  bool lazyDemarshalling)
 {
     QDBusMessage message;
     if (!dmsg)
@@ -230,6 +270,15 @@ QDBusMessage QDBusMessagePrivate::fromDBusMessage(DBusMessage *dmsg, QDBusConnec
     message.d_ptr->interactiveAuthorizationAllowed = q_dbus_message_get_allow_interactive_authorization(dmsg);
     message.d_ptr->isReplyRequired = !q_dbus_message_get_no_reply(dmsg);
 
+    if (lazyDemarshalling) {
+        // defer the (possibly expensive) argument demarshalling until the
+        // first access, so it runs on the thread consuming the message
+        // instead of the connection's thread
+        message.d_ptr->capabilities = capabilities;
+        message.d_ptr->pendingMessage.storeRelaxed(q_dbus_message_ref(dmsg));
+        return message;
+    }
+
     QDBusDemarshaller demarshaller(capabilities);
     demarshaller.message = q_dbus_message_ref(dmsg);
     if (q_dbus_message_iter_init(demarshaller.message, &demarshaller.iterator))
@@ -251,6 +300,8 @@ QDBusMessage QDBusMessagePrivate::makeLocal(const QDBusConnectionPrivate &conn,
     // (as opposed to the message as we send it), is the sender
     // so we simply set the sender to our unique name
 
+    asSent.d_ptr->ensureArguments();    // in case we're re-sending a received message
+
     // determine if we are carrying any complex types
     QString computedSignature;
     for (const QVariant &argument : std::as_const(asSent.d_ptr->arguments)) {
@@ -744,6 +795,10 @@ bool QDBusMessage::isInteractiveAuthorizationAllowed() const
 */
 void QDBusMessage::setArguments(const QList<QVariant> &arguments)
 {
+    // the old argument list is replaced wholesale, so don't bother
+    // demarshalling a pending raw message
+    if (DBusMessage *dmsg = d_ptr->pendingMessage.fetchAndStoreOrdered(nullptr))
+        q_dbus_message_unref(dmsg);
     d_ptr->arguments = arguments;
 }
 
@@ -753,6 +808,7 @@ void QDBusMessage::setArguments(const QList<QVariant> &arguments)
 */
 QList<QVariant> QDBusMessage::arguments() const
 {
+    d_ptr->ensureArguments();
     return d_ptr->arguments;
 }
 
@@ -763,6 +819,7 @@ QList<QVariant> QDBusMessage::arguments() const
 
 QDBusMessage &QDBusMessage::operator<<(const QVariant &arg)
 {
+    d_ptr->ensureArguments();
     d_ptr->arguments.append(arg);
     return *this;
 }
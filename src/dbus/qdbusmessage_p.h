@@ -42,6 +42,12 @@ public:
     // (service is also used to store the destination of reply-type messages)
     QString service, path, interface, name, message, signature;
 
+    // for incoming messages whose demarshalling was deferred by
+    // fromDBusMessage(): the raw message (referenced) and the capabilities
+    // needed to parse it on the first access to the argument list
+    QAtomicPointer<DBusMessage> pendingMessage;
+    QDBusConnection::ConnectionCapabilities capabilities;
+
     mutable QDBusMessage *localReply;
     QAtomicInt ref;
     QDBusMessage::MessageType type;
@@ -55,12 +61,19 @@ public:
     uint isReplyRequired : 1;
 
     void createResponseLink(const QDBusMessagePrivate *call);
+    void ensureArguments()
+    {
+        if (pendingMessage.loadAcquire())
+            demarshallPendingArguments();
+    }
+    void demarshallPendingArguments();
     static void setParametersValidated(QDBusMessage &msg, bool enable)
     { msg.d_ptr->parametersValidated = enable; }
 
     static DBusMessage *toDBusMessage(const QDBusMessage &message, QDBusConnection::ConnectionCapabilities capabilities,
                                       QDBusError *error);
-    static QDBusMessage fromDBusMessage(DBusMessage *dmsg, QDBusConnection::ConnectionCapabilities capabilities);
+    static QDBusMessage fromDBusMessage(DBusMessage *dmsg, QDBusConnection::ConnectionCapabilities capabilities,
+                                        bool lazyDemarshalling = false);
 
     static bool isLocal(const QDBusMessage &msg);
     static QDBusMessage makeLocal(const QDBusConnectionPrivate &conn,
@@ -128,6 +128,10 @@ static const uint *QT_FASTCALL fetchRGB32ToARGB32PM(uint *buffer, const uchar *s
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
 extern void QT_FASTCALL storeRGB32FromARGB32PM_sse4(uchar *dest, const uint *src, int index, int count,
                                                     const QList<QRgb> *, QDitherInfo *);
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+extern void QT_FASTCALL storeRGB32FromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                                    const QList<QRgb> *, QDitherInfo *);
+#endif
 #elif defined(__ARM_NEON__) && (Q_BYTE_ORDER == Q_LITTLE_ENDIAN)
 extern void QT_FASTCALL storeRGB32FromARGB32PM_neon(uchar *dest, const uint *src, int index, int count,
                                                     const QList<QRgb> *, QDitherInfo *);
@@ -152,6 +156,11 @@ void convert_generic(QImageData *dest, const QImageData *src, Qt::ImageConversio
             fetch = fetchRGB32ToARGB32PM;
         if (dest->format == QImage::Format_RGB32) {
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+            if (qCpuHasFeature(ArchHaswell))
+                store = storeRGB32FromARGB32PM_avx2;
+            else
+#endif
             if (qCpuHasFeature(SSE4_1))
                 store = storeRGB32FromARGB32PM_sse4;
             else
@@ -370,6 +379,11 @@ bool convert_generic_inplace(QImageData *data, QImage::Format dst_format, Qt::Im
             fetch = fetchRGB32ToARGB32PM;
         if (dst_format == QImage::Format_RGB32) {
 #ifdef QT_COMPILER_SUPPORTS_SSE4_1
+#ifdef QT_COMPILER_SUPPORTS_AVX2
+            if (qCpuHasFeature(ArchHaswell))
+                store = storeRGB32FromARGB32PM_avx2;
+            else
+#endif
             if (qCpuHasFeature(SSE4_1))
                 store = storeRGB32FromARGB32PM_sse4;
             else
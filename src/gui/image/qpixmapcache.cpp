@@ -201,7 +201,16 @@ public:
 
     bool flushDetachedPixmaps(bool nt);
 
+    void recordEntryDestroyed()
+    {
+        if (!destroyingEntries)
+            ++stats.evictions;
+    }
+
+    mutable QPixmapCache::Statistics stats;
+
 private:
+    bool destroyingEntries = false; // explicit remove()/clear(), not an eviction
     static constexpr auto soon_time = 10s;
     static constexpr auto flush_time = 30s;
     int *keyArray;
@@ -284,6 +293,7 @@ QPixmap *QPMCache::object(const QString &key) const
 {
     if (const auto it = cacheKeys.find(key); it != cacheKeys.cend())
         return object(it.value());
+    ++stats.misses;
     return nullptr;
 }
 
@@ -294,6 +304,10 @@ QPixmap *QPMCache::object(const QPixmapCache::Key &key) const
     //We didn't find the pixmap in the cache, the key is not valid anymore
     if (!ptr)
         const_cast<QPMCache *>(this)->releaseKey(key);
+    if (ptr)
+        ++stats.hits;
+    else
+        ++stats.misses;
     return ptr;
 }
 
@@ -318,10 +332,14 @@ QPixmapCache::Key QPMCache::insert(const QPixmap &pixmap, int cost)
     bool success = QCache<QPixmapCache::Key, QPixmapCacheEntry>::insert(cacheKey, new QPixmapCacheEntry(cacheKey, pixmap), cost);
     Q_ASSERT(success || !cacheKey.isValid());
     if (success) {
+        ++stats.inserts;
         if (!theid) {
             theid = startTimer(flush_time);
             t = false;
         }
+    } else {
+        // a failed insert destroys the new entry; that is not an eviction
+        --stats.evictions;
     }
     return cacheKey;
 }
@@ -334,7 +352,10 @@ bool QPMCache::remove(const QString &key)
 
 bool QPMCache::remove(const QPixmapCache::Key &key)
 {
-    return QCache<QPixmapCache::Key, QPixmapCacheEntry>::remove(key);
+    destroyingEntries = true;
+    const bool result = QCache<QPixmapCache::Key, QPixmapCacheEntry>::remove(key);
+    destroyingEntries = false;
+    return result;
 }
 
 void QPMCache::resizeKeyArray(int size)
@@ -388,7 +409,9 @@ void QPMCache::clear()
         if (key.d)
             key.d->isValid = false;
     }
+    destroyingEntries = true;
     QCache<QPixmapCache::Key, QPixmapCacheEntry>::clear();
+    destroyingEntries = false;
     // Nothing left to flush; stop the timer
     if (theid) {
         killTimer(theid);
@@ -412,7 +435,9 @@ int Q_AUTOTEST_EXPORT q_QPixmapCache_keyHashSize()
 
 QPixmapCacheEntry::~QPixmapCacheEntry()
 {
-    pm_cache()->releaseKey(key);
+    QPMCache *cache = pm_cache();
+    cache->recordEntryDestroyed();
+    cache->releaseKey(key);
 }
 
 /*!
@@ -549,6 +574,51 @@ void QPixmapCache::setCacheLimit(int n)
     pm_cache()->setMaxCost(n);
 }
 
+/*!
+    \struct QPixmapCache::Statistics
+    \inmodule QtGui
+    \since 6.9
+    \brief The QPixmapCache::Statistics struct carries counters describing
+    the cache's effectiveness.
+
+    \c hits and \c misses count find() calls that did and did not locate a
+    pixmap. \c inserts counts successfully inserted pixmaps, and \c evictions
+    counts pixmaps the cache dropped on its own, either to stay within
+    cacheLimit() or through the periodic flush of unused pixmaps; explicit
+    remove() and clear() calls are not counted as evictions.
+
+    \sa QPixmapCache::statistics()
+*/
+
+/*!
+    \since 6.9
+
+    Returns the accumulated cache statistics. A high eviction count relative
+    to inserts indicates that cacheLimit() is too small for the working set.
+
+    \sa resetStatistics(), setCacheLimit()
+*/
+QPixmapCache::Statistics QPixmapCache::statistics()
+{
+    if (!qt_pixmapcache_thread_test())
+        return Statistics();
+    return pm_cache()->stats;
+}
+
+/*!
+    \since 6.9
+
+    Resets all cache statistics counters to zero.
+
+    \sa statistics()
+*/
+void QPixmapCache::resetStatistics()
+{
+    if (!qt_pixmapcache_thread_test())
+        return;
+    pm_cache()->stats = Statistics();
+}
+
 /*!
   Removes the pixmap associated with \a key from the cache.
 */
@@ -40,8 +40,18 @@ public:
         friend class QPixmapCache;
     };
 
+    struct Statistics
+    {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        quint64 inserts = 0;
+        quint64 evictions = 0;
+    };
+
     static int cacheLimit();
     static void setCacheLimit(int);
+    static Statistics statistics();
+    static void resetStatistics();
     static bool find(const QString &key, QPixmap *pixmap);
     static bool find(const Key &key, QPixmap *pixmap);
     static bool insert(const QString &key, const QPixmap &pixmap);
@@ -5,6 +5,8 @@
 #include <qcoreapplication.h>
 #include <qdebug.h>
 #include <qdirlisting.h>
+#include <qsemaphore.h>
+#include <qthreadpool.h>
 #include <private/qabstractfileiconprovider_p.h>
 #include <private/qfileinfo_p.h>
 #ifndef Q_OS_WIN
@@ -418,6 +420,7 @@ void QFileInfoGatherer::getFileInfos(const QString &path, const QStringList &fil
     QStringList filesToCheck = files;
 
     QStringList allFiles;
+    QList<QFileInfo> entries;
     if (files.isEmpty()) {
         // Use QDirListing::IteratorFlags when QFileSystemModel is
         // changed to use them too
@@ -425,14 +428,17 @@ void QFileInfoGatherer::getFileInfos(const QString &path, const QStringList &fil
         for (const auto &dirEntry : QDirListing(path, {}, dirFilters.toInt())) {
             if (isInterruptionRequested())
                 break;
-            fileInfo = dirEntry.fileInfo();
-            fileInfo.stat();
-            allFiles.append(fileInfo.fileName());
-            fetch(fileInfo, base, firstTime, updatedFiles, path);
+            // enumeration only needs the name (and the entry type the
+            // dirent already carries); the expensive stats are issued in
+            // parallel once the whole list is known
+            entries.append(dirEntry.fileInfo());
+            allFiles.append(entries.last().fileName());
         }
     }
     if (!allFiles.isEmpty())
         emit newListOfFiles(path, allFiles);
+    if (!entries.isEmpty())
+        statEntriesInParallel(path, entries);
 
     QStringList::const_iterator filesIt = filesToCheck.constBegin();
     while (!isInterruptionRequested() && filesIt != filesToCheck.constEnd()) {
@@ -446,6 +452,66 @@ void QFileInfoGatherer::getFileInfos(const QString &path, const QStringList &fil
     emit directoryLoaded(path);
 }
 
+/*
+    Stat the enumerated directory entries on the global thread pool, a few
+    hundred entries per task, and deliver the results in large batches. On
+    slow (network) file systems the stats dominate the listing time by far;
+    issuing them in parallel and coalescing everything that has finished into
+    one updates() emission keeps both the wall-clock time and the number of
+    layout passes in the model low.
+*/
+void QFileInfoGatherer::statEntriesInParallel(const QString &path, QList<QFileInfo> &entries)
+{
+    constexpr qsizetype chunkSize = 512;
+    const qsizetype count = entries.size();
+    const qsizetype chunkCount = (count + chunkSize - 1) / chunkSize;
+    QFileInfo *const data = entries.data();
+
+    QMutex batchMutex;
+    QList<QList<std::pair<QString, QFileInfo>>> readyBatches;
+    QSemaphore batchesReady;
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    for (qsizetype chunk = 0; chunk < chunkCount; ++chunk) {
+        const qsizetype first = chunk * chunkSize;
+        const qsizetype last = qMin(first + chunkSize, count);
+        pool->start([this, data, first, last, &batchMutex, &readyBatches, &batchesReady] {
+            QList<std::pair<QString, QFileInfo>> batch;
+            if (!isInterruptionRequested()) {
+                batch.reserve(last - first);
+                for (qsizetype i = first; i < last; ++i) {
+                    data[i].stat();
+                    batch.emplace_back(data[i].fileName(), data[i]);
+                }
+            }
+            {
+                QMutexLocker locker(&batchMutex);
+                readyBatches.append(std::move(batch));
+            }
+            batchesReady.release();
+        });
+    }
+
+    // every task must have finished before the locals above go out of scope,
+    // so drain all batches even when interrupted
+    qsizetype received = 0;
+    while (received < chunkCount) {
+        batchesReady.acquire();
+        qsizetype taken = 1;
+        while (batchesReady.tryAcquire())
+            ++taken;
+        QList<std::pair<QString, QFileInfo>> updatedFiles;
+        {
+            QMutexLocker locker(&batchMutex);
+            for (qsizetype i = 0; i < taken; ++i)
+                updatedFiles += readyBatches.takeFirst();
+        }
+        received += taken;
+        if (!updatedFiles.isEmpty())
+            emit updates(path, updatedFiles);
+    }
+}
+
 void QFileInfoGatherer::fetch(const QFileInfo &fileInfo, QElapsedTimer &base, bool &firstTime,
                               QList<std::pair<QString, QFileInfo>> &updatedFiles, const QString &path)
 {
@@ -169,6 +169,7 @@ private:
     void run() override;
     // called by run():
     void getFileInfos(const QString &path, const QStringList &files);
+    void statEntriesInParallel(const QString &path, QList<QFileInfo> &entries);
     void fetch(const QFileInfo &info, QElapsedTimer &base, bool &firstTime,
                QList<std::pair<QString, QFileInfo>> &updatedFiles, const QString &path);
 
@@ -2389,6 +2389,68 @@ void QStandardItemModel::setItem(int row, int column, QStandardItem *item)
   \overload
 */
 
+/*!
+    \since 6.9
+
+    Sets the data for the given \a role of the top-level items in the given
+    \a column to the given \a values; the item in row \c i receives the value
+    at index \c i. The row and column counts are increased as necessary to
+    fit the values, and items are created where none exist yet.
+
+    This is equivalent to calling setData() on each cell in the column, but
+    is considerably faster for large models: the column is filled in one
+    pass, itemChanged() is not emitted for the individual items, and a single
+    dataChanged() signal covering the whole column is emitted at the end.
+
+    \note As for \l{QStandardItem::}{setData()}, Qt::EditRole and
+    Qt::DisplayRole refer to the same data.
+
+    \sa setData(), setItem(), setRowCount()
+*/
+void QStandardItemModel::setColumnData(int column, const QList<QVariant> &values, int role)
+{
+    Q_D(QStandardItemModel);
+    if (column < 0 || values.isEmpty())
+        return;
+    if (column >= columnCount())
+        setColumnCount(column + 1);
+    if (values.size() > rowCount())
+        setRowCount(int(values.size()));
+
+    role = (role == Qt::EditRole) ? Qt::DisplayRole : role;
+    QStandardItemPrivate *rootPriv = d->root->d_func();
+    for (qsizetype row = 0; row < values.size(); ++row) {
+        const int index = rootPriv->childIndex(int(row), column);
+        QStandardItem *item = rootPriv->children.at(index);
+        if (!item) {
+            item = d->createItem();
+            item->d_func()->setParentAndModel(d->root.data(), this);
+            item->d_func()->lastKnownIndex = index;
+            rootPriv->children.replace(index, item);
+        }
+        const QVariant &value = values.at(row);
+        QList<QStandardItemData> &itemValues = item->d_func()->values;
+        bool assigned = false;
+        for (auto it = itemValues.begin(); it != itemValues.end(); ++it) {
+            if ((*it).role == role) {
+                if (value.isValid())
+                    (*it).value = value;
+                else
+                    itemValues.erase(it);
+                assigned = true;
+                break;
+            }
+        }
+        if (!assigned && value.isValid())
+            itemValues.append(QStandardItemData(role, value));
+    }
+
+    const QList<int> roles((role == Qt::DisplayRole)
+                               ? QList<int>({Qt::DisplayRole, Qt::EditRole})
+                               : QList<int>({role}));
+    emit dataChanged(index(0, column), index(int(values.size()) - 1, column), roles);
+}
+
 /*!
     \since 4.2
 
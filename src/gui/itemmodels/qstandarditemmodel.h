@@ -328,6 +328,7 @@ public:
     QStandardItem *item(int row, int column = 0) const;
     void setItem(int row, int column, QStandardItem *item);
     inline void setItem(int row, QStandardItem *item);
+    void setColumnData(int column, const QList<QVariant> &values, int role = Qt::DisplayRole);
     QStandardItem *invisibleRootItem() const;
 
     QStandardItem *horizontalHeaderItem(int column) const;
@@ -29,6 +29,7 @@
 #include <QtCore/qmutex.h>
 #include <QtCore/private/qthread_p.h>
 #include <QtCore/private/qlocking_p.h>
+#include <QtCore/private/qstartupprofiler_p.h>
 #include <QtCore/private/qflatmap_p.h>
 #include <QtCore/qdir.h>
 #include <QtCore/qlibraryinfo.h>
@@ -1477,6 +1478,8 @@ void QGuiApplicationPrivate::addQtOptions(QList<QCommandLineOption> *options)
 
 void QGuiApplicationPrivate::createPlatformIntegration()
 {
+    QStartupPhase startupPhase("QGuiApplicationPrivate::createPlatformIntegration");
+
     QHighDpiScaling::initHighDpiScaling();
 
     // Load the platform integration
@@ -6,6 +6,8 @@
 #include <QtCore/qvariant.h>
 #include <QtGui/qtransform.h>
 
+#include <private/qsimd_p.h>
+
 #include <cmath>
 
 QT_BEGIN_NAMESPACE
@@ -1840,6 +1842,151 @@ QRectF QMatrix4x4::mapRect(const QRectF& rect) const
     return QRectF(QPointF(xmin, ymin), QPointF(xmax, ymax));
 }
 
+#ifndef QT_NO_VECTOR3D
+
+/*!
+    \since 6.9
+    \overload
+
+    Maps the \a size points at \a in by multiplying this matrix by each
+    of them, including the perspective divide, and writes the results to
+    \a out. The source and destination may be the same array for
+    in-place mapping, but must not otherwise overlap.
+
+    The matrix contents are classified once for the entire span, so this
+    overload is considerably faster than mapping large vertex arrays one
+    point at a time.
+
+    \sa mapVectors()
+*/
+void QMatrix4x4::map(const QVector3D *in, QVector3D *out, qsizetype size) const
+{
+    if (flagBits == Identity) {
+        if (in != out) {
+            for (qsizetype i = 0; i < size; ++i)
+                out[i] = in[i];
+        }
+        return;
+    }
+    if (flagBits.toInt() < Rotation2D) {
+        // Translation | Scale
+        const float m11 = m[0][0], m22 = m[1][1], m33 = m[2][2];
+        const float tx = m[3][0], ty = m[3][1], tz = m[3][2];
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i] = QVector3D(in[i].x() * m11 + tx,
+                               in[i].y() * m22 + ty,
+                               in[i].z() * m33 + tz);
+        }
+        return;
+    }
+#if defined(__SSE2__)
+    // result = col0 * x + col1 * y + col2 * z + col3; the columns are
+    // contiguous in memory
+    const __m128 col0 = _mm_loadu_ps(m[0]);
+    const __m128 col1 = _mm_loadu_ps(m[1]);
+    const __m128 col2 = _mm_loadu_ps(m[2]);
+    const __m128 col3 = _mm_loadu_ps(m[3]);
+    const float *src = reinterpret_cast<const float *>(in);
+    float *dst = reinterpret_cast<float *>(out);
+    for (qsizetype i = 0; i < size; ++i, src += 3, dst += 3) {
+        __m128 res = _mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(src[0])), col3);
+        res = _mm_add_ps(_mm_mul_ps(col1, _mm_set1_ps(src[1])), res);
+        res = _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(src[2])), res);
+        const float w = _mm_cvtss_f32(_mm_shuffle_ps(res, res, _MM_SHUFFLE(3, 3, 3, 3)));
+        if (w != 1.0f)
+            res = _mm_div_ps(res, _mm_set1_ps(w));
+        // store only three floats so the write never reaches past out[i]
+        _mm_storel_pi(reinterpret_cast<__m64 *>(dst), res);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(res, res));
+    }
+#elif defined(__ARM_NEON__)
+    const float32x4_t col0 = vld1q_f32(m[0]);
+    const float32x4_t col1 = vld1q_f32(m[1]);
+    const float32x4_t col2 = vld1q_f32(m[2]);
+    const float32x4_t col3 = vld1q_f32(m[3]);
+    const float *src = reinterpret_cast<const float *>(in);
+    float *dst = reinterpret_cast<float *>(out);
+    for (qsizetype i = 0; i < size; ++i, src += 3, dst += 3) {
+        float32x4_t res = vmlaq_n_f32(col3, col0, src[0]);
+        res = vmlaq_n_f32(res, col1, src[1]);
+        res = vmlaq_n_f32(res, col2, src[2]);
+        const float w = vgetq_lane_f32(res, 3);
+        if (w != 1.0f)
+            res = vmulq_n_f32(res, 1.0f / w);
+        vst1_f32(dst, vget_low_f32(res));
+        vst1q_lane_f32(dst + 2, res, 2);
+    }
+#else
+    for (qsizetype i = 0; i < size; ++i)
+        out[i] = map(in[i]);
+#endif
+}
+
+/*!
+    \since 6.9
+
+    Maps the \a size direction vectors at \a in by multiplying the top
+    3x3 portion of this matrix by each of them and writes the results to
+    \a out, with the same semantics as mapVector(). The source and
+    destination may be the same array for in-place mapping, but must not
+    otherwise overlap.
+
+    \sa map()
+*/
+void QMatrix4x4::mapVectors(const QVector3D *in, QVector3D *out, qsizetype size) const
+{
+    if (flagBits.toInt() < Scale) {
+        // Translation
+        if (in != out) {
+            for (qsizetype i = 0; i < size; ++i)
+                out[i] = in[i];
+        }
+        return;
+    }
+    if (flagBits.toInt() < Rotation2D) {
+        // Translation | Scale
+        const float m11 = m[0][0], m22 = m[1][1], m33 = m[2][2];
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i] = QVector3D(in[i].x() * m11,
+                               in[i].y() * m22,
+                               in[i].z() * m33);
+        }
+        return;
+    }
+#if defined(__SSE2__)
+    const __m128 col0 = _mm_loadu_ps(m[0]);
+    const __m128 col1 = _mm_loadu_ps(m[1]);
+    const __m128 col2 = _mm_loadu_ps(m[2]);
+    const float *src = reinterpret_cast<const float *>(in);
+    float *dst = reinterpret_cast<float *>(out);
+    for (qsizetype i = 0; i < size; ++i, src += 3, dst += 3) {
+        __m128 res = _mm_mul_ps(col0, _mm_set1_ps(src[0]));
+        res = _mm_add_ps(_mm_mul_ps(col1, _mm_set1_ps(src[1])), res);
+        res = _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(src[2])), res);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(dst), res);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(res, res));
+    }
+#elif defined(__ARM_NEON__)
+    const float32x4_t col0 = vld1q_f32(m[0]);
+    const float32x4_t col1 = vld1q_f32(m[1]);
+    const float32x4_t col2 = vld1q_f32(m[2]);
+    const float *src = reinterpret_cast<const float *>(in);
+    float *dst = reinterpret_cast<float *>(out);
+    for (qsizetype i = 0; i < size; ++i, src += 3, dst += 3) {
+        float32x4_t res = vmulq_n_f32(col0, src[0]);
+        res = vmlaq_n_f32(res, col1, src[1]);
+        res = vmlaq_n_f32(res, col2, src[2]);
+        vst1_f32(dst, vget_low_f32(res));
+        vst1q_lane_f32(dst + 2, res, 2);
+    }
+#else
+    for (qsizetype i = 0; i < size; ++i)
+        out[i] = mapVector(in[i]);
+#endif
+}
+
+#endif // QT_NO_VECTOR3D
+
 /*!
     \fn float *QMatrix4x4::data()
 
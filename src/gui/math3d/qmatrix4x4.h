@@ -132,6 +132,8 @@ public:
 #ifndef QT_NO_VECTOR3D
     inline QVector3D map(const QVector3D& point) const;
     inline QVector3D mapVector(const QVector3D& vector) const;
+    void map(const QVector3D *in, QVector3D *out, qsizetype size) const;
+    void mapVectors(const QVector3D *in, QVector3D *out, qsizetype size) const;
 #endif
 #ifndef QT_NO_VECTOR4D
     inline QVector4D map(const QVector4D& point) const;
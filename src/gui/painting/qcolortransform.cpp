@@ -270,9 +270,23 @@ enum ApplyMatrixForm {
     DoClamp = 1
 };
 
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+// Defined in qcolortransform_avx2.cpp; all of these require len >= 2.
+extern void qColorTransformApplyMatrix_avx2(QColorVector *buffer, qsizetype len, const QColorMatrix &colorMatrix, bool doClamp);
+extern void qColorTransformLoadPremultipliedArgb32_avx2(QColorVector *buffer, const QRgb *src, qsizetype len, const QColorTransformPrivate *d_ptr);
+extern void qColorTransformLoadUnpremultipliedArgb32_avx2(QColorVector *buffer, const QRgb *src, qsizetype len, const QColorTransformPrivate *d_ptr);
+extern void qColorTransformStorePremultipliedArgb32_avx2(QRgb *dst, const QRgb *src, const QColorVector *buffer, qsizetype len, const QColorTransformPrivate *d_ptr);
+extern void qColorTransformStoreUnpremultipliedArgb32_avx2(QRgb *dst, const QRgb *src, const QColorVector *buffer, qsizetype len, const QColorTransformPrivate *d_ptr);
+extern void qColorTransformStoreOpaqueArgb32_avx2(QRgb *dst, const QColorVector *buffer, qsizetype len, const QColorTransformPrivate *d_ptr);
+#endif
+
 template<ApplyMatrixForm doClamp = DoClamp>
 static void applyMatrix(QColorVector *buffer, const qsizetype len, const QColorMatrix &colorMatrix)
 {
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if (qCpuHasFeature(ArchHaswell) && len >= 2)
+        return qColorTransformApplyMatrix_avx2(buffer, len, colorMatrix, doClamp == DoClamp);
+#endif
 #if defined(__SSE2__)
     const __m128 minV = _mm_set1_ps(0.0f);
     const __m128 maxV = _mm_set1_ps(1.0f);
@@ -445,6 +459,12 @@ inline void loadP<QRgba64>(const QRgba64 &p, __m128i &v)
 template<typename T>
 static void loadPremultiplied(QColorVector *buffer, const T *src, const qsizetype len, const QColorTransformPrivate *d_ptr)
 {
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if constexpr (std::is_same_v<T, QRgb>) {
+        if (qCpuHasFeature(ArchHaswell) && len >= 2)
+            return qColorTransformLoadPremultipliedArgb32_avx2(buffer, src, len, d_ptr);
+    }
+#endif
     const __m128 vTrcRes = _mm_set1_ps(float(QColorTrcLut::Resolution));
     const __m128 iFF00 = _mm_set1_ps(1.0f / (255 * 256));
     constexpr bool isARGB = isArgb<T>();
@@ -571,6 +591,12 @@ inline void loadPU<QRgba64>(const QRgba64 &p, __m128i &v)
 template<typename T>
 void loadUnpremultiplied(QColorVector *buffer, const T *src, const qsizetype len, const QColorTransformPrivate *d_ptr)
 {
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if constexpr (std::is_same_v<T, QRgb>) {
+        if (qCpuHasFeature(ArchHaswell) && len >= 2)
+            return qColorTransformLoadUnpremultipliedArgb32_avx2(buffer, src, len, d_ptr);
+    }
+#endif
     constexpr bool isARGB = isArgb<T>();
     const __m128 iFF00 = _mm_set1_ps(1.0f / (255 * 256));
     const __m128i vRangeMax = _mm_setr_epi32(isARGB ? d_ptr->colorSpaceIn->lut[2]->m_unclampedToLinear
@@ -890,6 +916,12 @@ template<typename D, typename S,
 static void storePremultiplied(D *dst, const S *src, const QColorVector *buffer, const qsizetype len,
                                const QColorTransformPrivate *d_ptr)
 {
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if constexpr (std::is_same_v<D, QRgb> && std::is_same_v<S, QRgb>) {
+        if (qCpuHasFeature(ArchHaswell) && len >= 2)
+            return qColorTransformStorePremultipliedArgb32_avx2(dst, src, buffer, len, d_ptr);
+    }
+#endif
     const __m128 vTrcRes = _mm_set1_ps(float(QColorTrcLut::Resolution));
     const __m128 iFF00 = _mm_set1_ps(1.0f / (255 * 256));
     constexpr bool isARGB = isArgb<D>();
@@ -974,6 +1006,12 @@ template<typename D, typename S,
 static void storeUnpremultiplied(D *dst, const S *src, const QColorVector *buffer, const qsizetype len,
                                  const QColorTransformPrivate *d_ptr)
 {
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if constexpr (std::is_same_v<D, QRgb> && std::is_same_v<S, QRgb>) {
+        if (qCpuHasFeature(ArchHaswell) && len >= 2)
+            return qColorTransformStoreUnpremultipliedArgb32_avx2(dst, src, buffer, len, d_ptr);
+    }
+#endif
     const __m128 vTrcRes = _mm_set1_ps(float(QColorTrcLut::Resolution));
     constexpr bool isARGB = isArgb<D>();
     static_assert(getFactor<D>() >= getFactor<S>());
@@ -1031,6 +1069,12 @@ template<typename T>
 static void storeOpaque(T *dst, const QColorVector *buffer, const qsizetype len,
                         const QColorTransformPrivate *d_ptr)
 {
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if constexpr (std::is_same_v<T, QRgb>) {
+        if (qCpuHasFeature(ArchHaswell) && len >= 2)
+            return qColorTransformStoreOpaqueArgb32_avx2(dst, buffer, len, d_ptr);
+    }
+#endif
     const __m128 vTrcRes = _mm_set1_ps(float(QColorTrcLut::Resolution));
     constexpr bool isARGB = isArgb<T>();
     for (qsizetype i = 0; i < len; ++i) {
@@ -0,0 +1,231 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qcolortransform_p.h"
+
+#include "qcolormatrix_p.h"
+#include "qcolorspace_p.h"
+#include "qcolortrclut_p.h"
+
+#include <QtGui/qrgb.h>
+#include <QtCore/private/qsimd_p.h>
+
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+
+QT_BEGIN_NAMESPACE
+
+// AVX2+FMA versions of the block conversion sub-routines in
+// qcolortransform.cpp, processing two pixels per iteration. They are selected
+// at runtime from the SSE2 code paths there, and handle any length >= 2; an
+// odd tail is covered by reprocessing the last, partially overlapping pair,
+// which is safe as all the routines are idempotent.
+
+void qColorTransformApplyMatrix_avx2(QColorVector *buffer, qsizetype len, const QColorMatrix &colorMatrix, bool doClamp)
+{
+    const __m256 minV = _mm256_set1_ps(0.0f);
+    const __m256 maxV = _mm256_set1_ps(1.0f);
+    const __m256 xMat = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&colorMatrix.r.x));
+    const __m256 yMat = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&colorMatrix.g.x));
+    const __m256 zMat = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&colorMatrix.b.x));
+    qsizetype j = 0;
+    for (; j + 2 <= len; j += 2) {
+        __m256 c = _mm256_loadu_ps(&buffer[j].x);
+        const __m256 cy = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m256 cz = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2));
+        c = _mm256_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0));
+        c = _mm256_mul_ps(c, xMat);
+        c = _mm256_fmadd_ps(cy, yMat, c);
+        c = _mm256_fmadd_ps(cz, zMat, c);
+        if (doClamp) {
+            c = _mm256_min_ps(c, maxV);
+            c = _mm256_max_ps(c, minV);
+        }
+        _mm256_storeu_ps(&buffer[j].x, c);
+    }
+    if (j < len) {
+        // One color left over, use a 128-bit version (applyMatrix is not idempotent):
+        __m128 c = _mm_loadu_ps(&buffer[j].x);
+        const __m128 cy = _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 cz = _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2));
+        c = _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0));
+        c = _mm_mul_ps(c, _mm256_castps256_ps128(xMat));
+        c = _mm_fmadd_ps(cy, _mm256_castps256_ps128(yMat), c);
+        c = _mm_fmadd_ps(cz, _mm256_castps256_ps128(zMat), c);
+        if (doClamp) {
+            c = _mm_min_ps(c, _mm256_castps256_ps128(maxV));
+            c = _mm_max_ps(c, _mm256_castps256_ps128(minV));
+        }
+        _mm_storeu_ps(&buffer[j].x, c);
+    }
+}
+
+void qColorTransformLoadPremultipliedArgb32_avx2(QColorVector *buffer, const QRgb *src, qsizetype len, const QColorTransformPrivate *d_ptr)
+{
+    Q_ASSERT(len >= 2);
+    const __m256 vTrcRes = _mm256_set1_ps(float(QColorTrcLut::Resolution));
+    const __m256 iFF00 = _mm256_set1_ps(1.0f / (255 * 256));
+    const __m128i vRangeMax128 = _mm_setr_epi32(d_ptr->colorSpaceIn->lut[2]->m_unclampedToLinear,
+                                                d_ptr->colorSpaceIn->lut[1]->m_unclampedToLinear,
+                                                d_ptr->colorSpaceIn->lut[0]->m_unclampedToLinear,
+                                                QColorTrcLut::Resolution);
+    const __m256i vRangeMax = _mm256_set_m128i(vRangeMax128, vRangeMax128);
+    for (qsizetype i = 0; i + 2 <= len; i += 2) {
+        // 2x BGRA8 -> 8x epi32
+        __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+        __m256 vf = _mm256_cvtepi32_ps(v);
+        // Approximate 1/a:
+        __m256 va = _mm256_shuffle_ps(vf, vf, _MM_SHUFFLE(3, 3, 3, 3));
+        __m256 via = _mm256_rcp_ps(va);
+        via = _mm256_sub_ps(_mm256_add_ps(via, via), _mm256_mul_ps(via, _mm256_mul_ps(via, va)));
+        // v * (1/a)
+        vf = _mm256_mul_ps(vf, via);
+
+        // Handle zero alpha
+        const __m256 vAlphaMask = _mm256_cmp_ps(va, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        vf = _mm256_andnot_ps(vAlphaMask, vf);
+
+        // LUT
+        v = _mm256_cvtps_epi32(_mm256_mul_ps(vf, vTrcRes));
+        alignas(32) int idx[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(idx), v);
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(v, vRangeMax)) == 0) {
+            for (int p = 0; p < 2; ++p) {
+                const int rl = d_ptr->colorSpaceIn->lut[0]->m_toLinear[idx[p * 4 + 2]];
+                const int gl = d_ptr->colorSpaceIn->lut[1]->m_toLinear[idx[p * 4 + 1]];
+                const int bl = d_ptr->colorSpaceIn->lut[2]->m_toLinear[idx[p * 4 + 0]];
+                idx[p * 4 + 0] = rl;
+                idx[p * 4 + 1] = gl;
+                idx[p * 4 + 2] = bl;
+            }
+            vf = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_load_si256(reinterpret_cast<const __m256i *>(idx))), iFF00);
+            _mm256_storeu_ps(&buffer[i].x, vf);
+        } else {
+            constexpr float f = 1.f / QColorTrcLut::Resolution;
+            for (int p = 0; p < 2; ++p) {
+                buffer[i + p].x = d_ptr->colorSpaceIn->trc[0].applyExtended(idx[p * 4 + 2] * f);
+                buffer[i + p].y = d_ptr->colorSpaceIn->trc[1].applyExtended(idx[p * 4 + 1] * f);
+                buffer[i + p].z = d_ptr->colorSpaceIn->trc[2].applyExtended(idx[p * 4 + 0] * f);
+            }
+        }
+        if (i + 2 < len && i + 4 > len)
+            i = len - 4; // reprocess the last pair for an odd tail
+    }
+}
+
+void qColorTransformLoadUnpremultipliedArgb32_avx2(QColorVector *buffer, const QRgb *src, qsizetype len, const QColorTransformPrivate *d_ptr)
+{
+    Q_ASSERT(len >= 2);
+    const __m256 iFF00 = _mm256_set1_ps(1.0f / (255 * 256));
+    const __m128i vRangeMax128 = _mm_setr_epi32(d_ptr->colorSpaceIn->lut[2]->m_unclampedToLinear,
+                                                d_ptr->colorSpaceIn->lut[1]->m_unclampedToLinear,
+                                                d_ptr->colorSpaceIn->lut[0]->m_unclampedToLinear,
+                                                QColorTrcLut::Resolution);
+    const __m256i vRangeMax = _mm256_set_m128i(vRangeMax128, vRangeMax128);
+    for (qsizetype i = 0; i + 2 <= len; i += 2) {
+        // 2x BGRA8 -> 8x epi32, scaled to [0->TrcResolution]
+        __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+        v = _mm256_slli_epi32(v, QColorTrcLut::ShiftUp);
+        alignas(32) int idx[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(idx), v);
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(v, vRangeMax)) == 0) {
+            for (int p = 0; p < 2; ++p) {
+                const int rl = d_ptr->colorSpaceIn->lut[0]->m_toLinear[idx[p * 4 + 2]];
+                const int gl = d_ptr->colorSpaceIn->lut[1]->m_toLinear[idx[p * 4 + 1]];
+                const int bl = d_ptr->colorSpaceIn->lut[2]->m_toLinear[idx[p * 4 + 0]];
+                idx[p * 4 + 0] = rl;
+                idx[p * 4 + 1] = gl;
+                idx[p * 4 + 2] = bl;
+            }
+            const __m256 vf = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_load_si256(reinterpret_cast<const __m256i *>(idx))), iFF00);
+            _mm256_storeu_ps(&buffer[i].x, vf);
+        } else {
+            constexpr float f = 1.f / QColorTrcLut::Resolution;
+            for (int p = 0; p < 2; ++p) {
+                buffer[i + p].x = d_ptr->colorSpaceIn->trc[0].applyExtended(idx[p * 4 + 2] * f);
+                buffer[i + p].y = d_ptr->colorSpaceIn->trc[1].applyExtended(idx[p * 4 + 1] * f);
+                buffer[i + p].z = d_ptr->colorSpaceIn->trc[2].applyExtended(idx[p * 4 + 0] * f);
+            }
+        }
+        if (i + 2 < len && i + 4 > len)
+            i = len - 4; // reprocess the last pair for an odd tail
+    }
+}
+
+void qColorTransformStorePremultipliedArgb32_avx2(QRgb *dst, const QRgb *src, const QColorVector *buffer, qsizetype len,
+                                                  const QColorTransformPrivate *d_ptr)
+{
+    Q_ASSERT(len >= 2);
+    const __m256 vTrcRes = _mm256_set1_ps(float(QColorTrcLut::Resolution));
+    const __m256 iFF00 = _mm256_set1_ps(1.0f / (255 * 256));
+    for (qsizetype i = 0; i + 2 <= len; i += 2) {
+        const int a0 = qAlpha(src[i]);
+        const int a1 = qAlpha(src[i + 1]);
+        const __m256 vf = _mm256_loadu_ps(&buffer[i].x);
+        const __m256i v = _mm256_cvtps_epi32(_mm256_mul_ps(vf, vTrcRes));
+        const __m256 va = _mm256_mul_ps(_mm256_setr_ps(a0, a0, a0, a0, a1, a1, a1, a1), iFF00);
+        alignas(32) int idx[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(idx), v);
+        for (int p = 0; p < 2; ++p) {
+            const int bl = d_ptr->colorSpaceOut->lut[2]->m_fromLinear[idx[p * 4 + 2]];
+            const int gl = d_ptr->colorSpaceOut->lut[1]->m_fromLinear[idx[p * 4 + 1]];
+            const int rl = d_ptr->colorSpaceOut->lut[0]->m_fromLinear[idx[p * 4 + 0]];
+            idx[p * 4 + 0] = bl;
+            idx[p * 4 + 1] = gl;
+            idx[p * 4 + 2] = rl;
+        }
+        // Premultiply
+        const __m256i vr = _mm256_cvtps_epi32(
+                _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_load_si256(reinterpret_cast<const __m256i *>(idx))), va));
+        _mm256_store_si256(reinterpret_cast<__m256i *>(idx), vr);
+        dst[i] = uint(a0 << 24) | uint(idx[2] << 16) | uint(idx[1] << 8) | uint(idx[0]);
+        dst[i + 1] = uint(a1 << 24) | uint(idx[6] << 16) | uint(idx[5] << 8) | uint(idx[4]);
+        if (i + 2 < len && i + 4 > len)
+            i = len - 4; // reprocess the last pair for an odd tail
+    }
+}
+
+void qColorTransformStoreUnpremultipliedArgb32_avx2(QRgb *dst, const QRgb *src, const QColorVector *buffer, qsizetype len,
+                                                    const QColorTransformPrivate *d_ptr)
+{
+    Q_ASSERT(len >= 2);
+    const __m256 vTrcRes = _mm256_set1_ps(float(QColorTrcLut::Resolution));
+    for (qsizetype i = 0; i + 2 <= len; i += 2) {
+        const __m256 vf = _mm256_loadu_ps(&buffer[i].x);
+        const __m256i v = _mm256_cvtps_epi32(_mm256_mul_ps(vf, vTrcRes));
+        alignas(32) int idx[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(idx), v);
+        for (int p = 0; p < 2; ++p) {
+            const uint r = (d_ptr->colorSpaceOut->lut[0]->m_fromLinear[idx[p * 4 + 0]] + 0x80) >> 8;
+            const uint g = (d_ptr->colorSpaceOut->lut[1]->m_fromLinear[idx[p * 4 + 1]] + 0x80) >> 8;
+            const uint b = (d_ptr->colorSpaceOut->lut[2]->m_fromLinear[idx[p * 4 + 2]] + 0x80) >> 8;
+            dst[i + p] = uint(qAlpha(src[i + p]) << 24) | (r << 16) | (g << 8) | b;
+        }
+        if (i + 2 < len && i + 4 > len)
+            i = len - 4; // reprocess the last pair for an odd tail
+    }
+}
+
+void qColorTransformStoreOpaqueArgb32_avx2(QRgb *dst, const QColorVector *buffer, qsizetype len,
+                                           const QColorTransformPrivate *d_ptr)
+{
+    Q_ASSERT(len >= 2);
+    const __m256 vTrcRes = _mm256_set1_ps(float(QColorTrcLut::Resolution));
+    for (qsizetype i = 0; i + 2 <= len; i += 2) {
+        const __m256 vf = _mm256_loadu_ps(&buffer[i].x);
+        const __m256i v = _mm256_cvtps_epi32(_mm256_mul_ps(vf, vTrcRes));
+        alignas(32) int idx[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(idx), v);
+        for (int p = 0; p < 2; ++p) {
+            const uint r = (d_ptr->colorSpaceOut->lut[0]->m_fromLinear[idx[p * 4 + 0]] + 0x80) >> 8;
+            const uint g = (d_ptr->colorSpaceOut->lut[1]->m_fromLinear[idx[p * 4 + 1]] + 0x80) >> 8;
+            const uint b = (d_ptr->colorSpaceOut->lut[2]->m_fromLinear[idx[p * 4 + 2]] + 0x80) >> 8;
+            dst[i + p] = 0xff000000 | (r << 16) | (g << 8) | b;
+        }
+        if (i + 2 < len && i + 4 > len)
+            i = len - 4; // reprocess the last pair for an odd tail
+    }
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_COMPILER_SUPPORTS_AVX2
@@ -5912,12 +5912,45 @@ static void qt_alphargbblit_argb32(QRasterBuffer *rasterBuffer,
     }
 }
 
+// Fills the rect with the given (converted) color value. Large fills are
+// memory-bandwidth-bound on a single core, so they are split into horizontal
+// bands executed on the gui thread pool, mirroring QT_THREAD_PARALLEL_FILLS.
+template <class T>
+static void qt_rectfill_banded(QRasterBuffer *rasterBuffer, T value,
+                               int x, int y, int width, int height)
+{
+    T *dest = reinterpret_cast<T *>(rasterBuffer->buffer());
+    const qsizetype stride = rasterBuffer->bytesPerLine();
+#if defined(QT_USE_THREAD_PARALLEL_FILLS)
+    constexpr qint64 MinParallelArea = 128 * 1024; // pixels
+    QThreadPool *threadPool = QThreadPoolPrivate::qtGuiInstance();
+    if (qint64(width) * height >= MinParallelArea && height >= 4 && threadPool
+            && !threadPool->contains(QThread::currentThread())) {
+        const int segments = qMin(4, height / 2);
+        QSemaphore semaphore;
+        int yStart = y;
+        int remaining = height;
+        for (int i = 0; i < segments; ++i) {
+            const int bandHeight = remaining / (segments - i);
+            threadPool->start([=, &semaphore]() {
+                qt_rectfill<T>(dest, value, x, yStart, width, bandHeight, stride);
+                semaphore.release(1);
+            }, 1);
+            yStart += bandHeight;
+            remaining -= bandHeight;
+        }
+        semaphore.acquire(segments);
+        return;
+    }
+#endif
+    qt_rectfill<T>(dest, value, x, y, width, height, stride);
+}
+
 static void qt_rectfill_argb32(QRasterBuffer *rasterBuffer,
                                int x, int y, int width, int height,
                                const QRgba64 &color)
 {
-    qt_rectfill<quint32>(reinterpret_cast<quint32 *>(rasterBuffer->buffer()),
-                         color.toArgb32(), x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint32>(rasterBuffer, color.toArgb32(), x, y, width, height);
 }
 
 static void qt_rectfill_quint16(QRasterBuffer *rasterBuffer,
@@ -5928,8 +5961,7 @@ static void qt_rectfill_quint16(QRasterBuffer *rasterBuffer,
     quint32 c32 = color.toArgb32();
     quint16 c16;
     layout.storeFromARGB32PM(reinterpret_cast<uchar *>(&c16), &c32, 0, 1, nullptr, nullptr);
-    qt_rectfill<quint16>(reinterpret_cast<quint16 *>(rasterBuffer->buffer()),
-                         c16, x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint16>(rasterBuffer, c16, x, y, width, height);
 }
 
 static void qt_rectfill_quint24(QRasterBuffer *rasterBuffer,
@@ -5940,32 +5972,30 @@ static void qt_rectfill_quint24(QRasterBuffer *rasterBuffer,
     quint32 c32 = color.toArgb32();
     quint24 c24;
     layout.storeFromARGB32PM(reinterpret_cast<uchar *>(&c24), &c32, 0, 1, nullptr, nullptr);
-    qt_rectfill<quint24>(reinterpret_cast<quint24 *>(rasterBuffer->buffer()),
-                         c24, x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint24>(rasterBuffer, c24, x, y, width, height);
 }
 
 static void qt_rectfill_nonpremul_argb32(QRasterBuffer *rasterBuffer,
                                          int x, int y, int width, int height,
                                          const QRgba64 &color)
 {
-    qt_rectfill<quint32>(reinterpret_cast<quint32 *>(rasterBuffer->buffer()),
-                         color.unpremultiplied().toArgb32(), x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint32>(rasterBuffer, color.unpremultiplied().toArgb32(), x, y, width,
+                                height);
 }
 
 static void qt_rectfill_rgba(QRasterBuffer *rasterBuffer,
                              int x, int y, int width, int height,
                              const QRgba64 &color)
 {
-    qt_rectfill<quint32>(reinterpret_cast<quint32 *>(rasterBuffer->buffer()),
-                         ARGB2RGBA(color.toArgb32()), x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint32>(rasterBuffer, ARGB2RGBA(color.toArgb32()), x, y, width, height);
 }
 
 static void qt_rectfill_nonpremul_rgba(QRasterBuffer *rasterBuffer,
                                        int x, int y, int width, int height,
                                        const QRgba64 &color)
 {
-    qt_rectfill<quint32>(reinterpret_cast<quint32 *>(rasterBuffer->buffer()),
-                         ARGB2RGBA(color.unpremultiplied().toArgb32()), x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint32>(rasterBuffer, ARGB2RGBA(color.unpremultiplied().toArgb32()), x, y,
+                                width, height);
 }
 
 template<QtPixelOrder PixelOrder>
@@ -5973,24 +6003,22 @@ static void qt_rectfill_rgb30(QRasterBuffer *rasterBuffer,
                               int x, int y, int width, int height,
                               const QRgba64 &color)
 {
-    qt_rectfill<quint32>(reinterpret_cast<quint32 *>(rasterBuffer->buffer()),
-                         qConvertRgb64ToRgb30<PixelOrder>(color), x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint32>(rasterBuffer, qConvertRgb64ToRgb30<PixelOrder>(color), x, y,
+                                width, height);
 }
 
 static void qt_rectfill_alpha(QRasterBuffer *rasterBuffer,
                              int x, int y, int width, int height,
                              const QRgba64 &color)
 {
-    qt_rectfill<quint8>(reinterpret_cast<quint8 *>(rasterBuffer->buffer()),
-                         color.alpha() >> 8, x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint8>(rasterBuffer, color.alpha() >> 8, x, y, width, height);
 }
 
 static void qt_rectfill_gray(QRasterBuffer *rasterBuffer,
                              int x, int y, int width, int height,
                              const QRgba64 &color)
 {
-    qt_rectfill<quint8>(reinterpret_cast<quint8 *>(rasterBuffer->buffer()),
-                         qGray(color.toArgb32()), x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint8>(rasterBuffer, qGray(color.toArgb32()), x, y, width, height);
 }
 
 static void qt_rectfill_quint64(QRasterBuffer *rasterBuffer,
@@ -6000,8 +6028,7 @@ static void qt_rectfill_quint64(QRasterBuffer *rasterBuffer,
     const auto store = qStoreFromRGBA64PM[rasterBuffer->format];
     quint64 c64;
     store(reinterpret_cast<uchar *>(&c64), &color, 0, 1, nullptr, nullptr);
-    qt_rectfill<quint64>(reinterpret_cast<quint64 *>(rasterBuffer->buffer()),
-                         c64, x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<quint64>(rasterBuffer, c64, x, y, width, height);
 }
 
 static void qt_rectfill_fp32x4(QRasterBuffer *rasterBuffer,
@@ -6011,8 +6038,7 @@ static void qt_rectfill_fp32x4(QRasterBuffer *rasterBuffer,
     const auto store = qStoreFromRGBA64PM[rasterBuffer->format];
     QRgbaFloat32 c;
     store(reinterpret_cast<uchar *>(&c), &color, 0, 1, nullptr, nullptr);
-    qt_rectfill<QRgbaFloat32>(reinterpret_cast<QRgbaFloat32 *>(rasterBuffer->buffer()),
-                          c, x, y, width, height, rasterBuffer->bytesPerLine());
+    qt_rectfill_banded<QRgbaFloat32>(rasterBuffer, c, x, y, width, height);
 }
 
 // Map table for destination image format. Contains function pointers
@@ -6598,6 +6624,29 @@ static void qInitDrawhelperFunctions()
         qPixelLayouts[QImage::Format_RGBA8888].fetchToARGB32PM = fetchRGBA8888ToARGB32PM_avx2;
         qPixelLayouts[QImage::Format_RGBA8888].convertToARGB32PM = convertRGBA8888ToARGB32PM_avx2;
 
+        extern void QT_FASTCALL storeARGB32FromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                                             const QList<QRgb> *, QDitherInfo *);
+        extern void QT_FASTCALL storeRGBA8888FromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                                               const QList<QRgb> *, QDitherInfo *);
+        extern void QT_FASTCALL storeRGBXFromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                                           const QList<QRgb> *, QDitherInfo *);
+        qPixelLayouts[QImage::Format_ARGB32].storeFromARGB32PM = storeARGB32FromARGB32PM_avx2;
+        qPixelLayouts[QImage::Format_RGBA8888].storeFromARGB32PM = storeRGBA8888FromARGB32PM_avx2;
+        qPixelLayouts[QImage::Format_RGBX8888].storeFromARGB32PM = storeRGBXFromARGB32PM_avx2;
+
+        extern const uint *QT_FASTCALL fetchGrayscale8ToRGB32_avx2(uint *buffer, const uchar *src, int index, int count,
+                                                                   const QList<QRgb> *, QDitherInfo *);
+        extern const uint *QT_FASTCALL fetchGrayscale16ToRGB32_avx2(uint *buffer, const uchar *src, int index, int count,
+                                                                    const QList<QRgb> *, QDitherInfo *);
+        extern void QT_FASTCALL storeGrayscale8FromRGB32_avx2(uchar *dest, const uint *src, int index, int count,
+                                                              const QList<QRgb> *, QDitherInfo *);
+        extern void QT_FASTCALL storeGrayscale16FromRGB32_avx2(uchar *dest, const uint *src, int index, int count,
+                                                               const QList<QRgb> *, QDitherInfo *);
+        qPixelLayouts[QImage::Format_Grayscale8].fetchToARGB32PM = fetchGrayscale8ToRGB32_avx2;
+        qPixelLayouts[QImage::Format_Grayscale8].storeFromRGB32 = storeGrayscale8FromRGB32_avx2;
+        qPixelLayouts[QImage::Format_Grayscale16].fetchToARGB32PM = fetchGrayscale16ToRGB32_avx2;
+        qPixelLayouts[QImage::Format_Grayscale16].storeFromRGB32 = storeGrayscale16FromRGB32_avx2;
+
         extern const QRgba64 *QT_FASTCALL convertARGB32ToRGBA64PM_avx2(QRgba64 *, const uint *, int, const QList<QRgb> *, QDitherInfo *);
         extern const QRgba64 *QT_FASTCALL convertRGBA8888ToRGBA64PM_avx2(QRgba64 *, const uint *, int count, const QList<QRgb> *, QDitherInfo *);
         extern const QRgba64 *QT_FASTCALL fetchARGB32ToRGBA64PM_avx2(QRgba64 *, const uchar *, int, int, const QList<QRgb> *, QDitherInfo *);
@@ -6637,6 +6686,18 @@ static void qInitDrawhelperFunctions()
 #endif // QT_CONFIG(raster_fp)
     }
 
+#if defined(QT_COMPILER_SUPPORTS_AVX512F) && defined(QT_COMPILER_SUPPORTS_AVX512BW) \
+        && defined(QT_COMPILER_SUPPORTS_AVX512VL)
+    if (qCpuHasFeature(ArchSkylakeAvx512)) {
+        extern void QT_FASTCALL comp_func_Source_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha);
+        extern void QT_FASTCALL comp_func_SourceOver_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha);
+        extern void QT_FASTCALL comp_func_solid_SourceOver_avx512(uint *destPixels, int length, uint color, uint const_alpha);
+        qt_functionForMode_C[QPainter::CompositionMode_Source] = comp_func_Source_avx512;
+        qt_functionForMode_C[QPainter::CompositionMode_SourceOver] = comp_func_SourceOver_avx512;
+        qt_functionForModeSolid_C[QPainter::CompositionMode_SourceOver] = comp_func_solid_SourceOver_avx512;
+    }
+#endif
+
 #endif
 
 #endif // SSE2
@@ -1611,6 +1611,202 @@ void QT_FASTCALL storeRGBA16FFromRGBA32F_avx2(uchar *dest, const QRgbaFloat32 *s
 }
 #endif
 
+static inline __m256 Q_DECL_VECTORCALL reciprocal_mul_ps_avx2(__m256 a, float mul)
+{
+    __m256 ia = _mm256_rcp_ps(a); // Approximate 1/a
+    // Improve precision of ia using Newton-Raphson
+    ia = _mm256_sub_ps(_mm256_add_ps(ia, ia), _mm256_mul_ps(ia, _mm256_mul_ps(ia, a)));
+    ia = _mm256_mul_ps(ia, _mm256_set1_ps(mul));
+    return ia;
+}
+
+template<bool RGBA, bool RGBx>
+static inline void convertARGBFromARGB32PM_avx2(uint *buffer, const uint *src, int count)
+{
+    int i = 0;
+    if ((_MM_GET_EXCEPTION_MASK() & _MM_MASK_INVALID) == 0) {
+        for (; i < count; ++i) {
+            uint v = qUnpremultiply(src[i]);
+            if (RGBx)
+                v = 0xff000000 | v;
+            if (RGBA)
+                v = ARGB2RGBA(v);
+            buffer[i] = v;
+        }
+        return;
+    }
+    const __m256i alphaMask = _mm256_set1_epi32(0xff000000);
+    const __m256i rgbaMask = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (; i < count - 7; i += 8) {
+        __m256i srcVector = _mm256_loadu_si256((const __m256i *)&src[i]);
+        if (!_mm256_testz_si256(srcVector, alphaMask)) {
+            if (!_mm256_testc_si256(srcVector, alphaMask)) {
+                __m256i srcVectorAlpha = _mm256_srli_epi32(srcVector, 24);
+                if (RGBA)
+                    srcVector = _mm256_shuffle_epi8(srcVector, rgbaMask);
+                const __m256 a = _mm256_cvtepi32_ps(srcVectorAlpha);
+                const __m256 ia = reciprocal_mul_ps_avx2(a, 255.0f);
+                // The unpacks and packs below all operate per 128-bit lane,
+                // mirroring the SSE4 version on two independent sets of four pixels.
+                __m256i src1 = _mm256_unpacklo_epi8(srcVector, zero);
+                __m256i src3 = _mm256_unpackhi_epi8(srcVector, zero);
+                __m256i src2 = _mm256_unpackhi_epi16(src1, zero);
+                __m256i src4 = _mm256_unpackhi_epi16(src3, zero);
+                src1 = _mm256_unpacklo_epi16(src1, zero);
+                src3 = _mm256_unpacklo_epi16(src3, zero);
+                const __m256 ia1 = _mm256_shuffle_ps(ia, ia, _MM_SHUFFLE(0, 0, 0, 0));
+                const __m256 ia2 = _mm256_shuffle_ps(ia, ia, _MM_SHUFFLE(1, 1, 1, 1));
+                const __m256 ia3 = _mm256_shuffle_ps(ia, ia, _MM_SHUFFLE(2, 2, 2, 2));
+                const __m256 ia4 = _mm256_shuffle_ps(ia, ia, _MM_SHUFFLE(3, 3, 3, 3));
+                src1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(src1), ia1));
+                src2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(src2), ia2));
+                src3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(src3), ia3));
+                src4 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(src4), ia4));
+                src1 = _mm256_packus_epi32(src1, src2);
+                src3 = _mm256_packus_epi32(src3, src4);
+                src1 = _mm256_packus_epi16(src1, src3);
+                // Handle potential alpha == 0 values:
+                __m256i srcVectorAlphaMask = _mm256_cmpeq_epi32(srcVectorAlpha, zero);
+                src1 = _mm256_andnot_si256(srcVectorAlphaMask, src1);
+                // Fixup alpha values:
+                if (RGBx)
+                    srcVector = _mm256_or_si256(src1, alphaMask);
+                else
+                    srcVector = _mm256_blendv_epi8(src1, srcVector, alphaMask);
+                _mm256_storeu_si256((__m256i *)&buffer[i], srcVector);
+            } else {
+                if (RGBA)
+                    _mm256_storeu_si256((__m256i *)&buffer[i], _mm256_shuffle_epi8(srcVector, rgbaMask));
+                else if (buffer != src)
+                    _mm256_storeu_si256((__m256i *)&buffer[i], srcVector);
+            }
+        } else {
+            if (RGBx)
+                _mm256_storeu_si256((__m256i *)&buffer[i], alphaMask);
+            else
+                _mm256_storeu_si256((__m256i *)&buffer[i], zero);
+        }
+    }
+
+    SIMD_EPILOGUE(i, count, 7) {
+        uint v = qUnpremultiply_sse4(src[i]);
+        if (RGBx)
+            v = 0xff000000 | v;
+        if (RGBA)
+            v = ARGB2RGBA(v);
+        buffer[i] = v;
+    }
+}
+
+void QT_FASTCALL storeRGB32FromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                             const QList<QRgb> *, QDitherInfo *)
+{
+    uint *d = reinterpret_cast<uint *>(dest) + index;
+    convertARGBFromARGB32PM_avx2<false, true>(d, src, count);
+}
+
+void QT_FASTCALL storeARGB32FromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                              const QList<QRgb> *, QDitherInfo *)
+{
+    uint *d = reinterpret_cast<uint *>(dest) + index;
+    convertARGBFromARGB32PM_avx2<false, false>(d, src, count);
+}
+
+void QT_FASTCALL storeRGBA8888FromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                                const QList<QRgb> *, QDitherInfo *)
+{
+    uint *d = reinterpret_cast<uint *>(dest) + index;
+    convertARGBFromARGB32PM_avx2<true, false>(d, src, count);
+}
+
+void QT_FASTCALL storeRGBXFromARGB32PM_avx2(uchar *dest, const uint *src, int index, int count,
+                                            const QList<QRgb> *, QDitherInfo *)
+{
+    uint *d = reinterpret_cast<uint *>(dest) + index;
+    convertARGBFromARGB32PM_avx2<true, true>(d, src, count);
+}
+
+const uint *QT_FASTCALL fetchGrayscale8ToRGB32_avx2(uint *buffer, const uchar *src, int index, int count,
+                                                    const QList<QRgb> *, QDitherInfo *)
+{
+    const uchar *s = src + index;
+    int i = 0;
+    const __m256i vAlpha = _mm256_set1_epi32(int(0xff000000));
+    const __m256i vReplicate = _mm256_set1_epi32(0x010101);
+    for (; i < count - 7; i += 8) {
+        const __m256i vs = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(s + i)));
+        _mm256_storeu_si256((__m256i *)(buffer + i), _mm256_or_si256(_mm256_mullo_epi32(vs, vReplicate), vAlpha));
+    }
+    SIMD_EPILOGUE(i, count, 7)
+        buffer[i] = qRgb(s[i], s[i], s[i]);
+    return buffer;
+}
+
+const uint *QT_FASTCALL fetchGrayscale16ToRGB32_avx2(uint *buffer, const uchar *src, int index, int count,
+                                                     const QList<QRgb> *, QDitherInfo *)
+{
+    const unsigned short *s = reinterpret_cast<const unsigned short *>(src) + index;
+    int i = 0;
+    const __m256i vAlpha = _mm256_set1_epi32(int(0xff000000));
+    const __m256i vReplicate = _mm256_set1_epi32(0x010101);
+    const __m256i vHalf = _mm256_set1_epi32(128);
+    for (; i < count - 7; i += 8) {
+        __m256i vs = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(s + i)));
+        // qt_div_257(x) == ((x + 128) - ((x + 128) >> 8)) >> 8
+        vs = _mm256_add_epi32(vs, vHalf);
+        vs = _mm256_srli_epi32(_mm256_sub_epi32(vs, _mm256_srli_epi32(vs, 8)), 8);
+        _mm256_storeu_si256((__m256i *)(buffer + i), _mm256_or_si256(_mm256_mullo_epi32(vs, vReplicate), vAlpha));
+    }
+    SIMD_EPILOGUE(i, count, 7) {
+        const uint x = qt_div_257(s[i]);
+        buffer[i] = qRgb(x, x, x);
+    }
+    return buffer;
+}
+
+// Computes qGray() on eight (B, G, R, A) pixels: per 16-bit pair (5 * b + 16 * g)
+// and (11 * r + 0 * a), summed and divided by 32.
+static inline __m256i Q_DECL_VECTORCALL qGray_epi32_avx2(__m256i v)
+{
+    v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x000b1005));
+    v = _mm256_madd_epi16(v, _mm256_set1_epi16(1));
+    return _mm256_srli_epi32(v, 5);
+}
+
+void QT_FASTCALL storeGrayscale8FromRGB32_avx2(uchar *dest, const uint *src, int index, int count,
+                                               const QList<QRgb> *, QDitherInfo *)
+{
+    uchar *d = dest + index;
+    int i = 0;
+    for (; i < count - 7; i += 8) {
+        __m256i v = qGray_epi32_avx2(_mm256_loadu_si256((const __m256i *)(src + i)));
+        v = _mm256_packus_epi32(v, v);
+        v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m128i v128 = _mm256_castsi256_si128(v);
+        _mm_storel_epi64((__m128i *)(d + i), _mm_packus_epi16(v128, v128));
+    }
+    SIMD_EPILOGUE(i, count, 7)
+        d[i] = qGray(src[i]);
+}
+
+void QT_FASTCALL storeGrayscale16FromRGB32_avx2(uchar *dest, const uint *src, int index, int count,
+                                                const QList<QRgb> *, QDitherInfo *)
+{
+    unsigned short *d = reinterpret_cast<unsigned short *>(dest) + index;
+    int i = 0;
+    for (; i < count - 7; i += 8) {
+        __m256i v = qGray_epi32_avx2(_mm256_loadu_si256((const __m256i *)(src + i)));
+        v = _mm256_mullo_epi32(v, _mm256_set1_epi32(257));
+        v = _mm256_packus_epi32(v, v);
+        v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i *)(d + i), _mm256_castsi256_si128(v));
+    }
+    SIMD_EPILOGUE(i, count, 7)
+        d[i] = qGray(src[i]) * 257;
+}
+
 QT_END_NAMESPACE
 
 #endif
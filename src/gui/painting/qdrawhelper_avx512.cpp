@@ -0,0 +1,219 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qdrawhelper_p.h"
+#include "qdrawhelper_x86_p.h"
+
+#if defined(QT_COMPILER_SUPPORTS_AVX512F) && defined(QT_COMPILER_SUPPORTS_AVX512BW) \
+        && defined(QT_COMPILER_SUPPORTS_AVX512VL)
+
+QT_BEGIN_NAMESPACE
+
+QT_WARNING_PUSH
+// GCC 12 implements some unmasked AVX-512 intrinsics through their masked
+// builtins with an _mm512_undefined_epi32() pass-through operand, which trips
+// -Wuninitialized on the undefined value (GCC PR105593).
+QT_WARNING_DISABLE_GCC("-Wuninitialized")
+QT_WARNING_DISABLE_GCC("-Wmaybe-uninitialized")
+
+// 512-bit variants of the hot ARGB32PM composition kernels. They follow the
+// structure of their AVX2 counterparts in qdrawhelper_avx2.cpp, but use
+// masked loads and stores instead of scalar prologues and epilogues, so even
+// short spans are handled in a single masked iteration.
+
+// See BYTE_MUL_SSE2 for details.
+static inline __m512i Q_DECL_VECTORCALL
+byte_mul_avx512(__m512i pixelVector, __m512i alphaChannel, __m512i colorMask, __m512i half)
+{
+    __m512i pixelVectorAG = _mm512_srli_epi16(pixelVector, 8);
+    __m512i pixelVectorRB = _mm512_and_si512(pixelVector, colorMask);
+
+    pixelVectorAG = _mm512_mullo_epi16(pixelVectorAG, alphaChannel);
+    pixelVectorRB = _mm512_mullo_epi16(pixelVectorRB, alphaChannel);
+
+    pixelVectorRB = _mm512_add_epi16(pixelVectorRB, _mm512_srli_epi16(pixelVectorRB, 8));
+    pixelVectorAG = _mm512_add_epi16(pixelVectorAG, _mm512_srli_epi16(pixelVectorAG, 8));
+    pixelVectorRB = _mm512_add_epi16(pixelVectorRB, half);
+    pixelVectorAG = _mm512_add_epi16(pixelVectorAG, half);
+
+    pixelVectorRB = _mm512_srli_epi16(pixelVectorRB, 8);
+    pixelVectorAG = _mm512_andnot_si512(colorMask, pixelVectorAG);
+
+    return _mm512_or_si512(pixelVectorAG, pixelVectorRB);
+}
+
+// See INTERPOLATE_PIXEL_255_SSE2 for details.
+static inline __m512i Q_DECL_VECTORCALL
+interpolate_pixel_255_avx512(__m512i srcVector, __m512i dstVector, __m512i alphaChannel,
+                             __m512i oneMinusAlphaChannel, __m512i colorMask, __m512i half)
+{
+    const __m512i srcVectorAG = _mm512_srli_epi16(srcVector, 8);
+    const __m512i dstVectorAG = _mm512_srli_epi16(dstVector, 8);
+    const __m512i srcVectorRB = _mm512_and_si512(srcVector, colorMask);
+    const __m512i dstVectorRB = _mm512_and_si512(dstVector, colorMask);
+    const __m512i srcVectorAGalpha = _mm512_mullo_epi16(srcVectorAG, alphaChannel);
+    const __m512i srcVectorRBalpha = _mm512_mullo_epi16(srcVectorRB, alphaChannel);
+    const __m512i dstVectorAGoneMinusAlpha = _mm512_mullo_epi16(dstVectorAG, oneMinusAlphaChannel);
+    const __m512i dstVectorRBoneMinusAlpha = _mm512_mullo_epi16(dstVectorRB, oneMinusAlphaChannel);
+    __m512i finalAG = _mm512_add_epi16(srcVectorAGalpha, dstVectorAGoneMinusAlpha);
+    __m512i finalRB = _mm512_add_epi16(srcVectorRBalpha, dstVectorRBoneMinusAlpha);
+    finalAG = _mm512_add_epi16(finalAG, _mm512_srli_epi16(finalAG, 8));
+    finalRB = _mm512_add_epi16(finalRB, _mm512_srli_epi16(finalRB, 8));
+    finalAG = _mm512_add_epi16(finalAG, half);
+    finalRB = _mm512_add_epi16(finalRB, half);
+    finalAG = _mm512_andnot_si512(colorMask, finalAG);
+    finalRB = _mm512_srli_epi16(finalRB, 8);
+
+    return _mm512_or_si512(finalAG, finalRB);
+}
+
+// Spreads the alpha byte of each pixel over its whole 16-bit AG/RB channels;
+// the pattern repeats per 128-bit lane, as _mm512_shuffle_epi8 shuffles
+// within lanes.
+static inline __m512i alphaShuffleMaskAvx512()
+{
+    return _mm512_set4_epi32(0xff0fff0f, 0xff0bff0b, 0xff07ff07, 0xff03ff03);
+}
+
+void QT_FASTCALL comp_func_SourceOver_avx512(uint *destPixels, const uint *srcPixels, int length,
+                                             uint const_alpha)
+{
+    Q_ASSERT(const_alpha < 256);
+
+    const quint32 *src = (const quint32 *) srcPixels;
+    quint32 *dst = (quint32 *) destPixels;
+
+    const __m512i half = _mm512_set1_epi16(0x80);
+    const __m512i one = _mm512_set1_epi16(0xff);
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i alphaMask = _mm512_set1_epi32(0xff000000);
+    const __m512i alphaShuffleMask = alphaShuffleMaskAvx512();
+
+    int x = 0;
+    if (const_alpha == 255) {
+        for (; x <= length - 16; x += 16) {
+            const __m512i srcVector = _mm512_loadu_si512(&src[x]);
+            if (!_mm512_test_epi32_mask(srcVector, alphaMask))
+                continue; // all transparent
+            // a premultiplied pixel is opaque iff its value is >= 0xff000000
+            if (_mm512_cmpge_epu32_mask(srcVector, alphaMask) == 0xffff) {
+                _mm512_storeu_si512(&dst[x], srcVector);
+            } else {
+                __m512i alphaChannel = _mm512_shuffle_epi8(srcVector, alphaShuffleMask);
+                alphaChannel = _mm512_sub_epi16(one, alphaChannel);
+                __m512i dstVector = _mm512_loadu_si512(&dst[x]);
+                dstVector = byte_mul_avx512(dstVector, alphaChannel, colorMask, half);
+                dstVector = _mm512_add_epi8(dstVector, srcVector);
+                _mm512_storeu_si512(&dst[x], dstVector);
+            }
+        }
+        if (x < length) {
+            const __mmask16 tailMask = __mmask16((1u << (length - x)) - 1);
+            const __m512i srcVector = _mm512_maskz_loadu_epi32(tailMask, &src[x]);
+            if (_mm512_test_epi32_mask(srcVector, alphaMask)) {
+                __m512i alphaChannel = _mm512_shuffle_epi8(srcVector, alphaShuffleMask);
+                alphaChannel = _mm512_sub_epi16(one, alphaChannel);
+                __m512i dstVector = _mm512_maskz_loadu_epi32(tailMask, &dst[x]);
+                dstVector = byte_mul_avx512(dstVector, alphaChannel, colorMask, half);
+                dstVector = _mm512_add_epi8(dstVector, srcVector);
+                _mm512_mask_storeu_epi32(&dst[x], tailMask, dstVector);
+            }
+        }
+    } else {
+        const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+        for (; x <= length - 16; x += 16) {
+            __m512i srcVector = _mm512_loadu_si512(&src[x]);
+            if (!_mm512_test_epi32_mask(srcVector, alphaMask))
+                continue;
+            srcVector = byte_mul_avx512(srcVector, constAlphaVector, colorMask, half);
+            __m512i alphaChannel = _mm512_shuffle_epi8(srcVector, alphaShuffleMask);
+            alphaChannel = _mm512_sub_epi16(one, alphaChannel);
+            __m512i dstVector = _mm512_loadu_si512(&dst[x]);
+            dstVector = byte_mul_avx512(dstVector, alphaChannel, colorMask, half);
+            dstVector = _mm512_add_epi8(dstVector, srcVector);
+            _mm512_storeu_si512(&dst[x], dstVector);
+        }
+        if (x < length) {
+            const __mmask16 tailMask = __mmask16((1u << (length - x)) - 1);
+            __m512i srcVector = _mm512_maskz_loadu_epi32(tailMask, &src[x]);
+            if (_mm512_test_epi32_mask(srcVector, alphaMask)) {
+                srcVector = byte_mul_avx512(srcVector, constAlphaVector, colorMask, half);
+                __m512i alphaChannel = _mm512_shuffle_epi8(srcVector, alphaShuffleMask);
+                alphaChannel = _mm512_sub_epi16(one, alphaChannel);
+                __m512i dstVector = _mm512_maskz_loadu_epi32(tailMask, &dst[x]);
+                dstVector = byte_mul_avx512(dstVector, alphaChannel, colorMask, half);
+                dstVector = _mm512_add_epi8(dstVector, srcVector);
+                _mm512_mask_storeu_epi32(&dst[x], tailMask, dstVector);
+            }
+        }
+    }
+}
+
+void QT_FASTCALL comp_func_Source_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    if (const_alpha == 255) {
+        ::memcpy(dst, src, length * sizeof(uint));
+    } else {
+        const int ialpha = 255 - const_alpha;
+        const __m512i half = _mm512_set1_epi16(0x80);
+        const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+        const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+        const __m512i oneMinusConstAlpha = _mm512_set1_epi16(ialpha);
+
+        int x = 0;
+        for (; x <= length - 16; x += 16) {
+            const __m512i srcVector = _mm512_loadu_si512(&src[x]);
+            __m512i dstVector = _mm512_loadu_si512(&dst[x]);
+            dstVector = interpolate_pixel_255_avx512(srcVector, dstVector, constAlphaVector,
+                                                     oneMinusConstAlpha, colorMask, half);
+            _mm512_storeu_si512(&dst[x], dstVector);
+        }
+        if (x < length) {
+            const __mmask16 tailMask = __mmask16((1u << (length - x)) - 1);
+            const __m512i srcVector = _mm512_maskz_loadu_epi32(tailMask, &src[x]);
+            __m512i dstVector = _mm512_maskz_loadu_epi32(tailMask, &dst[x]);
+            dstVector = interpolate_pixel_255_avx512(srcVector, dstVector, constAlphaVector,
+                                                     oneMinusConstAlpha, colorMask, half);
+            _mm512_mask_storeu_epi32(&dst[x], tailMask, dstVector);
+        }
+    }
+}
+
+void QT_FASTCALL comp_func_solid_SourceOver_avx512(uint *destPixels, int length, uint color,
+                                                   uint const_alpha)
+{
+    if ((const_alpha & qAlpha(color)) == 255) {
+        qt_memfill32(destPixels, color, length);
+    } else {
+        if (const_alpha != 255)
+            color = BYTE_MUL(color, const_alpha);
+
+        const quint32 minusAlphaOfColor = qAlpha(~color);
+        quint32 *dst = (quint32 *) destPixels;
+        const __m512i colorVector = _mm512_set1_epi32(color);
+        const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+        const __m512i half = _mm512_set1_epi16(0x80);
+        const __m512i minusAlphaOfColorVector = _mm512_set1_epi16(minusAlphaOfColor);
+
+        int x = 0;
+        for (; x <= length - 16; x += 16) {
+            __m512i dstVector = _mm512_loadu_si512(&dst[x]);
+            dstVector = byte_mul_avx512(dstVector, minusAlphaOfColorVector, colorMask, half);
+            dstVector = _mm512_add_epi8(colorVector, dstVector);
+            _mm512_storeu_si512(&dst[x], dstVector);
+        }
+        if (x < length) {
+            const __mmask16 tailMask = __mmask16((1u << (length - x)) - 1);
+            __m512i dstVector = _mm512_maskz_loadu_epi32(tailMask, &dst[x]);
+            dstVector = byte_mul_avx512(dstVector, minusAlphaOfColorVector, colorMask, half);
+            dstVector = _mm512_add_epi8(colorVector, dstVector);
+            _mm512_mask_storeu_epi32(&dst[x], tailMask, dstVector);
+        }
+    }
+}
+
+QT_WARNING_POP
+
+QT_END_NAMESPACE
+
+#endif
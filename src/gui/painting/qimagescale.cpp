@@ -275,6 +275,8 @@ static inline void multithread_pixels_function(QImageScaleInfo *isi, int dh, con
     int segments = (qsizetype(isi->sh) * isi->sw) / (1<<16);
     segments = std::min(segments, dh);
     QThreadPool *threadPool = QThreadPoolPrivate::qtGuiInstance();
+    if (threadPool) // more segments than workers just adds queuing overhead
+        segments = std::min(segments, threadPool->maxThreadCount());
     if (segments > 1 && threadPool && !threadPool->contains(QThread::currentThread())) {
         QSemaphore semaphore;
         int y = 0;
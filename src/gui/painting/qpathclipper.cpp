@@ -1441,12 +1441,14 @@ static void clear(QWingedEdge& list, int edge, QPathEdge::Traversal traversal)
     } while (status.edge != edge);
 }
 
-template <typename InputIterator>
-InputIterator qFuzzyFind(InputIterator first, InputIterator last, qreal val)
+// the range must be sorted; returns the first element fuzzy-equal to val
+template <typename RandomAccessIterator>
+RandomAccessIterator qFuzzyFind(RandomAccessIterator first, RandomAccessIterator last, qreal val)
 {
-    while (first != last && !QT_PREPEND_NAMESPACE(qFuzzyCompare)(qreal(*first), qreal(val)))
-        ++first;
-    return first;
+    RandomAccessIterator it = std::lower_bound(first, last, val);
+    if (it != first && QT_PREPEND_NAMESPACE(qFuzzyCompare)(qreal(*(it - 1)), qreal(val)))
+        --it;
+    return it;
 }
 
 static bool fuzzyCompare(qreal a, qreal b)
@@ -1599,68 +1601,67 @@ bool QPathClipper::doClip(QWingedEdge &list, ClipperMode mode)
     }
 #endif
 
-    bool found;
-    do {
-        found = false;
-        int index = 0;
-        qreal maxHeight = 0;
-        for (int i = 0; i < list.edgeCount(); ++i) {
-            QPathEdge *edge = list.edge(i);
-
-            // have both sides of this edge already been handled?
-            if ((edge->flag & 0x3) == 0x3)
-                continue;
+    // Process the edges from tallest to shortest. The edge geometry never
+    // changes during clipping (handleCrossingEdges only sets traversal
+    // flags), so the max-height selection can be done with one upfront sort
+    // instead of rescanning every edge per iteration.
+    const auto edgeHeight = [&list](int i) {
+        const QPathEdge *edge = list.edge(i);
+        return qAbs(list.vertex(edge->first)->y - list.vertex(edge->second)->y);
+    };
 
-            QPathVertex *a = list.vertex(edge->first);
-            QPathVertex *b = list.vertex(edge->second);
+    QList<int> edgeOrder;
+    edgeOrder.reserve(list.edgeCount());
+    for (int i = 0; i < list.edgeCount(); ++i) {
+        const QPathEdge *edge = list.edge(i);
 
-            if (qFuzzyCompare(a->y, b->y))
-                continue;
+        // horizontal edges have no crossing line of their own
+        if (qFuzzyCompare(list.vertex(edge->first)->y, list.vertex(edge->second)->y))
+            continue;
 
-            found = true;
+        edgeOrder << i;
+    }
+    std::stable_sort(edgeOrder.begin(), edgeOrder.end(), [&edgeHeight](int lhs, int rhs) {
+        return edgeHeight(lhs) > edgeHeight(rhs);
+    });
 
-            qreal height = qAbs(a->y - b->y);
-            if (height > maxHeight) {
-                index = i;
-                maxHeight = height;
-            }
-        }
+    for (int index : std::as_const(edgeOrder)) {
+        QPathEdge *edge = list.edge(index);
 
-        if (found) {
-            QPathEdge *edge = list.edge(index);
+        // have both sides of this edge already been handled?
+        if ((edge->flag & 0x3) == 0x3)
+            continue;
 
-            QPathVertex *a = list.vertex(edge->first);
-            QPathVertex *b = list.vertex(edge->second);
+        QPathVertex *a = list.vertex(edge->first);
+        QPathVertex *b = list.vertex(edge->second);
 
-            // FIXME: this can be optimized by using binary search
-            const int first = qFuzzyFind(y_coords.cbegin(), y_coords.cend(), qMin(a->y, b->y)) - y_coords.cbegin();
-            const int last = qFuzzyFind(y_coords.cbegin() + first, y_coords.cend(), qMax(a->y, b->y)) - y_coords.cbegin();
+        const int first = qFuzzyFind(y_coords.cbegin(), y_coords.cend(), qMin(a->y, b->y)) - y_coords.cbegin();
+        const int last = qFuzzyFind(y_coords.cbegin() + first, y_coords.cend(), qMax(a->y, b->y)) - y_coords.cbegin();
 
-            Q_ASSERT(first < y_coords.size() - 1);
-            Q_ASSERT(last < y_coords.size());
+        Q_ASSERT(first < y_coords.size() - 1);
+        Q_ASSERT(last < y_coords.size());
 
-            qreal biggestGap = y_coords.at(first + 1) - y_coords.at(first);
-            int bestIdx = first;
-            for (int i = first + 1; i < last; ++i) {
-                qreal gap = y_coords.at(i + 1) - y_coords.at(i);
+        qreal biggestGap = y_coords.at(first + 1) - y_coords.at(first);
+        int bestIdx = first;
+        for (int i = first + 1; i < last; ++i) {
+            qreal gap = y_coords.at(i + 1) - y_coords.at(i);
 
-                if (gap > biggestGap) {
-                    bestIdx = i;
-                    biggestGap = gap;
-                }
+            if (gap > biggestGap) {
+                bestIdx = i;
+                biggestGap = gap;
             }
-            const qreal bestY = 0.5 * (y_coords.at(bestIdx) + y_coords.at(bestIdx + 1));
+        }
+        const qreal bestY = 0.5 * (y_coords.at(bestIdx) + y_coords.at(bestIdx + 1));
 
 #ifdef QDEBUG_CLIPPER
-            printf("y: %.9f, gap: %.9f\n", bestY, biggestGap);
+        printf("y: %.9f, gap: %.9f\n", bestY, biggestGap);
 #endif
 
-            if (handleCrossingEdges(list, bestY, mode) && mode == CheckMode)
-                return true;
+        if (handleCrossingEdges(list, bestY, mode) && mode == CheckMode)
+            return true;
 
-            edge->flag |= 0x3;
-        }
-    } while (found);
+        edge->flag |= 0x3;
+    }
 
     if (mode == ClipMode)
         list.simplify();
@@ -19,7 +19,9 @@
 #include <qfile.h>
 #include <qimagewriter.h>
 #include <qnumeric.h>
+#include <qpromise.h>
 #include <qtemporaryfile.h>
+#include <qthreadpool.h>
 #include <qtimezone.h>
 #include <quuid.h>
 #include <qxmlstream.h>
@@ -2279,11 +2281,92 @@ void QPdfEnginePrivate::writeFonts()
     fonts.clear();
 }
 
+#ifndef QT_NO_COMPRESS
+// Like writeCompressed(QIODevice *), but deflating into a byte array so it
+// can run off the document thread.
+static QByteArray qt_pdf_deflate(QIODevice *dev)
+{
+    const int size = QPdfPage::chunkSize();
+    QByteArray result;
+    ::z_stream zStruct;
+    zStruct.zalloc = Z_NULL;
+    zStruct.zfree = Z_NULL;
+    zStruct.opaque = Z_NULL;
+    if (::deflateInit(&zStruct, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        qWarning("qt_pdf_deflate: Error in deflateInit()");
+        return result;
+    }
+    zStruct.avail_in = 0;
+    QByteArray in, out;
+    out.resize(size);
+    while (!dev->atEnd() || zStruct.avail_in != 0) {
+        if (zStruct.avail_in == 0) {
+            in = dev->read(size);
+            zStruct.avail_in = in.size();
+            zStruct.next_in = reinterpret_cast<unsigned char*>(in.data());
+            if (in.size() <= 0) {
+                qWarning("qt_pdf_deflate: Error in read()");
+                ::deflateEnd(&zStruct);
+                return result;
+            }
+        }
+        zStruct.next_out = reinterpret_cast<unsigned char*>(out.data());
+        zStruct.avail_out = out.size();
+        if (::deflate(&zStruct, 0) != Z_OK) {
+            qWarning("qt_pdf_deflate: Error in deflate()");
+            ::deflateEnd(&zStruct);
+            return result;
+        }
+        result.append(out.constData(), out.size() - zStruct.avail_out);
+    }
+    int ret;
+    do {
+        zStruct.next_out = reinterpret_cast<unsigned char*>(out.data());
+        zStruct.avail_out = out.size();
+        ret = ::deflate(&zStruct, Z_FINISH);
+        if (ret != Z_OK && ret != Z_STREAM_END) {
+            qWarning("qt_pdf_deflate: Error in deflate()");
+            ::deflateEnd(&zStruct);
+            return result;
+        }
+        result.append(out.constData(), out.size() - zStruct.avail_out);
+    } while (ret == Z_OK);
+
+    ::deflateEnd(&zStruct);
+
+    return result;
+}
+#endif
+
+void QPdfEnginePrivate::flushPendingPageStream()
+{
+    if (pendingPageStream.object < 0)
+        return;
+
+    const QByteArray data = pendingPageStream.compressed.result();
+    addXrefEntry(pendingPageStream.object);
+    xprintf("<<\n"
+            "/Length %d 0 R\n"
+            "/Filter /FlateDecode\n"
+            ">>\n"
+            "stream\n", pendingPageStream.lengthObject);
+    write(data);
+    xprintf("\nendstream\n"
+            "endobj\n");
+
+    addXrefEntry(pendingPageStream.lengthObject);
+    xprintf("%d\nendobj\n", int(data.size()));
+
+    pendingPageStream = {};
+}
+
 void QPdfEnginePrivate::writePage()
 {
     if (pages.empty())
         return;
 
+    flushPendingPageStream();
+
     *currentPage << "Q Q\n";
 
     uint pageStream = requestObject();
@@ -2366,6 +2449,31 @@ void QPdfEnginePrivate::writePage()
     }
     xprintf("]\nendobj\n");
 
+#ifndef QT_NO_COMPRESS
+    if (do_compress && !QThreadPool::globalInstance()->contains(QThread::currentThread())) {
+        // Deflate the content stream on the thread pool, so that compressing
+        // this page overlaps with painting the next one. The stream and
+        // length objects are emitted by flushPendingPageStream() when the
+        // result is needed, at the latest from writeTail(). When we are
+        // ourselves running on a global-pool thread (e.g. PDF generation in
+        // a QtConcurrent task), blocking on the future could deadlock on a
+        // starved pool, so compress synchronously below instead.
+        pendingPageStream.object = pageStream;
+        pendingPageStream.lengthObject = pageStreamLength;
+        QPromise<QByteArray> promise;
+        pendingPageStream.compressed = promise.future();
+        QThreadPool::globalInstance()->start(
+            [page = currentPage, promise = std::move(promise)]() mutable {
+                promise.start();
+                promise.addResult(qt_pdf_deflate(page->stream()));
+                delete page;
+                promise.finish();
+            });
+        currentPage = nullptr; // ownership passed to the compression task
+        return;
+    }
+#endif
+
     addXrefEntry(pageStream);
     xprintf("<<\n"
             "/Length %d 0 R\n", pageStreamLength); // object number for stream length object
@@ -2386,6 +2494,7 @@ void QPdfEnginePrivate::writePage()
 void QPdfEnginePrivate::writeTail()
 {
     writePage();
+    flushPendingPageStream();
     writeFonts();
     writePageRoot();
     writeDestsRoot();
@@ -19,6 +19,7 @@
 
 #ifndef QT_NO_PDF
 
+#include "QtCore/qfuture.h"
 #include "QtCore/qlist.h"
 #include "QtCore/qstring.h"
 #include "QtCore/quuid.h"
@@ -320,6 +321,17 @@ private:
     int writeImage(const QByteArray &data, int width, int height, WriteImageOption option,
                    int maskObject, int softMaskObject, bool dct = false, bool isMono = false);
     void writePage();
+    void flushPendingPageStream();
+
+    // A page content stream whose deflation is running on the thread pool;
+    // the object is emitted once the result is needed.
+    struct PendingPageStream
+    {
+        int object = -1;
+        int lengthObject = -1;
+        QFuture<QByteArray> compressed;
+    };
+    PendingPageStream pendingPageStream;
 
     int addXrefEntry(int object, bool printostr = true);
     void printString(QStringView string);
@@ -74,6 +74,7 @@ public:
     bool intersects(const QRect &r) const;
 
     QRect boundingRect() const noexcept;
+    static QRegion fromRects(QSpan<const QRect> rects);
     void setRects(const QRect *rect, int num);
     void setRects(QSpan<const QRect> r);
     QSpan<const QRect> rects() const noexcept;
@@ -276,6 +276,7 @@ void QStrokerOps::strokePolygon(const QPointF *points, int pointCount, bool impl
 
     setCurveThresholdFromTransform(QTransform());
     begin(data);
+    m_elements.reserve(pointCount + 1); // one grow for the whole span
     if (matrix.isIdentity()) {
         moveTo(qt_real_to_fixed(points[0].x()), qt_real_to_fixed(points[0].y()));
         for (int i=1; i<pointCount; ++i)
@@ -382,6 +383,37 @@ void QStroker::processCurrentSubpath()
     Q_ASSERT(m_elements.first().type == QPainterPath::MoveToElement);
     Q_ASSERT(m_elements.size() > 1);
 
+    // Single line segments are by far the most common subpath when dashing:
+    // every dash of a dashed polyline arrives here as its own two-element
+    // subpath. Stroke them directly instead of running the generic
+    // forward/backward iteration, which recomputes the segment normal once
+    // per side.
+    if (m_elements.size() == 2 && m_elements.at(1).isLineTo()) {
+        const qfixed2d p0 = m_elements.at(0);
+        const qfixed2d p1 = m_elements.at(1);
+        const qreal x0 = qt_fixed_to_real(p0.x);
+        const qreal y0 = qt_fixed_to_real(p0.y);
+        const qreal x1 = qt_fixed_to_real(p1.x);
+        const qreal y1 = qt_fixed_to_real(p1.y);
+        const qreal dx = x1 - x0;
+        const qreal dy = y1 - y0;
+        const qreal len = qHypot(dx, dy);
+        // Fuzzy-equal endpoints form a closed subpath and degenerate
+        // segments emit nothing; leave those to the generic code below.
+        if (!(p0 == p1) && qIsFinite(len)) {
+            const qreal scale = qt_fixed_to_real(m_strokeWidth) / 2 / len;
+            const qreal nx = dy * scale; // same orientation as QLineF::normalVector()
+            const qreal ny = -dx * scale;
+
+            emitMoveTo(qt_real_to_fixed(x0 + nx), qt_real_to_fixed(y0 + ny));
+            emitLineTo(qt_real_to_fixed(x1 + nx), qt_real_to_fixed(y1 + ny));
+            joinPoints(p1.x, p1.y, QLineF(x1 - nx, y1 - ny, x0 - nx, y0 - ny), m_capStyle);
+            emitLineTo(qt_real_to_fixed(x0 - nx), qt_real_to_fixed(y0 - ny));
+            joinPoints(p0.x, p0.y, QLineF(x0 + nx, y0 + ny, x1 + nx, y1 + ny), m_capStyle);
+            return;
+        }
+    }
+
     QSubpathForwardIterator fwit(&m_elements);
     QSubpathBackwardIterator bwit(&m_elements);
 
@@ -1140,6 +1172,7 @@ void QDashStroker::processCurrentSubpath()
                        qt_fixed_to_real(e.x),
                        qt_fixed_to_real(e.y));
         elen = cline.length();
+        const qreal invElen = elen > 0 ? qreal(1) / elen : qreal(0);
 
         estop = estart + elen;
 
@@ -1199,7 +1232,7 @@ void QDashStroker::processCurrentSubpath()
                 done = true;
                 p2 = cline.p2();
             } else { // Dash is on this line
-                p2 = cline.pointAt(dpos/elen);
+                p2 = cline.pointAt(dpos * invElen);
                 pos = dpos + estart;
                 done = pos >= estop;
                 if (++idash >= dashCount)
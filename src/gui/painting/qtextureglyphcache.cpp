@@ -9,6 +9,8 @@
 
 #include <QtGui/qpainterpath.h>
 
+#include <string.h>
+
 QT_BEGIN_NAMESPACE
 
 // #define CACHE_DEBUG
@@ -313,14 +315,33 @@ void QImageTextureGlyphCache::fillTexture(const Coord &c,
 
     if (m_format == QFontEngine::Format_A32
         || m_format == QFontEngine::Format_ARGB) {
-        QImage ref(m_image.bits() + (c.x * 4 + c.y * m_image.bytesPerLine()),
-                   qMin(mask.width(), c.w), qMin(mask.height(), c.h), m_image.bytesPerLine(),
-                   m_image.format());
-        QPainter p(&ref);
-        p.setCompositionMode(QPainter::CompositionMode_Source);
-        p.fillRect(0, 0, c.w, c.h, QColor(0,0,0,0)); // TODO optimize this
-        p.drawImage(0, 0, mask);
-        p.end();
+        if (mask.format() == m_image.format()) {
+            // Same 32-bit layout: copy the rows directly and zero out the
+            // reserved cell area the mask does not cover.
+            int mw = qMin(mask.width(), c.w);
+            int mh = qMin(mask.height(), c.h);
+            uchar *d = m_image.bits();
+            qsizetype dbpl = m_image.bytesPerLine();
+
+            for (int y = 0; y < c.h; ++y) {
+                uchar *dest = d + (c.y + y) * dbpl + c.x * 4;
+                if (y < mh) {
+                    memcpy(dest, mask.constScanLine(y), mw * 4);
+                    memset(dest + mw * 4, 0, (c.w - mw) * 4);
+                } else {
+                    memset(dest, 0, c.w * 4);
+                }
+            }
+        } else {
+            QImage ref(m_image.bits() + (c.x * 4 + c.y * m_image.bytesPerLine()),
+                       qMin(mask.width(), c.w), qMin(mask.height(), c.h), m_image.bytesPerLine(),
+                       m_image.format());
+            QPainter p(&ref);
+            p.setCompositionMode(QPainter::CompositionMode_Source);
+            p.fillRect(0, 0, c.w, c.h, QColor(0,0,0,0));
+            p.drawImage(0, 0, mask);
+            p.end();
+        }
     } else if (m_format == QFontEngine::Format_Mono) {
         if (mask.depth() > 1) {
             // TODO optimize this
@@ -369,15 +390,9 @@ void QImageTextureGlyphCache::fillTexture(const Coord &c,
                 }
             }
         } else if (mask.depth() == 8) {
-            for (int y = 0; y < c.h; ++y) {
+            for (int y = 0; y < mh; ++y) {
                 uchar *dest = d + (c.y + y) *dbpl + c.x;
-                if (y < mh) {
-                    const uchar *src = mask.constScanLine(y);
-                    for (int x = 0; x < c.w; ++x) {
-                        if (x < mw)
-                            dest[x] = src[x];
-                    }
-                }
+                memcpy(dest, mask.constScanLine(y), mw);
             }
         }
     }
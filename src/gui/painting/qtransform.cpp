@@ -13,6 +13,7 @@
 #include <qnumeric.h>
 
 #include <private/qbezier_p.h>
+#include <private/qsimd_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -1289,16 +1290,98 @@ QPolygonF QTransform::map(const QPolygonF &a) const
     if (t <= TxTranslate)
         return a.translated(m_matrix[2][0], m_matrix[2][1]);
 
-    int size = a.size();
-    int i;
-    QPolygonF p(size);
-    const QPointF *da = a.constData();
-    QPointF *dp = p.data();
+    QPolygonF p(a.size());
+    map(a.constData(), p.data(), a.size());
+    return p;
+}
 
-    for(i = 0; i < size; ++i) {
-        MAP(da[i].xp, da[i].yp, dp[i].xp, dp[i].yp);
+/*!
+    \since 6.9
+    \overload
+
+    Maps the \a size points at \a in into the coordinate system defined
+    by this matrix and writes the results to \a out. The source and
+    destination may be the same array for in-place mapping, but must not
+    otherwise overlap.
+
+    The transformation type is resolved once for the entire span instead
+    of once per point, so this overload is the preferred way to
+    transform large batches of coordinates.
+*/
+void QTransform::map(const QPointF *in, QPointF *out, qsizetype size) const
+{
+    const TransformationType t = inline_type();
+    switch (t) {
+    case TxNone:
+        if (in != out) {
+            for (qsizetype i = 0; i < size; ++i)
+                out[i] = in[i];
+        }
+        break;
+    case TxTranslate: {
+        const qreal dx = m_matrix[2][0];
+        const qreal dy = m_matrix[2][1];
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i].xp = in[i].xp + dx;
+            out[i].yp = in[i].yp + dy;
+        }
+        break;
+    }
+    case TxScale: {
+        const qreal m11 = m_matrix[0][0];
+        const qreal m22 = m_matrix[1][1];
+        const qreal dx = m_matrix[2][0];
+        const qreal dy = m_matrix[2][1];
+        for (qsizetype i = 0; i < size; ++i) {
+            out[i].xp = m11 * in[i].xp + dx;
+            out[i].yp = m22 * in[i].yp + dy;
+        }
+        break;
+    }
+    case TxRotate:
+    case TxShear: {
+#if defined(__SSE2__) && !defined(QT_COORD_TYPE)
+        // out = x * (m11, m12) + y * (m21, m22) + (dx, dy), two doubles at a time
+        const __m128d mcol1 = _mm_set_pd(m_matrix[0][1], m_matrix[0][0]);
+        const __m128d mcol2 = _mm_set_pd(m_matrix[1][1], m_matrix[1][0]);
+        const __m128d mtrans = _mm_set_pd(m_matrix[2][1], m_matrix[2][0]);
+        for (qsizetype i = 0; i < size; ++i) {
+            const __m128d v = _mm_loadu_pd(&in[i].xp);
+            __m128d r = _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(v, v), mcol1), mtrans);
+            r = _mm_add_pd(_mm_mul_pd(_mm_unpackhi_pd(v, v), mcol2), r);
+            _mm_storeu_pd(&out[i].xp, r);
+        }
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64) && !defined(QT_COORD_TYPE)
+        const float64x2_t mcol1 = { m_matrix[0][0], m_matrix[0][1] };
+        const float64x2_t mcol2 = { m_matrix[1][0], m_matrix[1][1] };
+        const float64x2_t mtrans = { m_matrix[2][0], m_matrix[2][1] };
+        for (qsizetype i = 0; i < size; ++i) {
+            const float64x2_t v = vld1q_f64(&in[i].xp);
+            float64x2_t r = vfmaq_laneq_f64(mtrans, mcol1, v, 0);
+            r = vfmaq_laneq_f64(r, mcol2, v, 1);
+            vst1q_f64(&out[i].xp, r);
+        }
+#else
+        const qreal m11 = m_matrix[0][0];
+        const qreal m12 = m_matrix[0][1];
+        const qreal m21 = m_matrix[1][0];
+        const qreal m22 = m_matrix[1][1];
+        const qreal dx = m_matrix[2][0];
+        const qreal dy = m_matrix[2][1];
+        for (qsizetype i = 0; i < size; ++i) {
+            const qreal fx = in[i].xp;
+            const qreal fy = in[i].yp;
+            out[i].xp = m11 * fx + m21 * fy + dx;
+            out[i].yp = m12 * fx + m22 * fy + dy;
+        }
+#endif
+        break;
+    }
+    case TxProject:
+        for (qsizetype i = 0; i < size; ++i)
+            MAP(in[i].xp, in[i].yp, out[i].xp, out[i].yp);
+        break;
     }
-    return p;
 }
 
 /*!
@@ -1857,6 +1940,54 @@ QRectF QTransform::mapRect(const QRectF &rect) const
     }
 }
 
+/*!
+    \since 6.9
+    \overload
+
+    Maps the \a size rectangles at \a in into the coordinate system
+    defined by this matrix and writes the results to \a out, with the
+    same semantics as mapRect(): for rotating, shearing or projecting
+    matrices each result is the bounding rectangle of the mapped input.
+    The source and destination may be the same array, but must not
+    otherwise overlap.
+
+    The transformation type is resolved once for the entire span instead
+    of once per rectangle.
+*/
+void QTransform::mapRect(const QRectF *in, QRectF *out, qsizetype size) const
+{
+    const TransformationType t = inline_type();
+    if (t <= TxTranslate) {
+        const qreal dx = m_matrix[2][0];
+        const qreal dy = m_matrix[2][1];
+        for (qsizetype i = 0; i < size; ++i)
+            out[i] = in[i].translated(dx, dy);
+    } else if (t <= TxScale) {
+        const qreal m11 = m_matrix[0][0];
+        const qreal m22 = m_matrix[1][1];
+        const qreal dx = m_matrix[2][0];
+        const qreal dy = m_matrix[2][1];
+        for (qsizetype i = 0; i < size; ++i) {
+            qreal x = m11 * in[i].x() + dx;
+            qreal y = m22 * in[i].y() + dy;
+            qreal w = m11 * in[i].width();
+            qreal h = m22 * in[i].height();
+            if (w < 0) {
+                w = -w;
+                x -= w;
+            }
+            if (h < 0) {
+                h = -h;
+                y -= h;
+            }
+            out[i] = QRectF(x, y, w, h);
+        }
+    } else {
+        for (qsizetype i = 0; i < size; ++i)
+            out[i] = mapRect(in[i]);
+    }
+}
+
 /*!
     \fn QRect QTransform::mapRect(const QRect &rectangle) const
     \overload
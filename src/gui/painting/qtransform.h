@@ -124,6 +124,8 @@ public:
     QRectF mapRect(const QRectF &) const;
     void map(int x, int y, int *tx, int *ty) const;
     void map(qreal x, qreal y, qreal *tx, qreal *ty) const;
+    void map(const QPointF *in, QPointF *out, qsizetype size) const;
+    void mapRect(const QRectF *in, QRectF *out, qsizetype size) const;
 
     QTransform &operator*=(qreal div);
     QTransform &operator/=(qreal div);
@@ -3,6 +3,10 @@
 
 #include "qrhi_p.h"
 #include <qmath.h>
+#include <qdir.h>
+#include <qfileinfo.h>
+#include <qsavefile.h>
+#include <qstandardpaths.h>
 #include <QLoggingCategory>
 
 #include "qrhinull_p.h"
@@ -278,7 +282,12 @@ Q_LOGGING_CATEGORY(QRHI_LOG_INFO, "qt.rhi.general")
     \section2 Threading
 
     A QRhi instance and the associated resources can be created and used on any
-    thread but all usage must be limited to that one single thread. When
+    thread but all usage must be limited to that one single thread. The one
+    exception is resource update batches: since 6.9, nextResourceUpdateBatch()
+    can be called, and the returned batch filled with operations, on any
+    thread, as long as each batch stays confined to one thread and is handed
+    back to the QRhi's thread for committing. See nextResourceUpdateBatch()
+    for details. When
     rendering to multiple QWindows in an application, having a dedicated thread
     and QRhi instance for each window is often advisable, as this can eliminate
     issues with unexpected throttling caused by presenting to multiple windows.
@@ -677,6 +686,19 @@ Q_LOGGING_CATEGORY(QRHI_LOG_INFO, "qt.rhi.general")
     with a different set of flags (such as, \l PreferSoftwareRenderer), in order
     to hide the unconditional warnings from the output that would be printed
     when the first create() attempt had failed.
+
+    \value EnablePersistentPipelineCache Makes the QRhi manage disk-based
+    persistence of the pipeline cache automatically, without any further
+    application involvement: at create() time the cache is seeded with the
+    contents of a file in QStandardPaths::CacheLocation, and at destruction
+    time the (possibly grown) cache contents are written back. The file is
+    keyed by the backend and the adapter/device identifiers, and the
+    serialized blob carries the Qt version and driver version, so stale data
+    after a Qt upgrade or a driver update is recognized and ignored by
+    setPipelineCacheData(). Setting this flag implies
+    \l EnablePipelineCacheDataSave. Applications that want full control over
+    persistence policy should instead use pipelineCacheData() and
+    setPipelineCacheData() directly. This flag was introduced in Qt 6.9.
  */
 
 /*!
@@ -1036,6 +1058,13 @@ Q_LOGGING_CATEGORY(QRHI_LOG_INFO, "qt.rhi.general")
     texture becomes necessary, for example when rendering into an
     OpenXR-provided depth texture (XR_KHR_composition_layer_depth). This enum
     value has been introduced in Qt 6.8.
+
+    \value PerPassTimestamps Indicates that recording a GPU timestamp pair
+    around each render or compute pass, queried via
+    \l{QRhiCommandBuffer::lastCompletedGpuPassTimings()}{lastCompletedGpuPassTimings()},
+    is supported. Like \l Timestamps, this requires
+    \l{QRhi::EnableTimestamps}{EnableTimestamps} to be set when creating the
+    QRhi. This enum value has been introduced in Qt 6.9.
  */
 
 /*!
@@ -3482,6 +3511,11 @@ QRhiResource::~QRhiResource()
 {
     // destroy() cannot be called here, due to virtuals; it is up to the
     // subclasses to do that.
+
+    // A pipeline that never got created is not registered, so its destroy()
+    // may not reach unregisterResource(); drop any queued creation here.
+    if (m_rhi)
+        m_rhi->cancelPendingPipelineCreation(this);
 }
 
 /*!
@@ -6750,6 +6784,35 @@ QRhiResource::Type QRhiGraphicsPipeline::resourceType() const
     comes in addition to any driver-level caching).
  */
 
+/*!
+    \since 6.9
+
+    Requests deferred creation of the pipeline instead of compiling it
+    synchronously like create() does.
+
+    The pipeline is queued on the QRhi and built at a subsequent frame start
+    (or when QRhi::finish() is called, which drains the queue completely). At
+    least one queued pipeline is built per frame, and more as long as a small
+    time budget is not exceeded; the budget defaults to 2 milliseconds and can
+    be overridden with the \c QT_RHI_PIPELINE_CREATE_BUDGET environment
+    variable (in milliseconds). This allows speculatively warming up a set of
+    pipelines spread over several frames, instead of hitching the first frame
+    that happens to use a new combination of shaders and state.
+
+    \a completed, when valid, is invoked with the result of create() once
+    creation has been attempted. It is always invoked on the thread the QRhi
+    operates on. Until then the pipeline must not be used in a render pass.
+
+    A still-pending request is replaced by calling createAsync() again, and is
+    dropped when the pipeline is destroyed before the request is processed.
+
+    \sa create(), QRhi::pipelineCacheData()
+ */
+void QRhiGraphicsPipeline::createAsync(std::function<void(bool)> completed)
+{
+    m_rhi->enqueuePipelineCreation(this, std::move(completed));
+}
+
 /*!
     \fn QRhiGraphicsPipeline::Flags QRhiGraphicsPipeline::flags() const
     \return the currently set flags.
@@ -7879,6 +7942,21 @@ QRhiComputePipeline::QRhiComputePipeline(QRhiImplementation *rhi)
 {
 }
 
+/*!
+    \since 6.9
+
+    Requests deferred creation of the pipeline instead of compiling it
+    synchronously like create() does. Works like
+    QRhiGraphicsPipeline::createAsync(); \a completed, when valid, is invoked
+    with the result of create() once creation has been attempted.
+
+    \sa create(), QRhiGraphicsPipeline::createAsync()
+ */
+void QRhiComputePipeline::createAsync(std::function<void(bool)> completed)
+{
+    m_rhi->enqueuePipelineCreation(this, std::move(completed));
+}
+
 /*!
     \fn QRhiComputePipeline::Flags QRhiComputePipeline::flags() const
     \return the currently set flags.
@@ -8057,6 +8135,69 @@ QRhiImplementation::~QRhiImplementation()
             res->m_rhi = nullptr;
         }
     }
+
+    // Pipelines with a pending createAsync() may never have been registered;
+    // null their rhi pointer too so deleting them later stays harmless.
+    for (const PendingPipelineCreation &p : pendingPipelineCreations)
+        p.resource->m_rhi = nullptr;
+}
+
+void QRhiImplementation::enqueuePipelineCreation(QRhiResource *ps, std::function<void(bool)> completed)
+{
+    for (PendingPipelineCreation &p : pendingPipelineCreations) {
+        if (p.resource == ps) {
+            p.completed = std::move(completed);
+            return;
+        }
+    }
+    pendingPipelineCreations.append({ ps, std::move(completed) });
+}
+
+void QRhiImplementation::cancelPendingPipelineCreation(QRhiResource *res)
+{
+    for (qsizetype i = 0; i < pendingPipelineCreations.size(); ++i) {
+        if (pendingPipelineCreations[i].resource == res) {
+            pendingPipelineCreations.remove(i);
+            return;
+        }
+    }
+}
+
+void QRhiImplementation::processPendingPipelineCreations(bool drainAll)
+{
+    if (pendingPipelineCreations.isEmpty())
+        return;
+
+    // in milliseconds; the default allows roughly amortizing a typical
+    // monolithic pipeline compilation over one frame of a 60 FPS budget
+    static const qint64 budgetUsecs = [] {
+        bool ok = false;
+        const int env = qEnvironmentVariableIntValue("QT_RHI_PIPELINE_CREATE_BUDGET", &ok);
+        return ok ? qint64(env) * 1000 : qint64(2000);
+    }();
+
+    QElapsedTimer timer;
+    timer.start();
+    // Build at least one pipeline per call, then keep going only while
+    // within the time budget, so that speculative warm-up of many pipelines
+    // is spread over several frames instead of hitching a single one.
+    while (!pendingPipelineCreations.isEmpty()) {
+        const PendingPipelineCreation p = std::move(pendingPipelineCreations.first());
+        pendingPipelineCreations.remove(0);
+        const bool ok = p.resource->resourceType() == QRhiResource::GraphicsPipeline
+                ? static_cast<QRhiGraphicsPipeline *>(p.resource)->create()
+                : static_cast<QRhiComputePipeline *>(p.resource)->create();
+        if (p.completed)
+            p.completed(ok);
+        if (!drainAll && timer.nsecsElapsed() / 1000 >= budgetUsecs)
+            break;
+    }
+}
+
+QList<QRhiCommandBuffer::GpuPassTiming> QRhiImplementation::lastCompletedGpuPassTimings(QRhiCommandBuffer *cb)
+{
+    Q_UNUSED(cb);
+    return {};
 }
 
 bool QRhiImplementation::isCompressedFormat(QRhiTexture::Format format) const
@@ -8447,6 +8588,9 @@ QRhi::~QRhi()
     qDeleteAll(d->pendingDeleteResources);
     d->pendingDeleteResources.clear();
 
+    if (d->persistentPipelineCache)
+        d->savePersistentPipelineCache();
+
     d->destroy();
     delete d;
 }
@@ -8462,11 +8606,71 @@ void QRhiImplementation::prepareForCreate(QRhi *rhi, QRhi::Implementation impl,
         const_cast<QLoggingCategory &>(QRHI_LOG_INFO()).setEnabled(QtDebugMsg, true);
 
     debugMarkers = flags.testFlag(QRhi::EnableDebugMarkers);
+    persistentPipelineCache = flags.testFlag(QRhi::EnablePersistentPipelineCache);
 
     implType = impl;
     implThread = QThread::currentThread();
 }
 
+static QString qrhi_persistentPipelineCacheFilePath(QRhi *q, QRhi::Implementation implType)
+{
+    const QString base = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (base.isEmpty())
+        return QString();
+
+    // The backend and the adapter/device identify the file; everything else
+    // that can go stale (driver version, Qt version, data layout) is part of
+    // the serialized header and is validated by setPipelineCacheData(),
+    // which ignores mismatching blobs.
+    const QRhiDriverInfo info = q->driverInfo();
+    const QString name = QString::asprintf("qrhi_%s_%llx_%llx_%zx.qpc",
+                                           QRhi::backendName(implType),
+                                           (unsigned long long) info.vendorId,
+                                           (unsigned long long) info.deviceId,
+                                           size_t(qHash(info.deviceName)));
+    return base + QStringLiteral("/qtpipelinecache/") + name;
+}
+
+void QRhiImplementation::loadPersistentPipelineCache()
+{
+    const QString path = qrhi_persistentPipelineCacheFilePath(q, implType);
+    if (path.isEmpty())
+        return;
+
+    QFile f(path);
+    if (f.open(QIODevice::ReadOnly)) {
+        const QByteArray blob = f.readAll();
+        if (!blob.isEmpty()) {
+            qCDebug(QRHI_LOG_INFO, "Seeding pipeline cache from '%s' (%d bytes)",
+                    qPrintable(path), int(blob.size()));
+            q->setPipelineCacheData(blob);
+        }
+    }
+}
+
+void QRhiImplementation::savePersistentPipelineCache()
+{
+    const QString path = qrhi_persistentPipelineCacheFilePath(q, implType);
+    if (path.isEmpty())
+        return;
+
+    const QByteArray blob = q->pipelineCacheData();
+    if (blob.isEmpty())
+        return;
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile f(path);
+    if (f.open(QIODevice::WriteOnly)) {
+        f.write(blob);
+        if (f.commit()) {
+            qCDebug(QRHI_LOG_INFO, "Persisted pipeline cache to '%s' (%d bytes)",
+                    qPrintable(path), int(blob.size()));
+            return;
+        }
+    }
+    qCDebug(QRHI_LOG_INFO, "Failed to persist pipeline cache to '%s'", qPrintable(path));
+}
+
 /*!
     \return a new QRhi instance with a backend for the graphics API specified
     by \a impl with the specified \a flags. \return \c nullptr if the
@@ -8500,6 +8704,10 @@ void QRhiImplementation::prepareForCreate(QRhi *rhi, QRhi::Implementation impl,
  */
 QRhi *QRhi::create(Implementation impl, QRhiInitParams *params, Flags flags, QRhiNativeHandles *importDevice)
 {
+    // managed persistence needs the backend to keep retrievable cache contents
+    if (flags.testFlag(EnablePersistentPipelineCache))
+        flags |= EnablePipelineCacheDataSave;
+
     std::unique_ptr<QRhi> r(new QRhi);
 
     switch (impl) {
@@ -8564,8 +8772,11 @@ QRhi *QRhi::create(Implementation impl, QRhiInitParams *params, Flags flags, QRh
 
     if (r->d) {
         r->d->prepareForCreate(r.get(), impl, flags);
-        if (r->d->create(flags))
+        if (r->d->create(flags)) {
+            if (r->d->persistentPipelineCache)
+                r->d->loadPersistentPipelineCache();
             return r.release();
+        }
     }
 
     return nullptr;
@@ -9001,6 +9212,26 @@ bool QRhiResourceUpdateBatch::hasOptimalCapacity() const
 void QRhiResourceUpdateBatch::updateDynamicBuffer(QRhiBuffer *buf, quint32 offset, quint32 size, const void *data)
 {
     if (size > 0) {
+        // Coalesce with the previous op when this write continues (or
+        // rewrites) it; thousands of small sequential updates per frame are
+        // common and this keeps both the op count and the number of transfer
+        // commands the backends record down.
+        if (d->activeBufferOpCount > 0) {
+            QRhiResourceUpdateBatchPrivate::BufferOp &prev(d->bufferOps[d->activeBufferOpCount - 1]);
+            if (prev.type == QRhiResourceUpdateBatchPrivate::BufferOp::DynamicUpdate
+                && prev.buf == buf
+                && prev.data.isDetached())
+            {
+                if (prev.offset + prev.data.size() == offset) {
+                    prev.data.append(reinterpret_cast<const char *>(data), size);
+                    return;
+                }
+                if (prev.offset == offset && prev.data.size() == size) {
+                    prev.data.assign(reinterpret_cast<const char *>(data), size);
+                    return;
+                }
+            }
+        }
         const int idx = d->activeBufferOpCount++;
         const int opListSize = d->bufferOps.size();
         if (idx < opListSize)
@@ -9021,6 +9252,18 @@ void QRhiResourceUpdateBatch::updateDynamicBuffer(QRhiBuffer *buf, quint32 offse
 void QRhiResourceUpdateBatch::uploadStaticBuffer(QRhiBuffer *buf, quint32 offset, quint32 size, const void *data)
 {
     if (size > 0) {
+        // Adjacent uploads to the same buffer become one copy command.
+        if (d->activeBufferOpCount > 0) {
+            QRhiResourceUpdateBatchPrivate::BufferOp &prev(d->bufferOps[d->activeBufferOpCount - 1]);
+            if (prev.type == QRhiResourceUpdateBatchPrivate::BufferOp::StaticUpload
+                && prev.buf == buf
+                && prev.data.isDetached()
+                && prev.offset + prev.data.size() == offset)
+            {
+                prev.data.append(reinterpret_cast<const char *>(data), size);
+                return;
+            }
+        }
         const int idx = d->activeBufferOpCount++;
         if (idx < d->bufferOps.size())
             QRhiResourceUpdateBatchPrivate::BufferOp::changeToStaticUpload(&d->bufferOps[idx], buf, offset, size, data);
@@ -9239,6 +9482,14 @@ void QRhiResourceUpdateBatch::generateMips(QRhiTexture *tex)
    \note Can be called outside beginFrame() - endFrame() as well since a batch
    instance just collects data on its own, it does not perform any operations.
 
+   \note Since 6.9 this function may also be called on threads other than the
+   one the QRhi operates on, and the returned batch can be filled with
+   operations on that thread. Each batch must still be used by a single thread
+   at a time, and committing a batch (or merging it into another with
+   \l{QRhiResourceUpdateBatch::merge()}{merge()}) must happen on the QRhi's
+   thread. This allows engines to prepare upload data for several passes
+   concurrently while the command recording itself stays on one thread.
+
    Due to not being tied to a frame being recorded, the following sequence is
    valid for example:
 
@@ -9276,6 +9527,8 @@ QRhiResourceUpdateBatch *QRhi::nextResourceUpdateBatch()
     // memory (see trimOpLists) before returning it.
     static const bool preferMemoryOverPerformance = qEnvironmentVariableIntValue("QT_RHI_MINIMIZE_POOLS");
 
+    QMutexLocker locker(&d->resUpdPoolMutex);
+
     auto nextFreeBatch = [this]() -> QRhiResourceUpdateBatch * {
         auto isFree = [this](int i) -> QRhiResourceUpdateBatch * {
             const quint64 mask = 1ULL << quint64(i);
@@ -9321,13 +9574,15 @@ QRhiResourceUpdateBatch *QRhi::nextResourceUpdateBatch()
 
 void QRhiResourceUpdateBatchPrivate::free()
 {
-    Q_ASSERT(poolIndex >= 0 && rhi->resUpdPool[poolIndex] == q);
-
     activeBufferOpCount = 0;
     activeTextureOpCount = 0;
 
-    const quint64 mask = 1ULL << quint64(poolIndex);
-    rhi->resUpdPoolMap &= ~mask;
+    {
+        QMutexLocker locker(&rhi->resUpdPoolMutex);
+        Q_ASSERT(poolIndex >= 0 && rhi->resUpdPool[poolIndex] == q);
+        const quint64 mask = 1ULL << quint64(poolIndex);
+        rhi->resUpdPoolMap &= ~mask;
+    }
     poolIndex = -1;
 
     // textureOps is cleared, to not keep the potentially large image pixel
@@ -10002,6 +10257,47 @@ double QRhiCommandBuffer::lastCompletedGpuTime()
     return m_rhi->lastCompletedGpuTime(this);
 }
 
+/*!
+    \struct QRhiCommandBuffer::GpuPassTiming
+    \inmodule QtGuiPrivate
+    \inheaderfile rhi/qrhi.h
+    \since 6.9
+    \brief Describes the GPU time spent in one render or compute pass.
+
+    \note This is a RHI API with limited compatibility guarantees, see \l QRhi
+    for details.
+ */
+
+/*!
+    \variable QRhiCommandBuffer::GpuPassTiming::name
+    \brief the \l{QRhiResource::name()}{name} of the pass' render target, or
+    \c{"compute"} for compute passes.
+ */
+
+/*!
+    \variable QRhiCommandBuffer::GpuPassTiming::seconds
+    \brief the GPU time, in seconds, the pass took to execute.
+ */
+
+/*!
+    \return the GPU timings for the passes of the last completed frame, one
+    entry per render or compute pass, in submission order. An empty list is
+    returned when the results are not (yet) available, or when the
+    \l{QRhi::PerPassTimestamps}{PerPassTimestamps} feature is not supported or
+    \l{QRhi::EnableTimestamps}{timestamp collection} was not enabled.
+
+    Like \l lastCompletedGpuTime(), the results do not refer to the frame
+    currently being recorded, but rather to an earlier, already completed use
+    of the same frame slot, and are only collected for swapchain-based frames.
+
+    \since 6.9
+    \sa lastCompletedGpuTime(), QRhi::EnableTimestamps
+ */
+QList<QRhiCommandBuffer::GpuPassTiming> QRhiCommandBuffer::lastCompletedGpuPassTimings()
+{
+    return m_rhi->lastCompletedGpuPassTimings(this);
+}
+
 /*!
     \return the value (typically an offset) \a v aligned to the uniform buffer
     alignment given by by ubufAlignment().
@@ -10186,6 +10482,7 @@ void QRhi::releaseCachedResources()
 {
     d->releaseCachedResources();
 
+    QMutexLocker locker(&d->resUpdPoolMutex);
     for (QRhiResourceUpdateBatch *u : d->resUpdPool) {
         if (u->d->poolIndex < 0)
             u->d->trimOpLists();
@@ -10756,6 +11053,8 @@ QRhi::FrameOpResult QRhi::beginFrame(QRhiSwapChain *swapChain, BeginFrameFlags f
 {
     if (d->inFrame)
         qWarning("Attempted to call beginFrame() within a still active frame; ignored");
+    else
+        d->processPendingPipelineCreations();
 
     QRhi::FrameOpResult r = !d->inFrame ? d->beginFrame(swapChain, flags) : FrameOpSuccess;
     if (r == FrameOpSuccess)
@@ -10904,6 +11203,8 @@ QRhi::FrameOpResult QRhi::beginOffscreenFrame(QRhiCommandBuffer **cb, BeginFrame
 {
     if (d->inFrame)
         qWarning("Attempted to call beginOffscreenFrame() within a still active frame; ignored");
+    else
+        d->processPendingPipelineCreations();
 
     QRhi::FrameOpResult r = !d->inFrame ? d->beginOffscreenFrame(cb, flags) : FrameOpSuccess;
     if (r == FrameOpSuccess)
@@ -10945,6 +11246,7 @@ QRhi::FrameOpResult QRhi::endOffscreenFrame(EndFrameFlags flags)
  */
 QRhi::FrameOpResult QRhi::finish()
 {
+    d->processPendingPipelineCreations(true);
     return d->finish();
 }
 
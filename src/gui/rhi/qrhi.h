@@ -1475,6 +1475,7 @@ public:
     void setMultiViewCount(int count) { m_multiViewCount = count; }
 
     virtual bool create() = 0;
+    void createAsync(std::function<void(bool)> completed = {});
 
 protected:
     QRhiGraphicsPipeline(QRhiImplementation *rhi);
@@ -1629,6 +1630,7 @@ public:
 
     QRhiResource::Type resourceType() const override;
     virtual bool create() = 0;
+    void createAsync(std::function<void(bool)> completed = {});
 
     Flags flags() const { return m_flags; }
     void setFlags(Flags f) { m_flags = f; }
@@ -1714,6 +1716,12 @@ public:
 
     double lastCompletedGpuTime();
 
+    struct GpuPassTiming {
+        QByteArray name;
+        double seconds;
+    };
+    QList<GpuPassTiming> lastCompletedGpuPassTimings();
+
 protected:
     QRhiCommandBuffer(QRhiImplementation *rhi);
 };
@@ -1818,7 +1826,8 @@ public:
         PreferSoftwareRenderer = 1 << 1,
         EnablePipelineCacheDataSave = 1 << 2,
         EnableTimestamps = 1 << 3,
-        SuppressSmokeTestWarnings = 1 << 4
+        SuppressSmokeTestWarnings = 1 << 4,
+        EnablePersistentPipelineCache = 1 << 5
     };
     Q_DECLARE_FLAGS(Flags, Flag)
 
@@ -1872,7 +1881,8 @@ public:
         ThreeDimensionalTextureMipmaps,
         MultiView,
         TextureViewFormat,
-        ResolveDepthStencil
+        ResolveDepthStencil,
+        PerPassTimestamps
     };
 
     enum BeginFrameFlag {
@@ -19,6 +19,7 @@
 #include <QBitArray>
 #include <QAtomicInt>
 #include <QElapsedTimer>
+#include <QMutex>
 #include <QLoggingCategory>
 #include <QtCore/qset.h>
 #include <QtCore/qvarlengtharray.h>
@@ -121,6 +122,7 @@ public:
     virtual void beginExternal(QRhiCommandBuffer *cb) = 0;
     virtual void endExternal(QRhiCommandBuffer *cb) = 0;
     virtual double lastCompletedGpuTime(QRhiCommandBuffer *cb) = 0;
+    virtual QList<QRhiCommandBuffer::GpuPassTiming> lastCompletedGpuPassTimings(QRhiCommandBuffer *cb);
 
     virtual QList<int> supportedSampleCounts() const = 0;
     virtual int ubufAlignment() const = 0;
@@ -164,6 +166,7 @@ public:
     void unregisterResource(QRhiResource *res)
     {
         resources.remove(res);
+        cancelPendingPipelineCreation(res);
     }
 
     void addDeleteLater(QRhiResource *res)
@@ -174,6 +177,13 @@ public:
             delete res;
     }
 
+    void enqueuePipelineCreation(QRhiResource *ps, std::function<void(bool)> completed);
+    void cancelPendingPipelineCreation(QRhiResource *res);
+    void processPendingPipelineCreations(bool drainAll = false);
+
+    void loadPersistentPipelineCache();
+    void savePersistentPipelineCache();
+
     void addCleanupCallback(const QRhi::CleanupCallback &callback)
     {
         cleanupCallbacks.append(callback);
@@ -239,6 +249,7 @@ public:
     static const int MAX_SHADER_CACHE_ENTRIES = 128;
 
     bool debugMarkers = false;
+    bool persistentPipelineCache = false;
     int currentFrameSlot = 0; // for vk, mtl, and similar. unused by gl and d3d11.
     bool inFrame = false;
 
@@ -246,10 +257,16 @@ private:
     QRhi::Implementation implType;
     QThread *implThread;
     QVarLengthArray<QRhiResourceUpdateBatch *, 4> resUpdPool;
+    QMutex resUpdPoolMutex; // batches may be acquired and filled on any thread
     quint64 resUpdPoolMap = 0;
     int lastResUpdIdx = -1;
     QHash<QRhiResource *, bool> resources;
     QSet<QRhiResource *> pendingDeleteResources;
+    struct PendingPipelineCreation {
+        QRhiResource *resource;
+        std::function<void(bool)> completed;
+    };
+    QVarLengthArray<PendingPipelineCreation, 4> pendingPipelineCreations;
     QVarLengthArray<QRhi::CleanupCallback, 4> cleanupCallbacks;
     QHash<const void *, QRhi::CleanupCallback> keyedCleanupCallbacks;
     QElapsedTimer pipelineCreationTimer;
@@ -378,6 +395,32 @@ public:
             memcpy(d->largeData, s, size);
         }
     }
+    bool isDetached() const
+    {
+        return d && d->ref == 1;
+    }
+    void append(const char *s, quint32 size)
+    {
+        Q_ASSERT(isDetached());
+        const quint32 newSize = d->size + size;
+        if (newSize <= QRhiBufferDataPrivate::SMALL_DATA_SIZE) {
+            memcpy(d->data + d->size, s, size);
+        } else {
+            if (d->largeAlloc < newSize) {
+                // grow geometrically, coalesced updates arrive as many small slices
+                const quint32 alloc = qMax(newSize, d->largeAlloc * 2);
+                char *p = new char[alloc];
+                memcpy(p, constData(), d->size);
+                delete[] d->largeData;
+                d->largeData = p;
+                d->largeAlloc = alloc;
+            } else if (d->size <= QRhiBufferDataPrivate::SMALL_DATA_SIZE) {
+                memcpy(d->largeData, d->data, d->size);
+            }
+            memcpy(d->largeData + d->size, s, size);
+        }
+        d->size = newSize;
+    }
 private:
     QRhiBufferDataPrivate *d = nullptr;
 };
@@ -1476,6 +1476,8 @@ bool QRhiGles2::isFeatureSupported(QRhi::Feature feature) const
         return false;
     case QRhi::ResolveDepthStencil:
         return true;
+    case QRhi::PerPassTimestamps:
+        return false;
     default:
         Q_UNREACHABLE_RETURN(false);
     }
@@ -838,6 +838,8 @@ bool QRhiMetal::isFeatureSupported(QRhi::Feature feature) const
         return false;
     case QRhi::ResolveDepthStencil:
         return true;
+    case QRhi::PerPassTimestamps:
+        return false;
     default:
         Q_UNREACHABLE();
         return false;
@@ -889,6 +889,16 @@ bool QRhiVulkan::create(QRhi::Flags flags)
     timestampQueryPoolMap.resize(QVK_MAX_ACTIVE_TIMESTAMP_PAIRS); // 1 bit per pair
     timestampQueryPoolMap.fill(false);
 
+    if (rhiFlags.testFlag(QRhi::EnableTimestamps) && timestampValidBits) {
+        VkQueryPoolCreateInfo passTimestampQueryPoolInfo = {};
+        passTimestampQueryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        passTimestampQueryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        passTimestampQueryPoolInfo.queryCount = QVK_MAX_PASS_TIMESTAMP_PAIRS * 2 * QVK_FRAMES_IN_FLIGHT;
+        err = df->vkCreateQueryPool(dev, &passTimestampQueryPoolInfo, nullptr, &passTimestampQueryPool);
+        if (err != VK_SUCCESS)
+            qWarning("Failed to create pass timestamp query pool: %d", err);
+    }
+
 #ifdef VK_EXT_debug_utils
     if (caps.debugUtils) {
         vkSetDebugUtilsObjectNameEXT = reinterpret_cast<PFN_vkSetDebugUtilsObjectNameEXT>(f->vkGetDeviceProcAddr(dev, "vkSetDebugUtilsObjectNameEXT"));
@@ -942,6 +952,11 @@ void QRhiVulkan::destroy()
         timestampQueryPool = VK_NULL_HANDLE;
     }
 
+    if (passTimestampQueryPool) {
+        df->vkDestroyQueryPool(dev, passTimestampQueryPool, nullptr);
+        passTimestampQueryPool = VK_NULL_HANDLE;
+    }
+
     if (!importedAllocator && allocator) {
         vmaDestroyAllocator(toVmaAllocator(allocator));
         allocator = nullptr;
@@ -2144,6 +2159,46 @@ double QRhiVulkan::elapsedSecondsFromTimestamp(quint64 timestamp[2], bool *ok)
     return 0;
 }
 
+void QRhiVulkan::enqueuePassTimestampBegin(QVkCommandBuffer *cbD, const QByteArray &name)
+{
+    // Per-pass timestamps are only collected for swapchain-based frames, like
+    // the whole-frame timestamp.
+    if (passTimestampQueryPool == VK_NULL_HANDLE || !currentSwapChain)
+        return;
+
+    PassTimestampSlot &pt(passTimestampSlots[currentFrameSlot]);
+    if (pt.count == 0)
+        pt.owner = currentSwapChain;
+    else if (pt.owner != currentSwapChain) // another swapchain holds this slot's queries
+        return;
+
+    if (pt.count >= QVK_MAX_PASS_TIMESTAMP_PAIRS)
+        return;
+
+    const int query = currentFrameSlot * QVK_MAX_PASS_TIMESTAMP_PAIRS * 2 + pt.count * 2;
+    pt.names[pt.count] = name;
+    pt.count += 1;
+    cbD->currentPassTimestampQuery = query;
+
+    QVkCommandBuffer::Command &cmd(cbD->commands.get());
+    cmd.cmd = QVkCommandBuffer::Command::WriteTimestamp;
+    cmd.args.writeTimestamp.stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    cmd.args.writeTimestamp.query = uint32_t(query);
+}
+
+void QRhiVulkan::enqueuePassTimestampEnd(QVkCommandBuffer *cbD)
+{
+    if (cbD->currentPassTimestampQuery < 0)
+        return;
+
+    QVkCommandBuffer::Command &cmd(cbD->commands.get());
+    cmd.cmd = QVkCommandBuffer::Command::WriteTimestamp;
+    cmd.args.writeTimestamp.stage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    cmd.args.writeTimestamp.query = uint32_t(cbD->currentPassTimestampQuery + 1);
+
+    cbD->currentPassTimestampQuery = -1;
+}
+
 QRhi::FrameOpResult QRhiVulkan::beginFrame(QRhiSwapChain *swapChain, QRhi::BeginFrameFlags)
 {
     QVkSwapChain *swapChainD = QRHI_RES(QVkSwapChain, swapChain);
@@ -2258,6 +2313,36 @@ QRhi::FrameOpResult QRhiVulkan::beginFrame(QRhiSwapChain *swapChain, QRhi::Begin
         }
     }
 
+    // Read back the per-pass timestamps from this slot's previous use, then
+    // reset the slot's query range for the new frame.
+    if (passTimestampQueryPool) {
+        PassTimestampSlot &pt(passTimestampSlots[currentFrameSlot]);
+        if (pt.count == 0 || pt.owner == swapChainD) {
+            const uint32_t base = uint32_t(currentFrameSlot * QVK_MAX_PASS_TIMESTAMP_PAIRS * 2);
+            swapChainD->cbWrapper.lastGpuPassTimings.clear();
+            if (pt.count > 0) {
+                QVarLengthArray<quint64, 32> results(pt.count * 2);
+                VkResult err = df->vkGetQueryPoolResults(dev, passTimestampQueryPool, base, uint32_t(pt.count * 2),
+                                                         size_t(pt.count) * 2 * sizeof(quint64), results.data(), sizeof(quint64),
+                                                         VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+                if (err == VK_SUCCESS) {
+                    for (int i = 0; i < pt.count; ++i) {
+                        quint64 timestamp[2] = { results[i * 2], results[i * 2 + 1] };
+                        bool ok = false;
+                        const double elapsedSec = elapsedSecondsFromTimestamp(timestamp, &ok);
+                        if (ok)
+                            swapChainD->cbWrapper.lastGpuPassTimings.append({ pt.names[i], elapsedSec });
+                    }
+                } else {
+                    qWarning("Failed to query pass timestamps: %d", err);
+                }
+                pt.count = 0;
+                pt.owner = nullptr;
+            }
+            df->vkCmdResetQueryPool(frame.cmdBuf, passTimestampQueryPool, base, QVK_MAX_PASS_TIMESTAMP_PAIRS * 2);
+        }
+    }
+
     return QRhi::FrameOpSuccess;
 }
 
@@ -2859,6 +2944,8 @@ void QRhiVulkan::beginPass(QRhiCommandBuffer *cb,
     }
     rpBeginInfo.clearValueCount = uint32_t(cvs.size());
 
+    enqueuePassTimestampBegin(cbD, rt->name());
+
     QVkCommandBuffer::Command &cmd(cbD->commands.get());
     cmd.cmd = QVkCommandBuffer::Command::BeginRenderPass;
     cmd.args.beginRenderPass.desc = rpBeginInfo;
@@ -2886,6 +2973,8 @@ void QRhiVulkan::endPass(QRhiCommandBuffer *cb, QRhiResourceUpdateBatch *resourc
     QVkCommandBuffer::Command &cmd(cbD->commands.get());
     cmd.cmd = QVkCommandBuffer::Command::EndRenderPass;
 
+    enqueuePassTimestampEnd(cbD);
+
     cbD->recordingPass = QVkCommandBuffer::NoPass;
     cbD->currentTarget = nullptr;
 
@@ -2910,6 +2999,8 @@ void QRhiVulkan::beginComputePass(QRhiCommandBuffer *cb,
 
     cbD->computePassState.reset();
 
+    enqueuePassTimestampBegin(cbD, QByteArrayLiteral("compute"));
+
     if (cbD->passUsesSecondaryCb)
         cbD->activeSecondaryCbStack.append(startSecondaryCommandBuffer());
 
@@ -2927,6 +3018,8 @@ void QRhiVulkan::endComputePass(QRhiCommandBuffer *cb, QRhiResourceUpdateBatch *
         endAndEnqueueSecondaryCommandBuffer(secondaryCb, cbD);
     }
 
+    enqueuePassTimestampEnd(cbD);
+
     cbD->recordingPass = QVkCommandBuffer::NoPass;
 
     if (resourceUpdates)
@@ -4419,6 +4512,10 @@ void QRhiVulkan::recordPrimaryCommandBuffer(QVkCommandBuffer *cbD)
         case QVkCommandBuffer::Command::ExecuteSecondary:
             df->vkCmdExecuteCommands(cbD->cb, 1, &cmd.args.executeSecondary.cb);
             break;
+        case QVkCommandBuffer::Command::WriteTimestamp:
+            df->vkCmdWriteTimestamp(cbD->cb, cmd.args.writeTimestamp.stage,
+                                    passTimestampQueryPool, cmd.args.writeTimestamp.query);
+            break;
         default:
             break;
         }
@@ -4824,6 +4921,8 @@ bool QRhiVulkan::isFeatureSupported(QRhi::Feature feature) const
         return true;
     case QRhi::ResolveDepthStencil:
         return caps.renderPass2KHR && caps.depthStencilResolveKHR;
+    case QRhi::PerPassTimestamps:
+        return timestampValidBits != 0;
     default:
         Q_UNREACHABLE_RETURN(false);
     }
@@ -5707,6 +5806,12 @@ void QRhiVulkan::endExternal(QRhiCommandBuffer *cb)
     cbD->resetCachedState();
 }
 
+QList<QRhiCommandBuffer::GpuPassTiming> QRhiVulkan::lastCompletedGpuPassTimings(QRhiCommandBuffer *cb)
+{
+    QVkCommandBuffer *cbD = QRHI_RES(QVkCommandBuffer, cb);
+    return cbD->lastGpuPassTimings;
+}
+
 double QRhiVulkan::lastCompletedGpuTime(QRhiCommandBuffer *cb)
 {
     QVkCommandBuffer *cbD = QRHI_RES(QVkCommandBuffer, cb);
@@ -32,6 +32,8 @@ static const int QVK_STORAGE_IMAGES_PER_POOL = 128;
 
 static const int QVK_MAX_ACTIVE_TIMESTAMP_PAIRS = 16;
 
+static const int QVK_MAX_PASS_TIMESTAMP_PAIRS = 64;
+
 // no vk_mem_alloc.h available here, void* is good enough
 typedef void * QVkAlloc;
 typedef void * QVkAllocator;
@@ -329,6 +331,7 @@ struct QVkCommandBuffer : public QRhiCommandBuffer
         recordingPass = NoPass;
         passUsesSecondaryCb = false;
         lastGpuTime = 0;
+        currentPassTimestampQuery = -1;
         currentTarget = nullptr;
         activeSecondaryCbStack.clear();
         resetCommands();
@@ -354,6 +357,8 @@ struct QVkCommandBuffer : public QRhiCommandBuffer
     PassType recordingPass;
     bool passUsesSecondaryCb;
     double lastGpuTime = 0;
+    QList<QRhiCommandBuffer::GpuPassTiming> lastGpuPassTimings;
+    int currentPassTimestampQuery = -1;
     QRhiRenderTarget *currentTarget;
     QRhiGraphicsPipeline *currentGraphicsPipeline;
     QRhiComputePipeline *currentComputePipeline;
@@ -404,7 +409,8 @@ struct QVkCommandBuffer : public QRhiCommandBuffer
             DebugMarkerInsert,
             TransitionPassResources,
             Dispatch,
-            ExecuteSecondary
+            ExecuteSecondary,
+            WriteTimestamp
         };
         Cmd cmd;
 
@@ -531,6 +537,10 @@ struct QVkCommandBuffer : public QRhiCommandBuffer
             struct {
                 VkCommandBuffer cb;
             } executeSecondary;
+            struct {
+                VkPipelineStageFlagBits stage;
+                uint32_t query;
+            } writeTimestamp;
         } args;
     };
 
@@ -736,6 +746,7 @@ public:
     void beginExternal(QRhiCommandBuffer *cb) override;
     void endExternal(QRhiCommandBuffer *cb) override;
     double lastCompletedGpuTime(QRhiCommandBuffer *cb) override;
+    QList<QRhiCommandBuffer::GpuPassTiming> lastCompletedGpuPassTimings(QRhiCommandBuffer *cb) override;
 
     QList<int> supportedSampleCounts() const override;
     int ubufAlignment() const override;
@@ -830,6 +841,8 @@ public:
     void updateShaderResourceBindings(QRhiShaderResourceBindings *srb, int descSetIdx = -1);
     void ensureCommandPoolForNewFrame();
     double elapsedSecondsFromTimestamp(quint64 timestamp[2], bool *ok);
+    void enqueuePassTimestampBegin(QVkCommandBuffer *cbD, const QByteArray &name);
+    void enqueuePassTimestampEnd(QVkCommandBuffer *cbD);
     void printExtraErrorInfo(VkResult err);
 
     QVulkanInstance *inst = nullptr;
@@ -916,6 +929,13 @@ public:
     VkQueryPool timestampQueryPool = VK_NULL_HANDLE;
     QBitArray timestampQueryPoolMap;
 
+    VkQueryPool passTimestampQueryPool = VK_NULL_HANDLE;
+    struct PassTimestampSlot {
+        int count = 0;
+        void *owner = nullptr; // the QVkSwapChain the recorded queries belong to
+        QByteArray names[QVK_MAX_PASS_TIMESTAMP_PAIRS];
+    } passTimestampSlots[QVK_FRAMES_IN_FLIGHT];
+
     VkFormat optimalDsFormat = VK_FORMAT_UNDEFINED;
     QMatrix4x4 clipCorrectMatrix;
 
@@ -2005,7 +2005,25 @@ void StyleSheet::buildIndexes(Qt::CaseSensitivity nameCaseSensitivity)
                     name = std::move(name).toLower();
                 nameIndex.insert(name, nr);
             } else {
-                universalsSelectors += selector;
+                // bucket by class selector (".foo"), like the id and name buckets above
+                int classSelector = -1;
+                for (int k = 0; k < sel.attributeSelectors.size(); ++k) {
+                    const AttributeSelector &a = sel.attributeSelectors.at(k);
+                    if (a.name == "class"_L1
+                        && a.valueMatchCriterium == AttributeSelector::MatchIncludes) {
+                        classSelector = k;
+                        break;
+                    }
+                }
+                if (classSelector != -1) {
+                    StyleRule nr;
+                    nr.selectors += selector;
+                    nr.declarations = rule.declarations;
+                    nr.order = i;
+                    classIndex.insert(sel.attributeSelectors.at(classSelector).value, nr);
+                } else {
+                    universalsSelectors += selector;
+                }
             }
         }
         if (!universalsSelectors.isEmpty()) {
@@ -2035,6 +2053,16 @@ QStringList StyleSelector::nodeIds(NodePtr node) const
     return QStringList(attributeValue(node, QCss::AttributeSelector{"id"_L1, {}, AttributeSelector::NoMatch}));
 }
 
+QStringList StyleSelector::nodeClasses(NodePtr node) const
+{
+    if (!hasAttributes(node))
+        return QStringList();
+    // the "class" attribute holds a space separated list, matching the
+    // MatchIncludes semantics used by class selectors
+    const QString value = attributeValue(node, QCss::AttributeSelector{"class"_L1, {}, AttributeSelector::NoMatch});
+    return value.split(u' ', Qt::SkipEmptyParts);
+}
+
 bool StyleSelector::selectorMatches(const Selector &selector, NodePtr node)
 {
     if (selector.basicSelectors.isEmpty())
@@ -2222,6 +2250,17 @@ QList<StyleRule> StyleSelector::styleRulesForNode(NodePtr node)
                 }
             }
         }
+        if (!styleSheet.classIndex.isEmpty()) {
+            const QStringList classes = nodeClasses(node);
+            for (int i = 0; i < classes.size(); i++) {
+                const QString &key = classes.at(i);
+                QMultiHash<QString, StyleRule>::const_iterator it = styleSheet.classIndex.constFind(key);
+                while (it != styleSheet.classIndex.constEnd() && it.key() == key) {
+                    matchRule(node, it.value(), styleSheet.origin, styleSheet.depth, &weightedRules);
+                    ++it;
+                }
+            }
+        }
         if (!medium.isEmpty()) {
             for (int i = 0; i < styleSheet.mediaRules.size(); ++i) {
                 if (styleSheet.mediaRules.at(i).media.contains(medium, Qt::CaseInsensitive)) {
@@ -626,6 +626,7 @@ struct StyleSheet
     int depth; // applicable only for inline style sheets
     QMultiHash<QString, StyleRule> nameIndex;
     QMultiHash<QString, StyleRule> idIndex;
+    QMultiHash<QString, StyleRule> classIndex;
 
     Q_GUI_EXPORT void buildIndexes(Qt::CaseSensitivity nameCaseSensitivity = Qt::CaseSensitive);
 };
@@ -650,6 +651,7 @@ public:
     virtual QString attributeValue(NodePtr node, const QCss::AttributeSelector &aSelector) const = 0;
     virtual bool hasAttributes(NodePtr node) const = 0;
     virtual QStringList nodeIds(NodePtr node) const;
+    QStringList nodeClasses(NodePtr node) const;
     virtual QStringList nodeNames(NodePtr node) const = 0;
     virtual bool isNullNode(NodePtr node) const = 0;
     virtual NodePtr parentNode(NodePtr node) const = 0;
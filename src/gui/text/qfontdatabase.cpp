@@ -20,6 +20,7 @@
 
 #include <QtCore/qcache.h>
 #include <QtCore/qmath.h>
+#include <QtCore/private/qstartupprofiler_p.h>
 
 #include <stdlib.h>
 #include <algorithm>
@@ -1325,6 +1326,8 @@ QFontDatabasePrivate *QFontDatabasePrivate::ensureFontDatabase()
 {
     auto *d = QFontDatabasePrivate::instance();
     if (!d->populated) {
+        QStartupPhase startupPhase("QFontDatabasePrivate::ensureFontDatabase");
+
         // The font database may have been partially populated, but to ensure
         // we can answer queries for any platform- or user-provided family we
         // need to fully populate it now.
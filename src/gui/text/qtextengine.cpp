@@ -21,6 +21,7 @@
 #include "qrawfont_p.h"
 #include <qguiapplication.h>
 #include <qinputmethod.h>
+#include <QtCore/qcache.h>
 #include <algorithm>
 #include <stdlib.h>
 
@@ -1351,6 +1352,97 @@ static void applyVisibilityRules(ushort ucs, QGlyphLayout *glyphs, uint glyphPos
     }
 }
 
+#if QT_CONFIG(harfbuzz)
+namespace {
+
+struct ShapedRunCacheKey
+{
+    const QFontEngine *fontEngine;
+    QFontDef fontDef; // guards against a new engine reusing the address
+    QString text;
+    QFixed letterSpacing;
+    QFixed wordSpacing;
+    ushort script;
+    ushort flags;
+
+    enum Flag : ushort {
+        RightToLeft = 0x1,
+        Kerning = 0x2,
+        AbsoluteLetterSpacing = 0x4,
+        DesignMetrics = 0x8
+    };
+
+    friend bool operator==(const ShapedRunCacheKey &lhs, const ShapedRunCacheKey &rhs)
+    {
+        return lhs.fontEngine == rhs.fontEngine
+                && lhs.script == rhs.script
+                && lhs.flags == rhs.flags
+                && lhs.letterSpacing == rhs.letterSpacing
+                && lhs.wordSpacing == rhs.wordSpacing
+                && lhs.text == rhs.text
+                && lhs.fontDef == rhs.fontDef;
+    }
+    friend size_t qHash(const ShapedRunCacheKey &key, size_t seed) noexcept
+    {
+        return qHashMulti(seed, key.fontEngine, key.text, key.script, key.flags,
+                          key.letterSpacing.value(), key.wordSpacing.value());
+    }
+};
+
+struct ShapedRunCacheEntry
+{
+    QList<glyph_t> glyphs;
+    QList<QFixed> advances;
+    QList<QFixedPoint> offsets;
+    QList<QGlyphAttributes> attributes;
+    QList<QGlyphJustification> justifications;
+    QList<ushort> logClusters;
+    QFixed width;
+    QFixed ascent;
+    QFixed descent;
+    QFixed leading;
+};
+
+// Layouts keep re-shaping the same short strings (item views and styled
+// widgets redraw identical labels every frame), and the HarfBuzz pass
+// dominates layout time. Cache the finished runs per thread; font engines
+// are owned by the thread-local QFontCache, so entries must not cross
+// threads anyway.
+struct ShapedRunCache : QCache<ShapedRunCacheKey, ShapedRunCacheEntry>
+{
+    static constexpr int MaxTextLength = 64;
+
+    ShapedRunCache() : QCache(maxGlyphs()) { }
+
+    // cost is counted in glyphs + characters; override to tune, 0 disables
+    static int maxGlyphs()
+    {
+        static const int size = qEnvironmentVariableIsSet("QT_TEXT_SHAPING_CACHE_SIZE")
+                ? qEnvironmentVariableIntValue("QT_TEXT_SHAPING_CACHE_SIZE")
+                : 16384;
+        return size;
+    }
+
+    quint64 hits = 0;
+    quint64 misses = 0;
+};
+
+} // unnamed namespace
+
+static thread_local ShapedRunCache qt_shapedRunCache;
+
+// exported for autotests and for tuning the cache capacity
+Q_AUTOTEST_EXPORT quint64 qt_shapedRunCacheHits()
+{
+    return qt_shapedRunCache.hits;
+}
+
+Q_AUTOTEST_EXPORT quint64 qt_shapedRunCacheMisses()
+{
+    return qt_shapedRunCache.misses;
+}
+#endif // harfbuzz
+
 void QTextEngine::shapeText(int item) const
 {
     Q_ASSERT(item < layoutData->items.size());
@@ -1434,6 +1526,52 @@ void QTextEngine::shapeText(int item) const
             letterSpacing *= font.d->dpi / qt_defaultDpiY();
     }
 
+#if QT_CONFIG(harfbuzz)
+    // Custom font features are rare and would blow up the key, and long runs
+    // flush more of the cache than a hit on them could save.
+    const bool cacheable = shapingEnabled
+            && itemLength <= ShapedRunCache::MaxTextLength
+            && features.isEmpty()
+            && ShapedRunCache::maxGlyphs() > 0;
+    ShapedRunCacheKey cacheKey;
+    if (cacheable) {
+        ushort keyFlags = 0;
+        if (si.analysis.bidiLevel & 1)
+            keyFlags |= ShapedRunCacheKey::RightToLeft;
+        if (kerningEnabled)
+            keyFlags |= ShapedRunCacheKey::Kerning;
+        if (letterSpacingIsAbsolute)
+            keyFlags |= ShapedRunCacheKey::AbsoluteLetterSpacing;
+        if (option.useDesignMetrics())
+            keyFlags |= ShapedRunCacheKey::DesignMetrics;
+        cacheKey = { fontEngine, fontEngine->fontDef,
+                     QString(reinterpret_cast<const QChar *>(string), itemLength),
+                     letterSpacing, wordSpacing,
+                     ushort(si.analysis.script), keyFlags };
+        if (const ShapedRunCacheEntry *entry = qt_shapedRunCache.object(cacheKey)) {
+            const int numGlyphs = entry->glyphs.size();
+            if (Q_LIKELY(ensureSpace(numGlyphs))) {
+                ++qt_shapedRunCache.hits;
+                si.num_glyphs = numGlyphs;
+                QGlyphLayout g = availableGlyphs(&si);
+                memcpy(g.glyphs, entry->glyphs.constData(), numGlyphs * sizeof(glyph_t));
+                memcpy(g.advances, entry->advances.constData(), numGlyphs * sizeof(QFixed));
+                memcpy(g.offsets, entry->offsets.constData(), numGlyphs * sizeof(QFixedPoint));
+                memcpy(g.attributes, entry->attributes.constData(), numGlyphs * sizeof(QGlyphAttributes));
+                memcpy(g.justifications, entry->justifications.constData(), numGlyphs * sizeof(QGlyphJustification));
+                memcpy(logClusters(&si), entry->logClusters.constData(), itemLength * sizeof(ushort));
+                layoutData->used += numGlyphs;
+                si.width = entry->width;
+                si.ascent = entry->ascent;
+                si.descent = entry->descent;
+                si.leading = entry->leading;
+                return;
+            }
+        }
+        ++qt_shapedRunCache.misses;
+    }
+#endif
+
     // split up the item into parts that come from different font engines
     // k * 3 entries, array[k] == index in string, array[k + 1] == index in glyphs, array[k + 2] == engine index
     QVarLengthArray<uint, 24> itemBoundaries;
@@ -1584,6 +1722,30 @@ void QTextEngine::shapeText(int item) const
 
     for (int i = 0; i < si.num_glyphs; ++i)
         si.width += glyphs.advances[i] * !glyphs.attributes[i].dontPrint;
+
+#if QT_CONFIG(harfbuzz)
+    if (cacheable) {
+        auto entry = std::make_unique<ShapedRunCacheEntry>();
+        const int numGlyphs = si.num_glyphs;
+        entry->glyphs.resize(numGlyphs);
+        memcpy(entry->glyphs.data(), glyphs.glyphs, numGlyphs * sizeof(glyph_t));
+        entry->advances.resize(numGlyphs);
+        memcpy(entry->advances.data(), glyphs.advances, numGlyphs * sizeof(QFixed));
+        entry->offsets.resize(numGlyphs);
+        memcpy(entry->offsets.data(), glyphs.offsets, numGlyphs * sizeof(QFixedPoint));
+        entry->attributes.resize(numGlyphs);
+        memcpy(entry->attributes.data(), glyphs.attributes, numGlyphs * sizeof(QGlyphAttributes));
+        entry->justifications.resize(numGlyphs);
+        memcpy(entry->justifications.data(), glyphs.justifications, numGlyphs * sizeof(QGlyphJustification));
+        entry->logClusters.resize(itemLength);
+        memcpy(entry->logClusters.data(), logClusters(&si), itemLength * sizeof(ushort));
+        entry->width = si.width;
+        entry->ascent = si.ascent;
+        entry->descent = si.descent;
+        entry->leading = si.leading;
+        qt_shapedRunCache.insert(cacheKey, entry.release(), numGlyphs + itemLength);
+    }
+#endif
 }
 
 #if QT_CONFIG(harfbuzz)
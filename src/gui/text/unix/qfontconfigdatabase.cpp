@@ -544,6 +544,76 @@ static void populateFromPattern(FcPattern *pattern,
 
 }
 
+// Registers only the family names (including aliases and subfamilies)
+// carried by \a pattern; the styles and writing systems are filled in by
+// populateFromPattern() once the family is actually used.
+static void registerFamiliesFromPattern(FcPattern *pattern)
+{
+    FcChar8 *value = nullptr;
+    if (FcPatternGetString(pattern, FC_FAMILY, 0, &value) != FcResultMatch)
+        return;
+
+    const QString familyName = QString::fromUtf8((const char *)value);
+    QPlatformFontDatabase::registerFontFamily(familyName);
+
+    QString familyNameLang;
+    if (FcPatternGetString(pattern, FC_FAMILYLANG, 0, &value) == FcResultMatch)
+        familyNameLang = QString::fromUtf8((const char *)value);
+
+    QString styleName;
+    if (FcPatternGetString(pattern, FC_STYLE, 0, &value) == FcResultMatch)
+        styleName = QString::fromUtf8((const char *)value);
+
+    for (int k = 1; FcPatternGetString(pattern, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
+        const QString altFamilyName = QString::fromUtf8((const char *)value);
+
+        QString altStyleName;
+        if (FcPatternGetString(pattern, FC_STYLE, k, &value) == FcResultMatch)
+            altStyleName = QString::fromUtf8((const char *)value);
+        else
+            altStyleName = styleName;
+
+        QString altFamilyNameLang;
+        if (FcPatternGetString(pattern, FC_FAMILYLANG, k, &value) == FcResultMatch)
+            altFamilyNameLang = QString::fromUtf8((const char *)value);
+        else
+            altFamilyNameLang = familyNameLang;
+
+        // same classification as populateFromPattern(): an extra name in the
+        // same language with its own style is a subfamily, anything else an alias
+        if (familyNameLang == altFamilyNameLang && altStyleName != styleName)
+            QPlatformFontDatabase::registerFontFamily(altFamilyName);
+        else
+            QPlatformFontDatabase::registerAliasToFontFamily(familyName, altFamilyName);
+    }
+}
+
+// Lists the installed fonts matching \a pattern with all the properties
+// populateFromPattern() consumes.
+static FcFontSet *qt_fontSetForPattern(FcPattern *pattern)
+{
+    FcObjectSet *os = FcObjectSetCreate();
+    const char *properties [] = {
+        FC_FAMILY, FC_STYLE, FC_WEIGHT, FC_SLANT,
+        FC_SPACING, FC_FILE, FC_INDEX,
+        FC_LANG, FC_CHARSET, FC_FOUNDRY, FC_SCALABLE, FC_PIXEL_SIZE,
+        FC_WIDTH, FC_FAMILYLANG,
+#if FC_VERSION >= 20297
+        FC_CAPABILITY,
+#endif
+        (const char *)nullptr
+    };
+    const char **p = properties;
+    while (*p) {
+        FcObjectSetAdd(os, *p);
+        ++p;
+    }
+
+    FcFontSet *fonts = FcFontList(nullptr, pattern, os);
+    FcObjectSetDestroy(os);
+    return fonts;
+}
+
 static bool isDprScaling()
 {
     return !qFuzzyCompare(qApp->devicePixelRatio(), 1.0);
@@ -560,16 +630,13 @@ void QFontconfigDatabase::populateFontDatabase()
     FcFontSet  *fonts;
 
     {
+        // Only fetch the family names here; resolving the full properties
+        // (notably the language set) for every installed font is what makes
+        // a cold start expensive, so that is deferred to populateFamily().
         FcObjectSet *os = FcObjectSetCreate();
         FcPattern *pattern = FcPatternCreate();
         const char *properties [] = {
-            FC_FAMILY, FC_STYLE, FC_WEIGHT, FC_SLANT,
-            FC_SPACING, FC_FILE, FC_INDEX,
-            FC_LANG, FC_CHARSET, FC_FOUNDRY, FC_SCALABLE, FC_PIXEL_SIZE,
-            FC_WIDTH, FC_FAMILYLANG,
-#if FC_VERSION >= 20297
-            FC_CAPABILITY,
-#endif
+            FC_FAMILY, FC_STYLE, FC_FAMILYLANG,
             (const char *)nullptr
         };
         const char **p = properties;
@@ -591,7 +658,7 @@ void QFontconfigDatabase::populateFontDatabase()
     }
 
     for (int i = 0; i < fonts->nfont; i++)
-        populateFromPattern(fonts->fonts[i]);
+        registerFamiliesFromPattern(fonts->fonts[i]);
 
     FcFontSetDestroy (fonts);
 
@@ -628,10 +695,68 @@ void QFontconfigDatabase::populateFontDatabase()
 //    QApplication::setFont(font);
 }
 
+void QFontconfigDatabase::populateFamily(const QString &familyName)
+{
+    FcFontSet *fonts;
+
+    {
+        FcPattern *pattern = FcPatternCreate();
+        const QByteArray cs = familyName.toUtf8();
+        FcPatternAddString(pattern, FC_FAMILY, (const FcChar8 *)cs.constData());
+#ifdef FC_VARIABLE
+        /* Support the named instance of Variable Fonts. */
+        FcPatternAddBool(pattern, FC_VARIABLE, FcFalse);
+#endif
+        fonts = qt_fontSetForPattern(pattern);
+        FcPatternDestroy(pattern);
+        if (!fonts)
+            return;
+    }
+
+    for (int i = 0; i < fonts->nfont; i++)
+        populateFromPattern(fonts->fonts[i]);
+
+    FcFontSetDestroy(fonts);
+}
+
+bool QFontconfigDatabase::populateFamilyAliases(const QString &missingFamily)
+{
+    Q_UNUSED(missingFamily);
+
+    // The lazy scan registers the alias names fontconfig lists for each
+    // font, but names that only exist through substitution rules do not
+    // show up there. Fall back to a full population once so the alias
+    // tables are complete.
+    if (m_populatedAliases)
+        return false;
+
+    FcFontSet *fonts;
+
+    {
+        FcPattern *pattern = FcPatternCreate();
+#ifdef FC_VARIABLE
+        /* Support the named instance of Variable Fonts. */
+        FcPatternAddBool(pattern, FC_VARIABLE, FcFalse);
+#endif
+        fonts = qt_fontSetForPattern(pattern);
+        FcPatternDestroy(pattern);
+    }
+
+    if (fonts) {
+        for (int i = 0; i < fonts->nfont; i++)
+            populateFromPattern(fonts->fonts[i]);
+        FcFontSetDestroy(fonts);
+    }
+
+    m_populatedAliases = true;
+    return true;
+}
+
 void QFontconfigDatabase::invalidate()
 {
     // Clear app fonts.
     FcConfigAppFontClear(nullptr);
+    m_populatedAliases = false;
 }
 
 QFontEngineMulti *QFontconfigDatabase::fontEngineMulti(QFontEngine *fontEngine, QChar::Script script)
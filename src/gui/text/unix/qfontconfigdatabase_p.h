@@ -27,6 +27,8 @@ class Q_GUI_EXPORT QFontconfigDatabase : public QFreeTypeFontDatabase
 public:
     ~QFontconfigDatabase() override;
     void populateFontDatabase() override;
+    void populateFamily(const QString &familyName) override;
+    bool populateFamilyAliases(const QString &missingFamily) override;
     void invalidate() override;
     bool supportsVariableApplicationFonts() const override;
     QFontEngineMulti *fontEngineMulti(QFontEngine *fontEngine, QChar::Script script) override;
@@ -39,6 +41,8 @@ public:
 
 private:
     void setupFontEngine(QFontEngineFT *engine, const QFontDef &fontDef) const;
+
+    bool m_populatedAliases = false;
 };
 
 QT_END_NAMESPACE
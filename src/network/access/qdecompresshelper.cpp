@@ -5,6 +5,7 @@
 
 #include <QtCore/qiodevice.h>
 #include <QtCore/qcoreapplication.h>
+#include <QtCore/qthreadpool.h>
 
 #include <limits>
 #include <zlib.h>
@@ -84,11 +85,17 @@ QByteArrayList QDecompressHelper::acceptedEncoding()
 
 QDecompressHelper::~QDecompressHelper()
 {
-    clear();
+    {
+        QMutexLocker locker(&mutex);
+        while (workerActive)
+            workerIdle.wait(&mutex);
+    }
+    reset();
 }
 
 bool QDecompressHelper::setEncoding(QByteArrayView encoding)
 {
+    QMutexLocker locker(&mutex);
     Q_ASSERT(contentEncoding == QDecompressHelper::None);
     if (contentEncoding != QDecompressHelper::None) {
         qWarning("Encoding is already set.");
@@ -161,6 +168,7 @@ bool QDecompressHelper::setEncoding(ContentEncoding ce)
 */
 bool QDecompressHelper::isCountingBytes() const
 {
+    QMutexLocker locker(&mutex);
     return countDecompressed;
 }
 
@@ -179,6 +187,7 @@ bool QDecompressHelper::isCountingBytes() const
 */
 void QDecompressHelper::setCountingBytesEnabled(bool shouldCount)
 {
+    QMutexLocker locker(&mutex);
     // These are a best-effort check to ensure that no data has already been processed before this
     // gets enabled
     Q_ASSERT(compressedDataBuffer.byteAmount() == 0);
@@ -186,6 +195,28 @@ void QDecompressHelper::setCountingBytesEnabled(bool shouldCount)
     countDecompressed = shouldCount;
 }
 
+/*!
+    \internal
+
+    Enable or disable decompressing the data on a thread from
+    QThreadPool::globalInstance() based on \a enabled. When enabled, data
+    handed to feed() is inflated by a pool thread into an internal buffer of
+    at most \c MaxDecompressedDataBufferSize bytes, so large downloads no
+    longer spend their decompression time on the thread that delivers the
+    data. read() still works synchronously: if it outruns the worker it picks
+    up the remaining work itself.
+
+    \note Can only be called before contentEncoding is set and data
+    is fed to the object.
+*/
+void QDecompressHelper::setOffThreadDecompressionEnabled(bool enabled)
+{
+    QMutexLocker locker(&mutex);
+    Q_ASSERT(compressedDataBuffer.byteAmount() == 0);
+    Q_ASSERT(contentEncoding == None);
+    offThreadDecompression = enabled;
+}
+
 /*!
     \internal
 
@@ -201,6 +232,7 @@ void QDecompressHelper::setCountingBytesEnabled(bool shouldCount)
 */
 qint64 QDecompressHelper::uncompressedSize() const
 {
+    QMutexLocker locker(&mutex);
     Q_ASSERT(countDecompressed);
     // Use the 'totalUncompressedBytes' from the countHelper if it exceeds the amount of bytes
     // that we know about.
@@ -231,11 +263,20 @@ void QDecompressHelper::feed(const QByteArray &data)
 */
 void QDecompressHelper::feed(QByteArray &&data)
 {
+    QMutexLocker locker(&mutex);
+    if (offThreadDecompression) {
+        if (contentEncoding == None)
+            return; // the worker hit an error and reset us; the next read() reports it
+        totalCompressedBytes += data.size();
+        pendingInputBuffer.append(std::move(data));
+        scheduleDecompression();
+        return;
+    }
     Q_ASSERT(contentEncoding != None);
     totalCompressedBytes += data.size();
     compressedDataBuffer.append(std::move(data));
     if (!countInternal(compressedDataBuffer[compressedDataBuffer.bufferCount() - 1]))
-        clear(); // If our counting brother failed then so will we :|
+        reset(); // If our counting brother failed then so will we :|
 }
 
 /*!
@@ -244,11 +285,20 @@ void QDecompressHelper::feed(QByteArray &&data)
 */
 void QDecompressHelper::feed(const QByteDataBuffer &buffer)
 {
+    QMutexLocker locker(&mutex);
+    if (offThreadDecompression) {
+        if (contentEncoding == None)
+            return;
+        totalCompressedBytes += buffer.byteAmount();
+        pendingInputBuffer.append(buffer);
+        scheduleDecompression();
+        return;
+    }
     Q_ASSERT(contentEncoding != None);
     totalCompressedBytes += buffer.byteAmount();
     compressedDataBuffer.append(buffer);
     if (!countInternal(buffer))
-        clear(); // If our counting brother failed then so will we :|
+        reset(); // If our counting brother failed then so will we :|
 }
 
 /*!
@@ -257,12 +307,21 @@ void QDecompressHelper::feed(const QByteDataBuffer &buffer)
 */
 void QDecompressHelper::feed(QByteDataBuffer &&buffer)
 {
+    QMutexLocker locker(&mutex);
+    if (offThreadDecompression) {
+        if (contentEncoding == None)
+            return;
+        totalCompressedBytes += buffer.byteAmount();
+        pendingInputBuffer.append(std::move(buffer));
+        scheduleDecompression();
+        return;
+    }
     Q_ASSERT(contentEncoding != None);
     totalCompressedBytes += buffer.byteAmount();
     const QByteDataBuffer copy(buffer);
     compressedDataBuffer.append(std::move(buffer));
     if (!countInternal(copy))
-        clear(); // If our counting brother failed then so will we :|
+        reset(); // If our counting brother failed then so will we :|
 }
 
 /*!
@@ -340,15 +399,91 @@ bool QDecompressHelper::countInternal(const QByteDataBuffer &buffer)
     return true;
 }
 
+/*!
+    \internal
+    Moves the chunks that feed() has queued for the thread pool worker into
+    the compressed data buffer, counting them on the way if needed. Ran by
+    whoever gets to the data first: the worker, or a read() that outpaced it.
+*/
+bool QDecompressHelper::ingestPendingInput()
+{
+    while (!pendingInputBuffer.isEmpty()) {
+        compressedDataBuffer.append(pendingInputBuffer.read());
+        if (!countInternal(compressedDataBuffer[compressedDataBuffer.bufferCount() - 1])) {
+            reset(); // If our counting brother failed then so will we :|
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+    \internal
+    Starts the thread pool worker unless it is already running or there is
+    nothing useful for it to do (no queued input, and the decompressed data
+    buffer is either full or there is nothing left to inflate).
+*/
+void QDecompressHelper::scheduleDecompression()
+{
+    if (!offThreadDecompression || workerActive || contentEncoding == None)
+        return;
+    if (pendingInputBuffer.isEmpty()
+        && (!hasDataInternal()
+            || decompressedDataBuffer.byteAmount() >= MaxDecompressedDataBufferSize)) {
+        return;
+    }
+    workerActive = true;
+    QThreadPool::globalInstance()->start([this]() { decompressOffThread(); });
+}
+
+/*!
+    \internal
+    The thread pool worker: ingests queued input and inflates it into the
+    decompressed data buffer, one chunk at a time, until the buffer is full
+    or all received data has been handled. The mutex is dropped between
+    chunks so a concurrent read() never stalls behind a long backlog.
+*/
+void QDecompressHelper::decompressOffThread()
+{
+    QMutexLocker locker(&mutex);
+    while (contentEncoding != None) {
+        if (!pendingInputBuffer.isEmpty()) {
+            if (!ingestPendingInput())
+                break;
+        } else if (hasDataInternal()
+                   && decompressedDataBuffer.byteAmount() < MaxDecompressedDataBufferSize) {
+            const qsizetype toRead = 256 * 1024;
+            QByteArray buffer(toRead, Qt::Uninitialized);
+            qsizetype bytesRead = readInternal(buffer.data(), buffer.size());
+            if (bytesRead <= 0) // on error readInternal() has reset us already
+                break;
+            buffer.truncate(bytesRead);
+            decompressedDataBuffer.append(std::move(buffer));
+        } else {
+            break;
+        }
+        locker.unlock();
+        locker.relock();
+    }
+    workerActive = false;
+    workerIdle.wakeAll();
+}
+
 qsizetype QDecompressHelper::read(char *data, qsizetype maxSize)
 {
+    QMutexLocker locker(&mutex);
     if (maxSize <= 0)
         return 0;
 
-    if (!isValid())
+    if (contentEncoding == None)
+        return -1;
+
+    // If the worker hasn't gotten around to the most recent chunks yet then
+    // take them over; the caller wants the data now.
+    if (!pendingInputBuffer.isEmpty() && !ingestPendingInput())
         return -1;
 
-    if (!hasData())
+    if (!hasDataInternal() && decompressedDataBuffer.isEmpty())
         return 0;
 
     qsizetype cachedRead = 0;
@@ -362,6 +497,7 @@ qsizetype QDecompressHelper::read(char *data, qsizetype maxSize)
     if (bytesRead == -1)
         return -1;
     totalBytesRead += bytesRead + cachedRead;
+    scheduleDecompression(); // refill the buffer we just drained
     return bytesRead + cachedRead;
 }
 
@@ -397,7 +533,7 @@ qsizetype QDecompressHelper::readInternal(char *data, qsizetype maxSize)
         break;
     }
     if (bytesRead == -1)
-        clear();
+        reset();
 
     totalUncompressedBytes += bytesRead;
     if (isPotentialArchiveBomb()) {
@@ -419,6 +555,7 @@ qsizetype QDecompressHelper::readInternal(char *data, qsizetype maxSize)
 */
 void QDecompressHelper::setDecompressedSafetyCheckThreshold(qint64 threshold)
 {
+    QMutexLocker locker(&mutex);
     if (threshold == -1)
         threshold = std::numeric_limits<qint64>::max();
     archiveBombCheckThreshold = threshold;
@@ -469,6 +606,7 @@ bool QDecompressHelper::isPotentialArchiveBomb() const
 */
 bool QDecompressHelper::hasData() const
 {
+    QMutexLocker locker(&mutex);
     return hasDataInternal() || !decompressedDataBuffer.isEmpty();
 }
 
@@ -484,7 +622,7 @@ bool QDecompressHelper::hasDataInternal() const
 
 qint64 QDecompressHelper::encodedBytesAvailable() const
 {
-    return compressedDataBuffer.byteAmount();
+    return compressedDataBuffer.byteAmount() + pendingInputBuffer.byteAmount();
 }
 
 /*!
@@ -496,6 +634,7 @@ qint64 QDecompressHelper::encodedBytesAvailable() const
 */
 bool QDecompressHelper::isValid() const
 {
+    QMutexLocker locker(&mutex);
     return contentEncoding != None;
 }
 
@@ -507,10 +646,22 @@ bool QDecompressHelper::isValid() const
 */
 QString QDecompressHelper::errorString() const
 {
+    QMutexLocker locker(&mutex);
     return errorStr;
 }
 
 void QDecompressHelper::clear()
+{
+    QMutexLocker locker(&mutex);
+    reset();
+}
+
+/*!
+    \internal
+    Like clear(), but assumes the mutex is already held (or no longer
+    needed, as in the destructor).
+*/
+void QDecompressHelper::reset()
 {
     switch (contentEncoding) {
     case None:
@@ -545,7 +696,9 @@ void QDecompressHelper::clear()
 
     compressedDataBuffer.clear();
     decompressedDataBuffer.clear();
+    pendingInputBuffer.clear();
     decoderHasData = false;
+    offThreadDecompression = false;
 
     countDecompressed = false;
     countHelper.reset();
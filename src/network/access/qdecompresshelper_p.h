@@ -18,6 +18,9 @@
 #include <QtNetwork/private/qtnetworkglobal_p.h>
 #include <QtCore/private/qbytedata_p.h>
 
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
+
 #include <memory>
 
 QT_BEGIN_NAMESPACE
@@ -42,6 +45,8 @@ public:
     bool isCountingBytes() const;
     void setCountingBytesEnabled(bool shouldCount);
 
+    void setOffThreadDecompressionEnabled(bool enabled);
+
     qint64 uncompressedSize() const;
 
     bool hasData() const;
@@ -63,10 +68,16 @@ public:
     QString errorString() const;
 
 private:
+    void reset();
+
     bool isPotentialArchiveBomb() const;
     bool hasDataInternal() const;
     qsizetype readInternal(char *data, qsizetype maxSize);
 
+    bool ingestPendingInput();
+    void scheduleDecompression();
+    void decompressOffThread();
+
     bool countInternal();
     bool countInternal(const QByteArray &data);
     bool countInternal(const QByteDataBuffer &buffer);
@@ -80,9 +91,17 @@ private:
 
     QByteDataBuffer compressedDataBuffer;
     QByteDataBuffer decompressedDataBuffer;
+    // Chunks fed to us that the thread pool worker hasn't picked up yet:
+    QByteDataBuffer pendingInputBuffer;
     const qsizetype MaxDecompressedDataBufferSize = 10 * 1024 * 1024;
     bool decoderHasData = false;
 
+    // Guards all members; decompression may run on a thread pool thread.
+    mutable QMutex mutex;
+    QWaitCondition workerIdle;
+    bool offThreadDecompression = false;
+    bool workerActive = false;
+
     bool countDecompressed = false;
     std::unique_ptr<QDecompressHelper> countHelper;
 
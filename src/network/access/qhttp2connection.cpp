@@ -231,7 +231,7 @@ bool QHttp2Stream::sendRST_STREAM(quint32 errorCode)
     FrameWriter &frameWriter = connection->frameWriter;
     frameWriter.start(FrameType::RST_STREAM, FrameFlag::EMPTY, m_streamID);
     frameWriter.append(errorCode);
-    return frameWriter.write(*connection->getSocket());
+    return connection->enqueueFrame();
 }
 
 /*!
@@ -314,7 +314,6 @@ void QHttp2Stream::internalSendDATA()
     Q_ASSERT(m_uploadByteDevice);
     QHttp2Connection *connection = getConnection();
     Q_ASSERT(connection->maxFrameSize > frameHeaderSize);
-    QIODevice *socket = connection->getSocket();
 
     qCDebug(qHttp2ConnectionLog,
             "[%p] stream %u, about to write to socket, current session window size: %d, stream "
@@ -374,7 +373,7 @@ void QHttp2Stream::internalSendDATA()
             sentEND_STREAM = true;
             frameWriter.addFlag(FrameFlag::END_STREAM);
         }
-        if (!frameWriter.write(*socket)) {
+        if (!connection->enqueueFrame()) {
             qCDebug(qHttp2ConnectionLog, "[%p] stream %u, failed to write to socket", connection,
                     m_streamID);
             finishWithError(QNetworkReply::ProtocolFailure, "failed to write to socket"_L1);
@@ -402,7 +401,7 @@ void QHttp2Stream::internalSendDATA()
             // This can happen if we got a final readyRead to signify no more
             // data available, but we hadn't sent the END_STREAM flag yet.
             frameWriter.start(FrameType::DATA, FrameFlag::END_STREAM, streamID());
-            frameWriter.write(*socket);
+            connection->enqueueFrame();
         }
         finishSendDATA();
     } else if (isUploadBlocked()) {
@@ -475,7 +474,6 @@ bool QHttp2Stream::sendHEADERS(const HPack::HttpHeader &headers, bool endStream,
     qCDebug(qHttp2ConnectionLog, "[%p] stream %u, sending HEADERS frame with %u entries",
             connection, streamID(), uint(headers.size()));
 
-    QIODevice *socket = connection->getSocket();
     FrameWriter &frameWriter = connection->frameWriter;
 
     frameWriter.start(FrameType::HEADERS, FrameFlag::PRIORITY | FrameFlag::END_HEADERS, streamID());
@@ -495,7 +493,7 @@ bool QHttp2Stream::sendHEADERS(const HPack::HttpHeader &headers, bool endStream,
             return false;
     }
 
-    bool result = frameWriter.writeHEADERS(*socket, connection->maxFrameSize);
+    bool result = connection->enqueueHEADERS(connection->maxFrameSize);
     if (endStream)
         transitionState(StateTransition::CloseLocal);
 
@@ -924,6 +922,7 @@ QHttp2Connection::QHttp2Connection(QIODevice *socket) : QObject(socket)
     Q_ASSERT(socket);
     Q_ASSERT(socket->isOpen());
     Q_ASSERT(socket->openMode() & QIODevice::ReadWrite);
+    outboundBuffer.open(QIODevice::WriteOnly);
     // We don't make any connections directly because this is used in
     // in the http2 protocol handler, which is used by
     // QHttpNetworkConnectionChannel. Which in turn owns and deals with all the
@@ -982,7 +981,7 @@ bool QHttp2Connection::sendPing(QByteArrayView data)
     }
 
     frameWriter.append((uchar*)data.data(), (uchar*)data.end());
-    frameWriter.write(*getSocket());
+    enqueueFrame();
     return true;
 }
 
@@ -1120,6 +1119,9 @@ void QHttp2Connection::connectionError(Http2Error errorCode, const char *message
 
     m_goingAway = true;
     sendGOAWAY(errorCode);
+    // Flush right away - the error may have left no event-loop pass to come.
+    // m_goingAway guards against recursing here should this write fail too.
+    flushOutboundFrames();
     const auto error = qt_error(errorCode);
     auto messageView = QLatin1StringView(message);
 
@@ -1149,11 +1151,11 @@ bool QHttp2Connection::isInvalidStream(quint32 streamID) noexcept
 
 bool QHttp2Connection::sendClientPreface()
 {
-    QIODevice *socket = getSocket();
     // 3.5 HTTP/2 Connection Preface
-    const qint64 written = socket->write(Http2clientPreface, clientPrefaceLength);
+    const qint64 written = outboundBuffer.write(Http2clientPreface, clientPrefaceLength);
     if (written != clientPrefaceLength)
         return false;
+    scheduleOutboundFlush();
 
     if (!sendSETTINGS()) {
         qCWarning(qHttp2ConnectionLog, "[%p] Failed to send SETTINGS", this);
@@ -1175,14 +1177,13 @@ bool QHttp2Connection::sendServerPreface()
 
 bool QHttp2Connection::sendSETTINGS()
 {
-    QIODevice *socket = getSocket();
     // 6.5 SETTINGS
     frameWriter.setOutboundFrame(configurationToSettingsFrame(m_config));
     qCDebug(qHttp2ConnectionLog, "[%p] Sending SETTINGS frame, %d bytes", this,
             frameWriter.outboundFrame().payloadSize());
     Q_ASSERT(frameWriter.outboundFrame().payloadSize());
 
-    if (!frameWriter.write(*socket))
+    if (!enqueueFrame())
         return false;
 
     sessionReceiveWindowSize = maxSessionReceiveWindowSize;
@@ -1202,7 +1203,7 @@ bool QHttp2Connection::sendWINDOW_UPDATE(quint32 streamID, quint32 delta)
             streamID, delta);
     frameWriter.start(FrameType::WINDOW_UPDATE, FrameFlag::EMPTY, streamID);
     frameWriter.append(delta);
-    return frameWriter.write(*getSocket());
+    return enqueueFrame();
 }
 
 bool QHttp2Connection::sendGOAWAY(quint32 errorCode)
@@ -1211,13 +1212,57 @@ bool QHttp2Connection::sendGOAWAY(quint32 errorCode)
                       Http2PredefinedParameters::connectionStreamID);
     frameWriter.append(quint32(m_lastIncomingStreamID));
     frameWriter.append(errorCode);
-    return frameWriter.write(*getSocket());
+    return enqueueFrame();
 }
 
 bool QHttp2Connection::sendSETTINGS_ACK()
 {
     frameWriter.start(FrameType::SETTINGS, FrameFlag::ACK, Http2::connectionStreamID);
-    return frameWriter.write(*getSocket());
+    return enqueueFrame();
+}
+
+bool QHttp2Connection::enqueueFrame()
+{
+    if (!frameWriter.write(outboundBuffer))
+        return false;
+    scheduleOutboundFlush();
+    return true;
+}
+
+bool QHttp2Connection::enqueueHEADERS(quint32 sizeLimit)
+{
+    if (!frameWriter.writeHEADERS(outboundBuffer, sizeLimit))
+        return false;
+    scheduleOutboundFlush();
+    return true;
+}
+
+void QHttp2Connection::scheduleOutboundFlush()
+{
+    if (flushScheduled)
+        return;
+    flushScheduled = true;
+    QMetaObject::invokeMethod(this, &QHttp2Connection::flushOutboundFrames, Qt::QueuedConnection);
+}
+
+bool QHttp2Connection::flushOutboundFrames()
+{
+    flushScheduled = false;
+    if (outboundBuffer.buffer().isEmpty())
+        return true;
+
+    QIODevice *socket = getSocket();
+    const qint64 pendingSize = outboundBuffer.buffer().size();
+    qCDebug(qHttp2ConnectionLog, "[%p] flushing %lld bytes of buffered frames to the socket", this,
+            pendingSize);
+    const qint64 written = socket ? socket->write(outboundBuffer.buffer()) : -1;
+    outboundBuffer.close();
+    outboundBuffer.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    if (written != pendingSize) {
+        connectionError(INTERNAL_ERROR, "failed to write to socket");
+        return false;
+    }
+    return true;
 }
 
 void QHttp2Connection::handleDATA()
@@ -1485,7 +1530,7 @@ void QHttp2Connection::handlePING()
 
     frameWriter.start(FrameType::PING, FrameFlag::ACK, connectionStreamID);
     frameWriter.append(inboundFrame.dataBegin(), inboundFrame.dataBegin() + 8);
-    frameWriter.write(*getSocket());
+    enqueueFrame();
 }
 
 void QHttp2Connection::handleGOAWAY()
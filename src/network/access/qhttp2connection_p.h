@@ -17,6 +17,7 @@
 
 #include <private/qtnetworkglobal_p.h>
 
+#include <QtCore/qbuffer.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qhash.h>
 #include <QtCore/qvarlengtharray.h>
@@ -229,7 +230,12 @@ public:
         return nullptr;
     }
 
-    void close() { sendGOAWAY(Http2::HTTP2_NO_ERROR); }
+    void close()
+    {
+        sendGOAWAY(Http2::HTTP2_NO_ERROR);
+        // Flush right away - the caller may drop the connection after this.
+        flushOutboundFrames();
+    }
 
     bool isGoingAway() const noexcept { return m_goingAway; }
 
@@ -279,6 +285,11 @@ private:
     bool sendGOAWAY(quint32 errorCode);
     bool sendSETTINGS_ACK();
 
+    bool enqueueFrame();
+    bool enqueueHEADERS(quint32 sizeLimit);
+    void scheduleOutboundFlush();
+    bool flushOutboundFrames();
+
     void handleDATA();
     void handleHEADERS();
     void handlePRIORITY();
@@ -323,6 +334,12 @@ private:
     Http2::Frame inboundFrame;
     Http2::FrameWriter frameWriter;
 
+    // Outbound frames are serialized into this buffer and flushed to the
+    // socket once per event-loop pass, so that multiplexed streams produce
+    // one large write instead of a small write (and syscall) per frame.
+    QBuffer outboundBuffer;
+    bool flushScheduled = false;
+
     // Temporary storage to assemble HEADERS' block
     // from several CONTINUATION frames ...
     bool continuationExpected = false;
@@ -297,6 +297,7 @@ bool QHttp2ProtocolHandler::sendRequest()
                 // was negotiated, we send a client preface. connectToHostEncrypted
                 // though is not meant to send any data, it's just a 'preconnect'.
                 // Thus we return early:
+                m_channel->freshConnection = false;
                 return true;
             }
         } else {
@@ -333,6 +334,9 @@ bool QHttp2ProtocolHandler::sendRequest()
                                        requests.size());
     auto it = requests.begin();
     for (qint64 i = 0; i < streamsToUse; ++i) {
+        // streams opened after the first batch ride on an already negotiated
+        // connection and did not have to wait for the handshake
+        it->second->setConnectionWasReused(!m_channel->freshConnection);
         const qint32 newStreamID = createNewStream(*it);
         if (!newStreamID) {
             // TODO: actually we have to open a new connection.
@@ -360,6 +364,7 @@ bool QHttp2ProtocolHandler::sendRequest()
     }
 
     m_channel->state = QHttpNetworkConnectionChannel::IdleState;
+    m_channel->freshConnection = false;
 
     return true;
 }
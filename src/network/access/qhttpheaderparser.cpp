@@ -63,7 +63,8 @@ bool QHttpHeaderParser::parseHeaders(QByteArrayView header)
         if (!fieldNameCheck(name))
             return false;
         header = header.sliced(colon + 1);
-        QByteArray value;
+        QByteArrayView valueView; // the whole value, unless the field is folded
+        QByteArray value;         // materialized only for folded (multi-line) values
         qsizetype valueSpace = maxFieldSize - name.size() - 1;
         do {
             const qsizetype endLine = header.indexOf('\n');
@@ -74,15 +75,23 @@ bool QHttpHeaderParser::parseHeaders(QByteArrayView header)
                 return false;
             line = line.trimmed();
             if (!line.empty()) {
-                if (value.size())
+                if (valueView.empty() && value.isEmpty()) {
+                    valueView = line; // copied by append() below
+                } else {
+                    if (value.isEmpty())
+                        value = valueView.toByteArray();
                     value += ' ' + line;
-                else
-                    value = line.toByteArray();
+                }
             }
             header = header.sliced(endLine + 1);
         } while (hSpaceStart(header));
-        Q_ASSERT(name.size() + 1 + value.size() <= maxFieldSize);
-        result.append(name, value);
+        if (value.isEmpty()) {
+            Q_ASSERT(name.size() + 1 + valueView.size() <= maxFieldSize);
+            result.append(name, valueView);
+        } else {
+            Q_ASSERT(name.size() + 1 + value.size() <= maxFieldSize);
+            result.append(name, value);
+        }
     }
 
     fields = result;
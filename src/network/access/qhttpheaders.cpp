@@ -4,6 +4,7 @@
 #include "qhttpheaders.h"
 
 #include <private/qoffsetstringarray_p.h>
+#include <private/qtools_p.h>
 
 #include <QtCore/qcompare.h>
 #include <QtCore/qhash.h>
@@ -295,6 +296,36 @@ private:
         return headerNames.viewAt(i);
     }
 };
+
+// Compares 'lhs' case-insensitively against 'rhs', which must consist of
+// lower-case characters only (as all 'headerNames' entries do)
+constexpr int compareWithLowerCase(QByteArrayView lhs, QByteArrayView rhs) noexcept
+{
+    const qsizetype size = qMin(lhs.size(), rhs.size());
+    for (qsizetype i = 0; i < size; ++i) {
+        const int c = int(uchar(QtMiscUtils::toAsciiLower(lhs[i]))) - int(uchar(rhs[i]));
+        if (c != 0)
+            return c;
+    }
+    return lhs.size() == rhs.size() ? 0 : lhs.size() < rhs.size() ? -1 : 1;
+}
+
+struct ByIndirectHeaderNameCaseInsensitive
+{
+    constexpr bool operator()(quint8 lhs, QByteArrayView rhs) const noexcept
+    {
+        return compareWithLowerCase(rhs, map(lhs)) > 0;
+    }
+    constexpr bool operator()(QByteArrayView lhs, quint8 rhs) const noexcept
+    {
+        return compareWithLowerCase(lhs, map(rhs)) < 0;
+    }
+private:
+    static constexpr QByteArrayView map(quint8 i) noexcept
+    {
+        return headerNames.viewAt(i);
+    }
+};
 } // unnamed namespace
 
 // This index table contains the indexes of 'headerNames' entries (above) in alphabetical order.
@@ -700,6 +731,25 @@ struct HeaderName
 
     explicit HeaderName(QAnyStringView name)
     {
+        // Try to map the name to the enum without allocating a lower-cased
+        // copy first. This is the common case: the header parser hands us
+        // byte-based views, and almost all names in the wild are well-known.
+        const bool mapped = name.visit([this](auto name) {
+            using View = decltype(name);
+            if constexpr (std::is_same_v<View, QStringView>) {
+                return false; // rare; needs converting, take the allocating path
+            } else {
+                const QByteArrayView view(reinterpret_cast<const char *>(name.data()),
+                                          name.size());
+                if (const auto h = toWellKnownHeaderCaseInsensitive(view)) {
+                    data = *h;
+                    return true;
+                }
+                return false;
+            }
+        });
+        if (mapped)
+            return;
         auto nname = normalizedName(name);
         if (auto h = HeaderName::toWellKnownHeader(nname))
             data = *h;
@@ -721,6 +771,22 @@ struct HeaderName
         return std::nullopt;
     }
 
+    // As above, but compares case-insensitively so that the caller does not
+    // have to allocate a lower-cased copy of 'name' just for the lookup
+    static std::optional<QHttpHeaders::WellKnownHeader>
+    toWellKnownHeaderCaseInsensitive(QByteArrayView name) noexcept
+    {
+        auto indexesBegin = std::cbegin(orderedHeaderNameIndexes);
+        auto indexesEnd = std::cend(orderedHeaderNameIndexes);
+
+        auto result = std::lower_bound(indexesBegin, indexesEnd, name,
+                                       ByIndirectHeaderNameCaseInsensitive{});
+
+        if (result != indexesEnd && compareWithLowerCase(name, headerNames[*result]) == 0)
+            return static_cast<QHttpHeaders::WellKnownHeader>(*result);
+        return std::nullopt;
+    }
+
     QByteArrayView asView() const noexcept
     {
         return std::visit([](const auto &arg) -> QByteArrayView {
@@ -638,6 +638,8 @@ QHttpNetworkReply* QHttpNetworkConnectionPrivate::queueRequest(const QHttpNetwor
             highPriorityQueue.prepend(pair);
             break;
         case QHttpNetworkRequest::NormalPriority:
+            normalPriorityQueue.prepend(pair);
+            break;
         case QHttpNetworkRequest::LowPriority:
             lowPriorityQueue.prepend(pair);
             break;
@@ -679,6 +681,14 @@ void QHttpNetworkConnectionPrivate::fillHttp2Queue()
 
     highPriorityQueue.clear();
 
+    for (auto &pair : normalPriorityQueue) {
+        if (!pair.second->d_func()->requestIsPrepared)
+            prepareRequest(pair);
+        channels[0].h2RequestsToSend.insert(pair.first.priority(), pair);
+    }
+
+    normalPriorityQueue.clear();
+
     for (auto &pair : lowPriorityQueue) {
         if (!pair.second->d_func()->requestIsPrepared)
             prepareRequest(pair);
@@ -698,6 +708,8 @@ void QHttpNetworkConnectionPrivate::requeueRequest(const HttpMessagePair &pair)
         highPriorityQueue.prepend(pair);
         break;
     case QHttpNetworkRequest::NormalPriority:
+        normalPriorityQueue.prepend(pair);
+        break;
     case QHttpNetworkRequest::LowPriority:
         lowPriorityQueue.prepend(pair);
         break;
@@ -712,24 +724,46 @@ bool QHttpNetworkConnectionPrivate::dequeueRequest(QIODevice *socket)
     if (socket)
         i = indexOf(socket);
 
-    if (!highPriorityQueue.isEmpty()) {
-        // remove from queue before sendRequest! else we might pipeline the same request again
-        HttpMessagePair messagePair = highPriorityQueue.takeLast();
-        if (!messagePair.second->d_func()->requestIsPrepared)
-            prepareRequest(messagePair);
-        updateChannel(i, messagePair);
-        return true;
+    QList<HttpMessagePair> * const queues[] = { &highPriorityQueue, &normalPriorityQueue,
+                                                &lowPriorityQueue };
+
+    // Serve the highest-priority non-empty queue, but don't let a steady stream
+    // of higher-priority requests starve the lower priorities: after serving
+    // MaxPriorityDequeueStreak requests while lower-priority work was waiting,
+    // serve the lowest-priority non-empty queue once.
+    constexpr int MaxPriorityDequeueStreak = 8;
+
+    QList<HttpMessagePair> *chosen = nullptr;
+    bool skippedLowerPriority = false;
+    for (auto *queue : queues) {
+        if (queue->isEmpty())
+            continue;
+        if (!chosen)
+            chosen = queue;
+        else
+            skippedLowerPriority = true;
     }
+    if (!chosen)
+        return false;
 
-    if (!lowPriorityQueue.isEmpty()) {
-        // remove from queue before sendRequest! else we might pipeline the same request again
-        HttpMessagePair messagePair = lowPriorityQueue.takeLast();
-        if (!messagePair.second->d_func()->requestIsPrepared)
-            prepareRequest(messagePair);
-        updateChannel(i, messagePair);
-        return true;
+    if (!skippedLowerPriority) {
+        priorityDequeueStreak = 0;
+    } else if (++priorityDequeueStreak >= MaxPriorityDequeueStreak) {
+        priorityDequeueStreak = 0;
+        for (auto it = std::rbegin(queues); it != std::rend(queues); ++it) {
+            if (!(*it)->isEmpty()) {
+                chosen = *it;
+                break;
+            }
+        }
     }
-    return false;
+
+    // remove from queue before sendRequest! else we might pipeline the same request again
+    HttpMessagePair messagePair = chosen->takeLast();
+    if (!messagePair.second->d_func()->requestIsPrepared)
+        prepareRequest(messagePair);
+    updateChannel(i, messagePair);
+    return true;
 }
 
 void QHttpNetworkConnectionPrivate::updateChannel(int i, const HttpMessagePair &messagePair)
@@ -745,6 +779,8 @@ QHttpNetworkRequest QHttpNetworkConnectionPrivate::predictNextRequest() const
 {
     if (!highPriorityQueue.isEmpty())
         return highPriorityQueue.last().first;
+    if (!normalPriorityQueue.isEmpty())
+        return normalPriorityQueue.last().first;
     if (!lowPriorityQueue.isEmpty())
         return lowPriorityQueue.last().first;
     return QHttpNetworkRequest();
@@ -754,6 +790,8 @@ QHttpNetworkReply* QHttpNetworkConnectionPrivate::predictNextRequestsReply() con
 {
     if (!highPriorityQueue.isEmpty())
         return highPriorityQueue.last().second;
+    if (!normalPriorityQueue.isEmpty())
+        return normalPriorityQueue.last().second;
     if (!lowPriorityQueue.isEmpty())
         return lowPriorityQueue.last().second;
     return nullptr;
@@ -763,7 +801,7 @@ QHttpNetworkReply* QHttpNetworkConnectionPrivate::predictNextRequestsReply() con
 void QHttpNetworkConnectionPrivate::fillPipeline(QIODevice *socket)
 {
     // return fast if there is nothing to pipeline
-    if (highPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty())
+    if (highPriorityQueue.isEmpty() && normalPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty())
         return;
 
     int i = indexOf(socket);
@@ -821,6 +859,19 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QIODevice *socket)
             return;
         }
 
+        if (lengthBefore == channels[i].alreadyPipelinedRequests.size())
+            break; // did not process anything, now do the normal prio queue
+    }
+
+    while (!normalPriorityQueue.isEmpty()) {
+        lengthBefore = channels[i].alreadyPipelinedRequests.size();
+        fillPipeline(normalPriorityQueue, channels[i]);
+
+        if (channels[i].alreadyPipelinedRequests.size() >= defaultPipelineLength) {
+            channels[i].pipelineFlush();
+            return;
+        }
+
         if (lengthBefore == channels[i].alreadyPipelinedRequests.size())
             break; // did not process anything, now do the low prio queue
     }
@@ -1011,6 +1062,17 @@ void QHttpNetworkConnectionPrivate::removeReply(QHttpNetworkReply *reply)
             }
         }
     }
+    // remove from the normal priority queue
+    if (!normalPriorityQueue.isEmpty()) {
+        for (int j = normalPriorityQueue.size() - 1; j >= 0; --j) {
+            HttpMessagePair messagePair = normalPriorityQueue.at(j);
+            if (messagePair.second == reply) {
+                normalPriorityQueue.removeAt(j);
+                QMetaObject::invokeMethod(q, "_q_startNextRequest", Qt::QueuedConnection);
+                return;
+            }
+        }
+    }
     // remove from the low priority queue
     if (!lowPriorityQueue.isEmpty()) {
         for (int j = lowPriorityQueue.size() - 1; j >= 0; --j) {
@@ -1061,8 +1123,10 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
     switch (connectionType) {
     case QHttpNetworkConnection::ConnectionTypeHTTP: {
         // return fast if there is nothing to do
-        if (highPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty())
+        if (highPriorityQueue.isEmpty() && normalPriorityQueue.isEmpty()
+            && lowPriorityQueue.isEmpty()) {
             return;
+        }
 
         // try to get a free AND connected socket
         for (int i = 0; i < activeChannelCount; ++i) {
@@ -1080,7 +1144,8 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
     case QHttpNetworkConnection::ConnectionTypeHTTP2Direct:
     case QHttpNetworkConnection::ConnectionTypeHTTP2: {
         if (channels[0].h2RequestsToSend.isEmpty() && !channels[0].reply
-            && highPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty()) {
+            && highPriorityQueue.isEmpty() && normalPriorityQueue.isEmpty()
+            && lowPriorityQueue.isEmpty()) {
             return;
         }
 
@@ -1115,7 +1180,7 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
     // on the connected sockets
     //tryToFillPipeline(socket);
     // return fast if there is nothing to pipeline
-    if (highPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty())
+    if (highPriorityQueue.isEmpty() && normalPriorityQueue.isEmpty() && lowPriorityQueue.isEmpty())
         return;
     for (int i = 0; i < activeChannelCount; i++) {
         if (channels[i].socket
@@ -1128,7 +1193,8 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
     // If there is not already any connected channels we need to connect a new one.
     // We do not pair the channel with the request until we know if it is
     // connected or not. This is to reuse connected channels before we connect new once.
-    int queuedRequests = highPriorityQueue.size() + lowPriorityQueue.size();
+    int queuedRequests =
+            highPriorityQueue.size() + normalPriorityQueue.size() + lowPriorityQueue.size();
 
     // in case we have in-flight preconnect requests and normal requests,
     // we only need one socket for each (preconnect, normal request) pair
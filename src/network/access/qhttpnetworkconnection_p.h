@@ -239,8 +239,12 @@ public:
 
     //The request queues
     QList<HttpMessagePair> highPriorityQueue;
+    QList<HttpMessagePair> normalPriorityQueue;
     QList<HttpMessagePair> lowPriorityQueue;
 
+    // starvation avoidance, see dequeueRequest()
+    int priorityDequeueStreak = 0;
+
     int preConnectRequests = 0;
 
     QHttpNetworkConnection::ConnectionType connectionType;
@@ -316,6 +316,7 @@ bool QHttpNetworkConnectionChannel::ensureConnection()
         // connect to the host if not already connected.
         state = QHttpNetworkConnectionChannel::ConnectingState;
         pendingEncrypt = ssl;
+        freshConnection = true;
 
         // reset state
         pipeliningSupported = PipeliningSupportUnknown;
@@ -514,6 +515,9 @@ void QHttpNetworkConnectionChannel::allDone()
     // in case of failures, each channel will attempt two reconnects before emitting error.
     reconnectAttempts = reconnectAttemptsDefault;
 
+    // the handshake has paid off; further requests on this channel reuse the connection
+    freshConnection = false;
+
     // now the channel can be seen as free/idle again, all signal emissions for the reply have been done
     if (state != QHttpNetworkConnectionChannel::ClosingState)
         state = QHttpNetworkConnectionChannel::IdleState;
@@ -1134,6 +1138,7 @@ void QHttpNetworkConnectionChannel::_q_error(QAbstractSocket::SocketError socket
                 protocolHandler->setReply(nullptr);
         }
     } while (!connection->d_func()->highPriorityQueue.isEmpty()
+             || !connection->d_func()->normalPriorityQueue.isEmpty()
              || !connection->d_func()->lowPriorityQueue.isEmpty());
 
     if (connection->connectionType() == QHttpNetworkConnection::ConnectionTypeHTTP2
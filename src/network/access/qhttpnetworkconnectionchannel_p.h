@@ -95,6 +95,10 @@ public:
     std::unique_ptr<QAbstractProtocolHandler> protocolHandler;
     QMultiMap<int, HttpMessagePair> h2RequestsToSend;
     bool switchedToHttp2 = false;
+    // whether the socket still carries the connection established for the
+    // current/next request; cleared once a reply (or preconnect) completed,
+    // so later requests on this channel count as connection reuse
+    bool freshConnection = true;
 #ifndef QT_NO_SSL
     bool ignoreAllSslErrors;
     QList<QSslError> ignoreSslErrorsList;
@@ -283,6 +283,16 @@ void QHttpNetworkReply::setHttp2WasUsed(bool h2)
     d_func()->h2Used = h2;
 }
 
+bool QHttpNetworkReply::isConnectionReused() const
+{
+    return d_func()->connectionReused;
+}
+
+void QHttpNetworkReply::setConnectionWasReused(bool reused)
+{
+    d_func()->connectionReused = reused;
+}
+
 qint64 QHttpNetworkReply::removedContentLength() const
 {
     return d_func()->removedContentLength;
@@ -313,7 +323,7 @@ QHttpNetworkReplyPrivate::QHttpNetworkReplyPrivate(const QUrl &newUrl)
       removedContentLength(-1),
       connection(nullptr),
       autoDecompress(false), responseData(), requestIsPrepared(false)
-      ,pipeliningUsed(false), h2Used(false), downstreamLimited(false)
+      ,pipeliningUsed(false), h2Used(false), connectionReused(false), downstreamLimited(false)
       ,userProvidedDownloadBuffer(nullptr)
 
 {
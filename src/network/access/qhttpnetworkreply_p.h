@@ -115,6 +115,8 @@ public:
     bool isPipeliningUsed() const;
     bool isHttp2Used() const;
     void setHttp2WasUsed(bool h2Used);
+    bool isConnectionReused() const;
+    void setConnectionWasReused(bool reused);
     qint64 removedContentLength() const;
 
     bool isRedirecting() const;
@@ -239,6 +241,7 @@ public:
 
     bool pipeliningUsed;
     bool h2Used;
+    bool connectionReused;
     bool downstreamLimited;
 
     char* userProvidedDownloadBuffer;
@@ -247,6 +247,7 @@ bool QHttpProtocolHandler::sendRequest()
             m_reply = nullptr; // so we can reuse this channel
             return true; // we have a working connection and are done
         }
+        m_reply->setConnectionWasReused(!m_channel->freshConnection);
 
         m_channel->written = 0; // excluding the header
         m_channel->bytesTotal = 0;
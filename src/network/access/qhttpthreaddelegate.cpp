@@ -9,11 +9,14 @@
 #include <QAuthenticator>
 #include <QEventLoop>
 #include <QCryptographicHash>
+#include <QFile>
 
 #include "private/qhttpnetworkreply_p.h"
 #include "private/qnetworkaccesscache_p.h"
 #include "private/qnoncontiguousbytedevice_p.h"
 
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
@@ -196,6 +199,7 @@ QHttpThreadDelegate::QHttpThreadDelegate(QObject *parent) :
     , incomingStatusCode(0)
     , isPipeliningUsed(false)
     , isHttp2Used(false)
+    , isConnectionReused(false)
     , incomingContentLength(-1)
     , removedContentLength(-1)
     , incomingErrorCode(QNetworkReply::NoError)
@@ -604,13 +608,33 @@ void QHttpThreadDelegate::headerChangedSlot()
 #endif
 
     // Is using a zerocopy buffer allowed by user and possible with this reply?
-    if (httpReply->supportsUserProvidedDownloadBuffer()
-        && (downloadBufferMaximumSize > 0) && (httpReply->contentLength() <= downloadBufferMaximumSize)) {
-        char *buf = new (std::nothrow) char[httpReply->contentLength()];
-        // in out of memory situations, don't use downloadBuffer.
-        if (buf) {
-            downloadBuffer = QSharedPointer<char>(buf, [](auto p) { delete[] p; });
-            httpReply->setUserProvidedDownloadBuffer(buf);
+    if (httpReply->supportsUserProvidedDownloadBuffer()) {
+        if (!downloadDestinationFilePath.isEmpty()) {
+            // Write the body straight into a mapping of the destination file:
+            // the socket thread then moves the data to the page cache and the
+            // user thread only sees progress signals.
+            auto file = std::make_unique<QFile>(downloadDestinationFilePath);
+            if (file->open(QIODevice::ReadWrite) && file->resize(httpReply->contentLength())) {
+                if (uchar *mapping = file->map(0, httpReply->contentLength())) {
+                    // destroying the QFile releases the mapping again
+                    downloadBuffer = QSharedPointer<char>(reinterpret_cast<char *>(mapping),
+                                                          [file = file.release()](char *) {
+                                                              delete file;
+                                                          });
+                    httpReply->setUserProvidedDownloadBuffer(downloadBuffer.data());
+                }
+            }
+            // if the file could not be created or mapped, fall back below
+        }
+        if (downloadBuffer.isNull()
+            && (downloadBufferMaximumSize > 0)
+            && (httpReply->contentLength() <= downloadBufferMaximumSize)) {
+            char *buf = new (std::nothrow) char[httpReply->contentLength()];
+            // in out of memory situations, don't use downloadBuffer.
+            if (buf) {
+                downloadBuffer = QSharedPointer<char>(buf, [](auto p) { delete[] p; });
+                httpReply->setUserProvidedDownloadBuffer(buf);
+            }
         }
     }
 
@@ -622,6 +646,7 @@ void QHttpThreadDelegate::headerChangedSlot()
     incomingContentLength = httpReply->contentLength();
     removedContentLength = httpReply->removedContentLength();
     isHttp2Used = httpReply->isHttp2Used();
+    isConnectionReused = httpReply->isConnectionReused();
     isCompressed = httpReply->isCompressed();
 
     emit downloadMetaData(incomingHeaders,
@@ -632,7 +657,8 @@ void QHttpThreadDelegate::headerChangedSlot()
                           incomingContentLength,
                           removedContentLength,
                           isHttp2Used,
-                          isCompressed);
+                          isCompressed,
+                          isConnectionReused);
 }
 
 void QHttpThreadDelegate::synchronousHeaderChangedSlot()
@@ -649,6 +675,7 @@ void QHttpThreadDelegate::synchronousHeaderChangedSlot()
     incomingReasonPhrase = httpReply->reasonPhrase();
     isPipeliningUsed = httpReply->isPipeliningUsed();
     isHttp2Used = httpReply->isHttp2Used();
+    isConnectionReused = httpReply->isConnectionReused();
     incomingContentLength = httpReply->contentLength();
 }
 
@@ -60,6 +60,7 @@ public:
 #endif
     QHttpNetworkRequest httpRequest;
     qint64 downloadBufferMaximumSize;
+    QString downloadDestinationFilePath;
     qint64 readBufferMaxSize;
     qint64 bytesEmitted;
     // From backend, modified by us for signal compression
@@ -80,6 +81,7 @@ public:
     QString incomingReasonPhrase;
     bool isPipeliningUsed;
     bool isHttp2Used;
+    bool isConnectionReused;
     bool isCompressed = false;
     qint64 incomingContentLength;
     qint64 removedContentLength;
@@ -113,7 +115,7 @@ signals:
     void socketStartedConnecting();
     void requestSent();
     void downloadMetaData(const QHttpHeaders &, int, const QString &, bool,
-                          QSharedPointer<char>, qint64, qint64, bool, bool);
+                          QSharedPointer<char>, qint64, qint64, bool, bool, bool);
     void downloadProgress(qint64, qint64);
     void downloadData(const QByteArray &);
     void error(QNetworkReply::NetworkError, const QString &);
@@ -63,6 +63,8 @@
 
 #include "qnetconmonitor_p.h"
 
+#include <qtnetwork_tracepoints_p.h>
+
 #include <mutex>
 
 QT_BEGIN_NAMESPACE
@@ -70,6 +72,9 @@ QT_BEGIN_NAMESPACE
 using namespace Qt::StringLiterals;
 using namespace std::chrono_literals;
 
+Q_TRACE_POINT(qtnetwork, QNetworkAccessManager_createRequest_entry, int operation, const QUrl &url);
+Q_TRACE_POINT(qtnetwork, QNetworkAccessManager_createRequest_exit);
+
 #if defined(Q_OS_MACOS)
 Q_STATIC_LOGGING_CATEGORY(lcQnam, "qt.network.access.manager")
 #endif
@@ -1071,6 +1076,88 @@ void QNetworkAccessManager::connectToHost(const QString &hostName, quint16 port)
     get(request);
 }
 
+/*!
+    \since 6.9
+
+    Keeps a pool of \a connectionCount warm connections to \a origin, which
+    must be an \c http or \c https URL carrying at least a host name (the
+    scheme's default port is used if none is set).
+
+    The connections are established immediately by preconnecting, as
+    connectToHost() and connectToHostEncrypted() do, and the preconnect is
+    repeated every \a refreshInterval so that idle connections are not
+    expired from the connection cache and connections the server dropped
+    are re-established. Requests to \a origin then find a connected socket
+    and skip the DNS lookup and the TCP (and TLS) handshake, which
+    otherwise dominate the tail latency of the first requests of a traffic
+    burst. Whether an individual reply benefited can be seen from its
+    \l {QNetworkRequest::ConnectionReusedAttribute} attribute.
+
+    Calling this function again for the same \a origin replaces the
+    earlier pool configuration. Encrypted origins are preconnected with
+    the default QSslConfiguration; use connectToHostEncrypted() directly
+    if a custom configuration is needed.
+
+    \note When a host is served over HTTP/2, one single connection per
+    host is enough, and a larger \a connectionCount will not result in
+    faster network transactions.
+
+    \sa removeWarmHost(), connectToHost(), connectToHostEncrypted()
+*/
+void QNetworkAccessManager::setWarmHost(const QUrl &origin, int connectionCount,
+                                        std::chrono::milliseconds refreshInterval)
+{
+    Q_D(QNetworkAccessManager);
+    const QString scheme = origin.scheme();
+    const bool encrypted = scheme.compare("https"_L1, Qt::CaseInsensitive) == 0;
+    if (!encrypted && scheme.compare("http"_L1, Qt::CaseInsensitive) != 0) {
+        qWarning("QNetworkAccessManager::setWarmHost: unsupported scheme '%ls'",
+                 qUtf16Printable(scheme));
+        return;
+    }
+    if (origin.host().isEmpty()) {
+        qWarning("QNetworkAccessManager::setWarmHost: origin has no host");
+        return;
+    }
+#ifdef QT_NO_SSL
+    if (encrypted) {
+        qWarning("QNetworkAccessManager::setWarmHost: SSL is not supported");
+        return;
+    }
+#endif
+
+    removeWarmHost(origin);
+
+    const int count = qMax(connectionCount, 1);
+    QTimer *timer = new QTimer(this);
+    timer->setTimerType(Qt::VeryCoarseTimer);
+    timer->setInterval(refreshInterval);
+    connect(timer, &QTimer::timeout, this,
+            [this, origin, count] { d_func()->warmUpHost(origin, count); });
+    d->warmHosts.insert(origin, { count, timer });
+    d->warmUpHost(origin, count);
+    timer->start();
+}
+
+/*!
+    \since 6.9
+
+    Stops keeping warm connections to \a origin, previously configured
+    with setWarmHost(). Established connections are not torn down; they
+    simply expire from the connection cache once idle for long enough.
+
+    \sa setWarmHost()
+*/
+void QNetworkAccessManager::removeWarmHost(const QUrl &origin)
+{
+    Q_D(QNetworkAccessManager);
+    const auto it = d->warmHosts.constFind(origin);
+    if (it == d->warmHosts.cend())
+        return;
+    delete it->refreshTimer;
+    d->warmHosts.erase(it);
+}
+
 /*!
     \since 5.9
 
@@ -1195,6 +1282,9 @@ QNetworkReply *QNetworkAccessManager::createRequest(QNetworkAccessManager::Opera
 {
     Q_D(QNetworkAccessManager);
 
+    Q_TRACE(QNetworkAccessManager_createRequest_entry, int(op), originalReq.url());
+    Q_TRACE_EXIT(QNetworkAccessManager_createRequest_exit);
+
     QNetworkRequest req(originalReq);
     if (redirectPolicy() != QNetworkRequest::NoLessSafeRedirectPolicy
         && req.attribute(QNetworkRequest::RedirectPolicyAttribute).isNull()) {
@@ -1823,6 +1913,25 @@ void QNetworkAccessManagerPrivate::ensureBackendPluginsLoaded()
         ++index;
 }
 
+/*!
+    \internal
+    Issues the preconnect requests that establish (or keep alive) the warm
+    connections to \a origin configured with setWarmHost().
+*/
+void QNetworkAccessManagerPrivate::warmUpHost(const QUrl &origin, int connectionCount)
+{
+    Q_Q(QNetworkAccessManager);
+    for (int i = 0; i < connectionCount; ++i) {
+#ifndef QT_NO_SSL
+        if (origin.scheme().compare("https"_L1, Qt::CaseInsensitive) == 0) {
+            q->connectToHostEncrypted(origin.host(), quint16(origin.port(443)));
+            continue;
+        }
+#endif
+        q->connectToHost(origin.host(), quint16(origin.port(80)));
+    }
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qnetworkaccessmanager.cpp"
@@ -115,6 +115,10 @@ public:
 #endif
     void connectToHost(const QString &hostName, quint16 port = 80);
 
+    void setWarmHost(const QUrl &origin, int connectionCount = 1,
+                     std::chrono::milliseconds refreshInterval = std::chrono::seconds{30});
+    void removeWarmHost(const QUrl &origin);
+
     void setRedirectPolicy(QNetworkRequest::RedirectPolicy policy);
     QNetworkRequest::RedirectPolicy redirectPolicy() const;
 
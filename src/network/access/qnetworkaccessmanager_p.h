@@ -25,6 +25,8 @@
 #include "private/qobject_p.h"
 #include "QtNetwork/qnetworkproxy.h"
 #include "qnetworkaccessauthenticationmanager_p.h"
+#include <QtCore/qhash.h>
+#include <QtCore/qtimer.h>
 
 #if QT_CONFIG(settings)
 #include "qhstsstore_p.h"
@@ -96,6 +98,8 @@ public:
 
     void ensureBackendPluginsLoaded();
 
+    void warmUpHost(const QUrl &origin, int connectionCount);
+
     // this is the cache for storing downloaded files
     QAbstractNetworkCache *networkCache;
 
@@ -131,6 +135,14 @@ public:
 
     bool autoDeleteReplies = false;
 
+    // origins we keep warm connections to; the timers re-issue preconnects
+    // so idle connections are kept alive and dropped ones re-established
+    struct WarmHost {
+        int connectionCount;
+        QTimer *refreshTimer;
+    };
+    QHash<QUrl, WarmHost> warmHosts;
+
     std::chrono::milliseconds transferTimeout{0};
 
     Q_DECLARE_PUBLIC(QNetworkAccessManager)
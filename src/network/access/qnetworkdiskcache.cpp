@@ -116,6 +116,9 @@ void QNetworkDiskCache::setCacheDirectory(const QString &cacheDir)
         d->cacheDirectory += u'/';
 
     d->dataDirectory = d->cacheDirectory + DATA_DIR + QString::number(CACHE_VERSION) + u'/';
+    d->fileIndex.clear();
+    d->fileIndexLoaded = false;
+    d->recentMetaData.clear();
     d->prepareLayout();
 }
 
@@ -220,6 +223,33 @@ void QNetworkDiskCachePrivate::prepareLayout()
 }
 
 
+/*!
+    \internal
+
+    Walks the cache directory once and remembers each cache file's size and
+    timestamp. Afterwards eviction works from this index instead of
+    re-listing and re-statting the whole directory, and the index is kept up
+    to date as entries are stored and removed.
+*/
+void QNetworkDiskCachePrivate::ensureFileIndex()
+{
+    if (fileIndexLoaded)
+        return;
+    using F = QDirListing::IteratorFlag;
+    for (const auto &dirEntry : QDirListing(cacheDirectory, F::FilesOnly | F::Recursive)) {
+        if (!dirEntry.fileName().endsWith(CACHE_POSTFIX))
+            continue;
+
+        const QFileInfo &info = dirEntry.fileInfo();
+        QDateTime fileTime = info.birthTime(QTimeZone::UTC);
+        if (!fileTime.isValid())
+            fileTime = info.metadataChangeTime(QTimeZone::UTC);
+        fileIndex.insert(QDir::cleanPath(info.filePath()),
+                         { fileTime.toMSecsSinceEpoch(), info.size() });
+    }
+    fileIndexLoaded = true;
+}
+
 void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
 {
     Q_Q(QNetworkDiskCache);
@@ -251,13 +281,19 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
         // commit() invalidates the file-engine, and size() will create a new
         // one, pointing at an empty filename.
         qint64 size = cacheItem->file->size();
-        if (cacheItem->file->commit())
+        if (cacheItem->file->commit()) {
             currentCacheSize += size;
+            if (fileIndexLoaded) {
+                fileIndex.insert(QDir::cleanPath(fileName),
+                                 { QDateTime::currentMSecsSinceEpoch(), size });
+            }
+        }
         // Delete and unset the QSaveFile, it's invalid now.
         delete std::exchange(cacheItem->file, nullptr);
     }
     if (cacheItem->metaData.url() == lastItem.metaData.url())
         lastItem.reset();
+    recentMetaData.remove(cacheItem->metaData.url());
 }
 
 /*!
@@ -282,6 +318,7 @@ bool QNetworkDiskCache::remove(const QUrl &url)
 
     if (d->lastItem.metaData.url() == url)
         d->lastItem.reset();
+    d->recentMetaData.remove(url);
     return d->removeFile(d->cacheFileName(url));
 }
 
@@ -299,9 +336,15 @@ bool QNetworkDiskCachePrivate::removeFile(const QString &file)
     QString fileName = info.fileName();
     if (!fileName.endsWith(CACHE_POSTFIX))
         return false;
-    qint64 size = info.size();
+    const QString key = QDir::cleanPath(file);
+    qint64 size;
+    if (const auto it = fileIndex.constFind(key); it != fileIndex.cend())
+        size = it->size;
+    else
+        size = info.size();
     if (QFile::remove(file)) {
         currentCacheSize -= size;
+        fileIndex.remove(key);
         return true;
     }
     return false;
@@ -318,7 +361,12 @@ QNetworkCacheMetaData QNetworkDiskCache::metaData(const QUrl &url)
     Q_D(QNetworkDiskCache);
     if (d->lastItem.metaData.url() == url)
         return d->lastItem.metaData;
-    return fileMetaData(d->cacheFileName(url));
+    if (QNetworkCacheMetaData *cached = d->recentMetaData.object(url))
+        return *cached;
+    QNetworkCacheMetaData metaData = fileMetaData(d->cacheFileName(url));
+    if (metaData.isValid())
+        d->recentMetaData.insert(url, new QNetworkCacheMetaData(metaData));
+    return metaData;
 }
 
 /*!
@@ -473,32 +521,26 @@ qint64 QNetworkDiskCache::expire()
     // close file handle to prevent "in use" error when QFile::remove() is called
     d->lastItem.reset();
 
+    d->ensureFileIndex();
+
+    qint64 totalSize = 0;
+    for (auto it = d->fileIndex.cbegin(), end = d->fileIndex.cend(); it != end; ++it)
+        totalSize += it.value().size;
+
+    const qint64 goal = (maximumCacheSize() * 9) / 10;
+    if (totalSize < goal)
+        return totalSize; // Nothing to do
+
     struct CacheItem
     {
-        std::chrono::milliseconds msecs;
+        qint64 msecs;
         QString path;
         qint64 size = 0;
     };
     std::vector<CacheItem> cacheItems;
-    qint64 totalSize = 0;
-    using F = QDirListing::IteratorFlag;
-    for (const auto &dirEntry : QDirListing(cacheDirectory(), F::FilesOnly | F::Recursive)) {
-        if (!dirEntry.fileName().endsWith(CACHE_POSTFIX))
-            continue;
-
-        const QFileInfo &info = dirEntry.fileInfo();
-        QDateTime fileTime = info.birthTime(QTimeZone::UTC);
-        if (!fileTime.isValid())
-            fileTime = info.metadataChangeTime(QTimeZone::UTC);
-        const std::chrono::milliseconds msecs{fileTime.toMSecsSinceEpoch()};
-        const qint64 size = info.size();
-        cacheItems.push_back(CacheItem{msecs, info.filePath(), size});
-        totalSize += size;
-    }
-
-    const qint64 goal = (maximumCacheSize() * 9) / 10;
-    if (totalSize < goal)
-        return totalSize; // Nothing to do
+    cacheItems.reserve(d->fileIndex.size());
+    for (auto it = d->fileIndex.cbegin(), end = d->fileIndex.cend(); it != end; ++it)
+        cacheItems.push_back(CacheItem{it.value().fileTimeMs, it.key(), it.value().size});
 
     auto byFileTime = [&](const auto &a, const auto &b) { return a.msecs < b.msecs; };
     std::sort(cacheItems.begin(), cacheItems.end(), byFileTime);
@@ -506,11 +548,14 @@ qint64 QNetworkDiskCache::expire()
     [[maybe_unused]] int removedFiles = 0; // used under QNETWORKDISKCACHE_DEBUG
     for (const CacheItem &cached : cacheItems) {
         QFile::remove(cached.path);
+        d->fileIndex.remove(cached.path);
         ++removedFiles;
         totalSize -= cached.size;
         if (totalSize < goal)
             break;
     }
+    // Some of the removed entries may still be cached:
+    d->recentMetaData.clear();
 #if defined(QNETWORKDISKCACHE_DEBUG)
     if (removedFiles > 0) {
         qDebug() << "QNetworkDiskCache::expire()"
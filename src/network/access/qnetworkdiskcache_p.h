@@ -19,6 +19,7 @@
 #include "private/qabstractnetworkcache_p.h"
 
 #include <qbuffer.h>
+#include <qcache.h>
 #include <qhash.h>
 #include <qsavefile.h>
 
@@ -68,8 +69,17 @@ public:
     bool removeFile(const QString &file);
     void storeItem(QCacheItem *item);
     void prepareLayout();
+    void ensureFileIndex();
     static quint32 crc32(const char *data, uint len);
 
+    // Size and timestamp of one cache file, so eviction doesn't have to
+    // stat the whole cache directory every time it runs.
+    struct IndexEntry
+    {
+        qint64 fileTimeMs = 0;
+        qint64 size = 0;
+    };
+
     mutable QCacheItem lastItem;
     QString cacheDirectory;
     QString dataDirectory;
@@ -77,6 +87,9 @@ public:
     qint64 currentCacheSize;
 
     QHash<QIODevice*, QCacheItem*> inserting;
+    QHash<QString, IndexEntry> fileIndex;
+    QCache<QUrl, QNetworkCacheMetaData> recentMetaData { 64 };
+    bool fileIndexLoaded = false;
     Q_DECLARE_PUBLIC(QNetworkDiskCache)
 };
 
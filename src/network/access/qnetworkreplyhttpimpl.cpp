@@ -28,6 +28,8 @@
 
 #include "qnetworkreplyimpl_p.h"
 
+#include <qtnetwork_tracepoints_p.h>
+
 #include <string.h>             // for strchr
 
 QT_BEGIN_NAMESPACE
@@ -36,6 +38,9 @@ using namespace Qt::StringLiterals;
 using namespace QtMiscUtils;
 using namespace std::chrono_literals;
 
+Q_TRACE_POINT(qtnetwork, QNetworkReplyHttpImpl_startOperation, QObject *reply, const QUrl &url);
+Q_TRACE_POINT(qtnetwork, QNetworkReplyHttpImpl_finished, QObject *reply, int statusCode, qint64 bytesDownloaded);
+
 class QNetworkProxy;
 
 static inline QByteArray rangeName() { return "Range"_ba; }
@@ -870,6 +875,11 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
             delegate->downloadBufferMaximumSize = 128*1024;
         }
 
+        // Is the reply body to be written straight into a file?
+        QVariant downloadDestinationAttribute = newHttpRequest.attribute(QNetworkRequest::DownloadDestinationFileAttribute);
+        if (downloadDestinationAttribute.isValid())
+            delegate->downloadDestinationFilePath = downloadDestinationAttribute.toString();
+
 
         // These atomic integers are used for signal compression
         delegate->pendingDownloadData = pendingDownloadDataEmissions;
@@ -993,7 +1003,8 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
                     delegate->incomingContentLength,
                     delegate->removedContentLength,
                     delegate->isHttp2Used,
-                    delegate->isCompressed);
+                    delegate->isCompressed,
+                    delegate->isConnectionReused);
         replyDownloadData(delegate->synchronousDownloadData);
 
         if (delegate->incomingErrorCode != QNetworkReply::NoError)
@@ -1348,7 +1359,8 @@ void QNetworkReplyHttpImplPrivate::replyDownloadMetaData(const QHttpHeaders &hm,
                                                          QSharedPointer<char> db,
                                                          qint64 contentLength,
                                                          qint64 removedContentLength,
-                                                         bool h2Used, bool isCompressed)
+                                                         bool h2Used, bool isCompressed,
+                                                         bool connectionReused)
 {
     Q_Q(QNetworkReplyHttpImpl);
     Q_UNUSED(contentLength);
@@ -1375,6 +1387,7 @@ void QNetworkReplyHttpImplPrivate::replyDownloadMetaData(const QHttpHeaders &hm,
 
     q->setAttribute(QNetworkRequest::HttpPipeliningWasUsedAttribute, pu);
     q->setAttribute(QNetworkRequest::Http2WasUsedAttribute, h2Used);
+    q->setAttribute(QNetworkRequest::ConnectionReusedAttribute, connectionReused);
 
     // A user having manually defined which encodings they accept is, for
     // somwehat unknown (presumed legacy compatibility) reasons treated as
@@ -1394,8 +1407,12 @@ void QNetworkReplyHttpImplPrivate::replyDownloadMetaData(const QHttpHeaders &hm,
             h.removeAll(key);
 
         if (shouldDecompress && !decompressHelper.isValid() && key == "content-encoding"_L1) {
-            if (!synchronous) // with synchronous all the data is expected to be handled at once
+            if (!synchronous) { // with synchronous all the data is expected to be handled at once
                 decompressHelper.setCountingBytesEnabled(true);
+                // Decompress on the thread pool so one large compressed reply
+                // doesn't stall the other transfers serviced by this thread:
+                decompressHelper.setOffThreadDecompressionEnabled(true);
+            }
 
             if (!decompressHelper.setEncoding(originValue)) {
                 error(QNetworkReplyImpl::NetworkError::UnknownContentError,
@@ -1907,6 +1924,8 @@ void QNetworkReplyHttpImplPrivate::_q_startOperation()
 
     state = Working;
 
+    Q_TRACE(QNetworkReplyHttpImpl_startOperation, q_func(), request.url());
+
     postRequest(request);
 
     setupTransferTimeout();
@@ -2147,6 +2166,8 @@ void QNetworkReplyHttpImplPrivate::finished()
     state = Finished;
     q->setFinished(true);
 
+    Q_TRACE(QNetworkReplyHttpImpl_finished, q, statusCode, bytesDownloaded);
+
     if (totalSize == -1) {
         emit q->downloadProgress(bytesDownloaded, bytesDownloaded);
     } else {
@@ -245,7 +245,7 @@ public:
     void replyDownloadData(QByteArray);
     void replyFinished();
     void replyDownloadMetaData(const QHttpHeaders &, int, const QString &,
-                               bool, QSharedPointer<char>, qint64, qint64, bool, bool);
+                               bool, QSharedPointer<char>, qint64, qint64, bool, bool, bool);
     void replyDownloadProgressSlot(qint64,qint64);
     void httpAuthenticationRequired(const QHttpNetworkRequest &request, QAuthenticator *auth);
     void httpError(QNetworkReply::NetworkError error, const QString &errorString);
@@ -335,6 +335,31 @@ QT_IMPL_METATYPE_EXTERN_TAGGED(QNetworkRequest::RedirectPolicy, QNetworkRequest_
         be used for the Host header in the HTTP request.
         (This value was introduced in 6.8.)
 
+    \value ConnectionReusedAttribute
+        Replies only, type: QMetaType::Bool (default: false)
+        Indicates whether the request was sent over a connection that had
+        already been established, for example by an earlier request or by
+        preconnecting, so it did not have to wait for the DNS lookup and the
+        TCP (and TLS) handshake. Comparing the number of replies with this
+        attribute set against the total gives the connection reuse hit rate,
+        which is useful when tuning warm connection pools; see
+        QNetworkAccessManager::setWarmHost().
+        (This value was introduced in 6.9.)
+
+    \value DownloadDestinationFileAttribute
+        Requests only, type: QMetaType::QString
+        Holds the path of a file the reply body should be written to directly.
+        When the response has a known content length, the file is resized up
+        front and the body is written into a memory mapping of it straight
+        from the HTTP worker thread, so large downloads do not need to be read
+        out of the reply and only progress signals reach the user thread. The
+        reply data can still be read as usual. The attribute is ignored when
+        the response does not allow preallocation (unknown content length, a
+        compressed body, or a status code other than 200) or when the file
+        cannot be created or mapped; the body is then delivered normally. If
+        the transfer fails the file is left partially written.
+        (This value was introduced in 6.9.)
+
     \value User
         Special type. Additional information can be passed in
         QVariants with types ranging from User to UserMax. The default
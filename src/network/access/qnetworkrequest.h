@@ -71,6 +71,8 @@ public:
         Http2CleartextAllowedAttribute,
         UseCredentialsAttribute,
         FullLocalServerNameAttribute,
+        ConnectionReusedAttribute,
+        DownloadDestinationFileAttribute,
 
         User = 1000,
         UserMax = 32767
@@ -6,8 +6,10 @@
 #include "qdnslookup_p.h"
 
 #include <qapplicationstatic.h>
+#include <qcache.h>
 #include <qcoreapplication.h>
 #include <qdatetime.h>
+#include <qdeadlinetimer.h>
 #include <qendian.h>
 #include <qloggingcategory.h>
 #include <qrandom.h>
@@ -19,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <limits>
 
 QT_BEGIN_NAMESPACE
 
@@ -39,6 +42,88 @@ struct QDnsLookupThreadPool : QThreadPool
 
 Q_APPLICATION_STATIC(QDnsLookupThreadPool, theDnsLookupThreadPool);
 
+namespace {
+// A small cache of complete replies, honoring the TTLs the server sent, so
+// that high-rate discovery lookups (e.g. SRV/TXT) don't hit the network for
+// every query.
+struct QDnsLookupCache
+{
+    // Cap how long we are willing to serve a reply from the cache, however
+    // large the TTL: long-lived processes should notice zone changes and
+    // network reconfiguration in reasonable time.
+    static constexpr quint32 MaxTtl = 300;
+
+    struct Key
+    {
+        QDnsLookupRunnable::EncodedLabel name;
+        QHostAddress nameserver;
+        QDnsLookup::Type type;
+        quint16 port;
+        QDnsLookup::Protocol protocol;
+
+        friend bool operator==(const Key &lhs, const Key &rhs) noexcept
+        {
+            return lhs.type == rhs.type && lhs.port == rhs.port
+                    && lhs.protocol == rhs.protocol && lhs.name == rhs.name
+                    && lhs.nameserver == rhs.nameserver;
+        }
+        friend size_t qHash(const Key &key, size_t seed) noexcept
+        {
+            return qHashMulti(seed, key.name, key.nameserver, key.type, key.port, key.protocol);
+        }
+    };
+
+    std::optional<QDnsLookupReply> get(const Key &key)
+    {
+        QMutexLocker locker(&mutex);
+        if (Entry *entry = cache.object(key)) {
+            if (!entry->expiry.hasExpired())
+                return entry->reply;
+            cache.remove(key);
+        }
+        return std::nullopt;
+    }
+
+    void put(const Key &key, const QDnsLookupReply &reply, quint32 ttl)
+    {
+        QMutexLocker locker(&mutex);
+        cache.insert(key, new Entry { reply, QDeadlineTimer(std::chrono::seconds(ttl)) });
+    }
+
+private:
+    struct Entry
+    {
+        QDnsLookupReply reply;
+        QDeadlineTimer expiry;
+    };
+    QCache<Key, Entry> cache { 128 };
+    QMutex mutex;
+};
+}
+
+Q_APPLICATION_STATIC(QDnsLookupCache, theDnsLookupCache);
+
+// Returns the smallest TTL of all the records of \a reply, or zero if there
+// are none (a reply without records is not worth caching).
+static quint32 qt_qdnslookupreply_minimum_ttl(const QDnsLookupReply &reply)
+{
+    constexpr quint32 NoTtl = std::numeric_limits<quint32>::max();
+    quint32 ttl = NoTtl;
+    auto update = [&ttl](const auto &records) {
+        for (const auto &record : records)
+            ttl = qMin(ttl, record.timeToLive());
+    };
+    update(reply.canonicalNameRecords);
+    update(reply.hostAddressRecords);
+    update(reply.mailExchangeRecords);
+    update(reply.nameServerRecords);
+    update(reply.pointerRecords);
+    update(reply.serviceRecords);
+    update(reply.tlsAssociationRecords);
+    update(reply.textRecords);
+    return ttl == NoTtl ? 0 : ttl;
+}
+
 static bool qt_qdnsmailexchangerecord_less_than(const QDnsMailExchangeRecord &r1, const QDnsMailExchangeRecord &r2)
 {
     // Lower numbers are more preferred than higher ones.
@@ -1532,12 +1617,35 @@ void QDnsLookupRunnable::run()
         reply.error = QDnsLookup::InvalidRequestError;
         reply.errorString = QDnsLookup::tr("Invalid domain name");
     } else {
-        // Perform request.
-        query(&reply);
-
-        // Sort results.
-        qt_qdnsmailexchangerecord_sort(reply.mailExchangeRecords);
-        qt_qdnsservicerecord_sort(reply.serviceRecords);
+        QDnsLookupCache::Key cacheKey = { requestName, nameserver, requestType, port, protocol };
+        bool cacheable = true;
+#if QT_CONFIG(ssl)
+        // custom TLS settings are not part of the cache key
+        cacheable = !sslConfiguration.has_value();
+#endif
+        std::optional<QDnsLookupReply> cached;
+        if (cacheable)
+            cached = theDnsLookupCache->get(cacheKey);
+        if (cached) {
+            reply = std::move(*cached);
+
+            // Redo the RFC 2782 and RFC 5321 randomization for this use.
+            qt_qdnsmailexchangerecord_sort(reply.mailExchangeRecords);
+            qt_qdnsservicerecord_sort(reply.serviceRecords);
+        } else {
+            // Perform request.
+            query(&reply);
+
+            // Sort results.
+            qt_qdnsmailexchangerecord_sort(reply.mailExchangeRecords);
+            qt_qdnsservicerecord_sort(reply.serviceRecords);
+
+            if (cacheable && reply.error == QDnsLookup::NoError) {
+                quint32 ttl = qMin(qt_qdnslookupreply_minimum_ttl(reply), QDnsLookupCache::MaxTtl);
+                if (ttl > 0)
+                    theDnsLookupCache->put(cacheKey, reply, ttl);
+            }
+        }
     }
 
     emit finished(reply);
@@ -1587,6 +1695,33 @@ static constexpr std::chrono::milliseconds DnsOverTlsConnectTimeout(15'000);
 static constexpr std::chrono::milliseconds DnsOverTlsTimeout(120'000);
 static constexpr quint8 DnsAuthenticDataBit = 0x20;
 
+namespace {
+// TLS session tickets per nameserver, so that repeated DNS-over-TLS queries
+// get abbreviated handshakes instead of paying for a full one each time.
+struct QDnsOverTlsSessionCache
+{
+    QByteArray take(const QHostAddress &server, quint16 port)
+    {
+        QMutexLocker locker(&mutex);
+        return sessions.take({ server, port });
+    }
+
+    void store(const QHostAddress &server, quint16 port, const QByteArray &ticket)
+    {
+        if (ticket.isEmpty())
+            return;
+        QMutexLocker locker(&mutex);
+        sessions.insert({ server, port }, ticket);
+    }
+
+private:
+    QHash<std::pair<QHostAddress, quint16>, QByteArray> sessions;
+    QMutex mutex;
+};
+}
+
+Q_APPLICATION_STATIC(QDnsOverTlsSessionCache, theDnsOverTlsSessionCache);
+
 static int makeReplyErrorFromSocket(QDnsLookupReply *reply, const QAbstractSocket *socket)
 {
     QDnsLookup::Error error = [&] {
@@ -1606,7 +1741,12 @@ bool QDnsLookupRunnable::sendDnsOverTls(QDnsLookupReply *reply, QSpan<unsigned c
                                         ReplyBuffer &response)
 {
     QSslSocket socket;
-    socket.setSslConfiguration(sslConfiguration.value_or(QSslConfiguration::defaultConfiguration()));
+    QSslConfiguration config = sslConfiguration.value_or(QSslConfiguration::defaultConfiguration());
+    // session tickets are not stored unless persistence is enabled
+    config.setSslOption(QSsl::SslOptionDisableSessionPersistence, false);
+    // resume the previous TLS session with this server, if we have one
+    config.setSessionTicket(theDnsOverTlsSessionCache->take(nameserver, port));
+    socket.setSslConfiguration(config);
 
 #  if QT_CONFIG(networkproxy)
     socket.setProtocolTag("domain-s"_L1);
@@ -1648,6 +1788,10 @@ bool QDnsLookupRunnable::sendDnsOverTls(QDnsLookupReply *reply, QSpan<unsigned c
             // check if the AD bit is set; we'll trust it over TLS requests
             if (size >= 4)
                 reply->authenticData = response[3] & DnsAuthenticDataBit;
+
+            // remember the session ticket for the next query to this server
+            theDnsOverTlsSessionCache->store(nameserver, port,
+                                             socket.sslConfiguration().sessionTicket());
             return true;
         }
     } while (false);
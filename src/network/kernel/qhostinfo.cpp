@@ -322,6 +322,42 @@ void QHostInfo::abortHostLookup(int id)
     theHostInfoLookupManager()->abortLookup(id);
 }
 
+/*!
+    \since 6.9
+
+    Starts a background lookup of \a name and stores the result in
+    QHostInfo's internal cache, so that a later lookupHost() or fromName()
+    for the same name can be answered without waiting for the resolver.
+
+    Use this when a host name is known ahead of the connection that will
+    need it. There is no way to be notified about the outcome of the
+    lookup; if it fails, nothing is cached and the later lookup resolves
+    the name again.
+
+    This function does nothing if the name is already fresh in the cache.
+
+    \sa lookupHost(), fromName()
+*/
+void QHostInfo::prefetch(const QString &name)
+{
+#ifndef Q_OS_WASM
+    if (name.isEmpty())
+        return;
+    QHostInfoLookupManager *manager = theHostInfoLookupManager();
+    if (!manager || !manager->cache.isEnabled())
+        return;
+    bool valid = false;
+    bool refresh = false;
+    manager->cache.get(name, &valid, &refresh);
+    if (valid && !refresh)
+        return; // still fresh, nothing to do
+    manager->scheduleRefresh(name);
+#else
+    // lookups don't block on WASM, there is nothing to get ahead of
+    Q_UNUSED(name);
+#endif
+}
+
 /*!
     Looks up the IP address(es) for the given host \a name. The
     function blocks during the lookup which means that execution of
@@ -795,8 +831,11 @@ int QHostInfo::lookupHostImpl(const QString &name,
         if (manager->cache.isEnabled()) {
             // check cache first
             bool valid = false;
-            QHostInfo info = manager->cache.get(name, &valid);
+            bool refresh = false;
+            QHostInfo info = manager->cache.get(name, &valid, &refresh);
             if (valid) {
+                if (refresh)
+                    manager->scheduleRefresh(name);
                 info.setLookupId(id);
                 QHostInfoResult result(receiver, std::move(slotObj));
                 if (isUsingStringBasedSlot) {
@@ -843,11 +882,14 @@ void QHostInfoRunnable::run()
 
     // QHostInfo::lookupHost already checks the cache. However we need to check
     // it here too because it might have been cache saved by another QHostInfoRunnable
-    // in the meanwhile while this QHostInfoRunnable was scheduled but not running
+    // in the meanwhile while this QHostInfoRunnable was scheduled but not running.
+    // A cache refresh must not take this shortcut - its whole point is to do
+    // the lookup and renew the entry.
     if (manager->cache.isEnabled()) {
         // check the cache first
         bool valid = false;
-        hostInfo = manager->cache.get(toBeLookedUp, &valid);
+        if (!isCacheRefresh)
+            hostInfo = manager->cache.get(toBeLookedUp, &valid);
         if (!valid) {
             // not in cache, we need to do the lookup and store the result in the cache
             hostInfo = QHostInfoAgent::fromName(toBeLookedUp);
@@ -858,6 +900,9 @@ void QHostInfoRunnable::run()
         hostInfo = QHostInfoAgent::fromName(toBeLookedUp);
     }
 
+    if (isCacheRefresh)
+        return; // nobody is waiting for this result
+
     // check aborted again
     if (manager->wasAborted(id))
         return;
@@ -997,6 +1042,16 @@ void QHostInfoLookupManager::scheduleLookup(QHostInfoRunnable *r)
     rescheduleWithMutexHeld();
 }
 
+// Schedule a lookup whose only purpose is to freshen the cache entry for
+// \a name; the result is not delivered to anyone. Duplicate requests are
+// serialized by the same-host postponing in rescheduleWithMutexHeld().
+void QHostInfoLookupManager::scheduleRefresh(const QString &name)
+{
+    QHostInfoRunnable *runnable = new QHostInfoRunnable(name, nextId(), nullptr, nullptr);
+    runnable->isCacheRefresh = true;
+    scheduleLookup(runnable);
+}
+
 // called by QHostInfo
 void QHostInfoLookupManager::abortLookup(int id)
 {
@@ -1065,8 +1120,11 @@ QHostInfo qt_qhostinfo_lookup(const QString &name, QObject *receiver, const char
     // check cache
     QHostInfoLookupManager* manager = theHostInfoLookupManager();
     if (manager && manager->cache.isEnabled()) {
-        QHostInfo info = manager->cache.get(name, valid);
+        bool refresh = false;
+        QHostInfo info = manager->cache.get(name, valid, &refresh);
         if (*valid) {
+            if (refresh)
+                manager->scheduleRefresh(name);
             return info;
         }
     }
@@ -1105,28 +1163,33 @@ void qt_qhostinfo_cache_inject(const QString &hostname, const QHostInfo &resolut
 }
 #endif
 
-// cache for 60 seconds
+// cache for 60 seconds, start refreshing in the background after 45
 // cache 128 items
-QHostInfoCache::QHostInfoCache() : max_age(60), enabled(true), cache(128)
+QHostInfoCache::QHostInfoCache() : max_age(60), refresh_age(45), enabled(true), cache(128)
 {
 #ifdef QT_QHOSTINFO_CACHE_DISABLED_BY_DEFAULT
     enabled.store(false, std::memory_order_relaxed);
 #endif
 }
 
-QHostInfo QHostInfoCache::get(const QString &name, bool *valid)
+QHostInfo QHostInfoCache::get(const QString &name, bool *valid, bool *refresh)
 {
     QMutexLocker locker(&this->mutex);
 
     *valid = false;
     if (QHostInfoCacheElement *element = cache.object(name)) {
-        if (element->age.elapsed() < max_age*1000)
+        const qint64 elapsed = element->age.elapsed();
+        if (elapsed < max_age*1000) {
             *valid = true;
+            // If the entry is aging, have the caller freshen it in the
+            // background so frequently used names don't expire into a
+            // blocking lookup. Only the first caller gets to do so.
+            if (refresh && elapsed >= refresh_age*1000 && !element->refreshPending) {
+                element->refreshPending = true;
+                *refresh = true;
+            }
+        }
         return element->info;
-
-        // FIXME idea:
-        // if too old but not expired, trigger a new lookup
-        // to freshen our cache
     }
 
     return QHostInfo();
@@ -54,6 +54,7 @@ public:
 #endif
     static int lookupHost(const QString &name, const QObject *receiver, const char *member);
     static void abortHostLookup(int lookupId);
+    static void prefetch(const QString &name);
 
     static QHostInfo fromName(const QString &name);
     static QString localHostName();
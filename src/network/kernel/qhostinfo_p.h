@@ -113,8 +113,9 @@ class QHostInfoCache
 public:
     QHostInfoCache();
     const int max_age; // seconds
+    const int refresh_age; // seconds; background-refresh entries older than this
 
-    QHostInfo get(const QString &name, bool *valid);
+    QHostInfo get(const QString &name, bool *valid, bool *refresh = nullptr);
     void put(const QString &name, const QHostInfo &info);
     void clear();
 
@@ -127,6 +128,7 @@ private:
     struct QHostInfoCacheElement {
         QHostInfo info;
         QElapsedTimer age;
+        bool refreshPending = false;
     };
     QCache<QString,QHostInfoCacheElement> cache;
     QMutex mutex;
@@ -146,6 +148,8 @@ public:
     QString toBeLookedUp;
     int id;
     QHostInfoResult resultEmitter;
+    // refreshes an aging cache entry; nobody is waiting for the result
+    bool isCacheRefresh = false;
 };
 
 
@@ -159,6 +163,7 @@ public:
 
     // called from QHostInfo
     void scheduleLookup(QHostInfoRunnable *r);
+    void scheduleRefresh(const QString &name);
     void abortLookup(int id);
 
     // called from QHostInfoRunnable
@@ -200,7 +200,10 @@
 #endif
 
 #include "qauthenticator.h"
+#include "qcache.h"
+#include "qdeadlinetimer.h"
 #include "qdebug.h"
+#include "qhash.h"
 #include "qmutex.h"
 #include "qstringlist.h"
 #include "qurl.h"
@@ -268,6 +271,7 @@ public:
             delete applicationLevelProxyFactory;
             applicationLevelProxyFactory = nullptr;
         }
+        systemProxyCache.clear();
     }
 
     void setApplicationProxy(const QNetworkProxy &proxy)
@@ -300,7 +304,43 @@ public:
 
     QList<QNetworkProxy> proxyForQuery(const QNetworkProxyQuery &query);
 
+    void clearSystemProxyCache()
+    {
+        QMutexLocker lock(&mutex);
+        systemProxyCache.clear();
+    }
+
 private:
+    // System proxy lookups can be expensive (WinHTTP, PAC evaluation), so
+    // resolved results are kept for a short while, keyed by what the
+    // platform resolvers actually inspect: the query type, the protocol
+    // tag and the peer's host and port.
+    static constexpr auto SystemProxyCacheTtl = std::chrono::seconds(30);
+
+    struct SystemProxyCacheKey {
+        QNetworkProxyQuery::QueryType queryType;
+        QString protocolTag;
+        QString peerHostName;
+        int peerPort;
+
+        friend bool operator==(const SystemProxyCacheKey &lhs, const SystemProxyCacheKey &rhs)
+        {
+            return lhs.queryType == rhs.queryType && lhs.protocolTag == rhs.protocolTag
+                    && lhs.peerHostName == rhs.peerHostName && lhs.peerPort == rhs.peerPort;
+        }
+        friend size_t qHash(const SystemProxyCacheKey &key, size_t seed) noexcept
+        {
+            return qHashMulti(seed, key.queryType, key.protocolTag, key.peerHostName,
+                              key.peerPort);
+        }
+    };
+    struct SystemProxyCacheEntry {
+        QList<QNetworkProxy> proxies;
+        QDeadlineTimer expiry;
+    };
+
+    QCache<SystemProxyCacheKey, SystemProxyCacheEntry> systemProxyCache { 64 };
+
     QRecursiveMutex mutex;
     QNetworkProxy *applicationLevelProxy;
     QNetworkProxyFactory *applicationLevelProxyFactory;
@@ -333,6 +373,14 @@ QList<QNetworkProxy> QGlobalNetworkProxy::proxyForQuery(const QNetworkProxyQuery
             && applicationLevelProxy->type() != QNetworkProxy::DefaultProxy) {
             result << *applicationLevelProxy;
         } else if (useSystemProxies) {
+            const SystemProxyCacheKey cacheKey = { query.queryType(), query.protocolTag(),
+                                                   query.peerHostName(), query.peerPort() };
+            const SystemProxyCacheEntry *cached = systemProxyCache.object(cacheKey);
+            if (cached && !cached->expiry.hasExpired()) {
+                result = cached->proxies;
+                return result;
+            }
+
             result = QNetworkProxyFactory::systemProxyForQuery(query);
 
             // Make sure NoProxy is in the list, so that QTcpServer can work:
@@ -340,6 +388,10 @@ QList<QNetworkProxy> QGlobalNetworkProxy::proxyForQuery(const QNetworkProxyQuery
             // if none have (as is the case with HTTP proxies), it fails to bind.
             // NoProxy allows it to fallback to the 'no proxy' case and bind.
             result << QNetworkProxy(QNetworkProxy::NoProxy);
+
+            systemProxyCache.insert(
+                    cacheKey,
+                    new SystemProxyCacheEntry { result, QDeadlineTimer(SystemProxyCacheTtl) });
         } else {
             result << QNetworkProxy(QNetworkProxy::NoProxy);
         }
@@ -1550,6 +1602,24 @@ QList<QNetworkProxy> QNetworkProxyFactory::proxyForQuery(const QNetworkProxyQuer
     return globalNetworkProxy()->proxyForQuery(query);
 }
 
+/*!
+    \since 6.9
+
+    Discards all cached system proxy resolution results.
+
+    When the system proxy configuration is in use (see
+    setUseSystemConfiguration()), proxyForQuery() keeps the results
+    returned by systemProxyForQuery() for a short while, since querying
+    the operating system can be expensive. If the application knows that
+    the system's proxy settings have changed, it can call this function
+    to make the next query consult the operating system again.
+*/
+void QNetworkProxyFactory::clearSystemProxyCache()
+{
+    if (globalNetworkProxy.exists())
+        globalNetworkProxy()->clearSystemProxyCache();
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 QDebug operator<<(QDebug debug, const QNetworkProxy &proxy)
 {
@@ -170,6 +170,7 @@ public:
     static void setApplicationProxyFactory(QNetworkProxyFactory *factory);
     static QList<QNetworkProxy> proxyForQuery(const QNetworkProxyQuery &query);
     static QList<QNetworkProxy> systemProxyForQuery(const QNetworkProxyQuery &query = QNetworkProxyQuery());
+    static void clearSystemProxyCache();
 };
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -435,6 +435,7 @@
 #include "private/qhostinfo_p.h"
 
 #include <qabstracteventdispatcher.h>
+#include <qfiledevice.h>
 #include <qhostaddress.h>
 #include <qhostinfo.h>
 #include <qmetaobject.h>
@@ -517,6 +518,7 @@ void QAbstractSocketPrivate::resetSocketLayer()
 #endif
 
     hasPendingData = false;
+    fileSendState.reset();
     if (socketEngine) {
         socketEngine->close();
         socketEngine->disconnect();
@@ -751,6 +753,10 @@ void QAbstractSocketPrivate::connectionNotification()
 bool QAbstractSocketPrivate::writeToSocket()
 {
     Q_Q(QAbstractSocket);
+    // A queued sendFile() continues once all buffered data is on the wire.
+    if (fileSendState && socketEngine && socketEngine->isValid() && writeBuffer.isEmpty())
+        return writeFileToSocket();
+
     if (!socketEngine || !socketEngine->isValid() || (writeBuffer.isEmpty()
         && socketEngine->bytesToWrite() == 0)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
@@ -769,11 +775,26 @@ bool QAbstractSocketPrivate::writeToSocket()
         return false;
     }
 
-    qint64 nextSize = writeBuffer.nextDataBlockSize();
-    const char *ptr = writeBuffer.readPointer();
+    // Gather the leading blocks of the write buffer so a fragmented buffer
+    // does not cost one system call per block.
+    constexpr int MaxWriteSegments = 16;
+    QAbstractSocketEngine::WriteSegment segments[MaxWriteSegments];
+    int segmentCount = 0;
+    qint64 gatherPos = 0;
+    const qint64 bufferedSize = writeBuffer.size();
+    while (gatherPos < bufferedSize && segmentCount < MaxWriteSegments) {
+        qint64 blockSize;
+        const char *ptr = writeBuffer.readPointerAtPosition(gatherPos, blockSize);
+        segments[segmentCount++] = { ptr, blockSize };
+        gatherPos += blockSize;
+    }
 
     // Attempt to write it all in one chunk.
-    qint64 written = nextSize ? socketEngine->write(ptr, nextSize) : Q_INT64_C(0);
+    qint64 written = 0;
+    if (segmentCount == 1)
+        written = socketEngine->write(segments[0].data, segments[0].size);
+    else if (segmentCount > 1)
+        written = socketEngine->write(segments, segmentCount);
     if (written < 0) {
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug() << "QAbstractSocketPrivate::writeToSocket() write error, aborting."
@@ -796,6 +817,11 @@ bool QAbstractSocketPrivate::writeToSocket()
 
         // Emit notifications.
         emitBytesWritten(written);
+
+        if (writeBufferFull && writeBuffer.size() < writeBufferMaxSize) {
+            writeBufferFull = false;
+            emit q->writeBufferDrained();
+        }
     }
 
     if (writeBuffer.isEmpty() && socketEngine && !socketEngine->bytesToWrite())
@@ -806,6 +832,90 @@ bool QAbstractSocketPrivate::writeToSocket()
     return written > 0;
 }
 
+/*! \internal
+
+    Continues a file transfer queued by QAbstractSocket::sendFile(). Called
+    by writeToSocket() when the write buffer is empty. Uses the socket
+    engine's native file-send path when available; otherwise streams a
+    bounded chunk of the file through the write buffer.
+
+    Emits bytesWritten() for data sent through the native path.
+*/
+bool QAbstractSocketPrivate::writeFileToSocket()
+{
+    Q_Q(QAbstractSocket);
+    FileSendState &fs = *fileSendState;
+    if (!fs.file || !fs.file->isOpen()) {
+        // the device went away mid-transfer; nothing sensible left to send
+        fileSendState.reset();
+        if (writeBuffer.isEmpty() && !socketEngine->bytesToWrite())
+            socketEngine->setWriteNotificationEnabled(false);
+        if (state == QAbstractSocket::ClosingState)
+            q->disconnectFromHost();
+        return false;
+    }
+
+    qint64 written = 0;
+    if (fs.useNativePath) {
+        written = socketEngine->sendFile(fs.nativeHandle, &fs.offset, fs.remaining);
+        if (written == -2) {
+            // the kernel cannot send these descriptors directly; stream instead
+            fs.useNativePath = false;
+            written = 0;
+        } else if (written < 0) {
+#if defined (QABSTRACTSOCKET_DEBUG)
+            qDebug() << "QAbstractSocketPrivate::writeFileToSocket() send error, aborting."
+                     << socketEngine->errorString();
+#endif
+            setErrorAndEmit(socketEngine->error(), socketEngine->errorString());
+            q->abort();
+            return false;
+        } else {
+            fs.remaining -= written;
+            if (written > 0)
+                emitBytesWritten(written);
+        }
+    }
+
+    if (!fs.useNativePath) {
+        // Read the next chunk into the write buffer; the regular
+        // writeToSocket() path drains it and emits bytesWritten().
+        constexpr qint64 SendFileChunkSize = 128 * 1024;
+        const qint64 chunkSize = qMin(fs.remaining, SendFileChunkSize);
+        qint64 readBytes = -1;
+        if (fs.file->seek(fs.offset)) {
+            char *ptr = writeBuffer.reserve(chunkSize);
+            readBytes = fs.file->read(ptr, chunkSize);
+            writeBuffer.chop(chunkSize - qMax(readBytes, Q_INT64_C(0)));
+        }
+        if (readBytes < 0) {
+            fileSendState.reset();
+            setErrorAndEmit(QAbstractSocket::OperationError, fs.file->errorString());
+            return false;
+        }
+        fs.offset += readBytes;
+        fs.remaining -= readBytes;
+        if (readBytes == 0)
+            fs.remaining = 0; // the file ended early; treat the transfer as done
+        written = readBytes;
+    }
+
+#if defined (QABSTRACTSOCKET_DEBUG)
+    qDebug("QAbstractSocketPrivate::writeFileToSocket() %lld bytes, %lld remaining", written,
+           fs.remaining);
+#endif
+
+    if (fs.remaining <= 0) {
+        fileSendState.reset();
+        if (writeBuffer.isEmpty() && !socketEngine->bytesToWrite()) {
+            socketEngine->setWriteNotificationEnabled(false);
+            if (state == QAbstractSocket::ClosingState)
+                q->disconnectFromHost();
+        }
+    }
+    return written > 0;
+}
+
 /*! \internal
 
     Writes pending data in the write buffers to the socket. The function
@@ -816,7 +926,7 @@ bool QAbstractSocketPrivate::flush()
 {
     bool dataWasWritten = false;
 
-    while (!allWriteBuffersEmpty() && writeToSocket())
+    while ((!allWriteBuffersEmpty() || fileSendState) && writeToSocket())
         dataWasWritten = true;
 
     return dataWasWritten;
@@ -1740,7 +1850,10 @@ void QAbstractSocket::connectToHost(const QHostAddress &address, quint16 port,
 */
 qint64 QAbstractSocket::bytesToWrite() const
 {
-    const qint64 pendingBytes = QIODevice::bytesToWrite();
+    Q_D(const QAbstractSocket);
+    qint64 pendingBytes = QIODevice::bytesToWrite();
+    if (d->fileSendState)
+        pendingBytes += d->fileSendState->remaining;
 #if defined(QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocket::bytesToWrite() == %lld", pendingBytes);
 #endif
@@ -2379,6 +2492,75 @@ bool QAbstractSocket::flush()
     return d_func()->flush();
 }
 
+/*!
+    \since 6.9
+
+    Queues \a length bytes of \a file, starting at \a offset, for sending and
+    returns \c true on success. If \a length is -1, the rest of the file from
+    \a offset is sent. The data is transmitted after any data already
+    buffered by write(), and on platforms that support it the bytes are
+    handed from the file to the socket inside the kernel (\c sendfile())
+    without being copied through userspace.
+
+    The transfer proceeds asynchronously once control returns to the event
+    loop; progress is reported through bytesWritten(), and bytesToWrite()
+    includes the unsent remainder of the file. \a file must be open for
+    reading and remain open for the duration of the transfer; its read
+    position is not meaningful while a transfer is active. If the file ends
+    before \a length bytes could be read, the transfer stops at the end of
+    the file.
+
+    The socket must be a connected TCP socket, and only one file can be
+    queued at a time. Calling this function on an encrypted QSslSocket is
+    not supported.
+
+    \sa write(), bytesWritten(), bytesToWrite()
+*/
+bool QAbstractSocket::sendFile(QFileDevice *file, qint64 offset, qint64 length)
+{
+    Q_D(QAbstractSocket);
+#if defined(QABSTRACTSOCKET_DEBUG)
+    qDebug("QAbstractSocket::sendFile(%p, %lld, %lld)", file, offset, length);
+#endif
+    if (!file || !file->isOpen() || !(file->openMode() & QIODevice::ReadOnly)) {
+        qWarning("QAbstractSocket::sendFile: file must be open for reading");
+        return false;
+    }
+    if (offset < 0) {
+        qWarning("QAbstractSocket::sendFile: invalid offset");
+        return false;
+    }
+    if (d->socketType != TcpSocket) {
+        qWarning("QAbstractSocket::sendFile: only supported for TCP sockets");
+        return false;
+    }
+    if (d->state != ConnectedState || !d->socketEngine || !d->socketEngine->isValid()) {
+        qWarning("QAbstractSocket::sendFile: socket is not connected");
+        return false;
+    }
+    if (d->fileSendState) {
+        qWarning("QAbstractSocket::sendFile: another file is already being sent");
+        return false;
+    }
+
+    const qint64 available = file->size() - offset;
+    if (length < 0 || length > available)
+        length = available;
+    if (length <= 0)
+        return true; // nothing to send
+
+    QAbstractSocketPrivate::FileSendState fs;
+    fs.file = file;
+    fs.nativeHandle = file->handle();
+    fs.offset = offset;
+    fs.remaining = length;
+    fs.useNativePath = fs.nativeHandle != -1 && d->socketEngine->supportsNativeFileSend();
+    d->fileSendState.emplace(std::move(fs));
+
+    d->socketEngine->setWriteNotificationEnabled(true);
+    return true;
+}
+
 /*! \reimp
 */
 qint64 QAbstractSocket::readData(char *data, qint64 maxSize)
@@ -2469,6 +2651,16 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
     // We just write to our write buffer and enable the write notifier
     // The write notifier then flush()es the buffer.
 
+    if (d->writeBufferMaxSize > 0) {
+        // Respect the high-water mark: accept only what fits and let the
+        // caller wait for writeBufferDrained() before writing the rest.
+        const qint64 room = d->writeBufferMaxSize - d->writeBuffer.size();
+        if (size > room) {
+            d->writeBufferFull = true;
+            size = qMax(room, Q_INT64_C(0));
+        }
+    }
+
     d->write(data, size);
     qint64 written = size;
 
@@ -2659,7 +2851,7 @@ void QAbstractSocket::disconnectFromHost()
 
         // Wait for pending data to be written.
         if (d->socketEngine && d->socketEngine->isValid() && (!d->allWriteBuffersEmpty()
-            || d->socketEngine->bytesToWrite() > 0)) {
+            || d->fileSendState || d->socketEngine->bytesToWrite() > 0)) {
             d->socketEngine->setWriteNotificationEnabled(true);
 
 #if defined(QABSTRACTSOCKET_DEBUG)
@@ -2749,6 +2941,61 @@ void QAbstractSocket::setReadBufferSize(qint64 size)
     }
 }
 
+/*!
+    \since 6.9
+
+    Returns the high-water mark of the internal write buffer. This
+    limits the amount of data that write() accepts before the data has
+    been transmitted to the network.
+
+    A write buffer size of 0 (the default) means that the buffer has
+    no size limit and write() never writes fewer bytes than requested.
+
+    \sa setWriteBufferSize(), bytesToWrite()
+*/
+qint64 QAbstractSocket::writeBufferSize() const
+{
+    return d_func()->writeBufferMaxSize;
+}
+
+/*!
+    \since 6.9
+
+    Sets the high-water mark of QAbstractSocket's internal write buffer
+    to be \a size bytes.
+
+    If a limit is set, write() accepts at most as many bytes as fit
+    into the buffer and returns the number of bytes actually taken;
+    once the buffer has drained below the limit, writeBufferDrained()
+    is emitted and writing can resume. Use this to keep memory bounded
+    when producing data faster than a slow peer consumes it.
+    Exceptionally, a buffer size of 0 means that the write buffer is
+    unlimited and write() always accepts all data. This is the default.
+
+    The limit only applies to buffered socket types, and only to data
+    that has to be queued: it does not reject data that is handed
+    directly to the operating system.
+
+    \sa writeBufferSize(), write(), bytesToWrite()
+*/
+void QAbstractSocket::setWriteBufferSize(qint64 size)
+{
+    Q_D(QAbstractSocket);
+    d->writeBufferMaxSize = size;
+}
+
+/*!
+    \fn void QAbstractSocket::writeBufferDrained()
+    \since 6.9
+
+    This signal is emitted when a write() was truncated because the
+    write buffer had reached the limit set with setWriteBufferSize(),
+    and enough buffered data has since been transmitted that the buffer
+    is below the limit again.
+
+    \sa setWriteBufferSize(), bytesWritten()
+*/
+
 /*!
     Returns the state of the socket.
 
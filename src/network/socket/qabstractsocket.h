@@ -20,6 +20,7 @@
 QT_BEGIN_NAMESPACE
 
 
+class QFileDevice;
 class QHostAddress;
 #ifndef QT_NO_NETWORKPROXY
 class QNetworkProxy;
@@ -156,6 +157,9 @@ public:
     qint64 readBufferSize() const;
     virtual void setReadBufferSize(qint64 size);
 
+    qint64 writeBufferSize() const;
+    virtual void setWriteBufferSize(qint64 size);
+
     void abort();
 
     virtual qintptr socketDescriptor() const;
@@ -174,6 +178,8 @@ public:
     bool isSequential() const override;
     bool flush();
 
+    bool sendFile(QFileDevice *file, qint64 offset = 0, qint64 length = -1);
+
     // for synchronous access
     virtual bool waitForConnected(int msecs = 30000);
     bool waitForReadyRead(int msecs = 30000) override;
@@ -193,6 +199,7 @@ Q_SIGNALS:
     void disconnected();
     void stateChanged(QAbstractSocket::SocketState);
     void errorOccurred(QAbstractSocket::SocketError);
+    void writeBufferDrained();
 #ifndef QT_NO_NETWORKPROXY
     void proxyAuthenticationRequired(const QNetworkProxy &proxy, QAuthenticator *authenticator);
 #endif
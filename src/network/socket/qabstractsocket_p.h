@@ -20,12 +20,16 @@
 #include "QtCore/qbytearray.h"
 #include "QtCore/qlist.h"
 #include "QtCore/qtimer.h"
+#include "QtCore/qpointer.h"
 #include "private/qiodevice_p.h"
 #include "private/qabstractsocketengine_p.h"
 #include "qnetworkproxy.h"
 
+#include <optional>
+
 QT_BEGIN_NAMESPACE
 
+class QFileDevice;
 class QHostInfo;
 
 class QAbstractSocketPrivate : public QIODevicePrivate, public QAbstractSocketEngineReceiver
@@ -101,13 +105,28 @@ public:
     void fetchConnectionParameters();
     bool readFromSocket();
     virtual bool writeToSocket();
+    bool writeFileToSocket();
     void emitReadyRead(int channel = 0);
     void emitBytesWritten(qint64 bytes, int channel = 0);
 
     void setError(QAbstractSocket::SocketError errorCode, const QString &errorString);
     void setErrorAndEmit(QAbstractSocket::SocketError errorCode, const QString &errorString);
 
+    // An ongoing sendFile(); writeToSocket() drains it once the write buffer
+    // is empty, using the engine's native file-send path where possible and
+    // streaming chunks through the write buffer otherwise.
+    struct FileSendState {
+        QPointer<QFileDevice> file;
+        int nativeHandle = -1;
+        qint64 offset = 0;
+        qint64 remaining = 0;
+        bool useNativePath = false;
+    };
+    std::optional<FileSendState> fileSendState;
+
     qint64 readBufferMaxSize = 0;
+    qint64 writeBufferMaxSize = 0;
+    bool writeBufferFull = false;
     bool isBuffered = false;
     bool hasPendingData = false;
     bool hasPendingDatagram = false;
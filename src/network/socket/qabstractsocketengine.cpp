@@ -233,6 +233,44 @@ int QAbstractSocketEngine::outboundStreamCount() const
     return d_func()->outboundStreamCount;
 }
 
+#ifndef QT_NO_UDPSOCKET
+qsizetype QAbstractSocketEngine::readDatagrams(QList<Datagram> *datagrams, qsizetype maxCount,
+                                               qint64 maxSize, PacketHeaderOptions options)
+{
+    qsizetype count = 0;
+    while (count < maxCount && hasPendingDatagrams()) {
+        qint64 size = pendingDatagramSize();
+        if (size < 0)
+            return count ? count : -1;
+        if (maxSize >= 0 && size > maxSize)
+            size = maxSize;
+        Datagram datagram;
+        datagram.data.resize(size);
+        const qint64 readBytes = readDatagram(datagram.data.data(), size, &datagram.header,
+                                              options);
+        if (readBytes < 0)
+            return count ? count : -1;
+        datagram.data.truncate(readBytes);
+        datagrams->append(std::move(datagram));
+        ++count;
+    }
+    return count;
+}
+
+qsizetype QAbstractSocketEngine::writeDatagrams(const QList<Datagram> &datagrams)
+{
+    qsizetype count = 0;
+    for (const Datagram &datagram : datagrams) {
+        const qint64 sent = writeDatagram(datagram.data.constData(), datagram.data.size(),
+                                          datagram.header);
+        if (sent < 0)
+            return count ? count : -1;
+        ++count;
+    }
+    return count;
+}
+#endif // QT_NO_UDPSOCKET
+
 QT_END_NAMESPACE
 
 #include "moc_qabstractsocketengine_p.cpp"
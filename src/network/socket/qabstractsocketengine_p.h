@@ -109,6 +109,43 @@ public:
     virtual qint64 read(char *data, qint64 maxlen) = 0;
     virtual qint64 write(const char *data, qint64 len) = 0;
 
+    struct WriteSegment
+    {
+        const char *data;
+        qint64 size;
+    };
+    // Writes the \a count segments as if they were one contiguous block,
+    // using as few system calls as the engine allows. The default
+    // implementation loops over write(); engines with scatter/gather I/O
+    // override it.
+    virtual qint64 write(const WriteSegment *segments, int count)
+    {
+        qint64 total = 0;
+        for (int i = 0; i < count; ++i) {
+            const qint64 written = write(segments[i].data, segments[i].size);
+            if (written < 0)
+                return total > 0 ? total : written;
+            total += written;
+            if (written < segments[i].size)
+                break;
+        }
+        return total;
+    }
+
+    // Sends up to \a count bytes from the open file at \a fileHandle directly
+    // to the socket, starting at *offset (which is advanced by the amount
+    // sent). Returns the number of bytes sent (0 if the operation would
+    // block), -1 on error, or -2 if these descriptors cannot be sent
+    // natively and the caller must fall back to buffered writes.
+    virtual bool supportsNativeFileSend() const { return false; }
+    virtual qint64 sendFile(int fileHandle, qint64 *offset, qint64 count)
+    {
+        Q_UNUSED(fileHandle);
+        Q_UNUSED(offset);
+        Q_UNUSED(count);
+        return -2;
+    }
+
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
     virtual bool joinMulticastGroup(const QHostAddress &groupAddress,
@@ -121,6 +158,22 @@ public:
 
     virtual bool hasPendingDatagrams() const = 0;
     virtual qint64 pendingDatagramSize() const = 0;
+
+    struct Datagram
+    {
+        QByteArray data;
+        QIpPacketHeader header;
+    };
+    // Receives up to maxCount pending datagrams of up to maxSize bytes each
+    // (-1: no limit) in a single operation where the platform supports it;
+    // the default implementation reads them one by one. Appends to
+    // \a datagrams and returns the number received, or -1 on error.
+    virtual qsizetype readDatagrams(QList<Datagram> *datagrams, qsizetype maxCount, qint64 maxSize,
+                                    PacketHeaderOptions options);
+    // Sends the given datagrams, coalescing syscalls where the platform
+    // supports it. Returns how many were sent before blocking, or -1 if the
+    // first send failed.
+    virtual qsizetype writeDatagrams(const QList<Datagram> &datagrams);
 #endif // QT_NO_UDPSOCKET
 
     virtual qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader *header = nullptr,
@@ -15,6 +15,7 @@
 #include <qdebug.h>
 #include <qdir.h>
 #include <qdatetime.h>
+#include <qpointer.h>
 
 #include <optional>
 
@@ -93,8 +94,9 @@ bool QLocalServerPrivate::listen(const QString &requestedServerName)
         encodedTempPath = QFile::encodeName(tempDir->path() + "/s"_L1);
     }
 
-    // create the unix socket
-    listenSocket = qt_safe_socket(PF_UNIX, SOCK_STREAM, 0);
+    // create the unix socket; non-blocking so that _q_onNewConnection() can
+    // drain the accept queue without risking a hang on the last accept
+    listenSocket = qt_safe_socket(PF_UNIX, SOCK_STREAM, 0, O_NONBLOCK);
     if (-1 == listenSocket) {
         setError("QLocalServer::listen"_L1);
         closeServer();
@@ -263,16 +265,28 @@ void QLocalServerPrivate::_q_onNewConnection()
     if (-1 == listenSocket)
         return;
 
-    ::sockaddr_un addr;
-    QT_SOCKLEN_T length = sizeof(sockaddr_un);
-    int connectedSocket = qt_safe_accept(listenSocket, (sockaddr *)&addr, &length);
-    if (-1 == connectedSocket) {
-        setError("QLocalSocket::activated"_L1);
-        closeServer();
-    } else {
-        socketNotifier->setEnabled(pendingConnections.size()
-                                   <= maxPendingConnections);
+    // Drain the whole accept queue while we're here: going back to the event
+    // loop between accepts caps the accept rate under connection storms.
+    for (;;) {
+        if (pendingConnections.size() > maxPendingConnections) {
+            socketNotifier->setEnabled(false);
+            return;
+        }
+
+        ::sockaddr_un addr;
+        QT_SOCKLEN_T length = sizeof(sockaddr_un);
+        int connectedSocket = qt_safe_accept(listenSocket, (sockaddr *)&addr, &length);
+        if (-1 == connectedSocket) {
+            if (errno == EWOULDBLOCK || errno == EAGAIN)
+                return; // queue drained
+            setError("QLocalSocket::activated"_L1);
+            closeServer();
+            return;
+        }
+        QPointer<QLocalServer> that = q;
         q->incomingConnection(connectedSocket);
+        if (!that || -1 == listenSocket)
+            return;
     }
 }
 
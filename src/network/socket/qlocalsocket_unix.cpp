@@ -323,7 +323,9 @@ void QLocalSocketPrivate::_q_connectToSocket()
     fullServerName = connectingPathName;
     if (unixSocket.setSocketDescriptor(connectingSocket,
         QAbstractSocket::ConnectedState, connectingOpenMode)) {
-        q->QIODevice::open(connectingOpenMode);
+        // The inner socket already buffers the stream; open our own QIODevice
+        // layer unbuffered so reads aren't copied through a second buffer.
+        q->QIODevice::open(connectingOpenMode | QIODevice::Unbuffered);
         q->emit connected();
     } else {
         QString function = "QLocalSocket::connectToServer"_L1;
@@ -353,7 +355,8 @@ bool QLocalSocket::setSocketDescriptor(qintptr socketDescriptor,
         newSocketState = QAbstractSocket::UnconnectedState;
         break;
     }
-    QIODevice::open(openMode);
+    // see _q_connectToSocket(): the inner socket does the buffering
+    QIODevice::open(openMode | QIODevice::Unbuffered);
     d->state = socketState;
     d->describeSocket(socketDescriptor);
     return d->unixSocket.setSocketDescriptor(socketDescriptor,
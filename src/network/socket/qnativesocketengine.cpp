@@ -882,6 +882,61 @@ qint64 QNativeSocketEngine::write(const char *data, qint64 size)
     return d->nativeWrite(data, size);
 }
 
+#ifndef Q_OS_WIN
+/*!
+    Writes the \a count \a segments to the socket with a single gathering
+    write. Returns the number of bytes written, or -1 if an error occurred.
+*/
+qint64 QNativeSocketEngine::write(const WriteSegment *segments, int count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::write(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::write(), QAbstractSocket::ConnectedState, -1);
+    return d->nativeWritev(segments, count);
+}
+
+bool QNativeSocketEngine::supportsNativeFileSend() const
+{
+#if defined(Q_OS_LINUX) || defined(Q_OS_DARWIN)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/*!
+    Sends up to \a count bytes from the open file at \a fileHandle to the
+    socket, starting at *\a offset, without copying the data through
+    userspace. *\a offset is advanced by the number of bytes sent.
+*/
+qint64 QNativeSocketEngine::sendFile(int fileHandle, qint64 *offset, qint64 count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::sendFile(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::sendFile(), QAbstractSocket::ConnectedState, -1);
+    return d->nativeSendFile(fileHandle, offset, count);
+}
+
+#ifndef QT_NO_UDPSOCKET
+qsizetype QNativeSocketEngine::readDatagrams(QList<Datagram> *datagrams, qsizetype maxCount,
+                                             qint64 maxSize, PacketHeaderOptions options)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::readDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::readDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+    return d->nativeReceiveDatagrams(datagrams, maxCount, maxSize, options);
+}
+
+qsizetype QNativeSocketEngine::writeDatagrams(const QList<Datagram> &datagrams)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeDatagrams(), -1);
+    return d->nativeSendDatagrams(datagrams);
+}
+#endif // QT_NO_UDPSOCKET
+#endif // Q_OS_WIN
+
 
 qint64 QNativeSocketEngine::bytesToWrite() const
 {
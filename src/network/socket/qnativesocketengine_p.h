@@ -124,6 +124,17 @@ public:
     qint64 read(char *data, qint64 maxlen) override;
     qint64 write(const char *data, qint64 len) override;
 
+#ifndef Q_OS_WIN
+    qint64 write(const WriteSegment *segments, int count) override;
+    bool supportsNativeFileSend() const override;
+    qint64 sendFile(int fileHandle, qint64 *offset, qint64 count) override;
+#ifndef QT_NO_UDPSOCKET
+    qsizetype readDatagrams(QList<Datagram> *datagrams, qsizetype maxCount, qint64 maxSize,
+                            PacketHeaderOptions options) override;
+    qsizetype writeDatagrams(const QList<Datagram> &datagrams) override;
+#endif
+#endif
+
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
     bool joinMulticastGroup(const QHostAddress &groupAddress,
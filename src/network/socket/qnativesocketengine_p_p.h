@@ -146,6 +146,16 @@ public:
     qint64 nativeSendDatagram(const char *data, qint64 length, const QIpPacketHeader &header);
     qint64 nativeRead(char *data, qint64 maxLength);
     qint64 nativeWrite(const char *data, qint64 length);
+#ifndef Q_OS_WIN
+    qint64 nativeWritev(const QAbstractSocketEngine::WriteSegment *segments, int count);
+    qint64 nativeSendFile(int fileHandle, qint64 *offset, qint64 count);
+#ifndef QT_NO_UDPSOCKET
+    qsizetype nativeReceiveDatagrams(QList<QAbstractSocketEngine::Datagram> *datagrams,
+                                     qsizetype maxCount, qint64 maxSize,
+                                     QAbstractSocketEngine::PacketHeaderOptions options);
+    qsizetype nativeSendDatagrams(const QList<QAbstractSocketEngine::Datagram> &datagrams);
+#endif
+#endif
     int nativeSelect(QDeadlineTimer deadline, bool selectForRead) const;
     int nativeSelect(QDeadlineTimer deadline, bool checkRead, bool checkWrite,
                      bool *selectForRead, bool *selectForWrite) const;
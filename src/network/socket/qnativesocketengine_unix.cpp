@@ -11,15 +11,16 @@
 #include "qvarlengtharray.h"
 #include "qnetworkinterface.h"
 #include "qendian.h"
+#if defined(Q_OS_LINUX)
+#include <sys/sendfile.h>
+#endif
 #ifdef Q_OS_WASM
 #include <private/qeventdispatcher_wasm_p.h>
 #endif
 #include <time.h>
 #include <errno.h>
 #include <fcntl.h>
-#ifdef Q_OS_INTEGRITY
 #include <sys/uio.h>
-#endif
 
 #if defined QNATIVESOCKETENGINE_DEBUG
 #include <private/qdebug_p.h>
@@ -1003,6 +1004,147 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
     return qint64((maxSize || recvResult < 0) ? recvResult : Q_INT64_C(0));
 }
 
+#ifndef QT_NO_UDPSOCKET
+qsizetype QNativeSocketEnginePrivate::nativeReceiveDatagrams(
+        QList<QAbstractSocketEngine::Datagram> *datagrams, qsizetype maxCount, qint64 maxSize,
+        QAbstractSocketEngine::PacketHeaderOptions options)
+{
+    Q_Q(QNativeSocketEngine);
+#if defined(Q_OS_LINUX)
+    // recvmmsg() can report the sender through msg_name, but anything that
+    // needs ancillary data takes the per-datagram path below.
+    if ((options & ~QAbstractSocketEngine::WantDatagramSender) == 0) {
+        constexpr int MaxBatch = 64;
+        const qint64 bufferSize = maxSize < 0 ? 65535 : qMax(maxSize, Q_INT64_C(1));
+        qsizetype received = 0;
+        while (received < maxCount) {
+            const int batch = int(qMin<qsizetype>(maxCount - received, MaxBatch));
+            QVarLengthArray<QByteArray, MaxBatch> buffers;
+            QVarLengthArray<struct mmsghdr, MaxBatch> messages(batch);
+            QVarLengthArray<struct iovec, MaxBatch> vectors(batch);
+            QVarLengthArray<qt_sockaddr, MaxBatch> addresses(batch);
+            memset(messages.data(), 0, size_t(batch) * sizeof(struct mmsghdr));
+            for (int i = 0; i < batch; ++i) {
+                buffers.append(QByteArray(bufferSize, Qt::Uninitialized));
+                vectors[i].iov_base = buffers[i].data();
+                vectors[i].iov_len = size_t(bufferSize);
+                messages[i].msg_hdr.msg_iov = &vectors[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+                if (options & QAbstractSocketEngine::WantDatagramSender) {
+                    memset(&addresses[i], 0, sizeof(qt_sockaddr));
+                    messages[i].msg_hdr.msg_name = &addresses[i];
+                    messages[i].msg_hdr.msg_namelen = sizeof(qt_sockaddr);
+                }
+            }
+
+            int result;
+            do {
+                result = ::recvmmsg(socketDescriptor, messages.data(), uint(batch), 0, nullptr);
+            } while (result == -1 && errno == EINTR);
+            if (result < 0) {
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+                    if (!received)
+                        return -1;
+                }
+                break;
+            }
+
+            for (int i = 0; i < result; ++i) {
+                QAbstractSocketEngine::Datagram datagram;
+                datagram.data = std::move(buffers[i]);
+                datagram.data.truncate(messages[i].msg_len);
+                if (options & QAbstractSocketEngine::WantDatagramSender) {
+                    qt_socket_getPortAndAddress(&addresses[i], &datagram.header.senderPort,
+                                                &datagram.header.senderAddress);
+                }
+                datagrams->append(std::move(datagram));
+            }
+            received += result;
+            if (result < batch)
+                break; // the receive queue is drained
+        }
+        return received;
+    }
+#endif // Q_OS_LINUX
+    return q->QAbstractSocketEngine::readDatagrams(datagrams, maxCount, maxSize, options);
+}
+
+qsizetype QNativeSocketEnginePrivate::nativeSendDatagrams(
+        const QList<QAbstractSocketEngine::Datagram> &datagrams)
+{
+    Q_Q(QNativeSocketEngine);
+#if defined(Q_OS_LINUX)
+    // sendmmsg() carries only the payload and the destination; datagrams
+    // that need ancillary data (hop limit, source address, stream number)
+    // are sent one at a time.
+    bool plain = true;
+    for (const QAbstractSocketEngine::Datagram &datagram : datagrams) {
+        if (datagram.header.hopLimit != -1 || datagram.header.ifindex != 0
+            || datagram.header.streamNumber != -1 || !datagram.header.senderAddress.isNull()) {
+            plain = false;
+            break;
+        }
+    }
+    if (plain) {
+        constexpr int MaxBatch = 64;
+        qsizetype sent = 0;
+        while (sent < datagrams.size()) {
+            const int batch = int(qMin<qsizetype>(datagrams.size() - sent, MaxBatch));
+            QVarLengthArray<struct mmsghdr, MaxBatch> messages(batch);
+            QVarLengthArray<struct iovec, MaxBatch> vectors(batch);
+            QVarLengthArray<qt_sockaddr, MaxBatch> addresses(batch);
+            memset(messages.data(), 0, size_t(batch) * sizeof(struct mmsghdr));
+            for (int i = 0; i < batch; ++i) {
+                const QAbstractSocketEngine::Datagram &datagram = datagrams.at(sent + i);
+                vectors[i].iov_base = const_cast<char *>(datagram.data.constData());
+                vectors[i].iov_len = size_t(datagram.data.size());
+                messages[i].msg_hdr.msg_iov = &vectors[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+                if (datagram.header.destinationPort != 0) {
+                    memset(&addresses[i], 0, sizeof(qt_sockaddr));
+                    messages[i].msg_hdr.msg_name = &addresses[i].a;
+                    setPortAndAddress(datagram.header.destinationPort,
+                                      datagram.header.destinationAddress, &addresses[i],
+                                      &messages[i].msg_hdr.msg_namelen);
+                }
+            }
+
+            int result;
+            do {
+                result = ::sendmmsg(socketDescriptor, messages.data(), uint(batch), 0);
+            } while (result == -1 && errno == EINTR);
+            if (result < 0) {
+                switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+                case EWOULDBLOCK:
+#endif
+                case EAGAIN:
+                    break;
+                case EMSGSIZE:
+                    setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+                    if (!sent)
+                        return -1;
+                    break;
+                default:
+                    setError(QAbstractSocket::NetworkError, SendDatagramErrorString);
+                    if (!sent)
+                        return -1;
+                    break;
+                }
+                break;
+            }
+            sent += result;
+            if (result < batch)
+                break; // the send buffer is full
+        }
+        return sent;
+    }
+#endif // Q_OS_LINUX
+    return q->QAbstractSocketEngine::writeDatagrams(datagrams);
+}
+#endif // QT_NO_UDPSOCKET
+
 qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
 {
     // we use quintptr to force the alignment
@@ -1297,6 +1439,131 @@ qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
 
     return qint64(writtenBytes);
 }
+
+qint64 QNativeSocketEnginePrivate::nativeWritev(const QAbstractSocketEngine::WriteSegment *segments,
+                                                int count)
+{
+    Q_Q(QNativeSocketEngine);
+
+    QVarLengthArray<struct iovec, 16> vec(count);
+    for (int i = 0; i < count; ++i) {
+        vec[i].iov_base = const_cast<char *>(segments[i].data);
+        vec[i].iov_len = size_t(segments[i].size);
+    }
+
+    ssize_t writtenBytes;
+    qt_ignore_sigpipe();
+    QT_EINTR_LOOP(writtenBytes, ::writev(socketDescriptor, vec.constData(), count));
+
+    if (writtenBytes < 0) {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+#if EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            writtenBytes = 0;
+            break;
+        default:
+            break;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWritev(%p, %i) == %i", segments, count,
+           (int) writtenBytes);
+#endif
+
+    return qint64(writtenBytes);
+}
+
+qint64 QNativeSocketEnginePrivate::nativeSendFile(int fileHandle, qint64 *offset, qint64 count)
+{
+    qint64 writtenBytes;
+#if defined(Q_OS_LINUX)
+    Q_Q(QNativeSocketEngine);
+    off_t off = off_t(*offset);
+    ssize_t sent;
+    do {
+        sent = ::sendfile(socketDescriptor, fileHandle, &off, size_t(count));
+    } while (sent == -1 && errno == EINTR);
+
+    if (sent >= 0) {
+        *offset = qint64(off);
+        writtenBytes = qint64(sent);
+    } else {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+#if EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            writtenBytes = 0;
+            break;
+        case EINVAL:
+        case ENOSYS:
+        case EOPNOTSUPP:
+            // the kernel cannot splice these descriptors, e.g. the file
+            // lives on a filesystem without mmap support
+            writtenBytes = -2;
+            break;
+        default:
+            writtenBytes = -1;
+            break;
+        }
+    }
+#elif defined(Q_OS_DARWIN)
+    Q_Q(QNativeSocketEngine);
+    // Darwin's sendfile() reports partial progress through len, also when
+    // failing with EAGAIN or EINTR.
+    off_t len = off_t(count);
+    const int result = ::sendfile(fileHandle, socketDescriptor, off_t(*offset), &len, nullptr, 0);
+    if (result == 0 || errno == EAGAIN || errno == EINTR) {
+        *offset += qint64(len);
+        writtenBytes = qint64(len);
+    } else {
+        switch (errno) {
+        case EPIPE:
+        case ENOTCONN:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+        case EINVAL:
+        case ENOSYS:
+        case EOPNOTSUPP:
+            writtenBytes = -2;
+            break;
+        default:
+            writtenBytes = -1;
+            break;
+        }
+    }
+#else
+    Q_UNUSED(fileHandle);
+    Q_UNUSED(offset);
+    Q_UNUSED(count);
+    writtenBytes = -2;
+#endif
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeSendFile(%i, %lli, %lli) == %lli", fileHandle,
+           *offset, count, writtenBytes);
+#endif
+
+    return writtenBytes;
+}
+
 /*
 */
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
@@ -441,6 +441,161 @@ QNetworkDatagram QUdpSocket::receiveDatagram(qint64 maxSize)
     return result;
 }
 
+/*!
+    \since 6.9
+    \overload
+
+    Receives a datagram no larger than \a maxSize bytes into \a datagram,
+    reusing its existing buffer and metadata storage, and returns the size
+    of the received payload, or -1 on failure.
+
+    This overload is intended for high packet-rate receive loops: passing
+    the same QNetworkDatagram object to every call recycles its payload
+    buffer, so once the buffer has grown to the size of the largest
+    datagram seen, no further memory is allocated per packet. (This
+    requires that the caller does not keep copies of the datagram or of
+    its \l{QNetworkDatagram::}{data()} between calls, as that would force
+    the next call to reallocate.)
+
+    If \a maxSize is too small, the rest of the datagram will be lost. If
+    \a maxSize is 0, the datagram will be discarded. If \a maxSize is -1
+    (the default), this function will attempt to read the entire datagram.
+
+    \sa writeDatagram(), hasPendingDatagrams(), pendingDatagramSize()
+*/
+qint64 QUdpSocket::receiveDatagram(QNetworkDatagram *datagram, qint64 maxSize)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::receiveDatagram(%p, %lld)", datagram, maxSize);
+#endif
+    QT_CHECK_BOUND("QUdpSocket::receiveDatagram()", -1);
+
+    if (maxSize < 0)
+        maxSize = d->socketEngine->pendingDatagramSize();
+    if (maxSize < 0)
+        return -1;
+
+    if (!datagram->d) // was moved from
+        datagram->d = new QNetworkDatagramPrivate;
+
+    QByteArray &buffer = datagram->d->data;
+    buffer.resize(maxSize);
+    qint64 readBytes = d->socketEngine->readDatagram(buffer.data(), maxSize, &datagram->d->header,
+                                                     QAbstractSocketEngine::WantAll);
+    d->hasPendingData = false;
+    d->hasPendingDatagram = false;
+    d->socketEngine->setReadNotificationEnabled(true);
+    if (readBytes < 0) {
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+        buffer.truncate(0);
+        return -1;
+    }
+
+    buffer.truncate(readBytes);
+    return readBytes;
+}
+
+/*!
+    \since 6.9
+
+    Receives up to \a maxCount pending datagrams, each no larger than
+    \a maxSize bytes, and returns them in a list. On platforms that support
+    it (\c{recvmmsg()} on Linux) multiple datagrams are received in one
+    system call, so datagram-heavy applications process far more packets
+    per second than with repeated receiveDatagram() calls.
+
+    Each returned datagram carries its sender's address and port; unlike
+    receiveDatagram(), the destination address and hop count are not
+    reported. If \a maxSize is -1 (the default), entire datagrams are
+    received; otherwise the rest of a larger datagram is lost.
+
+    Returns an empty list if no datagrams were available or an error
+    occurred.
+
+    \sa receiveDatagram(), writeDatagrams(), hasPendingDatagrams()
+*/
+QList<QNetworkDatagram> QUdpSocket::receiveDatagrams(qsizetype maxCount, qint64 maxSize)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::receiveDatagrams(%lld, %lld)", qint64(maxCount), maxSize);
+#endif
+    QT_CHECK_BOUND("QUdpSocket::receiveDatagrams()", QList<QNetworkDatagram>());
+
+    QList<QAbstractSocketEngine::Datagram> raw;
+    const qsizetype received = d->socketEngine->readDatagrams(
+            &raw, maxCount, maxSize, QAbstractSocketEngine::WantDatagramSender);
+    d->hasPendingData = false;
+    d->hasPendingDatagram = false;
+    d->socketEngine->setReadNotificationEnabled(true);
+    if (received < 0) {
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+        return QList<QNetworkDatagram>();
+    }
+
+    QList<QNetworkDatagram> result;
+    result.reserve(raw.size());
+    for (QAbstractSocketEngine::Datagram &datagram : raw) {
+        QNetworkDatagram converted(std::move(datagram.data));
+        converted.d->header = datagram.header;
+        result.append(std::move(converted));
+    }
+    return result;
+}
+
+/*!
+    \since 6.9
+
+    Sends the given \a datagrams, coalescing them into as few system calls
+    as the platform allows (\c{sendmmsg()} on Linux). The destination of
+    each datagram is taken from its header, like with
+    \l{writeDatagram(const QNetworkDatagram &datagram)}{writeDatagram()};
+    datagrams that set a hop limit or source address are sent individually.
+
+    Returns the number of datagrams sent, which can be smaller than the
+    size of the list if the send buffer filled up, or -1 if the first send
+    failed. bytesWritten() is emitted for the data that was sent.
+
+    \sa writeDatagram(), receiveDatagrams()
+*/
+qsizetype QUdpSocket::writeDatagrams(const QList<QNetworkDatagram> &datagrams)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::writeDatagrams(%lld datagrams)", qint64(datagrams.size()));
+#endif
+    if (datagrams.isEmpty())
+        return 0;
+    if (!d->doEnsureInitialized(QHostAddress::Any, 0, datagrams.first().destinationAddress()))
+        return -1;
+    if (state() == UnconnectedState)
+        bind();
+
+    QList<QAbstractSocketEngine::Datagram> raw;
+    raw.reserve(datagrams.size());
+    for (const QNetworkDatagram &datagram : datagrams)
+        raw.append({ datagram.d->data, datagram.d->header });
+
+    const qsizetype sent = d->socketEngine->writeDatagrams(raw);
+    d->cachedSocketDescriptor = d->socketEngine->socketDescriptor();
+
+    if (sent < 0) {
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+        return -1;
+    }
+
+    qint64 sentBytes = 0;
+    for (qsizetype i = 0; i < sent; ++i)
+        sentBytes += datagrams.at(i).d->data.size();
+    if (sentBytes > 0)
+        emit bytesWritten(sentBytes);
+    return sent;
+}
+
 /*!
     Receives a datagram no larger than \a maxSize bytes and stores
     it in \a data. The sender's host address and port is stored in
@@ -10,6 +10,14 @@
 #include "qmutex.h"
 #include "qdebug.h"
 
+#include <QtCore/qdatastream.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qsavefile.h>
+
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 QT_IMPL_METATYPE_EXTERN(QSslConfiguration)
@@ -815,6 +823,194 @@ int QSslConfiguration::sessionTicketLifeTimeHint() const
     return d->sslSessionTicketLifeTimeHint;
 }
 
+namespace {
+struct QTlsPersistentSessionStore
+{
+    static constexpr quint32 FileMagic = 0x51'54'4c'53;     // "QTLS"
+    static constexpr quint32 FileVersion = 1;
+    static constexpr qsizetype MaxEntries = 4096;
+    // for servers that don't send a lifetime hint; RFC 5077 tickets are
+    // meant to be short-lived, so be conservative
+    static constexpr int DefaultLifeTime = 3600;            // seconds
+
+    struct Entry
+    {
+        QByteArray ticket;
+        qint64 expiresAt = 0;   // msecs since the epoch
+    };
+
+    QString path;
+    QHash<QString, Entry> entries;
+    bool loaded = false;
+    QMutex mutex;
+
+    static QString key(const QString &host, quint16 port)
+    {
+        return host.toLower() + u':' + QString::number(port);
+    }
+
+    // the remaining functions require the mutex to be held:
+
+    void ensureLoaded()
+    {
+        if (loaded)
+            return;
+        loaded = true;
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly))
+            return;
+        QDataStream stream(&file);
+        quint32 magic = 0, version = 0, count = 0;
+        stream >> magic >> version >> count;
+        if (magic != FileMagic || version != FileVersion)
+            return;
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+            QString key;
+            Entry entry;
+            stream >> key >> entry.ticket >> entry.expiresAt;
+            if (entry.expiresAt > now)
+                entries.insert(key, entry);
+        }
+        if (stream.status() != QDataStream::Ok)
+            entries.clear();
+    }
+
+    void save()
+    {
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly))
+            return;
+        QDataStream stream(&file);
+        stream << FileMagic << FileVersion << quint32(entries.size());
+        for (auto it = entries.cbegin(), end = entries.cend(); it != end; ++it)
+            stream << it.key() << it.value().ticket << it.value().expiresAt;
+        // the tickets allow resuming (and thus decrypting) the sessions they
+        // belong to, so keep the file private to the owner instead of relying
+        // on the process's umask
+        file.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner);
+        file.commit();
+    }
+
+    void prune(qint64 now)
+    {
+        for (auto it = entries.begin(); it != entries.end(); ) {
+            if (it.value().expiresAt <= now)
+                it = entries.erase(it);
+            else
+                ++it;
+        }
+        // the store is bounded; evict the soonest-expiring entries first
+        while (entries.size() >= MaxEntries) {
+            auto soonest = std::min_element(entries.begin(), entries.end(),
+                                            [](const Entry &lhs, const Entry &rhs) {
+                                                return lhs.expiresAt < rhs.expiresAt;
+                                            });
+            entries.erase(soonest);
+        }
+    }
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QTlsPersistentSessionStore, theTlsSessionStore)
+
+/*!
+    \since 6.9
+
+    Returns the path of the file used to persist TLS session tickets
+    across process restarts, or an empty string if no persistent session
+    store has been set.
+
+    \sa setPersistentSessionStorePath()
+*/
+QString QSslConfiguration::persistentSessionStorePath()
+{
+    const auto store = theTlsSessionStore();
+    QMutexLocker locker(&store->mutex);
+    return store->path;
+}
+
+/*!
+    \since 6.9
+
+    Sets \a path as the file used to persist TLS session tickets across
+    process restarts and enables the persistent session store. Once set,
+    session tickets received by client-side QSslSocket connections are
+    saved to the file, keyed by peer host and port together with the
+    expiry derived from the server's life time hint, and
+    QSslSocket::connectToHostEncrypted() resumes a stored session with
+    the peer when one is available. A stored ticket is used at most once.
+    Setting an empty path disables the store.
+
+    This allows a freshly started process to resume the TLS sessions its
+    predecessor had established, avoiding the latency and CPU cost of
+    full handshakes after a restart.
+
+    \note Anyone with knowledge of a session ticket can eavesdrop on the
+    data encrypted with the session parameters, so the file must be given
+    the same protection as a private key. The store creates it readable
+    and writable only by the owning user; take care not to widen those
+    permissions, and prefer a directory that is itself access-protected.
+
+    \sa persistentSessionStorePath(), sessionTicket(),
+    QSslSocket::newSessionTicketReceived()
+*/
+void QSslConfiguration::setPersistentSessionStorePath(const QString &path)
+{
+    const auto store = theTlsSessionStore();
+    QMutexLocker locker(&store->mutex);
+    if (store->path == path)
+        return;
+    store->path = path;
+    store->entries.clear();
+    store->loaded = false;
+}
+
+bool QSslConfigurationPrivate::persistentSessionStoreEnabled()
+{
+    const auto store = theTlsSessionStore();
+    QMutexLocker locker(&store->mutex);
+    return !store->path.isEmpty();
+}
+
+QByteArray QSslConfigurationPrivate::takeStoredSessionTicket(const QString &host, quint16 port)
+{
+    const auto store = theTlsSessionStore();
+    QMutexLocker locker(&store->mutex);
+    if (store->path.isEmpty())
+        return {};
+    store->ensureLoaded();
+    const auto it = store->entries.constFind(QTlsPersistentSessionStore::key(host, port));
+    if (it == store->entries.cend())
+        return {};
+    // tickets are single-use; TLS 1.3 servers may reject replayed ones
+    QByteArray ticket = it.value().ticket;
+    if (it.value().expiresAt <= QDateTime::currentMSecsSinceEpoch())
+        ticket.clear();
+    store->entries.erase(it);
+    store->save();
+    return ticket;
+}
+
+void QSslConfigurationPrivate::storeSessionTicket(const QString &host, quint16 port,
+                                                  const QByteArray &ticket, int lifeTimeHint)
+{
+    if (ticket.isEmpty())
+        return;
+    const auto store = theTlsSessionStore();
+    QMutexLocker locker(&store->mutex);
+    if (store->path.isEmpty())
+        return;
+    store->ensureLoaded();
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    store->prune(now);
+    const int lifeTime = lifeTimeHint > 0 ? lifeTimeHint
+                                          : QTlsPersistentSessionStore::DefaultLifeTime;
+    store->entries.insert(QTlsPersistentSessionStore::key(host, port),
+                          { ticket, now + lifeTime * qint64(1000) });
+    store->save();
+}
+
 /*!
    \since 5.7
 
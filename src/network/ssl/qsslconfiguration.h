@@ -125,6 +125,9 @@ public:
     static QSslConfiguration defaultConfiguration();
     static void setDefaultConfiguration(const QSslConfiguration &configuration);
 
+    static QString persistentSessionStorePath();
+    static void setPersistentSessionStorePath(const QString &path);
+
 #if QT_CONFIG(dtls) || defined(Q_QDOC)
     bool dtlsCookieVerificationEnabled() const;
     void setDtlsCookieVerificationEnabled(bool enable);
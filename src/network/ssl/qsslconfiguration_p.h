@@ -46,6 +46,12 @@ QT_BEGIN_NAMESPACE
 class QSslConfigurationPrivate: public QSharedData
 {
 public:
+    // the persistent TLS session ticket store, see QSslConfiguration::setPersistentSessionStorePath()
+    static bool persistentSessionStoreEnabled();
+    static QByteArray takeStoredSessionTicket(const QString &host, quint16 port);
+    static void storeSessionTicket(const QString &host, quint16 port,
+                                   const QByteArray &ticket, int lifeTimeHint);
+
     QSslConfigurationPrivate()
         : sessionProtocol(QSsl::UnknownProtocol),
           protocol(QSsl::SecureProtocols),
@@ -404,6 +404,16 @@ QSslSocket::QSslSocket(QObject *parent)
 #endif
     d->q_ptr = this;
     d->init();
+
+    // If a persistent session store is configured, feed it the tickets we receive
+    connect(this, &QSslSocket::newSessionTicketReceived, this, [this]() {
+        Q_D(QSslSocket);
+        if (QSslConfigurationPrivate::persistentSessionStoreEnabled()) {
+            QSslConfigurationPrivate::storeSessionTicket(
+                    peerName(), peerPort(), d->configuration.sslSession,
+                    d->configuration.sslSessionTicketLifeTimeHint);
+        }
+    });
 }
 
 /*!
@@ -502,6 +512,7 @@ void QSslSocket::connectToHostEncrypted(const QString &hostName, quint16 port, O
     d->init();
     d->autoStartHandshake = true;
     d->initialized = true;
+    d->resumePersistentSession(hostName, port);
 
     // Note: When connecting to localhost, some platforms (e.g., HP-UX and some BSDs)
     // establish the connection immediately (i.e., first attempt).
@@ -540,6 +551,7 @@ void QSslSocket::connectToHostEncrypted(const QString &hostName, quint16 port,
     d->autoStartHandshake = true;
     d->initialized = true;
     d->verificationPeerName = sslPeerName;
+    d->resumePersistentSession(hostName, port);
 
     // Note: When connecting to localhost, some platforms (e.g., HP-UX and some BSDs)
     // establish the connection immediately (i.e., first attempt).
@@ -2060,6 +2072,26 @@ void QSslSocketPrivate::init()
     }
 }
 
+/*!
+    \internal
+
+    Resumes a TLS session with \a hostName and \a port from the persistent
+    session store, if one is configured and the user did not already supply
+    a session ticket of their own.
+
+    \sa QSslConfiguration::setPersistentSessionStorePath()
+*/
+void QSslSocketPrivate::resumePersistentSession(const QString &hostName, quint16 port)
+{
+    if (!QSslConfigurationPrivate::persistentSessionStoreEnabled())
+        return;
+
+    // the backend neither uses nor stores tickets with persistence disabled
+    configuration.sslOptions.setFlag(QSsl::SslOptionDisableSessionPersistence, false);
+    if (configuration.sslSession.isEmpty())
+        configuration.sslSession = QSslConfigurationPrivate::takeStoredSessionTicket(hostName, port);
+}
+
 /*!
     \internal
 */
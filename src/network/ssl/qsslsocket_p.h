@@ -46,6 +46,7 @@ public:
     virtual ~QSslSocketPrivate();
 
     void init();
+    void resumePersistentSession(const QString &hostName, quint16 port);
     bool verifyProtocolSupported(const char *where);
     bool initialized;
 
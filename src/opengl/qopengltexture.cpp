@@ -12,6 +12,8 @@
 #include <private/qobject_p.h>
 #include <private/qopenglcontext_p.h>
 
+#include <cstring>
+
 QT_BEGIN_NAMESPACE
 
 //this is to work around GL_TEXTURE_WRAP_R_OES which also has 0x8072 as value
@@ -19,6 +21,32 @@ QT_BEGIN_NAMESPACE
     #define GL_TEXTURE_WRAP_R 0x8072
 #endif
 
+// Constants used by setDataAsync() that are absent from OpenGL ES 2 headers
+#ifndef GL_PIXEL_UNPACK_BUFFER
+    #define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+#ifndef GL_MAP_WRITE_BIT
+    #define GL_MAP_WRITE_BIT 0x0002
+#endif
+#ifndef GL_MAP_INVALIDATE_BUFFER_BIT
+    #define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+    #define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+    #define GL_MAP_COHERENT_BIT 0x0080
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+    #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+    #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif
+#ifndef GL_TIMEOUT_IGNORED
+    #define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+#endif
+
 QOpenGLTexturePrivate::QOpenGLTexturePrivate(QOpenGLTexture::Target textureTarget,
                                              QOpenGLTexture *qq)
     : q_ptr(qq),
@@ -48,7 +76,10 @@ QOpenGLTexturePrivate::QOpenGLTexturePrivate(QOpenGLTexture::Target textureTarge
       autoGenerateMipMaps(true),
       storageAllocated(false),
       texFuncs(nullptr),
-      functions(nullptr)
+      functions(nullptr),
+      asyncUploadIndex(0),
+      bufferStorageResolved(false),
+      bufferStorageFn(nullptr)
 {
     dimensions[0] = dimensions[1] = dimensions[2] = 1;
 
@@ -172,6 +203,8 @@ void QOpenGLTexturePrivate::destroy()
         return;
     }
 
+    destroyAsyncUploadRing();
+
     functions->glDeleteTextures(1, &textureId);
 
     context = nullptr;
@@ -1683,6 +1716,234 @@ void QOpenGLTexturePrivate::setCompressedData(int mipLevel, int layer, int layer
     }
 }
 
+static int packedPixelTypeSize(QOpenGLTexture::PixelType pixelType)
+{
+    switch (pixelType) {
+    case QOpenGLTexture::UInt8_RG3B2:
+    case QOpenGLTexture::UInt8_RG3B2_Rev:
+        return 1;
+    case QOpenGLTexture::UInt16_RGB5A1:
+    case QOpenGLTexture::UInt16_RGB5A1_Rev:
+    case QOpenGLTexture::UInt16_R5G6B5:
+    case QOpenGLTexture::UInt16_R5G6B5_Rev:
+    case QOpenGLTexture::UInt16_RGBA4:
+    case QOpenGLTexture::UInt16_RGBA4_Rev:
+        return 2;
+    case QOpenGLTexture::UInt32_RGBA8:
+    case QOpenGLTexture::UInt32_RGBA8_Rev:
+    case QOpenGLTexture::UInt32_RGB10A2:
+    case QOpenGLTexture::UInt32_RGB10A2_Rev:
+    case QOpenGLTexture::UInt32_RG11B10F:
+    case QOpenGLTexture::UInt32_RGB9_E5:
+    case QOpenGLTexture::UInt32_D24S8:
+        return 4;
+    case QOpenGLTexture::Float32_D32_UInt32_S8_X24:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+static int pixelTypeComponentSize(QOpenGLTexture::PixelType pixelType)
+{
+    switch (pixelType) {
+    case QOpenGLTexture::Int8:
+    case QOpenGLTexture::UInt8:
+        return 1;
+    case QOpenGLTexture::Int16:
+    case QOpenGLTexture::UInt16:
+    case QOpenGLTexture::Float16:
+    case QOpenGLTexture::Float16OES:
+        return 2;
+    case QOpenGLTexture::Int32:
+    case QOpenGLTexture::UInt32:
+    case QOpenGLTexture::Float32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static int pixelFormatComponentCount(QOpenGLTexture::PixelFormat pixelFormat)
+{
+    switch (pixelFormat) {
+    case QOpenGLTexture::Red:
+    case QOpenGLTexture::Red_Integer:
+    case QOpenGLTexture::Stencil:
+    case QOpenGLTexture::Depth:
+    case QOpenGLTexture::Alpha:
+    case QOpenGLTexture::Luminance:
+        return 1;
+    case QOpenGLTexture::RG:
+    case QOpenGLTexture::RG_Integer:
+    case QOpenGLTexture::LuminanceAlpha:
+        return 2;
+    case QOpenGLTexture::RGB:
+    case QOpenGLTexture::BGR:
+    case QOpenGLTexture::RGB_Integer:
+    case QOpenGLTexture::BGR_Integer:
+        return 3;
+    case QOpenGLTexture::RGBA:
+    case QOpenGLTexture::BGRA:
+    case QOpenGLTexture::RGBA_Integer:
+    case QOpenGLTexture::BGRA_Integer:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+qsizetype QOpenGLTexturePrivate::sourceDataSize(int mipLevel, QOpenGLTexture::PixelFormat sourceFormat,
+                                                QOpenGLTexture::PixelType sourceType,
+                                                const QOpenGLPixelTransferOptions * const options) const
+{
+    // Skip-based transfers reference caller memory outside the uploaded
+    // rectangle; leave those to the synchronous path.
+    if (options && (options->skipImages() || options->skipRows() || options->skipPixels()))
+        return 0;
+
+    int bytesPerPixel = packedPixelTypeSize(sourceType);
+    if (!bytesPerPixel) {
+        const int componentSize = pixelTypeComponentSize(sourceType);
+        const int componentCount = pixelFormatComponentCount(sourceFormat);
+        if (!componentSize || !componentCount)
+            return 0;
+        bytesPerPixel = componentSize * componentCount;
+    }
+
+    int width = mipLevelSize(mipLevel, dimensions[0]);
+    if (options && options->rowLength() > 0)
+        width = options->rowLength();
+    int height = 1;
+    int depth = 1;
+    switch (target) {
+    case QOpenGLTexture::Target1D:
+    case QOpenGLTexture::Target1DArray:
+        break;
+    case QOpenGLTexture::Target2D:
+    case QOpenGLTexture::Target2DArray:
+    case QOpenGLTexture::TargetCubeMap:
+    case QOpenGLTexture::TargetCubeMapArray:
+        height = mipLevelSize(mipLevel, dimensions[1]);
+        break;
+    case QOpenGLTexture::Target3D:
+        height = mipLevelSize(mipLevel, dimensions[1]);
+        depth = mipLevelSize(mipLevel, dimensions[2]);
+        break;
+    case QOpenGLTexture::TargetRectangle:
+        height = dimensions[1];
+        break;
+    default:
+        return 0;
+    }
+    if (options && options->imageHeight() > 0 && depth > 1)
+        height = options->imageHeight();
+
+    const int alignment = options ? options->alignment() : 4;
+    const qsizetype bytesPerRow = (qsizetype(width) * bytesPerPixel + alignment - 1)
+                                  & ~qsizetype(alignment - 1);
+    return bytesPerRow * height * depth;
+}
+
+bool QOpenGLTexturePrivate::setDataAsync(int mipLevel, int layer, QOpenGLTexture::CubeMapFace cubeFace,
+                                         QOpenGLTexture::PixelFormat sourceFormat,
+                                         QOpenGLTexture::PixelType sourceType,
+                                         const void *data, const QOpenGLPixelTransferOptions * const options)
+{
+    QOpenGLContext *ctx = QOpenGLContext::currentContext();
+    if (!ctx || ctx->format().majorVersion() < 3)
+        return false;
+
+    const qsizetype dataSize = sourceDataSize(mipLevel, sourceFormat, sourceType, options);
+    if (dataSize <= 0)
+        return false;
+
+    QOpenGLExtraFunctions *xfuncs = ctx->extraFunctions();
+
+    if (!bufferStorageResolved) {
+        bufferStorageResolved = true;
+        if (ctx->hasExtension(QByteArrayLiteral("GL_ARB_buffer_storage"))
+            || (!ctx->isOpenGLES() && ctx->format().version() >= qMakePair(4, 4))) {
+            bufferStorageFn = reinterpret_cast<void (QOPENGLF_APIENTRYP)(GLenum, GLsizeiptr, const void *, GLbitfield)>(
+                ctx->getProcAddress("glBufferStorage"));
+        } else if (ctx->hasExtension(QByteArrayLiteral("GL_EXT_buffer_storage"))) {
+            bufferStorageFn = reinterpret_cast<void (QOPENGLF_APIENTRYP)(GLenum, GLsizeiptr, const void *, GLbitfield)>(
+                ctx->getProcAddress("glBufferStorageEXT"));
+        }
+    }
+
+    AsyncUploadBuffer &staging = asyncUploadRing[asyncUploadIndex];
+    asyncUploadIndex = (asyncUploadIndex + 1) % AsyncUploadRingSize;
+
+    // Wait until the driver has finished reading from this staging buffer.
+    // With a deep enough ring this returns immediately in steady state.
+    if (staging.fence) {
+        xfuncs->glClientWaitSync(staging.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        xfuncs->glDeleteSync(staging.fence);
+        staging.fence = nullptr;
+    }
+
+    if (!staging.pbo)
+        functions->glGenBuffers(1, &staging.pbo);
+    functions->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging.pbo);
+
+    if (staging.size < dataSize) {
+        if (bufferStorageFn) {
+            // Immutable storage cannot be reallocated; create a fresh buffer
+            // and keep it persistently mapped.
+            if (staging.persistentPtr) {
+                functions->glDeleteBuffers(1, &staging.pbo);
+                functions->glGenBuffers(1, &staging.pbo);
+                functions->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging.pbo);
+                staging.persistentPtr = nullptr;
+            }
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            bufferStorageFn(GL_PIXEL_UNPACK_BUFFER, dataSize, nullptr, flags);
+            staging.persistentPtr = xfuncs->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, dataSize, flags);
+        } else {
+            functions->glBufferData(GL_PIXEL_UNPACK_BUFFER, dataSize, nullptr, GL_STREAM_DRAW);
+        }
+        staging.size = dataSize;
+    }
+
+    if (staging.persistentPtr) {
+        memcpy(staging.persistentPtr, data, dataSize);
+    } else {
+        void *mapped = xfuncs->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, dataSize,
+                                                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (!mapped) {
+            functions->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return false;
+        }
+        memcpy(mapped, data, dataSize);
+        xfuncs->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    // With the pixel unpack buffer bound the data argument becomes an offset
+    // into the buffer, so the regular upload path sources from the PBO.
+    setData(mipLevel, layer, 1, cubeFace, sourceFormat, sourceType, nullptr, options);
+
+    staging.fence = xfuncs->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    functions->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return true;
+}
+
+void QOpenGLTexturePrivate::destroyAsyncUploadRing()
+{
+    QOpenGLContext *ctx = QOpenGLContext::currentContext();
+    for (AsyncUploadBuffer &staging : asyncUploadRing) {
+        if (staging.fence && ctx)
+            ctx->extraFunctions()->glDeleteSync(staging.fence);
+        staging.fence = nullptr;
+        if (staging.pbo && functions)
+            functions->glDeleteBuffers(1, &staging.pbo); // implicitly unmaps
+        staging.pbo = 0;
+        staging.persistentPtr = nullptr;
+        staging.size = 0;
+    }
+    asyncUploadIndex = 0;
+}
+
 void QOpenGLTexturePrivate::setWrapMode(QOpenGLTexture::WrapMode mode)
 {
     switch (target) {
@@ -3652,6 +3913,70 @@ void QOpenGLTexture::setData(const QImage& image, MipMapGeneration genMipMaps)
     setData(0, QOpenGLTexture::RGBA, QOpenGLTexture::UInt8, glImage.constBits(), &uploadOptions);
 }
 
+/*!
+    Uploads pixel \a data for this texture object \a mipLevel, array \a layer, and
+    \a cubeFace without serializing on the driver-side copy.
+
+    The data is first copied into an internal ring of staging pixel unpack
+    buffers, so the memory pointed to by \a data can be reused or freed as soon
+    as this function returns. The transfer from the staging buffer into the
+    texture is performed by the driver and may overlap with rendering; a fence
+    is used to recycle each staging buffer only once the driver has finished
+    reading from it. This makes the function suitable for streaming textures,
+    for example pushing video frames every frame.
+
+    The structure of the pixel data pointed to by \a data is specified by
+    \a sourceFormat and \a sourceType. The pixel data upload can optionally be
+    controlled by \a options.
+
+    The asynchronous path requires an OpenGL 3.0 or OpenGL ES 3.0 context.
+    When that is not available, or when the combination of \a sourceFormat,
+    \a sourceType and \a options is not supported by it, this function falls
+    back to a synchronous setData() call. When \c GL_ARB_buffer_storage is
+    available the staging buffers are persistently mapped, avoiding a
+    map/unmap round trip per upload.
+
+    Storage must have been allocated before uploading pixel data.
+
+    \since 6.9
+    \sa setData()
+*/
+void QOpenGLTexture::setDataAsync(int mipLevel, int layer, CubeMapFace cubeFace,
+                                  PixelFormat sourceFormat, PixelType sourceType,
+                                  const void *data, const QOpenGLPixelTransferOptions * const options)
+{
+    Q_D(QOpenGLTexture);
+    Q_ASSERT(d->textureId);
+    if (!isStorageAllocated()) {
+        qWarning("Cannot set data on a texture that does not have storage allocated.\n"
+                 "To do so call allocateStorage() before this function");
+        return;
+    }
+    if (!d->setDataAsync(mipLevel, layer, cubeFace, sourceFormat, sourceType, data, options))
+        d->setData(mipLevel, layer, 1, cubeFace, sourceFormat, sourceType, data, options);
+}
+
+/*!
+    \since 6.9
+    \overload
+*/
+void QOpenGLTexture::setDataAsync(int mipLevel,
+                                  PixelFormat sourceFormat, PixelType sourceType,
+                                  const void *data, const QOpenGLPixelTransferOptions * const options)
+{
+    setDataAsync(mipLevel, 0, QOpenGLTexture::CubeMapPositiveX, sourceFormat, sourceType, data, options);
+}
+
+/*!
+    \since 6.9
+    \overload
+*/
+void QOpenGLTexture::setDataAsync(PixelFormat sourceFormat, PixelType sourceType,
+                                  const void *data, const QOpenGLPixelTransferOptions * const options)
+{
+    setDataAsync(0, 0, QOpenGLTexture::CubeMapPositiveX, sourceFormat, sourceType, data, options);
+}
+
 /*!
     Uploads compressed pixel \a data to \a mipLevel, array \a layer, and \a cubeFace.
     The pixel transfer can optionally be controlled with \a options. The \a dataSize
@@ -460,6 +460,16 @@ public:
                  PixelFormat sourceFormat, PixelType sourceType,
                  const void *data, const QOpenGLPixelTransferOptions * const options = nullptr);
 
+    // Asynchronous data upload
+    void setDataAsync(int mipLevel, int layer, CubeMapFace cubeFace,
+                      PixelFormat sourceFormat, PixelType sourceType,
+                      const void *data, const QOpenGLPixelTransferOptions * const options = nullptr);
+    void setDataAsync(int mipLevel,
+                      PixelFormat sourceFormat, PixelType sourceType,
+                      const void *data, const QOpenGLPixelTransferOptions * const options = nullptr);
+    void setDataAsync(PixelFormat sourceFormat, PixelType sourceType,
+                      const void *data, const QOpenGLPixelTransferOptions * const options = nullptr);
+
     // Compressed data upload
     void setCompressedData(int mipLevel, int layer, CubeMapFace cubeFace,
                            int dataSize, const void *data,
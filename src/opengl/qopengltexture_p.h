@@ -21,6 +21,7 @@
 #include "private/qobject_p.h"
 #include "qopengltexture.h"
 #include "qopengl.h"
+#include <QtGui/qopenglextrafunctions.h>
 
 #include <cmath>
 
@@ -73,6 +74,14 @@ public:
                            int dataSize, const void *data,
                            const QOpenGLPixelTransferOptions * const options);
 
+    bool setDataAsync(int mipLevel, int layer, QOpenGLTexture::CubeMapFace cubeFace,
+                      QOpenGLTexture::PixelFormat sourceFormat, QOpenGLTexture::PixelType sourceType,
+                      const void *data, const QOpenGLPixelTransferOptions * const options);
+    qsizetype sourceDataSize(int mipLevel, QOpenGLTexture::PixelFormat sourceFormat,
+                             QOpenGLTexture::PixelType sourceType,
+                             const QOpenGLPixelTransferOptions * const options) const;
+    void destroyAsyncUploadRing();
+
 
     void setWrapMode(QOpenGLTexture::WrapMode mode);
     void setWrapMode(QOpenGLTexture::CoordinateDirection direction, QOpenGLTexture::WrapMode mode);
@@ -137,6 +146,20 @@ public:
     QOpenGLFunctions *functions;
 
     QOpenGLTexture::Features features;
+
+    // Ring of staging pixel unpack buffers used by setDataAsync()
+    struct AsyncUploadBuffer {
+        GLuint pbo = 0;
+        GLsync fence = nullptr;
+        void *persistentPtr = nullptr;
+        qsizetype size = 0;
+    };
+    static const int AsyncUploadRingSize = 3;
+    AsyncUploadBuffer asyncUploadRing[AsyncUploadRingSize];
+    int asyncUploadIndex;
+    bool bufferStorageResolved;
+    void (QOPENGLF_APIENTRYP bufferStorageFn)(GLenum target, GLsizeiptr size,
+                                              const void *data, GLbitfield flags);
 };
 
 QT_END_NAMESPACE
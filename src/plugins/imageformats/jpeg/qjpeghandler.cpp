@@ -304,6 +304,19 @@ static bool read_jpeg_image(QImage *outImage,
             info->do_fancy_upsampling = FALSE;
         }
 
+        bool directRgb32 = false;
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        // libjpeg-turbo can emit the Format_RGB32 byte order directly with
+        // its SIMD color converter, making the RGB888-to-RGB32 conversion
+        // pass (and, for unclipped reads, the intermediate row buffer)
+        // unnecessary. JCS_EXT_BGRA fills the alpha byte with 0xff as
+        // Format_RGB32 requires; the plain X formats leave it undefined.
+        if (info->out_color_space == JCS_RGB) {
+            info->out_color_space = JCS_EXT_BGRA;
+            directRgb32 = true;
+        }
+#endif
+
         (void) jpeg_calc_output_dimensions(info);
 
         // Determine the clip region to extract.
@@ -327,10 +340,12 @@ static bool read_jpeg_image(QImage *outImage,
         if (!ensureValidImage(outImage, info, clip.size()))
             return false;
 
-        // Avoid memcpy() overhead if grayscale with no clipping.
-        bool quickGray = (info->output_components == 1 &&
-                          clip == imageRect);
-        if (!quickGray) {
+        // Decode straight into the QImage when the decoded rows need no
+        // repacking: grayscale with no clipping, or libjpeg-turbo emitting
+        // the Format_RGB32 byte order itself.
+        bool quickDecode = (clip == imageRect &&
+                            (info->output_components == 1 || directRgb32));
+        if (!quickDecode) {
             // Ask the jpeg library to allocate a temporary row.
             // The library will automatically delete it for us later.
             // The libjpeg docs say we should do this before calling
@@ -343,6 +358,23 @@ static bool read_jpeg_image(QImage *outImage,
 
             (void) jpeg_start_decompress(info);
 
+            int clipColumnOffset = clip.x();
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER)
+            // libjpeg-turbo can restrict decompression to a horizontal band
+            // and skip the rows above the clip without running the IDCT on
+            // them, so a small clip region only decodes a fraction of the
+            // image. The band is expanded to MCU boundaries, so the clip
+            // offset must be taken relative to the adjusted band start.
+            if (clip != imageRect) {
+                JDIMENSION bandOffset = clip.x();
+                JDIMENSION bandWidth = clip.width();
+                jpeg_crop_scanline(info, &bandOffset, &bandWidth);
+                clipColumnOffset = clip.x() - int(bandOffset);
+                if (clip.y() > 0)
+                    (void) jpeg_skip_scanlines(info, clip.y());
+            }
+#endif
+
             while (info->output_scanline < info->output_height) {
                 int y = int(info->output_scanline) - clip.y();
                 if (y >= clip.height())
@@ -353,12 +385,15 @@ static bool read_jpeg_image(QImage *outImage,
                 if (y < 0)
                     continue;   // Haven't reached the starting line yet.
 
-                if (info->output_components == 3) {
-                    uchar *in = rows[0] + clip.x() * 3;
+                if (directRgb32) {
+                    memcpy(outImage->scanLine(y),
+                           rows[0] + clipColumnOffset * 4, clip.width() * 4);
+                } else if (info->output_components == 3) {
+                    uchar *in = rows[0] + clipColumnOffset * 3;
                     QRgb *out = (QRgb*)outImage->scanLine(y);
                     converter(out, in, clip.width());
                 } else if (info->out_color_space == JCS_CMYK) {
-                    uchar *in = rows[0] + clip.x() * 4;
+                    uchar *in = rows[0] + clipColumnOffset * 4;
                     quint32 *out = (quint32*)outImage->scanLine(y);
                     if (invertCMYK) {
                         for (int i = 0; i < clip.width(); ++i) {
@@ -371,11 +406,11 @@ static bool read_jpeg_image(QImage *outImage,
                 } else if (info->output_components == 1) {
                     // Grayscale.
                     memcpy(outImage->scanLine(y),
-                           rows[0] + clip.x(), clip.width());
+                           rows[0] + clipColumnOffset, clip.width());
                 }
             }
         } else {
-            // Load unclipped grayscale data directly into the QImage.
+            // Load unclipped rows directly into the QImage.
             (void) jpeg_start_decompress(info);
             while (info->output_scanline < info->output_height) {
                 uchar *row = outImage->scanLine(info->output_scanline);
@@ -171,6 +171,7 @@ protected:
 
     bool prepare(const QString &stmt) override;
     bool exec() override;
+    bool execBatch(bool arrayBind = false) override;
 };
 
 class QMYSQLResultPrivate: public QSqlResultPrivate
@@ -1078,6 +1079,95 @@ bool QMYSQLResult::exec()
     return true;
 }
 
+bool QMYSQLResult::execBatch(bool arrayBind)
+{
+    Q_D(QMYSQLResult);
+    if (arrayBind || !d->preparedQuery)
+        return QSqlResult::execBatch(arrayBind);
+
+    const QVariantList columns = boundValues();
+    if (columns.isEmpty())
+        return false;
+    const qsizetype columnCount = columns.size();
+    const qsizetype rowCount = columns.at(0).toList().size();
+    if (rowCount < 2)
+        return QSqlResult::execBatch(arrayBind);
+    for (const QVariant &column : columns) {
+        if (column.toList().size() != rowCount)
+            return QSqlResult::execBatch(arrayBind);
+    }
+
+    // Only a plain "INSERT ... VALUES (?, ?, ...)" can be rewritten into a
+    // multi-row insert; everything else takes the generic row-by-row path.
+    const QString query = d->executedQuery.trimmed();
+    if (!query.startsWith("insert"_L1, Qt::CaseInsensitive))
+        return QSqlResult::execBatch(arrayBind);
+    const qsizetype valuesIdx = query.lastIndexOf("values"_L1, Qt::CaseInsensitive);
+    if (valuesIdx == -1)
+        return QSqlResult::execBatch(arrayBind);
+    const QStringView tuple = QStringView(query).mid(valuesIdx + 6).trimmed();
+    if (tuple.size() < 2 || !tuple.startsWith(u'(') || !tuple.endsWith(u')'))
+        return QSqlResult::execBatch(arrayBind);
+    qsizetype placeholders = 0;
+    for (QChar c : tuple.mid(1, tuple.size() - 2)) {
+        if (c == u'?')
+            ++placeholders;
+        else if (c != u',' && !c.isSpace())
+            return QSqlResult::execBatch(arrayBind);
+    }
+    if (placeholders != columnCount)
+        return QSqlResult::execBatch(arrayBind);
+
+    // stay below the protocol limit of 65535 placeholders per statement
+    const qsizetype maxRowsPerStatement = qMax(qsizetype(1), qsizetype(65535) / columnCount);
+    const QString prefix = query.left(valuesIdx + 6) + u' ';
+    const QString rowTuple = tuple.toString();
+
+    MYSQL *mysql = d->drv_d_func()->mysql;
+    const bool useTransaction = rowCount > maxRowsPerStatement
+            && mysql && mysql_query(mysql, "BEGIN WORK") == 0;
+
+    my_ulonglong affected = 0;
+    qsizetype row = 0;
+    while (row < rowCount) {
+        const qsizetype rowsThisChunk = qMin(maxRowsPerStatement, rowCount - row);
+        QString sql = prefix;
+        sql.reserve(prefix.size() + (rowTuple.size() + 1) * rowsThisChunk);
+        for (qsizetype i = 0; i < rowsThisChunk; ++i) {
+            if (i)
+                sql += u',';
+            sql += rowTuple;
+        }
+        if (!prepare(sql)) {
+            if (useTransaction)
+                mysql_query(mysql, "ROLLBACK");
+            return false;
+        }
+        d->clearValues();
+        qsizetype bindIdx = 0;
+        for (qsizetype i = 0; i < rowsThisChunk; ++i) {
+            for (qsizetype c = 0; c < columnCount; ++c)
+                bindValue(bindIdx++, columns.at(c).toList().at(row + i), QSql::In);
+        }
+        if (!exec()) {
+            if (useTransaction)
+                mysql_query(mysql, "ROLLBACK");
+            return false;
+        }
+        affected += mysql_stmt_affected_rows(d->stmt);
+        row += rowsThisChunk;
+    }
+
+    if (useTransaction && mysql_query(mysql, "COMMIT")) {
+        setLastError(qMakeError(QCoreApplication::translate("QMYSQLResult",
+                     "Unable to commit batch transaction"), QSqlError::StatementError,
+                     d->drv_d_func()));
+        return false;
+    }
+    d->rowsAffected = affected;
+    return true;
+}
+
 /////////////////////////////////////////////////////////
 
 static int qMySqlConnectionCount = 0;
@@ -161,6 +161,7 @@ public:
 
     bool prepare(const QString &query) override;
     bool exec() override;
+    bool execBatch(bool arrayBind = false) override;
 
     QVariant lastInsertId() const override;
     QVariant handle() const override;
@@ -1742,6 +1743,238 @@ bool QODBCResult::exec()
     return true;
 }
 
+bool QODBCResult::execBatch(bool arrayBind)
+{
+    Q_D(QODBCResult);
+    if (arrayBind || hasOutValues())
+        return QSqlResult::execBatch(arrayBind);
+    if (!d->hStmt) {
+        qSqlWarning("QODBCResult::execBatch: No statement handle available"_L1, d);
+        return false;
+    }
+
+    const QVariantList columns = boundValues();
+    if (columns.isEmpty())
+        return false;
+    const qsizetype paramCount = columns.size();
+    const qsizetype rowCount = columns.at(0).toList().size();
+    if (rowCount < 2)
+        return QSqlResult::execBatch(arrayBind);
+
+    // Each column must hold one supported element type throughout; mixed or
+    // unsupported types (and all-null columns) take the generic row loop.
+    QVarLengthArray<int, 32> columnTypes(paramCount);
+    columnTypes.fill(QMetaType::UnknownType);
+    for (qsizetype i = 0; i < paramCount; ++i) {
+        const QVariantList column = columns.at(i).toList();
+        if (column.size() != rowCount)
+            return QSqlResult::execBatch(arrayBind);
+        for (const QVariant &val : column) {
+            if (QSqlResultPrivate::isVariantNull(val))
+                continue;
+            if (columnTypes[i] == QMetaType::UnknownType)
+                columnTypes[i] = val.typeId();
+            else if (columnTypes[i] != val.typeId())
+                return QSqlResult::execBatch(arrayBind);
+        }
+        switch (columnTypes[i]) {
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Double:
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong:
+        case QMetaType::QString:
+        case QMetaType::QByteArray:
+            break;
+        default:
+            return QSqlResult::execBatch(arrayBind);
+        }
+    }
+
+    setActive(false);
+    setAt(QSql::BeforeFirstRow);
+    d->rInf.clear();
+    d->fieldCache.clear();
+    d->fieldCacheIdx = 0;
+
+    if (isSelect())
+        SQLCloseCursor(d->hStmt);
+
+    SQLULEN rowsProcessed = 0;
+    SQLRETURN r = SQLSetStmtAttr(d->hStmt,
+                                 SQL_ATTR_PARAM_BIND_TYPE,
+                                 (SQLPOINTER)SQL_PARAM_BIND_BY_COLUMN,
+                                 SQL_IS_UINTEGER);
+    if (SQL_SUCCEEDED(r))
+        r = SQLSetStmtAttr(d->hStmt,
+                           SQL_ATTR_PARAMSET_SIZE,
+                           (SQLPOINTER)(quintptr)rowCount,
+                           SQL_IS_UINTEGER);
+    if (SQL_SUCCEEDED(r))
+        r = SQLSetStmtAttr(d->hStmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &rowsProcessed, 0);
+    if (!SQL_SUCCEEDED(r)) {
+        // the driver cannot do parameter arrays
+        SQLSetStmtAttr(d->hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, SQL_IS_UINTEGER);
+        return QSqlResult::execBatch(arrayBind);
+    }
+
+    // column-wise arrays; the storage must stay alive until SQLExecute() is done
+    QList<QByteArray> columnStorage(paramCount);
+    QList<QByteArray> indicatorStorage(paramCount);
+
+    for (qsizetype i = 0; i < paramCount && SQL_SUCCEEDED(r); ++i) {
+        const QVariantList column = columns.at(i).toList();
+        QByteArray &storage = columnStorage[i];
+        QByteArray &indicatorBytes = indicatorStorage[i];
+        indicatorBytes.resize(rowCount * qsizetype(sizeof(SQLLEN)));
+        SQLLEN *indicators = reinterpret_cast<SQLLEN *>(indicatorBytes.data());
+        for (qsizetype row = 0; row < rowCount; ++row)
+            indicators[row] = QSqlResultPrivate::isVariantNull(column.at(row)) ? SQL_NULL_DATA : 0;
+
+        switch (columnTypes[i]) {
+        case QMetaType::Int:
+        case QMetaType::UInt: {
+            storage.resize(rowCount * qsizetype(sizeof(SQLINTEGER)));
+            SQLINTEGER *data = reinterpret_cast<SQLINTEGER *>(storage.data());
+            for (qsizetype row = 0; row < rowCount; ++row)
+                data[row] = SQLINTEGER(column.at(row).toInt());
+            r = SQLBindParameter(d->hStmt,
+                                 i + 1,
+                                 SQL_PARAM_INPUT,
+                                 columnTypes[i] == QMetaType::Int ? SQL_C_SLONG : SQL_C_ULONG,
+                                 columnTypes[i] == QMetaType::Int ? SQL_INTEGER : SQL_NUMERIC,
+                                 columnTypes[i] == QMetaType::Int ? 0 : 15,
+                                 0,
+                                 data,
+                                 0,
+                                 indicators);
+            break; }
+        case QMetaType::LongLong:
+        case QMetaType::ULongLong: {
+            storage.resize(rowCount * qsizetype(sizeof(SQLBIGINT)));
+            SQLBIGINT *data = reinterpret_cast<SQLBIGINT *>(storage.data());
+            for (qsizetype row = 0; row < rowCount; ++row)
+                data[row] = SQLBIGINT(column.at(row).toLongLong());
+            r = SQLBindParameter(d->hStmt,
+                                 i + 1,
+                                 SQL_PARAM_INPUT,
+                                 columnTypes[i] == QMetaType::LongLong ? SQL_C_SBIGINT
+                                                                       : SQL_C_UBIGINT,
+                                 SQL_BIGINT,
+                                 0,
+                                 0,
+                                 data,
+                                 0,
+                                 indicators);
+            break; }
+        case QMetaType::Double: {
+            storage.resize(rowCount * qsizetype(sizeof(double)));
+            double *data = reinterpret_cast<double *>(storage.data());
+            for (qsizetype row = 0; row < rowCount; ++row)
+                data[row] = column.at(row).toDouble();
+            r = SQLBindParameter(d->hStmt,
+                                 i + 1,
+                                 SQL_PARAM_INPUT,
+                                 SQL_C_DOUBLE,
+                                 SQL_DOUBLE,
+                                 0,
+                                 0,
+                                 data,
+                                 0,
+                                 indicators);
+            break; }
+        case QMetaType::QString: {
+            QByteArrayList encoded;
+            encoded.reserve(rowCount);
+            qsizetype maxBytes = 0;
+            for (qsizetype row = 0; row < rowCount; ++row) {
+                QByteArray cell;
+                if (d->unicode) {
+                    const auto enc = toSQLTCHAR(column.at(row).toString());
+                    cell = QByteArray(reinterpret_cast<const char *>(enc.data()),
+                                      enc.size() * sizeof(SQLTCHAR));
+                } else {
+                    cell = column.at(row).toString().toUtf8();
+                }
+                maxBytes = qMax(maxBytes, cell.size());
+                encoded.append(std::move(cell));
+            }
+            const qsizetype cellBytes = maxBytes + qsizetype(d->unicode ? sizeof(SQLTCHAR) : 1);
+            storage = QByteArray(rowCount * cellBytes, '\0');
+            for (qsizetype row = 0; row < rowCount; ++row) {
+                memcpy(storage.data() + row * cellBytes, encoded.at(row).constData(),
+                       encoded.at(row).size());
+                if (indicators[row] != SQL_NULL_DATA)
+                    indicators[row] = encoded.at(row).size();
+            }
+            r = SQLBindParameter(d->hStmt,
+                                 i + 1,
+                                 SQL_PARAM_INPUT,
+                                 d->unicode ? SQL_C_TCHAR : SQL_C_CHAR,
+                                 d->unicode ? (maxBytes > 254 ? SQL_WLONGVARCHAR : SQL_WVARCHAR)
+                                            : (maxBytes > 254 ? SQL_LONGVARCHAR : SQL_VARCHAR),
+                                 maxBytes,
+                                 0,
+                                 storage.data(),
+                                 cellBytes,
+                                 indicators);
+            break; }
+        case QMetaType::QByteArray: {
+            qsizetype maxBytes = 1;
+            for (qsizetype row = 0; row < rowCount; ++row)
+                maxBytes = qMax(maxBytes, column.at(row).toByteArray().size());
+            storage = QByteArray(rowCount * maxBytes, '\0');
+            for (qsizetype row = 0; row < rowCount; ++row) {
+                const QByteArray cell = column.at(row).toByteArray();
+                memcpy(storage.data() + row * maxBytes, cell.constData(), cell.size());
+                if (indicators[row] != SQL_NULL_DATA)
+                    indicators[row] = cell.size();
+            }
+            r = SQLBindParameter(d->hStmt,
+                                 i + 1,
+                                 SQL_PARAM_INPUT,
+                                 SQL_C_BINARY,
+                                 SQL_LONGVARBINARY,
+                                 maxBytes,
+                                 0,
+                                 storage.data(),
+                                 maxBytes,
+                                 indicators);
+            break; }
+        default:
+            Q_UNREACHABLE();
+        }
+    }
+
+    if (!SQL_SUCCEEDED(r)) {
+        SQLFreeStmt(d->hStmt, SQL_RESET_PARAMS);
+        SQLSetStmtAttr(d->hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, SQL_IS_UINTEGER);
+        SQLSetStmtAttr(d->hStmt, SQL_ATTR_PARAMS_PROCESSED_PTR, nullptr, 0);
+        qSqlWarning("QODBCResult::execBatch: unable to bind variable:"_L1, d);
+        setLastError(qMakeError(QCoreApplication::translate("QODBCResult",
+                     "Unable to bind variable"), QSqlError::StatementError, d));
+        return false;
+    }
+
+    r = SQLExecute(d->hStmt);
+
+    // rearm the statement for ordinary executions and drop the references
+    // into the local arrays
+    SQLFreeStmt(d->hStmt, SQL_RESET_PARAMS);
+    SQLSetStmtAttr(d->hStmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, SQL_IS_UINTEGER);
+    SQLSetStmtAttr(d->hStmt, SQL_ATTR_PARAMS_PROCESSED_PTR, nullptr, 0);
+
+    if (!SQL_SUCCEEDED(r) && r != SQL_NO_DATA) {
+        qSqlWarning("QODBCResult::execBatch: Unable to execute statement:"_L1, d);
+        setLastError(qMakeError(QCoreApplication::translate("QODBCResult",
+                     "Unable to execute statement"), QSqlError::StatementError, d));
+        return false;
+    }
+    setSelect(false);
+    setActive(true);
+    return true;
+}
+
 QSqlRecord QODBCResult::record() const
 {
     Q_D(const QODBCResult);
@@ -112,6 +112,7 @@ protected:
     QVariant lastInsertId() const override;
     bool prepare(const QString &query) override;
     bool exec() override;
+    bool execBatch(bool arrayBind = false) override;
 };
 
 class QPSQLDriverPrivate final : public QSqlDriverPrivate
@@ -901,6 +902,86 @@ bool QPSQLResult::exec()
     return d->processResults();
 }
 
+bool QPSQLResult::execBatch(bool arrayBind)
+{
+#ifdef LIBPQ_HAS_PIPELINING
+    Q_D(QPSQLResult);
+    if (!d->preparedQueriesEnabled || d->preparedStmtId.isEmpty())
+        return QSqlResult::execBatch(arrayBind);
+
+    const QList<QVariant> values = boundValues();
+    if (values.isEmpty() || values.at(0).toList().isEmpty())
+        return false;
+    const qsizetype rowCount = values.at(0).toList().size();
+
+    cleanup();
+
+    auto *drv = const_cast<QPSQLDriverPrivate *>(d->drv_d_func());
+    drv->discardResults();
+    drv->currentStmtId = InvalidStatementId;
+
+    if (PQenterPipelineMode(drv->connection) != 1)
+        return QSqlResult::execBatch(arrayBind);
+
+    // Queue one EXECUTE per row; nothing goes over the wire until the
+    // pipeline is synced, so the whole batch costs a single round trip
+    // instead of one per row.
+    bool ok = true;
+    qsizetype queued = 0;
+    for (qsizetype row = 0; row < rowCount; ++row) {
+        QList<QVariant> rowValues;
+        rowValues.reserve(values.size());
+        for (const QVariant &column : values)
+            rowValues.append(column.toList().value(row));
+        const QString params = qCreateParamString(rowValues, driver());
+        const QString stmt = params.isEmpty()
+                ? QStringLiteral("EXECUTE %1").arg(d->preparedStmtId)
+                : QStringLiteral("EXECUTE %1 (%2)").arg(d->preparedStmtId, params);
+        if (PQsendQueryParams(drv->connection, stmt.toUtf8().constData(), 0,
+                              nullptr, nullptr, nullptr, nullptr, 0) != 1) {
+            ok = false;
+            break;
+        }
+        ++queued;
+    }
+    if (PQpipelineSync(drv->connection) != 1)
+        ok = false;
+
+    // Collect the results of every queued EXECUTE; after a failure the
+    // remaining ones come back as PGRES_PIPELINE_ABORTED and only the
+    // first error is reported.
+    for (qsizetype row = 0; row < queued; ++row) {
+        bool first = true;
+        while (PGresult *result = PQgetResult(drv->connection)) {
+            if (first) {
+                const int status = PQresultStatus(result);
+                if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK && ok) {
+                    setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                                 "Unable to execute batch"), QSqlError::StatementError,
+                                 drv, result));
+                    ok = false;
+                }
+                first = false;
+            }
+            PQclear(result);
+        }
+    }
+
+    // Eat the PGRES_PIPELINE_SYNC marker and leave pipeline mode.
+    while (PGresult *result = PQgetResult(drv->connection))
+        PQclear(result);
+    if (PQexitPipelineMode(drv->connection) != 1 && ok) {
+        setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                     "Unable to exit pipeline mode"), QSqlError::StatementError, drv));
+        ok = false;
+    }
+    drv->checkPendingNotifications();
+    return ok;
+#else
+    return QSqlResult::execBatch(arrayBind);
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////
 
 bool QPSQLDriverPrivate::setEncodingUtf8()
@@ -6,6 +6,8 @@
 #include <qcoreapplication.h>
 #include <qdatetime.h>
 #include <qdebug.h>
+#include <qhash.h>
+#include <qiodevice.h>
 #include <qlist.h>
 #include <qloggingcategory.h>
 #include <qsqlerror.h>
@@ -91,6 +93,7 @@ protected:
     int numRowsAffected() override;
     QVariant lastInsertId() const override;
     QSqlRecord record() const override;
+    QIODevice *lobDevice(int field) override;
     void detachFromResultSet() override;
     void virtual_hook(int id, void *data) override;
 };
@@ -104,12 +107,24 @@ public:
     bool isIdentifierEscaped(QStringView identifier) const;
     QSqlIndex getTableInfo(QSqlQuery &query, const QString &tableName,
                            bool onlyPIndex = false) const;
+    void clearStatementCache();
 
     sqlite3 *access = nullptr;
     QList<QSQLiteResult *> results;
     QStringList notificationid;
+    // idle prepared statements, keyed by SQL text; only populated when
+    // QSQLITE_STATEMENT_CACHE_SIZE is set as a connect option
+    QHash<QString, sqlite3_stmt *> stmtCache;
+    int stmtCacheSize = 0;
 };
 
+void QSQLiteDriverPrivate::clearStatementCache()
+{
+    for (sqlite3_stmt *stmt : std::as_const(stmtCache))
+        sqlite3_finalize(stmt);
+    stmtCache.clear();
+}
+
 bool QSQLiteDriverPrivate::isIdentifierEscaped(QStringView identifier) const
 {
     return identifier.size() > 2
@@ -174,6 +189,7 @@ public:
     void finalize();
 
     sqlite3_stmt *stmt = nullptr;
+    QString stmtSql; // the text stmt was prepared from, for the statement cache
     QSqlRecord rInf;
     QList<QVariant> firstRow;
     bool skippedStatus = false; // the status of the fetchNext() that's skipped
@@ -197,8 +213,21 @@ void QSQLiteResultPrivate::finalize()
     if (!stmt)
         return;
 
-    sqlite3_finalize(stmt);
+    // hand idle statements back to the per-connection cache instead of
+    // finalizing them, so the next prepare() of the same text skips
+    // sqlite3_prepare16_v2 and just resets the statement
+    auto *drv = const_cast<QSQLiteDriverPrivate *>(drv_d_func());
+    if (drv && drv->access && !stmtSql.isEmpty()
+        && drv->stmtCache.size() < drv->stmtCacheSize
+        && !drv->stmtCache.contains(stmtSql)
+        && sqlite3_reset(stmt) == SQLITE_OK) {
+        sqlite3_clear_bindings(stmt);
+        drv->stmtCache.insert(stmtSql, stmt);
+    } else {
+        sqlite3_finalize(stmt);
+    }
     stmt = nullptr;
+    stmtSql.clear();
 }
 
 void QSQLiteResultPrivate::initColumns(bool emptyResultset)
@@ -390,6 +419,16 @@ bool QSQLiteResult::prepare(const QString &query)
 
     setSelect(false);
 
+    auto *drv = const_cast<QSQLiteDriverPrivate *>(d->drv_d_func());
+    if (drv->stmtCacheSize > 0) {
+        if (sqlite3_stmt *cached = drv->stmtCache.take(query)) {
+            sqlite3_reset(cached);
+            d->stmt = cached;
+            d->stmtSql = query;
+            return true;
+        }
+    }
+
     const void *pzTail = nullptr;
     const auto size = int((query.size() + 1) * sizeof(QChar));
 
@@ -412,18 +451,28 @@ bool QSQLiteResult::prepare(const QString &query)
         d->finalize();
         return false;
     }
+    d->stmtSql = query;
     return true;
 }
 
 bool QSQLiteResult::execBatch(bool arrayBind)
 {
     Q_UNUSED(arrayBind);
-    Q_D(QSqlResult);
+    Q_D(QSQLiteResult);
     QScopedValueRollback<QList<QVariant>> valuesScope(d->values);
     QList<QVariant> values = d->values;
     if (values.size() == 0)
         return false;
 
+    // run the whole batch inside one transaction, so sqlite syncs to disk
+    // once instead of once per row; skip this if the user already opened one
+    sqlite3 *access = d->drv_d_func()->access;
+    bool implicitTransaction = access && sqlite3_get_autocommit(access);
+    if (implicitTransaction
+        && sqlite3_exec(access, "BEGIN", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        implicitTransaction = false;
+    }
+
     for (int i = 0; i < values.at(0).toList().size(); ++i) {
         d->values.clear();
         QScopedValueRollback<QHash<QString, QList<int>>> indexesScope(d->indexes);
@@ -432,8 +481,19 @@ bool QSQLiteResult::execBatch(bool arrayBind)
             bindValue(it.key(), values.at(it.value().first()).toList().at(i), QSql::In);
             ++it;
         }
-        if (!exec())
+        if (!exec()) {
+            if (implicitTransaction)
+                sqlite3_exec(access, "ROLLBACK", nullptr, nullptr, nullptr);
             return false;
+        }
+    }
+    if (implicitTransaction
+        && sqlite3_exec(access, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                     "Unable to commit transaction"), QSqlError::TransactionError,
+                     sqlite3_errcode(access)));
+        sqlite3_exec(access, "ROLLBACK", nullptr, nullptr, nullptr);
+        return false;
     }
     return true;
 }
@@ -615,6 +675,100 @@ QSqlRecord QSQLiteResult::record() const
     return d->rInf;
 }
 
+// Streams a blob through sqlite3_blob_read() so it never has to be
+// materialized as one contiguous QByteArray.
+class QSQLiteBlobDevice final : public QIODevice
+{
+public:
+    explicit QSQLiteBlobDevice(sqlite3_blob *blob)
+        : m_blob(blob)
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+    ~QSQLiteBlobDevice() override
+    {
+        QSQLiteBlobDevice::close();
+    }
+
+    qint64 size() const override { return m_size; }
+    void close() override
+    {
+        QIODevice::close();
+        if (m_blob) {
+            sqlite3_blob_close(m_blob);
+            m_blob = nullptr;
+        }
+    }
+    bool seek(qint64 pos) override
+    {
+        if (pos < 0 || pos > m_size || !QIODevice::seek(pos))
+            return false;
+        m_offset = pos;
+        return true;
+    }
+
+protected:
+    qint64 readData(char *data, qint64 maxlen) override
+    {
+        if (!m_blob)
+            return -1;
+        const qint64 available = m_size - m_offset;
+        if (available <= 0)
+            return 0;
+        const int len = int(qMin(maxlen, available));
+        if (sqlite3_blob_read(m_blob, data, len, int(m_offset)) != SQLITE_OK)
+            return -1;
+        m_offset += len;
+        return len;
+    }
+    qint64 writeData(const char *, qint64) override { return -1; }
+
+private:
+    sqlite3_blob *m_blob;
+    qint64 m_size = m_blob ? sqlite3_blob_bytes(m_blob) : 0;
+    qint64 m_offset = 0;
+};
+
+QIODevice *QSQLiteResult::lobDevice(int field)
+{
+    Q_D(QSQLiteResult);
+    if (!d->stmt || !isActive() || !isSelect() || at() < 0)
+        return nullptr;
+    if (field < 0 || field >= d->rInf.count())
+        return nullptr;
+
+    // expression columns have no on-disk blob to open
+    const char *dbName = sqlite3_column_database_name(d->stmt, field);
+    const char *tableName = sqlite3_column_table_name(d->stmt, field);
+    const char *columnName = sqlite3_column_origin_name(d->stmt, field);
+    if (!dbName || !tableName || !columnName)
+        return nullptr;
+
+    // sqlite3_blob_open() addresses the row by rowid, so the query
+    // must have selected it alongside the blob column
+    int rowidField = -1;
+    for (int i = 0; i < d->rInf.count(); ++i) {
+        const QString name = d->rInf.fieldName(i).toLower();
+        if (name == "rowid"_L1 || name == "_rowid_"_L1 || name == "oid"_L1) {
+            rowidField = i;
+            break;
+        }
+    }
+    if (rowidField == -1)
+        return nullptr;
+    const qint64 rowid = data(rowidField).toLongLong();
+
+    sqlite3_blob *blob = nullptr;
+    const int res = sqlite3_blob_open(d->drv_d_func()->access, dbName, tableName,
+                                      columnName, rowid, 0, &blob);
+    if (res != SQLITE_OK) {
+        setLastError(qMakeError(d->drv_d_func()->access, QCoreApplication::translate("QSQLiteResult",
+                     "Unable to open blob for streaming"), QSqlError::StatementError, res));
+        return nullptr;
+    }
+    return new QSQLiteBlobDevice(blob);
+}
+
 void QSQLiteResult::detachFromResultSet()
 {
     Q_D(QSQLiteResult);
@@ -757,6 +911,10 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
     bool useQtVfs = false;
     bool useQtCaseFolding = false;
     bool openNoFollow = false;
+    bool enableWal = false;
+    QByteArray synchronousMode;
+    qint64 mmapSize = -1;
+    int stmtCacheSize = 0;
 #if QT_CONFIG(regularexpression)
     static const auto regexpConnectOption = "QSQLITE_ENABLE_REGEXP"_L1;
     bool defineRegexp = false;
@@ -788,6 +946,38 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
             useQtCaseFolding = true;
         } else if (option == "QSQLITE_OPEN_NOFOLLOW"_L1) {
             openNoFollow = true;
+        } else if (option == "QSQLITE_ENABLE_WAL"_L1) {
+            enableWal = true;
+        } else if (option.startsWith("QSQLITE_SYNCHRONOUS"_L1)) {
+            option = option.mid(19).trimmed();
+            if (option.startsWith(u'=')) {
+                const auto mode = option.mid(1).trimmed();
+                if (mode.compare("OFF"_L1, Qt::CaseInsensitive) == 0
+                    || mode.compare("NORMAL"_L1, Qt::CaseInsensitive) == 0
+                    || mode.compare("FULL"_L1, Qt::CaseInsensitive) == 0
+                    || mode.compare("EXTRA"_L1, Qt::CaseInsensitive) == 0) {
+                    synchronousMode = mode.toLatin1();
+                } else {
+                    qCWarning(lcSqlite, "Invalid synchronous mode '%ls'",
+                              qUtf16Printable(mode.toString()));
+                }
+            }
+        } else if (option.startsWith("QSQLITE_MMAP_SIZE"_L1)) {
+            option = option.mid(17).trimmed();
+            if (option.startsWith(u'=')) {
+                bool ok;
+                const qint64 size = option.mid(1).trimmed().toLongLong(&ok);
+                if (ok && size >= 0)
+                    mmapSize = size;
+            }
+        } else if (option.startsWith("QSQLITE_STATEMENT_CACHE_SIZE"_L1)) {
+            option = option.mid(28).trimmed();
+            if (option.startsWith(u'=')) {
+                bool ok;
+                const int size = option.mid(1).trimmed().toInt(&ok);
+                if (ok && size > 0)
+                    stmtCacheSize = size;
+            }
         }
 #if QT_CONFIG(regularexpression)
         else if (option.startsWith(regexpConnectOption)) {
@@ -828,6 +1018,17 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
     if (res == SQLITE_OK) {
         sqlite3_busy_timeout(d->access, timeOut);
         sqlite3_extended_result_codes(d->access, useExtendedResultCodes);
+        if (enableWal)
+            sqlite3_exec(d->access, "PRAGMA journal_mode=WAL", nullptr, nullptr, nullptr);
+        if (!synchronousMode.isEmpty()) {
+            const QByteArray pragma = "PRAGMA synchronous=" + synchronousMode;
+            sqlite3_exec(d->access, pragma.constData(), nullptr, nullptr, nullptr);
+        }
+        if (mmapSize >= 0) {
+            const QByteArray pragma = "PRAGMA mmap_size=" + QByteArray::number(mmapSize);
+            sqlite3_exec(d->access, pragma.constData(), nullptr, nullptr, nullptr);
+        }
+        d->stmtCacheSize = stmtCacheSize;
         setOpen(true);
         setOpenError(false);
 #if QT_CONFIG(regularexpression)
@@ -865,6 +1066,8 @@ void QSQLiteDriver::close()
     if (isOpen()) {
         for (QSQLiteResult *result : std::as_const(d->results))
             result->d_func()->finalize();
+        d->clearStatementCache();
+        d->stmtCacheSize = 0;
 
         if (d->access && (d->notificationid.size() > 0)) {
             d->notificationid.clear();
@@ -1022,7 +1022,10 @@ void TlsCryptographOpenSSL::transmit()
         // we have a readBufferMaxSize. There's no point in leaving data there
         // just so that readBuffer.size() == readBufferMaxSize.
         int readBytes = 0;
-        const int bytesToRead = 4096;
+        // Read one full TLS record (2^14 bytes of plaintext) at a time:
+        // smaller chunks make SSL_read copy out partial records, multiplying
+        // the per-call overhead for bulk transfers.
+        const int bytesToRead = 16384;
         do {
             if (q->readChannelCount() == 0) {
                 // The read buffer is deallocated, don't try resize or write to it.
@@ -178,6 +178,41 @@ bool QSqlCachedResult::fetchLast()
     }
 }
 
+QList<QVariantList> QSqlCachedResult::fetchRows(int maxRows)
+{
+    Q_D(QSqlCachedResult);
+    QList<QVariantList> rows;
+    if (!isActive() || !isSelect() || d->colCount <= 0)
+        return rows;
+    while (maxRows < 0 || rows.size() < maxRows) {
+        bool fetched;
+        switch (at()) {
+        case QSql::BeforeFirstRow:
+            fetched = fetchFirst();
+            break;
+        case QSql::AfterLastRow:
+            fetched = false;
+            break;
+        default:
+            fetched = fetchNext();
+            if (!fetched)
+                setAt(QSql::AfterLastRow);
+            break;
+        }
+        if (!fetched)
+            break;
+        // copy straight out of the row cache, skipping the per-field
+        // data() virtual dispatch and its bounds checks
+        const int base = d->forwardOnly ? 0 : at() * d->colCount;
+        QVariantList row;
+        row.reserve(d->colCount);
+        for (int i = 0; i < d->colCount; ++i)
+            row.append(d->cache.at(base + i));
+        rows.append(std::move(row));
+    }
+    return rows;
+}
+
 QVariant QSqlCachedResult::data(int i)
 {
     Q_D(const QSqlCachedResult);
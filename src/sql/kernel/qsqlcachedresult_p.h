@@ -49,6 +49,7 @@ protected:
     bool fetchPrevious() override;
     bool fetchFirst() override;
     bool fetchLast() override;
+    QList<QVariantList> fetchRows(int maxRows) override;
 
     int colCount() const;
     ValueCache &cache();
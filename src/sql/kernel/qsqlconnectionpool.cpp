@@ -0,0 +1,296 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qsqlconnectionpool.h"
+
+#include <qatomic.h>
+#include <qlist.h>
+#include <qloggingcategory.h>
+#include <qmutex.h>
+#include <qthread.h>
+#include <qwaitcondition.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_LOGGING_CATEGORY(lcSqlPool, "qt.sql.connectionpool")
+
+using namespace Qt::StringLiterals;
+
+class QSqlConnectionPoolPrivate
+{
+public:
+    struct IdleConnection
+    {
+        QString name;
+        Qt::HANDLE threadId;
+    };
+
+    QString sourceName;
+    QString poolPrefix;
+    int maxConnections;
+    int serial = 0;
+    int total = 0; // connections currently existing (idle + leased)
+    QMutex mutex;
+    QWaitCondition connectionReleased;
+    QList<IdleConnection> idle;
+};
+
+/*!
+    \class QSqlConnectionPool
+    \brief The QSqlConnectionPool class distributes database connections
+    between threads.
+    \since 6.9
+
+    \ingroup database
+    \inmodule QtSql
+    \threadsafe
+
+    A QSqlDatabase connection may only be used from the thread that
+    created it. Multi-threaded applications therefore need one
+    connection per worker, and opening a fresh connection for every
+    task is expensive. QSqlConnectionPool manages a bounded set of
+    clones of a source connection and hands them out as leases:
+
+    \code
+    QSqlConnectionPool pool("myConnection", 8);
+
+    // in any worker thread:
+    QSqlConnectionPool::Connection lease = pool.acquire();
+    if (lease.isValid()) {
+        QSqlQuery query(lease.database());
+        // ...
+    } // the connection returns to the pool when the lease goes out of scope
+    \endcode
+
+    Connections are created lazily, up to maxConnections(), by cloning
+    the settings of the source connection, and are reused by the thread
+    that created them. Leased connections that fail to (re)open are
+    dropped and replaced, so a lost server connection does not poison
+    the pool. When all connections are leased, acquire() blocks until
+    one is released or the given deadline expires.
+
+    Every lease must be released (destroyed) before the pool is
+    destroyed, and a lease must not outlive the thread it was acquired
+    in.
+
+    \sa QSqlDatabase::cloneDatabase(), QSqlDatabase::addDatabase()
+*/
+
+/*!
+    \class QSqlConnectionPool::Connection
+    \brief An RAII lease on a database connection from a QSqlConnectionPool.
+    \since 6.9
+
+    \ingroup database
+    \inmodule QtSql
+
+    The connection is exclusively owned by the holder of the lease and
+    is returned to the pool when the lease is destroyed. Leases are
+    movable but not copyable. A default-constructed or expired lease is
+    invalid and database() returns an invalid QSqlDatabase.
+
+    \sa QSqlConnectionPool::acquire()
+*/
+
+/*!
+    Creates a connection pool that clones the connection settings of
+    the registered connection \a sourceConnectionName and keeps at most
+    \a maxConnections connections.
+
+    The source connection itself is never handed out and does not have
+    to be open; only its settings (driver, database name, user name,
+    password, host, port and connect options) are used.
+*/
+QSqlConnectionPool::QSqlConnectionPool(const QString &sourceConnectionName, int maxConnections)
+    : d(new QSqlConnectionPoolPrivate)
+{
+    Q_CONSTINIT static QBasicAtomicInt poolCount = Q_BASIC_ATOMIC_INITIALIZER(0);
+    d->sourceName = sourceConnectionName;
+    d->maxConnections = qMax(maxConnections, 1);
+    d->poolPrefix = "qt_sql_pool_"_L1
+            + QString::number(poolCount.fetchAndAddRelaxed(1) + 1) + u'_';
+}
+
+/*!
+    Destroys the pool and closes all idle connections.
+
+    All leases handed out by acquire() must have been released before
+    the pool is destroyed.
+*/
+QSqlConnectionPool::~QSqlConnectionPool()
+{
+    QMutexLocker locker(&d->mutex);
+    if (d->total != d->idle.size())
+        qCWarning(lcSqlPool, "QSqlConnectionPool: destroyed with %d connection(s) still leased",
+                  int(d->total - d->idle.size()));
+    const QList<QSqlConnectionPoolPrivate::IdleConnection> idle = std::move(d->idle);
+    locker.unlock();
+    for (const auto &connection : idle)
+        QSqlDatabase::removeDatabase(connection.name);
+    delete d;
+}
+
+/*!
+    Acquires a connection from the pool, waiting at most until
+    \a deadline expires if all connections are currently leased.
+
+    Connections are reused by the thread that created them; a thread
+    never receives a connection that was created in another thread.
+    Before a connection is handed out it is checked to be open, and
+    reopened or replaced if it is not.
+
+    Returns an invalid lease if the deadline expired or if no
+    connection could be opened; in the latter case the source
+    connection's settings are usually wrong and
+    \l{QSqlDatabase::lastError()}{lastError()} of a fresh clone will
+    say why.
+*/
+QSqlConnectionPool::Connection QSqlConnectionPool::acquire(QDeadlineTimer deadline)
+{
+    const Qt::HANDLE threadId = QThread::currentThreadId();
+    QMutexLocker locker(&d->mutex);
+    for (;;) {
+        // prefer an idle connection that was created by this thread
+        for (qsizetype i = 0; i < d->idle.size(); ++i) {
+            if (d->idle.at(i).threadId != threadId)
+                continue;
+            const QString name = d->idle.takeAt(i).name;
+            locker.unlock();
+            QSqlDatabase db = QSqlDatabase::database(name);
+            if (db.isOpen())
+                return Connection(this, name);
+            // health check failed; drop the connection and start over
+            db = QSqlDatabase();
+            QSqlDatabase::removeDatabase(name);
+            locker.relock();
+            --d->total;
+            continue;
+        }
+
+        if (d->total < d->maxConnections) {
+            const QString name = d->poolPrefix + QString::number(++d->serial);
+            ++d->total;
+            locker.unlock();
+            QSqlDatabase db = QSqlDatabase::cloneDatabase(d->sourceName, name);
+            if (db.open())
+                return Connection(this, name);
+            qCWarning(lcSqlPool, "QSqlConnectionPool: unable to open connection: %ls",
+                      qUtf16Printable(db.lastError().text()));
+            db = QSqlDatabase();
+            QSqlDatabase::removeDatabase(name);
+            locker.relock();
+            --d->total;
+            d->connectionReleased.wakeOne();
+            return Connection();
+        }
+
+        // the pool is full, but idle connections of other threads can
+        // be closed to make room for one belonging to this thread
+        if (!d->idle.isEmpty()) {
+            const QString victim = d->idle.takeFirst().name;
+            --d->total;
+            locker.unlock();
+            QSqlDatabase::removeDatabase(victim);
+            locker.relock();
+            continue;
+        }
+
+        if (!d->connectionReleased.wait(&d->mutex, deadline))
+            return Connection();
+    }
+}
+
+/*!
+    \internal
+
+    Returns the leased connection \a name to the idle list.
+*/
+void QSqlConnectionPool::release(const QString &name)
+{
+    QMutexLocker locker(&d->mutex);
+    d->idle.append({ name, QThread::currentThreadId() });
+    d->connectionReleased.wakeOne();
+}
+
+/*!
+    Returns the name of the connection whose settings the pooled
+    connections are cloned from.
+*/
+QString QSqlConnectionPool::sourceConnectionName() const
+{
+    return d->sourceName;
+}
+
+/*!
+    Returns the maximum number of connections the pool will create.
+*/
+int QSqlConnectionPool::maxConnections() const
+{
+    return d->maxConnections;
+}
+
+/*!
+    Returns the number of connections that currently exist, whether
+    idle or leased.
+*/
+int QSqlConnectionPool::openConnections() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->total;
+}
+
+/*!
+    Releases the connection back to the pool it was acquired from.
+*/
+QSqlConnectionPool::Connection::~Connection()
+{
+    if (pool)
+        pool->release(name);
+}
+
+/*!
+    Returns the leased database connection, or an invalid QSqlDatabase
+    if the lease is invalid.
+
+    The returned connection must only be used in the thread the lease
+    was acquired in, and not after the lease has been destroyed.
+*/
+QSqlDatabase QSqlConnectionPool::Connection::database() const
+{
+    if (!pool)
+        return QSqlDatabase();
+    return QSqlDatabase::database(name);
+}
+
+/*!
+    \fn QSqlConnectionPool::Connection::Connection()
+
+    Constructs an invalid lease.
+*/
+
+/*!
+    \fn QSqlConnectionPool::Connection::Connection(Connection &&other)
+
+    Move-constructs the lease from \a other, which becomes invalid.
+*/
+
+/*!
+    \fn QSqlConnectionPool::Connection &QSqlConnectionPool::Connection::operator=(Connection &&other)
+
+    Move-assigns \a other to this lease, releasing any currently held
+    connection. \a other becomes invalid.
+*/
+
+/*!
+    \fn void QSqlConnectionPool::Connection::swap(Connection &other)
+
+    Swaps this lease with \a other.
+*/
+
+/*!
+    \fn bool QSqlConnectionPool::Connection::isValid() const
+
+    Returns \c true if the lease holds a connection.
+*/
+
+QT_END_NAMESPACE
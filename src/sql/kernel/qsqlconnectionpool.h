@@ -0,0 +1,74 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSQLCONNECTIONPOOL_H
+#define QSQLCONNECTIONPOOL_H
+
+#include <QtSql/qtsqlglobal.h>
+#include <QtSql/qsqldatabase.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+class QSqlConnectionPoolPrivate;
+
+class Q_SQL_EXPORT QSqlConnectionPool
+{
+public:
+    explicit QSqlConnectionPool(const QString &sourceConnectionName =
+                                        QLatin1StringView(QSqlDatabase::defaultConnection),
+                                int maxConnections = 16);
+    ~QSqlConnectionPool();
+
+    class Connection
+    {
+    public:
+        Connection() noexcept = default;
+        Connection(Connection &&other) noexcept
+            : pool(std::exchange(other.pool, nullptr)), name(std::move(other.name))
+        {}
+        Connection &operator=(Connection &&other) noexcept
+        {
+            Connection moved(std::move(other));
+            swap(moved);
+            return *this;
+        }
+        ~Connection();
+
+        void swap(Connection &other) noexcept
+        {
+            qt_ptr_swap(pool, other.pool);
+            name.swap(other.name);
+        }
+
+        bool isValid() const noexcept { return pool != nullptr; }
+        QSqlDatabase database() const;
+
+    private:
+        Q_DISABLE_COPY(Connection)
+        friend class QSqlConnectionPool;
+        Connection(QSqlConnectionPool *pool, const QString &name)
+            : pool(pool), name(name)
+        {}
+
+        QSqlConnectionPool *pool = nullptr;
+        QString name;
+    };
+
+    Connection acquire(QDeadlineTimer deadline = QDeadlineTimer(QDeadlineTimer::Forever));
+
+    QString sourceConnectionName() const;
+    int maxConnections() const;
+    int openConnections() const;
+
+private:
+    Q_DISABLE_COPY_MOVE(QSqlConnectionPool)
+    void release(const QString &name);
+
+    QSqlConnectionPoolPrivate *d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSQLCONNECTIONPOOL_H
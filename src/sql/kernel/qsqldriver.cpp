@@ -7,6 +7,8 @@
 #include "qsqlerror.h"
 #include "qsqlfield.h"
 #include "qsqlindex.h"
+#include "qsqlquery.h"
+#include "qsqlrecord.h"
 #include "private/qsqldriver_p.h"
 #include "private/qtools_p.h"
 
@@ -801,6 +803,143 @@ int QSqlDriver::maximumIdentifierLength(QSqlDriver::IdentifierType type) const
     return INT_MAX;
 }
 
+/*!
+    \struct QSqlDriver::QueryStatistics
+    \inmodule QtSql
+    \since 6.9
+
+    \brief The QueryStatistics struct describes one query execution on a
+    database connection.
+
+    An instance is passed to the handler installed with
+    setQueryStatisticsHandler() every time a query is executed through
+    QSqlQuery on this connection.
+
+    \variable QSqlDriver::QueryStatistics::statement
+    The statement text as passed to QSqlQuery::exec() or QSqlQuery::prepare().
+
+    \variable QSqlDriver::QueryStatistics::boundValues
+    The number of values bound to the statement. 0 for queries executed
+    without placeholders.
+
+    \variable QSqlDriver::QueryStatistics::prepareNsecs
+    The time spent in QSqlQuery::prepare() for this statement, in
+    nanoseconds, or -1 if the statement was executed directly.
+
+    \variable QSqlDriver::QueryStatistics::executeNsecs
+    The time spent executing the statement, in nanoseconds. For select
+    statements on drivers that fetch lazily this does not include the time
+    spent navigating the result set.
+
+    \variable QSqlDriver::QueryStatistics::resultSize
+    The size of the result set, or -1 if the query is not a select
+    statement or the driver does not report query sizes
+    (\l{QSqlDriver::}{QuerySize}).
+
+    \variable QSqlDriver::QueryStatistics::rowsAffected
+    The number of rows affected by the statement, or -1 if it cannot be
+    determined.
+
+    \variable QSqlDriver::QueryStatistics::success
+    Whether the execution succeeded.
+*/
+
+/*!
+    \typealias QSqlDriver::QueryStatisticsHandler
+
+    A function that is called with a \l QueryStatistics instance after
+    every query execution.
+*/
+
+/*!
+    \since 6.9
+
+    Installs \a handler as the query statistics handler for this
+    connection. Once set, the handler is invoked after every statement
+    executed through QSqlQuery::exec() on this connection, with the
+    statement text, the number of bound values, prepare and execute
+    timings, and the result size. Pass a default-constructed
+    QueryStatisticsHandler to uninstall the handler again.
+
+    The handler is invoked synchronously from the thread executing the
+    query, so it should be cheap; aggregate or log the statistics rather
+    than doing heavy processing inline. When no handler is installed no
+    timing overhead is incurred.
+
+    \sa queryStatisticsHandler(), explainStatement()
+*/
+void QSqlDriver::setQueryStatisticsHandler(QueryStatisticsHandler handler)
+{
+    Q_D(QSqlDriver);
+    d->queryStatisticsHandler = std::move(handler);
+}
+
+/*!
+    \since 6.9
+
+    Returns the query statistics handler installed on this connection, or
+    a default-constructed QueryStatisticsHandler if none is installed.
+
+    \sa setQueryStatisticsHandler()
+*/
+QSqlDriver::QueryStatisticsHandler QSqlDriver::queryStatisticsHandler() const
+{
+    Q_D(const QSqlDriver);
+    return d->queryStatisticsHandler;
+}
+
+/*!
+    \since 6.9
+
+    Returns the execution plan the database reports for \a statement, or
+    an empty string if the plan cannot be retrieved. The statement is
+    planned but not executed.
+
+    The plan is obtained by prefixing \a statement with the
+    DBMS-specific explain keyword (\c{EXPLAIN QUERY PLAN} for SQLite,
+    \c{EXPLAIN} for PostgreSQL and MySQL) and executing the result.
+    Databases without such a statement-level explain command return an
+    empty string. The returned text is the raw plan as reported by the
+    database, with columns separated by tabs and rows by newlines; its
+    format varies between (and sometimes within) DBMS versions, so it is
+    meant for logging and inspection rather than parsing.
+
+    \sa setQueryStatisticsHandler()
+*/
+QString QSqlDriver::explainStatement(const QString &statement)
+{
+    QString prefix;
+    switch (dbmsType()) {
+    case SQLite:
+        prefix = "EXPLAIN QUERY PLAN "_L1;
+        break;
+    case PostgreSQL:
+    case MySqlServer:
+        prefix = "EXPLAIN "_L1;
+        break;
+    default:
+        return QString();
+    }
+    // The explain query itself should not show up in the statistics.
+    Q_D(QSqlDriver);
+    const QueryStatisticsHandler handler = std::exchange(d->queryStatisticsHandler, nullptr);
+    QSqlQuery query(createResult());
+    query.setForwardOnly(true);
+    const bool executed = query.exec(prefix + statement);
+    d->queryStatisticsHandler = handler;
+    if (!executed)
+        return QString();
+    const int columns = query.record().count();
+    QStringList rows;
+    while (query.next()) {
+        QStringList fields;
+        for (int i = 0; i < columns; ++i)
+            fields.append(query.value(i).toString());
+        rows.append(fields.join(u'\t'));
+    }
+    return rows.join(u'\n');
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qsqldriver.cpp"
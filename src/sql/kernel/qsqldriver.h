@@ -9,6 +9,8 @@
 #include <QtCore/qstring.h>
 #include <QtCore/qstringlist.h>
 
+#include <functional>
+
 // clazy:excludeall=qproperty-without-notify
 QT_BEGIN_NAMESPACE
 
@@ -56,6 +58,18 @@ public:
         MimerSQL,
     };
 
+    struct QueryStatistics
+    {
+        QString statement;
+        int boundValues = 0;
+        qint64 prepareNsecs = -1;
+        qint64 executeNsecs = -1;
+        int resultSize = -1;
+        int rowsAffected = -1;
+        bool success = false;
+    };
+    using QueryStatisticsHandler = std::function<void(const QueryStatistics &)>;
+
     explicit QSqlDriver(QObject *parent = nullptr);
     ~QSqlDriver();
     virtual bool isOpen() const;
@@ -98,6 +112,10 @@ public:
 
     DbmsType dbmsType() const;
     virtual int maximumIdentifierLength(IdentifierType type) const;
+
+    void setQueryStatisticsHandler(QueryStatisticsHandler handler);
+    QueryStatisticsHandler queryStatisticsHandler() const;
+    QString explainStatement(const QString &statement);
 public Q_SLOTS:
     virtual bool cancelQuery();
 
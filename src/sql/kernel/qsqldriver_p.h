@@ -34,6 +34,7 @@ public:
 
     QSqlError error;
     QSql::NumericalPrecisionPolicy precisionPolicy = QSql::LowPrecisionDouble;
+    QSqlDriver::QueryStatisticsHandler queryStatisticsHandler;
     QSqlDriver::DbmsType dbmsType;
     bool isOpen = false;
     bool isOpenError = false;
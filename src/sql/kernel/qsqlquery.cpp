@@ -14,9 +14,7 @@
 #include "qsqldatabase.h"
 #include "private/qsqlnulldriver_p.h"
 
-#ifdef QT_DEBUG_SQL
 #include "qelapsedtimer.h"
-#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -29,6 +27,7 @@ public:
     ~QSqlQueryPrivate();
     QAtomicInt ref;
     QSqlResult* sqlResult;
+    qint64 lastPrepareNsecs = -1;
 
     static QSqlQueryPrivate* shared_null();
 };
@@ -405,7 +404,21 @@ bool QSqlQuery::exec(const QString& query)
         return false;
     }
 
-    bool retval = d->sqlResult->reset(query);
+    bool retval;
+    if (const auto statsHandler = driver()->queryStatisticsHandler()) {
+        QElapsedTimer timer;
+        timer.start();
+        retval = d->sqlResult->reset(query);
+        QSqlDriver::QueryStatistics stats;
+        stats.statement = d->sqlResult->lastQuery();
+        stats.executeNsecs = timer.nsecsElapsed();
+        stats.resultSize = d->sqlResult->size();
+        stats.rowsAffected = d->sqlResult->numRowsAffected();
+        stats.success = retval;
+        statsHandler(stats);
+    } else {
+        retval = d->sqlResult->reset(query);
+    }
 #ifdef QT_DEBUG_SQL
     qCDebug(lcSqlQuery()).nospace() << "Executed query (" << t.elapsed() << "ms, "
                                     << d->sqlResult->size()
@@ -462,6 +475,45 @@ QVariant QSqlQuery::value(QAnyStringView name) const
     return QVariant();
 }
 
+/*!
+    \since 6.9
+
+    Returns a device for streaming the large object (BLOB) in field
+    \a i of the current record, or \nullptr if the field cannot be
+    streamed. The caller takes ownership of the device and must delete
+    it before navigating away from the current record or clearing the
+    query.
+
+    Unlike value(), which materializes the whole object as a
+    QByteArray, the returned device reads the object in chunks
+    directly from the database, so transferring a large object needs
+    only constant memory:
+
+    \code
+    query.next();
+    std::unique_ptr<QIODevice> blob(query.lobDevice(1));
+    if (blob) {
+        while (!blob->atEnd())
+            socket->write(blob->read(65536));
+    }
+    \endcode
+
+    Streaming is only available where the client library supports
+    incremental LOB I/O and the driver can locate the object; other
+    drivers and fields return \nullptr. The SQLite driver supports
+    streaming for table columns when the query also selects the
+    table's \c rowid.
+
+    \sa value(), isValid(), isActive()
+*/
+QIODevice *QSqlQuery::lobDevice(int i) const
+{
+    if (isActive() && isValid() && (i > -1))
+        return d->sqlResult->lobDevice(i);
+    qCWarning(lcSqlQuery, "QSqlQuery::lobDevice: not positioned on a valid record");
+    return nullptr;
+}
+
 /*!
     Returns the current internal position of the query. The first
     record is at position zero. If the position is invalid, the
@@ -676,6 +728,35 @@ bool QSqlQuery::next()
     }
 }
 
+/*!
+  \since 6.9
+
+  Retrieves up to \a maxRows records following the current position
+  and returns them as a list of rows, each row holding one QVariant
+  per field in record order. If \a maxRows is negative (the default),
+  all remaining records are retrieved. Note that the result must be in
+  the \l{isActive()}{active} state and isSelect() must return true
+  before calling this function or it will do nothing and return an
+  empty list.
+
+  This is equivalent to calling next() repeatedly and reading every
+  field with value(), but allows the driver to retrieve the records in
+  one step, which is considerably faster when draining large result
+  sets. Like next(), it positions the query on the last record
+  retrieved, or after the last record if the result set was exhausted.
+
+  This function works for both scrollable and
+  \l{setForwardOnly()}{forward-only} queries.
+
+  \sa next(), value(), record(), at()
+*/
+QList<QVariantList> QSqlQuery::fetchRows(int maxRows)
+{
+    if (!isSelect() || !isActive())
+        return {};
+    return d->sqlResult->fetchRows(maxRows);
+}
+
 /*!
 
   Retrieves the previous record in the result, if available, and
@@ -1004,6 +1085,14 @@ bool QSqlQuery::prepare(const QString& query)
 #ifdef QT_DEBUG_SQL
     qCDebug(lcSqlQuery, "\n QSqlQuery::prepare: %ls", qUtf16Printable(query));
 #endif
+    d->lastPrepareNsecs = -1;
+    if (driver()->queryStatisticsHandler()) {
+        QElapsedTimer timer;
+        timer.start();
+        const bool retval = d->sqlResult->savePrepare(query);
+        d->lastPrepareNsecs = timer.nsecsElapsed();
+        return retval;
+    }
     return d->sqlResult->savePrepare(query);
 }
 
@@ -1027,7 +1116,23 @@ bool QSqlQuery::exec()
     if (d->sqlResult->lastError().isValid())
         d->sqlResult->setLastError(QSqlError());
 
-    bool retval = d->sqlResult->exec();
+    bool retval;
+    if (const auto statsHandler = driver()->queryStatisticsHandler()) {
+        QElapsedTimer timer;
+        timer.start();
+        retval = d->sqlResult->exec();
+        QSqlDriver::QueryStatistics stats;
+        stats.statement = d->sqlResult->lastQuery();
+        stats.boundValues = d->sqlResult->boundValueCount();
+        stats.prepareNsecs = d->lastPrepareNsecs;
+        stats.executeNsecs = timer.nsecsElapsed();
+        stats.resultSize = d->sqlResult->size();
+        stats.rowsAffected = d->sqlResult->numRowsAffected();
+        stats.success = retval;
+        statsHandler(stats);
+    } else {
+        retval = d->sqlResult->exec();
+    }
 #ifdef QT_DEBUG_SQL
     qCDebug(lcSqlQuery).nospace() << "Executed prepared query (" << t.elapsed() << "ms, "
                                   << d->sqlResult->size() << " results, " << d->sqlResult->numRowsAffected()
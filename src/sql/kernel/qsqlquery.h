@@ -13,6 +13,7 @@
 QT_BEGIN_NAMESPACE
 
 
+class QIODevice;
 class QSqlDriver;
 class QSqlError;
 class QSqlResult;
@@ -77,6 +78,7 @@ public:
     QVariant value(const QString &name) const;
 #endif
     QVariant value(QAnyStringView name) const;
+    QIODevice *lobDevice(int i) const;
 
     void setNumericalPrecisionPolicy(QSql::NumericalPrecisionPolicy precisionPolicy);
     QSql::NumericalPrecisionPolicy numericalPrecisionPolicy() const;
@@ -87,6 +89,7 @@ public:
     bool seek(int i, bool relative = false);
     bool next();
     bool previous();
+    QList<QVariantList> fetchRows(int maxRows = -1);
     bool first();
     bool last();
 
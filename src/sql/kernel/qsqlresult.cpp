@@ -506,6 +506,80 @@ bool QSqlResult::fetchPrevious()
     return fetch(at() - 1);
 }
 
+/*!
+    \since 6.9
+
+    Fetches up to \a maxRows records starting at the record after the
+    current position and returns them as a list of rows, each row
+    holding one QVariant per field. If \a maxRows is negative, all
+    remaining records are fetched. The result is positioned on the
+    last record fetched, or after the last record if the result set
+    was exhausted.
+
+    This function is only called if the result is in an active state.
+    The default implementation calls fetchNext() and data() for each
+    record. Derived classes that can retrieve several records from the
+    database in one step should reimplement this function to avoid the
+    per-row and per-field virtual call overhead.
+
+    \sa fetchNext(), data(), QSqlQuery::fetchRows()
+*/
+
+QList<QVariantList> QSqlResult::fetchRows(int maxRows)
+{
+    QList<QVariantList> rows;
+    if (!isActive() || !isSelect())
+        return rows;
+    const int columns = record().count();
+    if (columns <= 0)
+        return rows;
+    while (maxRows < 0 || rows.size() < maxRows) {
+        bool fetched;
+        switch (at()) {
+        case QSql::BeforeFirstRow:
+            fetched = fetchFirst();
+            break;
+        case QSql::AfterLastRow:
+            fetched = false;
+            break;
+        default:
+            fetched = fetchNext();
+            if (!fetched)
+                setAt(QSql::AfterLastRow);
+            break;
+        }
+        if (!fetched)
+            break;
+        QVariantList row;
+        row.reserve(columns);
+        for (int i = 0; i < columns; ++i)
+            row.append(data(i));
+        rows.append(std::move(row));
+    }
+    return rows;
+}
+
+/*!
+    \since 6.9
+
+    Returns a device for streaming the large object (BLOB) in field
+    \a i of the current record, or \nullptr if the driver cannot
+    stream the field incrementally.
+
+    The default implementation returns \nullptr. Drivers whose client
+    library offers incremental LOB I/O reimplement this function and
+    return a new QIODevice that reads the object in chunks; the caller
+    takes ownership of the device.
+
+    \sa data(), QSqlQuery::lobDevice()
+*/
+
+QIODevice *QSqlResult::lobDevice(int i)
+{
+    Q_UNUSED(i);
+    return nullptr;
+}
+
 /*!
     Returns \c true if you can only scroll forward through the result
     set; otherwise returns \c false.
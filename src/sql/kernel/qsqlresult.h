@@ -12,6 +12,7 @@ QT_BEGIN_NAMESPACE
 
 
 class QString;
+class QIODevice;
 class QSqlRecord;
 class QVariant;
 class QSqlDriver;
@@ -86,6 +87,8 @@ protected:
     virtual bool fetchPrevious();
     virtual bool fetchFirst() = 0;
     virtual bool fetchLast() = 0;
+    virtual QList<QVariantList> fetchRows(int maxRows);
+    virtual QIODevice *lobDevice(int i);
     virtual int size() = 0;
     virtual int numRowsAffected() = 0;
     virtual QSqlRecord record() const;
@@ -49,6 +49,57 @@ void QSqlQueryModelPrivate::prefetch(int limit)
     }
 }
 
+void QSqlQueryModelPrivate::setWindowedQuery(const QString &queryText, const QSqlDatabase &db)
+{
+    Q_Q(QSqlQueryModel);
+    q->beginResetModel();
+
+    windowQuery = queryText;
+    windowDb = db;
+    windowCache.clear();
+    windowStart = 0;
+    error = QSqlError();
+    bottom = QModelIndex();
+    atEnd = true;
+    query.clear();
+    rec.clear();
+
+    // the row count is established once up front; the windowed queries
+    // below only ever see windowSize rows
+    int totalRows = 0;
+    QSqlQuery countQuery("SELECT COUNT(*) FROM ("_L1 + queryText + ") qt_window_count"_L1, db);
+    if (countQuery.next())
+        totalRows = countQuery.value(0).toInt();
+    else
+        error = countQuery.lastError();
+
+    if (!error.isValid())
+        fetchWindow(0);
+
+    if (colOffsets.size() != rec.count())
+        initColOffsets(rec.count());
+    if (totalRows > 0 && rec.count() > 0)
+        bottom = q->createIndex(totalRows - 1, rec.count() - 1);
+
+    q->endResetModel();
+    q->queryChange();
+}
+
+void QSqlQueryModelPrivate::fetchWindow(int row)
+{
+    const int start = qMax(0, row - windowSize / 2);
+    QSqlQuery windowQ(windowQuery + " LIMIT "_L1 + QString::number(windowSize)
+                      + " OFFSET "_L1 + QString::number(start), windowDb);
+    if (!windowQ.isActive()) {
+        error = windowQ.lastError();
+        return;
+    }
+    if (rec.isEmpty())
+        rec = windowQ.record();
+    windowCache = windowQ.fetchRows(windowSize);
+    windowStart = start;
+}
+
 QSqlQueryModelPrivate::~QSqlQueryModelPrivate()
 {
 }
@@ -336,6 +387,17 @@ QVariant QSqlQueryModel::data(const QModelIndex &item, int role) const
     if (!d->rec.isGenerated(item.column()))
         return v;
     QModelIndex dItem = indexInQuery(item);
+    if (d->windowSize > 0 && !d->windowQuery.isEmpty()) {
+        auto *dd = const_cast<QSqlQueryModelPrivate *>(d);
+        if (dItem.row() < d->windowStart
+            || dItem.row() >= d->windowStart + d->windowCache.size()) {
+            dd->fetchWindow(dItem.row());
+        }
+        const qsizetype offset = dItem.row() - d->windowStart;
+        if (offset < 0 || offset >= d->windowCache.size())
+            return v;
+        return d->windowCache.at(offset).value(dItem.column());
+    }
     if (dItem.row() > d->bottom.row())
         const_cast<QSqlQueryModelPrivate *>(d)->prefetch(dItem.row());
 
@@ -466,6 +528,11 @@ void QSqlQueryModel::setQuery(QSqlQuery &&query)
 */
 void QSqlQueryModel::setQuery(const QString &query, const QSqlDatabase &db)
 {
+    Q_D(QSqlQueryModel);
+    if (d->windowSize > 0) {
+        d->setWindowedQuery(query, db);
+        return;
+    }
     setQuery(QSqlQuery(query, db));
 }
 
@@ -483,9 +550,62 @@ void QSqlQueryModel::clear()
     d->colOffsets.clear();
     d->bottom = QModelIndex();
     d->headers.clear();
+    d->windowQuery.clear();
+    d->windowDb = QSqlDatabase();
+    d->windowCache.clear();
+    d->windowStart = 0;
     endResetModel();
 }
 
+/*!
+    \since 6.9
+
+    Sets the size of the fetch window to \a rows and enables windowed
+    fetching, or disables it if \a rows is 0 (the default).
+
+    In windowed mode the model does not accumulate the whole result
+    set. Instead it keeps only a window of about \a rows rows in
+    memory, centered on the rows most recently accessed, and
+    re-executes the query with a \c LIMIT/OFFSET clause whenever a row
+    outside the window is requested. The total row count is determined
+    once up front with a \c{SELECT COUNT(*)} wrapper query. This keeps
+    memory usage bounded when displaying very large tables, at the cost
+    of an extra query whenever the window moves.
+
+    Windowed fetching only takes effect when the query is set with
+    \l{QSqlQueryModel::}{setQuery(const QString &query, const QSqlDatabase &db)},
+    since the model must be able to re-execute the statement. The
+    database must support appending \c LIMIT and \c OFFSET to the
+    statement, and the query should have a deterministic order (use
+    \c{ORDER BY}) so that re-fetched windows line up with the
+    established row numbering. Changes made to the data by others
+    become visible whenever the window is re-fetched.
+
+    Calling this function does not affect an already set query; it
+    applies the next time setQuery() is called.
+
+    \sa fetchWindowSize(), setQuery()
+*/
+void QSqlQueryModel::setFetchWindowSize(int rows)
+{
+    Q_D(QSqlQueryModel);
+    d->windowSize = qMax(rows, 0);
+}
+
+/*!
+    \since 6.9
+
+    Returns the size of the fetch window, or 0 if windowed fetching is
+    disabled.
+
+    \sa setFetchWindowSize()
+*/
+int QSqlQueryModel::fetchWindowSize() const
+{
+    Q_D(const QSqlQueryModel);
+    return d->windowSize;
+}
+
 /*!
     Sets the caption for a horizontal header for the specified \a role to
     \a value. This is useful if the model is used to
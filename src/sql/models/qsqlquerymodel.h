@@ -53,6 +53,9 @@ public:
 
     virtual void clear();
 
+    void setFetchWindowSize(int rows);
+    int fetchWindowSize() const;
+
     QSqlError lastError() const;
 
     void fetchMore(const QModelIndex &parent = QModelIndex()) override;
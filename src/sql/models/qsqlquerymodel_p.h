@@ -17,6 +17,7 @@
 
 #include <QtSql/private/qtsqlglobal_p.h>
 #include "private/qabstractitemmodel_p.h"
+#include "QtSql/qsqldatabase.h"
 #include "QtSql/qsqlerror.h"
 #include "QtSql/qsqlquery.h"
 #include "QtSql/qsqlrecord.h"
@@ -38,6 +39,8 @@ public:
     void prefetch(int);
     void initColOffsets(int size);
     int columnInQuery(int modelColumn) const;
+    void setWindowedQuery(const QString &query, const QSqlDatabase &db);
+    void fetchWindow(int row);
 
     mutable QSqlQuery query = { QSqlQuery(nullptr) };
     mutable QSqlError error;
@@ -47,6 +50,13 @@ public:
     QList<QHash<int, QVariant>> headers;
     QVarLengthArray<int, 56> colOffsets; // used to calculate indexInQuery of columns
     int nestedResetLevel;
+    // windowed fetching (see setFetchWindowSize()); only the rows in
+    // [windowStart, windowStart + windowCache.size()) are kept in memory
+    QString windowQuery;
+    QSqlDatabase windowDb;
+    QList<QVariantList> windowCache;
+    int windowStart = 0;
+    int windowSize = 0;
 };
 
 // helpers for building SQL expressions
@@ -46,6 +46,9 @@ static const QBenchmarkMetricKey entries[] = {
     { AlignmentFaults, "AlignmentFaults", "alignment faults" },
     { EmulationFaults, "EmulationFaults", "emulation faults" },
     { RefCPUCycles, "RefCPUCycles", "Reference CPU cycles" },
+    { InstructionsPerCycle, "InstructionsPerCycle", "instructions/cycle" },
+    { BranchMissRate, "BranchMissRate", "%" },
+    { CacheMissRate, "CacheMissRate", "%" },
 };
 static const int NumEntries = sizeof(entries) / sizeof(entries[0]);
 
@@ -88,6 +91,9 @@ static const int NumEntries = sizeof(entries) / sizeof(entries[0]);
   \value MajorPageFaults        Major page faults
   \value AlignmentFaults        Faults caused due to misalignment
   \value EmulationFaults        Faults that needed software emulation
+  \value [since 6.9] InstructionsPerCycle   Instructions executed per CPU cycle
+  \value [since 6.9] BranchMissRate         Mispredicted branches, in percent of all branches
+  \value [since 6.9] CacheMissRate          Cache misses, in percent of all cache references
 
   \sa QTest::benchmarkMetricName(), QTest::benchmarkMetricUnit()
 
@@ -44,6 +44,9 @@ enum QBenchmarkMetric {
     AlignmentFaults,
     EmulationFaults,
     RefCPUCycles,
+    InstructionsPerCycle,
+    BranchMissRate,
+    CacheMissRate,
 };
 
 }
@@ -80,6 +80,9 @@ static QList<PerfEvent> defaultCounters()
         { .type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CPU_CYCLES },
         { .type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_INSTRUCTIONS },
         { .type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+        { .type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_BRANCH_MISSES },
+        { .type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CACHE_REFERENCES },
+        { .type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CACHE_MISSES },
     };
 }
 
@@ -483,10 +486,8 @@ void QBenchmarkPerfEventsMeasurer::start()
         int group_fd = -1;
         int flags = PERF_FLAG_FD_CLOEXEC;
 
-        fds.reserve(counters.size());
-        for (PerfEvent counter : std::as_const(counters)) {
-            attr.type = counter.type;
-            attr.config = counter.config;
+        auto openCounter = [&](int group_fd) {
+            attr.pinned = group_fd == -1; // only group leaders may be pinned
             int fd = perf_event_open(&attr, pid, cpu, group_fd, flags);
             if (fd == -1) {
                 // probably a paranoid kernel (/proc/sys/kernel/perf_event_paranoid)
@@ -494,6 +495,27 @@ void QBenchmarkPerfEventsMeasurer::start()
                 attr.exclude_hv = true;
                 fd = perf_event_open(&attr, pid, cpu, group_fd, flags);
             }
+            return fd;
+        };
+
+        // Schedule the counters as one event group, so they are all counting
+        // over exactly the same instructions and the ratios between them are
+        // meaningful. If the group doesn't fit on the PMU, fall back to
+        // free-running counters, which the kernel multiplexes and readValue()
+        // scales.
+        bool grouped = true;
+        fds.reserve(counters.size());
+        for (PerfEvent counter : std::as_const(counters)) {
+            attr.type = counter.type;
+            attr.config = counter.config;
+            int fd = -1;
+            if (grouped && !fds.isEmpty()) {
+                fd = openCounter(fds.first());
+                if (fd == -1)
+                    grouped = false;
+            }
+            if (fd == -1)
+                fd = openCounter(group_fd);
             if (fd == -1) {
                 perror("QBenchmarkPerfEventsMeasurer::start: perf_event_open");
                 exit(1);
@@ -519,6 +541,24 @@ QList<QBenchmarkMeasurerBase::Measurement> QBenchmarkPerfEventsMeasurer::stop()
     for (qsizetype i = 0; i < counters.size(); ++i) {
         result[i] = readValue(i);
     }
+
+    // derive the ratio metrics when both of their inputs were measured
+    auto valueOf = [&result](QTest::QBenchmarkMetric metric, qreal *value) {
+        for (const Measurement &m : std::as_const(result)) {
+            if (m.metric == metric) {
+                *value = m.value;
+                return true;
+            }
+        }
+        return false;
+    };
+    qreal total, detail;
+    if (valueOf(QTest::CPUCycles, &total) && valueOf(QTest::Instructions, &detail) && total > 0)
+        result.append({ detail / total, QTest::InstructionsPerCycle });
+    if (valueOf(QTest::BranchInstructions, &total) && valueOf(QTest::BranchMisses, &detail) && total > 0)
+        result.append({ detail * 100 / total, QTest::BranchMissRate });
+    if (valueOf(QTest::CacheReferences, &total) && valueOf(QTest::CacheMisses, &detail) && total > 0)
+        result.append({ detail * 100 / total, QTest::CacheMissRate });
     return result;
 }
 
@@ -0,0 +1,134 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qjsonbenchmarklogger_p.h"
+#include "qtestresult_p.h"
+#include "qbenchmark_p.h"
+
+#include <QtCore/qfile.h>
+#include <QtCore/qjsondocument.h>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+/*! \internal
+    \class QJsonBenchmarkLogger
+    \inmodule QtTest
+
+    QJsonBenchmarkLogger implements a machine-readable JSON report for
+    benchmarks.
+
+    Every benchmark result becomes one entry carrying the test function, data
+    tag, metric, unit, per-iteration value, total and iteration count. When the
+    QTEST_BENCHMARK_BASELINE environment variable names a report produced by an
+    earlier run, each entry also carries that run's per-iteration value and the
+    ratio of the current value to it, so regressions can be spotted without
+    post-processing.
+
+    It does not print test failures, debug messages, warnings or any other
+    details.
+*/
+
+static QString qJsonBenchmarkKey(const QString &function, const QString &tag, const QString &metric)
+{
+    return function + u'\x1f' + tag + u'\x1f' + metric;
+}
+
+QJsonBenchmarkLogger::QJsonBenchmarkLogger(const char *filename)
+    : QAbstractTestLogger(filename)
+{
+}
+
+QJsonBenchmarkLogger::~QJsonBenchmarkLogger() = default;
+
+void QJsonBenchmarkLogger::startLogging()
+{
+    const QString baselinePath = qEnvironmentVariable("QTEST_BENCHMARK_BASELINE");
+    if (baselinePath.isEmpty())
+        return;
+
+    QFile file(baselinePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        fprintf(stderr, "QJsonBenchmarkLogger: could not open baseline report %s\n",
+                qPrintable(baselinePath));
+        return;
+    }
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    const QJsonArray baselineResults = root.value("results"_L1).toArray();
+    for (const QJsonValue &entry : baselineResults) {
+        const QJsonObject result = entry.toObject();
+        baseline.insert(qJsonBenchmarkKey(result.value("function"_L1).toString(),
+                                          result.value("tag"_L1).toString(),
+                                          result.value("metric"_L1).toString()),
+                        result.value("valuePerIteration"_L1));
+    }
+}
+
+void QJsonBenchmarkLogger::stopLogging()
+{
+    QJsonObject root;
+    root["format"_L1] = "QtTestBenchmark"_L1;
+    root["version"_L1] = 1;
+    root["test"_L1] = QString::fromUtf8(QTestResult::currentAppName());
+    root["results"_L1] = results;
+    outputString(QJsonDocument(root).toJson().constData());
+}
+
+void QJsonBenchmarkLogger::enterTestFunction(const char *)
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::leaveTestFunction()
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::addIncident(QAbstractTestLogger::IncidentTypes, const char *, const char *, int)
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::addBenchmarkResult(const QBenchmarkResult &result)
+{
+    const char *fn = QTestResult::currentTestFunction() ? QTestResult::currentTestFunction()
+        : "UnknownTestFunc";
+    const char *tag = QTestResult::currentDataTag() ? QTestResult::currentDataTag() : "";
+    const char *gtag = QTestResult::currentGlobalDataTag()
+                     ? QTestResult::currentGlobalDataTag()
+                     : "";
+    const char *filler = (tag[0] && gtag[0]) ? ":" : "";
+
+    const QString function = QString::fromUtf8(fn);
+    const QString fullTag = QLatin1StringView(gtag) + QLatin1StringView(filler)
+            + QLatin1StringView(tag);
+    const QString metric = QLatin1StringView(QTest::benchmarkMetricName(result.measurement.metric));
+    const qreal valuePerIteration = result.measurement.value / result.iterations;
+
+    QJsonObject entry;
+    entry["function"_L1] = function;
+    entry["tag"_L1] = fullTag;
+    entry["metric"_L1] = metric;
+    entry["unit"_L1] = QLatin1StringView(QTest::benchmarkMetricUnit(result.measurement.metric));
+    entry["valuePerIteration"_L1] = valuePerIteration;
+    entry["total"_L1] = result.measurement.value;
+    entry["iterations"_L1] = result.iterations;
+
+    const QJsonValue baselineValue =
+            baseline.value(qJsonBenchmarkKey(function, fullTag, metric));
+    if (baselineValue.isDouble()) {
+        entry["baselineValuePerIteration"_L1] = baselineValue.toDouble();
+        if (baselineValue.toDouble() != 0.0)
+            entry["ratioToBaseline"_L1] = valuePerIteration / baselineValue.toDouble();
+    }
+
+    results.append(entry);
+}
+
+void QJsonBenchmarkLogger::addMessage(QAbstractTestLogger::MessageTypes, const QString &, const char *, int)
+{
+    // don't print anything
+}
+
+QT_END_NAMESPACE
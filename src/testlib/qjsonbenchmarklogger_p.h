@@ -0,0 +1,51 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QJSONBENCHMARKLOGGER_P_H
+#define QJSONBENCHMARKLOGGER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qabstracttestlogger_p.h"
+
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+
+QT_BEGIN_NAMESPACE
+
+class QJsonBenchmarkLogger : public QAbstractTestLogger
+{
+public:
+    QJsonBenchmarkLogger(const char *filename);
+    ~QJsonBenchmarkLogger();
+
+    void startLogging() override;
+    void stopLogging() override;
+
+    void enterTestFunction(const char *function) override;
+    void leaveTestFunction() override;
+
+    void addIncident(IncidentTypes type, const char *description,
+                     const char *file = nullptr, int line = 0) override;
+    void addBenchmarkResult(const QBenchmarkResult &result) override;
+
+    void addMessage(MessageTypes type, const QString &message,
+                            const char *file = nullptr, int line = 0) override;
+
+private:
+    QJsonArray results;
+    QJsonObject baseline; // per-iteration values from an earlier report
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONBENCHMARKLOGGER_P_H
@@ -386,6 +386,9 @@ void QPlainTestLogger::printBenchmarkResults(const QList<QBenchmarkResult> &resu
 
         case QTest::FramesPerSecond:
         case QTest::CPUTicks:
+        case QTest::InstructionsPerCycle:
+        case QTest::BranchMissRate:
+        case QTest::CacheMissRate:
         case QTest::WalltimeMilliseconds:
         case QTest::WalltimeNanoseconds:
             break;  // no additional information
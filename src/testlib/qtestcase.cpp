@@ -18,6 +18,9 @@
 #include <QtCore/qlist.h>
 #include <QtCore/qmetaobject.h>
 #include <QtCore/qobject.h>
+#if QT_CONFIG(process)
+#include <QtCore/qprocess.h>
+#endif
 #include <QtCore/qstringlist.h>
 #include <QtCore/qtemporarydir.h>
 #include <QtCore/qthread.h>
@@ -435,6 +438,9 @@ static int timeout = -1;
 static int repetitions = 1;
 static bool repeatForever = false;
 static bool skipBlacklisted = false;
+#if QT_CONFIG(process)
+static int parallelJobs = 1;
+#endif
 
 namespace Internal {
 bool noCrashHandler = false;
@@ -619,6 +625,9 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
 
     repetitions = 1;
     repeatForever = false;
+#if QT_CONFIG(process)
+    parallelJobs = 1;
+#endif
 
     QTest::testFunctions.clear();
     QTest::testTags.clear();
@@ -640,6 +649,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
          "                       Valid formats are:\n"
          "                         txt      : Plain text\n"
          "                         csv      : CSV format (suitable for benchmarks)\n"
+         "                         json     : JSON benchmark report\n"
          "                         junitxml : XML JUnit document\n"
          "                         xml      : XML document\n"
          "                         lightxml : A stream of XML tags\n"
@@ -652,6 +662,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
          " -o filename         : Write the output into file\n"
          " -txt                : Output results in Plain Text\n"
          " -csv                : Output results in a CSV format (suitable for benchmarks)\n"
+         " -json               : Output results as a JSON benchmark report\n"
          " -junitxml           : Output results as XML JUnit document\n"
          " -xml                : Output results as XML document\n"
          " -lightxml           : Output results as stream of XML tags\n"
@@ -683,6 +694,11 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
          "                       Useful for finding flaky tests. If negative, the tests are\n"
          "                       repeated forever. This is intended as a developer tool, and\n"
          "                       is only supported with the plain text logger.\n"
+#if QT_CONFIG(process)
+         " -parallel n         : Run the test functions in up to n child processes at a\n"
+         "                       time, relaying their reports in declaration order. Only\n"
+         "                       supported with loggers that write to stdout.\n"
+#endif
          " -skipblacklisted    : Skip blacklisted tests. Useful for measuring test coverage.\n"
          " -[no]throwonfail    : Enables/disables throwing on QCOMPARE()/QVERIFY()/etc.\n"
          "                       Default: off,  unless QTEST_THROW_ON_FAIL is set."
@@ -745,6 +761,8 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
             logFormat = QTestLog::Plain;
         } else if (strcmp(argv[i], "-csv") == 0) {
             logFormat = QTestLog::CSV;
+        } else if (strcmp(argv[i], "-json") == 0) {
+            logFormat = QTestLog::JSON;
         } else if (strcmp(argv[i], "-junitxml") == 0)  {
             logFormat = QTestLog::JUnitXML;
         } else if (strcmp(argv[i], "-xunitxml") == 0)  {
@@ -784,6 +802,8 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                     logFormat = QTestLog::Plain;
                 else if (strcmp(format, "csv") == 0)
                     logFormat = QTestLog::CSV;
+                else if (strcmp(format, "json") == 0)
+                    logFormat = QTestLog::JSON;
                 else if (strcmp(format, "lightxml") == 0)
                     logFormat = QTestLog::LightXML;
                 else if (strcmp(format, "xml") == 0)
@@ -798,7 +818,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                 else if (strcmp(format, "tap") == 0)
                     logFormat = QTestLog::TAP;
                 else {
-                    fprintf(stderr, "output format must be one of txt, csv, lightxml, xml, tap, teamcity or junitxml\n");
+                    fprintf(stderr, "output format must be one of txt, csv, json, lightxml, xml, tap, teamcity or junitxml\n");
                     exit(1);
                 }
                 if (strcmp(filename, "-") == 0 && QTestLog::loggerUsingStdout()) {
@@ -845,6 +865,15 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
                 repetitions = qToInt(argv[++i]);
                 repeatForever = repetitions < 0;
             }
+#if QT_CONFIG(process)
+        } else if (strcmp(argv[i], "-parallel") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "-parallel needs an extra parameter with the number of child processes\n");
+                exit(1);
+            } else {
+                parallelJobs = qToInt(argv[++i]);
+            }
+#endif
         } else if (strcmp(argv[i], "-nocrashhandler") == 0) {
             QTest::Internal::noCrashHandler = true;
         } else if (strcmp(argv[i], "-skipblacklisted") == 0) {
@@ -1013,6 +1042,18 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, const char *const argv[], bool
         fprintf(stderr, "-repeat is only supported with plain text logger\n");
         exit(1);
     }
+
+#if QT_CONFIG(process)
+    if (parallelJobs > 1 && !QTestLog::loggerUsingStdout()) {
+        fprintf(stderr, "-parallel is only supported with loggers that write to stdout\n");
+        exit(1);
+    }
+    if (parallelJobs > 1 && !QCoreApplication::instance()) {
+        fprintf(stderr, "WARNING: -parallel requires a QCoreApplication. "
+                        "Running the test functions serially.\n");
+        parallelJobs = 1;
+    }
+#endif
 }
 
 // Temporary, backwards compatibility, until qtdeclarative's use of it is converted
@@ -1772,6 +1813,104 @@ bool reportResult(bool success, const void *lhs, const void *rhs,
     return QTestResult::reportResult(success, lhs, rhs, lhsFormatter, rhsFormatter,
                                      lhsExpr, rhsExpr, op, file, line);
 }
+
+#if QT_CONFIG(process)
+/*! \internal
+    Returns true if this process shards the test functions across -parallel
+    child processes instead of invoking them itself.
+*/
+static bool isParallelParentProcess()
+{
+    return parallelJobs > 1 && QCoreApplication::instance()
+        && !qEnvironmentVariableIsSet("QTEST_PARALLEL_WORKER");
+}
+
+/*! \internal
+    Runs every test function in a child process of its own, keeping up to
+    \c parallelJobs children busy at a time. Each child re-runs this binary
+    with the original options plus a single test function selection, so it
+    reports through the ordinary logging plumbing and keeps the crash handler's
+    per-process isolation. The children's merged output is relayed strictly in
+    declaration order, making the combined report deterministic regardless of
+    how the children are scheduled.
+
+    Returns the accumulated failure count, capped like qRun()'s exit code.
+*/
+static int qRunInParallel()
+{
+    // Forward the original options to the children, minus -parallel and the
+    // test function selections, which become one child process each.
+    QStringList args = QCoreApplication::arguments();
+    const QString program = args.takeFirst();
+    QStringList jobs;
+    for (qsizetype i = 0; i < args.size(); ) {
+        const QString &arg = args.at(i);
+        if (arg == "-parallel"_L1) {
+            args.remove(i, qMin(qsizetype(2), args.size() - i));
+        } else if (!arg.startsWith(u'-')
+                   && QTest::testFunctions.contains(arg.section(u':', 0, 0))) {
+            jobs += arg;
+            args.removeAt(i);
+        } else {
+            ++i;
+        }
+    }
+    if (jobs.isEmpty()) {
+        // No selection on the command line: shard all test slots.
+        const QMetaObject *metaObject = QTest::currentTestObject->metaObject();
+        for (int i = 0; i < metaObject->methodCount(); ++i) {
+            const QMetaMethod sl = metaObject->method(i);
+            if (isValidSlot(sl))
+                jobs += QString::fromLatin1(sl.name());
+        }
+    }
+
+    struct Job {
+        QString selection;
+        std::unique_ptr<QProcess> process;
+    };
+    std::vector<Job> queue;
+    queue.reserve(size_t(jobs.size()));
+    for (const QString &job : std::as_const(jobs))
+        queue.push_back({ job, nullptr });
+
+    QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
+    env.insert(QStringLiteral("QTEST_PARALLEL_WORKER"), QStringLiteral("1"));
+
+    qsizetype nextToStart = 0;
+    const auto startNext = [&] {
+        if (nextToStart >= qsizetype(queue.size()))
+            return;
+        Job &job = queue[nextToStart++];
+        job.process = std::make_unique<QProcess>();
+        job.process->setProcessChannelMode(QProcess::MergedChannels);
+        job.process->setProcessEnvironment(env);
+        job.process->start(program, QStringList(args) << job.selection);
+    };
+    for (qsizetype i = 0; i < qsizetype(parallelJobs) && i < qsizetype(queue.size()); ++i)
+        startNext();
+
+    int failCount = 0;
+    for (Job &job : queue) {
+        const bool finished = job.process->waitForFinished(-1);
+        startNext(); // keep the pipeline full while we relay in order
+        const QByteArray output = job.process->readAllStandardOutput();
+        fwrite(output.constData(), 1, size_t(output.size()), stdout);
+        fflush(stdout);
+        if (!finished || job.process->exitStatus() != QProcess::NormalExit) {
+            fprintf(stderr, "QTest: child process for test function %s did not finish normally\n",
+                    qPrintable(job.selection));
+            ++failCount;
+        } else {
+            failCount += job.process->exitCode();
+        }
+    }
+    // make sure our exit code is never going above 127
+    // since that could wrap and indicate 0 test fails
+    return qMin(failCount, 127);
+}
+#endif // QT_CONFIG(process)
+
 } // namespace QTest
 
 static void initEnvironment()
@@ -1877,6 +2016,9 @@ void QTest::qInit(QObject *testObject, int argc, char **argv)
 
 #if QT_CONFIG(valgrind)
     if (QBenchmarkGlobalData::current->mode() != QBenchmarkGlobalData::CallgrindParentProcess)
+#endif
+#if QT_CONFIG(process)
+    if (!isParallelParentProcess()) // the children log, the parent only relays
 #endif
         QTestLog::startLogging();
 }
@@ -1907,6 +2049,11 @@ int QTest::qRun()
         QBenchmarkValgrindUtils::cleanup();
 
     } else
+#endif
+#if QT_CONFIG(process)
+    if (isParallelParentProcess()) {
+        return qRunInParallel();
+    } else
 #endif
     {
         std::optional<CrashHandler::FatalSignalHandler> handler;
@@ -1984,6 +2131,9 @@ void QTest::qCleanup()
 
 #if QT_CONFIG(valgrind)
     if (QBenchmarkGlobalData::current->mode() != QBenchmarkGlobalData::CallgrindParentProcess)
+#endif
+#if QT_CONFIG(process)
+    if (!isParallelParentProcess())
 #endif
         QTestLog::stopLogging();
 
@@ -34,6 +34,7 @@ enum {
     CONSTANT_COMPRESSLEVEL_DEFAULT = -1,
     CONSTANT_ZSTDCOMPRESSLEVEL_CHECK = 1,   // Zstd level to check if compressing is a good idea
     CONSTANT_ZSTDCOMPRESSLEVEL_STORE = 14,  // Zstd level to actually store the data
+    CONSTANT_ZSTDCHUNKSIZE = 256 * 1024,    // uncompressed bytes per Zstd frame
     CONSTANT_COMPRESSTHRESHOLD_DEFAULT = 70
 };
 
@@ -304,40 +305,59 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib,
         if (m_compressAlgo == RCCResourceLibrary::CompressionAlgorithm::Zstd && !m_noZstd) {
             if (lib.m_zstdCCtx == nullptr)
                 lib.m_zstdCCtx = ZSTD_createCCtx();
-            qsizetype size = data.size();
-            size = ZSTD_COMPRESSBOUND(size);
 
             int compressLevel = m_compressLevel;
             if (compressLevel < 0)
                 compressLevel = CONSTANT_ZSTDCOMPRESSLEVEL_CHECK;
 
-            QByteArray compressed(size, Qt::Uninitialized);
-            char *dst = const_cast<char *>(compressed.constData());
-            size_t n = ZSTD_compressCCtx(lib.m_zstdCCtx, dst, size,
-                                         data.constData(), data.size(),
-                                         compressLevel);
-            if (n * 100.0 < data.size() * 1.0 * (100 - m_compressThreshold) ) {
+            // Entries larger than CONSTANT_ZSTDCHUNKSIZE are cut into one
+            // independently compressed frame per chunk (concatenated frames
+            // are a valid zstd stream), so readers can decompress only the
+            // frames that a read actually touches.
+            QByteArray compressed;
+            auto compressChunked = [&](int level) -> size_t {
+                compressed.clear();
+                size_t total = 0;
+                for (qsizetype inPos = 0; inPos < data.size(); ) {
+                    const qsizetype chunk = qMin(qsizetype(CONSTANT_ZSTDCHUNKSIZE),
+                                                 data.size() - inPos);
+                    const size_t bound = ZSTD_COMPRESSBOUND(size_t(chunk));
+                    const qsizetype oldSize = compressed.size();
+                    compressed.resize(oldSize + qsizetype(bound));
+                    size_t n = ZSTD_compressCCtx(lib.m_zstdCCtx, compressed.data() + oldSize,
+                                                 bound, data.constData() + inPos, size_t(chunk),
+                                                 level);
+                    if (ZSTD_isError(n))
+                        return n;
+                    compressed.truncate(oldSize + qsizetype(n));
+                    total += n;
+                    inPos += chunk;
+                }
+                return total;
+            };
+
+            size_t n = compressChunked(compressLevel);
+            if (!ZSTD_isError(n) && n * 100.0 < data.size() * 1.0 * (100 - m_compressThreshold)) {
                 // compressing is worth it
                 if (m_compressLevel < 0) {
                     // heuristic compression, so recompress
-                    n = ZSTD_compressCCtx(lib.m_zstdCCtx, dst, size,
-                                          data.constData(), data.size(),
-                                          CONSTANT_ZSTDCOMPRESSLEVEL_STORE);
+                    n = compressChunked(CONSTANT_ZSTDCOMPRESSLEVEL_STORE);
                 }
                 if (ZSTD_isError(n)) {
                     QString msg = QString::fromLatin1("%1: error: compression with zstd failed: %2\n")
                             .arg(m_name, QString::fromUtf8(ZSTD_getErrorName(n)));
                     lib.m_errorDevice->write(msg.toUtf8());
-                } else if (lib.verbose()) {
-                    QString msg = QString::fromLatin1("%1: note: compressed using zstd (%2 -> %3)\n")
-                            .arg(m_name).arg(data.size()).arg(n);
-                    lib.m_errorDevice->write(msg.toUtf8());
-                }
+                } else {
+                    if (lib.verbose()) {
+                        QString msg = QString::fromLatin1("%1: note: compressed using zstd (%2 -> %3)\n")
+                                .arg(m_name).arg(data.size()).arg(n);
+                        lib.m_errorDevice->write(msg.toUtf8());
+                    }
 
-                lib.m_overallFlags |= CompressedZstd;
-                m_flags |= CompressedZstd;
-                data = std::move(compressed);
-                data.truncate(n);
+                    lib.m_overallFlags |= CompressedZstd;
+                    m_flags |= CompressedZstd;
+                    data = std::move(compressed);
+                }
             } else if (lib.verbose()) {
                 QString msg = QString::fromLatin1("%1: note: not compressed\n").arg(m_name);
                 lib.m_errorDevice->write(msg.toUtf8());
@@ -713,9 +713,11 @@
     \value DeviceCoordinateCache Caching is enabled at the paint device level,
     in device coordinates. This mode is for items that can move, but are not
     rotated, scaled or sheared. If the item is transformed directly or
-    indirectly, the cache will be regenerated automatically. Unlike
-    ItemCoordinateCacheMode, DeviceCoordinateCache always renders at maximum
-    quality.
+    indirectly, the cache will be regenerated automatically. Small scale
+    changes (up to 25%), for example during an interactive zoom, are drawn by
+    transforming the cached contents; the cache is regenerated once the scale
+    deviates further from the contents. Apart from this, DeviceCoordinateCache
+    renders at maximum quality, unlike ItemCoordinateCache.
 
     \sa QGraphicsItem::setCacheMode()
 */
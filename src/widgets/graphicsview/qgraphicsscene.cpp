@@ -157,6 +157,12 @@
     removing items is logarithmic. This approach is best for static scenes
     (i.e., scenes where most items do not move).
 
+    \value QuadtreeIndex A loose quadtree is applied. Item location is of
+    logarithmic complexity, and adding, moving and removing items is
+    incremental; unlike BspTreeIndex, no scene-wide re-partitioning takes
+    place after bulk item moves. This approach is best for large dynamic
+    scenes. This value was introduced in Qt 6.9.
+
     \value NoIndex No index is applied. Item location is of linear complexity,
     as all items on the scene are searched. Adding, moving and removing items,
     however, is done in constant time. This approach is ideal for dynamic
@@ -179,6 +185,7 @@
 #include "qgraphicssceneindex_p.h"
 #include "qgraphicsscenebsptreeindex_p.h"
 #include "qgraphicsscenelinearindex_p.h"
+#include "qgraphicsscenequadtreeindex_p.h"
 
 #include <QtCore/qdebug.h>
 #include <QtCore/qlist.h>
@@ -1846,6 +1853,8 @@ void QGraphicsScene::setItemIndexMethod(ItemIndexMethod method)
     delete d->index;
     if (method == BspTreeIndex)
         d->index = new QGraphicsSceneBspTreeIndex(this);
+    else if (method == QuadtreeIndex)
+        d->index = new QGraphicsSceneQuadtreeIndex(this);
     else
         d->index = new QGraphicsSceneLinearIndex(this);
     for (int i = oldItems.size() - 1; i >= 0; --i)
@@ -4463,10 +4472,49 @@ void QGraphicsScenePrivate::drawItemHelper(QGraphicsItem *item, QPainter *painte
         QTransform diff = deviceData->lastTransform.inverted(&invertable);
         if (invertable)
             diff *= painter->worldTransform();
-        deviceData->lastTransform = painter->worldTransform();
-        bool allowPartialCacheExposure = false;
         bool simpleTransform = invertable && diff.type() <= QTransform::TxTranslate
                                && transformIsSimple(painter->worldTransform());
+
+        // If the cache contents are valid and the transform has only changed
+        // by a modest scale (e.g. an ongoing zoom), or moved under a rotated
+        // view, blit the cached pixmap through the relative transform instead
+        // of re-rendering the item. lastTransform is deliberately left at the
+        // transform the cache was rasterized with, so the distortion is
+        // accumulated and the cache re-rendered once it exceeds the threshold.
+        if (!simpleTransform && invertable && diff.type() <= QTransform::TxScale
+            && !itemCache->allExposed && itemCache->exposed.isEmpty()
+            && deviceData->cacheIndent == QPoint() && pixmapFound && !pix.isNull()) {
+            const qreal maxCacheDistortion = 0.25;
+            const qreal distortion = qMax(qAbs(diff.m11() - 1), qAbs(diff.m22() - 1));
+            // Reconstruct the device rect the cache was rendered for; the
+            // item has no pending exposes, so its bounding rect is the same
+            // as when the cache was filled. The pixmap must cover that rect
+            // completely: a cache that was clipped to the viewport (partial
+            // exposure with a zero indent) cannot serve bands the scale
+            // change would newly expose.
+            const QRect cachedRect = deviceData->lastTransform.mapRect(brect).toRect()
+                                             .adjusted(-1, -1, 1, 1);
+            if (distortion <= maxCacheDistortion
+                && pix.size() == cachedRect.size() * devicePixelRatio) {
+                const QTransform restoreTransform = painter->worldTransform();
+                const QPainter::RenderHints restoreHints = painter->renderHints();
+                painter->setWorldTransform(diff);
+                painter->setRenderHint(QPainter::SmoothPixmapTransform);
+                if (newPainterOpacity != oldPainterOpacity) {
+                    painter->setOpacity(newPainterOpacity);
+                    painter->drawPixmap(cachedRect.topLeft(), pix);
+                    painter->setOpacity(oldPainterOpacity);
+                } else {
+                    painter->drawPixmap(cachedRect.topLeft(), pix);
+                }
+                painter->setRenderHints(restoreHints);
+                painter->setWorldTransform(restoreTransform);
+                return;
+            }
+        }
+
+        deviceData->lastTransform = painter->worldTransform();
+        bool allowPartialCacheExposure = false;
         if (!simpleTransform) {
             pixModified = true;
             itemCache->allExposed = true;
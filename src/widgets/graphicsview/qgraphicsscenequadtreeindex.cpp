@@ -0,0 +1,348 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+/*!
+    \class QGraphicsSceneQuadtreeIndex
+    \brief The QGraphicsSceneQuadtreeIndex class provides a loose quadtree
+    index for discovering items in QGraphicsScene.
+    \since 6.9
+    \ingroup graphicsview-api
+
+    \internal
+
+    Unlike the BSP tree index, which periodically re-partitions the whole
+    scene, the quadtree index is fully incremental: every insertion and
+    removal touches only the path from the root to one node, so bulk item
+    moves never trigger a scene-wide rebuild stall. The tree is "loose" -
+    each node accepts items that fit within twice its cell size - which
+    means a moving item can stay indexed without being pushed up to the
+    root whenever it crosses a cell boundary.
+
+    Items are first queued and inserted in bulk on the next query, so that
+    scenes populated from large item arrays pay one traversal per item
+    instead of growing bookkeeping structures while items are still being
+    constructed.
+
+    \sa QGraphicsScene, QGraphicsSceneIndex, QGraphicsSceneBspTreeIndex
+*/
+
+#include "qgraphicsscenequadtreeindex_p.h"
+
+#include <private/qgraphicsitem_p.h>
+#include <private/qgraphicsscenebsptreeindex_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// Beyond this depth cells become smaller than typical items and the tree
+// degenerates into a linked list of single-child nodes.
+static const int QGRAPHICSSCENE_QUADTREE_MAXDEPTH = 12;
+
+// The loose bounds of a cell: twice the cell size, centered on the cell.
+static inline QRectF looseRect(const QRectF &rect)
+{
+    const qreal dx = rect.width() / 2;
+    const qreal dy = rect.height() / 2;
+    return rect.adjusted(-dx, -dy, dx, dy);
+}
+
+/*!
+    Constructs a quadtree scene index for the given \a scene.
+*/
+QGraphicsSceneQuadtreeIndex::QGraphicsSceneQuadtreeIndex(QGraphicsScene *scene)
+    : QGraphicsSceneIndex(scene)
+{
+}
+
+QGraphicsSceneQuadtreeIndex::~QGraphicsSceneQuadtreeIndex()
+{
+}
+
+/*!
+    \internal
+    Clears the quadtree index.
+*/
+void QGraphicsSceneQuadtreeIndex::clear()
+{
+    for (Node *&child : m_root.children) {
+        delete child;
+        child = nullptr;
+    }
+    m_root.items.clear();
+    m_itemNodes.clear();
+    m_pendingItems.clear();
+    m_untransformableItems.clear();
+}
+
+/*!
+    Adds the \a item to the quadtree index.
+*/
+void QGraphicsSceneQuadtreeIndex::addItem(QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    // Indexing requires sceneBoundingRect(), but because \a item might
+    // not be completely constructed at this point, we queue it and insert
+    // in bulk before the next query.
+    m_pendingItems << item;
+}
+
+/*!
+    Removes the \a item from the quadtree index.
+*/
+void QGraphicsSceneQuadtreeIndex::removeItem(QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    const auto it = m_itemNodes.constFind(item);
+    if (it != m_itemNodes.cend()) {
+        if (Node *node = it.value())
+            node->items.removeOne(item);
+        else if (QGraphicsItemPrivate::get(item)->itemIsUntransformable())
+            m_untransformableItems.removeOne(item);
+        m_itemNodes.erase(it);
+    } else {
+        m_pendingItems.removeOne(item);
+    }
+}
+
+/*!
+    \internal
+    Moves the \a item back to the pending list so that it is re-inserted at
+    its new position before the next query.
+*/
+void QGraphicsSceneQuadtreeIndex::moveToPendingItems(QGraphicsItem *item, bool recursive)
+{
+    if (!item)
+        return;
+
+    if (m_itemNodes.contains(item)) {
+        removeItem(item);
+        m_pendingItems << item;
+    }
+
+    if (recursive) {
+        for (int i = 0; i < QGraphicsItemPrivate::get(item)->children.size(); ++i)
+            moveToPendingItems(QGraphicsItemPrivate::get(item)->children.at(i), recursive);
+    }
+}
+
+/*!
+    \internal
+    Re-indexes the \a item when its bounding rect is about to change.
+*/
+void QGraphicsSceneQuadtreeIndex::prepareBoundingRectChange(const QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    QGraphicsItem *thatItem = const_cast<QGraphicsItem *>(item);
+    moveToPendingItems(thatItem, /*recursive=*/true);
+}
+
+/*!
+    \internal
+    Inserts the \a item into the deepest node whose loose bounds contain its
+    scene bounding rect. Items that do not fit anywhere (or lie outside the
+    scene rect) stay in the root node.
+*/
+void QGraphicsSceneQuadtreeIndex::insertItem(QGraphicsItem *item)
+{
+    const QRectF rect = QGraphicsItemPrivate::get(item)->sceneEffectiveBoundingRect();
+    Node *node = &m_root;
+    for (int depth = 0; depth < QGRAPHICSSCENE_QUADTREE_MAXDEPTH; ++depth) {
+        if (node->rect.isEmpty())
+            break;
+        const QPointF center = node->rect.center();
+        const int quadrant = (rect.center().x() >= center.x() ? 1 : 0)
+                             | (rect.center().y() >= center.y() ? 2 : 0);
+        QRectF childRect(node->rect.topLeft(), center);
+        if (quadrant & 1)
+            childRect.moveLeft(center.x());
+        if (quadrant & 2)
+            childRect.moveTop(center.y());
+        if (!looseRect(childRect).contains(rect))
+            break;
+        if (!node->children[quadrant]) {
+            node->children[quadrant] = new Node;
+            node->children[quadrant]->rect = childRect;
+        }
+        node = node->children[quadrant];
+    }
+    node->items << item;
+    m_itemNodes.insert(item, node);
+}
+
+/*!
+    \internal
+    Bulk-inserts all queued items into the tree.
+*/
+void QGraphicsSceneQuadtreeIndex::flushPendingItems()
+{
+    if (m_pendingItems.isEmpty())
+        return;
+
+    if (m_root.rect.isEmpty())
+        m_root.rect = scene()->sceneRect();
+
+    for (QGraphicsItem *item : std::as_const(m_pendingItems)) {
+        if (QGraphicsItemPrivate::get(item)->itemIsUntransformable()) {
+            m_untransformableItems << item;
+            m_itemNodes.insert(item, nullptr);
+            continue;
+        }
+        if (QGraphicsItemPrivate::get(item)->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+            || QGraphicsItemPrivate::get(item)->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren) {
+            // Covered by an ancestor's shape; discovery descends from the
+            // ancestor, so the item does not need to be in the tree.
+            m_itemNodes.insert(item, nullptr);
+            continue;
+        }
+        insertItem(item);
+    }
+    m_pendingItems.clear();
+}
+
+/*!
+    \internal
+    Appends the items of every node whose loose bounds intersect \a rect.
+*/
+void QGraphicsSceneQuadtreeIndex::collectItems(const Node *node, const QRectF &rect, QList<QGraphicsItem *> *items) const
+{
+    *items += node->items;
+    for (const Node *child : node->children) {
+        if (child && QRectF_intersects(looseRect(child->rect), rect))
+            collectItems(child, rect, items);
+    }
+}
+
+QList<QGraphicsItem *> QGraphicsSceneQuadtreeIndex::estimateItems(const QRectF &rect, Qt::SortOrder order,
+                                                                  bool onlyTopLevelItems) const
+{
+    if (onlyTopLevelItems && rect.isNull())
+        return QGraphicsSceneIndex::estimateTopLevelItems(rect, order);
+
+    const_cast<QGraphicsSceneQuadtreeIndex *>(this)->flushPendingItems();
+
+    QList<QGraphicsItem *> rectItems;
+    collectItems(&m_root, rect, &rectItems);
+    rectItems += m_untransformableItems;
+
+    if (onlyTopLevelItems) {
+        QList<QGraphicsItem *> topLevelItems;
+        for (QGraphicsItem *item : std::as_const(rectItems)) {
+            QGraphicsItem *topLevelItem = item->topLevelItem();
+            if (!QGraphicsItemPrivate::get(topLevelItem)->itemDiscovered) {
+                QGraphicsItemPrivate::get(topLevelItem)->itemDiscovered = 1;
+                topLevelItems << topLevelItem;
+            }
+        }
+        for (QGraphicsItem *item : std::as_const(topLevelItems))
+            QGraphicsItemPrivate::get(item)->itemDiscovered = 0;
+        rectItems = topLevelItems;
+    }
+
+    QGraphicsSceneBspTreeIndexPrivate::sortItems(&rectItems, order, /*sortCacheEnabled=*/false, onlyTopLevelItems);
+    return rectItems;
+}
+
+/*!
+    Returns an estimation of the items that are inside or intersect with the
+    specified \a rect, sorted using \a order.
+*/
+QList<QGraphicsItem *> QGraphicsSceneQuadtreeIndex::estimateItems(const QRectF &rect, Qt::SortOrder order) const
+{
+    return estimateItems(rect, order, /*onlyTopLevelItems=*/false);
+}
+
+QList<QGraphicsItem *> QGraphicsSceneQuadtreeIndex::estimateTopLevelItems(const QRectF &rect, Qt::SortOrder order) const
+{
+    return estimateItems(rect, order, /*onlyTopLevelItems=*/true);
+}
+
+/*!
+    Returns all items in the quadtree index, sorted using \a order.
+*/
+QList<QGraphicsItem *> QGraphicsSceneQuadtreeIndex::items(Qt::SortOrder order) const
+{
+    QList<QGraphicsItem *> itemList;
+    itemList.reserve(m_itemNodes.size() + m_pendingItems.size());
+    for (auto it = m_itemNodes.cbegin(); it != m_itemNodes.cend(); ++it)
+        itemList << it.key();
+    itemList += m_pendingItems;
+    QGraphicsSceneBspTreeIndexPrivate::sortItems(&itemList, order, /*sortCacheEnabled=*/false);
+    return itemList;
+}
+
+/*!
+    \internal
+
+    Re-roots the tree when the scene \a rect changes. All items move to the
+    pending list and are bulk re-inserted on the next query.
+*/
+void QGraphicsSceneQuadtreeIndex::updateSceneRect(const QRectF &rect)
+{
+    QList<QGraphicsItem *> allItems;
+    allItems.reserve(m_itemNodes.size() + m_pendingItems.size());
+    for (auto it = m_itemNodes.cbegin(); it != m_itemNodes.cend(); ++it)
+        allItems << it.key();
+    allItems += m_pendingItems;
+    clear();
+    m_root.rect = rect;
+    m_pendingItems = std::move(allItems);
+}
+
+/*!
+    \internal
+
+    Reacts to the \a change of the \a item and uses the \a value to update
+    the quadtree if necessary.
+*/
+void QGraphicsSceneQuadtreeIndex::itemChange(const QGraphicsItem *item, QGraphicsItem::GraphicsItemChange change, const void *const value)
+{
+    switch (change) {
+    case QGraphicsItem::ItemFlagsChange: {
+        // Handle ItemIgnoresTransformations
+        QGraphicsItem::GraphicsItemFlags newFlags = *static_cast<const QGraphicsItem::GraphicsItemFlags *>(value);
+        bool ignoredTransform = QGraphicsItemPrivate::get(item)->flags & QGraphicsItem::ItemIgnoresTransformations;
+        bool willIgnoreTransform = newFlags & QGraphicsItem::ItemIgnoresTransformations;
+        bool clipsChildren = QGraphicsItemPrivate::get(item)->flags & QGraphicsItem::ItemClipsChildrenToShape
+                             || QGraphicsItemPrivate::get(item)->flags & QGraphicsItem::ItemContainsChildrenInShape;
+        bool willClipChildren = newFlags & QGraphicsItem::ItemClipsChildrenToShape
+                                || newFlags & QGraphicsItem::ItemContainsChildrenInShape;
+        if ((ignoredTransform != willIgnoreTransform) || (clipsChildren != willClipChildren)) {
+            QGraphicsItem *thatItem = const_cast<QGraphicsItem *>(item);
+            // Re-classify the item and its descendants on the next flush.
+            moveToPendingItems(thatItem, /*recursive=*/true);
+        }
+        break;
+    }
+    case QGraphicsItem::ItemParentChange: {
+        // Handle ItemIgnoresTransformations
+        const QGraphicsItem *newParent = static_cast<const QGraphicsItem *>(value);
+        bool ignoredTransform = QGraphicsItemPrivate::get(item)->itemIsUntransformable();
+        bool willIgnoreTransform = (QGraphicsItemPrivate::get(item)->flags & QGraphicsItem::ItemIgnoresTransformations)
+                                   || (newParent && QGraphicsItemPrivate::get(newParent)->itemIsUntransformable());
+        bool ancestorClippedChildren = QGraphicsItemPrivate::get(item)->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+                                       || QGraphicsItemPrivate::get(item)->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren;
+        bool ancestorWillClipChildren = newParent
+                            && ((QGraphicsItemPrivate::get(newParent)->flags & QGraphicsItem::ItemClipsChildrenToShape
+                                 || QGraphicsItemPrivate::get(newParent)->flags & QGraphicsItem::ItemContainsChildrenInShape)
+                                || (QGraphicsItemPrivate::get(newParent)->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+                                    || QGraphicsItemPrivate::get(newParent)->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren));
+        if ((ignoredTransform != willIgnoreTransform) || (ancestorClippedChildren != ancestorWillClipChildren)) {
+            QGraphicsItem *thatItem = const_cast<QGraphicsItem *>(item);
+            // Re-classify the item and its descendants on the next flush.
+            moveToPendingItems(thatItem, /*recursive=*/true);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qgraphicsscenequadtreeindex_p.cpp"
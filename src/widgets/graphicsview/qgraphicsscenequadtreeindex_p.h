@@ -0,0 +1,85 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QGRAPHICSSCENEQUADTREEINDEX_H
+#define QGRAPHICSSCENEQUADTREEINDEX_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtWidgets/private/qtwidgetsglobal_p.h>
+
+#include "qgraphicssceneindex_p.h"
+
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qrect.h>
+
+QT_REQUIRE_CONFIG(graphicsview);
+
+QT_BEGIN_NAMESPACE
+
+class QGraphicsScene;
+
+class Q_AUTOTEST_EXPORT QGraphicsSceneQuadtreeIndex : public QGraphicsSceneIndex
+{
+    Q_OBJECT
+public:
+    QGraphicsSceneQuadtreeIndex(QGraphicsScene *scene = nullptr);
+    ~QGraphicsSceneQuadtreeIndex();
+
+    QList<QGraphicsItem *> estimateItems(const QRectF &rect, Qt::SortOrder order) const override;
+    QList<QGraphicsItem *> estimateTopLevelItems(const QRectF &rect, Qt::SortOrder order) const override;
+    QList<QGraphicsItem *> items(Qt::SortOrder order = Qt::DescendingOrder) const override;
+
+protected Q_SLOTS:
+    void updateSceneRect(const QRectF &rect) override;
+
+protected:
+    void clear() override;
+
+    void addItem(QGraphicsItem *item) override;
+    void removeItem(QGraphicsItem *item) override;
+    void prepareBoundingRectChange(const QGraphicsItem *item) override;
+
+    void itemChange(const QGraphicsItem *item, QGraphicsItem::GraphicsItemChange change, const void *const value) override;
+
+private:
+    struct Node {
+        QRectF rect;
+        QList<QGraphicsItem *> items;
+        Node *children[4] = { nullptr, nullptr, nullptr, nullptr };
+        ~Node()
+        {
+            for (Node *child : children)
+                delete child;
+        }
+    };
+
+    void flushPendingItems();
+    void insertItem(QGraphicsItem *item);
+    void moveToPendingItems(QGraphicsItem *item, bool recursive);
+    void collectItems(const Node *node, const QRectF &rect, QList<QGraphicsItem *> *items) const;
+    QList<QGraphicsItem *> estimateItems(const QRectF &rect, Qt::SortOrder order, bool onlyTopLevelItems) const;
+
+    Node m_root;
+    QHash<QGraphicsItem *, Node *> m_itemNodes; // value is null for items kept out of the tree
+    QList<QGraphicsItem *> m_pendingItems;
+    QList<QGraphicsItem *> m_untransformableItems;
+
+    friend class QGraphicsScene;
+    friend class QGraphicsScenePrivate;
+    Q_DISABLE_COPY_MOVE(QGraphicsSceneQuadtreeIndex)
+};
+
+QT_END_NAMESPACE
+
+#endif // QGRAPHICSSCENEQUADTREEINDEX_H
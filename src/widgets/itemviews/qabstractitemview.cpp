@@ -78,6 +78,8 @@ QAbstractItemViewPrivate::QAbstractItemViewPrivate()
         shouldClearStatusTip(false),
         alternatingColors(false),
         textElideMode(Qt::ElideRight),
+        batchedUpdates(false),
+        pendingDataChangedAll(false),
         verticalScrollMode(QAbstractItemView::ScrollPerItem),
         horizontalScrollMode(QAbstractItemView::ScrollPerItem),
         currentIndexSet(false),
@@ -1614,6 +1616,60 @@ bool QAbstractItemView::alternatingRowColors() const
     return d->alternatingColors;
 }
 
+/*!
+    \property QAbstractItemView::batchedUpdates
+    \brief whether repaints caused by data changes are batched per event-loop
+    turn
+    \since 6.9
+
+    By default, every \l{QAbstractItemModel::dataChanged()}{dataChanged()}
+    signal resolves the changed indexes to their visual rectangles and
+    schedules a repaint immediately. When a model emits many small changes in
+    quick succession, most of that work is redundant, since overlapping
+    regions are repainted only once anyway.
+
+    If this property is \c true, the changed ranges are instead accumulated
+    and merged into a minimal dirty region once per event-loop turn, and a
+    single repaint is scheduled for it. If very many distinct ranges change
+    within one turn, the view repaints the whole viewport instead of
+    resolving each range individually.
+
+    Use flushBatchedUpdates() to force the accumulated region to be
+    scheduled immediately.
+
+    By default, this property is \c false.
+*/
+void QAbstractItemView::setBatchedUpdates(bool enable)
+{
+    Q_D(QAbstractItemView);
+    if (d->batchedUpdates == enable)
+        return;
+    d->batchedUpdates = enable;
+    if (!enable)
+        flushBatchedUpdates();
+}
+
+bool QAbstractItemView::batchedUpdates() const
+{
+    Q_D(const QAbstractItemView);
+    return d->batchedUpdates;
+}
+
+/*!
+    \since 6.9
+
+    Schedules the repaint for the data changes accumulated so far without
+    waiting for the current event-loop turn to finish. This is only useful
+    when \l batchedUpdates is enabled.
+
+    \sa batchedUpdates
+*/
+void QAbstractItemView::flushBatchedUpdates()
+{
+    Q_D(QAbstractItemView);
+    d->updateDirtyRegion();
+}
+
 /*!
     \property QAbstractItemView::iconSize
     \brief the size of items' icons
@@ -3400,6 +3456,51 @@ void QAbstractItemView::update(const QModelIndex &index)
 
     \note: Qt::ToolTipRole is not honored by dataChanged() in the views provided by Qt.
 */
+// Remembers a changed range for the next flushPendingDataChanges(); once too
+// many distinct ranges have piled up, resolving them individually costs more
+// than repainting the viewport, so everything is folded into one full update.
+void QAbstractItemViewPrivate::scheduleDataChangedUpdate(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    constexpr qsizetype MaxPendingDataChangedRanges = 32;
+    if (!pendingDataChangedAll) {
+        if (!topLeft.isValid()
+            || pendingDataChangedRanges.size() >= MaxPendingDataChangedRanges) {
+            pendingDataChangedAll = true;
+            pendingDataChangedRanges.clear();
+        } else {
+            const auto range = std::make_pair(QPersistentModelIndex(topLeft),
+                                              QPersistentModelIndex(bottomRight));
+            if (!pendingDataChangedRanges.contains(range))
+                pendingDataChangedRanges.append(range);
+        }
+    }
+    if (!updateTimer.isActive())
+        updateTimer.start(0, q_func());
+}
+
+void QAbstractItemViewPrivate::flushPendingDataChanges()
+{
+    Q_Q(QAbstractItemView);
+    if (pendingDataChangedAll) {
+        updateRegion += viewport->rect();
+    } else {
+        for (const auto &range : std::as_const(pendingDataChangedRanges)) {
+            const QModelIndex topLeft = range.first;
+            const QModelIndex bottomRight = range.second;
+            if (!topLeft.isValid() || !bottomRight.isValid()) {
+                updateRegion += viewport->rect();
+                break;
+            }
+            if (topLeft == bottomRight)
+                updateRegion += q->visualRect(topLeft);
+            else
+                updateRegion += intersectedRect(viewport->rect(), topLeft, bottomRight);
+        }
+    }
+    pendingDataChangedAll = false;
+    pendingDataChangedRanges.clear();
+}
+
 void QAbstractItemView::dataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight,
                                     const QList<int> &roles)
 {
@@ -3417,7 +3518,10 @@ void QAbstractItemView::dataChanged(const QModelIndex &topLeft, const QModelInde
         }
         if (isVisible() && !d->delayedPendingLayout) {
             // otherwise the items will be update later anyway
-            update(topLeft);
+            if (d->batchedUpdates)
+                d->scheduleDataChangedUpdate(topLeft, topLeft);
+            else
+                update(topLeft);
         }
     } else {
         d->updateEditorData(topLeft, bottomRight);
@@ -3427,7 +3531,12 @@ void QAbstractItemView::dataChanged(const QModelIndex &topLeft, const QModelInde
                 topLeft.row() > bottomRight.row() ||
                 topLeft.column() > bottomRight.column()) {
                 // invalid parameter - call update() to redraw all
-                d->viewport->update();
+                if (d->batchedUpdates)
+                    d->scheduleDataChangedUpdate(QModelIndex(), QModelIndex());
+                else
+                    d->viewport->update();
+            } else if (d->batchedUpdates) {
+                d->scheduleDataChangedUpdate(topLeft, bottomRight);
             } else {
                 const QRect updateRect = d->intersectedRect(d->viewport->rect(), topLeft, bottomRight);
                 if (!updateRect.isEmpty())
@@ -37,6 +37,7 @@ class Q_WIDGETS_EXPORT QAbstractItemView : public QAbstractScrollArea
     Q_PROPERTY(Qt::DropAction defaultDropAction READ defaultDropAction WRITE setDefaultDropAction)
 #endif
     Q_PROPERTY(bool alternatingRowColors READ alternatingRowColors WRITE setAlternatingRowColors)
+    Q_PROPERTY(bool batchedUpdates READ batchedUpdates WRITE setBatchedUpdates)
     Q_PROPERTY(SelectionMode selectionMode READ selectionMode WRITE setSelectionMode)
     Q_PROPERTY(SelectionBehavior selectionBehavior READ selectionBehavior
                WRITE setSelectionBehavior)
@@ -161,6 +162,10 @@ public:
     void setAlternatingRowColors(bool enable);
     bool alternatingRowColors() const;
 
+    void setBatchedUpdates(bool enable);
+    bool batchedUpdates() const;
+    void flushBatchedUpdates();
+
     void setIconSize(const QSize &size);
     QSize iconSize() const;
 
@@ -222,10 +222,14 @@ public:
 
     void updateDirtyRegion() {
         updateTimer.stop();
+        flushPendingDataChanges();
         viewport->update(updateRegion);
         updateRegion = QRegion();
     }
 
+    void scheduleDataChangedUpdate(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+    void flushPendingDataChanges();
+
     void clearOrRemove();
     void checkPersistentEditorFocus();
 
@@ -397,6 +401,13 @@ public:
     QRegion updateRegion; // used for the internal update system
     QPoint scrollDelayOffset;
 
+    // used when batchedUpdates is enabled: the data-change ranges gathered
+    // since the last repaint; once the list overflows, the whole viewport is
+    // repainted instead of resolving each range to a visual rect
+    bool batchedUpdates;
+    bool pendingDataChangedAll;
+    QList<std::pair<QPersistentModelIndex, QPersistentModelIndex>> pendingDataChangedRanges;
+
     QBasicTimer updateTimer;
     QBasicTimer delayedEditing;
     QBasicTimer delayedAutoScroll; //used when an item is clicked
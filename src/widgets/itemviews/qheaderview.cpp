@@ -892,6 +892,68 @@ void QHeaderView::resizeSection(int logical, int size)
     emit sectionResized(logical, oldSize, size);
 }
 
+/*!
+    \since 6.9
+
+    Resizes the sections to the given \a sizes, measured in pixels. Entry \c i
+    of \a sizes is the new size of the section with logical index \c i; entries
+    beyond count() are ignored, as are negative entries. This is equivalent to
+    calling resizeSection() for every entry, except that the viewport is only
+    repainted once for the whole batch, which is considerably faster when
+    resizing many sections at once.
+
+    The sizes of hidden sections are stored and take effect when the sections
+    are shown again.
+
+    \sa resizeSection(), sectionResized(), sectionSize()
+*/
+
+void QHeaderView::resizeSections(const QList<int> &sizes)
+{
+    Q_D(QHeaderView);
+    d->executePostedLayout();
+
+    const int end = int(qMin(qsizetype(count()), sizes.size()));
+    bool sectionChanged = false;
+    for (int logical = 0; logical < end; ++logical) {
+        int size = sizes.at(logical);
+        if (size < 0 || size > maxSizeSection)
+            continue;
+
+        // make sure to not exceed bounds when setting size programmatically
+        if (size > 0)
+            size = qBound(minimumSectionSize(), size, maximumSectionSize());
+
+        if (isSectionHidden(logical)) {
+            d->hiddenSectionSize.insert(logical, size);
+            continue;
+        }
+
+        const int visual = visualIndex(logical);
+        if (visual == -1)
+            continue;
+
+        const int oldSize = d->headerSectionSize(visual);
+        if (oldSize == size)
+            continue;
+
+        if (stretchLastSection() && logical == d->lastSectionLogicalIdx)
+            d->lastSectionSize = size;
+
+        d->createSectionItems(visual, visual, size, d->headerSectionResizeMode(visual));
+        sectionChanged = true;
+        emit sectionResized(logical, oldSize, size);
+    }
+
+    if (!sectionChanged)
+        return;
+
+    d->invalidateCachedSizeHint();
+    if (d->hasAutoResizeSections())
+        d->doDelayedResizeSections();
+    d->viewport->update();
+}
+
 /*!
     Resizes the sections according to the given \a mode, ignoring the current
     resize mode.
@@ -3440,18 +3502,14 @@ bool QHeaderViewPrivate::isSectionSelected(int section) const
 
 bool QHeaderViewPrivate::isFirstVisibleSection(int section) const
 {
-    if (sectionStartposRecalc)
-        recalcSectionStartPos();
     const SectionItem &item = sectionItems.at(section);
-    return item.size > 0 && item.calculated_startpos == 0;
+    return item.size > 0 && headerSectionPosition(section) == 0;
 }
 
 bool QHeaderViewPrivate::isLastVisibleSection(int section) const
 {
-    if (sectionStartposRecalc)
-        recalcSectionStartPos();
     const SectionItem &item = sectionItems.at(section);
-    return item.size > 0 && item.calculatedEndPos() == length;
+    return item.size > 0 && headerSectionPosition(section) + item.sectionSize() == length;
 }
 
 /*!
@@ -3652,10 +3710,18 @@ void QHeaderViewPrivate::createSectionItems(int start, int end, int sizePerSecti
         sectionItems.resize(end + 1);
         sectionStartposRecalc = true;
     }
+    // a single-section resize can update the position tree in place
+    const bool updateTree = (start == end && !sectionStartposRecalc);
     SectionItem *sectiondata = sectionItems.data();
     for (int i = start; i <= end; ++i) {
-        length += (sizePerSection - sectiondata[i].size);
-        sectionStartposRecalc |= (sectiondata[i].size != sizePerSection);
+        const int delta = sizePerSection - sectiondata[i].size;
+        if (delta != 0) {
+            length += delta;
+            if (updateTree)
+                updateSectionPositionTree(i, delta);
+            else
+                sectionStartposRecalc = true;
+        }
         sectiondata[i].size = sizePerSection;
         sectiondata[i].resizeMode = mode;
     }
@@ -3681,6 +3747,8 @@ void QHeaderViewPrivate::clear()
         sectionSelected.clear();
         hiddenSectionSize.clear();
         sectionItems.clear();
+        sectionPositionTree.clear();
+        sectionStartposRecalc = true;
         lastSectionLogicalIdx = -1;
         invalidateCachedSizeHint();
     }
@@ -3878,14 +3946,28 @@ void QHeaderViewPrivate::updateDefaultSectionSizeFromStyle()
 
 void QHeaderViewPrivate::recalcSectionStartPos() const // linear (but fast)
 {
-    int pixelpos = 0;
-    for (const SectionItem &i : sectionItems) {
-        i.calculated_startpos = pixelpos; // write into const mutable
-        pixelpos += i.size;
+    const int count = sectionItems.size();
+    sectionPositionTree.resize(count + 1);
+    int *tree = sectionPositionTree.data(); // write into const mutable
+    tree[0] = 0;
+    for (int i = 1; i <= count; ++i)
+        tree[i] = sectionItems.at(i - 1).size;
+    for (int i = 1; i <= count; ++i) {
+        const int parent = i + (i & -i);
+        if (parent <= count)
+            tree[parent] += tree[i];
     }
     sectionStartposRecalc = false;
 }
 
+void QHeaderViewPrivate::updateSectionPositionTree(int visual, int delta) const
+{
+    const int count = sectionItems.size();
+    int *tree = sectionPositionTree.data();
+    for (int i = visual + 1; i <= count; i += i & -i)
+        tree[i] += delta;
+}
+
 void QHeaderViewPrivate::resizeSectionItem(int visualIndex, int oldSize, int newSize)
 {
     Q_Q(QHeaderView);
@@ -3906,29 +3988,38 @@ int QHeaderViewPrivate::headerSectionPosition(int visual) const
     if (visual < sectionCount() && visual >= 0) {
         if (sectionStartposRecalc)
             recalcSectionStartPos();
-        return sectionItems.at(visual).calculated_startpos;
+        const int *tree = sectionPositionTree.constData();
+        int position = 0;
+        for (int i = visual; i > 0; i -= i & -i)
+            position += tree[i];
+        return position;
     }
     return -1;
 }
 
 int QHeaderViewPrivate::headerVisualIndexAt(int position) const
 {
+    if (position < 0 || sectionItems.isEmpty())
+        return -1;
     if (sectionStartposRecalc)
         recalcSectionStartPos();
-    int startidx = 0;
-    int endidx = sectionItems.size() - 1;
-    while (startidx <= endidx) {
-        int middle = (endidx + startidx) / 2;
-        if (sectionItems.at(middle).calculated_startpos > position) {
-            endidx = middle - 1;
-        } else {
-            if (sectionItems.at(middle).calculatedEndPos() <= position)
-                startidx = middle + 1;
-            else // we found it.
-                return middle;
+    const int count = sectionItems.size();
+    const int *tree = sectionPositionTree.constData();
+    // descend the tree to the last section that starts at or before position;
+    // zero-sized (hidden) sections cannot contain any position and are skipped
+    int step = 1;
+    while ((step << 1) <= count)
+        step <<= 1;
+    int idx = 0;
+    int remaining = position;
+    for (; step > 0; step >>= 1) {
+        const int next = idx + step;
+        if (next <= count && tree[next] <= remaining) {
+            idx = next;
+            remaining -= tree[next];
         }
     }
-    return -1;
+    return idx < count ? idx : -1;
 }
 
 void QHeaderViewPrivate::setHeaderSectionResizeMode(int visual, QHeaderView::ResizeMode mode)
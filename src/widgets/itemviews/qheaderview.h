@@ -71,6 +71,7 @@ public:
     void swapSections(int first, int second);
     void resizeSection(int logicalIndex, int size);
     void resizeSections(QHeaderView::ResizeMode mode);
+    void resizeSections(const QList<int> &sizes);
 
     bool isSectionHidden(int logicalIndex) const;
     void setSectionHidden(int logicalIndex, bool hide);
@@ -293,16 +293,14 @@ public:
         uint currentlyUnusedPadding : 6;
 
         union { // This union is made in order to save space and ensure good vector performance (on remove)
-            mutable int calculated_startpos; // <- this is the primary used member.
             mutable int tmpLogIdx;         // When one of these 'tmp'-members has been used we call
             int tmpDataStreamSectionCount; // recalcSectionStartPos() or set sectionStartposRecalc to true
-        };                                 // to ensure that calculated_startpos will be calculated afterwards.
+        };                                 // to ensure that sectionPositionTree will be rebuilt afterwards.
 
         inline SectionItem() : size(0), isHidden(0), resizeMode(QHeaderView::Interactive) {}
         inline SectionItem(int length, QHeaderView::ResizeMode mode)
-            : size(length), isHidden(0), resizeMode(mode), calculated_startpos(-1) {}
+            : size(length), isHidden(0), resizeMode(mode), tmpLogIdx(-1) {}
         inline int sectionSize() const { return size; }
-        inline int calculatedEndPos() const { return calculated_startpos + size; }
 #ifndef QT_NO_DATASTREAM
         inline void write(QDataStream &out) const
         { out << static_cast<int>(size); out << 1; out << (int)resizeMode; }
@@ -312,6 +310,11 @@ public:
     };
 
     QList<SectionItem> sectionItems;
+    // Fenwick (binary indexed) tree over the section sizes; entry i holds the
+    // sum of the sizes of sections (i - (i & -i), i], so both position lookups
+    // and single-section resizes are O(log n). Rebuilt lazily (in one linear
+    // pass) when sectionStartposRecalc has been set.
+    mutable QList<int> sectionPositionTree;
     struct LayoutChangeItem {
         QPersistentModelIndex index;
         SectionItem section;
@@ -325,6 +328,7 @@ public:
     void setDefaultSectionSize(int size);
     void updateDefaultSectionSizeFromStyle();
     void recalcSectionStartPos() const; // not really const
+    void updateSectionPositionTree(int visual, int delta) const; // not really const
 
     inline int headerLength() const { // for debugging
         int len = 0;
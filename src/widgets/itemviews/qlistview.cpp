@@ -128,6 +128,13 @@ extern bool qt_sendSpontaneousEvent(QObject *receiver, QEvent *event);
 
   \value SinglePass The items are laid out all at once.
   \value Batched The items are laid out in batches of \l batchSize items.
+  \value Virtualized In \l ListMode without wrapping, item geometry is
+  computed on demand from a uniform slot size derived from the grid size or
+  from a bounded sample of item size hints, so the cost of laying out the
+  view does not depend on the number of rows. Scroll bars always operate in
+  pixels in this mode, hidden rows are not supported, and items are
+  positioned as if they all had the sampled size. In other configurations
+  this mode behaves like SinglePass. This value was introduced in Qt 6.9.
   \sa batchSize
 */
 
@@ -305,7 +312,10 @@ QListView::ResizeMode QListView::resizeMode() const
     When the mode is \l Batched, the items are laid out in batches of \l batchSize
     items, while processing events. This makes it possible to
     instantly view and interact with the visible items while the rest
-    are being laid out.
+    are being laid out. When the mode is \l Virtualized, unwrapped lists
+    estimate a uniform item size from a sample of size hints and compute
+    item geometry on demand, so the layout cost does not depend on the
+    number of rows.
 
     \sa viewMode
 */
@@ -1551,7 +1561,7 @@ void QListView::doItemsLayout()
     setState(ExpandingState);
     if (d->model->columnCount(d->root) > 0) { // no columns means no contents
         d->resetBatchStartRow();
-        if (layoutMode() == SinglePass) {
+        if (layoutMode() != Batched) {
             d->doItemsLayout(d->model->rowCount(d->root)); // layout everything
         } else if (!d->batchLayoutTimer.isActive()) {
             if (!d->doItemsLayout(d->batchSize)) // layout is done
@@ -2123,7 +2133,11 @@ int QCommonListViewBase::horizontalScrollToValue(const int /*index*/, QListView:
  * ListMode ListView Implementation
 */
 QListModeViewBase::QListModeViewBase(QListView *q, QListViewPrivate *d)
-    : QCommonListViewBase(q, d)
+    : QCommonListViewBase(q, d),
+      virtualItemExtent(0),
+      virtualFlowStart(0),
+      virtualSegPosition(0),
+      virtualCount(0)
 {
 #if QT_CONFIG(draganddrop)
     dd->defaultDropAction = Qt::CopyAction;
@@ -2293,7 +2307,8 @@ bool QListModeViewBase::dropOn(QDropEvent *event, int *dropRow, int *dropCol, QM
 
 void QListModeViewBase::updateVerticalScrollBar(const QSize &step)
 {
-    if (verticalScrollMode() == QAbstractItemView::ScrollPerItem
+    if (!virtualLayout()
+        && verticalScrollMode() == QAbstractItemView::ScrollPerItem
         && ((flow() == QListView::TopToBottom && !isWrapping())
         || (flow() == QListView::LeftToRight && isWrapping()))) {
             const int steps = (flow() == QListView::TopToBottom ? scrollValueMap : segmentPositions).size() - 1;
@@ -2314,7 +2329,8 @@ void QListModeViewBase::updateVerticalScrollBar(const QSize &step)
 
 void QListModeViewBase::updateHorizontalScrollBar(const QSize &step)
 {
-    if (horizontalScrollMode() == QAbstractItemView::ScrollPerItem
+    if (!virtualLayout()
+        && horizontalScrollMode() == QAbstractItemView::ScrollPerItem
         && ((flow() == QListView::TopToBottom && isWrapping())
         || (flow() == QListView::LeftToRight && !isWrapping()))) {
             int steps = (flow() == QListView::TopToBottom ? segmentPositions : scrollValueMap).size() - 1;
@@ -2334,7 +2350,7 @@ void QListModeViewBase::updateHorizontalScrollBar(const QSize &step)
 int QListModeViewBase::verticalScrollToValue(int index, QListView::ScrollHint hint,
                                           bool above, bool below, const QRect &area, const QRect &rect) const
 {
-    if (verticalScrollMode() == QAbstractItemView::ScrollPerItem) {
+    if (verticalScrollMode() == QAbstractItemView::ScrollPerItem && !virtualLayout()) {
         int value;
         if (scrollValueMap.isEmpty()) {
             value = 0;
@@ -2403,7 +2419,7 @@ int QListModeViewBase::verticalOffset() const
 int QListModeViewBase::horizontalScrollToValue(int index, QListView::ScrollHint hint,
                                             bool leftOf, bool rightOf, const QRect &area, const QRect &rect) const
 {
-    if (horizontalScrollMode() != QAbstractItemView::ScrollPerItem)
+    if (horizontalScrollMode() != QAbstractItemView::ScrollPerItem || virtualLayout())
         return QCommonListViewBase::horizontalScrollToValue(index, hint, leftOf, rightOf, area, rect);
 
     int value;
@@ -2423,6 +2439,12 @@ int QListModeViewBase::horizontalScrollToValue(int index, QListView::ScrollHint
 
 void QListModeViewBase::scrollContentsBy(int dx, int dy, bool scrollElasticBand)
 {
+    if (virtualLayout()) {
+        // the scroll bars always operate in pixels in virtualized mode
+        QCommonListViewBase::scrollContentsBy(dx, dy, scrollElasticBand);
+        return;
+    }
+
     // ### reorder this logic
     const int verticalValue = verticalScrollBar()->value();
     const int horizontalValue = horizontalScrollBar()->value();
@@ -2469,12 +2491,51 @@ void QListModeViewBase::scrollContentsBy(int dx, int dy, bool scrollElasticBand)
 
 bool QListModeViewBase::doBatchedItemLayout(const QListViewLayoutInfo &info, int max)
 {
+    if (dd->layoutMode == QListView::Virtualized && !info.wrap && hiddenCount() == 0) {
+        doVirtualLayout(info);
+        return true; // all rows are covered by the virtual layout
+    }
+    virtualCount = 0;
     doStaticLayout(info);
     return batchStartRow > max; // returning true stops items layout
 }
 
 QListViewItem QListModeViewBase::indexToListViewItem(const QModelIndex &index) const
 {
+    if (virtualLayout()) {
+        if (index.row() >= virtualCount)
+            return QListViewItem();
+
+        QStyleOptionViewItem options;
+        initViewItemOption(&options);
+        options.rect.setSize(contentsSize);
+        QSize size = (uniformItemSizes() && cachedItemSize().isValid())
+                     ? cachedItemSize() : itemSize(options, index);
+        QSize cellSize = size;
+
+        const int flowPosition = virtualFlowStart + index.row() * virtualItemExtent;
+        QPoint pos;
+        if (flow() == QListView::LeftToRight) {
+            pos = QPoint(flowPosition, virtualSegPosition);
+        } else { // TopToBottom
+            pos = QPoint(virtualSegPosition, flowPosition);
+            // make the items as wide as the viewport
+            cellSize.setWidth(qMax(size.width(), viewport()->width() - 2 * spacing()));
+        }
+
+        if (dd->itemAlignment & Qt::AlignHorizontal_Mask) {
+            size.setWidth(qMin(size.width(), cellSize.width()));
+            if (dd->itemAlignment & Qt::AlignRight)
+                pos.setX(pos.x() + cellSize.width() - size.width());
+            if (dd->itemAlignment & Qt::AlignHCenter)
+                pos.setX(pos.x() + (cellSize.width() - size.width()) / 2);
+        } else {
+            size.setWidth(cellSize.width());
+        }
+
+        return QListViewItem(QRect(pos, size), index.row());
+    }
+
     if (flowPositions.isEmpty()
         || segmentPositions.isEmpty()
         || index.row() >= flowPositions.size() - 1)
@@ -2659,6 +2720,73 @@ void QListModeViewBase::doStaticLayout(const QListViewLayoutInfo &info)
         viewport()->update();
 }
 
+/*!
+  \internal
+
+  Lays out the items arithmetically on a uniform slot size derived from the
+  grid size, or from a bounded sample of item size hints, without visiting
+  every row. Item geometry is computed on demand from the row number, so the
+  cost of this function is independent of the number of rows in the model.
+*/
+void QListModeViewBase::doVirtualLayout(const QListViewLayoutInfo &info)
+{
+    flowPositions.clear();
+    segmentPositions.clear();
+    segmentStartRows.clear();
+    segmentExtents.clear();
+    scrollValueMap.clear();
+    batchSavedPosition = 0;
+    batchSavedDeltaSeg = 0;
+    batchStartRow = info.max + 1;
+
+    virtualCount = info.max + 1;
+
+    int deltaFlowPosition;
+    int deltaSegPosition;
+    if (info.grid.isValid()) {
+        deltaFlowPosition = (info.flow == QListView::LeftToRight ? info.grid.width() : info.grid.height());
+        deltaSegPosition = (info.flow == QListView::LeftToRight ? info.grid.height() : info.grid.width());
+    } else {
+        // estimate a uniform item size from a bounded sample of size hints
+        QStyleOptionViewItem option;
+        initViewItemOption(&option);
+        option.rect = info.bounds;
+        option.rect.adjust(info.spacing, info.spacing, -info.spacing, -info.spacing);
+        const int sampleCount = qMin(virtualCount, 100);
+        const int sampleStep = qMax(1, virtualCount / sampleCount);
+        QSize sampledSize;
+        for (int row = 0; row < virtualCount; row += sampleStep)
+            sampledSize = sampledSize.expandedTo(itemSize(option, modelIndex(row)));
+        if (info.flow == QListView::LeftToRight) {
+            deltaFlowPosition = sampledSize.width() + info.spacing;
+            deltaSegPosition = sampledSize.height() + info.spacing;
+        } else { // TopToBottom
+            deltaFlowPosition = sampledSize.height() + info.spacing;
+            deltaSegPosition = sampledSize.width() + info.spacing;
+        }
+    }
+    virtualItemExtent = info.spacing + deltaFlowPosition;
+
+    if (info.flow == QListView::LeftToRight) {
+        virtualFlowStart = info.bounds.left() + info.spacing;
+        virtualSegPosition = info.bounds.top() + info.spacing;
+    } else { // TopToBottom
+        virtualFlowStart = info.bounds.top() + info.spacing;
+        virtualSegPosition = info.bounds.left() + info.spacing;
+    }
+
+    // set the contents size; this mirrors what doStaticLayout() would have
+    // computed for a single unwrapped segment of uniformly sized items
+    const int flowEnd = virtualFlowStart + virtualCount * virtualItemExtent - info.spacing;
+    const int segEnd = virtualSegPosition + deltaSegPosition;
+    if (info.flow == QListView::LeftToRight)
+        contentsSize = QSize(flowEnd, segEnd);
+    else // TopToBottom
+        contentsSize = QSize(segEnd, flowEnd);
+
+    viewport()->update();
+}
+
 /*!
   \internal
   Finds the set of items intersecting with \a area.
@@ -2667,6 +2795,22 @@ void QListModeViewBase::doStaticLayout(const QListViewLayoutInfo &info)
 QList<QModelIndex> QListModeViewBase::intersectingSet(const QRect &area) const
 {
     QList<QModelIndex> ret;
+    if (virtualLayout()) {
+        if (virtualItemExtent <= 0)
+            return ret;
+        const int flowStartPosition = (flow() == QListView::LeftToRight ? area.left() : area.top());
+        const int flowEndPosition = (flow() == QListView::LeftToRight ? area.right() : area.bottom());
+        const int first = qBound(0, (flowStartPosition - virtualFlowStart) / virtualItemExtent,
+                                 virtualCount - 1);
+        const int last = qBound(first, (flowEndPosition - virtualFlowStart) / virtualItemExtent,
+                                virtualCount - 1);
+        for (int row = first; row <= last; ++row) {
+            QModelIndex index = modelIndex(row);
+            if (index.isValid())
+                ret += index;
+        }
+        return ret;
+    }
     int segStartPosition;
     int segEndPosition;
     int flowStartPosition;
@@ -2857,6 +3001,10 @@ void QListModeViewBase::clear()
     batchSavedPosition = 0;
     batchStartRow = 0;
     batchSavedDeltaSeg = 0;
+    virtualItemExtent = 0;
+    virtualFlowStart = 0;
+    virtualSegPosition = 0;
+    virtualCount = 0;
 }
 
 /*
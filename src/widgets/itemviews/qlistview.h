@@ -38,7 +38,7 @@ public:
     Q_ENUM(Flow)
     enum ResizeMode { Fixed, Adjust };
     Q_ENUM(ResizeMode)
-    enum LayoutMode { SinglePass, Batched };
+    enum LayoutMode { SinglePass, Batched, Virtualized };
     Q_ENUM(LayoutMode)
     enum ViewMode { ListMode, IconMode };
     Q_ENUM(ViewMode)
@@ -172,12 +172,20 @@ public:
     // used when laying out in batches
     int batchSavedPosition;
 
+    // used when laying out in virtualized mode
+    int virtualItemExtent;
+    int virtualFlowStart;
+    int virtualSegPosition;
+    int virtualCount;
+
+    inline bool virtualLayout() const { return virtualCount > 0; }
+
     //reimplementations
     int itemIndex(const QListViewItem &item) const override { return item.indexHint; }
     QListViewItem indexToListViewItem(const QModelIndex &index) const override;
     bool doBatchedItemLayout(const QListViewLayoutInfo &info, int max) override;
     void clear() override;
-    void setRowCount(int rowCount) override { flowPositions.resize(rowCount); }
+    void setRowCount(int rowCount) override { if (!virtualLayout()) flowPositions.resize(rowCount); }
     QList<QModelIndex> intersectingSet(const QRect &area) const override;
     void dataChanged(const QModelIndex &, const QModelIndex &) override;
 
@@ -204,6 +212,7 @@ public:
 private:
     QPoint initStaticLayout(const QListViewLayoutInfo &info);
     void doStaticLayout(const QListViewLayoutInfo &info);
+    void doVirtualLayout(const QListViewLayoutInfo &info);
     int perItemScrollToValue(int index, int value, int height,
                              QAbstractItemView::ScrollHint hint,
                              Qt::Orientation orientation, bool wrap, int extent) const;
@@ -2027,37 +2027,76 @@ void QTableView::setSelection(const QRect &rect, QItemSelectionModel::SelectionF
         left = qMin(d->visualColumn(tl.column()), d->visualColumn(br.column()));
         bottom = qMax(d->visualRow(tl.row()), d->visualRow(br.row()));
         right = qMax(d->visualColumn(tl.column()), d->visualColumn(br.column()));
-        do {
-            expanded = false;
-            for (QSpanCollection::Span *it : d->spans.spans) {
-                const QSpanCollection::Span &span = *it;
-                const int t = d->visualRow(span.top());
-                const int l = d->visualColumn(span.left());
-                const int b = d->visualRow(d->rowSpanEndLogical(span.top(), span.height()));
-                const int r = d->visualColumn(d->columnSpanEndLogical(span.left(), span.width()));
-                if ((t > bottom) || (l > right) || (top > b) || (left > r))
-                    continue; // no intersect
-                intersectsSpan = true;
-                if (t < top) {
-                    top = t;
-                    expanded = true;
-                }
-                if (l < left) {
-                    left = l;
-                    expanded = true;
-                }
-                if (b > bottom) {
-                    bottom = b;
-                    expanded = true;
+        if (!verticalMoved && !horizontalMoved) {
+            // visual and logical indexes are the same, so the span collection's
+            // index can be queried with the selection rectangle directly instead
+            // of scanning every span; re-query whenever the rectangle grows
+            do {
+                expanded = false;
+                const QSet<QSpanCollection::Span *> intersecting
+                    = d->spans.spansInRect(left, top, right - left + 1, bottom - top + 1);
+                for (QSpanCollection::Span *it : intersecting) {
+                    const QSpanCollection::Span &span = *it;
+                    const int t = span.top();
+                    const int l = span.left();
+                    const int b = d->rowSpanEndLogical(span.top(), span.height());
+                    const int r = d->columnSpanEndLogical(span.left(), span.width());
+                    if ((t > bottom) || (l > right) || (top > b) || (left > r))
+                        continue; // no intersect
+                    intersectsSpan = true;
+                    if (t < top) {
+                        top = t;
+                        expanded = true;
+                    }
+                    if (l < left) {
+                        left = l;
+                        expanded = true;
+                    }
+                    if (b > bottom) {
+                        bottom = b;
+                        expanded = true;
+                    }
+                    if (r > right) {
+                        right = r;
+                        expanded = true;
+                    }
+                    if (expanded)
+                        break;
                 }
-                if (r > right) {
-                    right = r;
-                    expanded = true;
+            } while (expanded);
+        } else {
+            do {
+                expanded = false;
+                for (QSpanCollection::Span *it : d->spans.spans) {
+                    const QSpanCollection::Span &span = *it;
+                    const int t = d->visualRow(span.top());
+                    const int l = d->visualColumn(span.left());
+                    const int b = d->visualRow(d->rowSpanEndLogical(span.top(), span.height()));
+                    const int r = d->visualColumn(d->columnSpanEndLogical(span.left(), span.width()));
+                    if ((t > bottom) || (l > right) || (top > b) || (left > r))
+                        continue; // no intersect
+                    intersectsSpan = true;
+                    if (t < top) {
+                        top = t;
+                        expanded = true;
+                    }
+                    if (l < left) {
+                        left = l;
+                        expanded = true;
+                    }
+                    if (b > bottom) {
+                        bottom = b;
+                        expanded = true;
+                    }
+                    if (r > right) {
+                        right = r;
+                        expanded = true;
+                    }
+                    if (expanded)
+                        break;
                 }
-                if (expanded)
-                    break;
-            }
-        } while (expanded);
+            } while (expanded);
+        }
         if (!intersectsSpan) {
             top = tl.row();
             bottom = br.row();
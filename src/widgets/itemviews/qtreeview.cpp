@@ -3456,6 +3456,7 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
     }
 
     bool expanding = true;
+    QList<QTreeViewItem> trailingItems;
     if (i == -1) {
         if (uniformRowHeights) {
             QModelIndex index = model->index(0, 0, parent);
@@ -3464,6 +3465,14 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
         viewItems.resize(count);
         afterIsUninitialized = true;
     } else if (viewItems[i].total != (uint)count) {
+        if (!afterIsUninitialized && i + 1 < viewItems.size()) {
+            // Detach the items after i and lay the branch out in append mode;
+            // inserting in the middle would move the whole tail (and fix up
+            // its parent indexes) again for every nested branch.
+            trailingItems = viewItems.sliced(i + 1);
+            viewItems.resize(i + 1);
+            afterIsUninitialized = true;
+        }
         if (!afterIsUninitialized)
             insertViewItems(i + 1, count, QTreeViewItem()); // expand
         else if (count > 0)
@@ -3519,6 +3528,18 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
             viewItems.resize(viewItems.size() - hidden);
     }
 
+    if (!trailingItems.isEmpty()) {
+        // put the detached items back, adjusting the parents that pointed
+        // behind the expanded branch
+        const int insertedCount = viewItems.size() - first;
+        const int trailingPos = viewItems.size();
+        viewItems.append(std::move(trailingItems));
+        QTreeViewItem *items = viewItems.data();
+        for (int j = trailingPos; j < viewItems.size(); ++j)
+            if (items[j].parentItem >= first)
+                items[j].parentItem += insertedCount;
+    }
+
     if (!expanding)
         return; // nothing changed
 
@@ -56,6 +56,7 @@
 #include "private/qkeymapper_p.h"
 
 #include <qthread.h>
+#include <private/qobject_p.h>
 #include <private/qthread_p.h>
 
 #include <QtGui/private/qevent_p.h>
@@ -796,6 +797,13 @@ bool QApplication::compressEvent(QEvent *event, QObject *receiver, QPostEventLis
         return QGuiApplication::compressEvent(event, receiver, postedEvents);
     }
 
+    // The list contains the pending events for all receivers in this thread, so
+    // don't scan it at all if nothing has been posted to this receiver yet. This
+    // matters during invalidation storms, e.g. when populating a layout with
+    // many widgets, each posting its first LayoutRequest or UpdateLater event.
+    if (QObjectPrivate::get(receiver)->postedEvents.loadRelaxed() == 0)
+        return false;
+
     for (const auto &postedEvent : std::as_const(*postedEvents)) {
 
         // Continue, unless a valid event of the same type exists for the same receiver
@@ -77,11 +77,16 @@
 
 #include <sstream>
 
+#include <qtwidgets_tracepoints_p.h>
+
 QT_BEGIN_NAMESPACE
 
 using namespace QNativeInterface::Private;
 using namespace Qt::StringLiterals;
 
+Q_TRACE_POINT(qtwidgets, QWidget_paintEvent_entry, QObject *widget, QRect boundingRect, int rectCount);
+Q_TRACE_POINT(qtwidgets, QWidget_paintEvent_exit);
+
 Q_LOGGING_CATEGORY(lcWidgetPainting, "qt.widgets.painting", QtWarningMsg);
 Q_LOGGING_CATEGORY(lcWidgetShowHide, "qt.widgets.showhide", QtWarningMsg);
 Q_STATIC_LOGGING_CATEGORY(lcWidgetWindow, "qt.widgets.window", QtWarningMsg);
@@ -1659,6 +1664,7 @@ void QWidgetPrivate::createExtra()
         extra->autoFillBackground = 0;
         extra->nativeChildrenForced = 0;
         extra->inRenderWithPainter = 0;
+        extra->inSubtreeLayerPaint = 0;
         extra->hasWindowContainer = false;
         extra->hasMask = 0;
         createSysExtra();
@@ -5522,6 +5528,68 @@ void QWidgetPrivate::drawWidget(QPaintDevice *pdev, const QRegion &rgn, const QP
 
     Q_ASSERT(sharedPainter ? sharedPainter->isActive() : true);
 
+    // Serve the repaint from the retained subtree layer if the widget has one.
+    // The layer holds exactly what the subtree would have painted into the
+    // backing store; areas invalidated by update() are re-rendered into the
+    // layer first, everything else is a plain blit. The layer is rendered
+    // as its own paint root, so only opaque widgets may use it: for them the
+    // baked-in root background is either identical to the in-tree result
+    // (opaque autofill) or never visible (opaque paint event). Translucent
+    // widgets fall through to the regular paint path.
+    if (Q_UNLIKELY(q->testAttribute(Qt::WA_CachedSubtreeLayer))
+            && recursive && !onScreen && !sharedPainter && repaintManager && isOpaque
+            && !(extra && extra->inSubtreeLayerPaint)) {
+        if (!extra)
+            createExtra();
+
+        QRegion toBlit(rgn);
+        toBlit &= clipRect();
+        if (extra->hasMask)
+            toBlit &= extra->mask;
+        if (toBlit.isEmpty())
+            return;
+
+        const qreal dpr = q->devicePixelRatio();
+        const QSize layerSize = q->size() * dpr;
+        if (!extra->subtreeLayer || extra->subtreeLayer->size() != layerSize) {
+            extra->subtreeLayer = std::make_unique<QImage>(layerSize, QImage::Format_ARGB32_Premultiplied);
+            extra->subtreeLayer->setDevicePixelRatio(dpr);
+            extra->subtreeLayerValid = QRegion();
+        }
+
+        const QRegion toRender = toBlit - extra->subtreeLayerValid;
+        if (!toRender.isEmpty()) {
+            // Clear the stale area so translucent content does not accumulate,
+            // then replay the normal recursive paint into the layer.
+            {
+                QPainter clearer(extra->subtreeLayer.get());
+                clearer.setCompositionMode(QPainter::CompositionMode_Source);
+                for (const QRect &rect : toRender)
+                    clearer.fillRect(rect, Qt::transparent);
+            }
+            extra->inSubtreeLayerPaint = 1;
+            // DrawAsRoot keeps the root background fill, so the layer is
+            // self-contained and the blit below cannot composite paint-event
+            // output over a stale frame in the backing store.
+            drawWidget(extra->subtreeLayer.get(), toRender, QPoint(), flags | DrawAsRoot,
+                       nullptr, nullptr);
+            extra->inSubtreeLayerPaint = 0;
+            extra->subtreeLayerValid += toRender;
+        }
+
+        QPainter p(pdev);
+        p.translate(offset);
+        for (const QRect &rect : toBlit) {
+            const QRectF sourceRect(rect.x() * dpr, rect.y() * dpr,
+                                    rect.width() * dpr, rect.height() * dpr);
+            p.drawImage(QRectF(rect), *extra->subtreeLayer, sourceRect);
+        }
+        p.end();
+
+        repaintManager->markNeedsFlush(q, toBlit, offset);
+        return;
+    }
+
     QRegion toBePainted(rgn);
     if (asRoot && !alsoInvisible)
         toBePainted &= clipRect(); //(rgn & visibleRegion());
@@ -5653,6 +5721,8 @@ void QWidgetPrivate::sendPaintEvent(const QRegion &toBePainted)
 {
     Q_Q(QWidget);
     QPaintEvent e(toBePainted);
+    Q_TRACE(QWidget_paintEvent_entry, q, toBePainted.boundingRect(), int(toBePainted.rectCount()));
+    Q_TRACE_EXIT(QWidget_paintEvent_exit);
     QCoreApplication::sendSpontaneousEvent(q, &e);
 
     if (renderToTexture)
@@ -11528,6 +11598,12 @@ void QWidget::setAttribute(Qt::WidgetAttribute attribute, bool on)
         break;
     case Qt::WA_AcceptTouchEvents:
         break;
+    case Qt::WA_CachedSubtreeLayer:
+        if (!on && d->extra) {
+            d->extra->subtreeLayer.reset();
+            d->extra->subtreeLayerValid = QRegion();
+        }
+        break;
     default:
         break;
     }
@@ -23,6 +23,7 @@
 #include "QtCore/qrect.h"
 #include "QtCore/qlocale.h"
 #include "QtCore/qset.h"
+#include "QtGui/qimage.h"
 #include "QtGui/qregion.h"
 #include "QtGui/qinputmethod.h"
 #include "QtGui/qsurfaceformat.h"
@@ -134,9 +135,11 @@ struct QWExtra {
 #endif
     QPointer<QStyle> style;
     QPointer<QWidget> focus_proxy;
+    std::unique_ptr<QImage> subtreeLayer; // retained layer for Qt::WA_CachedSubtreeLayer
 
     // Implicit pointers (shared_empty/shared_null).
     QRegion mask; // widget mask
+    QRegion subtreeLayerValid; // part of subtreeLayer that is up to date
     QString styleSheet;
 
     // Other variables.
@@ -154,6 +157,7 @@ struct QWExtra {
     uint autoFillBackground : 1;
     uint nativeChildrenForced : 1;
     uint inRenderWithPainter : 1;
+    uint inSubtreeLayerPaint : 1;
     uint hasMask : 1;
     uint hasWindowContainer : 1;
 };
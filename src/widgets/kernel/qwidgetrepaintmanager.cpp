@@ -152,6 +152,20 @@ template Q_AUTOTEST_EXPORT void QWidgetPrivate::invalidateBackingStore<QRect>(co
 static inline QRect widgetRectFor(QWidget *, const QRect &r) { return r; }
 static inline QRect widgetRectFor(QWidget *widget, const QRegion &) { return widget->rect(); }
 
+/*
+    Invalidates the retained subtree layers (Qt::WA_CachedSubtreeLayer) of the
+    widget and of all its ancestors, for the part covered by \a widgetRect
+    (in the widget's coordinates).
+*/
+static void invalidateCachedSubtreeLayers(QWidget *widget, const QRect &widgetRect)
+{
+    for (QWidget *w = widget; w; w = w->isWindow() ? nullptr : w->parentWidget()) {
+        QWExtra *extra = QWidgetPrivate::get(w)->extra.get();
+        if (extra && extra->subtreeLayer && !extra->subtreeLayerValid.isEmpty())
+            extra->subtreeLayerValid -= widgetRect.translated(widget->mapTo(w, QPoint()));
+    }
+}
+
 /*!
     \internal
     Marks the region of the widget as dirty (if not already marked as dirty) and
@@ -182,6 +196,8 @@ void QWidgetRepaintManager::markDirty(const T &r, QWidget *widget, UpdateTime up
 
     QRect widgetRect = widgetRectFor(widget, r);
 
+    invalidateCachedSubtreeLayers(widget, widgetRect);
+
     // ---------------------------------------------------------------------------
 
     if (widget->d_func()->shouldPaintOnScreen()) {
@@ -529,6 +545,9 @@ bool QWidgetRepaintManager::bltRect(const QRect &rect, int dx, int dy, QWidget *
     const QRect tlwRect(QRect(pos, rect.size()));
     if (dirty.intersects(tlwRect))
         return false; // We don't want to scroll junk.
+    // The blt bypasses paint events, so any retained subtree layer covering
+    // the area no longer matches the backing store.
+    invalidateCachedSubtreeLayers(widget, rect.united(rect.translated(dx, dy)));
     return store->scroll(tlwRect, dx, dy);
 }
 
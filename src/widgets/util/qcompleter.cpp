@@ -314,7 +314,10 @@ int QCompletionModel::completionCount() const
     if (!engine->matchCount())
         return 0;
 
-    engine->filterOnDemand(INT_MAX);
+    // in incremental mode the timer completes the match list in the
+    // background; report what has been found so far instead of blocking
+    if (!c->incrementalFiltering || !incrementalFilterTimer.isActive())
+        engine->filterOnDemand(INT_MAX);
     return engine->matchCount();
 }
 
@@ -392,6 +395,45 @@ void QCompletionModel::filter(const QStringList& parts)
 
     if (d->model->canFetchMore(engine->curParent))
         d->model->fetchMore(engine->curParent);
+
+    if (c->incrementalFiltering) {
+        if (!showAll && engine->curMatch.partial) {
+            incrementalFilterTimer.start(0, this);
+        } else {
+            incrementalFilterTimer.stop();
+            emit filteringFinished();
+        }
+    } else {
+        incrementalFilterTimer.stop();
+    }
+}
+
+void QCompletionModel::timerEvent(QTimerEvent *e)
+{
+    if (e->timerId() != incrementalFilterTimer.timerId()) {
+        QAbstractProxyModel::timerEvent(e);
+        return;
+    }
+
+    // scan another slice of the source model; small enough to keep the GUI
+    // thread responsive between two slices
+    const int chunkRows = 10000;
+    QMatchData m;
+    engine->filterMoreRows(chunkRows, &m);
+    const int added = m.indices.count() - engine->curMatch.indices.count();
+    if (added > 0) {
+        const int first = engine->matchCount();
+        beginInsertRows(QModelIndex(), first, first + added - 1);
+        engine->curMatch = m;
+        endInsertRows();
+    } else {
+        engine->curMatch = m;
+    }
+
+    if (!engine->curMatch.partial) {
+        incrementalFilterTimer.stop();
+        emit filteringFinished();
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -732,6 +774,21 @@ int QUnsortedModelEngine::buildIndices(const QString& str, const QModelIndex& pa
     return indices[i-1];
 }
 
+bool QUnsortedModelEngine::filterMoreRows(int maxRows, QMatchData *m)
+{
+    *m = curMatch;
+    if (!m->partial || !m->indices.count())
+        return false;
+    const QAbstractItemModel *model = c->proxy->sourceModel();
+    const int lastRow = model->rowCount(curParent) - 1;
+    const int from = m->indices.last() + 1;
+    const int to = qMin(lastRow, from + maxRows - 1);
+    buildIndices(curParts.constLast(), curParent, INT_MAX, QIndexMapper(from, to), m);
+    m->partial = (to != lastRow);
+    saveInCache(curParts.constLast(), curParent, *m);
+    return m->partial;
+}
+
 void QUnsortedModelEngine::filterOnDemand(int n)
 {
     Q_ASSERT(matchCount());
@@ -798,6 +855,7 @@ QCompleterPrivate::QCompleterPrivate()
       maxVisibleItems(7),
       sorting(QCompleter::UnsortedModel),
       wrap(true),
+      incrementalFiltering(false),
       eatFocusOut(true),
       hiddenBecauseNoMatch(false)
 {
@@ -808,6 +866,7 @@ void QCompleterPrivate::init(QAbstractItemModel *m)
     Q_Q(QCompleter);
     proxy = new QCompletionModel(this, q);
     QObject::connect(proxy, SIGNAL(rowsAdded()), q, SLOT(_q_autoResizePopup()));
+    QObject::connect(proxy, SIGNAL(filteringFinished()), q, SIGNAL(filteringFinished()));
     q->setModel(m);
 #if !QT_CONFIG(listview)
     q->setCompletionMode(QCompleter::InlineCompletion);
@@ -1679,6 +1738,49 @@ bool QCompleter::wrapAround() const
     return d->wrap;
 }
 
+/*!
+    \property QCompleter::incrementalFiltering
+    \brief whether completions on a large unsorted model are gathered
+    incrementally
+    \since 6.9
+
+    By default, the completer filters the whole model before the popup is
+    shown, which can visibly stall the GUI thread on every keystroke when an
+    unsorted model contains hundreds of thousands of rows. When this property
+    is set to true, only enough matches to display the popup are gathered up
+    front; the rest of the model is scanned in small slices from the event
+    loop, the found completions are appended to the \l completionModel() as
+    they are discovered, and filteringFinished() is emitted once the whole
+    model has been scanned.
+
+    While the scan is still running, completionCount() returns the number of
+    completions found so far instead of blocking until the count is final.
+
+    The default is false. The property has no effect on sorted models
+    (\l modelSorting), where matches are found with a binary search and
+    filtering is cheap.
+*/
+void QCompleter::setIncrementalFiltering(bool enable)
+{
+    Q_D(QCompleter);
+    d->incrementalFiltering = enable;
+}
+
+bool QCompleter::incrementalFiltering() const
+{
+    Q_D(const QCompleter);
+    return d->incrementalFiltering;
+}
+
+/*!
+    \fn void QCompleter::filteringFinished()
+    \since 6.9
+
+    This signal is emitted in \l incrementalFiltering mode when all the rows
+    of the model have been examined for the current completion prefix, that
+    is when completionCount() has reached its final value.
+*/
+
 /*!
     \property QCompleter::maxVisibleItems
     \brief the maximum allowed size on screen of the completer, measured in items
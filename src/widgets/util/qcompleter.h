@@ -32,6 +32,7 @@ class Q_WIDGETS_EXPORT QCompleter : public QObject
     Q_PROPERTY(int maxVisibleItems READ maxVisibleItems WRITE setMaxVisibleItems)
     Q_PROPERTY(Qt::CaseSensitivity caseSensitivity READ caseSensitivity WRITE setCaseSensitivity)
     Q_PROPERTY(bool wrapAround READ wrapAround WRITE setWrapAround)
+    Q_PROPERTY(bool incrementalFiltering READ incrementalFiltering WRITE setIncrementalFiltering)
 
 public:
     enum CompletionMode {
@@ -84,6 +85,9 @@ public:
 
     bool wrapAround() const;
 
+    void setIncrementalFiltering(bool enable);
+    bool incrementalFiltering() const;
+
     int maxVisibleItems() const;
     void setMaxVisibleItems(int maxItems);
 
@@ -116,6 +120,7 @@ Q_SIGNALS:
     void activated(const QModelIndex &index);
     void highlighted(const QString &text);
     void highlighted(const QModelIndex &index);
+    void filteringFinished();
 
 private:
     Q_DISABLE_COPY(QCompleter)
@@ -27,6 +27,7 @@
 #include "QtGui/qpainter.h"
 
 #include "private/qabstractproxymodel_p.h"
+#include <QtCore/qbasictimer.h>
 #include <QtCore/qpointer.h>
 
 QT_REQUIRE_CONFIG(completer);
@@ -57,6 +58,7 @@ public:
     int maxVisibleItems;
     QCompleter::ModelSorting sorting;
     bool wrap;
+    bool incrementalFiltering;
 
     bool eatFocusOut;
     QRect popupRect;
@@ -126,6 +128,7 @@ public:
     bool lookupCache(const QString &part, const QModelIndex &parent, QMatchData *m) const;
 
     virtual void filterOnDemand(int) { }
+    virtual bool filterMoreRows(int, QMatchData *m) { *m = curMatch; return false; }
     virtual QMatchData filter(const QString&, const QModelIndex&, int) = 0;
 
     int matchCount() const { return curMatch.indices.count() + historyMatch.indices.count(); }
@@ -155,6 +158,7 @@ public:
     QUnsortedModelEngine(QCompleterPrivate *c) : QCompletionEngine(c) { }
 
     void filterOnDemand(int) override;
+    bool filterMoreRows(int, QMatchData *) override;
     QMatchData filter(const QString&, const QModelIndex&, int) override;
 private:
     int buildIndices(const QString& str, const QModelIndex& parent, int n,
@@ -209,11 +213,16 @@ public:
     QCompleterPrivate *c;
     QScopedPointer<QCompletionEngine> engine;
     bool showAll;
+    QBasicTimer incrementalFilterTimer;
 
     Q_DECLARE_PRIVATE(QCompletionModel)
 
+protected:
+    void timerEvent(QTimerEvent *) override;
+
 signals:
     void rowsAdded();
+    void filteringFinished();
 
 public Q_SLOTS:
     void invalidate();
@@ -97,6 +97,13 @@ public:
    or any sort of advanced text layout that goes beyond a list of
    paragraphs with syntax highlighting.
 
+   Paragraphs are laid out lazily: a block's QTextLayout is only
+   computed when a view actually needs its geometry, which in practice
+   limits layout work to the blocks around the visible viewport. Blocks
+   that have not been laid out yet are estimated to occupy one line, so
+   even very large documents can be opened without paying an up-front
+   layout cost for every paragraph.
+
 */
 
 
@@ -244,8 +251,14 @@ void QPlainTextDocumentLayoutPrivate::relayout()
     Q_Q(QPlainTextDocumentLayout);
     QTextBlock block = q->document()->firstBlock();
     while (block.isValid()) {
-        block.layout()->clearLayout();
-        block.setLineCount(block.isVisible() ? 1 : 0);
+        // QTextBlock::clearLayout() doesn't create the layout object for
+        // blocks that were never laid out; calling block.layout() here would
+        // allocate one QTextLayout per block, which hurts on huge documents
+        // where only the blocks near the viewport ever get laid out
+        block.clearLayout();
+        const int lineCount = block.isVisible() ? 1 : 0;
+        if (block.lineCount() != lineCount)
+            block.setLineCount(lineCount);
         block = block.next();
     }
     emit q->update();
@@ -58,6 +58,7 @@ private slots:
     void noIterations();
     void throttling();
     void multipleResults();
+    void fixedBlockSize();
 };
 
 QAtomicInt iterations;
@@ -246,6 +247,51 @@ void tst_QtConcurrentIterateKernel::multipleResults()
     f.waitForFinished();
 }
 
+QMutex blockSizesMutex;
+QList<int> blockSizes;
+class BlockSizeRecordingFor : public IterateKernel<TestIterator, void>
+{
+public:
+    BlockSizeRecordingFor(TestIterator begin, TestIterator end)
+        : IterateKernel<TestIterator, void>(QThreadPool::globalInstance(), begin, end) { }
+    inline bool runIterations(TestIterator/*beginIterator*/, int begin, int end, void *) override
+    {
+        QMutexLocker locker(&blockSizesMutex);
+        blockSizes.append(end - begin);
+        return false;
+    }
+    bool runIteration(TestIterator it, int index , void *result) override
+    {
+        return runIterations(it, index, index + 1, result);
+    }
+};
+
+void tst_QtConcurrentIterateKernel::fixedBlockSize()
+{
+    QCOMPARE(QtConcurrent::fixedBlockSize(), 0);
+
+    const int totalIterations = 100;
+    QtConcurrent::setFixedBlockSize(16);
+    QCOMPARE(QtConcurrent::fixedBlockSize(), 16);
+
+    blockSizes.clear();
+    auto future = startThreadEngine(new BlockSizeRecordingFor(0, totalIterations))
+                          .startAsynchronously();
+    future.waitForFinished();
+
+    QtConcurrent::setFixedBlockSize(0);
+    QCOMPARE(QtConcurrent::fixedBlockSize(), 0);
+
+    int total = 0;
+    for (int blockSize : std::as_const(blockSizes)) {
+        // Every block is exactly the requested size, except possibly the
+        // final partial block at the end of the range.
+        QVERIFY(blockSize == 16 || blockSize == totalIterations % 16);
+        total += blockSize;
+    }
+    QCOMPARE(total, totalIterations);
+}
+
 QTEST_MAIN(tst_QtConcurrentIterateKernel)
 
 #include "tst_qtconcurrentiteratekernel.moc"
@@ -0,0 +1,258 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtconcurrentpipeline.h>
+
+#include <QTest>
+#include <QException>
+#include <QSemaphore>
+#include <QThread>
+
+#include <algorithm>
+#include <memory>
+
+using namespace QtConcurrent;
+
+class tst_QtConcurrentPipeline : public QObject
+{
+    Q_OBJECT
+private slots:
+    void channelBasics();
+    void moveOnlyPayload();
+    void streamingMap();
+    void orderedEmission();
+    void boundedInFlight();
+    void chainedStages();
+    void cancel();
+    void exceptions();
+};
+
+void tst_QtConcurrentPipeline::channelBasics()
+{
+    QChannel<int> channel(2);
+    QCOMPARE(channel.capacity(), 2);
+    QVERIFY(!channel.isClosed());
+
+    QVERIFY(channel.send(1));
+    QVERIFY(channel.send(2));
+    QCOMPARE(channel.receive(), std::optional(1));
+
+    quint64 sequence = 0;
+    QCOMPARE(channel.receive(&sequence), std::optional(2));
+    QCOMPARE(sequence, quint64(1));
+
+    channel.close();
+    QVERIFY(channel.isClosed());
+    QVERIFY(!channel.send(3));
+    QCOMPARE(channel.receive(), std::nullopt);
+
+    // capacity is clamped to at least one item
+    QChannel<int> tiny(-1);
+    QCOMPARE(tiny.capacity(), 1);
+}
+
+void tst_QtConcurrentPipeline::moveOnlyPayload()
+{
+    QChannel<std::unique_ptr<int>> channel;
+    QVERIFY(channel.send(std::make_unique<int>(42)));
+    std::optional<std::unique_ptr<int>> received = channel.receive();
+    QVERIFY(received.has_value());
+    QCOMPARE(**received, 42);
+}
+
+void tst_QtConcurrentPipeline::streamingMap()
+{
+    const int itemCount = 100;
+    QChannel<int> source(8);
+    QChannel<int> sink(8);
+
+    QFuture<void> future = mapPipeline(source, sink, [](int value) { return value * value; });
+
+    // feed the stage while it is already running, as I/O code would
+    std::unique_ptr<QThread> producer(QThread::create([&] {
+        for (int i = 0; i < itemCount; ++i)
+            QVERIFY(source.send(i));
+        source.close();
+    }));
+    producer->start();
+
+    QList<int> results;
+    while (std::optional<int> result = sink.receive())
+        results.append(*result);
+
+    QVERIFY(producer->wait());
+    future.waitForFinished();
+    QVERIFY(sink.isClosed());
+
+    QCOMPARE(results.size(), itemCount);
+    std::sort(results.begin(), results.end());
+    for (int i = 0; i < itemCount; ++i)
+        QCOMPARE(results.at(i), i * i);
+}
+
+void tst_QtConcurrentPipeline::orderedEmission()
+{
+    const int itemCount = 200;
+    QChannel<int> source(16);
+    QChannel<int> sink(16);
+
+    QFuture<void> future = mapPipeline(source, sink,
+                                       [](int value) {
+                                           // uneven per-item cost to provoke reordering
+                                           if (value % 7 == 0)
+                                               QThread::usleep(100);
+                                           return value + 1;
+                                       },
+                                       0, PipelineOrder::Ordered);
+
+    std::unique_ptr<QThread> producer(QThread::create([&] {
+        for (int i = 0; i < itemCount; ++i)
+            QVERIFY(source.send(i));
+        source.close();
+    }));
+    producer->start();
+
+    QList<int> results;
+    while (std::optional<int> result = sink.receive())
+        results.append(*result);
+
+    QVERIFY(producer->wait());
+    future.waitForFinished();
+
+    QCOMPARE(results.size(), itemCount);
+    for (int i = 0; i < itemCount; ++i)
+        QCOMPARE(results.at(i), i + 1);
+}
+
+void tst_QtConcurrentPipeline::boundedInFlight()
+{
+    const int itemCount = 50;
+    const int maxInFlight = 2;
+    QChannel<int> source(itemCount);
+    QChannel<int> sink(itemCount);
+
+    QAtomicInt inFlight;
+    QAtomicInt peakInFlight;
+
+    QFuture<void> future = mapPipeline(source, sink,
+                                       [&](int value) {
+                                           const int current = inFlight.fetchAndAddOrdered(1) + 1;
+                                           int peak = peakInFlight.loadRelaxed();
+                                           while (current > peak
+                                                  && !peakInFlight.testAndSetOrdered(peak, current)) {
+                                               peak = peakInFlight.loadRelaxed();
+                                           }
+                                           QThread::usleep(100);
+                                           inFlight.deref();
+                                           return value;
+                                       },
+                                       maxInFlight);
+
+    for (int i = 0; i < itemCount; ++i)
+        QVERIFY(source.send(i));
+    source.close();
+
+    int received = 0;
+    while (sink.receive())
+        ++received;
+    future.waitForFinished();
+
+    QCOMPARE(received, itemCount);
+    QCOMPARE_LE(peakInFlight.loadRelaxed(), maxInFlight);
+}
+
+void tst_QtConcurrentPipeline::chainedStages()
+{
+    const int itemCount = 64;
+    QChannel<int> source(8);
+    QChannel<int> middle(8);
+    QChannel<int> sink(8);
+
+    // the first stage closing its sink propagates end-of-stream to the second
+    QFuture<void> first = mapPipeline(source, middle, [](int value) { return value * 2; });
+    QFuture<void> second = mapPipeline(middle, sink, [](int value) { return value + 1; });
+
+    for (int i = 0; i < itemCount; ++i)
+        QVERIFY(source.send(i));
+    source.close();
+
+    QList<int> results;
+    while (std::optional<int> result = sink.receive())
+        results.append(*result);
+
+    first.waitForFinished();
+    second.waitForFinished();
+
+    QCOMPARE(results.size(), itemCount);
+    std::sort(results.begin(), results.end());
+    for (int i = 0; i < itemCount; ++i)
+        QCOMPARE(results.at(i), i * 2 + 1);
+}
+
+void tst_QtConcurrentPipeline::cancel()
+{
+    QChannel<int> source(4);
+    QChannel<int> sink(4);
+    QSemaphore mapStarted;
+    QSemaphore mayFinish;
+
+    QFuture<void> future = mapPipeline(source, sink,
+                                       [&](int value) {
+                                           mapStarted.release();
+                                           mayFinish.acquire();
+                                           return value;
+                                       },
+                                       1);
+
+    QVERIFY(source.send(1));
+    QVERIFY(source.send(2));
+    mapStarted.acquire();
+
+    future.cancel();
+    mayFinish.release(2);
+    source.close();
+    QVERIFY(QTest::qWaitFor([&] { return future.isFinished(); }));
+
+    // the in-flight item completed, but no further item was taken
+    QVERIFY(future.isCanceled());
+    QVERIFY(sink.isClosed());
+    int received = 0;
+    while (sink.receive())
+        ++received;
+    QCOMPARE_LE(received, 1);
+}
+
+void tst_QtConcurrentPipeline::exceptions()
+{
+#ifndef QT_NO_EXCEPTIONS
+    const int itemCount = 32;
+    QChannel<int> source(itemCount);
+    QChannel<int> sink(itemCount);
+
+    QFuture<void> future = mapPipeline(source, sink, [](int value) -> int {
+        if (value == 3)
+            throw QException();
+        return value;
+    });
+
+    for (int i = 0; i < itemCount; ++i)
+        QVERIFY(source.send(i));
+    source.close();
+
+    while (sink.receive()) { }
+    QVERIFY(sink.isClosed());
+
+    bool caught = false;
+    try {
+        future.waitForFinished();
+    } catch (const QException &) {
+        caught = true;
+    }
+    QVERIFY(caught);
+#else
+    QSKIP("Exceptions are disabled");
+#endif
+}
+
+QTEST_MAIN(tst_QtConcurrentPipeline)
+#include "tst_qtconcurrentpipeline.moc"
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <qtconcurrenttaskgraph.h>
+
+#include <QException>
+#include <QMutex>
+#include <QSemaphore>
+#include <QTest>
+#include <QThreadPool>
+
+using namespace QtConcurrent;
+
+class tst_QTaskGraphTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void emptyGraph();
+    void singleTask();
+    void diamond();
+    void cancelSkipsUnstartedTasks();
+    void exceptionSkipsUnstartedTasks();
+    void invalidDependencyIsIgnored();
+    void customPool();
+};
+
+void tst_QTaskGraphTest::emptyGraph()
+{
+    QTaskGraph graph;
+    QFuture<void> future = graph.submit();
+    QVERIFY(future.isFinished());
+    QVERIFY(!future.isCanceled());
+}
+
+void tst_QTaskGraphTest::singleTask()
+{
+    QAtomicInt ran;
+    QTaskGraph graph;
+    graph.addTask([&] { ran.ref(); });
+    QFuture<void> future = graph.submit();
+    future.waitForFinished();
+    QCOMPARE(ran.loadRelaxed(), 1);
+}
+
+void tst_QTaskGraphTest::diamond()
+{
+    // a -> (b, c) -> d: b and c must run after a, d after both
+    QMutex mutex;
+    QList<char> order;
+    const auto record = [&](char task) {
+        QMutexLocker locker(&mutex);
+        order.append(task);
+    };
+
+    QTaskGraph graph;
+    const auto a = graph.addTask([&] { record('a'); });
+    const auto b = graph.addTask([&] { record('b'); }, { a });
+    const auto c = graph.addTask([&] { record('c'); }, { a });
+    graph.addTask([&] { record('d'); }, { b, c });
+
+    graph.submit().waitForFinished();
+
+    QCOMPARE(order.size(), 4);
+    QCOMPARE(order.first(), 'a');
+    QCOMPARE(order.last(), 'd');
+    QVERIFY(order.contains('b'));
+    QVERIFY(order.contains('c'));
+}
+
+void tst_QTaskGraphTest::cancelSkipsUnstartedTasks()
+{
+    QSemaphore started, mayFinish;
+    QAtomicInt dependentRan;
+
+    QTaskGraph graph;
+    const auto gate = graph.addTask([&] {
+        started.release();
+        mayFinish.acquire();
+    });
+    graph.addTask([&] { dependentRan.ref(); }, { gate });
+
+    QFuture<void> future = graph.submit();
+    started.acquire(); // the gate task is running
+    future.cancel();
+    mayFinish.release();
+    future.waitForFinished();
+
+    QVERIFY(future.isCanceled());
+    QCOMPARE(dependentRan.loadRelaxed(), 0);
+}
+
+void tst_QTaskGraphTest::exceptionSkipsUnstartedTasks()
+{
+#ifdef QT_NO_EXCEPTIONS
+    QSKIP("This test requires exception support");
+#else
+    QAtomicInt dependentRan;
+
+    QTaskGraph graph;
+    const auto failing = graph.addTask([] { throw QException(); });
+    graph.addTask([&] { dependentRan.ref(); }, { failing });
+
+    QFuture<void> future = graph.submit();
+    bool caught = false;
+    try {
+        future.waitForFinished();
+    } catch (const QException &) {
+        caught = true;
+    }
+    QVERIFY(caught);
+    QCOMPARE(dependentRan.loadRelaxed(), 0);
+#endif
+}
+
+void tst_QTaskGraphTest::invalidDependencyIsIgnored()
+{
+    // dependencies may only refer to earlier tasks, which also keeps the
+    // graph acyclic by construction
+    QAtomicInt ran;
+    QTaskGraph graph;
+    QTest::ignoreMessage(QtWarningMsg, "QTaskGraph::addTask: invalid dependency id 1 ignored");
+    graph.addTask([&] { ran.ref(); }, { 1 }); // forward reference is invalid
+
+    // the invalid dependency is dropped, so the graph still runs
+    graph.submit().waitForFinished();
+    QCOMPARE(ran.loadRelaxed(), 1);
+}
+
+void tst_QTaskGraphTest::customPool()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(2);
+
+    QAtomicInt ran;
+    QTaskGraph graph(&pool);
+    const auto a = graph.addTask([&] { ran.ref(); });
+    graph.addTask([&] { ran.ref(); }, { a });
+    graph.submit().waitForFinished();
+    QCOMPARE(ran.loadRelaxed(), 2);
+    pool.waitForDone();
+}
+
+QTEST_MAIN(tst_QTaskGraphTest)
+#include "tst_qtconcurrenttaskgraph.moc"
@@ -0,0 +1,127 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qbfloat16.h>
+
+#include <QTest>
+
+#include <QtCore/qlist.h>
+
+#include <cmath>
+#include <limits>
+
+class tst_QBFloat16 : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void roundTrip();
+    void rounding();
+    void specialValues();
+    void arithmetic();
+    void limits();
+    void arrayConversion();
+};
+
+void tst_QBFloat16::roundTrip()
+{
+    // every bfloat16 is exactly representable as float, so a
+    // float -> bfloat16 -> float round trip of an exact value is lossless
+    const float exact[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 2.0f, 96.0f,
+                            1.0f / 256.0f, 3.0e38f, 1.18e-38f };
+    for (float f : exact)
+        QCOMPARE(float(qbfloat16(f)), f);
+}
+
+void tst_QBFloat16::rounding()
+{
+    // 1 + 2^-8 is exactly half way between 1 and the next representable
+    // value, 1 + 2^-7; ties round to even mantissa, which here is 1
+    QCOMPARE(float(qbfloat16(1.0f + 1.0f / 256.0f)), 1.0f);
+    // 1 + 3 * 2^-8 is half way with an odd low kept bit, so it rounds up
+    QCOMPARE(float(qbfloat16(1.0f + 3.0f / 256.0f)), 1.0f + 2.0f / 128.0f);
+    // anything past half way rounds up
+    QCOMPARE(float(qbfloat16(1.0f + 1.5f / 256.0f)), 1.0f + 1.0f / 128.0f);
+}
+
+void tst_QBFloat16::specialValues()
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    QVERIFY(qIsInf(qbfloat16(inf)));
+    QVERIFY(qIsInf(qbfloat16(-inf)));
+    QVERIFY(qbfloat16(-inf) < qbfloat16(0.f));
+    QVERIFY(qIsNaN(qbfloat16(std::numeric_limits<float>::quiet_NaN())));
+    QVERIFY(qIsNaN(float(qbfloat16(std::numeric_limits<float>::quiet_NaN()))));
+
+    // FLT_MAX rounds up past the largest finite bfloat16, overflowing to
+    // infinity, while values at or below the bfloat16 maximum stay finite
+    QVERIFY(qIsInf(qbfloat16(std::numeric_limits<float>::max())));
+    QVERIFY(qIsFinite(qbfloat16(3.38e38f)));
+
+    QVERIFY(qIsNull(qbfloat16(0.0f)));
+    QVERIFY(qIsNull(qbfloat16(-0.0f)));
+    QCOMPARE(qFpClassify(qbfloat16(1.f)), FP_NORMAL);
+    QCOMPARE(qFpClassify(qbfloat16(0.f)), FP_ZERO);
+}
+
+void tst_QBFloat16::arithmetic()
+{
+    qbfloat16 a(2.0f), b(0.5f);
+    QCOMPARE(float(a + b), 2.5f);
+    QCOMPARE(float(a - b), 1.5f);
+    QCOMPARE(float(a * b), 1.0f);
+    QCOMPARE(float(a / b), 4.0f);
+    QCOMPARE(float(-a), -2.0f);
+    QCOMPARE(a.copySign(qbfloat16(-1.f)), qbfloat16(-2.0f));
+    QVERIFY(b < a);
+    QVERIFY(a == qbfloat16(2.0f));
+    QVERIFY(qFuzzyCompare(qbfloat16(100.f), qbfloat16(101.f)));
+    QVERIFY(!qFuzzyCompare(qbfloat16(100.f), qbfloat16(120.f)));
+}
+
+void tst_QBFloat16::limits()
+{
+    using Limits = std::numeric_limits<qbfloat16>;
+    QCOMPARE(Limits::digits, 8);
+    QVERIFY(qIsInf(Limits::infinity()));
+    QVERIFY(qIsNaN(Limits::quiet_NaN()));
+    QVERIFY(Limits::lowest() == -(Limits::max)());
+    QCOMPARE(float((Limits::min)()), 1.17549435e-38f);
+    QVERIFY(float(Limits::denorm_min()) > 0.0f);
+    // epsilon: 1 + epsilon is the next representable value after 1
+    QCOMPARE(float(qbfloat16(1.f) + Limits::epsilon()), 1.0f + 1.0f / 128.0f);
+}
+
+void tst_QBFloat16::arrayConversion()
+{
+    // long enough to exercise the vectorized paths and their tails
+    constexpr qsizetype N = 77;
+    QList<float> in;
+    for (qsizetype i = 0; i < N; ++i)
+        in.append(float(i) * 0.3333f - 11.f);
+    in[3] = std::numeric_limits<float>::quiet_NaN();
+    in[9] = std::numeric_limits<float>::infinity();
+
+    QList<qbfloat16> mid(N, qbfloat16(Qt::Uninitialized));
+    qFloatToBFloat16(mid.data(), in.constData(), N);
+    for (qsizetype i = 0; i < N; ++i) {
+        // the batch conversion must agree exactly with the scalar one
+        if (qIsNaN(qbfloat16(in[i])))
+            QVERIFY(qIsNaN(mid[i]));
+        else
+            QCOMPARE(mid[i], qbfloat16(in[i]));
+    }
+
+    QList<float> out(N);
+    qFloatFromBFloat16(out.data(), mid.constData(), N);
+    for (qsizetype i = 0; i < N; ++i) {
+        if (qIsNaN(in[i]))
+            QVERIFY(qIsNaN(out[i]));
+        else
+            QCOMPARE(out[i], float(mid[i]));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QBFloat16)
+
+#include "tst_qbfloat16.moc"
@@ -0,0 +1,99 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qsimd.h>
+
+#include <QTest>
+
+class tst_QSimd : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void hasFeature();
+    void foreignArchitectures();
+    void featureImplications();
+    void dispatch();
+};
+
+void tst_QSimd::hasFeature()
+{
+    QVERIFY(QCpuFeatures::hasFeature(QCpuFeatures::Feature::None));
+
+#if defined(Q_PROCESSOR_X86_64)
+    // SSE2 is part of the x86-64 baseline
+    QVERIFY(QCpuFeatures::hasFeature(QCpuFeatures::Feature::Sse2));
+#endif
+#if defined(Q_PROCESSOR_ARM_64)
+    // NEON is mandatory on AArch64
+    QVERIFY(QCpuFeatures::hasFeature(QCpuFeatures::Feature::Neon));
+#endif
+}
+
+void tst_QSimd::foreignArchitectures()
+{
+#if defined(Q_PROCESSOR_X86)
+    QVERIFY(!QCpuFeatures::hasFeature(QCpuFeatures::Feature::Neon));
+    QVERIFY(!QCpuFeatures::hasFeature(QCpuFeatures::Feature::Dsp));
+#elif defined(Q_PROCESSOR_ARM)
+    QVERIFY(!QCpuFeatures::hasFeature(QCpuFeatures::Feature::Avx2));
+    QVERIFY(!QCpuFeatures::hasFeature(QCpuFeatures::Feature::Dsp));
+#endif
+}
+
+void tst_QSimd::featureImplications()
+{
+    using F = QCpuFeatures::Feature;
+    // a microarchitecture level implies its member features
+    if (QCpuFeatures::hasFeature(F::ArchHaswell)) {
+        QVERIFY(QCpuFeatures::hasFeature(F::Avx2));
+        QVERIFY(QCpuFeatures::hasFeature(F::Sse42));
+    }
+    if (QCpuFeatures::hasFeature(F::ArchSkylakeAvx512)) {
+        QVERIFY(QCpuFeatures::hasFeature(F::Avx512F));
+        QVERIFY(QCpuFeatures::hasFeature(F::ArchHaswell));
+    }
+    if (QCpuFeatures::hasFeature(F::Avx2))
+        QVERIFY(QCpuFeatures::hasFeature(F::Avx));
+}
+
+static int generic() { return 0; }
+static int variantA() { return 1; }
+static int variantB() { return 2; }
+
+void tst_QSimd::dispatch()
+{
+    using Fn = int (*)();
+
+    // None always matches, so the first entry wins
+    const QCpuDispatchEntry<Fn> alwaysFirst[] = {
+        { QCpuFeatures::Feature::None, variantA },
+        { QCpuFeatures::Feature::None, variantB },
+    };
+    QCOMPARE(qCpuDispatch(alwaysFirst, generic)(), 1);
+
+    // foreign-architecture variants are skipped; fall through to generic
+    const QCpuDispatchEntry<Fn> foreignOnly[] = {
+#if defined(Q_PROCESSOR_X86)
+        { QCpuFeatures::Feature::Neon, variantA },
+#else
+        { QCpuFeatures::Feature::Avx512F, variantA },
+#endif
+    };
+    QCOMPARE(qCpuDispatch(foreignOnly, generic)(), 0);
+
+    // a supported variant must be picked over a later fallback entry
+    const QCpuDispatchEntry<Fn> mixed[] = {
+        { QCpuFeatures::Feature::ArchSkylakeAvx512, variantB },
+        { QCpuFeatures::Feature::None, variantA },
+    };
+    const int picked = qCpuDispatch(mixed, generic)();
+    if (QCpuFeatures::hasFeature(QCpuFeatures::Feature::ArchSkylakeAvx512))
+        QCOMPARE(picked, 2);
+    else
+        QCOMPARE(picked, 1);
+}
+
+QTEST_APPLESS_MAIN(tst_QSimd)
+
+#include "tst_qsimd.moc"
@@ -264,6 +264,8 @@ private slots:
     void mapOpenMode();
     void mapWrittenFile_data();
     void mapWrittenFile();
+    void mapWithHints();
+    void advise();
 
     void openStandardStreamsFileDescriptors();
     void openStandardStreamsBufferedStreams();
@@ -3591,6 +3593,76 @@ void tst_QFile::mapWrittenFile()
     file.remove();
 }
 
+void tst_QFile::mapWithHints()
+{
+    // the access pattern options are hints: a mapping created with them must
+    // behave like one created without them
+    static const QFileDevice::MemoryMapFlags hints[] = {
+        QFileDevice::MapSequentialOption,
+        QFileDevice::MapRandomAccessOption,
+        QFileDevice::MapWillNeedOption,
+        QFileDevice::MapPopulateOption,
+        QFileDevice::MapHugePagesOption,
+        QFileDevice::MapSequentialOption | QFileDevice::MapWillNeedOption
+                | QFileDevice::MapPopulateOption,
+    };
+
+    static const char data[128] = "Some data padded with nulls\n";
+    QString fileName = QDir::currentPath() + '/' + "qfile_map_testfile";
+
+    if (QFile::exists(fileName)) {
+        QVERIFY(QFile::setPermissions(fileName,
+            QFile::WriteOwner | QFile::ReadOwner | QFile::WriteUser | QFile::ReadUser));
+        QFile::remove(fileName);
+    }
+    QFile file(fileName);
+    QVERIFY2(file.open(QFile::ReadWrite), msgOpenFailed(file).constData());
+    QCOMPARE(file.write(data, sizeof data), qint64(sizeof data));
+    QVERIFY(file.flush());
+
+    for (QFileDevice::MemoryMapFlags flags : hints) {
+        uchar *memory = file.map(0, sizeof data, flags);
+        QCOMPARE(file.error(), QFile::NoError);
+        QVERIFY(memory);
+        QVERIFY(memcmp(memory, data, sizeof data) == 0);
+        QVERIFY(file.unmap(memory));
+        QCOMPARE(file.error(), QFile::NoError);
+    }
+
+    file.close();
+    file.remove();
+}
+
+void tst_QFile::advise()
+{
+    QFile file(m_testFile);
+
+    // invalid, not open
+    QVERIFY(!file.advise(0, 0, QFileDevice::SequentialAdvice));
+
+    QVERIFY2(file.open(QFile::ReadOnly), msgOpenFailed(file).constData());
+
+    const QFileDevice::FileAdvice advices[] = {
+        QFileDevice::SequentialAdvice,
+        QFileDevice::RandomAdvice,
+        QFileDevice::WillNeedAdvice,
+        QFileDevice::DontNeedAdvice,
+        QFileDevice::NormalAdvice,
+    };
+    for (QFileDevice::FileAdvice advice : advices) {
+        const bool ok = file.advise(0, file.size(), advice);
+#if defined(Q_OS_LINUX)
+        QVERIFY(ok);
+#else
+        Q_UNUSED(ok);   // merely a hint; not all platforms support it
+#endif
+    }
+
+    // advice must not affect what is read
+    QCOMPARE(file.pos(), qint64(0));
+    QVERIFY(!file.readAll().isEmpty());
+}
+
 void tst_QFile::openDirectory()
 {
     QFile f1(m_resourcesDir);
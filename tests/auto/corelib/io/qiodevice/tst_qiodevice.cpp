@@ -21,6 +21,8 @@ private slots:
     void unget();
     void peek();
     void peekAndRead();
+    void peekView();
+    void readLineView();
 
     void readLine_data();
     void readLine();
@@ -357,6 +359,53 @@ void tst_QIODevice::peekAndRead()
     QFile::remove("peektestfile");
 }
 
+void tst_QIODevice::peekView()
+{
+    QByteArray data("Hello world\nSecond line\n");
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QBuffer::ReadOnly));
+
+    QByteArrayView view = buffer.peekView();
+    QCOMPARE(view, QByteArrayView(data));
+    QCOMPARE(buffer.pos(), qint64(0));
+
+    // limited peek, no side effects on a subsequent read
+    QCOMPARE(buffer.peekView(5), QByteArrayView("Hello"));
+    QCOMPARE(buffer.read(5), QByteArray("Hello"));
+
+    // skip() consumes viewed bytes without copying
+    view = buffer.peekView();
+    QCOMPARE(view, QByteArrayView(" world\nSecond line\n"));
+    QCOMPARE(buffer.skip(view.size()), qint64(view.size()));
+    QVERIFY(buffer.atEnd());
+    QVERIFY(buffer.peekView().isEmpty());
+}
+
+void tst_QIODevice::readLineView()
+{
+    QByteArray data("First line\nSecond line\nUnterminated");
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QBuffer::ReadOnly));
+
+    QCOMPARE(buffer.readLineView(), QByteArrayView("First line\n"));
+    QCOMPARE(buffer.pos(), qint64(11));
+
+    // maxSize truncates the line, like readLine()
+    QCOMPARE(buffer.readLineView(6), QByteArrayView("Second"));
+    QCOMPARE(buffer.readLineView(), QByteArrayView(" line\n"));
+
+    // the unterminated last line is returned at the end of the stream
+    QCOMPARE(buffer.readLineView(), QByteArrayView("Unterminated"));
+    QVERIFY(buffer.atEnd());
+    QVERIFY(buffer.readLineView().isEmpty());
+
+    // mixing with the copying functions keeps the position consistent
+    QVERIFY(buffer.seek(0));
+    QCOMPARE(buffer.readLine(), QByteArray("First line\n"));
+    QCOMPARE(buffer.readLineView(), QByteArrayView("Second line\n"));
+    QCOMPARE(buffer.readAll(), QByteArray("Unterminated"));
+}
+
 void tst_QIODevice::readLine_data()
 {
     QTest::addColumn<QByteArray>("data");
@@ -0,0 +1,190 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QtCore/QIpcRingChannel>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QThread>
+#include <QTest>
+
+#include "../ipctestcommon.h"
+
+#ifdef Q_OS_UNIX
+#  include <poll.h>
+#endif
+
+using namespace Qt::StringLiterals;
+
+class tst_QIpcRingChannel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase_data();
+    void createAndAttach();
+    void sendReceive();
+    void wrapAround();
+    void fullRing();
+    void messageTooLarge();
+    void waitForMessage();
+    void notificationDescriptor();
+
+private:
+    QNativeIpcKey uniqueKey(const char *name);
+};
+
+void tst_QIpcRingChannel::initTestCase_data()
+{
+    IpcTestCommon::addGlobalTestRows<QIpcRingChannel>();
+}
+
+QNativeIpcKey tst_QIpcRingChannel::uniqueKey(const char *name)
+{
+    QFETCH_GLOBAL(QNativeIpcKey::Type, keyType);
+    QString id = QLatin1StringView(name) + u'-' + QString::number(QCoreApplication::applicationPid());
+    return QIpcRingChannel::platformSafeKey(id, keyType);
+}
+
+void tst_QIpcRingChannel::createAndAttach()
+{
+    const QNativeIpcKey key = uniqueKey("createAndAttach");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY(!writer.isAttached());
+    QVERIFY2(writer.create(1000), qPrintable(writer.errorString()));
+    QVERIFY(writer.isAttached());
+    QCOMPARE(writer.capacity(), 1024);      // rounded up to a power of two
+    QCOMPARE(writer.maximumMessageSize(), 1024 - 4);
+
+    QIpcRingChannel reader(key, QIpcRingChannel::Role::Reader);
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+    QCOMPARE(reader.capacity(), writer.capacity());
+    QCOMPARE(reader.bytesAvailable(), 0);
+
+    // a reader cannot send, a writer cannot receive
+    QVERIFY(!reader.send("hi"));
+    QCOMPARE_NE(reader.error(), QIpcRingChannel::NoError);
+    QVERIFY(writer.receive().isNull());
+    QCOMPARE_NE(writer.error(), QIpcRingChannel::NoError);
+}
+
+void tst_QIpcRingChannel::sendReceive()
+{
+    const QNativeIpcKey key = uniqueKey("sendReceive");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY2(writer.create(4096), qPrintable(writer.errorString()));
+    QIpcRingChannel reader(key, QIpcRingChannel::Role::Reader);
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    QCOMPARE(reader.receive(), QByteArray());
+    QCOMPARE(reader.error(), QIpcRingChannel::NoError);
+
+    QVERIFY(writer.send("hello"));
+    QVERIFY(writer.send(QByteArray()));     // empty messages are legal
+    QVERIFY(writer.send("world"));
+    QCOMPARE_GT(reader.bytesAvailable(), 0);
+
+    QCOMPARE(reader.receive(), "hello");
+    QCOMPARE(reader.receive(), QByteArray(""));
+    QCOMPARE(reader.receive(), "world");
+    QCOMPARE(reader.receive(), QByteArray());
+    QCOMPARE(reader.bytesAvailable(), 0);
+}
+
+void tst_QIpcRingChannel::wrapAround()
+{
+    const QNativeIpcKey key = uniqueKey("wrapAround");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY2(writer.create(256), qPrintable(writer.errorString()));
+    QIpcRingChannel reader(key, QIpcRingChannel::Role::Reader);
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    // push enough traffic through a small ring that every payload position,
+    // including the frame header, crosses the physical end of the buffer
+    for (int i = 0; i < 100; ++i) {
+        const QByteArray message(97, 'a' + (i % 26));
+        QVERIFY(writer.send(message));
+        QCOMPARE(reader.receive(), message);
+    }
+}
+
+void tst_QIpcRingChannel::fullRing()
+{
+    const QNativeIpcKey key = uniqueKey("fullRing");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY2(writer.create(256), qPrintable(writer.errorString()));
+    QIpcRingChannel reader(key, QIpcRingChannel::Role::Reader);
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    const QByteArray message(60, 'x');
+    int sent = 0;
+    while (writer.send(message))
+        ++sent;
+    QCOMPARE(writer.error(), QIpcRingChannel::NoError);     // full, not failed
+    QCOMPARE(sent, 4);                                      // 4 * (60 + 4) == 256
+
+    QVERIFY(!writer.waitForSpace(message.size(), QDeadlineTimer(50)));
+    QCOMPARE(reader.receive(), message);
+    QVERIFY(writer.waitForSpace(message.size(), QDeadlineTimer(5000)));
+    QVERIFY(writer.send(message));
+}
+
+void tst_QIpcRingChannel::messageTooLarge()
+{
+    const QNativeIpcKey key = uniqueKey("messageTooLarge");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY2(writer.create(256), qPrintable(writer.errorString()));
+
+    QVERIFY(!writer.send(QByteArray(256, 'x')));
+    QCOMPARE(writer.error(), QIpcRingChannel::MessageTooLarge);
+    QVERIFY(!writer.waitForSpace(256, QDeadlineTimer(0)));
+    QCOMPARE(writer.error(), QIpcRingChannel::MessageTooLarge);
+    QVERIFY(writer.send(QByteArray(252, 'x')));             // exactly fits
+}
+
+void tst_QIpcRingChannel::waitForMessage()
+{
+    const QNativeIpcKey key = uniqueKey("waitForMessage");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY2(writer.create(4096), qPrintable(writer.errorString()));
+    QIpcRingChannel reader(key, QIpcRingChannel::Role::Reader);
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    QVERIFY(!reader.waitForMessage(QDeadlineTimer(50)));
+
+    QScopedPointer<QThread> thread(QThread::create([&writer]() {
+        QTest::qSleep(100);
+        writer.send("delayed");
+    }));
+    thread->start();
+    QVERIFY(reader.waitForMessage(QDeadlineTimer(5000)));
+    QCOMPARE(reader.receive(), "delayed");
+    thread->wait();
+}
+
+void tst_QIpcRingChannel::notificationDescriptor()
+{
+    const QNativeIpcKey key = uniqueKey("notificationDescriptor");
+    QIpcRingChannel writer(key, QIpcRingChannel::Role::Writer);
+    QVERIFY2(writer.create(4096), qPrintable(writer.errorString()));
+    QIpcRingChannel reader(key, QIpcRingChannel::Role::Reader);
+    QVERIFY2(reader.attach(), qPrintable(reader.errorString()));
+
+    QCOMPARE(writer.notificationDescriptor(), -1);
+#ifdef Q_OS_UNIX
+    const int fd = reader.notificationDescriptor();
+    QCOMPARE_GE(fd, 0);
+
+    QVERIFY(writer.send("ding"));
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    QCOMPARE(::poll(&pfd, 1, 5000), 1);
+    QVERIFY(pfd.revents & POLLIN);
+
+    QCOMPARE(reader.receive(), "ding");
+    QCOMPARE(reader.receive(), QByteArray());   // drains the doorbell
+    pfd.revents = 0;
+    QCOMPARE(::poll(&pfd, 1, 0), 0);            // no stale wakeup left
+#endif
+}
+
+QTEST_MAIN(tst_QIpcRingChannel)
+
+#include "tst_qipcringchannel.moc"
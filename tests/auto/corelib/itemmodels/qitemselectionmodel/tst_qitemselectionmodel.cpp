@@ -55,6 +55,7 @@ private slots:
     void layoutChanged();
     void merge_data();
     void merge();
+    void manyRanges();
     void isRowSelected();
     void childrenDeselectionSignal();
 #if QT_CONFIG(proxymodel)
@@ -2199,6 +2200,36 @@ void tst_QItemSelectionModel::merge()
     verify(result.indexes(), init);
 }
 
+void tst_QItemSelectionModel::manyRanges()
+{
+    // stress the interval index over the committed ranges: many disjoint
+    // ranges, point queries, then a bulk deselect through the middle
+    QStandardItemModel model(10000, 2);
+    QItemSelectionModel selections(&model);
+
+    QItemSelection oddRows;
+    for (int row = 1; row < 10000; row += 2)
+        oddRows.select(model.index(row, 0), model.index(row, 1));
+    selections.select(oddRows, QItemSelectionModel::Select);
+
+    QVERIFY(selections.isSelected(model.index(4999, 0)));
+    QVERIFY(selections.isSelected(model.index(4999, 1)));
+    QVERIFY(!selections.isSelected(model.index(5000, 0)));
+    QCOMPARE(selections.selection().size(), 5000);
+
+    selections.select(QItemSelection(model.index(4000, 0), model.index(5999, 1)),
+                      QItemSelectionModel::Deselect);
+    QVERIFY(!selections.isSelected(model.index(4999, 0)));
+    QVERIFY(selections.isSelected(model.index(3999, 0)));
+    QVERIFY(selections.isSelected(model.index(6001, 0)));
+
+    selections.select(QItemSelection(model.index(0, 0), model.index(9999, 1)),
+                      QItemSelectionModel::Toggle);
+    QVERIFY(selections.isSelected(model.index(4999, 0)));
+    QVERIFY(!selections.isSelected(model.index(3999, 0)));
+    QVERIFY(selections.isSelected(model.index(5000, 0)));
+}
+
 void tst_QItemSelectionModel::isRowSelected()
 {
     QStandardItemModel model(2,2);
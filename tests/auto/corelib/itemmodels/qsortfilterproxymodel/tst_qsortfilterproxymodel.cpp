@@ -5301,6 +5301,62 @@ void tst_QSortFilterProxyModel::invalidateColumnsOrRowsFilter()
     QCOMPARE(proxy.rowFiltered, 20);
 }
 
+void tst_QSortFilterProxyModel::invalidateTargetedRowsFilter()
+{
+    class FilterProxy : public QSortFilterProxyModel
+    {
+    public:
+        bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const override
+        {
+            rowFiltered++;
+            const QString text = sourceModel()->data(sourceModel()->index(source_row, 0, source_parent)).toString();
+            return !rejected.contains(text);
+        }
+
+        mutable int rowFiltered = 0;
+        QStringList rejected;
+
+        using QSortFilterProxyModel::invalidateRowsFilter;
+    };
+    QStandardItemModel model(10, 1);
+    for (int i = 0; i < model.rowCount(); ++i)
+        model.setItem(i, 0, new QStandardItem(QString("A%1").arg(i + 1)));
+
+    FilterProxy proxy;
+    proxy.setSourceModel(&model);
+    QCOMPARE(proxy.rowCount(), 10);
+
+    // hiding a row only re-evaluates the given index
+    proxy.rejected = QStringList{ "A3" };
+    proxy.rowFiltered = 0;
+    proxy.invalidateRowsFilter(QModelIndexList{ model.index(2, 0) });
+    QCOMPARE(proxy.rowCount(), 9);
+    QCOMPARE(proxy.rowFiltered, 1);
+    QCOMPARE(proxy.index(2, 0).data().toString(), QString("A4"));
+
+    // rows not passed keep their accepted state even though the filter changed
+    proxy.rejected = QStringList{ "A3", "A5" };
+    proxy.rowFiltered = 0;
+    proxy.invalidateRowsFilter(QModelIndexList{ model.index(0, 0) });
+    QCOMPARE(proxy.rowCount(), 9);
+    QCOMPARE(proxy.rowFiltered, 1);
+
+    // showing a row again re-inserts it at its source position
+    proxy.rejected = QStringList{ "A5" };
+    proxy.rowFiltered = 0;
+    proxy.invalidateRowsFilter(QModelIndexList{ model.index(2, 0), model.index(4, 0) });
+    QCOMPARE(proxy.rowCount(), 9);
+    QCOMPARE(proxy.rowFiltered, 2);
+    QCOMPARE(proxy.index(2, 0).data().toString(), QString("A3"));
+    QCOMPARE(proxy.index(4, 0).data().toString(), QString("A6"));
+
+    // invalid and out-of-range indexes are ignored
+    proxy.rowFiltered = 0;
+    proxy.invalidateRowsFilter(QModelIndexList{ QModelIndex() });
+    QCOMPARE(proxy.rowCount(), 9);
+    QCOMPARE(proxy.rowFiltered, 0);
+}
+
 void tst_QSortFilterProxyModel::filterKeyColumnBinding()
 {
     QSortFilterProxyModel proxyModel;
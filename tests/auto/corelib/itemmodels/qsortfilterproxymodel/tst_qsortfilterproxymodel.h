@@ -141,6 +141,7 @@ private slots:
 
     void checkFilteredIndexes();
     void invalidateColumnsOrRowsFilter();
+    void invalidateTargetedRowsFilter();
 
     void filterKeyColumnBinding();
     void dynamicSortFilterBinding();
@@ -91,6 +91,7 @@ private slots:
     void noDoubleNotification();
     void groupedNotifications();
     void groupedNotificationConsistency();
+    void groupEvaluatesSharedBindingOnce();
     void bindingGroupMovingBindingData();
     void bindingGroupBindingDeleted();
     void uninstalledBindingDoesNotEvaluate();
@@ -2242,6 +2243,25 @@ void tst_QProperty::groupedNotificationConsistency()
     QVERIFY(areEqual); // value changed runs after everything has been evaluated
 }
 
+void tst_QProperty::groupEvaluatesSharedBindingOnce()
+{
+    QProperty<int> a(1);
+    QProperty<int> b(2);
+    int evaluationCounter = 0;
+    QProperty<int> sum;
+    sum.setBinding([&](){ ++evaluationCounter; return a.value() + b.value(); });
+    QCOMPARE(evaluationCounter, 1);
+
+    {
+        const QScopedPropertyUpdateGroup guard;
+        a = 10;
+        b = 20;
+    }
+    QCOMPARE(sum.value(), 30);
+    // both dependencies changed inside the group, but the binding only ran once
+    QCOMPARE(evaluationCounter, 2);
+}
+
 void tst_QProperty::bindingGroupMovingBindingData()
 {
     auto tester = std::make_unique<ClassWithNotifiedProperty>();
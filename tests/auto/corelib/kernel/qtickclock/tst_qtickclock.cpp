@@ -0,0 +1,65 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QtCore/private/qtickclock_p.h>
+
+#include <array>
+#include <chrono>
+
+using namespace std::chrono;
+using QtPrivate::QTickClock;
+
+class tst_QTickClock : public QObject
+{
+    Q_OBJECT
+private slots:
+    void monotonic();
+    void agreesWithSteadyClock();
+    void bulkTimestamps();
+};
+
+void tst_QTickClock::monotonic()
+{
+    QTickClock::time_point last = QTickClock::now();
+    for (int i = 0; i < 10000; ++i) {
+        QTickClock::time_point current = QTickClock::now();
+        QCOMPARE_GE(current, last);
+        last = current;
+    }
+}
+
+void tst_QTickClock::agreesWithSteadyClock()
+{
+    // force calibration to finish first, in case it needs a measurement window
+    QTickClock::now();
+    QTest::qSleep(20);
+
+    const auto steadyBefore = time_point_cast<nanoseconds>(steady_clock::now());
+    const auto tick = QTickClock::now();
+    const auto steadyAfter = time_point_cast<nanoseconds>(steady_clock::now());
+
+    // time points are anchored to the steady_clock epoch; allow a generous
+    // margin for calibration error and scheduling noise
+    constexpr nanoseconds margin = 100ms;
+    QCOMPARE_GE(tick, steadyBefore - margin);
+    QCOMPARE_LE(tick, steadyAfter + margin);
+}
+
+void tst_QTickClock::bulkTimestamps()
+{
+    std::array<QTickClock::time_point, 1000> points;
+    const QTickClock::time_point before = QTickClock::now();
+    QTickClock::timestamp(points);
+    const QTickClock::time_point after = QTickClock::now();
+
+    QCOMPARE_GE(points.front(), before);
+    QCOMPARE_LE(points.back(), after);
+    for (size_t i = 1; i < points.size(); ++i)
+        QCOMPARE_GE(points[i], points[i - 1]);
+}
+
+QTEST_MAIN(tst_QTickClock)
+
+#include "tst_qtickclock.moc"
@@ -13,6 +13,7 @@
 #include <sys/stat.h>
 #endif
 
+#include <QtCore/QDirListing>
 #include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -1093,6 +1094,40 @@ void tst_QMimeDatabase::fromThreads()
     QVERIFY(tp.waitForDone(60000));
 }
 
+void tst_QMimeDatabase::sniffCache()
+{
+    QMimeDatabase db;
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = dir.filePath(QStringLiteral("nosuffix"));
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("%PDF-");
+    }
+    QCOMPARE(db.mimeTypeForFile(fileName).name(), "application/pdf"_L1);
+    // the second query is served from the (device, inode, mtime)-keyed cache
+    QCOMPARE(db.mimeTypeForFile(fileName).name(), "application/pdf"_L1);
+
+    // rewriting the file changes its cache key, so the stale result must not
+    // be returned
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(QByteArrayLiteral("\x78\x9f\x3e\x22"));
+    }
+    QCOMPARE(db.mimeTypeForFile(fileName).name(), "application/vnd.ms-tnef"_L1);
+
+    // the QDirListing overload goes through the same code path
+    int seen = 0;
+    for (const auto &entry : QDirListing(dir.path(), QDirListing::IteratorFlag::FilesOnly)) {
+        QCOMPARE(db.mimeTypeForFile(entry).name(), "application/vnd.ms-tnef"_L1);
+        ++seen;
+    }
+    QCOMPARE(seen, 1);
+}
+
 #if QT_CONFIG(process)
 
 enum {
@@ -49,6 +49,7 @@ private slots:
     void filterString();
     void symlinkToFifo();
     void fromThreads();
+    void sniffCache();
 
     // shared-mime-info test suite
 
@@ -10,6 +10,8 @@
 #endif
 
 #include <qcoreapplication.h>
+#include <qdatetime.h>
+#include <qset.h>
 #include <quuid.h>
 
 class tst_QUuid : public QObject
@@ -48,6 +50,10 @@ private slots:
     void versions_data();
     void versions();
 
+    void generateV7();
+    void generateBulk();
+    void generateBulkV7();
+
     void threadUniqueness();
     void processUniqueness();
 
@@ -628,6 +634,56 @@ public:
     }
 };
 
+void tst_QUuid::generateV7()
+{
+    const qint64 before = QDateTime::currentMSecsSinceEpoch();
+    const QUuid uuid = QUuid::createUuidV7();
+    const qint64 after = QDateTime::currentMSecsSinceEpoch();
+
+    QVERIFY(!uuid.isNull());
+    QCOMPARE(uuid.variant(), QUuid::DCE);
+    QCOMPARE(uuid.version(), QUuid::UnixEpoch);
+
+    // the top 48 bits hold the creation time in milliseconds
+    const qint64 msecs = (qint64(uuid.data1) << 16) | uuid.data2;
+    QVERIFY(msecs >= before);
+    QVERIFY(msecs <= after);
+
+    // approximately time-ordered: a later UUID must sort after this one
+    QTest::qSleep(2);
+    QVERIFY(uuid < QUuid::createUuidV7());
+}
+
+void tst_QUuid::generateBulk()
+{
+    QList<QUuid> uuids(1000);
+    QUuid::createUuids(uuids);
+
+    QSet<QUuid> unique;
+    for (const QUuid &uuid : std::as_const(uuids)) {
+        QVERIFY(!uuid.isNull());
+#ifndef Q_OS_WIN
+        QCOMPARE(uuid.variant(), QUuid::DCE);
+        QCOMPARE(uuid.version(), QUuid::Random);
+#endif
+        unique.insert(uuid);
+    }
+    QCOMPARE(unique.size(), uuids.size());
+}
+
+void tst_QUuid::generateBulkV7()
+{
+    QList<QUuid> uuids(5000);
+    QUuid::createUuidsV7(uuids);
+
+    for (qsizetype i = 0; i < uuids.size(); ++i) {
+        QCOMPARE(uuids.at(i).variant(), QUuid::DCE);
+        QCOMPARE(uuids.at(i).version(), QUuid::UnixEpoch);
+        if (i > 0)
+            QVERIFY(uuids.at(i - 1) < uuids.at(i));
+    }
+}
+
 void tst_QUuid::threadUniqueness()
 {
     QList<UuidThread *> threads(qMax(2, QThread::idealThreadCount()));
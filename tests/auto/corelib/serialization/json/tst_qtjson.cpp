@@ -4,6 +4,7 @@
 
 #include <QTest>
 #include <QtTest/private/qcomparisontesthelper_p.h>
+#include <QBuffer>
 #include <QMap>
 #include <QVariantList>
 
@@ -13,7 +14,14 @@ QT_WARNING_DISABLE_DEPRECATED
 #include "qjsonobject.h"
 #include "qjsonvalue.h"
 #include "qjsondocument.h"
+#include "qcborarray.h"
+#include "qcbormap.h"
+#include "qcborstreamreader.h"
+#include "qcborstreamwriter.h"
+#include "qjsonstreamreader.h"
 #include "qregularexpression.h"
+#include "private/qjsonparser_p.h"
+#include "private/qjsonwriter_p.h"
 #include "private/qnumeric_p.h"
 #include <limits>
 
@@ -88,6 +96,12 @@ private Q_SLOTS:
     void toJsonSillyNumericValues();
     void toJsonLargeNumericValues();
     void toJsonDenormalValues();
+    void writeToDevice();
+    void transcodeCborToJson();
+    void transcodeJsonToCbor();
+    void streamReader();
+    void streamReaderIncremental();
+    void streamReaderErrors();
     void fromJson();
     void fromJsonErrors();
     void parseNumbers();
@@ -2104,6 +2118,365 @@ void tst_QtJson::toJsonDenormalValues()
     }
 }
 
+void tst_QtJson::writeToDevice()
+{
+    QJsonObject object;
+    object.insert("text", QString("plain ascii and \\ \" escapes \n plus unicode: áéíóú  "));
+    object.insert("number", 1.25);
+    QJsonArray array;
+    for (int i = 0; i < 1000; ++i)
+        array.append(QString::number(i).repeated(50));
+    object.insert("array", array);
+    QJsonDocument doc(object);
+
+    // the streamed output is byte-identical to toJson()
+    for (auto format : { QJsonDocument::Indented, QJsonDocument::Compact }) {
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(doc.writeTo(&buffer, format));
+        QCOMPARE(buffer.data(), doc.toJson(format));
+    }
+
+    {
+        QJsonDocument arrayDoc(array);
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(arrayDoc.writeTo(&buffer));
+        QCOMPARE(buffer.data(), arrayDoc.toJson());
+    }
+
+    // error cases: null document, no device, unwritable device
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(!QJsonDocument().writeTo(&buffer));
+    QVERIFY(buffer.data().isEmpty());
+    QVERIFY(!doc.writeTo(nullptr));
+    QBuffer closed;
+    QVERIFY(!doc.writeTo(&closed));
+}
+
+void tst_QtJson::transcodeCborToJson()
+{
+    // keys inserted in sorted order, so the DOM conversion (which sorts) and
+    // the transcoder (which preserves stream order) agree
+    QCborMap map;
+    map.insert(QLatin1String("array"),
+               QCborArray{1, -2, 1.25, QStringLiteral("x"), QCborValue(), true, false});
+    map.insert(QLatin1String("bytes"), QCborValue(QByteArray("raw\0data", 8)));
+    map.insert(QLatin1String("nested"), QCborMap{{QStringLiteral("k"), QStringLiteral("v")}});
+    map.insert(QLatin1String("text"), QStringLiteral("esc \" \\ \n plus unicode: áéíóú"));
+    const QByteArray cbor = QCborValue(map).toCbor();
+    const QJsonDocument dom(map.toJsonObject());
+
+    for (bool compact : { false, true }) {
+        QCborStreamReader reader(cbor);
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(QJsonPrivate::transcodeCborToJson(reader, &buffer, compact));
+        QCOMPARE(buffer.data(),
+                 dom.toJson(compact ? QJsonDocument::Compact : QJsonDocument::Indented));
+    }
+
+    // scalar documents and integers beyond the qint64 range keep exact form
+    {
+        QCborStreamReader reader("\x1b\xff\xff\xff\xff\xff\xff\xff\xff", 9);
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(QJsonPrivate::transcodeCborToJson(reader, &buffer, true));
+        QCOMPARE(buffer.data(), QByteArray("18446744073709551615"));
+    }
+
+    // indefinite-length (chunked) strings stream through
+    {
+        const QByteArray chunked = QByteArray::fromHex("7f626162626364ff"); // (_ "ab", "cd")
+        QCborStreamReader reader(chunked);
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(QJsonPrivate::transcodeCborToJson(reader, &buffer, true));
+        QCOMPARE(buffer.data(), QByteArray("\"abcd\""));
+    }
+
+    // error cases: no device, truncated input
+    {
+        QCborStreamReader reader(cbor);
+        QVERIFY(!QJsonPrivate::transcodeCborToJson(reader, nullptr));
+
+        QCborStreamReader truncated(cbor.left(cbor.size() / 2));
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QVERIFY(!QJsonPrivate::transcodeCborToJson(truncated, &buffer));
+    }
+}
+
+void tst_QtJson::transcodeJsonToCbor()
+{
+    const QByteArray json =
+            R"({"array":[1,2.5,"x",null,true,false,{"k":"v"}],"text":"esc \" \\ plus unicode: áéíóú"})";
+    QByteArray cbor;
+    {
+        QBuffer buffer(&cbor);
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QCborStreamWriter writer(&buffer);
+        QJsonParseError error;
+        QVERIFY(QJsonPrivate::transcodeJsonToCbor(json, writer, &error));
+        QCOMPARE(error.error, QJsonParseError::NoError);
+    }
+
+    // the result decodes to the same document the DOM parser produces
+    QCborParserError cborError;
+    const QCborValue decoded = QCborValue::fromCbor(cbor, &cborError);
+    QCOMPARE(cborError.error, QCborError::NoError);
+    QCOMPARE(QJsonDocument(decoded.toJsonValue().toObject()).toJson(QJsonDocument::Compact),
+             json);
+
+    // duplicated keys all pass through instead of collapsing to the last one
+    {
+        QByteArray out;
+        QBuffer buffer(&out);
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QCborStreamWriter writer(&buffer);
+        QVERIFY(QJsonPrivate::transcodeJsonToCbor(R"({"a":1,"a":2})", writer));
+        QCOMPARE(QCborValue::fromCbor(out).toMap().size(), 2);
+    }
+
+    // parse errors are reported exactly like QJsonDocument::fromJson()
+    const QByteArray bad = R"({"a":1,})";
+    QJsonParseError domError;
+    QJsonDocument::fromJson(bad, &domError);
+    {
+        QByteArray out;
+        QBuffer buffer(&out);
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        QCborStreamWriter writer(&buffer);
+        QJsonParseError error;
+        QVERIFY(!QJsonPrivate::transcodeJsonToCbor(bad, writer, &error));
+        QCOMPARE(error.error, domError.error);
+        QCOMPARE(error.offset, domError.offset);
+    }
+}
+
+void tst_QtJson::streamReader()
+{
+    const QByteArray json = R"({
+        "name": "value",
+        "int": 42,
+        "big": 9007199254740993,
+        "double": 1.25,
+        "t": true,
+        "f": false,
+        "n": null,
+        "array": [1, "two", []],
+        "empty": {}
+    })";
+
+    QJsonStreamReader reader(json);
+    QVERIFY(!reader.atEnd());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.containerDepth(), 1);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.text(), "name");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), "value");
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.text(), "int");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QVERIFY(reader.isInteger());
+    QCOMPARE(reader.toInteger(), 42);
+    QCOMPARE(reader.toDouble(), 42.0);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QVERIFY(reader.isInteger());    // exact, unlike going through double
+    QCOMPARE(reader.toInteger(), Q_INT64_C(9007199254740993));
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QVERIFY(!reader.isInteger());
+    QCOMPARE(reader.toDouble(), 1.25);
+    QCOMPARE(reader.toInteger(), 1);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.toBool(), true);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.toBool(), false);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Null);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.text(), "array");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.containerDepth(), 2);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), "two");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.containerDepth(), 1);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.containerDepth(), 0);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::NoToken);
+
+    // consecutive documents (e.g. newline-delimited JSON)
+    reader.clear();
+    reader.addData("[1]\n[2]\n");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QVERIFY(!reader.atEnd());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.toInteger(), 2);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QVERIFY(reader.atEnd());
+
+    // UTF-8 BOM and escape sequences
+    reader.clear();
+    reader.addData("\xef\xbb\xbf" R"(["\u00e4\n\"", "plain"])");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), QString::fromUtf8("\xc3\xa4\n\""));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), "plain");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QtJson::streamReaderIncremental()
+{
+    const QByteArray json =
+            R"({"key": "val\"ue", "list": [1.5, -10, true, null], "obj": {"k": "v"}})";
+
+    // parse the complete document once to get the expected token stream
+    QList<QJsonStreamReader::TokenType> expectedTokens;
+    {
+        QJsonStreamReader reader(json);
+        for (auto token = reader.readNext(); token != QJsonStreamReader::EndDocument;
+             token = reader.readNext()) {
+            QVERIFY(token != QJsonStreamReader::Invalid);
+            expectedTokens.append(token);
+        }
+    }
+    QVERIFY(expectedTokens.size() > 10);
+
+    // then feed the document byte by byte: the reader must stop with a
+    // recoverable error at each incomplete token and resume after addData()
+    for (qsizetype chunkSize : { qsizetype(1), qsizetype(3), qsizetype(7) }) {
+        QJsonStreamReader reader;
+        QList<QJsonStreamReader::TokenType> tokens;
+        qsizetype fed = 0;
+        while (tokens.size() < expectedTokens.size()) {
+            auto token = reader.readNext();
+            if (token == QJsonStreamReader::Invalid || token == QJsonStreamReader::NoToken) {
+                if (token == QJsonStreamReader::Invalid)
+                    QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+                QVERIFY(reader.atEnd());
+                QVERIFY(fed < json.size());
+                reader.addData(QByteArrayView(json).sliced(fed, qMin(chunkSize, json.size() - fed)));
+                fed += qMin(chunkSize, json.size() - fed);
+                QVERIFY(!reader.hasError());
+                continue;
+            }
+            tokens.append(token);
+            if (token == QJsonStreamReader::String || token == QJsonStreamReader::Name)
+                QVERIFY(!reader.text().isEmpty());
+        }
+        QCOMPARE(tokens, expectedTokens);
+        while (reader.readNext() != QJsonStreamReader::EndDocument) {
+            QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+            reader.addData(QByteArrayView(json).sliced(fed, qMin(chunkSize, json.size() - fed)));
+            fed += qMin(chunkSize, json.size() - fed);
+        }
+        QCOMPARE(reader.currentOffset(), json.size());
+    }
+}
+
+void tst_QtJson::streamReaderErrors()
+{
+    // a fatal error is sticky and reported via errorString()
+    {
+        QJsonStreamReader reader(R"({"a":1,})");
+        QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+        QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+        QJsonParseError domError;
+        QJsonDocument::fromJson(R"({"a":1,})", &domError);
+        QCOMPARE(reader.errorString(), domError.errorString());
+        reader.addData("}");    // more data doesn't clear a fatal error
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+        QVERIFY(reader.hasError());
+    }
+
+    // like fromJson(), the top level must be an object or an array
+    {
+        QJsonStreamReader reader("42");
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+        QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+    }
+
+    // assorted ill-formed documents
+    for (const char *bad : { "[1 2]", "[1,]", "{\"a\" 1}", "{1: 2}", "[\"\\u12\"]", "[truf]",
+                             "{\"a\": 1]", "[}" }) {
+        QJsonStreamReader reader{QByteArrayView(bad)};
+        QJsonStreamReader::TokenType token;
+        do {
+            token = reader.readNext();
+        } while (token != QJsonStreamReader::Invalid && token != QJsonStreamReader::NoToken);
+        QCOMPARE(reader.tokenType(), QJsonStreamReader::Invalid);
+        QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+        QVERIFY(!reader.errorString().isEmpty());
+    }
+
+    // truncated input is recoverable, not fatal
+    {
+        QJsonStreamReader reader(R"({"a": [tru)");
+        QJsonStreamReader::TokenType token;
+        do {
+            token = reader.readNext();
+        } while (token != QJsonStreamReader::Invalid);
+        QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+        QVERIFY(!reader.errorString().isEmpty());
+        reader.addData("e]}");
+        QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+        QCOMPARE(reader.toBool(), true);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+        QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    }
+
+    // deep nesting is rejected at the same depth as the document parser
+    {
+        QByteArray deep(1025, '[');
+        QJsonStreamReader reader(deep);
+        QJsonStreamReader::TokenType token;
+        do {
+            token = reader.readNext();
+        } while (token == QJsonStreamReader::StartArray);
+        QCOMPARE(token, QJsonStreamReader::Invalid);
+        QCOMPARE(reader.error(), QJsonStreamReader::NotWellFormedError);
+        QCOMPARE(reader.containerDepth(), 1024);
+    }
+}
+
 void tst_QtJson::fromJson()
 {
     {
@@ -24,6 +24,7 @@ private Q_SLOTS:
     void fixed();
     void strings_data();
     void strings();
+    void stringViews();
     void tags_data();
     void tags() { fixed(); }
     void emptyContainers_data();
@@ -628,6 +629,79 @@ void tst_QCborStreamReader::strings_data()
     addStringsData();
 }
 
+void tst_QCborStreamReader::stringViews()
+{
+    QFETCH_GLOBAL(bool, useDevice);
+    const char *deviceWarning = "QCborStreamReader: string views require an in-memory source";
+
+    {
+        // "Hello"
+        QByteArray data = QByteArray::fromHex("6548656c6c6f");
+        QBuffer buffer(&data);
+        QCborStreamReader reader(data);
+        if (useDevice) {
+            buffer.open(QIODevice::ReadOnly);
+            reader.setDevice(&buffer);
+        }
+        QVERIFY(reader.isString());
+        if (useDevice) {
+            QTest::ignoreMessage(QtWarningMsg, deviceWarning);
+            auto r = reader.readStringView();
+            QCOMPARE(r.status, QCborStreamReader::Error);
+            // the reader is unchanged and regular reads still work
+            QCOMPARE(reader.readAllString(), "Hello");
+        } else {
+            auto r = reader.readStringView();
+            QCOMPARE(r.status, QCborStreamReader::Ok);
+            QCOMPARE(r.data, "Hello");
+            // the view must point into the source buffer, not into a copy
+            QVERIFY(r.data.constData() >= data.constData()
+                    && r.data.constData() < data.constData() + data.size());
+            r = reader.readStringView();
+            QCOMPARE(r.status, QCborStreamReader::EndOfString);
+            QVERIFY(!reader.hasNext());
+        }
+    }
+
+    {
+        // h'6162636465'
+        QByteArray data = QByteArray::fromHex("456162636465");
+        QBuffer buffer(&data);
+        QCborStreamReader reader(data);
+        if (useDevice) {
+            buffer.open(QIODevice::ReadOnly);
+            reader.setDevice(&buffer);
+        }
+        QVERIFY(reader.isByteArray());
+        if (useDevice) {
+            QTest::ignoreMessage(QtWarningMsg, deviceWarning);
+            auto r = reader.readByteArrayView();
+            QCOMPARE(r.status, QCborStreamReader::Error);
+            QCOMPARE(reader.readAllByteArray(), "abcde");
+        } else {
+            auto r = reader.readByteArrayView();
+            QCOMPARE(r.status, QCborStreamReader::Ok);
+            QCOMPARE(r.data, "abcde");
+            r = reader.readByteArrayView();
+            QCOMPARE(r.status, QCborStreamReader::EndOfString);
+        }
+    }
+
+    if (!useDevice) {
+        // (_ "ab", "cd"): each chunk is returned as its own view
+        QByteArray data = QByteArray::fromHex("7f626162626364ff");
+        QCborStreamReader reader(data);
+        QVERIFY(reader.isString());
+        QVERIFY(!reader.isLengthKnown());
+        QByteArray full;
+        QCborStreamReader::StringResult<QByteArrayView> r;
+        while (r = reader.readStringView(), r.status == QCborStreamReader::Ok)
+            full += r.data;
+        QCOMPARE(r.status, QCborStreamReader::EndOfString);
+        QCOMPARE(full, "abcd");
+    }
+}
+
 void tst_QCborStreamReader::strings()
 {
     fixed();
@@ -203,6 +203,12 @@ private slots:
 
     void typedefQt5Compat();
 
+    void byteArrayViewStream();
+    void byteArrayViewTransaction();
+    void byteArrayAliasing();
+    void bulkReadIntegerContainers();
+    void dataStreamIndex();
+
 private:
     void writebool(QDataStream *s);
     void writeQBitArray(QDataStream *s);
@@ -3959,6 +3965,208 @@ void tst_QDataStream::typedefQt5Compat()
     }
 }
 
+void tst_QDataStream::byteArrayViewStream()
+{
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out << qint32(42) << QString("hello") << QByteArray("world");
+    }
+
+    QDataStream in{QByteArrayView(data)};
+    QVERIFY(!in.device());
+    QVERIFY(!in.atEnd());
+
+    qint32 i = 0;
+    QString s;
+    QByteArray ba;
+    in >> i >> s >> ba;
+    QCOMPARE(in.status(), QDataStream::Ok);
+    QCOMPARE(i, 42);
+    QCOMPARE(s, QString("hello"));
+    QCOMPARE(ba, QByteArray("world"));
+    QVERIFY(in.atEnd());
+
+    // reading past the end fails cleanly
+    in >> i;
+    QCOMPARE(in.status(), QDataStream::ReadPastEnd);
+    QCOMPARE(i, 0);
+}
+
+void tst_QDataStream::byteArrayViewTransaction()
+{
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out << qint32(1) << qint32(2);
+    }
+
+    QDataStream in{QByteArrayView(data)};
+    qint32 a = 0, b = 0, c = 0;
+
+    // an incomplete read rolls the stream back to the transaction start
+    in.startTransaction();
+    in >> a >> b >> c;
+    QVERIFY(!in.commitTransaction());
+    QCOMPARE(in.status(), QDataStream::ReadPastEnd);
+
+    in.resetStatus();
+    in.startTransaction();
+    in >> a >> b;
+    QVERIFY(in.commitTransaction());
+    QCOMPARE(a, 1);
+    QCOMPARE(b, 2);
+    QVERIFY(in.atEnd());
+}
+
+void tst_QDataStream::byteArrayAliasing()
+{
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        out << QByteArray("some payload");
+    }
+    const auto aliasesSource = [&data](const QByteArray &ba) {
+        return ba.constData() >= data.constData()
+                && ba.constData() < data.constData() + data.size();
+    };
+
+    {
+        // off by default: the result owns its data
+        QDataStream in{QByteArrayView(data)};
+        QVERIFY(!in.byteArrayAliasingEnabled());
+        QByteArray ba;
+        in >> ba;
+        QCOMPARE(ba, QByteArray("some payload"));
+        QVERIFY(!aliasesSource(ba));
+    }
+    {
+        QDataStream in{QByteArrayView(data)};
+        in.setByteArrayAliasingEnabled(true);
+        QVERIFY(in.byteArrayAliasingEnabled());
+        QByteArray ba;
+        in >> ba;
+        QCOMPARE(in.status(), QDataStream::Ok);
+        QCOMPARE(ba, QByteArray("some payload"));
+        QVERIFY(aliasesSource(ba));
+        QVERIFY(in.atEnd());
+    }
+    {
+        // no effect on device-backed streams
+        QDataStream in(data);
+        in.setByteArrayAliasingEnabled(true);
+        QByteArray ba;
+        in >> ba;
+        QCOMPARE(ba, QByteArray("some payload"));
+        QVERIFY(!aliasesSource(ba));
+    }
+}
+
+void tst_QDataStream::bulkReadIntegerContainers()
+{
+    const QList<qint32> ints = {0, -1, 42, std::numeric_limits<qint32>::max(),
+                                std::numeric_limits<qint32>::min()};
+    const QList<quint64> bigints = {0, 1, Q_UINT64_C(0x0123456789abcdef),
+                                    std::numeric_limits<quint64>::max()};
+    const QList<qint8> bytes = {0, -128, 127, 5};
+
+    for (auto order : {QDataStream::BigEndian, QDataStream::LittleEndian}) {
+        QByteArray data;
+        {
+            QDataStream out(&data, QIODevice::WriteOnly);
+            out.setByteOrder(order);
+            out << ints << bigints << bytes;
+        }
+
+        QDataStream in(data);
+        in.setByteOrder(order);
+        QList<qint32> rInts;
+        QList<quint64> rBigints;
+        QList<qint8> rBytes;
+        in >> rInts >> rBigints >> rBytes;
+        QCOMPARE(in.status(), QDataStream::Ok);
+        QCOMPARE(rInts, ints);
+        QCOMPARE(rBigints, bigints);
+        QCOMPARE(rBytes, bytes);
+
+        // a truncated stream leaves an empty container and an error status
+        QDataStream truncated(data.left(data.size() - 1));
+        truncated.setByteOrder(order);
+        truncated >> rInts >> rBigints >> rBytes;
+        QCOMPARE(truncated.status(), QDataStream::ReadPastEnd);
+        QVERIFY(rBytes.isEmpty());
+    }
+}
+
+void tst_QDataStream::dataStreamIndex()
+{
+    const QStringList entries = {QStringLiteral("first"), QStringLiteral("second"),
+                                 QString(500, u'x'), QStringLiteral("last")};
+
+    QByteArray data;
+    {
+        QDataStream out(&data, QIODevice::WriteOnly);
+        QDataStreamIndex index;
+        QCOMPARE(index.count(), 0);
+        for (const QString &entry : entries) {
+            index.recordEntry(out);
+            out << entry;
+        }
+        QCOMPARE(index.count(), entries.size());
+        QVERIFY(index.write(out));
+    }
+
+    // random access: read the entries out of order, skipping the big one
+    {
+        QDataStream in(data);
+        QDataStreamIndex index;
+        QVERIFY(index.read(in));
+        QCOMPARE(index.count(), entries.size());
+        QCOMPARE(index.offset(0), 0);
+        QCOMPARE(index.offset(-1), -1);
+        QCOMPARE(index.offset(entries.size()), -1);
+
+        QString entry;
+        for (qsizetype i : {3, 0, 1}) {
+            QVERIFY(index.seekToEntry(in, i));
+            in >> entry;
+            QCOMPARE(in.status(), QDataStream::Ok);
+            QCOMPARE(entry, entries.at(i));
+        }
+        QVERIFY(!index.seekToEntry(in, entries.size()));
+    }
+
+    // an unindexed stream is rejected and leaves the index empty
+    {
+        QByteArray plain;
+        QDataStream out(&plain, QIODevice::WriteOnly);
+        out << entries;
+        QDataStream in(plain);
+        QDataStreamIndex index;
+        QVERIFY(!index.read(in));
+        QCOMPARE(index.count(), 0);
+    }
+
+    // so is a truncated index
+    {
+        QDataStream in(QByteArray(data.constData(), data.size() - 1));
+        QDataStreamIndex index;
+        QVERIFY(!index.read(in));
+        QCOMPARE(index.count(), 0);
+    }
+
+    // an index written to an empty snapshot round-trips
+    {
+        QByteArray empty;
+        QDataStream out(&empty, QIODevice::WriteOnly);
+        QDataStreamIndex index;
+        QVERIFY(index.write(out));
+        QDataStream in(empty);
+        QVERIFY(index.read(in));
+        QCOMPARE(index.count(), 0);
+    }
+}
+
 QTEST_MAIN(tst_QDataStream)
 
 #include "tst_qdatastream.moc"
@@ -23,6 +23,8 @@ private Q_SLOTS:
     void compare();
 
     void state();
+    void cached();
+    void sortKeys();
 };
 
 static bool dpointer_is_null(QCollator &c)
@@ -349,6 +351,46 @@ void tst_QCollator::state()
     QCOMPARE(c.locale(), QLocale(QLocale::NorwegianBokmal));
 }
 
+void tst_QCollator::cached()
+{
+    QCollator c = QCollator::cached(QLocale(QLocale::German));
+    QCOMPARE(c.locale(), QLocale(QLocale::German));
+    QCOMPARE(c.caseSensitivity(), Qt::CaseSensitive);
+    QVERIFY(c.compare(QString("a"), QString("b")) < 0);
+
+    QCollator ci = QCollator::cached(QLocale(QLocale::German), Qt::CaseInsensitive, true, true);
+    QCOMPARE(ci.caseSensitivity(), Qt::CaseInsensitive);
+    QCOMPARE(ci.numericMode(), true);
+    QCOMPARE(ci.ignorePunctuation(), true);
+
+    // modifying a copy must not affect the cached instance
+    QCollator modified = QCollator::cached(QLocale(QLocale::German));
+    modified.setNumericMode(true);
+    QCOMPARE(QCollator::cached(QLocale(QLocale::German)).numericMode(), false);
+}
+
+void tst_QCollator::sortKeys()
+{
+#if defined(Q_OS_DARWIN) && !QT_CONFIG(icu)
+    QSKIP("Sort keys are not supported with the C locale on Darwin");
+#endif
+    auto asSign = [](int compared) {
+        return compared < 0 ? -1 : compared > 0 ? 1 : 0;
+    };
+    QCollator collator((QLocale()));
+    const QString strings[] = {
+        QString("bravo"), QString("alpha"), QString("charlie"), QString(),
+    };
+    const QList<QCollatorSortKey> keys = collator.sortKeys(strings);
+    QCOMPARE(keys.size(), qsizetype(std::size(strings)));
+    for (size_t i = 0; i < std::size(strings); ++i) {
+        for (size_t j = 0; j < std::size(strings); ++j) {
+            QCOMPARE(asSign(keys.at(i).compare(keys.at(j))),
+                     asSign(collator.sortKey(strings[i]).compare(collator.sortKey(strings[j]))));
+        }
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_QCollator)
 
 #include "tst_qcollator.moc"
@@ -65,6 +65,7 @@ private slots:
     void doubleToString();
     void strtod_data();
     void strtod();
+    void bulkStrtod();
     void long_long_conversion_data();
     void long_long_conversion();
     void long_long_conversion_extra();
@@ -1520,6 +1521,47 @@ void tst_QLocale::strtod()
     QCOMPARE(actualOk, ok);
 }
 
+void tst_QLocale::bulkStrtod()
+{
+    double results[8];
+    qsizetype consumed = 0;
+
+    // a plain comma-separated column
+    QByteArrayView column = "1.5,-2,1e3, 0.25 ,inf";
+    QCOMPARE(qt_asciiToDoubles(column.data(), column.size(), ',', results, 8, &consumed), 5);
+    QCOMPARE(consumed, column.size());
+    QCOMPARE(results[0], 1.5);
+    QCOMPARE(results[1], -2.0);
+    QCOMPARE(results[2], 1000.0);
+    QCOMPARE(results[3], 0.25);
+    QCOMPARE(results[4], qInf());
+
+    // stops at the first malformed field, reporting how far it got
+    column = "1,2,x,4";
+    QCOMPARE(qt_asciiToDoubles(column.data(), column.size(), ',', results, 8, &consumed), 2);
+    QCOMPARE(consumed, 4);
+    QCOMPARE(results[0], 1.0);
+    QCOMPARE(results[1], 2.0);
+
+    // ... and at an empty field
+    column = "1,,2";
+    QCOMPARE(qt_asciiToDoubles(column.data(), column.size(), ',', results, 8, &consumed), 1);
+    QCOMPARE(consumed, 2);
+
+    // respects maxCount, so the caller can continue from *consumed
+    column = "1 2 3 4";
+    QCOMPARE(qt_asciiToDoubles(column.data(), column.size(), ' ', results, 2, &consumed), 2);
+    QCOMPARE(consumed, 4);
+    QCOMPARE(qt_asciiToDoubles(column.data() + consumed, column.size() - consumed, ' ',
+                               results + 2, 2),
+             2);
+    QCOMPARE(results[2], 3.0);
+    QCOMPARE(results[3], 4.0);
+
+    QCOMPARE(qt_asciiToDoubles(nullptr, 0, ',', results, 8, &consumed), 0);
+    QCOMPARE(consumed, 0);
+}
+
 void tst_QLocale::long_long_conversion_data()
 {
     QTest::addColumn<QString>("locale_name");
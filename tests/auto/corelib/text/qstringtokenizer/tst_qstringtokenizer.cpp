@@ -18,6 +18,8 @@ private Q_SLOTS:
     void constExpr() const;
     void basics_data() const;
     void basics() const;
+    void anyOf() const;
+    void whitespace() const;
     void toContainer() const;
 };
 
@@ -107,6 +109,92 @@ void tst_QStringTokenizer::basics() const
     }
 }
 
+void tst_QStringTokenizer::anyOf() const
+{
+    // basic multi-separator splitting:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"a,b;c|d", u",;|")),
+             QStringList({"a", "b", "c", "d"}));
+
+    // each separator matches a single code unit:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"a,;b", u",;")),
+             QStringList({"a", "", "b"}));
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"a,;b", u",;", Qt::SkipEmptyParts)),
+             QStringList({"a", "b"}));
+
+    // leading/trailing separators:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u";a,", u",;")),
+             QStringList({"", "a", ""}));
+
+    // no separator occurs:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"abc", u",;")),
+             QStringList({"abc"}));
+
+    // empty separator set:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"a,b", u"")),
+             QStringList({"a,b"}));
+
+    // empty haystack:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"", u",;")),
+             QStringList({""}));
+
+    // case-insensitive separators:
+    QCOMPARE(toQStringList(qTokenizeAnyOf(u"aXbxc", u"x", Qt::CaseInsensitive)),
+             QStringList({"a", "b", "c"}));
+
+    // Latin-1 haystacks produce Latin-1 tokens:
+    {
+        QStringList result;
+        qTokenizeAnyOf(QLatin1String{"a,b;c"}, u",;").toContainer(result);
+        QCOMPARE(result, QStringList({"a", "b", "c"}));
+    }
+
+    // long haystack (> one SIMD chunk), separators in every position:
+    QString line;
+    QStringList words;
+    for (int i = 0; i < 100; ++i) {
+        line += (i % 2 ? u';' : u',');
+        line += QString::number(i);
+        words.push_back(QString::number(i));
+    }
+    QCOMPARE(toQStringList(qTokenizeAnyOf(line, u",;", Qt::SkipEmptyParts)), words);
+
+    // rvalue haystacks are pinned, like with qTokenize():
+    {
+        auto tok = qTokenizeAnyOf(words.join(u','), u",;");
+        QCOMPARE(toQStringList(tok), words);
+    }
+}
+
+void tst_QStringTokenizer::whitespace() const
+{
+    // skips runs of whitespace by default:
+    QCOMPARE(toQStringList(qTokenizeWhitespace(u" the\tquick\r\nbrown  fox ")),
+             QStringList({"the", "quick", "brown", "fox"}));
+
+    // explicit Qt::KeepEmptyParts:
+    QCOMPARE(toQStringList(qTokenizeWhitespace(u"a  b", Qt::KeepEmptyParts)),
+             QStringList({"a", "", "b"}));
+
+    // non-ASCII space characters (NBSP, EM SPACE, IDEOGRAPHIC SPACE):
+    QCOMPARE(toQStringList(qTokenizeWhitespace(u"a b c　d")),
+             QStringList({"a", "b", "c", "d"}));
+
+    // no whitespace at all:
+    QCOMPARE(toQStringList(qTokenizeWhitespace(u"abc")),
+             QStringList({"abc"}));
+
+    // all whitespace:
+    QCOMPARE(toQStringList(qTokenizeWhitespace(u" \t\r\n")),
+             QStringList());
+
+    // Latin-1 haystack:
+    {
+        QStringList result;
+        qTokenizeWhitespace(QLatin1String{"a b\tc"}).toContainer(result);
+        QCOMPARE(result, QStringList({"a", "b", "c"}));
+    }
+}
+
 void tst_QStringTokenizer::toContainer() const
 {
     // QStringView value_type:
@@ -45,6 +45,9 @@ private slots:
     void assignmentOperator();
     void isAtSoftHyphen_data();
     void isAtSoftHyphen();
+    void longAsciiText();
+    void recalculate_data();
+    void recalculate();
 };
 
 
@@ -857,5 +860,83 @@ void tst_QTextBoundaryFinder::isAtSoftHyphen()
     doTestData(testString, expectedSoftHyphenPositions, QTextBoundaryFinder::Line, QTextBoundaryFinder::SoftHyphen);
 }
 
+void tst_QTextBoundaryFinder::longAsciiText()
+{
+    // exercises the vectorized ASCII paths of the grapheme and word passes;
+    // long enough for whole 16-character blocks, with CR/LF and non-ASCII
+    // characters placed to force transitions in and out of the fast path
+    QString testString;
+    for (int i = 0; i < 20; ++i)
+        testString += QLatin1String("abcdefghijklmnopqrstuvwxyz0123456789 ");
+    testString.insert(100, QString::fromUtf8("caf\xc3\xa9"));
+    testString.insert(300, QLatin1String("\r\nnext line\n"));
+
+    {
+        QTextBoundaryFinder finder(QTextBoundaryFinder::Grapheme, testString);
+        for (qsizetype i = 0; i <= testString.size(); ++i) {
+            finder.setPosition(i);
+            // every position is a grapheme boundary here, except inside CRLF
+            const bool insideCrLf = i > 0 && testString.at(i - 1) == QLatin1Char('\r')
+                                 && i < testString.size() && testString.at(i) == QLatin1Char('\n');
+            QCOMPARE(finder.isAtBoundary(), !insideCrLf);
+        }
+    }
+
+    {
+        QTextBoundaryFinder finder(QTextBoundaryFinder::Word, testString);
+        for (qsizetype i = 0; i <= testString.size(); ++i) {
+            finder.setPosition(i);
+            // word boundaries everywhere except inside alphanumeric runs and CRLF
+            const bool prevAlnum = i > 0 && testString.at(i - 1).isLetterOrNumber();
+            const bool nextAlnum = i < testString.size() && testString.at(i).isLetterOrNumber();
+            const bool insideCrLf = i > 0 && testString.at(i - 1) == QLatin1Char('\r')
+                                 && i < testString.size() && testString.at(i) == QLatin1Char('\n');
+            QCOMPARE(finder.isAtBoundary(), !(prevAlnum && nextAlnum) && !insideCrLf);
+        }
+    }
+}
+
+void tst_QTextBoundaryFinder::recalculate_data()
+{
+    QTest::addColumn<int>("type");
+
+    QTest::newRow("grapheme") << int(QTextBoundaryFinder::Grapheme);
+    QTest::newRow("word") << int(QTextBoundaryFinder::Word);
+    QTest::newRow("sentence") << int(QTextBoundaryFinder::Sentence);
+    QTest::newRow("line") << int(QTextBoundaryFinder::Line);
+}
+
+void tst_QTextBoundaryFinder::recalculate()
+{
+    QFETCH(int, type);
+    const QTextBoundaryFinder::BoundaryType t = QTextBoundaryFinder::BoundaryType(type);
+
+    // lines end in a letter so that recalculate() can anchor the rework to
+    // the enclosing paragraph instead of reanalyzing the whole string
+    QString text = QLatin1String("First line of text\n"
+                                 "The second line, which we will edit. It has two sentences\n"
+                                 "And a third line to keep unchanged\n");
+
+    QTextBoundaryFinder finder(t, text.constData(), text.size());
+
+    // edit the buffer in place: replace "will edit" with "did chop."
+    const qsizetype editPos = text.indexOf(QLatin1String("will edit"));
+    QVERIFY(editPos > 0);
+    const QString replacement = QLatin1String("did chop.");
+    std::copy(replacement.constData(), replacement.constData() + replacement.size(),
+              const_cast<QChar *>(text.constData()) + editPos);
+    finder.recalculate(editPos, editPos + replacement.size());
+
+    // the updated finder must agree with a from-scratch analysis everywhere
+    QTextBoundaryFinder reference(t, text.constData(), text.size());
+    for (qsizetype i = 0; i <= text.size(); ++i) {
+        finder.setPosition(i);
+        reference.setPosition(i);
+        QVERIFY2(finder.isAtBoundary() == reference.isAtBoundary(),
+                 qPrintable(QString::number(i)));
+        QCOMPARE(finder.boundaryReasons(), reference.boundaryReasons());
+    }
+}
+
 QTEST_MAIN(tst_QTextBoundaryFinder)
 #include "tst_qtextboundaryfinder.moc"
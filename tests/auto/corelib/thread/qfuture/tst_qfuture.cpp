@@ -252,6 +252,13 @@ private slots:
 
     void unwrap();
 
+#if defined(__cpp_impl_coroutine) && !defined(QT_NO_EXCEPTIONS)
+    void awaitReady();
+    void awaitPending();
+    void awaitExceptionAndCancel();
+    void awaitWithContext();
+#endif
+
 private:
     using size_type = std::vector<int>::size_type;
 
@@ -5367,5 +5374,102 @@ void tst_QFuture::unwrap()
     }
 }
 
+#if defined(__cpp_impl_coroutine) && !defined(QT_NO_EXCEPTIONS)
+
+// A minimal eager, detached coroutine type; the test coroutines report their
+// progress through captured references.
+struct TestCoroutine
+{
+    struct promise_type
+    {
+        TestCoroutine get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { }
+        void unhandled_exception() { QTest::qFail("unhandled exception", __FILE__, __LINE__); }
+    };
+};
+
+void tst_QFuture::awaitReady()
+{
+    int value = 0;
+    bool done = false;
+    [&]() -> TestCoroutine {
+        value = co_await QtFuture::makeReadyValueFuture(42);
+        co_await QtFuture::makeReadyVoidFuture();
+        done = true;
+    }();
+    // both futures were finished, so the coroutine never suspended
+    QCOMPARE(value, 42);
+    QVERIFY(done);
+}
+
+void tst_QFuture::awaitPending()
+{
+    QPromise<int> promise;
+    int value = 0;
+    [&]() -> TestCoroutine {
+        value = co_await promise.future();
+    }(); // suspends on the unfinished future
+
+    QCOMPARE(value, 0);
+    promise.start();
+    promise.addResult(7);
+    promise.finish(); // resumes the coroutine
+    QCOMPARE(value, 7);
+}
+
+void tst_QFuture::awaitExceptionAndCancel()
+{
+    // a stored exception is rethrown from co_await
+    {
+        QPromise<int> promise;
+        bool caught = false;
+        [&]() -> TestCoroutine {
+            try {
+                co_await promise.future();
+            } catch (const QException &) {
+                caught = true;
+            }
+        }();
+        promise.start();
+        promise.setException(QException());
+        promise.finish();
+        QVERIFY(caught);
+    }
+
+    // cancellation resumes the coroutine and throws CanceledException
+    {
+        QPromise<int> promise;
+        bool caught = false;
+        [&]() -> TestCoroutine {
+            try {
+                co_await promise.future();
+            } catch (const QtFuture::CanceledException &) {
+                caught = true;
+            }
+        }();
+        promise.start();
+        promise.future().cancel();
+        promise.finish();
+        QVERIFY(caught);
+    }
+}
+
+void tst_QFuture::awaitWithContext()
+{
+    // with a context object the coroutine resumes through the context
+    // thread's event loop, even for an already finished future
+    QObject context;
+    int value = 0;
+    [&]() -> TestCoroutine {
+        value = co_await QtFuture::await(QtFuture::makeReadyValueFuture(5), &context);
+    }();
+    QCOMPARE(value, 0);
+    QTRY_COMPARE(value, 5);
+}
+
+#endif // __cpp_impl_coroutine && !QT_NO_EXCEPTIONS
+
 QTEST_MAIN(tst_QFuture)
 #include "tst_qfuture.moc"
@@ -0,0 +1,107 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QThread>
+
+#include <private/qlatch_p.h>
+
+#include <memory>
+#include <vector>
+
+class tst_QLatch : public QObject
+{
+    Q_OBJECT
+private slots:
+    void countDown();
+    void waitForWorkers();
+    void forkJoin();
+    void reusableBarrier();
+};
+
+void tst_QLatch::countDown()
+{
+    QLatch latch(2);
+    QVERIFY(!latch.tryWait());
+    latch.countDown();
+    QVERIFY(!latch.tryWait());
+    latch.countDown();
+    QVERIFY(latch.tryWait());
+    latch.wait(); // does not block once the count reached zero
+}
+
+void tst_QLatch::waitForWorkers()
+{
+    const int workerCount = 4;
+    QLatch latch(workerCount);
+    QAtomicInt completed;
+
+    std::vector<std::unique_ptr<QThread>> workers;
+    for (int i = 0; i < workerCount; ++i) {
+        workers.emplace_back(QThread::create([&] {
+            completed.ref();
+            latch.countDown();
+        }));
+        workers.back()->start();
+    }
+
+    latch.wait();
+    QCOMPARE(completed.loadRelaxed(), workerCount);
+    for (const auto &worker : workers)
+        QVERIFY(worker->wait());
+}
+
+void tst_QLatch::forkJoin()
+{
+    const int threadCount = 4;
+    QLatch latch(threadCount);
+    QAtomicInt joined;
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < threadCount - 1; ++i) {
+        threads.emplace_back(QThread::create([&] {
+            latch.arriveAndWait();
+            joined.ref();
+        }));
+        threads.back()->start();
+    }
+
+    latch.arriveAndWait(); // only returns once all participants arrived
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait());
+    QCOMPARE(joined.loadRelaxed(), threadCount - 1);
+}
+
+void tst_QLatch::reusableBarrier()
+{
+    const int threadCount = 4;
+    const int phases = 100;
+    QBarrier barrier(threadCount);
+    QAtomicInt arrived;
+    QAtomicInt errors;
+
+    const auto body = [&] {
+        for (int phase = 0; phase < phases; ++phase) {
+            arrived.ref();
+            barrier.arriveAndWait();
+            // after the barrier, every participant of this phase has arrived
+            if (arrived.loadAcquire() < (phase + 1) * threadCount)
+                errors.ref();
+        }
+    };
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int i = 0; i < threadCount - 1; ++i) {
+        threads.emplace_back(QThread::create(body));
+        threads.back()->start();
+    }
+    body();
+
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait());
+    QCOMPARE(errors.loadRelaxed(), 0);
+    QCOMPARE(arrived.loadRelaxed(), phases * threadCount);
+}
+
+QTEST_MAIN(tst_QLatch)
+#include "tst_qlatch.moc"
@@ -11,9 +11,13 @@
 #include <qmutex.h>
 #include <qthread.h>
 #include <qvarlengtharray.h>
+#include <qscopeguard.h>
 #include <qwaitcondition.h>
+#include <private/qlockstats_p.h>
 #include <private/qvolatile_p.h>
 
+#include <memory>
+
 using namespace std::chrono_literals;
 
 class tst_QMutex : public QObject
@@ -42,6 +46,7 @@ private slots:
     void tryLockNegative_data();
     void tryLockNegative();
     void moreStress();
+    void contentionStatistics();
 };
 
 static const int iterations = 100;
@@ -1191,6 +1196,73 @@ void tst_QMutex::moreStress()
     QCOMPARE(MoreStressTestThread::errorCount.loadRelaxed(), 0);
 }
 
+static QtLockStats::LockSnapshot snapshotFor(const void *lock)
+{
+    const auto snapshots = QtLockStats::snapshot();
+    for (const auto &snapshot : snapshots) {
+        if (snapshot.lock == lock)
+            return snapshot;
+    }
+    return { nullptr, QByteArray(), 0, 0, 0 };
+}
+
+void tst_QMutex::contentionStatistics()
+{
+    QMutex mutex;
+    QtLockStats::registerLock(&mutex, "tst_QMutex::contentionStatistics");
+    auto guard = qScopeGuard([&] { QtLockStats::unregisterLock(&mutex); });
+
+    // no contention yet
+    mutex.lock();
+    mutex.unlock();
+    QtLockStats::LockSnapshot snapshot = snapshotFor(&mutex);
+    QCOMPARE(snapshot.lock, &mutex);
+    QCOMPARE(snapshot.name, "tst_QMutex::contentionStatistics");
+    QCOMPARE(snapshot.contendedAcquisitions, quint64(0));
+    QCOMPARE(snapshot.totalWaitNsecs, quint64(0));
+    QCOMPARE(snapshot.waiterHighWaterMark, 0);
+
+    // force one thread to block on the mutex
+    mutex.lock();
+    QSemaphore aboutToLock;
+    std::unique_ptr<QThread> thread(QThread::create([&] {
+        aboutToLock.release();
+        mutex.lock();
+        mutex.unlock();
+    }));
+    thread->start();
+    aboutToLock.acquire();
+    QTest::qSleep(waitTime); // give the thread time to reach the slow path
+    mutex.unlock();
+    QVERIFY(thread->wait());
+
+    snapshot = snapshotFor(&mutex);
+    QCOMPARE(snapshot.contendedAcquisitions, quint64(1));
+    QVERIFY(snapshot.totalWaitNsecs > 0);
+    QCOMPARE(snapshot.waiterHighWaterMark, 1);
+
+    QtLockStats::resetStatistics();
+    snapshot = snapshotFor(&mutex);
+    QCOMPARE(snapshot.contendedAcquisitions, quint64(0));
+    QCOMPARE(snapshot.totalWaitNsecs, quint64(0));
+    QCOMPARE(snapshot.waiterHighWaterMark, 0);
+
+    QtLockStats::unregisterLock(&mutex);
+    guard.dismiss();
+    QCOMPARE(snapshotFor(&mutex).lock, nullptr);
+
+    // an unregistered lock is not recorded, even under contention
+    mutex.lock();
+    std::unique_ptr<QThread> uninstrumented(QThread::create([&] {
+        mutex.lock();
+        mutex.unlock();
+    }));
+    uninstrumented->start();
+    QTest::qSleep(waitTime);
+    mutex.unlock();
+    QVERIFY(uninstrumented->wait());
+    QCOMPARE(snapshotFor(&mutex).lock, nullptr);
+}
 
 QTEST_MAIN(tst_QMutex)
 #include "tst_qmutex.moc"
@@ -0,0 +1,110 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QThread>
+
+#include <private/qreadmostlypointer_p.h>
+
+#include <memory>
+#include <vector>
+
+class tst_QReadMostlyPointer : public QObject
+{
+    Q_OBJECT
+private slots:
+    void readAndReplace();
+    void deferredReclamation();
+    void concurrentReaders();
+};
+
+struct Counted
+{
+    explicit Counted(int v) : value(v) { ++instances; }
+    ~Counted() { --instances; }
+    int value;
+    static QAtomicInt instances;
+};
+QAtomicInt Counted::instances;
+
+void tst_QReadMostlyPointer::readAndReplace()
+{
+    QReadMostlyPointer<Counted> pointer(new Counted(1));
+    {
+        auto guard = pointer.read();
+        QVERIFY(guard);
+        QCOMPARE(guard->value, 1);
+        QCOMPARE((*guard).value, 1);
+    }
+
+    pointer.replace(new Counted(2));
+    pointer.reclaim();
+    {
+        auto guard = pointer.read();
+        QCOMPARE(guard->value, 2);
+    }
+}
+
+void tst_QReadMostlyPointer::deferredReclamation()
+{
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+    {
+        QReadMostlyPointer<Counted> pointer(new Counted(1));
+        {
+            auto guard = pointer.read();
+            pointer.replace(new Counted(2));
+            // the old value is pinned by the guard, so it must survive
+            QCOMPARE(Counted::instances.loadRelaxed(), 2);
+            QCOMPARE(guard->value, 1);
+        }
+        // with the guard gone, reclaim() may delete the retired value
+        pointer.reclaim();
+        QCOMPARE(Counted::instances.loadRelaxed(), 1);
+    }
+    // the destructor deletes the current value
+    QCOMPARE(Counted::instances.loadRelaxed(), 0);
+}
+
+void tst_QReadMostlyPointer::concurrentReaders()
+{
+    // The writer only publishes values for which value == -check; a reader
+    // seeing a reclaimed-too-early (and rewritten) object would likely see
+    // the invariant violated.
+    struct Checked
+    {
+        int value;
+        int check;
+    };
+
+    QReadMostlyPointer<Checked> pointer(new Checked{ 0, 0 });
+    QAtomicInt stop;
+    QAtomicInt errors;
+
+    const int readerCount = qMax(QThread::idealThreadCount() - 1, 1);
+    std::vector<std::unique_ptr<QThread>> readers;
+    for (int i = 0; i < readerCount; ++i) {
+        readers.emplace_back(QThread::create([&] {
+            while (!stop.loadAcquire()) {
+                auto guard = pointer.read();
+                if (guard->check != -guard->value)
+                    errors.ref();
+            }
+        }));
+        readers.back()->start();
+    }
+
+    const int writes = 10000;
+    for (int i = 1; i <= writes; ++i)
+        pointer.replace(new Checked{ i, -i });
+
+    stop.storeRelease(1);
+    for (const auto &reader : readers)
+        QVERIFY(reader->wait());
+
+    QCOMPARE(errors.loadRelaxed(), 0);
+    auto guard = pointer.read();
+    QCOMPARE(guard->value, writes);
+}
+
+QTEST_MAIN(tst_QReadMostlyPointer)
+#include "tst_qreadmostlypointer.moc"
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QThread>
+
+#include <private/qseqlock_p.h>
+
+#include <memory>
+#include <vector>
+
+class tst_QSeqLock : public QObject
+{
+    Q_OBJECT
+private slots:
+    void loadStore();
+    void concurrentReaders();
+};
+
+struct Pair
+{
+    int first;
+    int second;
+};
+
+void tst_QSeqLock::loadStore()
+{
+    QSeqLock<Pair> lock({ 1, 2 });
+    Pair value = lock.loadAcquire();
+    QCOMPARE(value.first, 1);
+    QCOMPARE(value.second, 2);
+
+    lock.storeRelease({ 3, 4 });
+    value = lock.loadAcquire();
+    QCOMPARE(value.first, 3);
+    QCOMPARE(value.second, 4);
+}
+
+void tst_QSeqLock::concurrentReaders()
+{
+    // The writer keeps the invariant value.second == -value.first; a reader
+    // observing a torn copy would see it violated.
+    QSeqLock<Pair> lock({ 0, 0 });
+    QAtomicInt stop;
+
+    const int readerCount = qMax(QThread::idealThreadCount() - 1, 1);
+    QAtomicInt errors;
+    std::vector<std::unique_ptr<QThread>> readers;
+    for (int i = 0; i < readerCount; ++i) {
+        readers.emplace_back(QThread::create([&] {
+            while (!stop.loadAcquire()) {
+                const Pair value = lock.loadAcquire();
+                if (value.second != -value.first)
+                    errors.ref();
+            }
+        }));
+        readers.back()->start();
+    }
+
+    const int writes = 100000;
+    for (int i = 1; i <= writes; ++i)
+        lock.storeRelease({ i, -i });
+
+    stop.storeRelease(1);
+    for (const auto &reader : readers)
+        QVERIFY(reader->wait());
+
+    QCOMPARE(errors.loadRelaxed(), 0);
+    const Pair value = lock.loadAcquire();
+    QCOMPARE(value.first, writes);
+    QCOMPARE(value.second, -writes);
+}
+
+QTEST_MAIN(tst_QSeqLock)
+#include "tst_qseqlock.moc"
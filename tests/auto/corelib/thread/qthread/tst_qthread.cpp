@@ -24,6 +24,7 @@
 
 #ifdef Q_OS_UNIX
 #include <pthread.h>
+#include <sched.h>
 #endif
 #if defined(Q_OS_WIN)
 #include <qt_windows.h>
@@ -36,6 +37,8 @@
 #include <exception>
 #endif
 
+#include <memory>
+
 #include <QtTest/private/qemulationdetector_p.h>
 
 using namespace std::chrono_literals;
@@ -50,6 +53,7 @@ private slots:
     void isFinished();
     void isRunning();
     void setPriority();
+    void setCpuAffinity();
     void setStackSize();
     void exit();
     void start();
@@ -404,6 +408,58 @@ void tst_QThread::setPriority()
     QCOMPARE(thread.priority(), QThread::InheritPriority);
 }
 
+// returns the number of processors the current thread may run on, or -1 if
+// we have no way of asking the operating system
+static int currentThreadAffinityCount()
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+        return CPU_COUNT(&set);
+#endif
+    return -1;
+}
+
+void tst_QThread::setCpuAffinity()
+{
+#if (defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)) || defined(Q_OS_WIN)
+    constexpr bool affinitySupported = true;
+#else
+    constexpr bool affinitySupported = false;
+#endif
+
+    QSemaphore pinnedRecorded, mayFinish;
+    QAtomicInt pinnedCpuCount = -1;
+    QAtomicInt resetCpuCount = -1;
+
+    std::unique_ptr<QThread> thread(QThread::create([&] {
+        pinnedCpuCount.storeRelaxed(currentThreadAffinityCount());
+        pinnedRecorded.release();
+        mayFinish.acquire();
+        resetCpuCount.storeRelaxed(currentThreadAffinityCount());
+    }));
+
+    // an affinity set before start() is applied when the thread starts
+    QCOMPARE(thread->setCpuAffinity({ 0 }), affinitySupported);
+    QCOMPARE(thread->cpuAffinity(), QList<int>{ 0 });
+
+    thread->start();
+    pinnedRecorded.acquire();
+
+    // an empty list lifts the restriction on the running thread
+    QCOMPARE(thread->setCpuAffinity({}), affinitySupported);
+    QVERIFY(thread->cpuAffinity().isEmpty());
+    mayFinish.release();
+    QVERIFY(thread->wait(five_minutes));
+
+    if (pinnedCpuCount.loadRelaxed() != -1) {
+        // the OS could tell us the affinity, so verify it took effect
+        QCOMPARE(pinnedCpuCount.loadRelaxed(), 1);
+        QCOMPARE_GE(resetCpuCount.loadRelaxed(), QThread::idealThreadCount());
+    }
+}
+
 void tst_QThread::setStackSize()
 {
     Simple_Thread thread;
@@ -12,6 +12,7 @@
 #include <qmutex.h>
 
 #ifdef Q_OS_UNIX
+#include <sched.h>
 #include <unistd.h>
 #endif
 
@@ -55,6 +56,7 @@ private slots:
     void destruction();
     void threadRecycling();
     void threadPriority();
+    void workerCpuAffinity();
     void expiryTimeout();
     void expiryTimeoutRace();
 #ifndef QT_NO_EXCEPTIONS
@@ -359,6 +361,33 @@ void tst_QThreadPool::threadPriority()
     QCOMPARE(thread->priority(), priority);
 }
 
+/*
+    Test that a worker started by the pool is pinned to a processor from the
+    configured affinity list.
+*/
+void tst_QThreadPool::workerCpuAffinity()
+{
+    QThreadPool pool;
+    QVERIFY(pool.workerCpuAffinity().isEmpty());
+    pool.setWorkerCpuAffinity({ 0 });
+    QCOMPARE(pool.workerCpuAffinity(), QList<int>{ 0 });
+
+    QAtomicInt observedCpuCount = -1;
+    pool.start([&] {
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0)
+            observedCpuCount.storeRelaxed(CPU_COUNT(&set));
+#endif
+    });
+    QVERIFY(pool.waitForDone());
+
+    // only checkable where the OS can report the affinity back to us
+    if (observedCpuCount.loadRelaxed() != -1)
+        QCOMPARE(observedCpuCount.loadRelaxed(), 1);
+}
+
 class ExpiryTimeoutTask : public QRunnable
 {
 public:
@@ -49,6 +49,7 @@ private Q_SLOTS:
     void transitionEachZone();
     void checkOffset_data();
     void checkOffset();
+    void offsetsFromUtc();
     void stressTest();
     void windowsId();
     void isValidId_data();
@@ -956,6 +957,33 @@ void tst_QTimeZone::checkOffset()
     QCOMPARE(data.daylightTimeOffset, dstOffset);
 }
 
+void tst_QTimeZone::offsetsFromUtc()
+{
+    // A fixed-offset zone yields the same offset for every input:
+    const QTimeZone ahead = QTimeZone::fromSecondsAheadOfUtc(7200);
+    const qint64 someTimes[] = { 0, Q_INT64_C(1'000'000'000'000), Q_INT64_C(-1'000'000'000'000) };
+    QCOMPARE(ahead.offsetsFromUtc(someTimes), QList<int>({ 7200, 7200, 7200 }));
+
+    // For a DST-using zone, the bulk API must agree with the per-call API
+    // across transitions, for sorted and unsorted input alike:
+    const QTimeZone berlin("Europe/Berlin");
+    if (!berlin.isValid())
+        QSKIP("Missing time-zone data");
+    QList<qint64> series;
+    // Hourly samples over two weeks around the spring 2024 transition
+    // (2024-03-31, 01:00 UTC):
+    const qint64 start = Q_INT64_C(1711238400000); // 2024-03-24 00:00 UTC
+    for (qint64 t = start; t < start + Q_INT64_C(14) * 86'400'000; t += 3'600'000)
+        series.append(t);
+    series.append(start - Q_INT64_C(365) * 86'400'000); // and one out-of-order entry
+    const QList<int> offsets = berlin.offsetsFromUtc(series);
+    QCOMPARE(offsets.size(), series.size());
+    for (qsizetype i = 0; i < series.size(); ++i) {
+        QCOMPARE(offsets.at(i),
+                 berlin.offsetFromUtc(QDateTime::fromMSecsSinceEpoch(series.at(i), QTimeZone::UTC)));
+    }
+}
+
 void tst_QTimeZone::availableTimeZoneIds()
 {
     if (debug) {
@@ -6,6 +6,7 @@
 #include <QTest>
 #include <QtCore/QString>
 #include <QtCore/qarraydata.h>
+#include <QtCore/private/qarraydataarena_p.h>
 
 #include "simplevector.h"
 
@@ -61,6 +62,7 @@ private slots:
     void dataPointerAllocate();
     void selfEmplaceBackwards();
     void selfEmplaceForward();
+    void arenaAllocation();
 #ifndef QT_NO_EXCEPTIONS
     void relocateWithExceptions_data();
     void relocateWithExceptions();
@@ -2532,5 +2534,65 @@ void tst_QArrayData::relocateWithExceptions()
 }
 #endif // QT_NO_EXCEPTIONS
 
+void tst_QArrayData::arenaAllocation()
+{
+    QArrayDataArena arena;
+    {
+        QArrayDataArena::Scope scope(arena);
+        QCOMPARE(QArrayDataArena::current(), &arena);
+
+        // fresh allocations are served from the arena and flagged as such
+        QArrayData *header = nullptr;
+        void *data = QArrayData::allocate(&header, sizeof(int), alignof(QtPrivate::AlignedQArrayData),
+                                          10, QArrayData::KeepSize);
+        QVERIFY(header);
+        QVERIFY(data);
+        QVERIFY(header->flags & QArrayData::ArenaAllocated);
+        QVERIFY(arena.bytesAllocated() > 0);
+
+        // growing an arena block keeps the contents and stays in the arena
+        int *ints = static_cast<int *>(data);
+        for (int i = 0; i < 10; ++i)
+            ints[i] = i;
+        auto [newHeader, newData] = QArrayData::reallocateUnaligned(header, data, sizeof(int),
+                                                                    1000, QArrayData::KeepSize);
+        QVERIFY(newHeader);
+        QVERIFY(newData);
+        QVERIFY(newHeader->flags & QArrayData::ArenaAllocated);
+        QCOMPARE(newHeader->constAllocatedCapacity(), 1000);
+        ints = static_cast<int *>(newData);
+        for (int i = 0; i < 10; ++i)
+            QCOMPARE(ints[i], i);
+
+        // deallocate() is a no-op for arena blocks (the arena owns the memory)
+        QArrayData::deallocate(newHeader, sizeof(int), alignof(QtPrivate::AlignedQArrayData));
+    }
+    QCOMPARE(QArrayDataArena::current(), nullptr);
+
+    {
+        // container-level smoke test: everything allocated inside the scope
+        // dies before the arena does
+        QArrayDataArena::Scope scope(arena);
+        QByteArray ba;
+        for (int i = 0; i < 1000; ++i)
+            ba.append("0123456789");
+        QCOMPARE(ba.size(), 10000);
+        QList<int> list;
+        for (int i = 0; i < 1000; ++i)
+            list.append(i);
+        QCOMPARE(list.size(), 1000);
+        QCOMPARE(list.at(999), 999);
+    }
+
+    // malloc'd blocks allocated outside a scope are not affected
+    QArrayData *header = nullptr;
+    void *data = QArrayData::allocate(&header, sizeof(int), alignof(QtPrivate::AlignedQArrayData),
+                                      10, QArrayData::KeepSize);
+    QVERIFY(header);
+    QVERIFY(data);
+    QVERIFY(!(header->flags & QArrayData::ArenaAllocated));
+    QArrayData::deallocate(header, sizeof(int), alignof(QtPrivate::AlignedQArrayData));
+}
+
 QTEST_APPLESS_MAIN(tst_QArrayData)
 #include "tst_qarraydata.moc"
@@ -0,0 +1,187 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QThread>
+
+#include <private/qconcurrentcache_p.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace Qt::StringLiterals;
+
+class tst_QConcurrentCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void basics();
+    void objectOrInsert();
+    void eviction();
+    void evictedObjectStaysAlive();
+    void concurrentObjectOrInsert();
+    void concurrentStress();
+};
+
+void tst_QConcurrentCache::basics()
+{
+    QConcurrentCache<int, QString> cache(100);
+    QCOMPARE(cache.maxCost(), 100);
+    QCOMPARE(cache.count(), 0);
+
+    QVERIFY(cache.insert(1, new QString(u"one"_s)));
+    QVERIFY(cache.insert(2, std::make_shared<QString>(u"two"_s)));
+    QCOMPARE(cache.count(), 2);
+    QCOMPARE(cache.totalCost(), 2);
+
+    QVERIFY(cache.contains(1));
+    QCOMPARE(*cache.object(1), u"one"_s);
+    QCOMPARE(*cache.object(2), u"two"_s);
+    QVERIFY(!cache.object(3));
+
+    QVERIFY(cache.remove(2));
+    QVERIFY(!cache.remove(2));
+    QVERIFY(!cache.contains(2));
+    QCOMPARE(cache.count(), 1);
+
+    cache.clear();
+    QCOMPARE(cache.count(), 0);
+    QCOMPARE(cache.totalCost(), 0);
+    QVERIFY(!cache.contains(1));
+}
+
+void tst_QConcurrentCache::objectOrInsert()
+{
+    QConcurrentCache<int, int> cache(100);
+    int factoryCalls = 0;
+    const auto factory = [&factoryCalls] {
+        ++factoryCalls;
+        return std::pair{ new int(42), qsizetype(1) };
+    };
+
+    const std::shared_ptr<int> created = cache.objectOrInsert(1, factory);
+    QCOMPARE(*created, 42);
+    QCOMPARE(factoryCalls, 1);
+
+    // a second lookup returns the cached object without invoking the factory
+    const std::shared_ptr<int> cached = cache.objectOrInsert(1, factory);
+    QCOMPARE(cached, created);
+    QCOMPARE(factoryCalls, 1);
+
+    cache.remove(1);
+    cache.objectOrInsert(1, factory);
+    QCOMPARE(factoryCalls, 2);
+}
+
+void tst_QConcurrentCache::eviction()
+{
+    // 16 shards, so each shard gets a slice of two
+    QConcurrentCache<int, int> cache(32);
+
+    for (int i = 0; i < 200; ++i)
+        QVERIFY(cache.insert(i, new int(i)));
+    QCOMPARE_LE(cache.totalCost(), cache.maxCost());
+    QCOMPARE_GT(cache.count(), 0);
+
+    // an entry larger than its shard's slice is rejected
+    QVERIFY(!cache.insert(1000, new int(1000), 3));
+    QVERIFY(!cache.contains(1000));
+}
+
+void tst_QConcurrentCache::evictedObjectStaysAlive()
+{
+    QConcurrentCache<int, int> cache(32);
+    const std::shared_ptr<int> held = cache.objectOrInsert(1, [] {
+        return std::pair{ new int(1), qsizetype(1) };
+    });
+
+    // push everything out of every shard
+    for (int i = 2; i < 500; ++i)
+        cache.insert(i, new int(i));
+    cache.clear();
+
+    // the reference we took keeps the evicted object valid
+    QCOMPARE(*held, 1);
+    QCOMPARE(held.use_count(), 1);
+}
+
+void tst_QConcurrentCache::concurrentObjectOrInsert()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int KeyCount = 256;
+    constexpr int Iterations = 50;
+
+    // large enough that nothing is evicted
+    QConcurrentCache<int, int> cache(10000);
+    std::atomic<int> factoryCalls{0};
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&cache, &factoryCalls, t] {
+            for (int i = 0; i < Iterations; ++i) {
+                for (int k = 0; k < KeyCount; ++k) {
+                    // stagger the key order per thread to provoke collisions
+                    const int key = (k + t * KeyCount / ThreadCount) % KeyCount;
+                    const std::shared_ptr<int> value
+                        = cache.objectOrInsert(key, [&factoryCalls, key] {
+                              ++factoryCalls;
+                              return std::pair{ new int(key), qsizetype(1) };
+                          });
+                    if (*value != key) {
+                        QCOMPARE(*value, key);
+                        return;
+                    }
+                }
+            }
+        }));
+    }
+    for (const auto &thread : threads)
+        thread->start();
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait(60'000));
+
+    // racing callers never created the same entry twice
+    QCOMPARE(factoryCalls.load(), KeyCount);
+    QCOMPARE(cache.count(), KeyCount);
+}
+
+void tst_QConcurrentCache::concurrentStress()
+{
+    constexpr int ThreadCount = 8;
+    constexpr int KeyCount = 64;
+    constexpr int Iterations = 2000;
+
+    // small enough that eviction happens while other threads hold references
+    QConcurrentCache<int, int> cache(32);
+
+    std::vector<std::unique_ptr<QThread>> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back(QThread::create([&cache, t] {
+            for (int i = 0; i < Iterations; ++i) {
+                const int key = (i * 7 + t) % KeyCount;
+                const std::shared_ptr<int> value = cache.objectOrInsert(key, [key] {
+                    return std::pair{ new int(key), qsizetype(1) };
+                });
+                if (*value != key) {
+                    QCOMPARE(*value, key);
+                    return;
+                }
+                if (i % 97 == 0)
+                    cache.remove(key);
+                if (t == 0 && i % 500 == 0)
+                    cache.clear();
+            }
+        }));
+    }
+    for (const auto &thread : threads)
+        thread->start();
+    for (const auto &thread : threads)
+        QVERIFY(thread->wait(60'000));
+
+    QCOMPARE_LE(cache.totalCost(), cache.maxCost());
+}
+
+QTEST_APPLESS_MAIN(tst_QConcurrentCache)
+#include "tst_qconcurrentcache.moc"
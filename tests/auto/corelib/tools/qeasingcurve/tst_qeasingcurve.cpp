@@ -24,6 +24,7 @@ private slots:
     void propertyOrderIsNotImportant();
     void bezierSpline_data();
     void bezierSpline();
+    void bezierSplineLookupTable();
     void tcbSpline_data();
     void tcbSpline();
     void testCbrtDouble();
@@ -623,6 +624,46 @@ void tst_QEasingCurve::bezierSpline()
     QVERIFY( !(bezierEasingCurve.valueForProgress(1) < 1) );
 }
 
+/*
+    After a number of evaluations the bezier solver switches to a lookup
+    table; the interpolated values must stay close to the exact solver's, and
+    curves with a segment narrower than the table resolution must not be
+    flattened by the switch.
+*/
+void tst_QEasingCurve::bezierSplineLookupTable()
+{
+    {
+        QEasingCurve curve(QEasingCurve::BezierSpline);
+        curve.addCubicBezierSegment(QPointF(0.4, 0.1), QPointF(0.6, 0.9), QPointF(1.0, 1.0));
+
+        // a fresh copy always starts out on the exact solver
+        QList<qreal> exact;
+        for (int i = 0; i <= 100; ++i)
+            exact.append(QEasingCurve(curve).valueForProgress(i / qreal(100)));
+
+        // repeated evaluation of one instance crosses into the table path
+        for (int pass = 0; pass < 3; ++pass) {
+            for (int i = 0; i <= 100; ++i) {
+                const qreal value = curve.valueForProgress(i / qreal(100));
+                QVERIFY(qAbs(value - exact.at(i)) <= 0.001);
+            }
+        }
+    }
+
+    {
+        // the middle segment is much narrower than the table step
+        QEasingCurve curve(QEasingCurve::BezierSpline);
+        curve.addCubicBezierSegment(QPointF(0.2, 0.0), QPointF(0.3, 0.2), QPointF(0.5, 0.2));
+        curve.addCubicBezierSegment(QPointF(0.5003, 0.4), QPointF(0.5006, 0.6), QPointF(0.5009, 0.8));
+        curve.addCubicBezierSegment(QPointF(0.7, 0.8), QPointF(0.9, 1.0), QPointF(1.0, 1.0));
+
+        const qreal inNarrowSegment = 0.50045;
+        const qreal first = curve.valueForProgress(inNarrowSegment);
+        for (int i = 0; i < 40; ++i)
+            QCOMPARE(curve.valueForProgress(inNarrowSegment), first);
+    }
+}
+
 void tst_QEasingCurve::tcbSpline_data()
 {
     QTest::addColumn<QString>("definition");
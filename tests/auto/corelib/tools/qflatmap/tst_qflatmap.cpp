@@ -44,6 +44,7 @@ private slots:
     void remove_if_pair() { remove_if_impl([](const auto &p) -> if_pair<decltype(p)> { return is_even(p.first) && is_empty(p.second); }); }
     void remove_if_key_value() { remove_if_impl([](const auto &k, const auto &v) { return is_even(k) && is_empty(v); }); }
     void remove_if_key() { remove_if_impl([](int k) { return is_even(k); }, true); }
+    void rangeQueries();
     void statefulComparator();
     void transparency_using();
     void transparency_struct();
@@ -452,6 +453,34 @@ void tst_QFlatMap::removal()
     QVERIFY(!m.contains(1));
 }
 
+void tst_QFlatMap::rangeQueries()
+{
+    using Map = QFlatMap<int, QByteArray>;
+    Map m;
+    m[1] = "een";
+    m[3] = "dree";
+    m[5] = "vijf";
+
+    QCOMPARE(m.upper_bound(1).key(), 3);
+    QCOMPARE(m.upper_bound(2).key(), 3);
+    QVERIFY(m.upper_bound(5) == m.end());
+
+    auto [first, last] = m.equal_range(3);
+    QCOMPARE(first.key(), 3);
+    QCOMPARE(first.value(), "dree");
+    QCOMPARE(std::distance(first, last), 1);
+
+    std::tie(first, last) = m.equal_range(2);
+    QCOMPARE(first, last);
+    QCOMPARE(first.key(), 3);
+
+    const Map &cm = m;
+    QVERIFY(cm.upper_bound(0) == cm.begin());
+    auto [cfirst, clast] = cm.equal_range(5);
+    QCOMPARE(cfirst.key(), 5);
+    QVERIFY(clast == cm.end());
+}
+
 void tst_QFlatMap::statefulComparator()
 {
     struct CountingCompare {
@@ -75,6 +75,7 @@ private slots:
     void eraseValidIteratorOnSharedHash();
     void equal_range();
     void insert_hash();
+    void insert_range();
     void multiHashStoresInReverseInsertionOrder();
 
     void emplace();
@@ -2739,6 +2740,44 @@ void tst_QHash::insert_hash()
     }
 }
 
+void tst_QHash::insert_range()
+{
+    {
+        // std::pair range, capacity reserved up front
+        std::vector<std::pair<int, int>> entries;
+        for (int i = 0; i < 100; ++i)
+            entries.emplace_back(i, i * 2);
+
+        QHash<int, int> hash;
+        hash.insert(1, -1); // will be overwritten by the range
+        hash.insert(entries.begin(), entries.end());
+
+        QCOMPARE(hash.size(), 100);
+        QVERIFY(hash.capacity() >= 100);
+        for (int i = 0; i < 100; ++i)
+            QCOMPARE(hash[i], i * 2);
+    }
+    {
+        // key()/value() range from another Qt associative container
+        QHash<int, int> source;
+        source.insert(0, 5);
+        source.insert(1, 6);
+
+        QHash<int, int> hash;
+        hash.insert(source.constBegin(), source.constEnd());
+        QCOMPARE(hash.size(), 2);
+        QCOMPARE(hash[0], 5);
+        QCOMPARE(hash[1], 6);
+    }
+    {
+        // empty range on an empty hash
+        std::vector<std::pair<int, int>> entries;
+        QHash<int, int> hash;
+        hash.insert(entries.begin(), entries.end());
+        QVERIFY(hash.isEmpty());
+    }
+}
+
 void tst_QHash::multiHashStoresInReverseInsertionOrder()
 {
     const QString strings[] = {
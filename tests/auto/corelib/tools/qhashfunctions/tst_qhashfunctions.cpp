@@ -47,6 +47,7 @@ private Q_SLOTS:
     void qhash_of_empty_and_null_qstring();
     void qhash_of_empty_and_null_qbytearray();
     void qhash_of_zero_floating_points();
+    void qHasher();
     void qmap();
     void qthash_data();
     void qthash();
@@ -456,6 +457,56 @@ void tst_QHashFunctions::qhash_of_zero_floating_points()
     QCOMPARE(qHash(-0.0L, seed), qHash(0.0L, seed));
 }
 
+void tst_QHashFunctions::qHasher()
+{
+    const QByteArray data = "The quick brown fox jumps over the lazy dog";
+
+    QHasher oneShot(seed);
+    oneShot.addData(data);
+    const size_t expected = oneShot.result();
+
+    // the result must not depend on how the input was chunked:
+    for (qsizetype split = 0; split <= data.size(); ++split) {
+        QHasher hasher(seed);
+        hasher.addData(QByteArrayView(data).first(split));
+        hasher.addData(QByteArrayView(data).sliced(split));
+        QCOMPARE(hasher.result(), expected);
+    }
+
+    // result() must not modify the state:
+    {
+        QHasher hasher(seed);
+        hasher.addData(QByteArrayView(data).first(5));
+        (void) hasher.result();
+        hasher.addData(QByteArrayView(data).sliced(5));
+        QCOMPARE(hasher.result(), expected);
+    }
+
+    // reset() must return to the just-constructed state:
+    {
+        QHasher hasher(seed);
+        hasher.addData("some other data");
+        hasher.reset();
+        hasher.addData(data);
+        QCOMPARE(hasher.result(), expected);
+    }
+
+    // two default-constructed hashers share the global seed:
+    {
+        QHasher h1, h2;
+        h1.addData(data);
+        h2.addData(data);
+        QCOMPARE(h1.result(), h2.result());
+    }
+
+    // verify that the seed matters (test not guaranteed):
+    {
+        QHasher hasher(seed + 1);
+        hasher.addData(data);
+        QVERIFY(hasher.result() != expected);
+    }
+}
+
 void tst_QHashFunctions::qmap()
 {
     // QTBUG-126659
@@ -0,0 +1,132 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QThread>
+
+#include <private/qspscqueue_p.h>
+
+#include <memory>
+
+class tst_QSpscQueue : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void capacity();
+    void fifoOrder();
+    void fullAndEmpty();
+    void moveOnlyPayload();
+    void destructorDestroysRemaining();
+    void producerConsumerStress();
+};
+
+void tst_QSpscQueue::capacity()
+{
+    // capacity is rounded up to a power of two minus the sacrificed slot,
+    // so the usable capacity is at least what was requested
+    for (qsizetype requested : { 1, 2, 3, 4, 7, 8, 100, 4096 }) {
+        QSpscQueue<int> q(requested);
+        QCOMPARE_GE(q.capacity(), requested);
+        QVERIFY(q.isEmpty());
+        QCOMPARE(q.size(), 0);
+    }
+}
+
+void tst_QSpscQueue::fifoOrder()
+{
+    QSpscQueue<int> q(8);
+    for (int i = 0; i < 8; ++i)
+        QVERIFY(q.tryPush(i));
+    QCOMPARE(q.size(), 8);
+    for (int i = 0; i < 8; ++i) {
+        int value = -1;
+        QVERIFY(q.tryPop(value));
+        QCOMPARE(value, i);
+    }
+    QVERIFY(q.isEmpty());
+}
+
+void tst_QSpscQueue::fullAndEmpty()
+{
+    QSpscQueue<int> q(4);
+
+    int value = -1;
+    QVERIFY(!q.tryPop(value));
+
+    qsizetype pushed = 0;
+    while (q.tryPush(int(pushed)))
+        ++pushed;
+    QCOMPARE(pushed, q.capacity());
+    QCOMPARE(q.size(), q.capacity());
+
+    // popping one element frees exactly one slot
+    QVERIFY(q.tryPop(value));
+    QCOMPARE(value, 0);
+    QVERIFY(q.tryPush(-1));
+    QVERIFY(!q.tryPush(-2));
+}
+
+void tst_QSpscQueue::moveOnlyPayload()
+{
+    QSpscQueue<std::unique_ptr<int>> q(2);
+    QVERIFY(q.tryPush(std::make_unique<int>(42)));
+    QVERIFY(q.tryEmplace(new int(43)));
+
+    std::unique_ptr<int> p;
+    QVERIFY(q.tryPop(p));
+    QVERIFY(p);
+    QCOMPARE(*p, 42);
+    QVERIFY(q.tryPop(p));
+    QVERIFY(p);
+    QCOMPARE(*p, 43);
+    QVERIFY(!q.tryPop(p));
+}
+
+void tst_QSpscQueue::destructorDestroysRemaining()
+{
+    const auto sentinel = std::make_shared<int>(0);
+    {
+        QSpscQueue<std::shared_ptr<int>> q(8);
+        for (int i = 0; i < 5; ++i)
+            QVERIFY(q.tryPush(sentinel));
+
+        std::shared_ptr<int> p;
+        QVERIFY(q.tryPop(p));
+        QCOMPARE(sentinel.use_count(), 1 + 4 + 1); // ours, queued, popped
+    }
+    QCOMPARE(sentinel.use_count(), 1); // queue destroyed its elements
+}
+
+void tst_QSpscQueue::producerConsumerStress()
+{
+    constexpr int Count = 500'000;
+    QSpscQueue<int> q(64);
+
+    const std::unique_ptr<QThread> producer{QThread::create([&q] {
+        for (int i = 0; i < Count; ++i) {
+            while (!q.tryPush(i))
+                QThread::yieldCurrentThread();
+        }
+    })};
+    const std::unique_ptr<QThread> consumer{QThread::create([&q] {
+        for (int expected = 0; expected < Count; ++expected) {
+            int value = -1;
+            while (!q.tryPop(value))
+                QThread::yieldCurrentThread();
+            if (value != expected) {
+                QCOMPARE(value, expected);
+                return;
+            }
+        }
+    })};
+
+    producer->start();
+    consumer->start();
+    QVERIFY(producer->wait(60'000));
+    QVERIFY(consumer->wait(60'000));
+    QVERIFY(q.isEmpty());
+}
+
+QTEST_APPLESS_MAIN(tst_QSpscQueue)
+#include "tst_qspscqueue.moc"
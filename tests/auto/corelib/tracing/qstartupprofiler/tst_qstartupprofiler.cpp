@@ -0,0 +1,88 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/private/qstartupprofiler_p.h>
+
+#include <QTest>
+#include <QJsonArray>
+#include <QScopeGuard>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+class tst_QStartupProfiler : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void disabledByDefault();
+    void recordAndDump();
+};
+
+void tst_QStartupProfiler::disabledByDefault()
+{
+    if (qEnvironmentVariableIsSet("QT_STARTUP_PROFILE"))
+        QSKIP("QT_STARTUP_PROFILE is set in the environment");
+    QVERIFY(!QStartupProfiler::isEnabled());
+    QCOMPARE(QStartupProfiler::beginPhase(), -1);
+}
+
+void tst_QStartupProfiler::recordAndDump()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString outputPath = dir.filePath(u"startup.json"_s);
+    qputenv("QT_STARTUP_PROFILE", outputPath.toLocal8Bit());
+    auto guard = qScopeGuard([] { qunsetenv("QT_STARTUP_PROFILE"); });
+
+    QStartupProfiler::setEnabled(true);
+    {
+        QStartupPhase phase("tst.outer");
+        {
+            QStartupPhase nested("tst.inner", "detail"_ba);
+            QTest::qSleep(1);
+        }
+        QStartupProfiler::mark("tst.marker");
+    }
+
+    // only the first dump in the process writes; this test must run before
+    // any other dump can have happened
+    QStartupProfiler::dump();
+    QStartupProfiler::setEnabled(false);
+
+    QFile file(outputPath);
+    QVERIFY2(file.open(QIODevice::ReadOnly), qPrintable(file.errorString()));
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    const QJsonObject root = doc.object();
+    QVERIFY(root.value(u"elapsed_us"_s).toDouble() > 0);
+
+    const QJsonArray phases = root.value(u"phases"_s).toArray();
+    bool sawOuter = false, sawInner = false, sawMarker = false;
+    for (const QJsonValue &value : phases) {
+        const QJsonObject phase = value.toObject();
+        const QString name = phase.value(u"name"_s).toString();
+        if (name == u"tst.outer"_s) {
+            sawOuter = true;
+            QVERIFY(phase.value(u"duration_us"_s).toDouble() >= 1000.0);
+        } else if (name == u"tst.inner"_s) {
+            sawInner = true;
+            QCOMPARE(phase.value(u"detail"_s).toString(), u"detail"_s);
+            QVERIFY(phase.value(u"duration_us"_s).toDouble() >= 1000.0);
+        } else if (name == u"tst.marker"_s) {
+            sawMarker = true;
+            QVERIFY(!phase.contains(u"duration_us"_s));
+        }
+    }
+    QVERIFY(sawOuter);
+    QVERIFY(sawInner);
+    QVERIFY(sawMarker);
+}
+
+QTEST_MAIN(tst_QStartupProfiler)
+
+#include "tst_qstartupprofiler.moc"
@@ -0,0 +1,157 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QtCore/qtracecounter.h>
+
+#include <QTest>
+#include <QScopeGuard>
+
+static QTraceCounter staticCounter("tst_qtracecounter.static");
+
+class tst_QTraceCounter : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void incrementWhileDisabled();
+    void incrementWhileEnabled();
+    void reset();
+    void snapshot();
+    void scope();
+    void builtinCounters();
+
+Q_SIGNALS:
+    void dummySignal();
+};
+
+void tst_QTraceCounter::init()
+{
+    QTraceCounter::setEnabled(false);
+    staticCounter.reset();
+}
+
+void tst_QTraceCounter::incrementWhileDisabled()
+{
+    QVERIFY(!QTraceCounter::isEnabled());
+    staticCounter.increment();
+    staticCounter.increment(10);
+    QCOMPARE(staticCounter.value(), 0);
+}
+
+void tst_QTraceCounter::incrementWhileEnabled()
+{
+    QTraceCounter::setEnabled(true);
+    const auto disable = qScopeGuard([] { QTraceCounter::setEnabled(false); });
+
+    staticCounter.increment();
+    QCOMPARE(staticCounter.value(), 1);
+    staticCounter.increment(10);
+    QCOMPARE(staticCounter.value(), 11);
+    staticCounter.increment(-2);
+    QCOMPARE(staticCounter.value(), 9);
+}
+
+void tst_QTraceCounter::reset()
+{
+    QTraceCounter::setEnabled(true);
+    const auto disable = qScopeGuard([] { QTraceCounter::setEnabled(false); });
+
+    staticCounter.increment(5);
+    QCOMPARE(staticCounter.value(), 5);
+    staticCounter.reset();
+    QCOMPARE(staticCounter.value(), 0);
+
+    // Values survive disabling; only reset() clears them:
+    staticCounter.increment(3);
+    QTraceCounter::setEnabled(false);
+    QCOMPARE(staticCounter.value(), 3);
+}
+
+void tst_QTraceCounter::snapshot()
+{
+    QTraceCounter::setEnabled(true);
+    const auto disable = qScopeGuard([] { QTraceCounter::setEnabled(false); });
+
+    staticCounter.increment(7);
+    const QList<QTraceCounter::Value> values = QTraceCounter::snapshot();
+    QVERIFY(!values.isEmpty());
+
+    bool found = false;
+    for (const QTraceCounter::Value &value : values) {
+        if (qstrcmp(value.name, "tst_qtracecounter.static") == 0) {
+            QCOMPARE(value.value, 7);
+            found = true;
+        }
+    }
+    QVERIFY(found);
+}
+
+void tst_QTraceCounter::scope()
+{
+    static QTraceCounter calls("tst_qtracecounter.scope.calls");
+    static QTraceCounter nsecs("tst_qtracecounter.scope.nsecs");
+
+    {
+        // Disabled on entry: nothing is recorded.
+        QTraceScope scope(calls, nsecs);
+    }
+    QCOMPARE(calls.value(), 0);
+    QCOMPARE(nsecs.value(), 0);
+
+    QTraceCounter::setEnabled(true);
+    const auto disable = qScopeGuard([] { QTraceCounter::setEnabled(false); });
+
+    {
+        QTraceScope scope(calls, nsecs);
+        QTest::qSleep(1);
+    }
+    QCOMPARE(calls.value(), 1);
+    QCOMPARE_GE(nsecs.value(), 1);
+}
+
+void tst_QTraceCounter::builtinCounters()
+{
+    QTraceCounter::setEnabled(true);
+    const auto disable = qScopeGuard([] { QTraceCounter::setEnabled(false); });
+
+    qint64 signalsBefore = -1;
+    qint64 allocationsBefore = -1;
+    const auto valueOf = [](const char *name, qint64 *value) {
+        const QList<QTraceCounter::Value> values = QTraceCounter::snapshot();
+        for (const QTraceCounter::Value &v : values) {
+            if (qstrcmp(v.name, name) == 0) {
+                *value = v.value;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    QVERIFY(valueOf("qobject.signals.emitted", &signalsBefore));
+    QVERIFY(valueOf("qarraydata.allocations", &allocationsBefore));
+
+    emit dummySignal();
+    QString s;
+    s.reserve(1024); // forces a fresh allocation
+
+    qint64 signalsAfter = -1;
+    qint64 allocationsAfter = -1;
+    QVERIFY(valueOf("qobject.signals.emitted", &signalsAfter));
+    QVERIFY(valueOf("qarraydata.allocations", &allocationsAfter));
+    QCOMPARE_GT(signalsAfter, signalsBefore);
+    QCOMPARE_GT(allocationsAfter, allocationsBefore);
+
+    qint64 depthBefore = -1;
+    QVERIFY(valueOf("qcoreapplication.eventqueue.depth", &depthBefore));
+    QCoreApplication::postEvent(this, new QEvent(QEvent::User));
+    qint64 depthAfter = -1;
+    QVERIFY(valueOf("qcoreapplication.eventqueue.depth", &depthAfter));
+    QCOMPARE(depthAfter, depthBefore + 1);
+    QCoreApplication::removePostedEvents(this, QEvent::User);
+    QVERIFY(valueOf("qcoreapplication.eventqueue.depth", &depthAfter));
+    QCOMPARE(depthAfter, depthBefore);
+}
+
+QTEST_MAIN(tst_QTraceCounter)
+#include "tst_qtracecounter.moc"
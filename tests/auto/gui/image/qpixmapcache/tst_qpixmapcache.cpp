@@ -46,6 +46,7 @@ private slots:
     void reducingCacheLimitDoesNotLeakStringKeys();
     void strictCacheLimit();
     void noCrashOnLargeInsert();
+    void statistics();
 
 private:
     void stringLeak_impl(std::function<void()> whenOp);
@@ -623,5 +624,45 @@ void tst_QPixmapCache::noCrashOnLargeInsert()
     QVERIFY(true); // no crash
 }
 
+void tst_QPixmapCache::statistics()
+{
+    QPixmapCache::clear();
+    QPixmapCache::setCacheLimit(100);
+    QPixmapCache::resetStatistics();
+
+    QPixmap pixmap(32, 32);
+    pixmap.fill(Qt::red);
+    QVERIFY(QPixmapCache::insert("stats-test", pixmap));
+
+    QPixmap result;
+    QVERIFY(QPixmapCache::find("stats-test", &result));
+    QVERIFY(!QPixmapCache::find("stats-missing", &result));
+
+    QPixmapCache::Statistics stats = QPixmapCache::statistics();
+    QCOMPARE(stats.inserts, quint64(1));
+    QCOMPARE(stats.hits, quint64(1));
+    QCOMPARE(stats.misses, quint64(1));
+    // an explicit removal must not count as an eviction
+    QPixmapCache::remove("stats-test");
+    stats = QPixmapCache::statistics();
+    QCOMPARE(stats.evictions, quint64(0));
+
+    // overflowing the cache limit evicts entries
+    QPixmapCache::setCacheLimit(200);
+    QPixmap big(200, 200);
+    big.fill(Qt::blue);
+    QVERIFY(QPixmapCache::insert("stats-big-1", big));
+    QVERIFY(QPixmapCache::insert("stats-big-2", big));
+    stats = QPixmapCache::statistics();
+    QVERIFY(stats.evictions >= 1);
+
+    QPixmapCache::resetStatistics();
+    stats = QPixmapCache::statistics();
+    QCOMPARE(stats.hits, quint64(0));
+    QCOMPARE(stats.misses, quint64(0));
+    QCOMPARE(stats.inserts, quint64(0));
+    QCOMPARE(stats.evictions, quint64(0));
+}
+
 QTEST_MAIN(tst_QPixmapCache)
 #include "tst_qpixmapcache.moc"
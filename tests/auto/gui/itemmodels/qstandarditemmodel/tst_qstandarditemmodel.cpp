@@ -118,6 +118,7 @@ private slots:
     void supportedDragDropActions();
 
     void taskQTBUG_45114_setItemData();
+    void setColumnData();
     void setItemPersistentIndex();
     void signalsOnTakeItem();
     void takeChild();
@@ -1732,6 +1733,51 @@ void tst_QStandardItemModel::taskQTBUG_45114_setItemData()
     QVERIFY(!itemRoles.keys().contains(Qt::UserRole + 3));
 }
 
+void tst_QStandardItemModel::setColumnData()
+{
+    QStandardItemModel m;
+    QSignalSpy dataChangedSpy(&m, &QStandardItemModel::dataChanged);
+    QSignalSpy itemChangedSpy(&m, &QStandardItemModel::itemChanged);
+
+    // the model grows to fit the values and emits one dataChanged for the column
+    QVariantList values;
+    for (int i = 0; i < 10; ++i)
+        values.append(QString::number(i));
+    m.setColumnData(1, values);
+    QCOMPARE(m.rowCount(), 10);
+    QCOMPARE(m.columnCount(), 2);
+    for (int i = 0; i < 10; ++i) {
+        QCOMPARE(m.index(i, 1).data(Qt::DisplayRole).toString(), QString::number(i));
+        QCOMPARE(m.index(i, 1).data(Qt::EditRole).toString(), QString::number(i));
+    }
+    QCOMPARE(dataChangedSpy.size(), 1);
+    QCOMPARE(itemChangedSpy.size(), 0);
+    QList<QVariant> arguments = dataChangedSpy.takeFirst();
+    QCOMPARE(arguments.at(0).value<QModelIndex>(), m.index(0, 1));
+    QCOMPARE(arguments.at(1).value<QModelIndex>(), m.index(9, 1));
+    QCOMPARE(arguments.at(2).value<QList<int>>(),
+             QList<int>({ Qt::DisplayRole, Qt::EditRole }));
+
+    // existing items are updated in place, other roles are untouched
+    m.item(0, 1)->setData(QStringLiteral("tip"), Qt::ToolTipRole);
+    dataChangedSpy.clear();
+    itemChangedSpy.clear();
+    m.setColumnData(1, { QStringLiteral("a"), QStringLiteral("b") });
+    QCOMPARE(m.rowCount(), 10);
+    QCOMPARE(m.index(0, 1).data().toString(), QStringLiteral("a"));
+    QCOMPARE(m.index(1, 1).data().toString(), QStringLiteral("b"));
+    QCOMPARE(m.index(0, 1).data(Qt::ToolTipRole).toString(), QStringLiteral("tip"));
+    QCOMPARE(dataChangedSpy.size(), 1);
+    QCOMPARE(itemChangedSpy.size(), 0);
+
+    // an invalid variant clears the role, other roles and custom roles work
+    m.setColumnData(1, { QVariant() });
+    QVERIFY(!m.index(0, 1).data().isValid());
+    m.setColumnData(0, { 1, 2, 3 }, Qt::UserRole);
+    QCOMPARE(m.index(2, 0).data(Qt::UserRole).toInt(), 3);
+    QVERIFY(!m.index(0, 0).data(Qt::DisplayRole).isValid());
+}
+
 void tst_QStandardItemModel::setItemPersistentIndex()
 {
     QPersistentModelIndex persistentIndex;
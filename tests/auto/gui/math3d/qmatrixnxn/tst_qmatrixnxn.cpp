@@ -5,6 +5,10 @@
 #include <QtCore/qmath.h>
 #include <QtGui/qmatrix4x4.h>
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 class tst_QMatrixNxN : public QObject
 {
     Q_OBJECT
@@ -130,6 +134,8 @@ private slots:
     void mapVector_data();
     void mapVector();
 
+    void mapSpan();
+
     void properties();
     void metaTypes();
 
@@ -3274,6 +3280,63 @@ void tst_QMatrixNxN::mapVector()
     QVERIFY(qFuzzyCompare(actual2.z(), expected.z()));
 }
 
+// Check the span overloads of map() and mapVectors() against the
+// single-point versions for every flag classification of the matrix.
+void tst_QMatrixNxN::mapSpan()
+{
+    QList<QMatrix4x4> matrices;
+    matrices.append(QMatrix4x4()); // identity
+    QMatrix4x4 m;
+    m.translate(1.0f, -2.0f, 3.0f);
+    matrices.append(m); // translation
+    m.scale(2.0f, 0.5f, -4.0f);
+    matrices.append(m); // translation | scale
+    m.rotate(30.0f, 0.0f, 0.0f, 1.0f);
+    matrices.append(m); // rotation about z
+    m.rotate(45.0f, 1.0f, 1.0f, 0.0f);
+    matrices.append(m); // general rotation
+    QMatrix4x4 p;
+    p.perspective(60.0f, 1.5f, 1.0f, 100.0f);
+    p.lookAt(QVector3D(0, 0, 10), QVector3D(0, 0, 0), QVector3D(0, 1, 0));
+    matrices.append(p); // perspective
+
+    const QVector3D points[] = {
+        QVector3D(0.0f, 0.0f, 0.0f),
+        QVector3D(1.0f, 2.0f, 3.0f),
+        QVector3D(-3.5f, 0.25f, -8.0f),
+        QVector3D(100.0f, -200.0f, 0.5f),
+        QVector3D(-1.0f, 1.0f, 1.0f)
+    };
+    constexpr qsizetype count = qsizetype(std::size(points));
+
+    for (const QMatrix4x4 &matrix : std::as_const(matrices)) {
+        QVector3D mapped[count];
+        matrix.map(points, mapped, count);
+        for (qsizetype i = 0; i < count; ++i) {
+            const QVector3D expected = matrix.map(points[i]);
+            QVERIFY(qFuzzyCompare(mapped[i].x(), expected.x()));
+            QVERIFY(qFuzzyCompare(mapped[i].y(), expected.y()));
+            QVERIFY(qFuzzyCompare(mapped[i].z(), expected.z()));
+        }
+
+        // in-place mapping must give the same results
+        QVector3D inPlace[count];
+        std::copy(std::begin(points), std::end(points), inPlace);
+        matrix.map(inPlace, inPlace, count);
+        for (qsizetype i = 0; i < count; ++i)
+            QCOMPARE(inPlace[i], mapped[i]);
+
+        QVector3D mappedVectors[count];
+        matrix.mapVectors(points, mappedVectors, count);
+        for (qsizetype i = 0; i < count; ++i) {
+            const QVector3D expected = matrix.mapVector(points[i]);
+            QVERIFY(qFuzzyCompare(mappedVectors[i].x(), expected.x()));
+            QVERIFY(qFuzzyCompare(mappedVectors[i].y(), expected.y()));
+            QVERIFY(qFuzzyCompare(mappedVectors[i].z(), expected.z()));
+        }
+    }
+}
+
 class tst_QMatrixNxN4x4Properties : public QObject
 {
     Q_OBJECT
@@ -28,6 +28,7 @@ private slots:
     void rects();
     void swap();
     void setRects();
+    void fromRects();
     void ellipseRegion();
     void polygonRegion();
     void bitmapRegion();
@@ -214,6 +215,47 @@ void tst_QRegion::setRects()
     }
 }
 
+void tst_QRegion::fromRects()
+{
+    QCOMPARE(QRegion::fromRects({}), QRegion());
+
+    {
+        // empty rectangles are ignored
+        const QRect rects[] = { QRect(), QRect(10, 10, 0, 5) };
+        QCOMPARE(QRegion::fromRects(rects), QRegion());
+    }
+    {
+        const QRect rects[] = { QRect(10, -20, 30, 40) };
+        QCOMPARE(QRegion::fromRects(rects), QRegion(rects[0]));
+    }
+    {
+        // overlapping, unsorted input must match the incremental union
+        const QRect rects[] = {
+            QRect(50, 50, 20, 20),
+            QRect(0, 0, 20, 20),
+            QRect(10, 10, 20, 20),
+            QRect(0, 0, 20, 20), // duplicate
+            QRect(55, 40, 5, 30),
+            QRect(-10, 5, 200, 3),
+        };
+        QRegion expected;
+        for (const QRect &r : rects)
+            expected += r;
+        QCOMPARE(QRegion::fromRects(rects), expected);
+    }
+    {
+        // a large scattered set
+        QList<QRect> rects;
+        QRegion expected;
+        for (int i = 0; i < 1000; ++i) {
+            const QRect r((i * 37) % 500, (i * 61) % 300, 10 + i % 13, 10 + i % 7);
+            rects << r;
+            expected += r;
+        }
+        QCOMPARE(QRegion::fromRects(rects), expected);
+    }
+}
+
 void tst_QRegion::ellipseRegion()
 {
     QRegion region(0, 0, 100, 100, QRegion::Ellipse);
@@ -8,6 +8,9 @@
 #include <qtransform.h>
 #include <qdebug.h>
 
+#include <algorithm>
+#include <iterator>
+
 class tst_QTransform : public QObject
 {
     Q_OBJECT
@@ -34,6 +37,8 @@ private slots:
     void projectivePathMapping();
     void mapInt();
     void mapPathWithPoint();
+    void mapSpan();
+    void mapRectSpan();
 
 private:
     void mapping_data();
@@ -700,6 +705,57 @@ void tst_QTransform::mapPathWithPoint()
     QCOMPARE(p.currentPosition(), QPointF(20, 20));
 }
 
+static QList<QTransform> spanTestMatrices()
+{
+    return {
+        QTransform(),
+        QTransform().translate(3, -5),
+        QTransform().scale(2, -1.5).translate(3, -5),
+        QTransform().rotate(30),
+        QTransform().shear(0.5, 0.25),
+        QTransform().rotate(45, Qt::YAxis)
+    };
+}
+
+void tst_QTransform::mapSpan()
+{
+    const QPointF points[] = {
+        QPointF(0, 0), QPointF(1, 1), QPointF(-10.5, 42),
+        QPointF(1000, -0.25), QPointF(-3.75, -8)
+    };
+    constexpr qsizetype count = qsizetype(std::size(points));
+
+    for (const QTransform &m : spanTestMatrices()) {
+        QPointF mapped[count];
+        m.map(points, mapped, count);
+        for (qsizetype i = 0; i < count; ++i)
+            QCOMPARE(mapped[i], m.map(points[i]));
+
+        // in-place mapping must give the same results
+        QPointF inPlace[count];
+        std::copy(std::begin(points), std::end(points), inPlace);
+        m.map(inPlace, inPlace, count);
+        for (qsizetype i = 0; i < count; ++i)
+            QCOMPARE(inPlace[i], mapped[i]);
+    }
+}
+
+void tst_QTransform::mapRectSpan()
+{
+    const QRectF rects[] = {
+        QRectF(0, 0, 10, 20), QRectF(-5, 7.5, 3, 4),
+        QRectF(100, -200, 0.5, 300)
+    };
+    constexpr qsizetype count = qsizetype(std::size(rects));
+
+    for (const QTransform &m : spanTestMatrices()) {
+        QRectF mapped[count];
+        m.mapRect(rects, mapped, count);
+        for (qsizetype i = 0; i < count; ++i)
+            QCOMPARE(mapped[i], m.mapRect(rects[i]));
+    }
+}
+
 QTEST_APPLESS_MAIN(tst_QTransform)
 
 
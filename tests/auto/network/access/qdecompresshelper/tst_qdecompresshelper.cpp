@@ -36,6 +36,9 @@ private Q_SLOTS:
     void countAheadPartialRead_data();
     void countAheadPartialRead();
 
+    void offThreadDecompress_data();
+    void offThreadDecompress();
+
     void decompressBigData_data();
     void decompressBigData();
 
@@ -317,6 +320,44 @@ void tst_QDecompressHelper::countAheadPartialRead()
     QCOMPARE(actual, expected);
 }
 
+void tst_QDecompressHelper::offThreadDecompress_data()
+{
+    sharedDecompress_data();
+}
+
+// Same decompression again, but performed by a thread pool worker while we
+// still read the results synchronously
+void tst_QDecompressHelper::offThreadDecompress()
+{
+    QDecompressHelper helper;
+    helper.setCountingBytesEnabled(true);
+    helper.setOffThreadDecompressionEnabled(true);
+
+    QFETCH(QByteArray, encoding);
+    QVERIFY(helper.setEncoding(encoding));
+
+    QFETCH(QByteArray, data);
+    // Feed in small pieces so the worker gets scheduled more than once
+    for (qsizetype i = 0; i < data.size(); i += 5)
+        helper.feed(data.mid(i, 5));
+
+    QFETCH(QByteArray, expected);
+    // The worker counts the bytes as it goes; wait until it has seen the
+    // whole stream
+    QTRY_COMPARE(helper.uncompressedSize(), qint64(expected.size()));
+
+    QByteArray actual;
+    QByteArray buffer(64, Qt::Uninitialized);
+    while (helper.hasData()) {
+        qsizetype read = helper.read(buffer.data(), buffer.size());
+        QVERIFY(read >= 0);
+        if (read == 0)
+            break;
+        actual.append(buffer.constData(), read);
+    }
+    QCOMPARE(actual, expected);
+}
+
 void tst_QDecompressHelper::decompressBigData_data()
 {
 #if defined(QT_ASAN_ENABLED)
@@ -17,6 +17,7 @@ public:
 
 private slots:
     void alwaysCacheRequest();
+    void warmHostValidation();
 };
 
 tst_QNetworkAccessManager::tst_QNetworkAccessManager()
@@ -34,5 +35,21 @@ void tst_QNetworkAccessManager::alwaysCacheRequest()
     delete reply;
 }
 
+void tst_QNetworkAccessManager::warmHostValidation()
+{
+    QNetworkAccessManager manager;
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         "QNetworkAccessManager::setWarmHost: unsupported scheme 'ftp'");
+    manager.setWarmHost(QUrl("ftp://example.com"));
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         "QNetworkAccessManager::setWarmHost: origin has no host");
+    manager.setWarmHost(QUrl("http://"));
+
+    // removing an origin that was never configured is a no-op
+    manager.removeWarmHost(QUrl("http://example.com"));
+}
+
 QTEST_MAIN(tst_QNetworkAccessManager)
 #include "tst_qnetworkaccessmanager.moc"
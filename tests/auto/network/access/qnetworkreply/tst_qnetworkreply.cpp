@@ -459,6 +459,7 @@ private Q_SLOTS:
     void getFromHttpIntoBuffer2_data();
     void getFromHttpIntoBuffer2();
     void getFromHttpIntoBufferCanReadLine();
+    void getFromHttpIntoFile();
 
     void ioGetFromHttpWithoutContentLength();
 
@@ -7489,6 +7490,43 @@ void tst_QNetworkReply::getFromHttpIntoBufferCanReadLine()
     QVERIFY(!reply->canReadLine());
 }
 
+void tst_QNetworkReply::getFromHttpIntoFile()
+{
+    QByteArray dataFromServerToClient;
+    dataFromServerToClient.reserve(128 * 1024);
+    for (int i = 0; i < 128 * 1024; ++i)
+        dataFromServerToClient.append(char('0' + i % 64));
+    QByteArray httpResponse = QByteArray("HTTP/1.0 200 OK\r\nContent-Length: ");
+    httpResponse += QByteArray::number(dataFromServerToClient.size());
+    httpResponse += "\r\n\r\n";
+    httpResponse += dataFromServerToClient;
+
+    MiniHttpServer server(httpResponse);
+    server.doClose = true;
+
+    QTemporaryDir tempDir(QDir::tempPath() + "/tst_qnetworkreply-XXXXXX");
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString filePath = tempDir.filePath("downloaded.bin");
+
+    QNetworkRequest request(QUrl("http://localhost:" + QString::number(server.serverPort())));
+    request.setAttribute(QNetworkRequest::DownloadDestinationFileAttribute, filePath);
+    QNetworkReplyPtr reply(manager.get(request));
+
+    QVERIFY2(waitForFinish(reply) == Success, msgWaitForFinished(reply));
+    QCOMPARE(reply->error(), QNetworkReply::NoError);
+
+    // The body must have arrived in the file ...
+    {
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        QCOMPARE(file.size(), qint64(dataFromServerToClient.size()));
+        QCOMPARE(file.readAll(), dataFromServerToClient);
+    }
+
+    // ... and must still be readable from the reply as usual
+    QCOMPARE(reply->readAll(), dataFromServerToClient);
+}
+
 
 
 // Is handled somewhere else too, introduced this special test to have it more accessible
@@ -83,6 +83,7 @@ private slots:
     void multipleDifferentLookups();
 
     void cache();
+    void prefetch();
 
     void abortHostLookup();
 
@@ -607,6 +608,31 @@ void tst_QHostInfo::cache()
     QCOMPARE(helper.lookupsDoneCounter, 2);
 }
 
+void tst_QHostInfo::prefetch()
+{
+    QFETCH_GLOBAL(bool, cache);
+    if (!cache)
+        return; // test makes only sense when cache enabled
+
+    tst_QHostInfo_Helper helper("localhost");
+    qt_qhostinfo_clear_cache();
+
+    // after a prefetch has had time to complete, a lookup is answered
+    // synchronously from the cache without calling the slot
+    QHostInfo::prefetch(helper.hostname);
+    QTest::qWait(2000);
+
+    bool valid = false;
+    int id = -1;
+    QHostInfo result = qt_qhostinfo_lookup(helper.hostname, &helper, SLOT(resultsReady(QHostInfo)), &valid, &id);
+    QVERIFY(valid);
+    QVERIFY(!result.addresses().isEmpty());
+    QCOMPARE(helper.lookupsDoneCounter, 0);
+
+    // prefetching a name that is already fresh in the cache is a no-op
+    QHostInfo::prefetch(helper.hostname);
+}
+
 void tst_QHostInfo_Helper::resultsReady(const QHostInfo &hi)
 {
     QVERIFY(QThread::currentThread() == thread());
@@ -7,6 +7,7 @@
 #include <qcoreapplication.h>
 #include <qdebug.h>
 #include <qabstractsocket.h>
+#include <qtemporaryfile.h>
 
 class tst_QAbstractSocket : public QObject
 {
@@ -18,6 +19,7 @@ public:
 
 private slots:
     void getSetCheck();
+    void sendFileValidation();
 };
 
 tst_QAbstractSocket::tst_QAbstractSocket()
@@ -64,5 +66,25 @@ void tst_QAbstractSocket::getSetCheck()
     QCOMPARE(quint16(0xffff), obj1.peerPort());
 }
 
+void tst_QAbstractSocket::sendFileValidation()
+{
+    MyAbstractSocket socket;
+
+    QTest::ignoreMessage(QtWarningMsg,
+                         "QAbstractSocket::sendFile: file must be open for reading");
+    QVERIFY(!socket.sendFile(nullptr));
+
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QVERIFY(file.write("payload") > 0);
+    QVERIFY(file.flush());
+
+    QTest::ignoreMessage(QtWarningMsg, "QAbstractSocket::sendFile: invalid offset");
+    QVERIFY(!socket.sendFile(&file, -1));
+
+    QTest::ignoreMessage(QtWarningMsg, "QAbstractSocket::sendFile: socket is not connected");
+    QVERIFY(!socket.sendFile(&file));
+}
+
 QTEST_MAIN(tst_QAbstractSocket)
 #include "tst_qabstractsocket.moc"
@@ -25,6 +25,8 @@
 #include <qelapsedtimer.h>
 #include <qnetworkdatagram.h>
 #include <QNetworkProxy>
+
+#include <algorithm>
 #include <QNetworkInterface>
 
 #include <qstringlist.h>
@@ -66,6 +68,8 @@ private slots:
     void broadcasting();
     void loop_data();
     void loop();
+    void batchLoop();
+    void recycledDatagramLoop();
     void ipv6Loop_data();
     void ipv6Loop();
     void dualStack();
@@ -533,6 +537,65 @@ void tst_QUdpSocket::loop()
 
 //----------------------------------------------------------------------------------
 
+void tst_QUdpSocket::batchLoop()
+{
+    QUdpSocket sender;
+    QUdpSocket receiver;
+
+    QHostAddress localhost = QHostAddress::LocalHost;
+    QVERIFY2(receiver.bind(localhost), receiver.errorString().toLatin1().constData());
+    QHostAddress receiverAddress = makeNonAny(receiver.localAddress());
+
+    constexpr qsizetype DatagramCount = 5;
+    QList<QNetworkDatagram> batch;
+    for (qsizetype i = 0; i < DatagramCount; ++i) {
+        QNetworkDatagram datagram("batch " + QByteArray::number(i));
+        datagram.setDestination(receiverAddress, receiver.localPort());
+        batch.append(datagram);
+    }
+    QCOMPARE(sender.writeDatagrams(batch), DatagramCount);
+
+    QList<QNetworkDatagram> received;
+    while (received.size() < DatagramCount && receiver.waitForReadyRead(9000))
+        received += receiver.receiveDatagrams();
+    QCOMPARE(received.size(), DatagramCount);
+
+    QList<QByteArray> payloads;
+    for (const QNetworkDatagram &datagram : std::as_const(received)) {
+        QCOMPARE(datagram.senderPort(), int(sender.localPort()));
+        payloads.append(datagram.data());
+    }
+    std::sort(payloads.begin(), payloads.end());
+    for (qsizetype i = 0; i < DatagramCount; ++i)
+        QCOMPARE(payloads.at(i), "batch " + QByteArray::number(i));
+}
+
+//----------------------------------------------------------------------------------
+
+void tst_QUdpSocket::recycledDatagramLoop()
+{
+    QUdpSocket sender;
+    QUdpSocket receiver;
+
+    QHostAddress localhost = QHostAddress::LocalHost;
+    QVERIFY2(receiver.bind(localhost), receiver.errorString().toLatin1().constData());
+    QHostAddress receiverAddress = makeNonAny(receiver.localAddress());
+
+    QNetworkDatagram datagram; // reused for every receive
+    for (int i = 0; i < 3; ++i) {
+        const QByteArray message = "recycled " + QByteArray::number(i);
+        QCOMPARE(sender.writeDatagram(message, receiverAddress, receiver.localPort()),
+                 qint64(message.size()));
+
+        QVERIFY(receiver.waitForReadyRead(9000));
+        QCOMPARE(receiver.receiveDatagram(&datagram), qint64(message.size()));
+        QCOMPARE(datagram.data(), message);
+        QCOMPARE(datagram.senderPort(), int(sender.localPort()));
+    }
+}
+
+//----------------------------------------------------------------------------------
+
 void tst_QUdpSocket::ipv6Loop_data()
 {
     loop_data();
@@ -0,0 +1,177 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+#include <QTemporaryDir>
+
+#include <QtNetwork/qsslconfiguration.h>
+#include <private/qsslconfiguration_p.h>
+
+#include <QtCore/qdatastream.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qfile.h>
+
+using namespace Qt::StringLiterals;
+
+// Exercises the persistent TLS session ticket store through the private
+// load/store entry points, without any network activity.
+class tst_QSslSessionStore : public QObject
+{
+    Q_OBJECT
+
+    // must match QTlsPersistentSessionStore in qsslconfiguration.cpp
+    static constexpr quint32 FileMagic = 0x51'54'4c'53;
+    static constexpr quint32 FileVersion = 1;
+    static constexpr qsizetype MaxEntries = 4096;
+
+    struct RawEntry
+    {
+        QString key;
+        QByteArray ticket;
+        qint64 expiresAt;
+    };
+    static void writeStoreFile(const QString &path, const QList<RawEntry> &entries);
+
+    QTemporaryDir tempDir;
+    QString storePath;
+
+private slots:
+    void initTestCase();
+    void cleanup();
+
+    void storeAndTake();
+    void persistsAcrossReload();
+    void expiredTicketsNotLoaded();
+    void corruptFileIgnored();
+    void eviction();
+    void filePermissions();
+};
+
+void tst_QSslSessionStore::writeStoreFile(const QString &path, const QList<RawEntry> &entries)
+{
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QDataStream stream(&file);
+    stream << FileMagic << FileVersion << quint32(entries.size());
+    for (const RawEntry &entry : entries)
+        stream << entry.key << entry.ticket << entry.expiresAt;
+}
+
+void tst_QSslSessionStore::initTestCase()
+{
+    QVERIFY(tempDir.isValid());
+    storePath = tempDir.filePath(u"tickets.store"_s);
+}
+
+void tst_QSslSessionStore::cleanup()
+{
+    // the store is process-global; detach it from the file and drop its
+    // in-memory entries between tests
+    QSslConfiguration::setPersistentSessionStorePath(QString());
+    QFile::remove(storePath);
+}
+
+void tst_QSslSessionStore::storeAndTake()
+{
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+    QVERIFY(QSslConfigurationPrivate::persistentSessionStoreEnabled());
+
+    QSslConfigurationPrivate::storeSessionTicket(u"Example.COM"_s, 443, "ticket-1", 60);
+
+    // keys are case-insensitive in the host part; tickets are single-use
+    QCOMPARE(QSslConfigurationPrivate::takeStoredSessionTicket(u"example.com"_s, 443),
+             QByteArray("ticket-1"));
+    QVERIFY(QSslConfigurationPrivate::takeStoredSessionTicket(u"example.com"_s, 443).isEmpty());
+
+    // different port is a different session
+    QSslConfigurationPrivate::storeSessionTicket(u"example.com"_s, 443, "ticket-2", 60);
+    QVERIFY(QSslConfigurationPrivate::takeStoredSessionTicket(u"example.com"_s, 8443).isEmpty());
+}
+
+void tst_QSslSessionStore::persistsAcrossReload()
+{
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+    QSslConfigurationPrivate::storeSessionTicket(u"example.com"_s, 443, "ticket-1", 60);
+
+    // detaching and re-attaching the store forces a reload from disk, as a
+    // fresh process would do
+    QSslConfiguration::setPersistentSessionStorePath(QString());
+    QVERIFY(!QSslConfigurationPrivate::persistentSessionStoreEnabled());
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+
+    QCOMPARE(QSslConfigurationPrivate::takeStoredSessionTicket(u"example.com"_s, 443),
+             QByteArray("ticket-1"));
+}
+
+void tst_QSslSessionStore::expiredTicketsNotLoaded()
+{
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    writeStoreFile(storePath, { { u"expired.example.com:443"_s, "stale", now - 1000 },
+                                { u"valid.example.com:443"_s, "fresh", now + 60'000 } });
+
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+    QVERIFY(QSslConfigurationPrivate::takeStoredSessionTicket(u"expired.example.com"_s, 443)
+                    .isEmpty());
+    QCOMPARE(QSslConfigurationPrivate::takeStoredSessionTicket(u"valid.example.com"_s, 443),
+             QByteArray("fresh"));
+}
+
+void tst_QSslSessionStore::corruptFileIgnored()
+{
+    QFile file(storePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("not a ticket store");
+    file.close();
+
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+    QVERIFY(QSslConfigurationPrivate::takeStoredSessionTicket(u"example.com"_s, 443).isEmpty());
+
+    // the store stays usable and overwrites the corrupt file
+    QSslConfigurationPrivate::storeSessionTicket(u"example.com"_s, 443, "ticket-1", 60);
+    QCOMPARE(QSslConfigurationPrivate::takeStoredSessionTicket(u"example.com"_s, 443),
+             QByteArray("ticket-1"));
+}
+
+void tst_QSslSessionStore::eviction()
+{
+    // fill the store to its bound with staggered expiries; inserting one more
+    // ticket must evict the soonest-expiring entry and nothing else
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    QList<RawEntry> entries;
+    entries.reserve(MaxEntries);
+    for (qsizetype i = 0; i < MaxEntries; ++i) {
+        entries.append({ u"host%1.example.com:443"_s.arg(i),
+                         "ticket-" + QByteArray::number(i),
+                         now + 60'000 + i * 1000 });
+    }
+    writeStoreFile(storePath, entries);
+
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+    QSslConfigurationPrivate::storeSessionTicket(u"new.example.com"_s, 443, "newest", 7200);
+
+    QVERIFY(QSslConfigurationPrivate::takeStoredSessionTicket(u"host0.example.com"_s, 443)
+                    .isEmpty());
+    QCOMPARE(QSslConfigurationPrivate::takeStoredSessionTicket(u"host1.example.com"_s, 443),
+             QByteArray("ticket-1"));
+    QCOMPARE(QSslConfigurationPrivate::takeStoredSessionTicket(u"new.example.com"_s, 443),
+             QByteArray("newest"));
+}
+
+void tst_QSslSessionStore::filePermissions()
+{
+#ifndef Q_OS_UNIX
+    QSKIP("File permissions are only enforced meaningfully on Unix systems");
+#else
+    QSslConfiguration::setPersistentSessionStorePath(storePath);
+    QSslConfigurationPrivate::storeSessionTicket(u"example.com"_s, 443, "secret", 60);
+
+    const QFileDevice::Permissions permissions = QFile::permissions(storePath);
+    QVERIFY(permissions & QFileDevice::ReadOwner);
+    QVERIFY(!(permissions
+              & (QFileDevice::ReadGroup | QFileDevice::WriteGroup | QFileDevice::ExeGroup
+                 | QFileDevice::ReadOther | QFileDevice::WriteOther | QFileDevice::ExeOther)));
+#endif
+}
+
+QTEST_MAIN(tst_QSslSessionStore)
+#include "tst_qsslsessionstore.moc"
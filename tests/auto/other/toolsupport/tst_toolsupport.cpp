@@ -118,9 +118,9 @@ void tst_toolsupport::offsets_data()
 #ifdef Q_PROCESSOR_X86_32
         // x86 32-bit has weird alignment rules. Refer to QtPrivate::AlignOf in
         // qglobal.h for more details.
-        data << 264 << -1;
+        data << 276 << -1;
 #else
-        data << 300 << 424;
+        data << 312 << 448;
 #endif
     }
 #endif
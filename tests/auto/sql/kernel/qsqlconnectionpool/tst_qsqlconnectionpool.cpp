@@ -0,0 +1,155 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+#include <QTest>
+
+#include <QtSql/qsqlconnectionpool.h>
+#include <QtSql/qsqldatabase.h>
+#include <QtSql/qsqlquery.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qregularexpression.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtCore/qthread.h>
+
+class tst_QSqlConnectionPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void acquireAndRelease();
+    void boundedSize();
+    void invalidSource();
+    void multipleThreads();
+
+private:
+    QTemporaryDir m_tempDir;
+    QString m_sourceName;
+};
+
+void tst_QSqlConnectionPool::initTestCase()
+{
+    if (!QSqlDatabase::drivers().contains(QLatin1String("QSQLITE")))
+        QSKIP("Database driver QSQLITE not available");
+    QVERIFY(m_tempDir.isValid());
+
+    m_sourceName = QLatin1String("pool_source");
+    QSqlDatabase db = QSqlDatabase::addDatabase(QLatin1String("QSQLITE"), m_sourceName);
+    db.setDatabaseName(m_tempDir.filePath(QLatin1String("pool.sqlite")));
+    QVERIFY(db.open());
+    QSqlQuery q(db);
+    QVERIFY(q.exec(QLatin1String("create table pool_test(id integer primary key)")));
+    QVERIFY(q.exec(QLatin1String("insert into pool_test values(42)")));
+}
+
+void tst_QSqlConnectionPool::cleanupTestCase()
+{
+    if (!m_sourceName.isEmpty())
+        QSqlDatabase::removeDatabase(m_sourceName);
+}
+
+void tst_QSqlConnectionPool::acquireAndRelease()
+{
+    QSqlConnectionPool pool(m_sourceName, 2);
+    QCOMPARE(pool.sourceConnectionName(), m_sourceName);
+    QCOMPARE(pool.maxConnections(), 2);
+    QCOMPARE(pool.openConnections(), 0);
+
+    QString firstName;
+    {
+        QSqlConnectionPool::Connection lease = pool.acquire();
+        QVERIFY(lease.isValid());
+        QSqlDatabase db = lease.database();
+        QVERIFY(db.isOpen());
+        firstName = db.connectionName();
+        QSqlQuery q(db);
+        QVERIFY(q.exec(QLatin1String("select id from pool_test")));
+        QVERIFY(q.next());
+        QCOMPARE(q.value(0).toInt(), 42);
+        QCOMPARE(pool.openConnections(), 1);
+    }
+
+    // the same thread gets its connection back
+    QSqlConnectionPool::Connection lease = pool.acquire();
+    QVERIFY(lease.isValid());
+    QCOMPARE(lease.database().connectionName(), firstName);
+    QCOMPARE(pool.openConnections(), 1);
+
+    // a moved-from lease does not release twice
+    QSqlConnectionPool::Connection moved = std::move(lease);
+    QVERIFY(moved.isValid());
+    QVERIFY(!lease.isValid());
+}
+
+void tst_QSqlConnectionPool::boundedSize()
+{
+    QSqlConnectionPool pool(m_sourceName, 2);
+    QSqlConnectionPool::Connection first = pool.acquire();
+    QSqlConnectionPool::Connection second = pool.acquire();
+    QVERIFY(first.isValid());
+    QVERIFY(second.isValid());
+    QCOMPARE(pool.openConnections(), 2);
+
+    // pool exhausted: acquire() with a deadline times out
+    QSqlConnectionPool::Connection third = pool.acquire(QDeadlineTimer(50));
+    QVERIFY(!third.isValid());
+
+    // releasing one connection lets the next acquire() through
+    second = QSqlConnectionPool::Connection();
+    QSqlConnectionPool::Connection fourth = pool.acquire(QDeadlineTimer(5000));
+    QVERIFY(fourth.isValid());
+    QCOMPARE(pool.openConnections(), 2);
+}
+
+void tst_QSqlConnectionPool::invalidSource()
+{
+    QSqlConnectionPool pool(QLatin1String("no_such_connection"), 2);
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(
+            QLatin1String("unable to open connection")));
+    QSqlConnectionPool::Connection lease = pool.acquire(QDeadlineTimer(50));
+    QVERIFY(!lease.isValid());
+    QVERIFY(!lease.database().isValid());
+    QCOMPARE(pool.openConnections(), 0);
+}
+
+void tst_QSqlConnectionPool::multipleThreads()
+{
+    constexpr int ThreadCount = 4;
+    QSqlConnectionPool pool(m_sourceName, ThreadCount);
+
+    QSemaphore done;
+    QAtomicInt failures;
+    QList<QThread *> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.append(QThread::create([&]() {
+            for (int i = 0; i < 20; ++i) {
+                QSqlConnectionPool::Connection lease = pool.acquire(QDeadlineTimer(30000));
+                if (!lease.isValid()) {
+                    failures.ref();
+                    break;
+                }
+                QSqlQuery q(lease.database());
+                if (!q.exec(QLatin1String("select id from pool_test"))
+                    || !q.next() || q.value(0).toInt() != 42) {
+                    failures.ref();
+                    break;
+                }
+            }
+            done.release();
+        }));
+    }
+    for (QThread *thread : threads)
+        thread->start();
+    QVERIFY(done.tryAcquire(ThreadCount, 60000));
+    for (QThread *thread : threads) {
+        QVERIFY(thread->wait(30000));
+        delete thread;
+    }
+    QCOMPARE(failures.loadRelaxed(), 0);
+}
+
+QTEST_MAIN(tst_QSqlConnectionPool)
+#include "tst_qsqlconnectionpool.moc"
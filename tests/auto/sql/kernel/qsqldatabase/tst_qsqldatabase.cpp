@@ -170,6 +170,8 @@ private slots:
 
     void sqlite_enableRegexp_data() { generic_data("QSQLITE"); }
     void sqlite_enableRegexp();
+    void sqlite_perfConnectOptions_data() { generic_data("QSQLITE"); }
+    void sqlite_perfConnectOptions();
 
     void sqlite_openError();
 
@@ -2218,6 +2220,48 @@ void tst_QSqlDatabase::sqlite_enableRegexp()
     QFAIL_SQL(q, next());
 }
 
+void tst_QSqlDatabase::sqlite_perfConnectOptions()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    db.close();
+    db.setConnectOptions("QSQLITE_ENABLE_WAL;QSQLITE_SYNCHRONOUS=NORMAL;"
+                         "QSQLITE_MMAP_SIZE=1048576;QSQLITE_STATEMENT_CACHE_SIZE=10");
+    QVERIFY_SQL(db, open());
+
+    QSqlQuery q(db);
+    if (!db.databaseName().contains(":memory:")) {
+        QVERIFY_SQL(q, exec("PRAGMA journal_mode"));
+        QVERIFY_SQL(q, next());
+        QCOMPARE(q.value(0).toString().toLower(), QString("wal"));
+    }
+    QVERIFY_SQL(q, exec("PRAGMA synchronous"));
+    QVERIFY_SQL(q, next());
+    QCOMPARE(q.value(0).toInt(), 1); // NORMAL
+
+    // re-preparing the same statement text must hit the statement cache
+    // and still produce correct results
+    TableScope ts(db, "qtest_stmtcache", __FILE__);
+    QVERIFY_SQL(q, exec(QString("CREATE TABLE %1(id INTEGER)").arg(ts.tableName())));
+    const QString insert = QString("INSERT INTO %1 VALUES(?)").arg(ts.tableName());
+    for (int i = 0; i < 3; ++i) {
+        QSqlQuery q2(db);
+        QVERIFY_SQL(q2, prepare(insert));
+        q2.addBindValue(i);
+        QVERIFY_SQL(q2, exec());
+    }
+    QVERIFY_SQL(q, exec(QString("SELECT COUNT(*), SUM(id) FROM %1").arg(ts.tableName())));
+    QVERIFY_SQL(q, next());
+    QCOMPARE(q.value(0).toInt(), 3);
+    QCOMPARE(q.value(1).toInt(), 3);
+
+    q.clear();
+    db.close();
+    db.setConnectOptions();
+    QVERIFY_SQL(db, open());
+}
+
 void tst_QSqlDatabase::sqlite_openError()
 {
     // see QTBUG-70506
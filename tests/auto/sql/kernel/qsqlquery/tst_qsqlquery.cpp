@@ -52,6 +52,10 @@ private slots:
     void first();
     void next_data() { generic_data(); }
     void next();
+    void fetchRows_data() { generic_data(); }
+    void fetchRows();
+    void queryStatistics_data() { generic_data(); }
+    void queryStatistics();
     void prev_data() { generic_data(); }
     void prev();
     void last_data() { generic_data(); }
@@ -62,6 +66,8 @@ private slots:
     void record();
     void record_sqlite_data() { generic_data("QSQLITE"); }
     void record_sqlite();
+    void sqlite_lobDevice_data() { generic_data("QSQLITE"); }
+    void sqlite_lobDevice();
     void finish_data() { generic_data(); }
     void finish();
     void sqlite_finish_data() { generic_data("QSQLITE"); }
@@ -1271,6 +1277,105 @@ void tst_QSqlQuery::next()
     QCOMPARE(q.at(), 1);
 }
 
+void tst_QSqlQuery::fetchRows()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    // collect the reference rows one at a time
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec("select * from " + qtest + " order by id"));
+    QList<QVariantList> expected;
+    while (q.next()) {
+        QVariantList row;
+        for (int i = 0; i < q.record().count(); ++i)
+            row.append(q.value(i));
+        expected.append(row);
+    }
+    QVERIFY(expected.size() > 1);
+
+    // fetching everything in one call must yield the same rows
+    QVERIFY_SQL(q, exec("select * from " + qtest + " order by id"));
+    QCOMPARE(q.at(), QSql::BeforeFirstRow);
+    QCOMPARE(q.fetchRows(), expected);
+    QCOMPARE(q.at(), QSql::AfterLastRow);
+    QCOMPARE(q.fetchRows(), QList<QVariantList>());
+
+    // maxRows limits the batch and leaves the position on the last row
+    QVERIFY_SQL(q, exec("select * from " + qtest + " order by id"));
+    QCOMPARE(q.fetchRows(1), expected.mid(0, 1));
+    QCOMPARE(q.at(), 0);
+    QCOMPARE(q.fetchRows(), expected.mid(1));
+
+    // forward-only queries are drained the same way
+    q.setForwardOnly(true);
+    QVERIFY_SQL(q, exec("select * from " + qtest + " order by id"));
+    QCOMPARE(q.fetchRows(), expected);
+
+    // inactive queries return nothing
+    QSqlQuery inactive(db);
+    QCOMPARE(inactive.fetchRows(), QList<QVariantList>());
+}
+
+void tst_QSqlQuery::queryStatistics()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    QSqlDriver *drv = db.driver();
+    QList<QSqlDriver::QueryStatistics> stats;
+    drv->setQueryStatisticsHandler([&stats](const QSqlDriver::QueryStatistics &s) {
+        stats.append(s);
+    });
+    const auto resetHandler = qScopeGuard([drv] { drv->setQueryStatisticsHandler(nullptr); });
+
+    // direct execution reports the statement text and the execute time
+    QSqlQuery q(db);
+    const QString selectQuery = "select * from " + qtest + " order by id";
+    QVERIFY_SQL(q, exec(selectQuery));
+    QCOMPARE(stats.size(), 1);
+    QCOMPARE(stats.at(0).statement, selectQuery);
+    QCOMPARE(stats.at(0).boundValues, 0);
+    QCOMPARE(stats.at(0).prepareNsecs, -1);
+    QVERIFY(stats.at(0).executeNsecs >= 0);
+    QVERIFY(stats.at(0).success);
+    if (drv->hasFeature(QSqlDriver::QuerySize))
+        QVERIFY(stats.at(0).resultSize > 0);
+
+    // prepared execution adds the prepare time and the bound value count
+    QVERIFY_SQL(q, prepare("select * from " + qtest + " where id = ?"));
+    q.addBindValue(1);
+    QVERIFY_SQL(q, exec());
+    QCOMPARE(stats.size(), 2);
+    QCOMPARE(stats.at(1).boundValues, 1);
+    QVERIFY(stats.at(1).prepareNsecs >= 0);
+    QVERIFY(stats.at(1).executeNsecs >= 0);
+    QVERIFY(stats.at(1).success);
+
+    // failed executions are reported as well
+    QVERIFY(!q.exec("blahfasel"));
+    QCOMPARE(stats.size(), 3);
+    QVERIFY(!stats.at(2).success);
+
+    // uninstalling the handler stops the reporting
+    drv->setQueryStatisticsHandler(nullptr);
+    QVERIFY_SQL(q, exec(selectQuery));
+    QCOMPARE(stats.size(), 3);
+
+    // the explain helper returns a plan for DBMSes with an explain statement
+    switch (drv->dbmsType()) {
+    case QSqlDriver::SQLite:
+    case QSqlDriver::PostgreSQL:
+    case QSqlDriver::MySqlServer:
+        QVERIFY(!drv->explainStatement(selectQuery).isEmpty());
+        break;
+    default:
+        break;
+    }
+}
+
 void tst_QSqlQuery::prev()
 {
     QFETCH(QString, dbName);
@@ -2662,6 +2767,44 @@ void tst_QSqlQuery::oraArrayBind()
 /* Tests that QSqlDatabase::record() and QSqlQuery::record() return the same
    thing - otherwise our models get confused.
 */
+void tst_QSqlQuery::sqlite_lobDevice()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    TableScope ts(db, "lobDevice", __FILE__);
+    QSqlQuery q(db);
+    QVERIFY_SQL(q, exec(QLatin1String("create table %1 (id integer primary key, data blob)")
+                        .arg(ts.tableName())));
+    QByteArray payload(1 << 16, '\0');
+    for (qsizetype i = 0; i < payload.size(); ++i)
+        payload[i] = char(i % 251);
+    QVERIFY_SQL(q, prepare(QLatin1String("insert into %1 values (1, ?)").arg(ts.tableName())));
+    q.addBindValue(payload);
+    QVERIFY_SQL(q, exec());
+
+    // without a rowid in the result set streaming is unavailable
+    QVERIFY_SQL(q, exec(QLatin1String("select data from %1").arg(ts.tableName())));
+    QVERIFY_SQL(q, next());
+    QVERIFY(!q.lobDevice(0));
+
+    QVERIFY_SQL(q, exec(QLatin1String("select rowid, data from %1").arg(ts.tableName())));
+    QVERIFY_SQL(q, next());
+    QScopedPointer<QIODevice> blob(q.lobDevice(1));
+    QVERIFY(!blob.isNull());
+    QVERIFY(blob->isOpen());
+    QCOMPARE(blob->size(), qint64(payload.size()));
+
+    QByteArray streamed;
+    while (!blob->atEnd())
+        streamed += blob->read(4096);
+    QCOMPARE(streamed, payload);
+
+    QVERIFY(blob->seek(100));
+    QCOMPARE(blob->read(16), payload.mid(100, 16));
+}
+
 void tst_QSqlQuery::record_sqlite()
 {
     QFETCH(QString, dbName);
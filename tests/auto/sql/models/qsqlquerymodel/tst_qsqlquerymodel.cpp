@@ -46,6 +46,8 @@ private slots:
     void setHeaderData();
     void fetchMore_data() { generic_data(); }
     void fetchMore();
+    void windowedFetch_data() { generic_data(); }
+    void windowedFetch();
 
     //problem specific tests
     void withSortFilterProxyModel_data() { generic_data(); }
@@ -466,6 +468,45 @@ void tst_QSqlQueryModel::fetchMore()
     }
 }
 
+void tst_QSqlQueryModel::windowedFetch()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QSqlDriver::DbmsType dbType = tst_Databases::getDatabaseType(db);
+    if (dbType != QSqlDriver::SQLite && dbType != QSqlDriver::PostgreSQL
+        && dbType != QSqlDriver::MySqlServer) {
+        QSKIP("Test requires a database with LIMIT/OFFSET support.");
+    }
+
+    QSqlQueryModel model;
+    QCOMPARE(model.fetchWindowSize(), 0);
+    model.setFetchWindowSize(16);
+    QCOMPARE(model.fetchWindowSize(), 16);
+
+    QSignalSpy modelResetSpy(&model, SIGNAL(modelReset()));
+    model.setQuery("select id, name from " + qTableName("many", __FILE__, db)
+                   + " order by id", db);
+    QCOMPARE(modelResetSpy.size(), 1);
+
+    // the full row count is known up front, without fetchMore()
+    QCOMPARE(model.rowCount(), 2048);
+    QVERIFY(!model.canFetchMore());
+    QCOMPARE(model.columnCount(), 2);
+    QCOMPARE(model.headerData(0, Qt::Horizontal).toString().toLower(), QString("id"));
+
+    // rows far apart go through different windows
+    QCOMPARE(model.data(model.index(0, 0)).toInt(), 0);
+    QCOMPARE(model.data(model.index(2000, 0)).toInt(), 2000);
+    QCOMPARE(model.data(model.index(2000, 1)).toString(), QString("harry"));
+    QCOMPARE(model.data(model.index(42, 0)).toInt(), 42);
+    QCOMPARE(model.data(model.index(2047, 0)).toInt(), 2047);
+    QVERIFY(!model.data(model.index(2048, 0)).isValid());
+
+    // record() goes through data() and must see windowed values too
+    QCOMPARE(model.record(1234).value(0).toInt(), 1234);
+}
+
 // For task 149491: When used with QSortFilterProxyModel, a view and a
 // database that doesn't support the QuerySize feature, blank rows was
 // appended if the query returned more than 256 rows and setQuery()
@@ -98,6 +98,7 @@ private slots:
 
     void checkIntersectedRect_data();
     void checkIntersectedRect();
+    void batchedUpdates();
 
     void task221955_selectedEditor();
     void task250754_fontChange();
@@ -1236,6 +1237,50 @@ void tst_QAbstractItemView::checkIntersectedRect()
     }
 }
 
+void tst_QAbstractItemView::batchedUpdates()
+{
+    QStandardItemModel model(50, 2);
+    for (int r = 0; r < 50; ++r)
+        for (int c = 0; c < 2; ++c)
+            model.setData(model.index(r, c), QString("%1/%2").arg(r).arg(c));
+
+    QTableView view;
+    view.setModel(&model);
+    view.resize(400, 400);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QVERIFY(!view.batchedUpdates());
+    view.setBatchedUpdates(true);
+    QVERIFY(view.batchedUpdates());
+
+    auto *av = static_cast<QAbstractItemViewPrivate *>(qt_widget_private(&view));
+    QVERIFY(av->pendingDataChangedRanges.isEmpty());
+
+    model.setData(model.index(0, 0), QStringLiteral("a"));
+    model.setData(model.index(1, 0), QStringLiteral("b"));
+    model.setData(model.index(1, 0), QStringLiteral("c")); // same range, coalesced
+    QCOMPARE(av->pendingDataChangedRanges.size(), 2);
+    QVERIFY(!av->pendingDataChangedAll);
+
+    view.flushBatchedUpdates();
+    QVERIFY(av->pendingDataChangedRanges.isEmpty());
+
+    // too many distinct ranges fold into one full-viewport update
+    for (int r = 0; r < 40; ++r)
+        model.setData(model.index(r, 1), QString::number(r));
+    QVERIFY(av->pendingDataChangedAll);
+    QVERIFY(av->pendingDataChangedRanges.isEmpty());
+    view.flushBatchedUpdates();
+    QVERIFY(!av->pendingDataChangedAll);
+
+    // switching the mode off flushes whatever is still pending
+    model.setData(model.index(2, 0), QStringLiteral("d"));
+    QCOMPARE(av->pendingDataChangedRanges.size(), 1);
+    view.setBatchedUpdates(false);
+    QVERIFY(av->pendingDataChangedRanges.isEmpty());
+}
+
 void tst_QAbstractItemView::task221955_selectedEditor()
 {
     if (!QGuiApplicationPrivate::platformIntegration()->hasCapability(QPlatformIntegration::WindowActivation))
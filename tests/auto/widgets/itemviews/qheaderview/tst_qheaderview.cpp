@@ -119,6 +119,7 @@ private slots:
 
     void resizeSection_data();
     void resizeSection();
+    void resizeSectionsBatch();
 
     void resizeAndMoveSection_data();
     void resizeAndMoveSection();
@@ -1297,6 +1298,40 @@ void tst_QHeaderView::resizeSection()
         QCOMPARE(view->sectionSize(logical.at(l)), expected.at(l));
 }
 
+void tst_QHeaderView::resizeSectionsBatch()
+{
+    view->setStretchLastSection(false);
+    for (int i = 0; i < view->count(); ++i)
+        view->resizeSection(i, 50);
+
+    QSignalSpy spy(view, &QHeaderView::sectionResized);
+
+    // entries beyond count() and negative entries are ignored,
+    // unchanged sections do not emit sectionResized
+    view->resizeSections(IntList{ 30, -1, 50, 40, 99, 99 });
+    QCOMPARE(spy.size(), 2);
+    QCOMPARE(view->sectionSize(0), 30);
+    QCOMPARE(view->sectionSize(1), 50);
+    QCOMPARE(view->sectionSize(2), 50);
+    QCOMPARE(view->sectionSize(3), 40);
+
+    // positions stay consistent with the new sizes
+    int pos = 0;
+    for (int i = 0; i < view->count(); ++i) {
+        QCOMPARE(view->sectionPosition(i), pos);
+        QCOMPARE(view->logicalIndexAt(pos), i);
+        pos += view->sectionSize(i);
+    }
+    QCOMPARE(view->length(), pos);
+
+    // hidden sections store the size for when they are shown again
+    view->setSectionHidden(1, true);
+    view->resizeSections(IntList{ 30, 60, 50, 40 });
+    QCOMPARE(view->sectionSize(1), 0);
+    view->setSectionHidden(1, false);
+    QCOMPARE(view->sectionSize(1), 60);
+}
+
 void tst_QHeaderView::highlightSections()
 {
     view->setHighlightSections(true);
@@ -103,6 +103,8 @@ private slots:
     void modelColumn();
     void hideFirstRow();
     void batchedMode();
+    void virtualizedMode();
+    void virtualizedModeFallbacks();
     void setCurrentIndex();
     void selection_data();
     void selection();
@@ -888,6 +890,118 @@ void tst_QListView::batchedMode()
     QTRY_COMPARE(modelIndexCount(&view), rowCount);
 }
 
+class VirtualizedTestModel : public QAbstractListModel
+{
+public:
+    using QAbstractListModel::QAbstractListModel;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    { return parent.isValid() ? 0 : 1000000; }
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override
+    {
+        if (!index.isValid() || role != Qt::DisplayRole)
+            return QVariant();
+        return QString::number(index.row());
+    }
+};
+
+void tst_QListView::virtualizedMode()
+{
+    VirtualizedTestModel model;
+    const int rowCount = model.rowCount();
+
+    PublicListView view;
+    view.setWindowTitle(QTest::currentTestFunction());
+    view.setViewMode(QListView::ListMode);
+    view.setLayoutMode(QListView::Virtualized);
+    view.setVerticalScrollMode(QAbstractItemView::ScrollPerItem);
+    view.setModel(&model);
+    view.resize(250, 300);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    const QRect first = view.visualRect(model.index(0, 0));
+    const QRect second = view.visualRect(model.index(1, 0));
+    QVERIFY(first.isValid());
+    const int extent = second.y() - first.y();
+    QCOMPARE_GT(extent, 0);
+
+    // item geometry is computed arithmetically from the row number, for rows
+    // far beyond anything that has been displayed
+    const int middle = rowCount / 2;
+    QCOMPARE(view.visualRect(model.index(middle, 0)).y(), first.y() + middle * extent);
+    QCOMPARE(view.visualRect(model.index(rowCount - 1, 0)).y(),
+             first.y() + (rowCount - 1) * extent);
+    QCOMPARE_GE(view.contentsSize().height(), rowCount * extent);
+
+    // indexAt() is the inverse of visualRect()
+    QCOMPARE(view.indexAt(first.center()), model.index(0, 0));
+    QCOMPARE(view.indexAt(second.center()), model.index(1, 0));
+
+    // the scroll bar operates in pixels even in per-item scroll mode, so its
+    // range covers the whole contents area
+    QScrollBar *vbar = view.verticalScrollBar();
+    QCOMPARE_GT(vbar->maximum(), rowCount);
+    vbar->setValue(extent);
+    QCOMPARE(view.visualRect(model.index(0, 0)).y(), first.y() - extent);
+    vbar->setValue(0);
+
+    // scrolling to a distant row lands on it
+    view.scrollTo(model.index(middle, 0), QAbstractItemView::PositionAtTop);
+    QCOMPARE(view.indexAt(QPoint(first.center().x(), first.y() + extent / 2)).row(), middle);
+}
+
+void tst_QListView::virtualizedModeFallbacks()
+{
+    QStringListModel model(generateList(QLatin1String("item "), 12));
+
+    PublicListView virtualized;
+    PublicListView reference;
+    for (PublicListView *view : {&virtualized, &reference}) {
+        view->setWindowTitle(QTest::currentTestFunction());
+        view->setViewMode(QListView::ListMode);
+        view->setModel(&model);
+        view->resize(200, 150);
+    }
+    virtualized.setLayoutMode(QListView::Virtualized);
+    reference.setLayoutMode(QListView::SinglePass);
+
+    const auto compareLayouts = [&] {
+        for (int row = 0; row < model.rowCount(); ++row) {
+            const QModelIndex index = model.index(row, 0);
+            QCOMPARE(virtualized.visualRect(index), reference.visualRect(index));
+        }
+    };
+
+    // wrapping is not representable arithmetically and falls back to the
+    // single-pass static layout
+    for (PublicListView *view : {&virtualized, &reference}) {
+        view->setWrapping(true);
+        view->show();
+    }
+    QVERIFY(QTest::qWaitForWindowExposed(&virtualized));
+    QVERIFY(QTest::qWaitForWindowExposed(&reference));
+    compareLayouts();
+    if (QTest::currentTestFailed())
+        return;
+
+    // so do hidden rows
+    for (PublicListView *view : {&virtualized, &reference}) {
+        view->setWrapping(false);
+        view->setRowHidden(2, true);
+    }
+    compareLayouts();
+    if (QTest::currentTestFailed())
+        return;
+    QVERIFY(!virtualized.visualRect(model.index(2, 0)).isValid());
+
+    // and in IconMode the mode behaves like SinglePass
+    for (PublicListView *view : {&virtualized, &reference}) {
+        view->setRowHidden(2, false);
+        view->setViewMode(QListView::IconMode);
+    }
+    compareLayouts();
+}
+
 void tst_QListView::setCurrentIndex()
 {
     QStringListModel model(generateList(QLatin1String("item "), 20));
@@ -268,6 +268,7 @@ private slots:
     void fastMove();
     void moveAccross();
     void moveInOutOverlapped();
+    void cachedSubtreeLayer();
 
 protected:
     /*
@@ -1042,6 +1043,60 @@ void tst_QWidgetRepaintManager::moveInOutOverlapped()
     QVERIFY(waitForFlush(&scene));
     QVERIFY(compareWidget(&scene));
 }
+
+/*!
+    A widget with Qt::WA_CachedSubtreeLayer serves repaints of unchanged
+    areas from its retained layer instead of sending new paint events, and
+    the blitted result must match a full render.
+*/
+void tst_QWidgetRepaintManager::cachedSubtreeLayer()
+{
+    if (QStringList{"android"}.contains(QGuiApplication::platformName()))
+        QSKIP("This test fails on Android");
+
+    TestWidget widget;
+    widget.initialShow();
+
+    TestWidget *cached = new TestWidget(&widget);
+    cached->setAttribute(Qt::WA_OpaquePaintEvent);
+    cached->setAttribute(Qt::WA_CachedSubtreeLayer);
+    cached->move(20, 20);
+    cached->show();
+    QVERIFY(cached->waitForPainted());
+    widget.takePaintedRegions();
+    cached->takePaintedRegions();
+
+    // repainting the parent over the cached child is served from the layer;
+    // the subtree gets no paint event, and the blit matches a full render
+    widget.update();
+    QVERIFY(widget.waitForPainted());
+    widget.takePaintedRegions();
+    QCOMPARE(cached->takePaintedRegions(), QRegion());
+    QVERIFY(compareWidget(&widget));
+
+    // updating the cached widget invalidates the layer and repaints once
+    cached->update();
+    QVERIFY(cached->waitForPainted());
+    QCOMPARE(cached->takePaintedRegions(), QRegion(cached->rect()));
+    QVERIFY(compareWidget(&widget));
+
+    // after which the layer is valid again
+    widget.update();
+    QVERIFY(widget.waitForPainted());
+    widget.takePaintedRegions();
+    QCOMPARE(cached->takePaintedRegions(), QRegion());
+
+    // a widget that doesn't paint all its pixels can't use the layer and
+    // paints normally
+    cached->setAttribute(Qt::WA_OpaquePaintEvent, false);
+    cached->update();
+    QVERIFY(cached->waitForPainted());
+    cached->takePaintedRegions();
+    widget.update();
+    QVERIFY(widget.waitForPainted());
+    QCOMPARE(cached->takePaintedRegions(), QRegion(cached->rect()));
+    QVERIFY(compareWidget(&widget));
+}
 #endif //# defined(QT_BUILD_INTERNAL)
 
 QTEST_MAIN(tst_QWidgetRepaintManager)
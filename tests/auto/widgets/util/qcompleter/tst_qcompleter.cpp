@@ -107,6 +107,7 @@ private slots:
     void setters();
 
     void dynamicSortOrder();
+    void incrementalFiltering();
     void disabledItems();
 
     void hideWidget();
@@ -1159,6 +1160,36 @@ void tst_QCompleter::dynamicSortOrder()
     QCOMPARE(completer.completionCount(), 12);
 }
 
+void tst_QCompleter::incrementalFiltering()
+{
+    // spread a few matches over enough rows for several filter slices
+    QStringList list;
+    for (int i = 0; i < 30000; ++i)
+        list.append(i % 3000 == 0 ? QString("abc%1").arg(i) : QString("xyz%1").arg(i));
+    QStringListModel model(list);
+
+    QCompleter completer(&model);
+    QVERIFY(!completer.incrementalFiltering());
+    completer.setIncrementalFiltering(true);
+    QVERIFY(completer.incrementalFiltering());
+
+    QSignalSpy spy(&completer, &QCompleter::filteringFinished);
+    completer.setCompletionPrefix("abc");
+
+    // only enough matches for the popup are gathered synchronously
+    QVERIFY(completer.completionCount() >= 1);
+    QVERIFY(completer.completionCount() <= 10);
+
+    QTRY_COMPARE(spy.size(), 1);
+    QCOMPARE(completer.completionCount(), 10);
+    QCOMPARE(completer.currentCompletion(), QString("abc0"));
+
+    // a prefix without matches finishes as well
+    completer.setCompletionPrefix("none");
+    QTRY_COMPARE(spy.size(), 2);
+    QCOMPARE(completer.completionCount(), 0);
+}
+
 void tst_QCompleter::disabledItems()
 {
     QLineEdit lineEdit;
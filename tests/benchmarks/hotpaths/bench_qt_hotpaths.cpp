@@ -0,0 +1,210 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only
+
+// Aggregates Qt's critical kernels - QString conversion, QHash operations,
+// signal emission, JSON parsing and qdrawhelper blending - in one binary so a
+// Qt upgrade can be checked for hot-path regressions in a single run.
+//
+// The harness pins the process to one CPU before the test object is created
+// (CPU 0 by default; override with QT_BENCH_CPU, or set it to -1 to disable
+// pinning), and initTestCase() touches all benchmark data once so page faults
+// don't land in the measured sections (disable with QT_BENCH_WARMUP=0).
+//
+// For stable numbers combine with testlib's own machinery: -perf or
+// -tickcounter for instruction/cycle counting, -median n for statistical
+// repetition, and -json with the QTEST_BENCHMARK_BASELINE environment
+// variable to diff a run against a stored report.
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qstring.h>
+#include <QtGui/qguiapplication.h>
+#include <QtGui/qimage.h>
+#include <QtGui/qpainter.h>
+#include <qtest.h>
+
+#ifdef Q_OS_LINUX
+#  include <sched.h>
+#endif
+
+Q_DECLARE_METATYPE(QPainter::CompositionMode)
+
+class BenchReceiver : public QObject
+{
+    Q_OBJECT
+public:
+    qint64 sum = 0;
+public slots:
+    void slot(int value) { sum += value; }
+};
+
+class BenchQtHotPaths : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void testSignal(int value);
+
+private slots:
+    void initTestCase();
+
+    void qstringFromUtf8_data();
+    void qstringFromUtf8();
+    void qstringToUtf8();
+    void qhashInsertLookup();
+    void signalEmission();
+    void jsonParse();
+    void drawhelperBlend_data();
+    void drawhelperBlend();
+
+private:
+    QByteArray asciiUtf8;
+    QByteArray mixedUtf8;
+    QString wideString;
+    QByteArray jsonData;
+};
+
+void BenchQtHotPaths::initTestCase()
+{
+    asciiUtf8 = QByteArray("The quick brown fox jumps over the lazy dog. ").repeated(64);
+
+    mixedUtf8.clear();
+    for (int i = 0; i < 64; ++i)
+        mixedUtf8 += QString(u"Größenmaßstäbe — xìnghuì 性能 测试 ☺ ").toUtf8();
+
+    wideString = QString::fromUtf8(mixedUtf8);
+
+    QJsonArray array;
+    for (int i = 0; i < 1000; ++i) {
+        QJsonObject object;
+        object[QStringLiteral("id")] = i;
+        object[QStringLiteral("name")] = QStringLiteral("entry-%1").arg(i);
+        object[QStringLiteral("enabled")] = (i % 2) == 0;
+        object[QStringLiteral("score")] = i * 0.25;
+        array.append(object);
+    }
+    jsonData = QJsonDocument(array).toJson(QJsonDocument::Compact);
+
+    if (qEnvironmentVariableIntValue("QT_BENCH_WARMUP") != 0
+        || !qEnvironmentVariableIsSet("QT_BENCH_WARMUP")) {
+        // Touch every data set once so first-use page faults and lazily
+        // initialized dispatch tables don't pollute the first iteration.
+        (void)QString::fromUtf8(asciiUtf8);
+        (void)QString::fromUtf8(mixedUtf8);
+        (void)wideString.toUtf8();
+        (void)QJsonDocument::fromJson(jsonData);
+        QImage warmup(64, 64, QImage::Format_ARGB32_Premultiplied);
+        warmup.fill(Qt::white);
+        QPainter painter(&warmup);
+        painter.drawImage(0, 0, warmup);
+    }
+}
+
+void BenchQtHotPaths::qstringFromUtf8_data()
+{
+    QTest::addColumn<QByteArray>("utf8");
+    QTest::newRow("ascii") << asciiUtf8;
+    QTest::newRow("multibyte") << mixedUtf8;
+}
+
+void BenchQtHotPaths::qstringFromUtf8()
+{
+    QFETCH(QByteArray, utf8);
+    QBENCHMARK {
+        [[maybe_unused]] const QString s = QString::fromUtf8(utf8);
+    }
+}
+
+void BenchQtHotPaths::qstringToUtf8()
+{
+    QBENCHMARK {
+        [[maybe_unused]] const QByteArray utf8 = wideString.toUtf8();
+    }
+}
+
+void BenchQtHotPaths::qhashInsertLookup()
+{
+    QBENCHMARK {
+        QHash<int, int> hash;
+        for (int i = 0; i < 1000; ++i)
+            hash.insert(i * 17, i);
+        int sum = 0;
+        for (int i = 0; i < 1000; ++i)
+            sum += hash.value(i * 17);
+        QCOMPARE(sum, 999 * 1000 / 2);
+    }
+}
+
+void BenchQtHotPaths::signalEmission()
+{
+    BenchReceiver receiver;
+    connect(this, &BenchQtHotPaths::testSignal, &receiver, &BenchReceiver::slot);
+    QBENCHMARK {
+        emit testSignal(1);
+    }
+    disconnect(this, &BenchQtHotPaths::testSignal, &receiver, &BenchReceiver::slot);
+    QVERIFY(receiver.sum > 0);
+}
+
+void BenchQtHotPaths::jsonParse()
+{
+    QBENCHMARK {
+        const QJsonDocument document = QJsonDocument::fromJson(jsonData);
+        QVERIFY(document.isArray());
+    }
+}
+
+void BenchQtHotPaths::drawhelperBlend_data()
+{
+    QTest::addColumn<QPainter::CompositionMode>("mode");
+    QTest::newRow("SourceOver") << QPainter::CompositionMode_SourceOver;
+    QTest::newRow("Source") << QPainter::CompositionMode_Source;
+}
+
+void BenchQtHotPaths::drawhelperBlend()
+{
+    QFETCH(QPainter::CompositionMode, mode);
+
+    QImage destination(512, 512, QImage::Format_ARGB32_Premultiplied);
+    destination.fill(Qt::white);
+    QImage source(512, 512, QImage::Format_ARGB32_Premultiplied);
+    source.fill(QColor(255, 0, 0, 127));
+
+    QPainter painter(&destination);
+    painter.setCompositionMode(mode);
+    QBENCHMARK {
+        painter.drawImage(0, 0, source);
+    }
+}
+
+static void pinToCpu()
+{
+#ifdef Q_OS_LINUX
+    bool ok = false;
+    int cpu = qEnvironmentVariableIntValue("QT_BENCH_CPU", &ok);
+    if (!ok)
+        cpu = 0;
+    if (cpu < 0)
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        fprintf(stderr, "bench_qt_hotpaths: could not pin to CPU %d, results may be noisy\n",
+                cpu);
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    pinToCpu();
+    QGuiApplication app(argc, argv);
+    BenchQtHotPaths test;
+    QTEST_SET_MAIN_SOURCE_PATH
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "bench_qt_hotpaths.moc"